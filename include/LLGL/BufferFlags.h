@@ -21,6 +21,8 @@ namespace LLGL
 {
 
 
+class VertexFormatHandle;
+
 /* ----- Enumerations ----- */
 
 /**
@@ -162,6 +164,15 @@ struct BufferDescriptor
     \todo Replace this by BufferViewDescriptor
     */
     StorageBuffer                   storageBuffer;
+
+    /**
+    \brief Optional reference to a pre-validated vertex format. By default null.
+    \remarks If this is non-null, it takes precedence over \c vertexAttribs and no further attribute validation is performed,
+    which avoids paying the validation and translation cost for every buffer when many buffers share the same vertex format.
+    The handle only has to remain valid until the buffer has been created.
+    \see VertexFormatHandle
+    */
+    const VertexFormatHandle*       vertexFormatHandle  = nullptr;
 };
 
 
@@ -199,6 +210,13 @@ LLGL_EXPORT bool IsStructuredBuffer(const StorageBufferType type);
 */
 LLGL_EXPORT bool IsByteAddressBuffer(const StorageBufferType type);
 
+/**
+\brief Returns the effective vertex attributes of the specified buffer descriptor.
+\return Reference to the attribute list of \c desc.vertexFormatHandle if it is non-null, or \c desc.vertexAttribs otherwise.
+\see BufferDescriptor::vertexFormatHandle
+*/
+LLGL_EXPORT const std::vector<VertexAttribute>& GetBufferVertexAttribs(const BufferDescriptor& desc);
+
 /** @} */
 
 
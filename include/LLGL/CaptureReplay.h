@@ -0,0 +1,59 @@
+/*
+ * CaptureReplay.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CAPTURE_REPLAY_H
+#define LLGL_CAPTURE_REPLAY_H
+
+
+#include "Export.h"
+#include "RenderSystem.h"
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Wraps the specified render system into the capture layer, which records all subsequent calls to a binary trace file.
+\param[in] renderSystem Specifies the render system to capture. This should be the result of the RenderSystem::Load function.
+\param[in] filename Specifies the filename of the trace file. The file is overwritten if it already exists.
+\return New render system that forwards all calls to the wrapped render system while serializing them to the trace file.
+\remarks The trace file is finalized when the returned render system is unloaded (see RenderSystem::Unload).
+Trace files are intended for offline performance analysis on the machine they were captured on;
+the format is versioned but not portable across architectures or LLGL revisions.
+Calls whose input data cannot be captured are forwarded but not recorded:
+buffer content written through a pointer returned by RenderSystem::MapBuffer,
+and backend specific state set with CommandBuffer::SetGraphicsAPIDependentState.
+The number of such calls is reported through Log::PostReport when the trace is closed.
+\throws std::runtime_error If the trace file cannot be opened for writing.
+\note Replaying a trace with a different renderer than it was captured with only works if the shader code is compatible with both renderers.
+\see ReplayRenderSystemTrace
+\see RenderSystem::Load
+*/
+LLGL_EXPORT std::unique_ptr<RenderSystem> CaptureRenderSystem(std::unique_ptr<RenderSystem>&& renderSystem, const char* filename);
+
+/**
+\brief Reads the specified trace file and re-executes all captured operations on the specified render system.
+\param[in] renderSystem Specifies the render system the captured operations are replayed on. This must not be the capture layer itself.
+\param[in] filename Specifies the filename of a trace file previously recorded with the capture layer.
+\remarks Render contexts captured in the trace are re-created with their own surfaces during replay.
+A warning is reported if the trace was captured with a different renderer than the specified render system.
+\throws std::runtime_error If the trace file cannot be opened, is malformed, or LLGL was not compiled with capture layer support.
+\see CaptureRenderSystem
+*/
+LLGL_EXPORT void ReplayRenderSystemTrace(RenderSystem& renderSystem, const char* filename);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
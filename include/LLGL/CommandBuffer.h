@@ -25,6 +25,8 @@
 #include "GraphicsPipeline.h"
 #include "ComputePipeline.h"
 #include "QueryHeap.h"
+#include "IndirectArguments.h"
+#include "CommandStream.h"
 
 #include <cstdint>
 
@@ -40,6 +42,10 @@ class RenderContext;
 \remarks This is the main interface to encode graphics, compute, and blit commands to be submitted to the GPU.
 You can assume that all states that can be changed with a setter function are not persistent across several encoding sections, unless the opposite is mentioned.
 Before any command can be encoded, the command buffer must be set into encode mode, which is done by the CommandBuffer::Begin function.
+\remarks A command buffer is \e not thread safe, but distinct command buffers can be encoded by distinct threads simultaneously:
+create one deferred command buffer per worker thread (see CommandBufferFlags::DeferredSubmit),
+encode them concurrently, and either execute them in a primary command buffer (see Execute)
+or submit them as an ordered batch (see CommandQueue::Submit(std::uint32_t, CommandBuffer* const *)).
 \see RenderSystem::CreateCommandBuffer
 */
 class LLGL_EXPORT CommandBuffer : public RenderSystemChild
@@ -73,11 +79,40 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         \param[in] deferredCommandBuffer Specifies the deferred command buffer which is meant to be executed.
         This command buffer must have been created with the flag CommandBufferFlags::DeferredSubmit.
         \remarks This function can only be used by primary command buffers, i.e. command buffers that have not been created with the flag CommandBufferFlags::DeferredSubmit.
+        \remarks The deferred command buffer must have finished encoding (see End) before it can be executed.
+        This is the intended mechanism to replay command buffers that have been recorded by multiple worker threads.
+        \remarks To execute a deferred command buffer inside an active render pass section (e.g. in the Vulkan backend),
+        the deferred command buffer must have been recorded with a render pass section for the same render target,
+        so the backend can inherit the render pass state.
         \see CommandBufferFlags
-        \todo Incomplete for: D3D12, Vulkan, Metal.
+        \todo Incomplete for: Metal.
         */
         virtual void Execute(CommandBuffer& deferredCommandBuffer) = 0;
 
+        /**
+        \brief Executes a tokenized command stream, i.e. a densely packed sequence of encoded commands in CPU memory.
+        \param[in] stream Raw pointer to the first command of the stream. This <b>must not</b> be null!
+        \param[in] size Specifies the size (in bytes) of the command stream.
+        \remarks Each command in the stream consists of a single opcode byte (see CmdOpcode)
+        immediately followed by its payload structure, e.g. CmdDraw for the CmdOpcodeDraw opcode.
+        This allows command streams to be generated in client memory (e.g. by job systems)
+        and to be replayed with a single call instead of one virtual call per command.
+        \remarks The default implementation decodes the stream and dispatches each command to the respective member function.
+        \throws std::invalid_argument If the stream contains an unknown opcode.
+        \see CmdOpcode
+        \code
+        // Example of manually encoding a draw command:
+        char stream[1 + sizeof(LLGL::CmdDraw)];
+        stream[0] = LLGL::CmdOpcodeDraw;
+        LLGL::CmdDraw drawCmd;
+        drawCmd.numVertices = 3;
+        drawCmd.firstVertex = 0;
+        ::memcpy(stream + 1, &drawCmd, sizeof(drawCmd));
+        myCmdBuffer->ExecuteStream(stream, sizeof(stream));
+        \endcode
+        */
+        virtual void ExecuteStream(const void* stream, std::size_t size);
+
         /* ----- Blitting ----- */
 
         /**
@@ -147,6 +182,35 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         virtual void BlitTexture(Texture& dstTexture, Texture& srcTexture, [...], Filter filter) = 0;
         #endif
 
+        /**
+        \brief Begins a batch of copy commands.
+        \remarks Copy commands (i.e. CopyBuffer, CopyTexture, and UpdateBuffer) that are encoded between \c BeginCopyBatch
+        and \c EndCopyBatch may be grouped by the renderer: same-direction transfers can be merged into fewer native commands
+        and the resource synchronization is hoisted to the batch edges,
+        so a frame prologue with many copy commands no longer pays for per-copy barrier management.
+        \remarks Only copy commands may be encoded inside a copy batch and the batch must be encoded outside of a render pass.
+        Copy batches must not be nested. For renderers without copy batching, this function has no effect.
+        \code
+        // Encode the frame prologue uploads as a single batch:
+        myCmdBuffer->BeginCopyBatch();
+        {
+            myCmdBuffer->CopyBuffer(*myVertexBuffer, 0, *myStagingBuffer, 0, myVertexDataSize);
+            myCmdBuffer->CopyBuffer(*myIndexBuffer, 0, *myStagingBuffer, myVertexDataSize, myIndexDataSize);
+            myCmdBuffer->UpdateBuffer(*myConstantBuffer, 0, &mySettings, sizeof(mySettings));
+        }
+        myCmdBuffer->EndCopyBatch();
+        \endcode
+        \see EndCopyBatch
+        */
+        virtual void BeginCopyBatch();
+
+        /**
+        \brief Ends a batch of copy commands, previously begun with \c BeginCopyBatch.
+        \remarks This flushes all pending copy commands of the batch and makes their writes visible to subsequent commands.
+        \see BeginCopyBatch
+        */
+        virtual void EndCopyBatch();
+
         /**
         \brief Generates all MIP-maps for the specified texture.
         \param[in,out] texture Specifies the texture whose MIP-maps are to be generated.
@@ -367,6 +431,27 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) = 0;
 
+        /**
+        \brief Binds the specified resource heap to the graphics pipeline with dynamic buffer offsets.
+        \param[in] resourceHeap Specifies the resource heap that contains all shader resources that will be bound to the shader pipeline.
+        \param[in] firstSet Specifies the set number of the first layout descriptor.
+        \param[in] numDynamicOffsets Specifies the number of entries in the \c dynamicOffsets array.
+        This must match the number of bindings declared with a dynamic offset in the pipeline layout.
+        \param[in] dynamicOffsets Pointer to the array of buffer offsets (in bytes), one for each dynamic binding
+        in ascending order of the binding slots that are declared as dynamic. This must not be null if \c numDynamicOffsets is non-zero.
+        \remarks This allows a single resource heap to be reused for many draw calls that only differ in a buffer offset.
+        Renderers that do not support dynamic offsets ignore them and bind the buffers at their base offset.
+        \note Only supported with: Vulkan, OpenGL.
+        \see BindingDescriptor::dynamicOffset
+        */
+        virtual void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets);
+
+        /**
+        \brief Binds the specified resource heap to the compute pipeline with dynamic buffer offsets.
+        \see SetGraphicsResourceHeap(ResourceHeap&, std::uint32_t, std::uint32_t, const std::uint32_t*)
+        */
+        virtual void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets);
+
         /**
         \brief Sets the specified resource to a binding slot.
         \param[in] resource Specifies the resource to set.
@@ -414,6 +499,35 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             long                stageFlags      = StageFlags::AllStages
         ) = 0;
 
+        /**
+        \brief Begins a split transition of the specified resource into a new usage.
+        \param[in] resource Specifies the resource to transition.
+        \param[in] bindFlags Specifies the usage the resource is transitioned into.
+        This can be a bitwise OR combination of the BindFlags entries and is typically BindFlags::Sampled,
+        i.e. the output of a previous pass becomes a shader input of a later pass.
+        \remarks A split transition tells the renderer that the resource will no longer be written in its current usage,
+        without stalling the pipeline at this point: independent work recorded between \c BeginResourceTransition and
+        \c EndResourceTransition can overlap with the transition, hiding the barrier latency.
+        The resource must not be accessed between the begin and the end of a split transition,
+        and each \c BeginResourceTransition must be matched by an \c EndResourceTransition with the same parameters
+        within the same command buffer.
+        \remarks For renderers that handle resource transitions implicitly, this function has no effect.
+        \note Only supported with: Direct3D 12, Vulkan.
+        \see EndResourceTransition
+        */
+        virtual void BeginResourceTransition(Resource& resource, long bindFlags);
+
+        /**
+        \brief Ends a split transition of the specified resource, previously begun with \c BeginResourceTransition.
+        \param[in] resource Specifies the resource to transition.
+        \param[in] bindFlags Specifies the usage the resource is transitioned into.
+        This must be the same value that was passed to the matching \c BeginResourceTransition.
+        \remarks Call this just before the resource is consumed in its new usage.
+        \note Only supported with: Direct3D 12, Vulkan.
+        \see BeginResourceTransition
+        */
+        virtual void EndResourceTransition(Resource& resource, long bindFlags);
+
         /* ----- Render Passes ----- */
 
         /**
@@ -709,6 +823,23 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
 
+        /**
+        \brief Draws an unknown amount of instances of primitives with a draw count that is read from a buffer object by the GPU.
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BufferFlags::IndirectBinding flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the draw count is taken. This buffer must have been created with the BufferFlags::IndirectBinding flag.
+        \param[in] countOffset Specifies an offset within the count buffer at which the draw count is stored as a single 32-bit unsigned integer. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands that can be taken from the argument buffer. The GPU clamps the draw count to this value.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawIndirectArguments)</code>. This stride must be a multiple of 4.
+        \remarks The draw count is read on the GPU timeline, e.g. as produced by a culling compute shader,
+        which avoids a CPU readback of the count between the culling dispatch and the draw command.
+        \note Only supported with: Direct3D 12, Vulkan (requires the \c VK_KHR_draw_indirect_count extension).
+        \see DrawIndirectArguments
+        \see RenderingFeatures::hasDrawIndirectCount
+        */
+        virtual void DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride);
+
         /**
         \brief Draws an unknown amount of instances of primitives whose indexed draw command arguments are taken from a buffer object.
         \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BufferFlags::IndirectBinding flag.
@@ -737,6 +868,82 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
 
+        /**
+        \brief Draws an unknown amount of instances of primitives with a draw count that is read from a buffer object by the GPU.
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BufferFlags::IndirectBinding flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the draw count is taken. This buffer must have been created with the BufferFlags::IndirectBinding flag.
+        \param[in] countOffset Specifies an offset within the count buffer at which the draw count is stored as a single 32-bit unsigned integer. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands that can be taken from the argument buffer. The GPU clamps the draw count to this value.
+        \param[in] stride Specifies the stride (in bytes) betweeen consecutive sets of arguments,
+        which is commonly greater than or euqal to <code>sizeof(DrawIndexedIndirectArguments)</code>. This stride must be a multiple of 4.
+        \note Only supported with: Direct3D 12, Vulkan (requires the \c VK_KHR_draw_indirect_count extension).
+        \see DrawIndirect(Buffer&, std::uint64_t, Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+        \see DrawIndexedIndirectArguments
+        \see RenderingFeatures::hasDrawIndirectCount
+        */
+        virtual void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride);
+
+        /**
+        \brief Draws multiple sets of primitives whose draw command arguments are taken from an array in CPU memory space.
+        \param[in] numCommands Specifies the number of draw commands in the argument array.
+        \param[in] commands Pointer to the array of draw command arguments. This must not be null, if \c numCommands is greater than zero.
+        \remarks This amortizes the per-call overhead (such as virtual dispatch, debug layer validation, and profiling)
+        over the entire batch, which reduces the recording cost for scenes that issue many CPU-culled draw calls.
+        The default implementation records the draw commands with a loop, which is equivalent to the following example:
+        \code
+        for (std::uint32_t i = 0; i < numCommands; ++i)
+        {
+            DrawInstanced(
+                commands[i].numVertices,
+                commands[i].firstVertex,
+                commands[i].numInstances,
+                commands[i].firstInstance
+            );
+        }
+        \endcode
+        \see DrawIndirectArguments
+        */
+        virtual void DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands);
+
+        /**
+        \brief Draws multiple sets of indexed primitives whose draw command arguments are taken from an array in CPU memory space.
+        \param[in] numCommands Specifies the number of draw commands in the argument array.
+        \param[in] commands Pointer to the array of draw command arguments. This must not be null, if \c numCommands is greater than zero.
+        \remarks The default implementation records the draw commands with a loop, which is equivalent to the following example:
+        \code
+        for (std::uint32_t i = 0; i < numCommands; ++i)
+        {
+            DrawIndexedInstanced(
+                commands[i].numIndices,
+                commands[i].numInstances,
+                commands[i].firstIndex,
+                commands[i].vertexOffset,
+                commands[i].firstInstance
+            );
+        }
+        \endcode
+        \see DrawMulti
+        \see DrawIndexedIndirectArguments
+        */
+        virtual void DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands);
+
+        /**
+        \brief Draws a mesh shading command with the specified number of task shader work groups.
+        \param[in] numWorkGroups Specifies the number of task shader work groups to launch.
+        If the bound shader program has no task shader, this specifies the number of mesh shader work groups instead.
+        \param[in] firstWorkGroup Specifies the zero-based index of the first work group.
+        \remarks This can only be used with a shader program that contains a mesh shader (and optionally a task shader)
+        and it replaces the vertex input stages of the graphics pipeline,
+        i.e. no vertex buffer or index buffer is involved and the vertex input layout is bypassed.
+        This maps to \c vkCmdDrawMeshTasksNV for Vulkan.
+        \note Only supported with: Vulkan (requires the \c VK_NV_mesh_shader extension).
+        \see ShaderProgramDescriptor::meshShader
+        \see RenderingFeatures::hasMeshShaders
+        \throws std::runtime_error If the renderer does not support mesh shaders.
+        */
+        virtual void DrawMeshTasks(std::uint32_t numWorkGroups, std::uint32_t firstWorkGroup = 0);
+
         /* ----- Compute ----- */
 
         /**
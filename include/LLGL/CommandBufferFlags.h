@@ -49,6 +49,10 @@ struct CommandBufferFlags
         /**
         \brief Specifies that the encoded command buffer will be submitted as a secondary command buffer.
         \remarks If this is specified, the command buffer must be submitted using the \c Execute function of a primary command buffer.
+        \remarks In the Direct3D 12 backend, such a command buffer is recorded as a bundle:
+        it inherits render targets, viewports, and scissor rectangles from the primary command buffer
+        and is intended for small command sequences (e.g. UI passes with many repeated draws)
+        that are recorded once and replayed every frame with minimal encoding cost.
         \see CommandBuffer::Execute
         */
         DeferredSubmit  = (1 << 0),
@@ -56,9 +60,37 @@ struct CommandBufferFlags
         /**
         \brief Specifies that the encoded command buffer can be submitted multiple times.
         \remarks If this is not specified, the command buffer must be encoded again after it has been submitted to the command queue.
+        \remarks After the \c End function has been called, the command buffer is considered immutable until the next call to \c Begin.
+        Such a command buffer can be recorded once (e.g. for static scene passes) and then replayed every frame with no re-encoding cost.
+        In the OpenGL backend, this replays the deferred command stream (or its JIT-compiled executable),
+        and in the Vulkan backend, the native command buffer is re-submitted without being reset.
         \see CommandQueue::Submit(CommandBuffer&)
+        \see CommandBuffer::End
         */
         MultiSubmit     = (1 << 1),
+
+        /**
+        \brief Specifies that the command buffer is encoded for the compute command queue.
+        \remarks If this is specified, only compute and transfer commands (e.g. \c Dispatch, \c UpdateBuffer, \c CopyBuffer)
+        must be encoded into this command buffer, and it must be submitted to the queue returned by RenderSystem::GetComputeCommandQueue.
+        Work on the compute queue runs concurrently to the graphics queue and must be synchronized with fences.
+        \note Only supported with: Direct3D 12, Vulkan (only if the device has a dedicated compute queue family).
+        \see RenderSystem::GetComputeCommandQueue
+        \see CommandQueue::Wait
+        */
+        ComputeOnly     = (1 << 2),
+
+        /**
+        \brief Specifies that the command buffer is encoded for a transfer command queue.
+        \remarks If this is specified, only transfer commands (e.g. \c UpdateBuffer, \c CopyBuffer, \c CopyTexture)
+        must be encoded into this command buffer, and it must be submitted to a queue returned by
+        <code>RenderSystem::GetCommandQueue(CommandQueueType::Transfer)</code>.
+        Work on the transfer queue runs concurrently to the graphics queue and must be synchronized with fences.
+        \note Only supported with: Direct3D 12.
+        \see RenderSystem::GetCommandQueue(const CommandQueueType, std::uint32_t)
+        \see CommandQueue::Wait
+        */
+        TransferOnly    = (1 << 3),
     };
 };
 
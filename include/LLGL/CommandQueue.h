@@ -50,13 +50,55 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void Submit(CommandBuffer& commandBuffer) = 0;
 
-        #if 0
         /**
         \brief Submits all command buffers in the specified array to the command queue at once.
+        \param[in] numCommandBuffers Specifies the number of command buffers in the array. This must be greater than zero.
+        \param[in] commandBuffers Pointer to the array of command buffers. This must not be null.
+        \remarks The command buffers are submitted in the order they appear in the array,
+        i.e. the GPU starts the execution of <code>commandBuffers[N]</code> before the execution of <code>commandBuffers[N+1]</code>.
+        This makes it possible to record the individual command buffers on separate worker threads and submit them as an ordered batch:
+        \code
+        // Record each command buffer on its own thread (one command buffer per thread)
+        for (int i = 0; i < numThreads; ++i)
+            workerThreads[i] = std::thread(RecordSceneCommands, myCmdBuffers[i], i);
+        for (int i = 0; i < numThreads; ++i)
+            workerThreads[i].join();
+
+        // Submit the entire batch in deterministic order
+        myCmdQueue->Submit(numThreads, myCmdBuffers);
+        \endcode
+        \remarks A command buffer must only be recorded by one thread at a time,
+        but different command buffers can be recorded by different threads simultaneously.
         \see Submit(CommandBuffer&)
+        \see RenderSystem::CreateCommandBuffer
         */
         virtual void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers);
-        #endif
+
+        /* ----- Sparse Resources ----- */
+
+        /**
+        \brief Binds or evicts device memory for a range of MIP-map levels of a sparse texture.
+        \param[in] texture Specifies the texture whose residency is to be updated.
+        This texture must have been created with the MiscFlags::SparseResidency flag.
+        \param[in] baseMipLevel Specifies the zero-based index of the first MIP-map level whose residency is to be updated.
+        \param[in] numMipLevels Specifies the number of MIP-map levels whose residency is to be updated. This must not be zero.
+        \param[in] resident Specifies whether the MIP-map levels are to be made resident (if true) or evicted (if false).
+        \return True on success, or false if the texture is not a sparse texture or sparse textures are not supported.
+        \remarks This can be used to stream large textures one MIP-map level at a time,
+        e.g. by initially only making the lowest MIP-map levels resident and streaming in higher ones as the viewer gets closer.
+        All MIP-map levels at or beyond the driver's "MIP tail" are bound and evicted as a whole.
+        This is a blocking operation, i.e. it waits until the sparse binding has completed on the GPU,
+        so it should be performed on a streaming thread rather than in the middle of a frame.
+        \note Only supported with: Vulkan.
+        \see MiscFlags::SparseResidency
+        \see RenderingFeatures::hasSparseTextures
+        */
+        virtual bool BindSparseTexture(
+            Texture&        texture,
+            std::uint32_t   baseMipLevel,
+            std::uint32_t   numMipLevels,
+            bool            resident
+        );
 
         /* ----- Queries ----- */
 
@@ -95,11 +137,58 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
             std::size_t     dataSize
         ) = 0;
 
+        /**
+        \brief Probes whether the results of the specified queries are available, without retrieving any data.
+        \param[in] queryHeap Specifies the query heap.
+        \param[in] firstQuery Specifies the zero-based index of the first query within the heap.
+        This must be in the half-open range [0, QueryHeapDescriptor::numQueries).
+        \param[in] numQueries Specifies the number of queries to probe.
+        This must be less than or equal to (QueryHeapDescriptor::numQueries - firstQuery) and it must not be zero.
+        \return True, if the results of all queries in the specified range are available.
+        \remarks In contrast to \c QueryResult, this never blocks and never copies any query data,
+        so it can be used to poll for completion before retrieving an entire batch of results in one call:
+        \code
+        // Fetch all 128 occlusion query results at once, but only when they are ready
+        std::uint64_t occlusionQueryResults[128] = {};
+        if (myCmdQueue->QueryResultAvailable(*myOcclusionQuery, 0, 128))
+            myCmdQueue->QueryResult(*myOcclusionQuery, 0, 128, occlusionQueryResults, sizeof(occlusionQueryResults));
+        \endcode
+        \remarks The default implementation always returns true.
+        Renderers without a dedicated probe rely on \c QueryResult returning false for unavailable results.
+        \see QueryResult
+        */
+        virtual bool QueryResultAvailable(
+            QueryHeap&      queryHeap,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries
+        );
+
         /* ----- Fences ----- */
 
         //! Submits the specified fence to the command queue for CPU/GPU synchronization.
         virtual void Submit(Fence& fence) = 0;
 
+        /**
+        \brief Makes this command queue wait on the GPU timeline until the specified fence has been signaled.
+        \param[in] fence Specifies the fence that has been (or will be) submitted to another command queue via \c Submit.
+        \remarks In contrast to \c WaitFence, this does not block the CPU:
+        only the GPU execution of subsequently submitted command buffers is delayed until the fence has been signaled.
+        This is used to synchronize work between the graphics and the compute queue:
+        \code
+        // Produce data on the compute queue and signal the fence
+        myComputeQueue->Submit(*myComputeCmdBuffer);
+        myComputeQueue->Submit(*myFence);
+
+        // Make the graphics queue wait for the compute results before consuming them
+        myCmdQueue->Wait(*myFence);
+        myCmdQueue->Submit(*myCmdBuffer);
+        \endcode
+        \remarks For renderers with a single implicit queue, all submissions are ordered anyway and this function has no effect.
+        \see Submit(Fence&)
+        \see RenderSystem::GetComputeCommandQueue
+        */
+        virtual void Wait(Fence& fence);
+
         /**
         \brief Blocks the CPU execution until the specified fence has been signaled.
         \param[in] fence Specifies the fence for which the CPU needs to wait to be signaled.
@@ -110,6 +199,79 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual bool WaitFence(Fence& fence, std::uint64_t timeout) = 0;
 
+        /**
+        \brief Blocks the CPU execution until one or all of the specified fences have been signaled.
+        \param[in] numFences Specifies the number of fences in the array. This must be greater than zero.
+        \param[in] fences Pointer to the array of fences. This must not be null.
+        \param[in] waitAll Specifies whether to wait until all fences have been signaled (if true),
+        or until at least one of them has been signaled (if false).
+        \param[in] timeout Specifies the waiting timeout (in nanoseconds).
+        \return True if the wait condition was satisfied before the timeout expired.
+        \remarks This is meant for systems that keep several workloads in flight,
+        e.g. a streaming thread that blocks until any one of its pending uploads has completed:
+        \code
+        // Block until at least one of the in-flight uploads has completed
+        if (myCmdQueue->WaitFences(numUploads, myUploadFences, false, ~0ull))
+            ReuseCompletedUploadSlots();
+        \endcode
+        \remarks This is mapped to \c vkWaitForFences with Vulkan and \c WaitForMultipleObjects with Direct3D 12.
+        The default implementation waits for the fences one at a time (if \c waitAll is true)
+        or polls them via \c IsSignaled (otherwise).
+        \see WaitFence
+        \see IsSignaled
+        */
+        virtual bool WaitFences(std::uint32_t numFences, Fence* const * fences, bool waitAll, std::uint64_t timeout);
+
+        /**
+        \brief Returns true if the specified fence has been signaled, without blocking the CPU.
+        \remarks Equivalent to <code>WaitFence(fence, 0)</code>,
+        but renderers with a dedicated status query avoid the per-call event setup of a full wait.
+        \see WaitFence
+        */
+        virtual bool IsSignaled(Fence& fence);
+
+        /**
+        \brief Submits a timeline signal to the command queue, which sets the fence to the specified value once the GPU reaches it.
+        \param[in] fence Specifies the fence whose timeline value is to be signaled.
+        \param[in] value Specifies the new timeline value. Values must increase monotonically for each fence.
+        \remarks A timeline fence replaces one binary fence per synchronization event:
+        a producer signals increasing values (e.g. one per frame) and consumers wait for the values they depend on,
+        all with a single fence object.
+        \code
+        // Producer: stream data for frame N and bump the timeline
+        myTransferQueue->Submit(*myUploadCmdBuffer);
+        myTransferQueue->Signal(*myFence, frameNumber);
+
+        // Consumer: wait until the uploads for frame N have completed
+        myCmdQueue->WaitFenceValue(*myFence, frameNumber, ~0ull);
+        \endcode
+        \remarks This is mapped to \c ID3D12Fence values with Direct3D 12 and emulated on top of binary fences elsewhere.
+        The emulation keeps at most one signal in flight per fence and retires a previous pending signal
+        by blocking the CPU before the next one is submitted.
+        \see WaitFenceValue
+        \see GetFenceValue
+        */
+        virtual void Signal(Fence& fence, std::uint64_t value);
+
+        /**
+        \brief Blocks the CPU execution until the timeline value of the specified fence has reached the specified value.
+        \param[in] fence Specifies the fence for which the CPU needs to wait.
+        \param[in] value Specifies the timeline value to wait for. The wait is satisfied once the completed value is greater than or equal to this value.
+        \param[in] timeout Specifies the waiting timeout (in nanoseconds).
+        \return True on success, or false if the wait timed out.
+        \note With the emulated timeline, the value must already have been submitted with \c Signal before this function is called;
+        waiting for a value that has not been signaled yet returns false immediately.
+        \see Signal
+        */
+        virtual bool WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout);
+
+        /**
+        \brief Returns the last completed timeline value of the specified fence without blocking the CPU.
+        \see Signal
+        \see WaitFenceValue
+        */
+        virtual std::uint64_t GetFenceValue(Fence& fence);
+
         /**
         \brief Blocks the CPU execution until the entire GPU command queue has been completed.
         \remarks To wait for a specific point in the command queue, use fences.
@@ -126,6 +288,11 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
 
         CommandQueue() = default;
 
+    private:
+
+        //! Raises the completed timeline value of the specified fence to the specified value.
+        static void RaiseCompletedFenceValue(Fence& fence, std::uint64_t value);
+
 };
 
 
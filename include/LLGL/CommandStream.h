@@ -0,0 +1,241 @@
+/*
+ * CommandStream.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_COMMAND_STREAM_H
+#define LLGL_COMMAND_STREAM_H
+
+
+#include "ForwardDecls.h"
+#include "Format.h"
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Enumerations ----- */
+
+/**
+\defgroup group_command_stream Tokenized command stream for batched command buffer encoding.
+\addtogroup group_command_stream
+@{
+*/
+
+/**
+\brief Command opcode enumeration for tokenized command streams.
+\remarks A command stream is a densely packed sequence of commands in CPU memory:
+each command consists of a single opcode byte immediately followed by its payload structure (if the opcode has one),
+and the next command starts right after that payload.
+This allows engines to build command streams in their own memory (e.g. generated by job systems)
+and submit them with a single call instead of one virtual call per command.
+\see CommandBuffer::ExecuteStream
+*/
+enum CmdOpcode : std::uint8_t
+{
+    CmdOpcodeSetViewport = 1,           //!< Payload is CmdSetViewport.
+    CmdOpcodeSetScissor,                //!< Payload is CmdSetScissor.
+    CmdOpcodeSetClearColor,             //!< Payload is CmdSetClearColor.
+    CmdOpcodeSetClearDepth,             //!< Payload is CmdSetClearDepth.
+    CmdOpcodeSetClearStencil,           //!< Payload is CmdSetClearStencil.
+    CmdOpcodeClear,                     //!< Payload is CmdClear.
+    CmdOpcodeUpdateBuffer,              //!< Payload is CmdUpdateBuffer plus trailing data.
+    CmdOpcodeSetVertexBuffer,           //!< Payload is CmdSetVertexBuffer.
+    CmdOpcodeSetVertexBufferArray,      //!< Payload is CmdSetVertexBufferArray.
+    CmdOpcodeSetIndexBuffer,            //!< Payload is CmdSetIndexBuffer.
+    CmdOpcodeSetIndexBufferFormat,      //!< Payload is CmdSetIndexBufferFormat.
+    CmdOpcodeSetGraphicsResourceHeap,   //!< Payload is CmdSetGraphicsResourceHeap.
+    CmdOpcodeSetComputeResourceHeap,    //!< Payload is CmdSetComputeResourceHeap.
+    CmdOpcodeBeginRenderPass,           //!< Payload is CmdBeginRenderPass plus trailing clear values.
+    CmdOpcodeEndRenderPass,             //!< No payload.
+    CmdOpcodeSetGraphicsPipeline,       //!< Payload is CmdSetGraphicsPipeline.
+    CmdOpcodeSetComputePipeline,        //!< Payload is CmdSetComputePipeline.
+    CmdOpcodeDraw,                      //!< Payload is CmdDraw.
+    CmdOpcodeDrawIndexed,               //!< Payload is CmdDrawIndexed.
+    CmdOpcodeDrawInstanced,             //!< Payload is CmdDrawInstanced.
+    CmdOpcodeDrawIndexedInstanced,      //!< Payload is CmdDrawIndexedInstanced.
+    CmdOpcodeDispatch,                  //!< Payload is CmdDispatch.
+};
+
+
+/* ----- Structures ----- */
+
+//! Payload structure for the CmdOpcodeSetViewport command.
+struct CmdSetViewport
+{
+    float x;            //!< X coordinate of the left-top origin. \see Viewport::x
+    float y;            //!< Y coordinate of the left-top origin. \see Viewport::y
+    float width;        //!< Width of the viewport rectangle. \see Viewport::width
+    float height;       //!< Height of the viewport rectangle. \see Viewport::height
+    float minDepth;     //!< Minimum depth range. \see Viewport::minDepth
+    float maxDepth;     //!< Maximum depth range. \see Viewport::maxDepth
+};
+
+//! Payload structure for the CmdOpcodeSetScissor command.
+struct CmdSetScissor
+{
+    std::int32_t x;         //!< Left-top X coordinate. \see Scissor::x
+    std::int32_t y;         //!< Left-top Y coordinate. \see Scissor::y
+    std::int32_t width;     //!< Width of the scissor rectangle. \see Scissor::width
+    std::int32_t height;    //!< Height of the scissor rectangle. \see Scissor::height
+};
+
+//! Payload structure for the CmdOpcodeSetClearColor command.
+struct CmdSetClearColor
+{
+    float color[4];     //!< RGBA clear color. \see CommandBuffer::SetClearColor
+};
+
+//! Payload structure for the CmdOpcodeSetClearDepth command.
+struct CmdSetClearDepth
+{
+    float depth;        //!< Depth clear value. \see CommandBuffer::SetClearDepth
+};
+
+//! Payload structure for the CmdOpcodeSetClearStencil command.
+struct CmdSetClearStencil
+{
+    std::uint32_t stencil;  //!< Stencil clear value. \see CommandBuffer::SetClearStencil
+};
+
+//! Payload structure for the CmdOpcodeClear command.
+struct CmdClear
+{
+    long flags;         //!< Clear buffer flags. \see ClearFlags
+};
+
+/**
+\brief Payload structure for the CmdOpcodeUpdateBuffer command.
+\remarks The payload is immediately followed by \c dataSize bytes of data which are written to the destination buffer.
+\see CommandBuffer::UpdateBuffer
+*/
+struct CmdUpdateBuffer
+{
+    Buffer*         dstBuffer;  //!< Destination buffer.
+    std::uint64_t   dstOffset;  //!< Destination offset (in bytes).
+    std::uint16_t   dataSize;   //!< Size (in bytes) of the trailing data block.
+//  std::int8_t     data[dataSize];
+};
+
+//! Payload structure for the CmdOpcodeSetVertexBuffer command.
+struct CmdSetVertexBuffer
+{
+    Buffer* buffer;     //!< Vertex buffer to bind.
+};
+
+//! Payload structure for the CmdOpcodeSetVertexBufferArray command.
+struct CmdSetVertexBufferArray
+{
+    BufferArray* bufferArray;   //!< Vertex buffer array to bind.
+};
+
+//! Payload structure for the CmdOpcodeSetIndexBuffer command.
+struct CmdSetIndexBuffer
+{
+    Buffer* buffer;     //!< Index buffer to bind.
+};
+
+//! Payload structure for the CmdOpcodeSetIndexBufferFormat command.
+struct CmdSetIndexBufferFormat
+{
+    Buffer*         buffer;     //!< Index buffer to bind.
+    Format          format;     //!< Index format, must be either Format::R16UInt or Format::R32UInt.
+    std::uint64_t   offset;     //!< Offset (in bytes) at which the index buffer is bound.
+};
+
+//! Payload structure for the CmdOpcodeSetGraphicsResourceHeap command.
+struct CmdSetGraphicsResourceHeap
+{
+    ResourceHeap*   resourceHeap;   //!< Resource heap to bind.
+    std::uint32_t   firstSet;       //!< First descriptor set. \see CommandBuffer::SetGraphicsResourceHeap
+};
+
+//! Payload structure for the CmdOpcodeSetComputeResourceHeap command.
+struct CmdSetComputeResourceHeap
+{
+    ResourceHeap*   resourceHeap;   //!< Resource heap to bind.
+    std::uint32_t   firstSet;       //!< First descriptor set. \see CommandBuffer::SetComputeResourceHeap
+};
+
+/**
+\brief Payload structure for the CmdOpcodeBeginRenderPass command.
+\remarks The payload is immediately followed by \c numClearValues entries of type ClearValue.
+\see CommandBuffer::BeginRenderPass
+*/
+struct CmdBeginRenderPass
+{
+    RenderTarget*       renderTarget;   //!< Render target or render context to begin rendering into.
+    const RenderPass*   renderPass;     //!< Optional render pass object, may be null.
+    std::uint32_t       numClearValues; //!< Number of trailing clear value entries.
+//  ClearValue          clearValues[numClearValues];
+};
+
+//! Payload structure for the CmdOpcodeSetGraphicsPipeline command.
+struct CmdSetGraphicsPipeline
+{
+    GraphicsPipeline* graphicsPipeline; //!< Graphics pipeline state to bind.
+};
+
+//! Payload structure for the CmdOpcodeSetComputePipeline command.
+struct CmdSetComputePipeline
+{
+    ComputePipeline* computePipeline;   //!< Compute pipeline state to bind.
+};
+
+//! Payload structure for the CmdOpcodeDraw command.
+struct CmdDraw
+{
+    std::uint32_t numVertices;  //!< Number of vertices to draw.
+    std::uint32_t firstVertex;  //!< First vertex index.
+};
+
+//! Payload structure for the CmdOpcodeDrawIndexed command.
+struct CmdDrawIndexed
+{
+    std::uint32_t   numIndices;     //!< Number of indices to draw.
+    std::uint32_t   firstIndex;     //!< First index within the index buffer.
+    std::int32_t    vertexOffset;   //!< Offset added to each index.
+};
+
+//! Payload structure for the CmdOpcodeDrawInstanced command.
+struct CmdDrawInstanced
+{
+    std::uint32_t numVertices;      //!< Number of vertices to draw.
+    std::uint32_t firstVertex;      //!< First vertex index.
+    std::uint32_t numInstances;     //!< Number of instances to draw.
+    std::uint32_t firstInstance;    //!< First instance index.
+};
+
+//! Payload structure for the CmdOpcodeDrawIndexedInstanced command.
+struct CmdDrawIndexedInstanced
+{
+    std::uint32_t   numIndices;     //!< Number of indices to draw.
+    std::uint32_t   numInstances;   //!< Number of instances to draw.
+    std::uint32_t   firstIndex;     //!< First index within the index buffer.
+    std::int32_t    vertexOffset;   //!< Offset added to each index.
+    std::uint32_t   firstInstance;  //!< First instance index.
+};
+
+//! Payload structure for the CmdOpcodeDispatch command.
+struct CmdDispatch
+{
+    std::uint32_t groupSizeX;   //!< Number of thread groups in X dimension.
+    std::uint32_t groupSizeY;   //!< Number of thread groups in Y dimension.
+    std::uint32_t groupSizeZ;   //!< Number of thread groups in Z dimension.
+};
+
+/** @} */
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,160 @@
+/*
+ * ConstantRing.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CONSTANT_RING_H
+#define LLGL_CONSTANT_RING_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Helper class for allocation-free per-draw constant data.
+\remarks This class owns one large constant buffer that is divided into equally sized per-frame regions.
+Constant data is sub-allocated from the current region with proper offset alignment and written through a CPU side shadow copy,
+so each draw call only differs in the dynamic offset of its constant-buffer binding (see BindingDescriptor::dynamicOffset)
+and no buffers are created or discarded at runtime.
+A fence per region guarantees that a region is only reused after the GPU has finished reading from it.
+\code
+LLGL::ConstantRing myConstants { *myRenderSystem, 64 * 1024 };
+
+// Declare the constant-buffer binding with a dynamic offset and
+// bind myConstants.GetBuffer() in the resource heap ...
+
+// Every frame:
+for (const auto& obj : mySceneObjects)
+{
+    std::uint32_t offset = 0;
+    auto data = reinterpret_cast<SceneConstants*>(myConstants.Allocate(sizeof(SceneConstants), &offset));
+    data->wvpMatrix = obj.wvpMatrix;
+    myCmdBuffer->SetGraphicsResourceHeap(*myResourceHeap, 0, 1, &offset);
+    myCmdBuffer->DrawIndexed(obj.numIndices, 0);
+}
+
+myConstants.Flush();                // upload this frame's constants
+myCmdQueue->Submit(*myCmdBuffer);
+myContext->Present();
+myConstants.NextFrame(*myCmdQueue); // fence the region and advance
+\endcode
+\see BindingDescriptor::dynamicOffset
+\see CommandBuffer::SetGraphicsResourceHeap
+*/
+class LLGL_EXPORT ConstantRing : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Creates the internal constant buffer and per-frame fences.
+        \param[in] renderSystem Specifies the render system the buffer and fences are created with.
+        \param[in] sizePerFrame Specifies the size (in bytes) of each per-frame region. This must not be zero.
+        The actual region size is rounded up to a multiple of the alignment.
+        \param[in] numFrames Specifies the number of per-frame regions, i.e. how many frames can be in flight
+        before allocations block on the GPU. This must not be zero. By default 2.
+        \param[in] alignment Specifies the offset alignment (in bytes) of each sub-allocation.
+        This must be a power of two and at least as large as the minimal constant-buffer offset alignment
+        of the rendering API (256 covers all current renderers). By default 256.
+        \throws std::invalid_argument If \c sizePerFrame or \c numFrames is zero, or \c alignment is not a power of two.
+        */
+        ConstantRing(
+            RenderSystem&   renderSystem,
+            std::uint64_t   sizePerFrame,
+            std::uint32_t   numFrames = 2,
+            std::uint32_t   alignment = 256
+        );
+
+        //! Releases the internal buffer and fences.
+        ~ConstantRing();
+
+        /**
+        \brief Sub-allocates constant data from the current per-frame region.
+        \param[in] size Specifies the size (in bytes) of the allocation. This must not be zero
+        and must not be larger than the per-frame region size.
+        \param[out] offset Specifies an optional output of the buffer relative offset of the allocation.
+        This can be passed directly as dynamic offset to CommandBuffer::SetGraphicsResourceHeap.
+        \return Pointer to the writable CPU memory of the allocation. The pointer remains valid until Flush is called.
+        \throws std::out_of_range If the current per-frame region is exhausted.
+        \see Flush
+        */
+        void* Allocate(std::uint64_t size, std::uint32_t* offset = nullptr);
+
+        /**
+        \brief Uploads all pending allocations of the current frame to the internal buffer.
+        \remarks This must be called after the last allocation of a frame
+        and before the command buffers that read the allocations are submitted.
+        \see RenderSystem::WriteBuffer
+        */
+        void Flush();
+
+        /**
+        \brief Fences the current per-frame region and advances to the next one.
+        \param[in] commandQueue Specifies the command queue the frame's command buffers were submitted to.
+        \remarks This submits the region's fence to the specified command queue and blocks
+        until the next region is no longer in use by the GPU. Pending allocations are flushed implicitly.
+        \see Flush
+        */
+        void NextFrame(CommandQueue& commandQueue);
+
+        //! Returns the internal constant buffer all allocations are sub-allocated from.
+        inline Buffer& GetBuffer() const
+        {
+            return *buffer_;
+        }
+
+        //! Returns the size (in bytes) of each per-frame region, rounded up to a multiple of the alignment.
+        inline std::uint64_t GetSizePerFrame() const
+        {
+            return sizePerFrame_;
+        }
+
+        //! Returns the number of per-frame regions that was specified at creation time.
+        inline std::uint32_t GetNumFrames() const
+        {
+            return numFrames_;
+        }
+
+        //! Returns the offset alignment (in bytes) that was specified at creation time.
+        inline std::uint32_t GetAlignment() const
+        {
+            return alignment_;
+        }
+
+    private:
+
+        RenderSystem&       renderSystem_;
+        Buffer*             buffer_         = nullptr;
+        std::vector<Fence*> fences_;
+        std::vector<bool>   fencesInFlight_;
+        std::vector<char>   shadowData_;
+
+        std::uint64_t       sizePerFrame_   = 0;
+        std::uint32_t       numFrames_      = 0;
+        std::uint32_t       alignment_      = 0;
+
+        std::uint32_t       frameIndex_     = 0;
+        std::uint64_t       writeOffset_    = 0;
+        std::uint64_t       flushedOffset_  = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -11,6 +11,7 @@
 
 #include "Interface.h"
 #include "DisplayFlags.h"
+#include <functional>
 #include <vector>
 #include <memory>
 #include <string>
@@ -42,6 +43,14 @@ class LLGL_EXPORT Display : public Interface
 
         LLGL_DECLARE_INTERFACE( InterfaceID::Display );
 
+    public:
+
+        /**
+        \brief Function signature for the display topology changed callback.
+        \see SetTopologyChangedCallback
+        */
+        using TopologyChangedCallback = std::function<void()>;
+
     public:
 
         /* ----- Global ----- */
@@ -49,6 +58,34 @@ class LLGL_EXPORT Display : public Interface
         //! Instantiates a list of interfaces for all connected displays.
         static std::vector<std::unique_ptr<Display>> InstantiateList();
 
+        /**
+        \brief Returns a reference to the cached list of all connected displays.
+        \remarks The list is enumerated on the first call and re-enumerated only after the cache has been invalidated,
+        which happens automatically when the host system reports a display topology change (e.g. \c WM_DISPLAYCHANGE on Win32, or RandR screen change events on Linux).
+        Use this instead of InstantiateList when the display attributes are queried frequently (e.g. every frame).
+        \remarks This function is thread-safe, but the returned list must not be accessed
+        while another thread calls this function after the cache has been invalidated.
+        \see InstantiateList
+        \see InvalidateCachedList
+        */
+        static const std::vector<std::unique_ptr<Display>>& GetCachedList();
+
+        /**
+        \brief Invalidates the cached display list, so it is re-enumerated on the next call to GetCachedList.
+        \remarks This is called automatically when the host system reports a display topology change,
+        but it can also be called manually on platforms without such notifications.
+        \see GetCachedList
+        */
+        static void InvalidateCachedList();
+
+        /**
+        \brief Sets the callback that is invoked whenever the cached display list has been invalidated, i.e. at most once per re-enumeration.
+        \param[in] callback Specifies the new callback function, or null to remove the previous callback.
+        \remarks The callback may be invoked from the thread that processes the window events.
+        \see InvalidateCachedList
+        */
+        static void SetTopologyChangedCallback(const TopologyChangedCallback& callback);
+
         /**
         \brief Instantiates an interface for the primary display.
         \return Unique pointer to a Display instance that represents the primary display, or null on failure.
@@ -10,6 +10,8 @@
 
 
 #include "RenderSystemChild.h"
+#include <atomic>
+#include <cstdint>
 
 
 namespace LLGL
@@ -18,13 +20,25 @@ namespace LLGL
 
 /**
 \brief Fence interface for CPU/GPU synchronization.
+\remarks Besides the binary signal-and-wait usage, each fence also carries a monotonically increasing 64-bit timeline value
+(see CommandQueue::Signal), so a single fence can coordinate producer/consumer threads across many synchronization events.
 \see RenderSystem::CreateFence
 \see CommandQueue::Submit(Fence&)
 \see CommandQueue::WaitFence
+\see CommandQueue::Signal
 */
 class LLGL_EXPORT Fence : public RenderSystemChild
 {
     LLGL_DECLARE_INTERFACE( InterfaceID::Fence );
+
+    private:
+
+        // Timeline state of the default emulation; renderers with native timeline fences ignore these.
+        friend class CommandQueue;
+
+        std::atomic<std::uint64_t> pendingValue_    { 0 };
+        std::atomic<std::uint64_t> completedValue_  { 0 };
+
 };
 
 
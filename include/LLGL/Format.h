@@ -221,6 +221,8 @@ enum class Format
     BC4SNorm,           //!< Compressed color format: S3TC BC4 compressed red channel with normalized signed integer component 64-bit per 4x4 block.
     BC5UNorm,           //!< Compressed color format: S3TC BC5 compressed red and green channels with normalized unsigned integer components in 64-bit per 4x4 block.
     BC5SNorm,           //!< Compressed color format: S3TC BC5 compressed red and green channels with normalized signed integer components in 128-bit per 4x4 block.
+    BC7UNorm,           //!< Compressed color format: BPTC BC7 compressed RGBA with normalized unsigned integer components in 128-bit per 4x4 block.
+    BC7UNorm_sRGB,      //!< Compressed color format: BPTC BC7 compressed RGBA with normalized unsigned integer components in 128-bit per 4x4 block in non-linear sRGB color space.
 };
 
 /**
@@ -253,6 +255,7 @@ enum class ImageFormat
     BC3,            //!< Block compression BC3.
     BC4,            //!< Block compression BC4.
     BC5,            //!< Block compression BC5.
+    BC7,            //!< Block compression BC7.
 };
 
 /**
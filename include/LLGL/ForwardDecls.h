@@ -22,6 +22,7 @@ class ComputePipeline;
 class Fence;
 class GraphicsPipeline;
 class Image;
+class MappedFile;
 class PipelineLayout;
 class QueryHeap;
 class RenderContext;
@@ -35,7 +36,9 @@ class Shader;
 class ShaderProgram;
 class Surface;
 class Texture;
+class TextureReadback;
 class Timer;
+class VertexFormatHandle;
 class Window;
 
 struct ApplicationDescriptor;
@@ -90,6 +93,7 @@ struct StreamOutputAttribute;//TODO: remove
 struct StreamOutputFormat;//TODO: remove
 struct TextureDescriptor;
 struct TextureRegion;
+struct TextureWriteDescriptor;
 struct VertexAttribute;
 struct VertexFormat;
 struct VideoAdapterDescriptor;
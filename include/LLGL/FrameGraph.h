@@ -0,0 +1,282 @@
+/*
+ * FrameGraph.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_FRAME_GRAPH_H
+#define LLGL_FRAME_GRAPH_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include "RenderSystemFlags.h"
+#include "TextureFlags.h"
+#include "BufferFlags.h"
+#include <functional>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+//! Opaque handle to a resource declared with a frame graph.
+using FrameGraphResource = std::uint32_t;
+
+/**
+\brief Frame graph resource usage structure.
+\see FrameGraphPassDescriptor::reads
+\see FrameGraphPassDescriptor::writes
+*/
+struct FrameGraphResourceUsage
+{
+    //! Specifies the resource that is accessed by the pass.
+    FrameGraphResource  resource    = 0;
+
+    /**
+    \brief Specifies how the pass binds the resource, e.g. BindFlags::Sampled or BindFlags::ColorAttachment.
+    \see BindFlags
+    */
+    long                bindFlags   = 0;
+};
+
+/**
+\brief Frame graph pass descriptor structure.
+\see FrameGraph::AddPass
+*/
+struct FrameGraphPassDescriptor
+{
+    /**
+    \brief Specifies the hardware queue the pass prefers to run on. By default CommandQueueType::Graphics.
+    \remarks Passes declared for the compute queue are only moved there if the renderer exposes a dedicated
+    compute queue and the pass does not depend on any graphics pass of the same frame (see FrameGraph::Execute).
+    \see RenderSystem::GetCommandQueue(const CommandQueueType, std::uint32_t)
+    */
+    CommandQueueType                        queueType       = CommandQueueType::Graphics;
+
+    //! List of all resources the pass reads.
+    std::vector<FrameGraphResourceUsage>    reads;
+
+    //! List of all resources the pass writes.
+    std::vector<FrameGraphResourceUsage>    writes;
+
+    /**
+    \brief Specifies whether the pass has side effects that are not visible to the frame graph. By default false.
+    \remarks Passes whose outputs are never consumed are culled unless this is set or they write an imported resource.
+    */
+    bool                                    hasSideEffects  = false;
+};
+
+/**
+\brief Frame graph that schedules render and compute passes declared by their resource accesses.
+\remarks Passes are re-declared every frame together with the transient resources they exchange.
+The graph derives the execution order from the declared reads and writes, culls passes whose outputs are never consumed,
+inserts split resource transitions between producers and consumers to hide barrier latency,
+aliases transient resources whose lifetimes do not overlap, and moves independent compute passes
+to the dedicated compute queue (if the renderer exposes one) to overlap them with graphics work.
+\code
+LLGL::FrameGraph myFrameGraph { *myRenderSystem };
+
+// Every frame:
+myFrameGraph.Reset();
+
+auto myShadowMap = myFrameGraph.DeclareTexture(myShadowMapDesc);
+
+LLGL::FrameGraphPassDescriptor myShadowPassDesc;
+myShadowPassDesc.writes.resize(1);
+myShadowPassDesc.writes[0].resource  = myShadowMap;
+myShadowPassDesc.writes[0].bindFlags = LLGL::BindFlags::DepthStencilAttachment;
+
+myFrameGraph.AddPass(
+    myShadowPassDesc,
+    [&](LLGL::CommandBuffer& cmdBuffer)
+    {
+        // Render shadow casters ...
+    }
+);
+
+LLGL::FrameGraphPassDescriptor myScenePassDesc;
+myScenePassDesc.reads.resize(1);
+myScenePassDesc.reads[0].resource    = myShadowMap;
+myScenePassDesc.reads[0].bindFlags   = LLGL::BindFlags::Sampled;
+myScenePassDesc.hasSideEffects       = true;
+
+myFrameGraph.AddPass(
+    myScenePassDesc,
+    [&](LLGL::CommandBuffer& cmdBuffer)
+    {
+        // Render scene with myFrameGraph.GetTexture(myShadowMap) bound ...
+    }
+);
+
+myFrameGraph.Execute();
+myContext->Present();
+\endcode
+\note The graph owns one command buffer per queue it uses; passes must not be recorded into other command buffers.
+\see CommandBuffer::BeginResourceTransition
+\see RenderSystem::GetNumCommandQueues
+*/
+class LLGL_EXPORT FrameGraph : public NonCopyable
+{
+
+    public:
+
+        //! Callback type that records the commands of a single pass.
+        using PassCallback = std::function<void(CommandBuffer& commandBuffer)>;
+
+    public:
+
+        //! Stores a reference to the render system; command buffers and fences are created lazily.
+        FrameGraph(RenderSystem& renderSystem);
+
+        //! Releases all transient resources, command buffers, and fences owned by the graph.
+        ~FrameGraph();
+
+        /**
+        \brief Declares a transient texture that only lives within the current frame.
+        \param[in] desc Specifies the texture descriptor the texture is created with on first use.
+        \remarks Transient textures with identical descriptors and non-overlapping lifetimes share a single texture object,
+        and the underlying objects are recycled across frames.
+        \return Handle to the declared resource; use GetTexture to access the realized texture during execution.
+        */
+        FrameGraphResource DeclareTexture(const TextureDescriptor& desc);
+
+        /**
+        \brief Declares a transient buffer that only lives within the current frame.
+        \remarks Transient buffers with vertex attributes are never aliased, since their layout is part of the object state.
+        \see DeclareTexture
+        */
+        FrameGraphResource DeclareBuffer(const BufferDescriptor& desc);
+
+        /**
+        \brief Imports an external resource (e.g. a persistent buffer or the back buffer) into the graph.
+        \remarks Passes that write an imported resource are never culled, since their results outlive the frame.
+        */
+        FrameGraphResource ImportResource(Resource& resource);
+
+        /**
+        \brief Adds a pass to the graph.
+        \param[in] desc Specifies the queue preference and the declared resource accesses of the pass.
+        \param[in] callback Specifies the callback that records the commands of the pass. This must not be empty.
+        \remarks The callback is invoked during \c Execute, after the graph has realized all transient resources.
+        Declaration order only matters between passes that access the same resources.
+        \return Zero-based index of the pass within the current frame.
+        \throws std::invalid_argument If the callback is empty or any declared resource handle is invalid.
+        \see Execute
+        */
+        std::uint32_t AddPass(const FrameGraphPassDescriptor& desc, const PassCallback& callback);
+
+        /**
+        \brief Compiles the declared passes, records them, and submits the resulting command buffers.
+        \remarks This derives the pass order from the declared dependencies, culls passes without observable outputs,
+        realizes and aliases the transient resources, and records split resource transitions between producers and consumers.
+        Compute passes that do not depend on any graphics pass of this frame are recorded into a separate command buffer
+        and submitted to the dedicated compute queue, synchronized with the graphics queue via a fence;
+        if the renderer has no dedicated compute queue, all passes run on the graphics queue.
+        \see Reset
+        */
+        void Execute();
+
+        /**
+        \brief Discards all declared passes and resources for the next frame.
+        \remarks The transient resource pool is kept alive, so re-declaring the same resources does not allocate.
+        */
+        void Reset();
+
+        /**
+        \brief Returns the realized texture of the specified transient resource, or null if the handle does not denote a texture.
+        \remarks Transient resources are only realized during \c Execute, i.e. this must be called from within a pass callback.
+        */
+        Texture* GetTexture(FrameGraphResource resource) const;
+
+        //! Returns the realized buffer of the specified transient resource; analogous to GetTexture.
+        Buffer* GetBuffer(FrameGraphResource resource) const;
+
+        //! Returns the number of passes declared since the last call to \c Reset.
+        inline std::uint32_t GetNumPasses() const
+        {
+            return static_cast<std::uint32_t>(passes_.size());
+        }
+
+    private:
+
+        enum class TransientType
+        {
+            Texture,
+            Buffer,
+            Imported,
+        };
+
+        struct ResourceEntry
+        {
+            TransientType       type        = TransientType::Imported;
+            TextureDescriptor   textureDesc;
+            BufferDescriptor    bufferDesc;
+            Resource*           realized    = nullptr;  // Imported resource or realized transient of the current frame
+        };
+
+        struct PassEntry
+        {
+            FrameGraphPassDescriptor            desc;
+            PassCallback                        callback;
+            std::vector<FrameGraphResourceUsage> beginTransitions;  // Split transitions begun after this pass
+            std::vector<FrameGraphResourceUsage> endTransitions;    // Split transitions ended before this pass
+        };
+
+        struct PoolEntry
+        {
+            TransientType       type            = TransientType::Texture;
+            TextureDescriptor   textureDesc;
+            BufferDescriptor    bufferDesc;
+            Resource*           resource        = nullptr;
+            int                 timeline        = -1;   // Timeline the entry is assigned to this frame, or -1 if free
+            std::size_t         lastUse         = 0;    // Position of the last pass that uses the entry within its timeline
+            std::uint32_t       numIdleFrames   = 0;    // Number of consecutive frames the entry was not used
+        };
+
+    private:
+
+        void MarkLivePasses(std::vector<bool>& livePasses) const;
+
+        // Returns true if any graphics pass consumes the output of a compute-timeline pass.
+        bool AssignQueues(const std::vector<bool>& livePasses, std::vector<int>& timelines) const;
+
+        void RealizeTransientResources(const std::vector<std::size_t>* schedules);
+        void ReleaseUnusedPoolEntries();
+
+        void RecordSplitTransitions(const std::vector<std::size_t>& schedule);
+        void RecordPasses(CommandBuffer& commandBuffer, const std::vector<std::size_t>& schedule);
+
+        CommandBuffer* GetOrCreateGraphicsCommandBuffer();
+        CommandBuffer* GetOrCreateComputeCommandBuffer();
+
+        PoolEntry* FindPoolEntry(const ResourceEntry& resourceEntry, int timeline, std::size_t firstUse);
+
+    private:
+
+        RenderSystem&               renderSystem_;
+
+        std::vector<ResourceEntry>  resources_;
+        std::vector<PassEntry>      passes_;
+
+        std::vector<PoolEntry>      resourcePool_;
+
+        CommandBuffer*              graphicsCmdBuffer_  = nullptr;
+        CommandBuffer*              computeCmdBuffer_   = nullptr;
+        Fence*                      computeFence_       = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,139 @@
+/*
+ * GPUCullingPass.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GPU_CULLING_PASS_H
+#define LLGL_GPU_CULLING_PASS_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include "IndirectArguments.h"
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Helper class for GPU-driven culling that produces a compacted indirect draw stream.
+\remarks This class owns an argument buffer of DrawIndexedIndirectArguments entries and a draw-count buffer,
+both created with the BindFlags::IndirectBuffer and BindFlags::Storage binding flags.
+A user-provided compute pipeline performs the actual culling (e.g. frustum or occlusion tests against instance bounds)
+and appends the draw arguments of all visible instances to the argument buffer
+while atomically incrementing the 32-bit draw count at the start of the count buffer.
+The recorded draws are then consumed with a single indirect draw call, without any CPU round-trip.
+\code
+LLGL::GPUCullingPass myCullingPass { *myRenderSystem, 4096 };
+
+// Bind myCullingPass.GetArgumentBuffer() and myCullingPass.GetCountBuffer()
+// as storage buffers in the resource heap of the culling pipeline ...
+
+// Every frame:
+myCullingPass.RecordCulling(*myCmdBuffer, *myCullingPipeline, *myCullingResourceHeap, myNumInstances);
+
+myCmdBuffer->BeginRenderPass(*myContext);
+{
+    myCmdBuffer->SetGraphicsPipeline(*myGfxPipeline);
+    myCmdBuffer->SetVertexBuffer(*myVertexBuffer);
+    myCmdBuffer->SetIndexBuffer(*myIndexBuffer);
+    myCullingPass.RecordDraws(*myCmdBuffer);
+}
+myCmdBuffer->EndRenderPass();
+\endcode
+\note If the renderer does not support indirect draw counts (see RenderingFeatures::hasDrawIndirectCount),
+the culling shader must write zero-filled argument entries for all culled slots instead of compacting them,
+because the entire argument buffer is consumed in that case.
+\see CommandBuffer::DrawIndexedIndirect
+\see RenderingFeatures::hasDrawIndirectCount
+*/
+class LLGL_EXPORT GPUCullingPass : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Creates the internal argument and count buffers.
+        \param[in] renderSystem Specifies the render system the buffers are created with.
+        \param[in] maxNumDraws Specifies the maximum number of draw commands the argument buffer can hold. This must not be zero.
+        \throws std::invalid_argument If \c maxNumDraws is zero.
+        */
+        GPUCullingPass(RenderSystem& renderSystem, std::uint32_t maxNumDraws);
+
+        //! Releases the internal buffers.
+        ~GPUCullingPass();
+
+        /**
+        \brief Records the culling dispatch into the specified command buffer.
+        \param[in] commandBuffer Specifies the command buffer the culling pass is recorded into.
+        \param[in] pipeline Specifies the compute pipeline that performs the culling.
+        \param[in] resourceHeap Specifies the resource heap of the culling pipeline.
+        This heap must contain the argument and count buffers of this culling pass as storage buffers,
+        next to whatever input resources the culling shader reads (e.g. instance bounds and camera planes).
+        \param[in] numInstances Specifies the number of instances the culling shader tests.
+        \param[in] workGroupSize Specifies the local work group size of the culling shader. This must not be zero. By default 64.
+        \remarks This resets the draw count to zero, dispatches the culling pipeline,
+        and begins the transition of the argument and count buffers towards their use as indirect argument sources.
+        \see CommandBuffer::BeginResourceTransition
+        */
+        void RecordCulling(
+            CommandBuffer&  commandBuffer,
+            ComputePipeline& pipeline,
+            ResourceHeap&   resourceHeap,
+            std::uint32_t   numInstances,
+            std::uint32_t   workGroupSize = 64
+        );
+
+        /**
+        \brief Records the indirect draw call that consumes the culled draw stream.
+        \param[in] commandBuffer Specifies the command buffer the draw call is recorded into.
+        \remarks This ends the resource transition begun by RecordCulling and issues a single indirect draw:
+        with the count variant of CommandBuffer::DrawIndexedIndirect if the renderer supports it,
+        otherwise all argument entries are consumed and culled slots must be zero-filled by the culling shader.
+        A graphics pipeline as well as the vertex and index buffers must already be bound.
+        \see RecordCulling
+        */
+        void RecordDraws(CommandBuffer& commandBuffer);
+
+        //! Returns the argument buffer that holds the DrawIndexedIndirectArguments entries.
+        inline Buffer& GetArgumentBuffer() const
+        {
+            return *argumentBuffer_;
+        }
+
+        //! Returns the buffer that holds the 32-bit draw count at offset zero.
+        inline Buffer& GetCountBuffer() const
+        {
+            return *countBuffer_;
+        }
+
+        //! Returns the maximum number of draw commands that was specified at creation time.
+        inline std::uint32_t GetMaxNumDraws() const
+        {
+            return maxNumDraws_;
+        }
+
+    private:
+
+        RenderSystem&   renderSystem_;
+        Buffer*         argumentBuffer_         = nullptr;
+        Buffer*         countBuffer_            = nullptr;
+        std::uint32_t   maxNumDraws_            = 0;
+        bool            hasDrawIndirectCount_   = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -24,7 +24,8 @@ namespace LLGL
 
 This class is not required for any interaction with the render system.
 It can be used as utility to handle 2D and 3D image data before passing it to a hardware texture.
-\remarks This class holds the ownership of an image buffer and its attributes.
+\remarks This class holds the ownership of an image buffer and its attributes,
+or alternatively wraps an externally managed buffer without owning it (see the respective constructor).
 The primary functions are implemented as global functions like <code>GenerateImageBuffer</code> for instance.
 \note All image operations of this class do NOT make use of hardware acceleration.
 \see GenerateImageBuffer
@@ -59,12 +60,27 @@ class LLGL_EXPORT Image
         */
         Image(const Extent3D& extent, const ImageFormat format, const DataType dataType, ByteBuffer&& data);
 
+        /**
+        \brief Constructor to wrap an external image buffer without copying or taking ownership of it.
+        \param[in] data Raw pointer to the external image buffer, e.g. a region of a memory-mapped asset file.
+        This pointer must remain valid for the entire lifetime of this Image instance.
+        \remarks The external buffer is not released when this image is destroyed.
+        Operations that reallocate the image buffer (such as Convert or Resize) detach the image
+        from the external buffer and continue with a newly allocated buffer that is owned by this image.
+        \note If the specified data does not manage an image buffer of the specified extent and format, the behavior is undefined.
+        \see GetSrcDesc
+        */
+        Image(const Extent3D& extent, const ImageFormat format, const DataType dataType, void* data);
+
         //! Copy constructor which copies the entire image buffer from the specified source image.
         Image(const Image& rhs);
 
         //! Move constructor which takes the ownership of the specified source image.
         Image(Image&& rhs);
 
+        //! Destructor which releases the image buffer, unless it merely wraps an external buffer.
+        ~Image();
+
         /* ----- Operators ----- */
 
         //! Copy operator which copies the entire image buffer and attributes.
@@ -128,7 +144,11 @@ class LLGL_EXPORT Image
         */
         void Reset(const Extent3D& extent, const ImageFormat format, const DataType dataType, ByteBuffer&& data);
 
-        //! Releases the ownership of the image buffer and resets all attributes.
+        /**
+        \brief Releases the ownership of the image buffer and resets all attributes.
+        \return Byte buffer this image previously owned,
+        or null if this image merely wraps an external buffer it does not own (which is detached but cannot be released).
+        */
         ByteBuffer Release();
 
         /* ----- Pixels ----- */
@@ -190,6 +210,20 @@ class LLGL_EXPORT Image
         */
         void WritePixels(const Offset3D& offset, const Extent3D& extent, const SrcImageDescriptor& imageDesc, std::size_t threadCount = 0);
 
+        /**
+        \brief Generates a MIP-map chain from this image on the CPU using a box filter.
+        \param[in] numMipLevels Specifies the number of MIP-map levels to generate (including the base level).
+        If this is 0, the full chain down to a single pixel is generated. By default 0.
+        \return Byte buffer that contains the pixels of all MIP-map levels contiguously, starting with a copy of the base level,
+        or null if this image has no data. Each level has half the extent of the previous level (rounded down but at least 1).
+        \remarks Each level can be used for a texture upload via SrcImageDescriptor by advancing the data pointer
+        by the data sizes of all previous levels (see ImageDataSize).
+        \note This function does NOT make use of hardware acceleration and can therefore be run on a loader thread.
+        \see NumMipLevels(std::uint32_t, std::uint32_t, std::uint32_t)
+        \see ImageDataSize
+        */
+        ByteBuffer GenerateMipChain(std::uint32_t numMipLevels = 0) const;
+
         /**
         \brief Mirrors the image at the YZ plane.
         \todo Not implemented yet
@@ -286,6 +320,8 @@ class LLGL_EXPORT Image
 
         void ResetAttributes();
 
+        void DetachExternalBuffer();
+
         std::size_t GetDataPtrOffset(const Offset3D& offset) const;
 
         void ClampRegion(Offset3D& offset, Extent3D& extent) const;
@@ -296,6 +332,7 @@ class LLGL_EXPORT Image
         ImageFormat format_     = ImageFormat::RGBA;
         DataType    dataType_   = DataType::UInt8;
         ByteBuffer  data_;
+        bool        ownsData_   = true;
 
 };
 
@@ -106,6 +106,30 @@ struct DstImageDescriptor
     std::size_t dataSize    = 0;
 };
 
+/**
+\brief Descriptor structure for a single region of a batched texture write operation.
+\remarks Combines a texture region with the source image data that is to be written into that region.
+\see RenderSystem::WriteTextureMulti
+*/
+struct TextureWriteDescriptor
+{
+    TextureWriteDescriptor() = default;
+    TextureWriteDescriptor(const TextureWriteDescriptor&) = default;
+
+    //! Constructor to initialize all attributes.
+    inline TextureWriteDescriptor(const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) :
+        textureRegion { textureRegion },
+        imageDesc     { imageDesc     }
+    {
+    }
+
+    //! Specifies the texture region where the texture is to be updated. The field TextureRegion::numMipLevels \b must be 1.
+    TextureRegion       textureRegion;
+
+    //! Specifies the image data descriptor. Its \c data member must not be null!
+    SrcImageDescriptor  imageDesc;
+};
+
 
 /* ----- Functions ----- */
 
@@ -184,6 +208,9 @@ If this is less than 2, no multi-threading is used. If this is 'Constants::maxTh
 the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
 \return Byte buffer with the converted image data or null if no conversion is necessary.
 This can be casted to the respective target data type (e.g. <code>unsigned char</code>, <code>int</code>, <code>float</code> etc.).
+\remarks A null return value is the zero-copy fast path: if the source image already has the requested format and data type,
+the caller can continue reading from its own buffer (e.g. a memory-mapped file region) without any intermediate copy.
+The render systems rely on this when uploading image data whose format matches the hardware texture format.
 \note Compressed images and depth-stencil images cannot be converted.
 \throw std::invalid_argument If a compressed image format is specified either as source or destination.
 \throw std::invalid_argument If a depth-stencil format is specified either as source or destination.
@@ -201,6 +228,38 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     std::size_t                 threadCount = 0
 );
 
+/**
+\brief Converts the image format and data type of the source image including compressed color formats and returns the new generated image buffer.
+\param[in] srcImageDesc Specifies the source image descriptor.
+\param[in] extent Specifies the extent of the image. This is required to transcode compressed formats, since their data is organized in blocks of 4x4 pixels rather than a flat pixel array.
+\param[in] dstFormat Specifies the destination image format.
+\param[in] dstDataType Specifies the destination image data type.
+\param[in] threadCount Specifies the number of threads to use for conversion.
+If this is less than 2, no multi-threading is used. If this is 'Constants::maxThreadCount',
+the maximal count of threads the system supports will be used (e.g. 4 on a quad-core processor). By default 0.
+\return Byte buffer with the converted image data or null if no conversion is necessary.
+\remarks In contrast to the overload without an extent parameter, this function also decodes, encodes, and transcodes the block-compressed formats.
+The supported codecs are decoding from ImageFormat::BC1, ImageFormat::BC2, and ImageFormat::BC3, and encoding to ImageFormat::BC1.
+Transcoding between compressed formats is composed of a decoding and an encoding pass with an intermediate RGBA image.
+If neither source nor destination format is compressed, this function behaves like the overload without an extent parameter.
+\note Compressed images must have the data type DataType::UInt8.
+\throw std::invalid_argument If a compressed image format with an unsupported codec is specified either as source or destination.
+\throw std::invalid_argument If a compressed image format is specified with a data type other than DataType::UInt8.
+\throw std::invalid_argument If the source buffer size does not match the block layout of a compressed source format.
+\throw std::invalid_argument If a depth-stencil format is specified either as source or destination.
+\throw std::invalid_argument If the source buffer is a null pointer.
+\see Constants::maxThreadCount
+\see ByteBuffer
+\see IsCompressedFormat(const ImageFormat)
+*/
+LLGL_EXPORT ByteBuffer ConvertImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    const Extent3D&             extent,
+    ImageFormat                 dstFormat,
+    DataType                    dstDataType,
+    std::size_t                 threadCount = 0
+);
+
 /**
 \brief Generates an image buffer with the specified fill data for each pixel.
 \param[in] format Specifies the image format of each pixel in the output image.
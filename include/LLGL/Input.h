@@ -69,7 +69,11 @@ class LLGL_EXPORT Input : public Window::EventListener
             return mousePosition_;
         }
 
-        //! Returns the global mouse motion.
+        /**
+        \brief Returns the global mouse motion.
+        \remarks This is the coalesced sum of all raw motion events received since the previous event processing,
+        i.e. even high-frequency mice result in a single accumulated delta per frame.
+        */
         inline const Offset2D& GetMouseMotion() const
         {
             return mouseMotion_;
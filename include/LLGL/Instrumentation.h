@@ -0,0 +1,111 @@
+/*
+ * Instrumentation.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_INSTRUMENTATION_H
+#define LLGL_INSTRUMENTATION_H
+
+
+#include "Export.h"
+#include <cstdint>
+#include <functional>
+
+
+namespace LLGL
+{
+
+namespace Instrumentation
+{
+
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Instrumentation event type enumeration.
+\see EventCallback
+*/
+enum class EventType
+{
+    /**
+    \brief Emitted when a render state cache lookup missed and the state change must be submitted to the native API.
+    \remarks The event value specifies the native handle of the newly bound object.
+    */
+    StateCacheMiss,
+
+    /**
+    \brief Emitted when the internal representation of a resource heap is built.
+    \remarks The event value specifies the size (in bytes) of the internal descriptor buffer.
+    */
+    ResourceHeapBuild,
+
+    /**
+    \brief Emitted when a new device memory chunk is allocated from the system.
+    \remarks The event value specifies the size (in bytes) of the allocated chunk.
+    */
+    MemoryChunkAllocation,
+};
+
+
+/* ----- Types ----- */
+
+/**
+\brief Instrumentation event callback function signature.
+\param[in] event Specifies the type of the event.
+\param[in] info Pointer to a null terminated string that describes the source of the event (e.g. <code>"GLStateManager::BindBuffer"</code>). This is never null.
+\param[in] value Specifies the event specific payload value (e.g. an allocation size in bytes). This is 0 if unused.
+\param[in] userData Specifies the user data that was set in the previous call to SetEventCallback.
+\remarks The callback is invoked from whichever thread executes the instrumented path, so it must be cheap and thread-safe.
+\see EventType
+\see SetEventCallback
+*/
+using EventCallback = std::function<void(EventType event, const char* info, std::uint64_t value, void* userData)>;
+
+
+/* ----- Functions ----- */
+
+/**
+\brief Sets the new instrumentation event callback. No event callback is specified by default, in which case the events are ignored.
+\param[in] callback Specifies the new event callback. This can also be null.
+\param[in] userData Optional raw pointer to some user data that will be passed to the callback each time an event is emitted.
+\remarks Events are only emitted if LLGL was built with the \c LLGL_ENABLE_INSTRUMENTATION compilation flag;
+otherwise, all instrumented paths compile to nothing and this callback is never invoked.
+The callback must be set before any instrumented path is executed (i.e. before rendering starts), since emission is not synchronized.
+\see PostEvent
+*/
+LLGL_EXPORT void SetEventCallback(const EventCallback& callback, void* userData = nullptr);
+
+/**
+\brief Posts an instrumentation event to the currently set event callback.
+\remarks This is primarily used by the internal instrumented paths, but can also be used to emit custom events.
+\see EventCallback
+*/
+LLGL_EXPORT void PostEvent(EventType event, const char* info, std::uint64_t value = 0);
+
+
+} // /namespace Instrumentation
+
+} // /namespace LLGL
+
+
+/* ----- Macros ----- */
+
+/**
+\brief Posts an instrumentation event if LLGL was built with the \c LLGL_ENABLE_INSTRUMENTATION compilation flag; compiles to nothing otherwise.
+\see LLGL::Instrumentation::PostEvent
+*/
+#ifdef LLGL_ENABLE_INSTRUMENTATION
+#   define LLGL_INSTRUMENT_EVENT(EVENT, INFO, VALUE) \
+        LLGL::Instrumentation::PostEvent(LLGL::Instrumentation::EventType::EVENT, INFO, VALUE)
+#else
+#   define LLGL_INSTRUMENT_EVENT(EVENT, INFO, VALUE)
+#endif
+
+
+#endif
+
+
+
+// ================================================================================
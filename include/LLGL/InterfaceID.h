@@ -46,6 +46,7 @@ struct InterfaceID
         Shader,                 //!< \see Shader
         ShaderProgram,          //!< \see ShaderProgram
         Texture,                //!< \see Texture
+        TextureReadback,        //!< \see TextureReadback
         Surface,                //!< \see Surface
         Canvas,                 //!< \see Canvas
         Canvas_EventListener,   //!< \see Canvas::EventListener
@@ -53,6 +54,7 @@ struct InterfaceID
         Window_EventListener,   //!< \see Window::EventListener
         Input,                  //!< \see Input
         Timer,                  //!< \see Timer
+        MappedFile,             //!< \see MappedFile
 
         /**
         \brief Maximum reserved ID for interfaces.
@@ -15,12 +15,14 @@
 #include "Display.h"
 #include "Input.h"
 #include "Timer.h"
+#include "MappedFile.h"
 #include "TypeInfo.h"
 #include "ColorRGB.h"
 #include "ColorRGBA.h"
 #include "RenderSystem.h"
 #include "Log.h"
 #include "IndirectArguments.h"
+#include "CommandStream.h"
 #include "ImageFlags.h"
 #include "VertexFormat.h"
 
@@ -103,6 +103,28 @@ LLGL_EXPORT void SetReportCallbackStd(std::ostream& stream = std::cerr);
 */
 LLGL_EXPORT void SetReportLimit(std::size_t maxCount);
 
+/**
+\brief Enables or disables asynchronous report processing. By default disabled.
+\param[in] enabled Specifies whether reports are processed asynchronously.
+\param[in] queueSize Specifies the capacity of the internal report queue and is rounded up to a power of two.
+This is ignored if \c enabled is false. By default 1024.
+\remarks If enabled, PostReport only stores the report in a bounded lock-free queue and returns immediately,
+while an internal writer thread drains the queue and invokes the report callback.
+This keeps verbose logging (e.g. with the debug layer enabled) from serializing the posting threads on an output stream.
+If the queue is full, the report is dropped and counted instead of blocking the posting thread (see GetNumDroppedReports).
+If this mode is disabled again, all pending reports are processed before this function returns.
+\note This function must not be called while another thread posts a report.
+\see GetNumDroppedReports
+\see PostReport
+*/
+LLGL_EXPORT void SetAsyncReportEnabled(bool enabled, std::size_t queueSize = 1024);
+
+/**
+\brief Returns the number of reports that have been dropped because the asynchronous report queue was full.
+\see SetAsyncReportEnabled
+*/
+LLGL_EXPORT std::size_t GetNumDroppedReports();
+
 
 } // /namespace Log
 
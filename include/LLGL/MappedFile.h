@@ -0,0 +1,74 @@
+/*
+ * MappedFile.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_MAPPED_FILE_H
+#define LLGL_MAPPED_FILE_H
+
+
+#include "Interface.h"
+#include <memory>
+#include <string>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Interface for a read-only memory mapped file.
+\remarks This maps the contents of a file directly into the address space of the process (e.g. \c mmap on POSIX systems or \c MapViewOfFile on Win32),
+so the contents can be consumed without reading the entire file into an intermediate buffer first.
+This is primarily intended to feed shader sources and image file contents into the respective compilers and upload paths zero-copy.
+\remarks This basic class is also designed as interface, since the native file mapping is platform specific.
+\see ShaderDescFromMappedFile
+*/
+class LLGL_EXPORT MappedFile : public Interface
+{
+
+        LLGL_DECLARE_INTERFACE( InterfaceID::MappedFile );
+
+    public:
+
+        /**
+        \brief Opens the specified file as read-only memory mapping.
+        \param[in] filename Specifies the file to map. This must not be null.
+        \remarks The mapped contents remain valid until this object is destroyed.
+        The contents are \e not guaranteed to be null terminated, i.e. consumers must respect GetSize.
+        \throws std::runtime_error If the file could not be opened or mapped.
+        \see GetData
+        \see GetSize
+        */
+        static std::unique_ptr<MappedFile> Open(const char* filename);
+
+        //! Returns a pointer to the beginning of the mapped file contents, or null if the file is empty.
+        virtual const void* GetData() const = 0;
+
+        //! Returns the size (in bytes) of the mapped file contents.
+        virtual std::size_t GetSize() const = 0;
+
+        //! Returns the filename this file mapping was opened with.
+        inline const char* GetFilename() const
+        {
+            return filename_.c_str();
+        }
+
+    private:
+
+        std::string filename_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
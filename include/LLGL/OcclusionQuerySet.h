@@ -0,0 +1,142 @@
+/*
+ * OcclusionQuerySet.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_OCCLUSION_QUERY_SET_H
+#define LLGL_OCCLUSION_QUERY_SET_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include "QueryHeapFlags.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Helper class for bulk occlusion-query culling with frame-lagged results.
+\remarks This class double-buffers a QueryHeap across frames:
+while the queries of the current frame are recorded into one heap,
+the results of the previous frame are resolved from the other heap in a single batched operation.
+Visibility is exposed as a bitset that lags one frame behind, which is the common trade-off for occlusion culling.
+\code
+LLGL::OcclusionQuerySet myQuerySet { *myRenderSystem, 500 };
+
+// Every frame:
+for (std::uint32_t i = 0; i < myQuerySet.GetNumQueries(); ++i)
+{
+    if (myQuerySet.IsVisible(i))
+    {
+        // Draw object 'i' at full detail ...
+    }
+    myQuerySet.Begin(*myCmdBuffer, i);
+    {
+        // Draw bounding volume of object 'i' ...
+    }
+    myQuerySet.End(*myCmdBuffer, i);
+}
+
+// After the command buffer has been submitted:
+myQuerySet.Resolve(*myCmdQueue);
+\endcode
+\see CommandBuffer::BeginQuery
+\see CommandQueue::QueryResult
+*/
+class LLGL_EXPORT OcclusionQuerySet : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Creates the internal query heaps and initializes all queries as visible.
+        \param[in] renderSystem Specifies the render system the query heaps are created with.
+        \param[in] numQueries Specifies the number of queries per frame. This must not be zero.
+        \param[in] queryType Specifies the type of the occlusion queries. This must be one of the occlusion query types,
+        i.e. QueryType::SamplesPassed, QueryType::AnySamplesPassed, or QueryType::AnySamplesPassedConservative.
+        By default QueryType::AnySamplesPassed.
+        \throws std::invalid_argument If \c numQueries is zero, or \c queryType is not an occlusion query type.
+        */
+        OcclusionQuerySet(RenderSystem& renderSystem, std::uint32_t numQueries, const QueryType queryType = QueryType::AnySamplesPassed);
+
+        //! Releases the internal query heaps.
+        ~OcclusionQuerySet();
+
+        /**
+        \brief Begins the specified query of the current frame.
+        \param[in] commandBuffer Specifies the command buffer the query is recorded into.
+        \param[in] query Specifies the zero-based query index and must be in the half-open range <code>[0, GetNumQueries())</code>.
+        \see CommandBuffer::BeginQuery
+        */
+        void Begin(CommandBuffer& commandBuffer, std::uint32_t query);
+
+        /**
+        \brief Ends the specified query of the current frame.
+        \see Begin
+        */
+        void End(CommandBuffer& commandBuffer, std::uint32_t query);
+
+        /**
+        \brief Resolves all query results of the previous frame in one batch and swaps the internal query heaps.
+        \param[in] commandQueue Specifies the command queue used to retrieve the query results.
+        \return True if new results were resolved into the visibility bitset.
+        Otherwise, the results of the previous frame were not yet available and the bitset is unchanged.
+        \remarks Call this once per frame after all queries have been recorded and the command buffer has been submitted.
+        This never blocks: if the results are not yet available, the visibility of the frame before is kept.
+        \see IsVisible
+        */
+        bool Resolve(CommandQueue& commandQueue);
+
+        /**
+        \brief Returns the visibility of the specified query as resolved by the last successful call to \c Resolve.
+        \param[in] query Specifies the zero-based query index and must be in the half-open range <code>[0, GetNumQueries())</code>.
+        \return True if any samples of the specified query passed the depth test in the last resolved frame.
+        Queries that have never been resolved are considered visible.
+        \see Resolve
+        */
+        bool IsVisible(std::uint32_t query) const;
+
+        /**
+        \brief Returns the visibility bitset as resolved by the last successful call to \c Resolve.
+        \remarks Bit \c i of element <code>i/64</code> stores the visibility of query \c i.
+        \see IsVisible
+        */
+        inline const std::vector<std::uint64_t>& GetVisibilityBits() const
+        {
+            return visibilityBits_;
+        }
+
+        //! Returns the number of queries per frame that was specified at creation time.
+        inline std::uint32_t GetNumQueries() const
+        {
+            return numQueries_;
+        }
+
+    private:
+
+        RenderSystem&               renderSystem_;
+        QueryHeap*                  queryHeaps_[2]      = {};
+        std::uint32_t               numQueries_         = 0;
+        std::uint32_t               activeHeap_         = 0;
+        bool                        heapRecorded_[2]    = {};
+        std::vector<std::uint64_t>  results_;
+        std::vector<std::uint64_t>  visibilityBits_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -106,6 +106,49 @@ struct BindingDescriptor
     \note For Vulkan, this number specifies the size of an array of resources (e.g. an array of uniform buffers).
     */
     std::uint32_t   arraySize   = 1;
+
+    /**
+    \brief Specifies whether this buffer binding receives a dynamic offset at bind time. By default false.
+    \remarks Declaring a binding as dynamic allows a single resource heap to be reused for many draw calls
+    that only differ in a buffer offset (e.g. per-object constants sub-allocated within one large buffer).
+    The offsets are passed to CommandBuffer::SetGraphicsResourceHeap and CommandBuffer::SetComputeResourceHeap
+    in ascending order of the binding slots that are declared as dynamic.
+    This must only be used for bindings of type ResourceType::Buffer.
+    \note Only supported with: Vulkan, OpenGL.
+    \see CommandBuffer::SetGraphicsResourceHeap
+    */
+    bool            dynamicOffset = false;
+};
+
+/**
+\brief Layout structure for an optional range of dynamic shader uniforms.
+\remarks Declaring such a range allows the renderer to pass small per-draw data (e.g. transform indices or material IDs)
+directly within the command stream, i.e. without a constant buffer upload or descriptor allocation.
+For Direct3D 12, this range is compiled into 32-bit root constants.
+\see PipelineLayoutDescriptor::uniformRange
+\see CommandBuffer::SetUniforms
+*/
+struct UniformRangeDescriptor
+{
+    /**
+    \brief Specifies the zero-based constant buffer slot this range is bound to. By default 0.
+    \remarks For Direct3D 12, this is the register of a \c cbuffer declaration in HLSL, e.g. <code>register(b2)</code> for slot 2.
+    */
+    std::uint32_t   slot        = 0;
+
+    /**
+    \brief Specifies which shader stages can read this uniform range. By default 0.
+    \see BindingDescriptor::stageFlags
+    */
+    long            stageFlags  = 0;
+
+    /**
+    \brief Specifies the size (in bytes) of the uniform range. By default 0.
+    \remarks If this is zero, the pipeline layout does not contain a uniform range.
+    This must be a multiple of 4, and should be kept small (16-64 bytes) since the range competes
+    with the resource bindings for the limited space of the root signature.
+    */
+    std::uint32_t   size        = 0;
 };
 
 /**
@@ -115,7 +158,16 @@ struct BindingDescriptor
 struct PipelineLayoutDescriptor
 {
     //! List of layout resource bindings.
-    std::vector<BindingDescriptor> bindings;
+    std::vector<BindingDescriptor>  bindings;
+
+    /**
+    \brief Optional range of dynamic shader uniforms.
+    \remarks If the size of this range is non-zero, the CommandBuffer::SetUniforms function writes into this range,
+    where the uniform location specifies the offset (in 32-bit words) within the range.
+    \note Only supported with: Direct3D 12.
+    \see CommandBuffer::SetUniforms
+    */
+    UniformRangeDescriptor          uniformRange;
 };
 
 
@@ -12,6 +12,7 @@
 #include "RenderTarget.h"
 #include "RenderContextFlags.h"
 #include "RenderSystemFlags.h"
+#include "ForwardDecls.h"
 #include "Surface.h"
 
 #include "Buffer.h"
@@ -27,6 +28,9 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <vector>
+#include <functional>
+#include <cstdint>
 
 
 namespace LLGL
@@ -78,6 +82,34 @@ class LLGL_EXPORT RenderContext : public RenderTarget
         //! Swaps the back buffer with the front buffer to present it on the screen (or rather on this render context).
         virtual void Present() = 0;
 
+        /**
+        \brief Blocks the calling thread until the swap chain is ready to accept the next frame.
+        \remarks Call this once per frame before polling input and recording commands to minimize input latency.
+        This is only effective if the render context was created with a non-zero maximum frame latency
+        and the swap chain provides a frame-latency waitable object; otherwise, this function has no effect.
+        \note Only supported with: Direct3D 12, OpenGL.
+        \see RenderContextDescriptor::frameLatency
+        */
+        virtual void WaitForFrameLatency();
+
+        /**
+        \brief Captures the content of the current back buffer asynchronously.
+        \param[in] renderSystem Specifies the render system this render context was created with;
+        it takes ownership of the returned readback object.
+        \param[in] callback Optional completion callback that is invoked from within RenderSystem::ProcessReadbacks
+        once the pixel data is available. This can also be specified later via TextureReadback::SetCompletedCallback.
+        \return Pointer to the new TextureReadback object, or null if this renderer does not support asynchronous frame capturing.
+        \remarks The copy to staging memory is enqueued when this function is called (commonly right before \c Present)
+        and the pixel data becomes available a few frames later, so capturing does not stall the frame like ReadTexture does.
+        The pixel data is delivered as ImageFormat::RGBA with DataType::UInt8, row by row from bottom to top,
+        with the resolution of the current video mode.
+        Release the readback with RenderSystem::Release once the data has been consumed.
+        \note Only supported with: OpenGL.
+        \see RenderSystem::ProcessReadbacks
+        \see TextureReadback
+        */
+        virtual TextureReadback* CaptureFrame(RenderSystem& renderSystem, const std::function<void(TextureReadback&)>& callback = {});
+
         /**
         \brief Returns the color format of this render context.
         \remarks This may depend on the settings specified for the video mode.
@@ -97,6 +129,63 @@ class LLGL_EXPORT RenderContext : public RenderTarget
         */
         virtual Format GetDepthStencilFormat() const = 0;
 
+        /* ----- Frame Pipelining ----- */
+
+        /**
+        \brief Initializes frame pipelining with the specified number of frames in flight.
+        \param[in] renderSystem Specifies the render system this render context was created with;
+        it is used to create one fence per frame in flight.
+        \param[in] numFramesInFlight Specifies how many frames the CPU may record ahead of the GPU.
+        This is clamped to at least 1, where 1 serializes CPU and GPU. By default 2.
+        \remarks This replaces the hand-rolled N-buffered fence rotation most applications implement themselves:
+        \code
+        myContext->InitFramePipeline(*myRenderSystem, 2);
+        while (myWindow.ProcessEvents())
+        {
+            // Block only when the pipeline is full, i.e. when the frame that last used this ring slot is still in flight
+            auto frameIndex = myContext->BeginFrame();
+
+            // Record and submit commands using the per-frame resources for 'frameIndex' ...
+
+            myContext->Present();
+            myContext->EndFrame();
+        }
+        \endcode
+        \remarks All per-frame resources that are rewritten every frame (e.g. constant buffers or staging memory)
+        must be allocated once per frame in flight and selected with the index returned by \c BeginFrame.
+        \see BeginFrame
+        \see EndFrame
+        */
+        void InitFramePipeline(RenderSystem& renderSystem, std::uint32_t numFramesInFlight = 2);
+
+        /**
+        \brief Begins a new frame and blocks the calling thread only when the frame pipeline is full.
+        \return Zero-based index of the frame ring slot, in the half-open range <code>[0, GetNumFramesInFlight())</code>.
+        Per-frame resources selected with this index are no longer in use by the GPU.
+        \remarks If \c InitFramePipeline has not been called, this function has no effect and always returns 0.
+        \see InitFramePipeline
+        \see EndFrame
+        */
+        std::uint32_t BeginFrame();
+
+        /**
+        \brief Ends the current frame by submitting its fence to the command queue.
+        \remarks This must be called once per frame after all command buffers of the frame have been submitted
+        (commonly right after \c Present).
+        If \c InitFramePipeline has not been called, this function has no effect.
+        \see BeginFrame
+        */
+        void EndFrame();
+
+        /**
+        \brief Returns the number of frames in flight, or 0 if frame pipelining has not been initialized.
+        \see InitFramePipeline
+        */
+        inline std::uint32_t GetNumFramesInFlight() const
+        {
+            return static_cast<std::uint32_t>(frameFences_.size());
+        }
+
         /**
         \brief Returns the surface which is used to present the content on the screen.
         \remarks On desktop platforms, this can be statically casted to 'LLGL::Window&',
@@ -224,6 +313,13 @@ class LLGL_EXPORT RenderContext : public RenderTarget
 
         std::unique_ptr<Offset2D>   cachedSurfacePos_;
 
+        /* ----- Frame pipeline state (see InitFramePipeline) ----- */
+
+        CommandQueue*               frameCmdQueue_      = nullptr;
+        std::vector<Fence*>         frameFences_;
+        std::uint64_t               frameCount_         = 0;
+        std::uint32_t               frameIndex_         = 0;
+
 };
 
 
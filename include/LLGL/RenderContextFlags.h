@@ -19,6 +19,38 @@ namespace LLGL
 {
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Swap-chain presentation mode enumeration.
+\see RenderContextDescriptor::presentMode
+*/
+enum class PresentMode
+{
+    /**
+    \brief Derive the presentation mode from the V-sync configuration. This is the default.
+    \see VsyncDescriptor
+    */
+    Default,
+
+    //! Presented frames are queued and consumed at the display rate. No tearing, but Present blocks when the queue is full.
+    Fifo,
+
+    /**
+    \brief Only the most recent frame is kept for presentation and older pending frames are discarded.
+    No tearing, and Present does not block on the display rate.
+    \note Only supported with: Vulkan. If unavailable, this falls back to the V-sync derived mode.
+    */
+    Mailbox,
+
+    /**
+    \brief Frames are presented immediately without waiting for the vertical blank. May produce tearing.
+    \note If unavailable, this falls back to the V-sync derived mode.
+    */
+    Immediate,
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -109,6 +141,26 @@ struct RenderContextDescriptor
 
     //! Video mode descriptor.
     VideoModeDescriptor     videoMode;
+
+    /**
+    \brief Maximum number of frames the CPU is allowed to queue ahead of the GPU. Can be 1, 2, or 3, or zero to keep the driver default. By default 0.
+    \remarks Lower values reduce input latency at the cost of less CPU/GPU parallelism.
+    With Direct3D 12, a non-zero value also creates the swap chain with a frame-latency waitable object,
+    which can be blocked on with RenderContext::WaitForFrameLatency.
+    With OpenGL, a non-zero value inserts a sync fence on each frame for the same purpose.
+    \note Only supported with: Direct3D 11, Direct3D 12, OpenGL.
+    \see RenderContext::WaitForFrameLatency
+    */
+    std::uint32_t           frameLatency    = 0;
+
+    /**
+    \brief Specifies the swap-chain presentation mode. By default PresentMode::Default.
+    \remarks An explicit presentation mode overrides the V-sync derived behavior,
+    e.g. PresentMode::Mailbox presents the most recent frame without blocking on compositor backpressure.
+    \note Only supported with: Vulkan, Direct3D 12.
+    \see PresentMode
+    */
+    PresentMode             presentMode     = PresentMode::Default;
 };
 
 
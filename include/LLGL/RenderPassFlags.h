@@ -141,6 +141,16 @@ struct RenderPassDescriptor
     They are separated here to specify different load and store operations.
     */
     AttachmentFormatDescriptor              stencilAttachment;
+
+    /**
+    \brief Specifies whether the depth and stencil attachments are bound as read-only within the render pass. By default false.
+    \remarks If enabled, the depth-stencil buffer can be sampled as a texture in the same render pass while the depth and stencil tests remain active,
+    e.g. for screen-space reflections or soft particles, without copying the depth buffer beforehand.
+    Writing to the depth and stencil buffers must be disabled in all graphics pipelines used within such a render pass.
+    \see DepthDescriptor::writeEnabled
+    \see StencilFaceDescriptor::writeMask
+    */
+    bool                                    readOnlyDepthStencil = false;
 };
 
 
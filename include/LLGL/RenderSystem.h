@@ -22,6 +22,7 @@
 #include "BufferArray.h"
 #include "Texture.h"
 #include "TextureFlags.h"
+#include "TextureReadback.h"
 #include "Sampler.h"
 #include "SamplerFlags.h"
 #include "ResourceHeap.h"
@@ -47,6 +48,8 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <future>
+#include <mutex>
 #include <cstdint>
 
 
@@ -54,6 +57,8 @@ namespace LLGL
 {
 
 
+class ThreadPool;
+
 /**
 \brief Render system interface.
 \remarks This is the main interface for the entire renderer.
@@ -81,6 +86,8 @@ class LLGL_EXPORT RenderSystem : public Interface
 
         /* ----- Common ----- */
 
+        ~RenderSystem();
+
         /**
         \brief Returns the list of all available render system modules for the current platform.
         \remarks For example, on Win32 this might be { "OpenGL", "Direct3D11", "Direct3D12" }, but on MacOS it might be only { "OpenGL" }.
@@ -158,10 +165,54 @@ class LLGL_EXPORT RenderSystem : public Interface
         \brief Returns the rendering capabilities.
         \remarks The validity of these information is only guaranteed if this function is called
         after a valid render context has been created. Otherwise the behavior is undefined!
+        \remarks Some renderers query the capabilities deferred, i.e. the first call to this function
+        performs the actual driver queries and the results are then memoized.
+        \see GetRenderingFeatures
+        \see GetRenderingLimits
+        */
+        const RenderingCapabilities& GetRenderingCaps() const;
+
+        /**
+        \brief Returns the supported rendering features.
+        \remarks Unlike GetRenderingCaps, this function only resolves the deferred queries for the feature category,
+        which avoids the more expensive format and limit queries if they are never requested.
+        \see GetRenderingCaps
+        */
+        const RenderingFeatures& GetRenderingFeatures() const;
+
+        /**
+        \brief Returns the rendering limits.
+        \remarks Unlike GetRenderingCaps, this function only resolves the deferred queries for the feature and limit categories,
+        which avoids the more expensive format queries if they are never requested.
+        \see GetRenderingCaps
+        */
+        const RenderingLimits& GetRenderingLimits() const;
+
+        /**
+        \brief Returns true if the specified hardware feature is supported.
+        \remarks This is equivalent to reading the respective boolean member of the structure returned by GetRenderingFeatures,
+        but it is backed by a compact bitset that is populated once, so repeated queries reduce to a single bit test.
+        \see Feature
+        \see GetRenderingFeatures
+        */
+        inline bool HasFeature(const Feature feature) const
+        {
+            if (queryCapsFeaturesFunc_)
+                GetRenderingFeatures();
+            return ((featureBits_ & (1ull << static_cast<std::uint32_t>(feature))) != 0);
+        }
+
+        /**
+        \brief Returns true if the specified hardware texture format is supported.
+        \remarks This is equivalent to searching the \c textureFormats list returned by GetRenderingCaps,
+        but it is backed by a flat per-format lookup table that is populated once, so repeated queries reduce to a single array access.
+        \see RenderingCapabilities::textureFormats
         */
-        inline const RenderingCapabilities& GetRenderingCaps() const
+        inline bool IsFormatSupported(const Format format) const
         {
-            return caps_;
+            if (queryCapsFormatsFunc_)
+                ResolveDeferredRenderingCaps(queryCapsFormatsFunc_);
+            return formatSupport_[static_cast<std::size_t>(format)];
         }
 
         /**
@@ -180,6 +231,53 @@ class LLGL_EXPORT RenderSystem : public Interface
             return config_;
         }
 
+        /**
+        \brief Enumerates all video adapters that are available to this render system.
+        \return List of video adapter descriptors, or an empty list if the renderer does not support adapter enumeration.
+        \remarks This can be used to pick a specific adapter (e.g. the discrete GPU on a multi GPU system)
+        via the \c preferredAdapter* members of RenderSystemDescriptor before the render system is loaded again.
+        \see RenderSystemDescriptor::preferredAdapterVendorID
+        \see RenderSystemDescriptor::preferredAdapterDeviceID
+        */
+        virtual std::vector<VideoAdapterDescriptor> QueryVideoAdapters() const;
+
+        /**
+        \brief Queries the current video memory usage and budget of all memory heaps.
+        \return List of memory budget entries, one for each memory heap of the active video adapter,
+        or an empty list if the renderer does not expose memory budgets.
+        \remarks Only supported with: Vulkan (requires the \c VK_EXT_memory_budget extension),
+        Direct3D 12, Direct3D 11 (requires DXGI 1.4), OpenGL (requires \c GL_NVX_gpu_memory_info), Metal.
+        \see SetVideoMemoryPressureCallback
+        */
+        virtual std::vector<VideoMemoryBudget> QueryVideoMemoryBudgets() const;
+
+        /**
+        \brief Queries the allocation statistics of the render system's device memory manager.
+        \return List of statistics entries, one for each memory type that currently has at least one chunk allocated,
+        or an empty list if the renderer does not manage device memory itself.
+        \remarks This can be used to monitor allocation churn and fragmentation,
+        e.g. to tune the minimum chunk size for workloads with many large resources.
+        \remarks Only supported with: Vulkan.
+        \see RendererConfigurationVulkan::minDeviceMemoryAllocationSize
+        \see QueryVideoMemoryBudgets
+        */
+        virtual std::vector<DeviceMemoryStats> QueryDeviceMemoryStats() const;
+
+        //! Callback signature for video memory pressure notifications. The first parameter specifies the index of the affected memory heap.
+        using VideoMemoryPressureCallback = std::function<void(std::uint32_t memoryHeap, const VideoMemoryBudget& budget)>;
+
+        /**
+        \brief Sets the callback that is invoked when video memory allocations approach the heap budget.
+        \param[in] callback Specifies the new callback. This can also be null to disable the notifications.
+        \remarks The callback is invoked from within the resource creation functions whenever a new device memory allocation
+        raises the usage of a memory heap to 90% of its budget or higher, and again only after the usage has dropped
+        below that threshold in the meantime. This can be used by a streaming system to reduce its working set
+        (e.g. by lowering texture resolutions) before the driver starts demoting allocations to slower memory.
+        \remarks Only supported with: Vulkan (requires the \c VK_EXT_memory_budget extension).
+        \see QueryVideoMemoryBudgets
+        */
+        void SetVideoMemoryPressureCallback(const VideoMemoryPressureCallback& callback);
+
         /* ----- Render Context ----- */
 
         /**
@@ -200,6 +298,41 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Returns the single instance of the command queue.
         virtual CommandQueue* GetCommandQueue() = 0;
 
+        /**
+        \brief Returns the command queue for asynchronous compute, or null if the renderer has no dedicated compute queue.
+        \remarks Command buffers submitted to this queue must have been created with the CommandBufferFlags::ComputeOnly flag.
+        Work on the compute queue runs concurrently to the graphics queue (e.g. to overlap a particle simulation with a shadow pass)
+        and must be synchronized with fences via CommandQueue::Submit(Fence&) and CommandQueue::Wait.
+        \note Only supported with: Direct3D 12, Vulkan (only if the device has a dedicated compute queue family).
+        \see CommandBufferFlags::ComputeOnly
+        \see CommandQueue::Wait
+        */
+        virtual CommandQueue* GetComputeCommandQueue();
+
+        /**
+        \brief Returns the number of hardware command queues of the specified type.
+        \param[in] queueType Specifies the command queue type.
+        \remarks Every renderer reports at least one graphics queue.
+        Renderers without dedicated hardware queues report zero compute and transfer queues,
+        in which case the respective work must be submitted to the graphics queue.
+        \see GetCommandQueue(const CommandQueueType, std::uint32_t)
+        */
+        virtual std::uint32_t GetNumCommandQueues(const CommandQueueType queueType);
+
+        /**
+        \brief Returns the command queue of the specified type, or null if the renderer has no such queue.
+        \param[in] queueType Specifies the command queue type.
+        \param[in] index Specifies the zero-based queue index.
+        This must be in the half-open range <code>[0, GetNumCommandQueues(queueType))</code>. By default 0.
+        \remarks <code>GetCommandQueue(CommandQueueType::Graphics)</code> is equivalent to \c GetCommandQueue().
+        Work on different hardware queues runs concurrently (e.g. to overlap resource uploads with rendering)
+        and must be synchronized with fences via CommandQueue::Submit(Fence&) and CommandQueue::Wait.
+        \note Dedicated compute queues are only supported with: Direct3D 12 and Vulkan. Dedicated transfer queues are only supported with: Direct3D 12.
+        \see GetNumCommandQueues
+        \see CommandQueue::Wait
+        */
+        virtual CommandQueue* GetCommandQueue(const CommandQueueType queueType, std::uint32_t index = 0);
+
         /* ----- Command buffers ----- */
 
         /**
@@ -207,6 +340,9 @@ class LLGL_EXPORT RenderSystem : public Interface
         \remarks All render systems can create multiple command buffers,
         but especially for the legacy graphics APIs such as OpenGL and Direct3D 11, this doesn't provide any benefit,
         since all graphics and compute commands are submitted sequentially to the GPU.
+        \remarks This function (and the respective \c Release function) is thread safe,
+        so worker threads can create their own deferred command buffers for multithreaded command encoding.
+        \see CommandQueue::Submit(std::uint32_t, CommandBuffer* const *)
         */
         virtual CommandBuffer* CreateCommandBuffer(const CommandBufferDescriptor& desc = {}) = 0;
 
@@ -261,6 +397,18 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize) = 0;
 
+        /**
+        \brief Result returning variant of WriteBuffer that reports failures via error code instead of exceptions.
+        \return ErrorCode::NoError if the buffer was updated,
+        ErrorCode::InvalidArgument if \c data is null while \c dataSize is non-zero,
+        or ErrorCode::InternalError if the renderer failed to update the buffer.
+        \remarks This is intended for tight update loops and for builds where exceptions are disabled,
+        where the throwing validation of the regular entry point is undesired.
+        \see WriteBuffer
+        \see ErrorCode
+        */
+        ErrorCode TryWriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize);
+
         /**
         \brief Maps the specified buffer from GPU to CPU memory space.
         \param[in] buffer Specifies the buffer which is to be mapped.
@@ -270,12 +418,47 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void* MapBuffer(Buffer& buffer, const CPUAccess access) = 0;
 
+        /**
+        \brief Result returning variant of MapBuffer that reports failures via error code instead of exceptions.
+        \param[out] mappedData Specifies the output pointer to the mapped memory block. This must not be null.
+        \return ErrorCode::NoError if the buffer was mapped,
+        ErrorCode::InvalidArgument if \c mappedData is null,
+        or ErrorCode::InternalError if the renderer failed to map the buffer.
+        \see MapBuffer
+        \see ErrorCode
+        */
+        ErrorCode TryMapBuffer(Buffer& buffer, const CPUAccess access, void** mappedData);
+
         /**
         \brief Unmaps the specified buffer.
         \see MapBuffer
         */
         virtual void UnmapBuffer(Buffer& buffer) = 0;
 
+        /**
+        \brief Returns the stable CPU pointer of a persistently mapped buffer.
+        \param[in] buffer Specifies the buffer whose mapped memory is to be retrieved.
+        \return Raw pointer to the persistently mapped memory block,
+        or null if the buffer was not created with the MiscFlags::PersistentMapped flag or the renderer does not support persistent mapping.
+        \remarks The pointer remains valid until the buffer is released, so there is no unmap counterpart.
+        The mapping is coherent, i.e. writes through this pointer are automatically made visible to the GPU.
+        \note Only supported with: OpenGL (requires \c GL_ARB_buffer_storage), Vulkan.
+        \see MiscFlags::PersistentMapped
+        \see FlushMappedBufferRange
+        */
+        virtual void* GetMappedBufferMemory(Buffer& buffer);
+
+        /**
+        \brief Makes the specified range of a persistently mapped buffer visible to the GPU.
+        \param[in] buffer Specifies the buffer whose mapped memory range is to be flushed.
+        \param[in] offset Specifies the offset (in bytes) of the range within the buffer.
+        \param[in] size Specifies the size (in bytes) of the range within the buffer.
+        \remarks Persistently mapped buffers are currently always mapped coherently, so this function has no effect.
+        It is provided for portability with platforms where coherent mappings may not be available.
+        \see GetMappedBufferMemory
+        */
+        virtual void FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size);
+
         /* ----- Textures ----- */
 
         /**
@@ -285,10 +468,32 @@ class LLGL_EXPORT RenderSystem : public Interface
         If this is null, the texture will be initialized with the currently configured default image color (if this feature is enabled).
         If this is non-null, it is used to initialize the texture data.
         This parameter will be ignored if the texture type is a multi-sampled texture (i.e. TextureType::Texture2DMS or TextureType::Texture2DMSArray).
+        \remarks If the image format and data type of 'imageDesc' already match the hardware texture format,
+        no conversion or intermediate copy is performed and the image data is read directly from the caller's buffer.
+        This allows zero-copy uploads from externally managed memory such as a memory-mapped asset file.
         \see WriteTexture
+        \see ConvertImageBuffer
         */
         virtual Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) = 0;
 
+        /**
+        \brief Creates a new texture view that shares the image data of another texture.
+        \param[in] sharedTexture Specifies the texture the view shares its image data with.
+        This texture must not be released before the texture view.
+        \param[in] textureViewDesc Specifies the texture view descriptor,
+        i.e. the type, format, subresource range, and component swizzle of the view.
+        \return Pointer to the new texture view, or null if the renderer does not support texture views.
+        \remarks Texture views reinterpret an existing texture resource without copying it:
+        e.g. a single MIP-map level can be exposed as a render target, an sRGB format can be re-read as UNORM,
+        or the stencil component of a depth-stencil target can be sampled.
+        The view and the shared texture must be in the same format class (see TextureViewDescriptor::format).
+        \note Only supported with: OpenGL (requires \c GL_ARB_texture_view), Vulkan, Direct3D 11.
+        For other renderers, texture views are only available within resource heaps.
+        \see ResourceViewDescriptor::textureView
+        \see RenderingFeatures::hasTextureViews
+        */
+        virtual Texture* CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc);
+
         //! Releases the specified texture object. After this call, the specified object must no longer be used.
         virtual void Release(Texture& texture) = 0;
 
@@ -301,6 +506,54 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) = 0;
 
+        /**
+        \brief Updates the image data of multiple regions of the specified texture at once.
+        \param[in] texture Specifies the texture whose data is to be updated.
+        \param[in] writeDescs Pointer to an array of texture write descriptors. This must not be null!
+        \param[in] numWriteDescs Specifies the number of entries in the \c writeDescs array.
+        \remarks This is equivalent to calling WriteTexture once for each entry,
+        but allows the renderer to batch all regions into a single staging allocation and a single copy-command sequence.
+        This is considerably faster when many subresources are updated at once,
+        e.g. when all faces and MIP-map levels of an environment cube map are streamed in.
+        \see WriteTexture
+        */
+        virtual void WriteTextureMulti(Texture& texture, const TextureWriteDescriptor* writeDescs, std::uint32_t numWriteDescs);
+
+        /**
+        \brief Sets the minimum level-of-detail (LOD) clamp of the specified texture.
+        \param[in] texture Specifies the texture whose LOD clamp is to be updated.
+        \param[in] minLod Specifies the minimum LOD value; sampling the texture will not access any MIP-map level below this value. By default 0.
+        \remarks This is a lightweight per-texture state change intended for MIP-map streaming:
+        while the most detailed MIP-map levels are not yet resident (see TextureDescriptor::sparseResidentMipLevels),
+        the clamp redirects sampling to the levels that already contain valid data,
+        and it can be relaxed after an upload without recreating the texture, its views, or its samplers.
+        \note Only supported with: OpenGL, Direct3D 11.
+        For Vulkan, use the \c minLod field of one or more pre-created samplers instead.
+        \see TextureDescriptor::sparseResidentMipLevels
+        \see CommandQueue::BindSparseTexture
+        */
+        virtual void SetTextureMinLod(Texture& texture, float minLod);
+
+        /**
+        \brief Returns true if the deferred initial upload of the specified texture has completed.
+        \param[in] texture Specifies the texture whose upload state is queried.
+        \remarks This is a non-blocking poll for textures created with the MiscFlags::DeferredUpload flag.
+        For all other textures, and for renderers that upload synchronously, this always returns true.
+        \see MiscFlags::DeferredUpload
+        \see WaitForTextureUpload
+        */
+        virtual bool IsTextureUploadComplete(Texture& texture);
+
+        /**
+        \brief Blocks until the deferred initial upload of the specified texture has completed.
+        \param[in] texture Specifies the texture whose upload is waited for.
+        \remarks This has no effect on textures that were not created with the MiscFlags::DeferredUpload flag,
+        or on renderers that upload synchronously.
+        \see MiscFlags::DeferredUpload
+        \see IsTextureUploadComplete
+        */
+        virtual void WaitForTextureUpload(Texture& texture);
+
         /**
         \brief Reads the image data from the specified texture.
         \param[in] texture Specifies the texture object to read from.
@@ -336,6 +589,39 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) = 0;
 
+        /**
+        \brief Starts an asynchronous read operation of the specified texture.
+        \param[in] texture Specifies the texture object to read from.
+        \param[in] mipLevel Specifies the MIP-level from which to read the texture data.
+        \param[in] format Specifies the image format in which the texture data is to be read.
+        \param[in] dataType Specifies the data type in which the texture data is to be read.
+        \return Pointer to the new TextureReadback object, or null if the renderer does not support asynchronous readbacks.
+        \remarks In contrast to ReadTexture, this function does not block until the data is available:
+        the texture data is copied into an internal buffer while the GPU pipeline keeps working,
+        and the readback object can be polled for completion.
+        The readback object must be released with the respective Release function when it is no longer needed.
+        \note Only supported with: OpenGL.
+        \see TextureReadback
+        \see Release(TextureReadback&)
+        */
+        virtual TextureReadback* ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, const ImageFormat format, const DataType dataType);
+
+        /**
+        \brief Releases the specified texture readback object. After this call, the specified object must no longer be used.
+        \see ReadTextureAsync
+        */
+        virtual void Release(TextureReadback& textureReadback);
+
+        /**
+        \brief Processes all pending readback objects and invokes their completion callbacks.
+        \remarks Call this once per frame to receive completion callbacks for readbacks started with ReadTextureAsync.
+        Each callback is invoked at most once, on the thread that calls this function.
+        Readbacks that are polled manually with TextureReadback::IsComplete do not require this function.
+        \see ReadTextureAsync
+        \see TextureReadback::SetCompletedCallback
+        */
+        virtual void ProcessReadbacks();
+
         /* ----- Samplers ---- */
 
         /**
@@ -348,6 +634,19 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Releases the specified Sampler object. After this call, the specified object must no longer be used.
         virtual void Release(Sampler& sampler) = 0;
 
+        /**
+        \brief Releases the specified array of resource objects (i.e. Buffer, Texture, and Sampler objects).
+        \param[in] numResources Specifies the number of entries in the \c resources array.
+        \param[in] resources Pointer to the array of resources to release. This must not be null if \c numResources is greater than zero.
+        \remarks This is equivalent to calling Release for each resource individually,
+        but the resources are first sorted by type, so each internal object container is only touched once.
+        If the renderer supports concurrent resource creation, the destruction work is deferred to a worker thread,
+        which turns large teardowns (e.g. at level exit) into a background operation.
+        \remarks As with the individual Release functions, none of the specified resources must be in use by the GPU anymore.
+        \see RenderingFeatures::hasConcurrentResourceCreation
+        */
+        void Release(std::uint32_t numResources, Resource* const* resources);
+
         /* ----- Resource Heaps ----- */
 
         /**
@@ -364,6 +663,28 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Releases the specified ResourceHeap object. After this call, the specified object must no longer be used.
         virtual void Release(ResourceHeap& resourceHeap) = 0;
 
+        /**
+        \brief Updates a range of descriptors of the specified resource heap in place.
+        \param[in] resourceHeap Specifies the resource heap whose descriptors are to be updated.
+        \param[in] firstDescriptor Specifies the zero-based index of the first descriptor to update.
+        This refers to the same order in which the resource views were specified when the resource heap was created.
+        \param[in] numResourceViews Specifies the number of consecutive descriptors to update. This must be greater than zero.
+        \param[in] resourceViews Pointer to the array of new resource view descriptors. This <b>must not</b> be null!
+        \remarks This updates the descriptors without re-creating the resource heap,
+        which avoids the overhead of a full heap rebuild when only a few bindings change (e.g. when a material is edited).
+        Each new resource must be of the same resource type as the binding it replaces, since the pipeline layout of the heap is immutable.
+        \remarks The resource heap must not be updated while any command buffer that binds it is still pending execution.
+        \note Only supported with: OpenGL, Vulkan, Direct3D 11, Direct3D 12.
+        \see CreateResourceHeap
+        \see ResourceHeapDescriptor::resourceViews
+        */
+        virtual void WriteResourceHeap(
+            ResourceHeap&                   resourceHeap,
+            std::uint32_t                   firstDescriptor,
+            std::uint32_t                   numResourceViews,
+            const ResourceViewDescriptor*   resourceViews
+        );
+
         /* ----- Render Passes ----- */
 
         /**
@@ -403,6 +724,19 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual Shader* CreateShader(const ShaderDescriptor& desc) = 0;
 
+        /**
+        \brief Creates multiple shaders in one batch.
+        \param[in] numShaders Specifies the number of shaders to create.
+        \param[in] shaderDescs Pointer to the array of shader descriptors. This must not be null if \c numShaders is greater than zero!
+        \return List of the new Shader objects, in the same order as the input descriptors.
+        \remarks If the renderer supports concurrent shader compilation, the shaders are compiled in parallel on an internal worker thread pool,
+        which can reduce the first-run time considerably when many shader permutations are created at once.
+        Otherwise, this is equivalent to calling CreateShader for each descriptor.
+        The memory the descriptors refer to (e.g. the \c source member) must remain valid until this function returns.
+        \see CreateShader
+        */
+        std::vector<Shader*> CreateShaders(std::size_t numShaders, const ShaderDescriptor* shaderDescs);
+
         /**
         \brief Creates a new shader program and links all specified shaders.
         \remarks To check whether the linking was successful or not, use the \c HasErrors and \c GetReport functions of the ShaderProgram interface.
@@ -460,6 +794,78 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Releases the specified ComputePipeline object. After this call, the specified object must no longer be used.
         virtual void Release(ComputePipeline& computePipeline) = 0;
 
+        /**
+        \brief Returns the serialized pipeline cache data of this render system.
+        \remarks The pipeline cache accumulates driver specific compilation results while pipeline states are created.
+        The returned blob is opaque (e.g. the content of a \c VkPipelineCache in the Vulkan backend) and can be stored to disk
+        and passed to SetPipelineCacheData on the next application start, so that recreating the same pipelines is significantly faster.
+        \return Serialized cache data, or an empty container if the renderer does not support pipeline caches.
+        \see SetPipelineCacheData
+        */
+        virtual std::vector<std::uint8_t> GetPipelineCacheData() const;
+
+        /**
+        \brief Initializes the pipeline cache of this render system with previously serialized cache data.
+        \param[in] data Pointer to the cache blob that was previously returned by GetPipelineCacheData.
+        \param[in] dataSize Specifies the size (in bytes) of the cache blob.
+        \remarks This must be called before the pipeline states are created in order to take effect.
+        Cache data from a different device or driver version is validated by the backend and ignored if incompatible.
+        \return True if the cache data was accepted, otherwise the renderer either rejected the blob or does not support pipeline caches.
+        \see GetPipelineCacheData
+        */
+        virtual bool SetPipelineCacheData(const void* data, std::size_t dataSize);
+
+        /**
+        \brief Initializes the pipeline cache of this render system from the specified shared cache directory.
+        \param[in] directory Specifies the cache directory. This must not be null and the directory must already exist.
+        \remarks The cache file within the directory is derived from the renderer name (see GetName),
+        so render systems of different backends can share the same directory.
+        The directory may be shared between multiple processes on the same machine:
+        writers are serialized with an advisory file lock and publish the cache file atomically (see SavePipelineCacheToDirectory),
+        so this function always reads a consistent cache blob.
+        This must be called before the pipeline states are created in order to take effect.
+        \return True if a cache file was found and its content was accepted by the backend.
+        \see SavePipelineCacheToDirectory
+        \see SetPipelineCacheData
+        */
+        bool LoadPipelineCacheFromDirectory(const char* directory);
+
+        /**
+        \brief Stores the pipeline cache of this render system in the specified shared cache directory.
+        \param[in] directory Specifies the cache directory. This must not be null and the directory must already exist.
+        \remarks Concurrent writers from other processes are serialized with an advisory file lock,
+        and the cache file is published atomically by writing to a temporary file first and renaming it afterwards,
+        i.e. other processes either see the previous or the new cache file but never a partially written one.
+        This is intended for setups where many processes on one machine create the same pipeline states,
+        so the first process that compiled a pipeline permutation serves all others.
+        \return True if the cache data was written to the directory.
+        \see LoadPipelineCacheFromDirectory
+        \see GetPipelineCacheData
+        */
+        bool SavePipelineCacheToDirectory(const char* directory) const;
+
+        /**
+        \brief Creates a new graphics pipeline state object asynchronously.
+        \param[in] desc Specifies the graphics pipeline descriptor. The descriptor is copied, but the referenced objects
+        (e.g. the \c shaderProgram member) must remain valid until the returned future is ready.
+        \return Future that provides the new GraphicsPipeline object once it has been created.
+        \remarks If the renderer supports concurrent pipeline creation, the pipeline is created on an internal worker thread pool
+        and the returned future can be polled (e.g. with \c wait_for) while another pipeline is used as fallback until it is ready.
+        Otherwise, the pipeline is created on the calling thread and the future is ready immediately.
+        \see CreateGraphicsPipeline
+        */
+        std::future<GraphicsPipeline*> CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc);
+
+        /**
+        \brief Creates a new compute pipeline state object asynchronously.
+        \param[in] desc Specifies the compute pipeline descriptor. The descriptor is copied, but the referenced objects
+        (e.g. the \c shaderProgram member) must remain valid until the returned future is ready.
+        \return Future that provides the new ComputePipeline object once it has been created.
+        \see CreateGraphicsPipelineAsync
+        \see CreateComputePipeline
+        */
+        std::future<ComputePipeline*> CreateComputePipelineAsync(const ComputePipelineDescriptor& desc);
+
         /* ----- Queries ----- */
 
         //! Creates a new query heap.
@@ -482,7 +888,7 @@ class LLGL_EXPORT RenderSystem : public Interface
 
     protected:
 
-        RenderSystem() = default;
+        RenderSystem();
 
         //! Sets the renderer information.
         void SetRendererInfo(const RendererInfo& info);
@@ -490,6 +896,31 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Sets the rendering capabilities.
         void SetRenderingCaps(const RenderingCapabilities& caps);
 
+        //! Callback interface for deferred rendering capabilities queries.
+        using QueryRenderingCapsFunc = std::function<void(RenderingCapabilities& caps)>;
+
+        /**
+        \brief Defers the rendering capabilities queries until they are requested the first time.
+        \param[in] queryFeaturesFunc Specifies the callback that queries the fixed rendering attributes and supported features.
+        \param[in] queryFormatsFunc Specifies the callback that queries the supported hardware formats.
+        \param[in] queryLimitsFunc Specifies the callback that queries the feature limits. This callback may depend on the
+        supported features, so the feature category is always resolved before the limit category.
+        \remarks Each callback is invoked at most once, when the respective category is requested the first time,
+        and the results are memoized. This replaces any capabilities previously set by SetRenderingCaps.
+        \see GetRenderingCaps
+        */
+        void SetDeferredRenderingCaps(
+            QueryRenderingCapsFunc&& queryFeaturesFunc,
+            QueryRenderingCapsFunc&& queryFormatsFunc,
+            QueryRenderingCapsFunc&& queryLimitsFunc
+        );
+
+        //! Returns the video memory pressure callback, or null if no callback has been set.
+        inline const VideoMemoryPressureCallback& GetVideoMemoryPressureCallback() const
+        {
+            return videoMemoryPressureCallback_;
+        }
+
         //! Validates the specified buffer descriptor to be used for buffer creation.
         void AssertCreateBuffer(const BufferDescriptor& desc, std::uint64_t maxSize);
 
@@ -511,14 +942,61 @@ class LLGL_EXPORT RenderSystem : public Interface
         //! Validates the specified image data size against the required size (in bytes).
         void AssertImageDataSize(std::size_t dataSize, std::size_t requiredDataSize, const char* info = nullptr);
 
+        /**
+        \brief Returns true if the "Create...Pipeline" functions of this render system can be called concurrently.
+        \remarks Renderers that return true here create asynchronous pipelines on an internal worker thread pool.
+        The default implementation returns false, in which case asynchronous pipelines are created on the calling thread.
+        \see CreateGraphicsPipelineAsync
+        */
+        virtual bool SupportsConcurrentPipelineCreation() const;
+
+        /**
+        \brief Returns true if the CreateShader function of this render system can be called concurrently.
+        \remarks Renderers that return true here compile batched shaders on an internal worker thread pool.
+        The default implementation returns false, in which case batched shaders are compiled on the calling thread.
+        \see CreateShaders
+        */
+        virtual bool SupportsConcurrentShaderCompilation() const;
+
     private:
 
-        int                         rendererID_ = 0;
-        std::string                 name_;
+        //! Capture layer entry point; needs access to the renderer ID and name of the wrapped render system.
+        friend LLGL_EXPORT std::unique_ptr<RenderSystem> CaptureRenderSystem(std::unique_ptr<RenderSystem>&& renderSystem, const char* filename);
+
+        //! Enqueues the specified task on the worker thread pool; the pool is started on first use.
+        void ScheduleWorkerTask(std::function<void()>&& task);
+
+        //! Runs the specified task either on the worker thread pool or on the calling thread.
+        void SchedulePipelineTask(std::function<void()>&& task);
+
+        //! Invokes and resets the specified deferred capabilities query if it is still pending.
+        void ResolveDeferredRenderingCaps(QueryRenderingCapsFunc& queryFunc) const;
+
+        //! Rebuilds the cached feature bitset and per-format lookup table from the current capabilities.
+        void UpdateCachedCaps() const;
+
+    private:
+
+        int                                 rendererID_ = 0;
+        std::string                         name_;
+
+        RendererInfo                        info_;
+        RenderSystemConfiguration           config_;
+
+        /* Rendering capabilities with deferred per-category queries (see SetDeferredRenderingCaps) */
+        mutable RenderingCapabilities       caps_;
+        mutable QueryRenderingCapsFunc      queryCapsFeaturesFunc_;
+        mutable QueryRenderingCapsFunc      queryCapsFormatsFunc_;
+        mutable QueryRenderingCapsFunc      queryCapsLimitsFunc_;
+
+        /* Cached O(1) capability lookups (see HasFeature and IsFormatSupported) */
+        mutable std::uint64_t               featureBits_        = 0;
+        mutable bool                        formatSupport_[256] = {};
+
+        VideoMemoryPressureCallback         videoMemoryPressureCallback_;
 
-        RendererInfo                info_;
-        RenderingCapabilities       caps_;
-        RenderSystemConfiguration   config_;
+        std::unique_ptr<ThreadPool>         workerThreads_;
+        std::mutex                          workerThreadsMutex_;
 
 };
 
@@ -14,6 +14,7 @@
 #include "TextureFlags.h"
 #include "Constants.h"
 #include "RendererConfiguration.h"
+#include "VideoAdapter.h"
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -173,6 +174,50 @@ enum class CPUAccess
     ReadWrite,
 };
 
+/**
+\brief Error code enumeration for the result returning entry point variants.
+\remarks These variants report failures via return value instead of exceptions,
+so they can be used in tight loops and in builds where exceptions are disabled (see \c LLGL_DISABLE_EXCEPTIONS build option).
+\see RenderSystem::TryMapBuffer
+\see RenderSystem::TryWriteBuffer
+*/
+enum class ErrorCode
+{
+    NoError,            //!< No error occurred. The name \c Success is avoided here, since it collides with an X11 macro.
+    InvalidArgument,    //!< An input argument was invalid, e.g. a null pointer.
+    InternalError,      //!< The renderer failed to perform the operation.
+};
+
+/**
+\brief Hardware command queue types.
+\remarks Modern rendering APIs expose dedicated hardware queues for compute and transfer work,
+which run concurrently to the graphics queue.
+\see RenderSystem::GetNumCommandQueues
+\see RenderSystem::GetCommandQueue(const CommandQueueType, std::uint32_t)
+*/
+enum class CommandQueueType
+{
+    /**
+    \brief Graphics command queue; accepts graphics, compute, and transfer commands.
+    \remarks Every renderer has at least one graphics queue, which is also returned by RenderSystem::GetCommandQueue().
+    */
+    Graphics,
+
+    /**
+    \brief Compute command queue; accepts compute and transfer commands.
+    \remarks Command buffers submitted to such a queue must have been created with the CommandBufferFlags::ComputeOnly flag.
+    \see CommandBufferFlags::ComputeOnly
+    */
+    Compute,
+
+    /**
+    \brief Transfer command queue; accepts transfer commands only.
+    \remarks Command buffers submitted to such a queue must have been created with the CommandBufferFlags::TransferOnly flag.
+    \see CommandBufferFlags::TransferOnly
+    */
+    Transfer,
+};
+
 
 /* ----- Structures ----- */
 
@@ -188,7 +233,20 @@ struct RenderSystemConfiguration
     to convert the image data into the respective hardware texture format. OpenGL does this automatically.
     \see Constants::maxThreadCount
     */
-    std::size_t threadCount = Constants::maxThreadCount;
+    std::size_t threadCount             = Constants::maxThreadCount;
+
+    /**
+    \brief Specifies whether pipeline states with identical descriptors are deduplicated. By default false.
+    \remarks If enabled, the "CreateGraphicsPipeline" and "CreateComputePipeline" functions return the same pipeline object
+    for descriptors with identical contents, which eliminates redundant driver compilations and their memory.
+    The shared object is reference counted and only destroyed when "Release" has been called once for each creation.
+    With Vulkan, the "CreateRenderPass" function also shares one render pass object across all compatible descriptors,
+    which in turn increases the deduplication hit rate for graphics pipelines that reference such a render pass.
+    \note Only supported with: Vulkan, Direct3D 12.
+    \see RenderSystem::CreateGraphicsPipeline
+    \see RenderSystem::CreateRenderPass
+    */
+    bool        pipelineDeduplication   = false;
 };
 
 /**
@@ -264,10 +322,10 @@ struct RenderSystemDescriptor
     translated to "LLGL_OpenGLD.dll", if compiled on Windows in Debug mode.
     If LLGL was built with the \c LLGL_BUILD_STATIC_LIB option, this member is ignored.
     */
-    std::string     moduleName;
+    std::string         moduleName;
 
     //! Debuging callback function object.
-    DebugCallback   debugCallback;
+    DebugCallback       debugCallback;
 
     /**
     \brief Optional raw pointer to a renderer specific configuration structure.
@@ -291,14 +349,53 @@ struct RenderSystemDescriptor
     \see RendererConfigurationVulkan
     \see RendererConfigurationOpenGL
     */
-    const void*     rendererConfig      = nullptr;
+    const void*         rendererConfig              = nullptr;
 
     /**
     \brief Specifies the size (in bytes) of the structure where the 'rendererConfig' member points to (use 'sizeof' with the respective structure). By default 0.
     \remarks If 'rendererConfig' is null then this member is ignored.
     \see rendererConfig
     */
-    std::size_t     rendererConfigSize  = 0;
+    std::size_t         rendererConfigSize          = 0;
+
+    /**
+    \brief Specifies the preferred video adapter type. By default VideoAdapterType::Undefined.
+    \remarks If this is undefined, renderers that support adapter selection prefer a discrete GPU over an integrated one.
+    This is currently only supported by the Vulkan renderer.
+    \see RenderSystem::QueryVideoAdapters
+    */
+    VideoAdapterType    preferredAdapterType        = VideoAdapterType::Undefined;
+
+    /**
+    \brief Specifies the hardware vendor ID of the video adapter the render system is pinned to. By default 0.
+    \remarks If non-zero, only adapters of this vendor are considered during adapter selection.
+    Use this together with 'preferredAdapterDeviceID' to pin the render system to a specific adapter
+    (e.g. to avoid an accidental integrated GPU selection on a multi GPU system);
+    RenderSystem::Load throws an exception if no such adapter exists.
+    This is currently only supported by the Vulkan renderer.
+    \see VideoAdapterDescriptor::vendorID
+    */
+    std::uint32_t       preferredAdapterVendorID    = 0;
+
+    /**
+    \brief Specifies the hardware device ID of the video adapter the render system is pinned to. By default 0.
+    \remarks If non-zero, only adapters with this device ID are considered during adapter selection.
+    \see preferredAdapterVendorID
+    \see VideoAdapterDescriptor::deviceID
+    */
+    std::uint32_t       preferredAdapterDeviceID    = 0;
+
+    /**
+    \brief Specifies whether the render system is initialized without presentation support. By default false.
+    \remarks If enabled, the render system does not require a window system to be available:
+    the Vulkan renderer creates its instance and device without the surface and swap-chain extensions,
+    and the OpenGL renderer creates an off-screen context (e.g. via a GLX pixel buffer) during RenderSystem::Load,
+    so resources and command buffers can be created before (or without) any render context.
+    In return, RenderSystem::CreateRenderContext must no longer be used and rendering is done exclusively into render targets.
+    This is intended for off-screen rendering, GPGPU, and server-side processing.
+    \see RenderSystem::CreateRenderTarget
+    */
+    bool                headless                    = false;
 };
 
 /**
@@ -364,6 +461,13 @@ struct RenderingFeatures
     */
     bool hasTextureViewSwizzle          = false;
 
+    /**
+    \brief Specifies whether partially-resident (sparse) textures are supported.
+    \see MiscFlags::SparseResidency
+    \see CommandQueue::BindSparseTexture
+    */
+    bool hasSparseTextures              = false;
+
     //! Specifies whether samplers are supported.
     bool hasSamplers                    = false;
 
@@ -409,6 +513,14 @@ struct RenderingFeatures
     */
     bool hasComputeShaders              = false;
 
+    /**
+    \brief Specifies whether task and mesh shaders are supported.
+    \see ShaderType::Task
+    \see ShaderType::Mesh
+    \see CommandBuffer::DrawMeshTasks
+    */
+    bool hasMeshShaders                 = false;
+
     /**
     \brief Specifies whether hardware instancing is supported.
     \see CommandBuffer::DrawInstanced(std::uint32_t, std::uint32_t, std::uint32_t)
@@ -431,6 +543,13 @@ struct RenderingFeatures
     */
     bool hasIndirectDrawing             = false;
 
+    /**
+    \brief Specifies whether indirect draw commands with a GPU-provided draw count are supported.
+    \see CommandBuffer::DrawIndirect(Buffer&, std::uint64_t, Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+    \see CommandBuffer::DrawIndexedIndirect(Buffer&, std::uint64_t, Buffer&, std::uint64_t, std::uint32_t, std::uint32_t)
+    */
+    bool hasDrawIndirectCount           = false;
+
     /**
     \brief Specifies whether multiple viewports, depth-ranges, and scissors at once are supported.
     \see RenderingLimits::maxViewports
@@ -470,6 +589,56 @@ struct RenderingFeatures
     \see CommandBuffer:BeginRenderCondition
     */
     bool hasRenderCondition             = false;
+
+    /**
+    \brief Specifies whether resources can be created and released concurrently.
+    \remarks If this is true, the \c Create and \c Release entry points of the render system for buffers, textures,
+    and samplers are thread-safe, i.e. loader threads can create resources in parallel without external synchronization.
+    Internally, the object containers are sharded and the staging paths are synchronized,
+    so threads only contend where the hardware interface requires serialization (e.g. queue submission).
+    If this is false, all render system functions must be externally serialized, which remains the default contract.
+    */
+    bool hasConcurrentResourceCreation  = false;
+};
+
+/**
+\brief Hardware feature enumeration for compact O(1) feature queries.
+\remarks Each entry corresponds to one of the boolean members of the RenderingFeatures structure
+and the entries must be declared in the same order as those members.
+\see RenderSystem::HasFeature
+\see RenderingFeatures
+*/
+enum class Feature
+{
+    DirectResourceBinding,      //!< \see RenderingFeatures::hasDirectResourceBinding
+    RenderTargets,              //!< \see RenderingFeatures::hasRenderTargets
+    Textures3D,                 //!< \see RenderingFeatures::has3DTextures
+    CubeTextures,               //!< \see RenderingFeatures::hasCubeTextures
+    ArrayTextures,              //!< \see RenderingFeatures::hasArrayTextures
+    CubeArrayTextures,          //!< \see RenderingFeatures::hasCubeArrayTextures
+    MultiSampleTextures,        //!< \see RenderingFeatures::hasMultiSampleTextures
+    TextureViews,               //!< \see RenderingFeatures::hasTextureViews
+    TextureViewSwizzle,         //!< \see RenderingFeatures::hasTextureViewSwizzle
+    SparseTextures,             //!< \see RenderingFeatures::hasSparseTextures
+    Samplers,                   //!< \see RenderingFeatures::hasSamplers
+    ConstantBuffers,            //!< \see RenderingFeatures::hasConstantBuffers
+    StorageBuffers,             //!< \see RenderingFeatures::hasStorageBuffers
+    Uniforms,                   //!< \see RenderingFeatures::hasUniforms
+    GeometryShaders,            //!< \see RenderingFeatures::hasGeometryShaders
+    TessellationShaders,        //!< \see RenderingFeatures::hasTessellationShaders
+    ComputeShaders,             //!< \see RenderingFeatures::hasComputeShaders
+    MeshShaders,                //!< \see RenderingFeatures::hasMeshShaders
+    Instancing,                 //!< \see RenderingFeatures::hasInstancing
+    OffsetInstancing,           //!< \see RenderingFeatures::hasOffsetInstancing
+    IndirectDrawing,            //!< \see RenderingFeatures::hasIndirectDrawing
+    DrawIndirectCount,          //!< \see RenderingFeatures::hasDrawIndirectCount
+    ViewportArrays,             //!< \see RenderingFeatures::hasViewportArrays
+    ConservativeRasterization,  //!< \see RenderingFeatures::hasConservativeRasterization
+    StreamOutputs,              //!< \see RenderingFeatures::hasStreamOutputs
+    LogicOp,                    //!< \see RenderingFeatures::hasLogicOp
+    PipelineStatistics,         //!< \see RenderingFeatures::hasPipelineStatistics
+    RenderCondition,            //!< \see RenderingFeatures::hasRenderCondition
+    ConcurrentResourceCreation, //!< \see RenderingFeatures::hasConcurrentResourceCreation
 };
 
 /**
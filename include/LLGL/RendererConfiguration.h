@@ -86,6 +86,9 @@ struct RendererConfigurationVulkan
     \remarks Vulkan only allows a limited set of device memory objects (e.g. 4096 on a GPU with 8 GB of VRAM).
     This member specifies the minimum size used for hardware memory allocation of such a memory chunk.
     The Vulkan render system automatically manages sub-region allocation and defragmentation.
+    Workloads with many large resources (e.g. streaming of large textures) benefit from a considerably larger value,
+    since it reduces the number of driver allocations; use RenderSystem::QueryDeviceMemoryStats to tune this value.
+    \see RenderSystem::QueryDeviceMemoryStats
     \todo Remove this as soon as Vulkan memory manage has been improved.
     */
     std::uint64_t               minDeviceMemoryAllocationSize   = 1024*1024;
@@ -10,6 +10,7 @@
 
 
 #include "Export.h"
+#include <cstdint>
 #include <map>
 #include <string>
 
@@ -36,6 +37,31 @@ enum class WarningType
     VaryingBehavior,    //!< Warning due to a varying behavior between the native APIs (e.g. \c SV_VertexID in HLSL behaves different to \c gl_VertexID in GLSL or \c gl_VertexIndex in SPIRV).
 };
 
+/**
+\brief Debugging layer validation category flags.
+\see RenderingDebugger::SetValidationCategories
+*/
+struct ValidationCategoryFlags
+{
+    enum
+    {
+        //! Validation of resource bindings, e.g. binding a buffer without the required binding flags.
+        Bindings    = (1 << 0),
+
+        //! Validation of draw state completeness, e.g. drawing without a graphics pipeline or vertex buffer being bound.
+        DrawState   = (1 << 1),
+
+        //! Validation of value ranges and hardware limits, e.g. viewport dimensions or thread group sizes.
+        ValueLimits = (1 << 2),
+
+        //! Validation of encoding and threading rules, e.g. recording commands outside of an encoding section.
+        Threading   = (1 << 3),
+
+        //! All validation categories. This is the default.
+        All         = (Bindings | DrawState | ValueLimits | Threading),
+    };
+};
+
 
 /**
 \brief Rendering debugger interface.
@@ -62,6 +88,63 @@ class LLGL_EXPORT RenderingDebugger
         */
         void SetDebugGroup(const char* name);
 
+        /**
+        \brief Sets the sampling interval (in frames) for validation. By default 1.
+        \param[in] interval Specifies every how many frames the debugging layer performs full validation.
+        If this is 1, every frame is validated.
+        If this is greater than 1, only every Nth frame is validated and all commands are cheaply passed through on the remaining frames,
+        which bounds the validation overhead for long-running automated tests.
+        If this is 0, validation is disabled entirely until a non-zero interval is set again.
+        \see NextFrame
+        */
+        void SetSamplingInterval(std::uint32_t interval);
+
+        /**
+        \brief Advances the frame counter for validation sampling.
+        \remarks This is called automatically by the debugging layer whenever a render context is presented.
+        Hence, manual calls are only necessary for workloads that never present a render context (e.g. headless compute).
+        \see SetSamplingInterval
+        \see RenderContext::Present
+        */
+        void NextFrame();
+
+        /**
+        \brief Returns true if the debugging layer is to perform full validation for the current frame.
+        \see SetSamplingInterval
+        */
+        bool IsFrameValidationEnabled() const;
+
+        //! Returns the sampling interval (in frames) for validation.
+        inline std::uint32_t GetSamplingInterval() const
+        {
+            return samplingInterval_;
+        }
+
+        /**
+        \brief Sets the categories of validation the debugging layer performs. By default ValidationCategoryFlags::All.
+        \param[in] categories Specifies a bitwise OR combination of entries of the ValidationCategoryFlags enumeration.
+        Validation blocks of disabled categories are skipped entirely, so the cost of the debugging layer
+        scales with the categories under investigation. Violations that are independent of these categories
+        (e.g. null pointer arguments or unsupported features) are always reported.
+        \see ValidationCategoryFlags
+        */
+        void SetValidationCategories(long categories);
+
+        //! Returns the bitmask of enabled validation categories.
+        inline long GetValidationCategories() const
+        {
+            return validationCategories_;
+        }
+
+        /**
+        \brief Returns true if all of the specified validation categories are enabled.
+        \see SetValidationCategories
+        */
+        inline bool IsValidationCategoryEnabled(long categories) const
+        {
+            return ((validationCategories_ & categories) == categories);
+        }
+
         /**
         \brief Posts an error message.
         \param[in] type Specifies the type of error.
@@ -76,6 +159,32 @@ class LLGL_EXPORT RenderingDebugger
         */
         void PostWarning(const WarningType type, const std::string& message);
 
+        /**
+        \brief Sets the maximum number of reports per call site and frame. By default 8.
+        \param[in] limit Specifies how many errors and warnings a single call site (see SetSource) may report within one frame.
+        Further violations from that call site are merely counted until the next frame, so a misbehaving loop
+        that emits thousands of violations per frame does not collapse the frame rate while the debugging layer is enabled.
+        If this is 0, the limit is disabled and every violation is reported.
+        \see AcquireReport
+        \see NextFrame
+        */
+        void SetReportLimit(std::size_t limit);
+
+        //! Returns the maximum number of reports per call site and frame.
+        inline std::size_t GetReportLimit() const
+        {
+            return reportLimit_;
+        }
+
+        /**
+        \brief Counts a violation for the current call site and returns true if it may still be reported this frame.
+        \remarks This is called by the debugging layer before an error or warning message is constructed,
+        so suppressed violations are counted without allocating any message strings.
+        A notice is posted once per call site and frame when its reports start being suppressed.
+        \see SetReportLimit
+        */
+        bool AcquireReport();
+
     protected:
 
         /**
@@ -183,10 +292,25 @@ class LLGL_EXPORT RenderingDebugger
 
     private:
 
-        std::map<std::string, Message>  errors_;
-        std::map<std::string, Message>  warnings_;
-        const char*                     source_     = "";
-        const char*                     groupName_  = "";
+        // Per call site counters for report throttling; keyed by the source pointer (see SetSource).
+        struct CallSiteRecord
+        {
+            std::size_t occurrences         = 0;
+            std::size_t reportedInFrame     = 0;
+            bool        throttleNotified    = false;
+        };
+
+    private:
+
+        std::map<std::string, Message>          errors_;
+        std::map<std::string, Message>          warnings_;
+        std::map<const void*, CallSiteRecord>   callSites_;
+        const char*                             source_                 = "";
+        const char*                             groupName_              = "";
+        std::uint32_t                           samplingInterval_       = 1;
+        std::uint32_t                           frameCounter_           = 0;
+        std::size_t                             reportLimit_            = 8;
+        long                                    validationCategories_   = ValidationCategoryFlags::All;
 
 };
 
@@ -12,8 +12,13 @@
 #include "Export.h"
 #include "RenderContextFlags.h"
 #include "GraphicsPipelineFlags.h"
+#include "QueryHeapFlags.h"
 #include <cstdint>
+#include <cstddef>
 #include <algorithm>
+#include <string>
+#include <vector>
+#include <ostream>
 
 
 namespace LLGL
@@ -21,13 +26,34 @@ namespace LLGL
 
 
 /**
-\brief Profile of a rendered frame.
-\see RenderingProfiler::NextFrame
+\brief GPU timing record of a debug group segment.
+\remarks Each record covers a contiguous segment of commands that were encoded while the annotated debug group was on top of the debug group stack.
+Pushing a nested debug group ends the segment of the enclosing group and popping it resumes the enclosing group with a new segment,
+so the total time of a group is the sum of all its segments and the hierarchical timeline can be reconstructed from the nesting levels in recording order.
+\see FrameProfile::timeRecords
+*/
+struct ProfileTimeRecord
+{
+    //! Debug group annotation this segment belongs to.
+    std::string     annotation;
+
+    //! Nesting level within the debug group stack, where 0 denotes an outermost debug group.
+    std::uint32_t   level       = 0;
+
+    //! Elapsed GPU time (in nanoseconds) of this segment.
+    std::uint64_t   elapsedTime = 0;
+};
+
+/**
+\brief Flat block of all per-frame counter values.
+\remarks This is a plain data block without any dynamic allocations,
+so it can be copied and reset cheaply by high-frequency samplers (e.g. a statistics overlay).
+\see RenderingProfiler::NextProfileCounters
 */
-struct FrameProfile
+struct FrameProfileCounters
 {
     //! Default constructor that initializes all counter values to zero.
-    inline FrameProfile()
+    inline FrameProfileCounters()
     {
         Clear();
     }
@@ -38,8 +64,8 @@ struct FrameProfile
         std::fill(std::begin(values), std::end(values), 0);
     }
 
-    //! Accumulates the specified profile with this profile.
-    inline void Accumulate(const FrameProfile& rhs)
+    //! Accumulates the specified counter values with these counter values.
+    inline void Accumulate(const FrameProfileCounters& rhs)
     {
         for (std::size_t i = 0; i < (sizeof(values) / sizeof(values[0])); ++i)
             values[i] += rhs.values[i];
@@ -266,6 +292,55 @@ struct FrameProfile
     };
 };
 
+/**
+\brief Profile of a rendered frame.
+\see RenderingProfiler::NextFrame
+*/
+struct FrameProfile : FrameProfileCounters
+{
+    //! Clears all counter values, the list of time records, and the pipeline statistics.
+    inline void Clear()
+    {
+        FrameProfileCounters::Clear();
+        timeRecords.clear();
+        pipelineStats = QueryPipelineStatistics{};
+    }
+
+    //! Accumulates the specified profile with this profile.
+    inline void Accumulate(const FrameProfile& rhs)
+    {
+        FrameProfileCounters::Accumulate(rhs);
+        timeRecords.insert(timeRecords.end(), rhs.timeRecords.begin(), rhs.timeRecords.end());
+        pipelineStats.inputAssemblyVertices             += rhs.pipelineStats.inputAssemblyVertices;
+        pipelineStats.inputAssemblyPrimitives           += rhs.pipelineStats.inputAssemblyPrimitives;
+        pipelineStats.vertexShaderInvocations           += rhs.pipelineStats.vertexShaderInvocations;
+        pipelineStats.geometryShaderInvocations         += rhs.pipelineStats.geometryShaderInvocations;
+        pipelineStats.geometryShaderPrimitives          += rhs.pipelineStats.geometryShaderPrimitives;
+        pipelineStats.clippingInvocations               += rhs.pipelineStats.clippingInvocations;
+        pipelineStats.clippingPrimitives                += rhs.pipelineStats.clippingPrimitives;
+        pipelineStats.fragmentShaderInvocations         += rhs.pipelineStats.fragmentShaderInvocations;
+        pipelineStats.tessControlShaderInvocations      += rhs.pipelineStats.tessControlShaderInvocations;
+        pipelineStats.tessEvaluationShaderInvocations   += rhs.pipelineStats.tessEvaluationShaderInvocations;
+        pipelineStats.computeShaderInvocations          += rhs.pipelineStats.computeShaderInvocations;
+    }
+
+    /**
+    \brief GPU timeline of the frame as list of time records in recording order.
+    \remarks This list remains empty unless time recording is enabled in the rendering profiler.
+    \see RenderingProfiler::timeRecordingEnabled
+    \see ProfileTimeRecord
+    */
+    std::vector<ProfileTimeRecord> timeRecords;
+
+    /**
+    \brief Aggregated GPU pipeline statistics of the frame, summed over all top-level debug group scopes.
+    \remarks These statistics remain zero unless pipeline-statistics recording is enabled in the rendering profiler.
+    \see RenderingProfiler::pipelineStatsRecordingEnabled
+    \see QueryPipelineStatistics
+    */
+    QueryPipelineStatistics pipelineStats;
+};
+
 /**
 \brief Rendering profiler model class.
 \remarks This can be used to profile the renderer draw calls and buffer updates.
@@ -289,14 +364,80 @@ class LLGL_EXPORT RenderingProfiler
         */
         void Accumulate(const FrameProfile& profile);
 
+        /**
+        \brief Flips the double-buffered frame counters and resets them for the next frame.
+        \return Stable pointer to the counter values of the completed frame.
+        The pointer refers to storage owned by this profiler, remains valid for the lifetime of the profiler,
+        and its content is overwritten by the next call to this function.
+        \remarks This is an allocation-free alternative to NextProfile for high-frequency samplers (e.g. a statistics overlay):
+        the counter values are copied into an internal buffer as flat data block and no dynamic allocations are performed.
+        The time records and pipeline statistics of the frame profile are cleared likewise, but not retained.
+        \see GetCompletedProfileCounters
+        \see NextProfile
+        */
+        const FrameProfileCounters* NextProfileCounters();
+
+        /**
+        \brief Returns a stable pointer to the counter values of the last completed frame.
+        \see NextProfileCounters
+        */
+        inline const FrameProfileCounters* GetCompletedProfileCounters() const
+        {
+            return &completedCounters_;
+        }
+
     public:
 
         //! Current frame profile with all counter values.
         FrameProfile frameProfile;
 
+        /**
+        \brief Specifies whether GPU timings of debug group scopes are recorded. By default false.
+        \remarks If this is true, the debugging layer encloses each segment of a debug group scope with a timer query (see QueryType::TimeElapsed)
+        and delivers the results as per-frame timeline in the frame profile.
+        The query results lag one command buffer submission behind, so resolving them may stall until the GPU has caught up.
+        \note The internal timer queries may interfere with user-defined queries of type QueryType::TimeElapsed in renderers that do not support overlapping queries (e.g. OpenGL).
+        \see CommandBuffer::PushDebugGroup
+        \see FrameProfile::timeRecords
+        */
+        bool timeRecordingEnabled = false;
+
+        /**
+        \brief Specifies whether GPU pipeline statistics of top-level debug group scopes are recorded. By default false.
+        \remarks If this is true, the debugging layer encloses each top-level debug group scope with a pipeline-statistics query (see QueryType::PipelineStatistics)
+        and accumulates the results into the frame profile.
+        The query results lag one command buffer submission behind, so resolving them may stall until the GPU has caught up.
+        Statistics the renderer does not support remain zero.
+        \see CommandBuffer::PushDebugGroup
+        \see FrameProfile::pipelineStats
+        */
+        bool pipelineStatsRecordingEnabled = false;
+
+    private:
+
+        // Counter values of the last completed frame (see NextProfileCounters)
+        FrameProfileCounters completedCounters_;
+
 };
 
 
+/* ----- Functions ----- */
+
+/**
+\brief Writes the specified sequence of frame profiles as trace event JSON to the output stream.
+\param[in] frameProfiles Pointer to the array of frame profiles, one entry for each rendered frame. This must not be null.
+\param[in] numFrameProfiles Specifies the number of entries in the \c frameProfiles array.
+\param[out] stream Specifies the output stream the JSON document is written to.
+\remarks The output uses the Chrome trace event format, so captures can be viewed with trace viewers such as \c chrome://tracing.
+The frames are laid out back-to-back on a synthetic timeline:
+GPU time records are emitted as duration events in recording order with one timeline row per nesting level,
+and all counter values are emitted as counter events at the start of their respective frame.
+\see RenderingProfiler::NextProfile
+\see FrameProfile::timeRecords
+*/
+LLGL_EXPORT void WriteProfileTraceJSON(const FrameProfile* frameProfiles, std::size_t numFrameProfiles, std::ostream& stream);
+
+
 } // /namespace LLGL
 
 
@@ -205,8 +205,64 @@ struct MiscFlags
         /**
         \brief Specifies to ignore resource data initialization.
         \remarks If this is specified, a texture or buffer resource will stay uninitialized during creation and the content is undefined.
+        \remarks This also allows the renderer to skip all staging and clearing work during resource creation,
+        which makes it the preferred flag for transient render targets and resources that are only written by the GPU.
         */
         NoInitialData   = (1 << 3),
+
+        /**
+        \brief Specifies that a buffer is persistently mapped into CPU memory space, i.e. a stable CPU pointer to its content can be retrieved.
+        \remarks This allows per-frame data to be written with plain stores instead of a map/unmap pair per update.
+        The mapping is coherent, i.e. writes are automatically made visible to the GPU without an explicit flush.
+        \note Only supported with: OpenGL (requires \c GL_ARB_buffer_storage), Vulkan.
+        \see RenderSystem::GetMappedBufferMemory
+        \see RenderSystem::FlushMappedBufferRange
+        */
+        PersistentMapped = (1 << 4),
+
+        /**
+        \brief Specifies that the resource contents are only needed temporarily within a frame, e.g. intermediate render targets of a post-processing chain.
+        \remarks Transient resources of compatible memory types may share (i.e. alias) the same device memory to reduce the overall memory footprint.
+        The application is responsible for ensuring that the lifetimes of the contents of aliasing transient resources do not overlap,
+        i.e. a transient resource must be rendered anew before its contents are read after another transient resource has been written.
+        \note Only supported with: Vulkan, Metal. Ignored by all other renderers, i.e. such resources merely have their own device memory.
+        */
+        Transient        = (1 << 5),
+
+        /**
+        \brief Specifies that a texture is created as a partially-resident (sparse) texture, i.e. without any device memory bound to it.
+        \remarks Device memory is bound to individual MIP-map levels on demand via CommandQueue::BindSparseTexture,
+        so large textures can be streamed one MIP-map level at a time instead of as whole subresources.
+        Reading from a non-resident MIP-map level returns undefined data.
+        \note Only supported with: Vulkan.
+        \see CommandQueue::BindSparseTexture
+        \see RenderingFeatures::hasSparseTextures
+        */
+        SparseResidency  = (1 << 6),
+
+        /**
+        \brief Hint to the renderer that a small buffer should be suballocated from a shared device buffer.
+        \remarks Suballocated buffers are ranges of a larger hardware buffer object, which reduces creation time,
+        bind-time driver overhead, and memory fragmentation when a scene consists of many small mesh buffers.
+        The range offsets are applied automatically when such a buffer is bound, e.g. via CommandBuffer::SetVertexBuffer.
+        This is only a hint and may be ignored, e.g. for large buffers or for buffers that require CPU access.
+        \note Only supported with: Vulkan. Ignored by all other renderers.
+        \see CommandBuffer::SetVertexBuffer
+        \see CommandBuffer::SetIndexBuffer
+        */
+        Suballocated     = (1 << 7),
+
+        /**
+        \brief Specifies that the initial image data of a texture is uploaded asynchronously.
+        \remarks The texture object is returned immediately and the upload of the initial image data rides the transfer queue,
+        instead of blocking RenderSystem::CreateTexture until the staging copies have completed.
+        Use RenderSystem::IsTextureUploadComplete to poll and RenderSystem::WaitForTextureUpload to wait for readiness;
+        sampling the texture before the upload has completed returns undefined data.
+        \note Only supported with: Vulkan. All other renderers upload synchronously, i.e. such textures are ready immediately.
+        \see RenderSystem::IsTextureUploadComplete
+        \see RenderSystem::WaitForTextureUpload
+        */
+        DeferredUpload   = (1 << 8),
     };
 };
 
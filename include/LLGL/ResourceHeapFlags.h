@@ -24,6 +24,30 @@ namespace LLGL
 class PipelineLayout;
 
 
+/* ----- Flags ----- */
+
+/**
+\brief Resource heap flags enumeration.
+\see ResourceHeapDescriptor::flags
+*/
+struct ResourceHeapFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that the texture resources of this heap are accessed as bindless texture handles.
+        \remarks The handles of all sampled textures are made resident when the heap is created
+        and written into an internal buffer that is bound at the binding slot of the heap's first texture binding.
+        Binding the heap then amounts to a single buffer bind and the shader reads the handles from that buffer,
+        e.g. with <code>layout(std430) buffer</code> and \c sampler2D handles in GLSL.
+        The sampler state of each texture is baked into its handle, so separate sampler bindings are ignored for these textures.
+        \note Only supported with: OpenGL (requires \c GL_ARB_bindless_texture).
+        */
+        BindlessTextures = (1 << 0),
+    };
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -97,6 +121,12 @@ struct ResourceHeapDescriptor
     \see PipelineLayoutDescriptor::bindings
     */
     std::vector<ResourceViewDescriptor> resourceViews;
+
+    /**
+    \brief Specifies optional resource heap flags. By default 0.
+    \see ResourceHeapFlags
+    */
+    long                                flags           = 0;
 };
 
 
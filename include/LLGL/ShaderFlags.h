@@ -13,6 +13,7 @@
 #include "VertexAttribute.h"
 #include "FragmentAttribute.h"
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 
 
@@ -35,6 +36,8 @@ enum class ShaderType
     Geometry,       //!< Geometry shader type.
     Fragment,       //!< Fragment shader type (also "Pixel Shader").
     Compute,        //!< Compute shader type.
+    Task,           //!< Task shader type (also "Amplification Shader"). \note Only supported with: Vulkan.
+    Mesh,           //!< Mesh shader type. Replaces the vertex input stages of the graphics pipeline. \note Only supported with: Vulkan.
 };
 
 /**
@@ -44,7 +47,7 @@ enum class ShaderType
 */
 enum class ShaderSourceType
 {
-    CodeString,     //!< Refers to <code>sourceSize+1</code> bytes, describing shader high-level code (including null terminator).
+    CodeString,     //!< Refers to <code>sourceSize+1</code> bytes, describing shader high-level code (including null terminator). If \c sourceSize is non-zero, no null terminator is required.
     CodeFile,       //!< Refers to <code>sourceSize+1</code> bytes, describing the filename of the shader high-level code (including null terminator).
     BinaryBuffer,   //!< Refers to <code>sourceSize</code> bytes, describing shader binary code.
     BinaryFile,     //!< Refers to <code>sourceSize+1</code> bytes, describing the filename of the shader binary code (including null terminator).
@@ -96,11 +99,17 @@ struct StageFlags
         //! Specifies the compute shader stage.
         ComputeStage        = (1 << 5),
 
+        //! Specifies the task shader stage (also referred to as "Amplification Shader"). \note Only supported with: Vulkan.
+        TaskStage           = (1 << 6),
+
+        //! Specifies the mesh shader stage. \note Only supported with: Vulkan.
+        MeshStage           = (1 << 7),
+
         //! Specifies all tessellation stages, i.e. tessellation-control-, tessellation-evaluation shader stages.
         AllTessStages       = (TessControlStage | TessEvaluationStage),
 
-        //! Specifies all graphics pipeline shader stages, i.e. vertex-, tessellation-, geometry-, and fragment shader stages.
-        AllGraphicsStages   = (VertexStage | AllTessStages | GeometryStage | FragmentStage),
+        //! Specifies all graphics pipeline shader stages, i.e. vertex-, tessellation-, geometry-, task-, mesh-, and fragment shader stages.
+        AllGraphicsStages   = (VertexStage | AllTessStages | GeometryStage | TaskStage | MeshStage | FragmentStage),
 
         //! Specifies all shader stages.
         AllStages           = (AllGraphicsStages | ComputeStage),
@@ -134,6 +143,46 @@ struct ShaderMacro
     const char* definition  = nullptr;
 };
 
+/**
+\brief Shader specialization constant structure.
+\remarks Specialization constants allow a single shader module to serve multiple pipeline permutations
+by fixing the value of a constant at pipeline compilation time rather than at shader authoring time.
+\see ShaderDescriptor::specializations
+*/
+struct ShaderSpecialization
+{
+    ShaderSpecialization() = default;
+    ShaderSpecialization(const ShaderSpecialization&) = default;
+    ShaderSpecialization& operator = (const ShaderSpecialization&) = default;
+
+    //! Constructor to initialize the specialization constant with an identifier, a name, and a value.
+    inline ShaderSpecialization(std::uint32_t id, const char* name, std::uint32_t value) :
+        id    { id    },
+        name  { name  },
+        value { value }
+    {
+    }
+
+    /**
+    \brief Specifies the specialization constant identifier, i.e. the \c constant_id layout qualifier in SPIR-V shaders.
+    \remarks This is only used for SPIR-V shader modules and is ignored for high-level source compilers.
+    */
+    std::uint32_t   id      = 0;
+
+    /**
+    \brief Specifies the name of the specialization constant. This must not be null.
+    \remarks Shader compilers that have no native notion of specialization constants (e.g. HLSL and GLSL source compilers)
+    map each specialization constant to a macro definition of this name instead.
+    */
+    const char*     name    = nullptr;
+
+    /**
+    \brief Specifies the raw 32-bit value of the specialization constant. By default 0.
+    \remarks For floating-point or boolean constants, the value must be provided as bit pattern of the respective type.
+    */
+    std::uint32_t   value   = 0;
+};
+
 /**
 \brief Vertex (or geometry) shader specific structure.
 \see ShaderDescriptor::vertex
@@ -226,7 +275,8 @@ struct ShaderDescriptor
     \brief Specifies the type of the shader source. By default ShaderSourceType::CodeFile.
     \remarks With the filename source types (i.e. ShaderSourceType::CodeFile and ShaderSourceType::BinaryFile),
     the shader source or binary code will be loaded from file using the standard C++ file streams (i.e. std::ifstream).
-    Only the binary buffer source type (i.e. ShaderSourceType::BinaryBuffer) does not require a null terminator for the 'source' pointer.
+    Only the binary buffer source type (i.e. ShaderSourceType::BinaryBuffer) and the code string source type with a non-zero 'sourceSize'
+    (i.e. ShaderSourceType::CodeString) do not require a null terminator for the 'source' pointer.
     \see ShaderSourceType
     \see source
     */
@@ -267,6 +317,27 @@ struct ShaderDescriptor
     */
     const ShaderMacro*          defines         = nullptr;
 
+    /**
+    \brief Optional array of specialization constants. By default null.
+    \remarks This must either be null or an array of ShaderSpecialization entries that is terminated with an entry whose \c name is null.
+    For SPIR-V shader modules, the constants are applied at pipeline compilation time (i.e. via \c VkSpecializationInfo or \c glSpecializeShader),
+    so a single shader module can serve many pipeline permutations without recompiling the shader source.
+    For high-level source compilers (i.e. HLSL and GLSL), each constant is injected as a macro definition before compilation.
+    \remarks Here is a brief example how to use:
+    \code
+    const LLGL::ShaderSpecialization mySpecializations[] = {
+        { 0, "NUM_LIGHTS",   4u }, // layout(constant_id = 0) in SPIR-V
+        { 1, "ENABLE_FOG",   1u }, // layout(constant_id = 1) in SPIR-V
+        { 0, nullptr,        0u }, // terminate array
+    };
+    LLGL::ShaderDescriptor myShaderDesc;
+    myShaderDesc.specializations = mySpecializations;
+    \endcode
+    \note Only supported with: Vulkan, HLSL, GLSL, SPIR-V.
+    \see ShaderSpecialization
+    */
+    const ShaderSpecialization* specializations = nullptr;
+
     /**
     \brief Optional compilation flags. By default 0.
     \remarks This can be a bitwise OR combination of the ShaderCompileFlags enumeration entries.
@@ -139,6 +139,26 @@ struct ShaderProgramDescriptor
     \remarks This shader cannot be used in conjunction with any other shaders.
     */
     Shader*                     computeShader           = nullptr;
+
+    /**
+    \brief Specifies an optional task shader (also referred to as "Amplification Shader").
+    \remarks This shader can only be used in conjunction with a mesh shader.
+    \note Only supported with: Vulkan.
+    \see meshShader
+    */
+    Shader*                     taskShader              = nullptr;
+
+    /**
+    \brief Specifies the mesh shader.
+    \remarks This shader replaces the vertex input stages of the graphics pipeline,
+    i.e. it cannot be used in conjunction with a vertex, tessellation, or geometry shader
+    and the vertex input layout (see VertexFormat) is bypassed.
+    The mesh shader fetches its geometry data from resources such as storage buffers instead.
+    \note Only supported with: Vulkan.
+    \see CommandBuffer::DrawMeshTasks
+    \see RenderingFeatures::hasMeshShaders
+    */
+    Shader*                     meshShader              = nullptr;
 };
 
 /**
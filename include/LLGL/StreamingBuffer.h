@@ -0,0 +1,161 @@
+/*
+ * StreamingBuffer.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_STREAMING_BUFFER_H
+#define LLGL_STREAMING_BUFFER_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include "VertexFormat.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Helper class for streaming per-instance vertex data to the GPU with a fence-guarded ring buffer.
+\remarks This class wraps a single vertex buffer that is split into a fixed number of segments.
+Each frame writes its instance data into one segment while the GPU may still read from the segments of the previous frames;
+a fence per segment guarantees that a segment is never overwritten before the GPU has finished reading from it.
+If the renderer supports persistently mapped buffers (see MiscFlags::PersistentMapped),
+writing instance data is a single \c memcpy into GPU-visible memory without any further allocations or copies.
+Otherwise, the data is staged in an intermediate CPU buffer and uploaded when \c Flush is called.
+\code
+// Initialization:
+LLGL::StreamingBuffer myInstanceStream { *myRenderSystem, myInstanceFormat, 4096 };
+
+// Every frame:
+std::uint32_t firstInstance = 0;
+auto data = myInstanceStream.Allocate(numInstances, firstInstance);
+::memcpy(data, myInstanceData, numInstances * myInstanceStream.GetStride());
+myInstanceStream.Flush();
+
+myCmdBuffer->SetVertexBuffer(*myInstanceStream.GetBuffer());
+myCmdBuffer->DrawInstanced(numVertices, 0, numInstances, firstInstance);
+
+// After the command buffer has been submitted:
+myCmdQueue->Submit(*myCmdBuffer);
+myInstanceStream.NextSegment(*myCmdQueue);
+\endcode
+\note Addressing the streamed data via the \c firstInstance output parameter requires support for
+offset instancing (see RenderingFeatures::hasOffsetInstancing).
+\see MiscFlags::PersistentMapped
+\see RenderSystem::GetMappedBufferMemory
+*/
+class LLGL_EXPORT StreamingBuffer : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Creates the internal vertex buffer and one fence per segment.
+        \param[in] renderSystem Specifies the render system the buffer and fences are created with.
+        \param[in] vertexFormat Specifies the vertex format of the per-instance data. The vertex stride of this format must not be zero.
+        \param[in] numInstancesPerSegment Specifies the maximum number of instances that can be allocated between two calls to \c NextSegment. This must not be zero.
+        \param[in] numSegments Specifies the number of ring buffer segments,
+        which should be at least the number of frames that can be in flight. This must not be zero. By default 3.
+        \throws std::invalid_argument If the vertex stride of \c vertexFormat is zero, or \c numInstancesPerSegment is zero, or \c numSegments is zero.
+        */
+        StreamingBuffer(
+            RenderSystem&       renderSystem,
+            const VertexFormat& vertexFormat,
+            std::uint32_t       numInstancesPerSegment,
+            std::uint32_t       numSegments             = 3
+        );
+
+        //! Releases the internal vertex buffer and fences.
+        ~StreamingBuffer();
+
+        /**
+        \brief Allocates space for the specified number of instances from the current segment.
+        \param[in] numInstances Specifies the number of instances to allocate.
+        \param[out] firstInstance Specifies the output parameter for the instance offset of the allocation within the buffer.
+        Pass this value as \c firstInstance parameter to one of the instanced draw commands.
+        \return Write pointer for the instance data of the allocation. The caller must write <code>numInstances * GetStride()</code> bytes at most.
+        \throws std::invalid_argument If \c numInstances is larger than the segment capacity.
+        \throws std::runtime_error If the current segment does not have enough space left for the allocation.
+        \see CommandBuffer::DrawInstanced
+        */
+        void* Allocate(std::uint32_t numInstances, std::uint32_t& firstInstance);
+
+        /**
+        \brief Makes all allocations since the last call to \c Flush visible to the GPU.
+        \remarks Call this after the instance data has been written and before the command buffer that reads it is submitted.
+        If the buffer is persistently mapped, this is nearly free; otherwise, the pending range is uploaded with a copy.
+        \see RenderSystem::FlushMappedBufferRange
+        */
+        void Flush();
+
+        /**
+        \brief Advances the ring to the next segment.
+        \param[in] commandQueue Specifies the command queue the per-segment fences are submitted to.
+        \remarks Call this once per frame after all command buffers that read from the current segment have been submitted.
+        This signals the fence of the current segment and blocks until the GPU has finished reading from the next segment,
+        which only happens when the GPU is more than <code>numSegments - 1</code> frames behind.
+        \see CommandQueue::Submit(Fence&)
+        */
+        void NextSegment(CommandQueue& commandQueue);
+
+        //! Returns the internal vertex buffer to bind for the instanced draw commands.
+        inline Buffer* GetBuffer() const
+        {
+            return buffer_;
+        }
+
+        //! Returns the vertex stride (in bytes) of the per-instance data.
+        inline std::uint32_t GetStride() const
+        {
+            return stride_;
+        }
+
+        //! Returns the maximum number of instances per segment.
+        inline std::uint32_t GetNumInstancesPerSegment() const
+        {
+            return numInstancesPerSegment_;
+        }
+
+        //! Returns the number of ring buffer segments.
+        inline std::uint32_t GetNumSegments() const
+        {
+            return numSegments_;
+        }
+
+    private:
+
+        RenderSystem&       renderSystem_;
+
+        Buffer*             buffer_                 = nullptr;
+        std::vector<Fence*> fences_;
+        std::vector<bool>   fencesSubmitted_;
+
+        char*               mappedMemory_           = nullptr;  // Non-null if the buffer is persistently mapped
+        std::vector<char>   intermediateData_;                  // Staging memory if persistent mapping is not supported
+
+        std::uint32_t       stride_                 = 0;
+        std::uint32_t       numInstancesPerSegment_ = 0;
+        std::uint32_t       numSegments_            = 0;
+
+        std::uint32_t       segmentIndex_           = 0;
+        std::uint32_t       numInstancesUsed_       = 0;
+        std::uint32_t       numInstancesFlushed_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
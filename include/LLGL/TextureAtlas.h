@@ -0,0 +1,177 @@
+/*
+ * TextureAtlas.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TEXTURE_ATLAS_H
+#define LLGL_TEXTURE_ATLAS_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include "Types.h"
+#include "ImageFlags.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Input entry for a texture atlas: sub-image extent and image data.
+\see TextureAtlas
+*/
+struct TextureAtlasEntryDescriptor
+{
+    TextureAtlasEntryDescriptor() = default;
+    TextureAtlasEntryDescriptor(const TextureAtlasEntryDescriptor&) = default;
+
+    //! Constructor to initialize all attributes.
+    inline TextureAtlasEntryDescriptor(const Extent2D& extent, const SrcImageDescriptor& imageDesc) :
+        extent    { extent    },
+        imageDesc { imageDesc }
+    {
+    }
+
+    //! Specifies the extent (in texels) of the sub-image. Both components must be greater than zero.
+    Extent2D            extent;
+
+    //! Specifies the image data of the sub-image. Its \c data member must not be null!
+    SrcImageDescriptor  imageDesc;
+};
+
+/**
+\brief Output entry of a texture atlas: array layer, texel region, and normalized texture coordinates of a packed sub-image.
+\see TextureAtlas::GetEntries
+*/
+struct TextureAtlasEntry
+{
+    //! Array layer the sub-image was packed into.
+    std::uint32_t   arrayLayer  = 0;
+
+    //! Texel offset of the sub-image within its array layer.
+    Offset2D        offset;
+
+    //! Texel extent of the sub-image; same as the extent of the respective input entry.
+    Extent2D        extent;
+
+    //! Normalized texture coordinates of the upper-left corner of the sub-image.
+    float           u0          = 0.0f;
+    float           v0          = 0.0f;
+
+    //! Normalized texture coordinates of the lower-right corner of the sub-image.
+    float           u1          = 1.0f;
+    float           v1          = 1.0f;
+};
+
+/**
+\brief Helper class that packs a set of sub-images into a single 2D array texture for draw batching.
+\remarks This class creates one TextureType::Texture2DArray resource and packs all input entries into it:
+if all entries share the same extent, each entry occupies its own array layer,
+otherwise the entries are packed shelf-wise into as few fixed-size layers as necessary.
+The resulting table of array layers and normalized texture coordinates can be fed to the shaders
+(e.g. through a per-instance vertex stream or a storage buffer),
+so draw calls that previously differed only in their bound texture can be merged into
+instanced or multi-draw commands without any texture re-binding in between.
+All image data is uploaded in a single batched staging pass.
+\code
+// Initialization:
+LLGL::TextureAtlas myAtlas { *myRenderSystem, myEntries.data(), myEntries.size() };
+
+// Fetch array layer and UV rectangle for each packed sub-image:
+const auto& entry = myAtlas.GetEntries()[i];
+
+// Bind the atlas once for all batched draws:
+myCmdBuffer->SetResource(myAtlas.GetTexture(), 0, LLGL::BindFlags::Sampled, LLGL::StageFlags::FragmentStage);
+\endcode
+\note The texture is created without MIP-maps,
+because filtered MIP-map levels of packed layers would bleed across neighboring sub-images.
+\see RenderSystem::WriteTextureMulti
+\see CommandBuffer::DrawMulti
+*/
+class LLGL_EXPORT TextureAtlas : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Packs the specified entries, creates the array texture, and uploads all sub-images in one batched staging pass.
+        \param[in] renderSystem Specifies the render system the texture is created with.
+        \param[in] entries Pointer to the array of input entries. This must not be null.
+        \param[in] numEntries Specifies the number of input entries. This must not be zero.
+        \param[in] format Specifies the hardware format of the texture. This must not be a compressed format. By default Format::RGBA8UNorm.
+        \param[in] maxLayerExtent Specifies the maximum extent of a single array layer.
+        Each entry must fit into this extent. By default (2048, 2048).
+        \remarks If all entries share the same extent, each entry occupies its own array layer of exactly that extent.
+        Otherwise the entries are sorted by height and packed shelf-wise,
+        and the layer extent is shrunk to the bounding rectangle of the packed sub-images.
+        The order of the output entries always matches the order of the input entries.
+        \throws std::invalid_argument If \c entries is null, or \c numEntries is zero,
+        or \c format is a compressed format, or any entry has a zero extent or does not fit into \c maxLayerExtent.
+        */
+        TextureAtlas(
+            RenderSystem&                       renderSystem,
+            const TextureAtlasEntryDescriptor*  entries,
+            std::size_t                         numEntries,
+            const Format                        format          = Format::RGBA8UNorm,
+            const Extent2D&                     maxLayerExtent  = Extent2D { 2048, 2048 }
+        );
+
+        //! Releases the texture.
+        ~TextureAtlas();
+
+        //! Returns the array texture all sub-images were packed into.
+        inline Texture& GetTexture() const
+        {
+            return *texture_;
+        }
+
+        //! Returns the table of output entries; one entry per input entry and in the same order.
+        inline const std::vector<TextureAtlasEntry>& GetEntries() const
+        {
+            return entries_;
+        }
+
+        //! Returns the extent of a single array layer of the texture.
+        inline const Extent2D& GetLayerExtent() const
+        {
+            return layerExtent_;
+        }
+
+        //! Returns the number of array layers of the texture.
+        inline std::uint32_t GetNumArrayLayers() const
+        {
+            return numArrayLayers_;
+        }
+
+    private:
+
+        void PackEntriesIntoLayers(const TextureAtlasEntryDescriptor* entries, std::size_t numEntries);
+        void PackEntriesShelfWise(const TextureAtlasEntryDescriptor* entries, std::size_t numEntries, const Extent2D& maxLayerExtent);
+
+    private:
+
+        RenderSystem&                   renderSystem_;
+
+        Texture*                        texture_        = nullptr;
+        std::vector<TextureAtlasEntry>  entries_;
+
+        Extent2D                        layerExtent_;
+        std::uint32_t                   numArrayLayers_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -285,6 +285,20 @@ struct TextureDescriptor
     */
     std::uint32_t   mipLevels       = 0;
 
+    /**
+    \brief Number of smallest MIP-map levels that are initially made resident for sparse textures. By default 0.
+    \remarks This is only used for textures created with the MiscFlags::SparseResidency flag;
+    all other textures always have their entire MIP-map chain resident.
+    If this is 0, a sparse texture is created entirely non-resident.
+    This allows a streaming system to allocate only the MIP tail up front and make more detailed levels
+    resident later via CommandQueue::BindSparseTexture and RenderSystem::WriteTexture,
+    without ever recreating the texture object.
+    \see MiscFlags::SparseResidency
+    \see CommandQueue::BindSparseTexture
+    \see RenderSystem::SetTextureMinLod
+    */
+    std::uint32_t   sparseResidentMipLevels = 0;
+
     /**
     \brief Number of samples per texel. By default 1.
     \remarks This is only used for multi-sampled textures (i.e. TextureType::Texture2DMS and TextureType::Texture2DMSArray).
@@ -390,7 +404,7 @@ LLGL_EXPORT std::uint32_t NumMipLevels(const TextureDescriptor& textureDesc);
 \brief Returns the required buffer size (in bytes) of a texture with the specified hardware format and number of texels.
 \param[in] format Specifies the texture format.
 \param[in] numTexels Specifies the number of texture elements (texels).
-For the DXT compressed texture formats, this must be a multiple of 16, since these formats compress the image in 4x4 texel blocks.
+For the block compressed texture formats, this is rounded up to the next multiple of the block size (e.g. 16 for the 4x4 texel blocks of the DXT formats).
 \return The required buffer size (in bytes), or zero if the input is invalid.
 \remarks The counterpart for image data is the function ImageDataSize.
 \see ImageDataSize
@@ -0,0 +1,102 @@
+/*
+ * TextureReadback.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_TEXTURE_READBACK_H
+#define LLGL_TEXTURE_READBACK_H
+
+
+#include "RenderSystemChild.h"
+#include <cstdint>
+#include <functional>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Texture readback interface for asynchronous GPU-to-CPU texture transfers.
+\remarks In contrast to RenderSystem::ReadTexture, a readback does not stall the pipeline:
+the texture data is copied into an internal buffer and completion can be polled while the GPU keeps working.
+\see RenderSystem::ReadTextureAsync
+*/
+class LLGL_EXPORT TextureReadback : public RenderSystemChild
+{
+
+        LLGL_DECLARE_INTERFACE( InterfaceID::TextureReadback );
+
+    public:
+
+        /**
+        \brief Polls whether the GPU has finished copying the texture data. This is a non-blocking operation.
+        \return True if the data can be mapped without stalling.
+        \see Map
+        */
+        virtual bool IsComplete() = 0;
+
+        /**
+        \brief Maps the read texture data into CPU memory space.
+        \return Raw pointer to the texture data, or null if the mapping failed.
+        \remarks If the copy operation has not completed yet, this blocks until it has; use IsComplete to avoid the stall.
+        \see Unmap
+        */
+        virtual const void* Map() = 0;
+
+        /**
+        \brief Unmaps the texture data previously mapped into CPU memory space.
+        \see Map
+        */
+        virtual void Unmap() = 0;
+
+        //! Returns the size (in bytes) of the texture data.
+        virtual std::uint64_t GetDataSize() const = 0;
+
+        /**
+        \brief Sets the callback that is invoked once the GPU has finished copying the texture data.
+        \param[in] callback Specifies the new completion callback. This can also be null to remove a previously set callback.
+        \remarks The callback is invoked at most once, from within RenderSystem::ProcessReadbacks,
+        i.e. on the thread that calls said function and never concurrently with the application.
+        This is an alternative to polling the readback manually with IsComplete.
+        \see RenderSystem::ProcessReadbacks
+        \see IsComplete
+        */
+        inline void SetCompletedCallback(const std::function<void(TextureReadback&)>& callback)
+        {
+            completedCallback_          = callback;
+            completedCallbackInvoked_   = false;
+        }
+
+        /**
+        \brief Invokes the completion callback if the readback has completed and the callback has not been invoked yet.
+        \remarks This is called by RenderSystem::ProcessReadbacks and does not need to be called manually.
+        \see SetCompletedCallback
+        */
+        inline void ProcessCompletedCallback()
+        {
+            if (completedCallback_ && !completedCallbackInvoked_ && IsComplete())
+            {
+                completedCallbackInvoked_ = true;
+                completedCallback_(*this);
+            }
+        }
+
+    private:
+
+        std::function<void(TextureReadback&)>   completedCallback_;
+        bool                                    completedCallbackInvoked_   = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -10,6 +10,7 @@
 
 
 #include "Interface.h"
+#include <chrono>
 #include <memory>
 #include <cstdint>
 
@@ -65,9 +66,57 @@ class LLGL_EXPORT Timer : public Interface
             return deltaTime_;
         }
 
+        /**
+        \brief Sets the target frame interval (in seconds) for frame pacing. By default 0.
+        \param[in] interval Specifies the interval between the beginning of two frames, e.g. \c 1.0/120.0 for 120 Hz.
+        If this is 0, frame pacing is disabled.
+        \see PaceFrame
+        */
+        void SetFrameInterval(double interval);
+
+        //! Returns the target frame interval (in seconds) for frame pacing.
+        inline double GetFrameInterval() const
+        {
+            return frameInterval_;
+        }
+
+        /**
+        \brief Waits until the beginning of the next frame interval.
+        \remarks This must be called once every frame, like MeasureTime.
+        The wait is a hybrid of sleeping and spinning: the thread sleeps while more than the scheduler granularity
+        of the host system remains, and spins for the rest to avoid the wake-up jitter of a plain sleep.
+        If the previous frame took longer than the target interval, this function returns immediately
+        and the schedule is restarted at the current time.
+        \see SetFrameInterval
+        \see GetWakeUpError
+        */
+        void PaceFrame();
+
+        /**
+        \brief Returns the measured wake-up error (in seconds) of the previous PaceFrame call.
+        \remarks This is the duration the wait returned past its target time, and can be used to monitor pacing quality.
+        \see PaceFrame
+        */
+        inline double GetWakeUpError() const
+        {
+            return wakeUpError_;
+        }
+
+    protected:
+
+        /**
+        \brief Called when frame pacing is enabled or disabled.
+        \remarks Platform implementations can increase the scheduler granularity here (e.g. \c timeBeginPeriod on Win32).
+        \see SetFrameInterval
+        */
+        virtual void OnFramePacingChanged(bool enabled);
+
     private:
 
-        double deltaTime_ = 0.0;
+        double                                  deltaTime_      = 0.0;
+        double                                  frameInterval_  = 0.0;
+        double                                  wakeUpError_    = 0.0;
+        std::chrono::steady_clock::time_point   nextFrameTime_;
 
 };
 
@@ -0,0 +1,204 @@
+/*
+ * UploadScheduler.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_UPLOAD_SCHEDULER_H
+#define LLGL_UPLOAD_SCHEDULER_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "ForwardDecls.h"
+#include "TextureFlags.h"
+#include "ImageFlags.h"
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Helper class that schedules prioritized resource uploads against a per-frame byte budget.
+\remarks This class queues buffer and texture uploads as jobs, copies their source data into an internal shadow copy
+(so the caller's pointers only need to remain valid for the duration of the enqueue call),
+and spreads the uploads over multiple frames: each call to ProcessFrame writes as many pending jobs
+as fit into the byte budget in descending priority order and fences the batch,
+so streaming large assets no longer stalls a single frame.
+Completion of a job can be polled with IsCompleted, e.g. to switch a material to a newly streamed MIP level.
+\code
+LLGL::UploadScheduler myStreamer { *myRenderSystem, 8 * 1024 * 1024 };
+
+// Asset loader: enqueue the MIP levels with the most important ones first
+auto jobID = myStreamer.EnqueueTextureUpload(*myTexture, mipRegion, imageDesc, mipPriority);
+
+// Every frame:
+myStreamer.ProcessFrame(*myCmdQueue);
+
+if (myStreamer.IsCompleted(jobID))
+{
+    // use the streamed MIP level ...
+}
+\endcode
+\see RenderSystem::WriteBuffer
+\see RenderSystem::WriteTexture
+*/
+class LLGL_EXPORT UploadScheduler : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Constructs the upload scheduler with the specified per-frame byte budget.
+        \param[in] renderSystem Specifies the render system the uploads and fences are performed with.
+        \param[in] budgetPerFrame Specifies the maximal number of bytes that ProcessFrame uploads per call.
+        This must not be zero. A single job that is larger than the budget is still uploaded in one piece
+        (as the only job of its frame), so oversized jobs cannot starve.
+        \throws std::invalid_argument If \c budgetPerFrame is zero.
+        */
+        UploadScheduler(RenderSystem& renderSystem, std::uint64_t budgetPerFrame);
+
+        /**
+        \brief Releases the internal fences.
+        \remarks Call Finish before the scheduler is destroyed while jobs are still in flight.
+        \see Finish
+        */
+        ~UploadScheduler();
+
+        /**
+        \brief Enqueues an upload into the specified destination buffer.
+        \param[in] dstBuffer Specifies the destination buffer.
+        \param[in] dstOffset Specifies the destination offset (in bytes) within the buffer.
+        \param[in] data Pointer to the source data. This must not be null. The data is copied into an internal
+        shadow copy, so the pointer does not need to remain valid after this call.
+        \param[in] dataSize Specifies the size (in bytes) of the source data. This must not be zero.
+        \param[in] priority Specifies the job priority. Jobs with a higher priority are uploaded first. By default 0.
+        \return Identifier of the enqueued job that can be passed to IsCompleted.
+        \throws std::invalid_argument If \c data is null or \c dataSize is zero.
+        \see IsCompleted
+        */
+        std::uint64_t EnqueueBufferUpload(
+            Buffer&         dstBuffer,
+            std::uint64_t   dstOffset,
+            const void*     data,
+            std::uint64_t   dataSize,
+            std::uint32_t   priority = 0
+        );
+
+        /**
+        \brief Enqueues an upload into the specified region of the destination texture.
+        \param[in] dstTexture Specifies the destination texture.
+        \param[in] textureRegion Specifies the destination region, i.e. MIP-map level, array layer, offset, and extent.
+        \param[in] imageDesc Specifies the source image data. The \c data member must not be null and the
+        \c dataSize member must not be zero. The image data is copied into an internal shadow copy.
+        \param[in] priority Specifies the job priority. Jobs with a higher priority are uploaded first. By default 0.
+        \return Identifier of the enqueued job that can be passed to IsCompleted.
+        \throws std::invalid_argument If the image data is null or its size is zero.
+        \see IsCompleted
+        */
+        std::uint64_t EnqueueTextureUpload(
+            Texture&                    dstTexture,
+            const TextureRegion&        textureRegion,
+            const SrcImageDescriptor&   imageDesc,
+            std::uint32_t               priority = 0
+        );
+
+        /**
+        \brief Uploads pending jobs within the byte budget and retires completed upload batches.
+        \param[in] commandQueue Specifies the command queue the upload fences are submitted to.
+        \remarks Pending jobs are uploaded in descending priority order (jobs of equal priority keep their
+        enqueue order) until the per-frame byte budget is exhausted, and the batch is guarded with a fence.
+        Previously submitted batches whose fences have been signaled are retired first,
+        which is when their jobs are reported as completed by IsCompleted.
+        \see IsCompleted
+        */
+        void ProcessFrame(CommandQueue& commandQueue);
+
+        /**
+        \brief Uploads all pending jobs regardless of the byte budget and blocks until all uploads have completed.
+        \param[in] commandQueue Specifies the command queue the upload fences are submitted to.
+        \remarks After this call, IsCompleted returns true for all previously enqueued jobs.
+        */
+        void Finish(CommandQueue& commandQueue);
+
+        /**
+        \brief Returns true if the upload job with the specified identifier has completed.
+        \param[in] jobID Specifies the job identifier that was returned by one of the enqueue functions.
+        \remarks Completions are observed when ProcessFrame or Finish is called,
+        i.e. this function does not query the GPU itself.
+        \see ProcessFrame
+        */
+        bool IsCompleted(std::uint64_t jobID) const;
+
+        //! Returns the per-frame byte budget that was specified at creation time.
+        inline std::uint64_t GetBudgetPerFrame() const
+        {
+            return budgetPerFrame_;
+        }
+
+        //! Returns the number of jobs that have not been uploaded yet.
+        inline std::size_t GetNumPendingJobs() const
+        {
+            return pendingJobs_.size();
+        }
+
+        //! Returns the total size (in bytes) of all jobs that have not been uploaded yet.
+        inline std::uint64_t GetNumPendingBytes() const
+        {
+            return pendingBytes_;
+        }
+
+    private:
+
+        // Pending upload job with a shadow copy of its source data
+        struct UploadJob
+        {
+            std::uint64_t       id          = 0;
+            std::uint32_t       priority    = 0;
+            Buffer*             dstBuffer   = nullptr;  // destination buffer (mutually exclusive with dstTexture)
+            std::uint64_t       dstOffset   = 0;
+            Texture*            dstTexture  = nullptr;  // destination texture (mutually exclusive with dstBuffer)
+            TextureRegion       textureRegion;
+            SrcImageDescriptor  imageDesc;              // data member is re-pointed to the shadow copy at upload time
+            std::vector<char>   data;
+        };
+
+        // Batch of jobs that was uploaded within one frame and is guarded by a fence
+        struct UploadBatch
+        {
+            Fence*                      fence = nullptr;
+            std::vector<std::uint64_t>  jobIDs;
+        };
+
+    private:
+
+        void UploadJobData(const UploadJob& job);
+        void SubmitBatch(CommandQueue& commandQueue, std::vector<std::uint64_t>&& jobIDs);
+        void RetireSignaledBatches(CommandQueue& commandQueue);
+
+    private:
+
+        RenderSystem&               renderSystem_;
+        std::uint64_t               budgetPerFrame_ = 0;
+        std::uint64_t               nextJobID_      = 1;
+        std::uint64_t               pendingBytes_   = 0;
+
+        std::vector<UploadJob>      pendingJobs_;
+        std::vector<UploadBatch>    batchesInFlight_;
+        std::vector<Fence*>         freeFences_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
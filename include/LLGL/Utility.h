@@ -131,6 +131,18 @@ LLGL_EXPORT BufferDescriptor StorageBufferDesc(uint64_t size, const StorageBuffe
 */
 LLGL_EXPORT ShaderDescriptor ShaderDescFromFile(const ShaderType type, const char* filename, const char* entryPoint = nullptr, const char* profile = nullptr, long flags = 0);
 
+/**
+\brief Returns a ShaderDescriptor structure whose source refers to the contents of the specified memory mapped file.
+\remarks In contrast to ShaderDescFromFile, the file contents are fed into the shader compiler directly out of the file mapping,
+i.e. without reading the file into an intermediate buffer first.
+The mapped file must remain open until the shader has been created.
+The source type is determined by the filename extension the mapped file was opened with, using the same rules as ShaderDescFromFile,
+except that the code and binary file types result into ShaderSourceType::CodeString and ShaderSourceType::BinaryBuffer respectively.
+\see MappedFile::Open
+\see RenderSystem::CreateShader
+*/
+LLGL_EXPORT ShaderDescriptor ShaderDescFromMappedFile(const ShaderType type, const MappedFile& mappedFile, const char* entryPoint = nullptr, const char* profile = nullptr, long flags = 0);
+
 /* ----- ShaderProgramDescriptor utility functions ----- */
 
 /**
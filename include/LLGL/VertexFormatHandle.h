@@ -0,0 +1,84 @@
+/*
+ * VertexFormatHandle.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VERTEX_FORMAT_HANDLE_H
+#define LLGL_VERTEX_FORMAT_HANDLE_H
+
+
+#include "Export.h"
+#include "NonCopyable.h"
+#include "VertexFormat.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Immutable, pre-validated vertex format that can be shared across many buffer creations.
+\remarks When many vertex buffers share a small set of vertex formats,
+passing the attribute list through BufferDescriptor::vertexAttribs validates and copies the attributes for every single buffer.
+This class performs the validation once at construction and can then be referenced by any number of buffer descriptors:
+\code
+// Initialization:
+LLGL::VertexFormatHandle myInstanceFormatHandle { myInstanceFormat };
+
+// For each buffer:
+LLGL::BufferDescriptor myBufferDesc;
+myBufferDesc.size               = myVertexDataSize;
+myBufferDesc.bindFlags          = LLGL::BindFlags::VertexBuffer;
+myBufferDesc.vertexFormatHandle = &myInstanceFormatHandle;
+auto myBuffer = myRenderSystem->CreateBuffer(myBufferDesc);
+\endcode
+\remarks The handle must remain valid until all buffers referencing it have been created;
+it does \e not have to outlive the buffers themselves.
+\see BufferDescriptor::vertexFormatHandle
+*/
+class LLGL_EXPORT VertexFormatHandle : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Validates the specified vertex format and stores its attributes immutably.
+        \param[in] vertexFormat Specifies the vertex format to compile. The attribute list must not be empty,
+        all attributes must have the same stride, and each attribute must fit into that stride.
+        \throws std::invalid_argument If the attribute list is empty, the attribute strides are inconsistent,
+        or an attribute exceeds the vertex stride.
+        */
+        explicit VertexFormatHandle(const VertexFormat& vertexFormat);
+
+        //! Returns the validated list of vertex attributes.
+        inline const std::vector<VertexAttribute>& GetAttributes() const
+        {
+            return attributes_;
+        }
+
+        //! Returns the vertex stride (in bytes) that is shared by all attributes.
+        inline std::uint32_t GetStride() const
+        {
+            return stride_;
+        }
+
+    private:
+
+        std::vector<VertexAttribute>    attributes_;
+        std::uint32_t                   stride_     = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -20,7 +20,21 @@ namespace LLGL
 {
 
 
-//TODO: this header is currently only included by internal classes
+/* ----- Enumerations ----- */
+
+/**
+\brief Video adapter type enumeration.
+\see VideoAdapterDescriptor::type
+*/
+enum class VideoAdapterType
+{
+    Undefined,      //!< Undefined adapter type, i.e. the renderer does not expose this information.
+    IntegratedGPU,  //!< GPU that is embedded in or tightly coupled with the host CPU.
+    DiscreteGPU,    //!< GPU that is typically a separate processor with dedicated video memory.
+    VirtualGPU,     //!< Virtualized GPU in an environment such as a virtual machine.
+    CPU,            //!< Software rasterizer running on the host CPU.
+};
+
 
 /* ----- Structures ----- */
 
@@ -35,10 +49,63 @@ struct VideoOutputDescriptor
     std::vector<DisplayModeDescriptor> displayModes;
 };
 
+/**
+\brief Video memory budget structure.
+\remarks The budget of a memory heap is an estimate provided by the driver and may change at runtime,
+e.g. when other applications compete for the same video memory.
+\see RenderSystem::QueryVideoMemoryBudgets
+*/
+struct VideoMemoryBudget
+{
+    //! Estimated video memory usage of the current process on this heap (in bytes).
+    std::uint64_t   usage       = 0;
+
+    /**
+    \brief Video memory budget for the current process on this heap (in bytes).
+    \remarks If the usage exceeds this budget, the driver is likely to demote allocations to slower memory.
+    */
+    std::uint64_t   budget      = 0;
+
+    //! Total size of the memory heap (in bytes).
+    std::uint64_t   heapSize    = 0;
+
+    //! Specifies whether this heap refers to device local video memory.
+    bool            deviceLocal = false;
+};
+
+/**
+\brief Device memory allocation statistics structure.
+\remarks Unlike VideoMemoryBudget, these statistics describe the allocations of the render system's
+own device memory manager rather than the driver's estimate of an entire memory heap.
+\see RenderSystem::QueryDeviceMemoryStats
+*/
+struct DeviceMemoryStats
+{
+    //! Index of the memory type these statistics refer to (i.e. the Vulkan memory type index).
+    std::uint32_t   memoryType      = 0;
+
+    //! Number of device memory chunks allocated for this memory type.
+    std::uint32_t   numChunks       = 0;
+
+    //! Total size (in bytes) allocated from the driver for this memory type.
+    std::uint64_t   allocatedSize   = 0;
+
+    //! Size (in bytes) occupied by live resource allocations.
+    std::uint64_t   inUseSize       = 0;
+
+    /**
+    \brief Size (in bytes) of free blocks between live allocations.
+    \remarks This space can only be reused by new allocations of a fitting size,
+    so a large value compared to \c inUseSize indicates allocation churn that may warrant a larger minimum chunk size.
+    \see RendererConfigurationVulkan::minDeviceMemoryAllocationSize
+    */
+    std::uint64_t   fragmentedSize  = 0;
+};
+
 /**
 \brief Video adapter descriptor structure.
 \remarks A video adapter determines the output capabilities of a GPU.
-\todo Currently unused in the interface.
+\see RenderSystem::QueryVideoAdapters
 */
 struct VideoAdapterDescriptor
 {
@@ -49,7 +116,25 @@ struct VideoAdapterDescriptor
     std::string                         vendor;
 
     //! Video memory size (in bytes).
-    std::uint64_t                       videoMemory = 0;
+    std::uint64_t                       videoMemory         = 0;
+
+    /**
+    \brief Hardware vendor ID (e.g. 0x10DE for NVIDIA). Zero if unknown.
+    \see RenderSystemDescriptor::preferredAdapterVendorID
+    */
+    std::uint32_t                       vendorID            = 0;
+
+    /**
+    \brief Hardware device ID. Zero if unknown.
+    \see RenderSystemDescriptor::preferredAdapterDeviceID
+    */
+    std::uint32_t                       deviceID            = 0;
+
+    //! Adapter type (integrated, discrete etc.). Not all renderers expose this information.
+    VideoAdapterType                    type                = VideoAdapterType::Undefined;
+
+    //! Number of hardware queue families (e.g. Vulkan queue families). Zero if the renderer does not expose queue families.
+    std::uint32_t                       numQueueFamilies    = 0;
 
     //! List of all adapter output descriptors.
     std::vector<VideoOutputDescriptor>  outputs;
@@ -12,6 +12,7 @@
 #include "Surface.h"
 #include "WindowFlags.h"
 #include "Key.h"
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -20,6 +21,9 @@ namespace LLGL
 {
 
 
+class WindowEventQueue;
+
+
 /**
 \brief Window interface for desktop platforms.
 \remarks This is the main interface for the windowing system in LLGL.
@@ -183,6 +187,9 @@ class LLGL_EXPORT Window : public Surface
         \return True, as long as the window can process events.
         Once the \c PostQuit function has set this window to the 'Quit' state, this function returns false.
         This happens when the user clicks on the close button.
+        \remarks If the window processes its events on a dedicated thread,
+        this also dispatches all events that have been queued since the previous call.
+        \see WindowDescriptor::threadedEventLoop
         \see PostQuit
         */
         bool ProcessEvents() override final;
@@ -256,9 +263,26 @@ class LLGL_EXPORT Window : public Surface
         */
         virtual void OnProcessEvents() = 0;
 
+        /**
+        \brief Enables or disables queued event dispatch. By default disabled.
+        \remarks If enabled, the \c Post functions no longer invoke the event listeners immediately,
+        but store the event in an internal thread-safe queue which is flushed each time \c ProcessEvents is called.
+        This is used by window implementations whose message pump runs on a dedicated thread.
+        When the queue is disabled again, all pending events are dispatched immediately.
+        \see WindowDescriptor::threadedEventLoop
+        \see ProcessEvents
+        */
+        void SetQueuedEventsEnabled(bool enabled);
+
+    private:
+
+        // Dispatches the specified event immediately, or enqueues it if queued event dispatch is enabled.
+        void PostOrDispatchEvent(std::function<void()>&& event);
+
     private:
 
         std::vector<std::shared_ptr<EventListener>> eventListeners_;
+        std::shared_ptr<WindowEventQueue>           eventQueue_;
         WindowBehavior                              behavior_;
         bool                                        quit_           = false;
         bool                                        focus_          = false;
@@ -87,6 +87,17 @@ struct WindowDescriptor
     //! Specifies whether the window is centered within the desktop screen. By default false.
     bool            centered            = false;
 
+    /**
+    \brief Specifies whether the window events are processed on a dedicated thread. By default false.
+    \remarks If enabled, the window runs its message pump on an internal thread and stores all events in a thread-safe queue,
+    which is flushed to the event listeners each time \c ProcessEvents is called.
+    This keeps the render loop responsive while the window is being moved or resized,
+    which would otherwise block the message pump in a modal loop.
+    \note Only supported on: MS/Windows.
+    \see Window::ProcessEvents
+    */
+    bool            threadedEventLoop   = false;
+
     /**
     \brief Window context handle.
     \remarks If used, this must be casted from a platform specific structure:
@@ -37,7 +37,7 @@ namespace LLGL
         ThrowExceededMaximumExcept(__FUNCTION__, #PARAM, static_cast<int>(PARAM), static_cast<int>(MAXIMUM))
 
 #define LLGL_ASSERT_FEATURE_SUPPORT(FEATURE)                            \
-    if (!GetRenderingCaps().features.FEATURE)                           \
+    if (!GetRenderingFeatures().FEATURE)                                \
         ThrowRenderingFeatureNotSupportedExcept(__FUNCTION__, #FEATURE)
 
 
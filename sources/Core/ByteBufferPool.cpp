@@ -0,0 +1,88 @@
+/*
+ * ByteBufferPool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ByteBufferPool.h"
+#include "Helper.h"
+
+
+namespace LLGL
+{
+
+
+ByteBufferPool& ByteBufferPool::Get()
+{
+    static ByteBufferPool instance;
+    return instance;
+}
+
+ByteBuffer ByteBufferPool::Alloc(std::size_t size)
+{
+    const auto bucket = GetBucketIndex(size);
+    if (bucket < numBuckets)
+    {
+        /* Try to recycle a pooled allocation of the matching bucket size */
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        if (!buckets_[bucket].empty())
+        {
+            auto buffer = std::move(buckets_[bucket].back());
+            buckets_[bucket].pop_back();
+            pooledSize_ -= (minBucketSize << bucket);
+            return buffer;
+        }
+    }
+
+    /* Allocate a fresh buffer of the full bucket size, so it can serve any request of the same bucket later */
+    return MakeUniqueArray<char>(bucket < numBuckets ? (minBucketSize << bucket) : size);
+}
+
+void ByteBufferPool::Recycle(ByteBuffer&& buffer, std::size_t size)
+{
+    const auto bucket = GetBucketIndex(size);
+    if (buffer && bucket < numBuckets)
+    {
+        const auto bucketSize = (minBucketSize << bucket);
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        if (pooledSize_ + bucketSize <= maxPooledSize)
+        {
+            buckets_[bucket].push_back(std::move(buffer));
+            pooledSize_ += bucketSize;
+        }
+    }
+}
+
+void ByteBufferPool::Clear()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    for (auto& bucket : buckets_)
+        bucket.clear();
+    pooledSize_ = 0;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::size_t ByteBufferPool::GetBucketIndex(std::size_t size)
+{
+    if (size <= (minBucketSize << (numBuckets - 1)))
+    {
+        /* Round size up to the next power-of-two bucket */
+        std::size_t bucket = 0;
+        while ((minBucketSize << bucket) < size)
+            ++bucket;
+        return bucket;
+    }
+    return numBuckets;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,72 @@
+/*
+ * ByteBufferPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_BYTE_BUFFER_POOL_H
+#define LLGL_BYTE_BUFFER_POOL_H
+
+
+#include <LLGL/ImageFlags.h>
+#include <cstddef>
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+// Size-bucketed pool of ByteBuffer allocations to recycle short-lived image operation temporaries.
+class ByteBufferPool
+{
+
+    public:
+
+        ByteBufferPool(const ByteBufferPool&) = delete;
+        ByteBufferPool& operator = (const ByteBufferPool&) = delete;
+
+        // Returns the singleton instance of this pool.
+        static ByteBufferPool& Get();
+
+        // Returns an uninitialized buffer of at least the specified size, recycling a pooled allocation if one fits.
+        ByteBuffer Alloc(std::size_t size);
+
+        // Returns a buffer back to the pool (or frees it if the pool is full); 'size' must be the size passed to Alloc.
+        void Recycle(ByteBuffer&& buffer, std::size_t size);
+
+        // Frees all pooled allocations.
+        void Clear();
+
+    private:
+
+        ByteBufferPool() = default;
+
+        // Returns the bucket index for the specified size, or 'numBuckets' if the size bypasses the pool.
+        static std::size_t GetBucketIndex(std::size_t size);
+
+    private:
+
+        static const std::size_t minBucketSize  = 4096;         // Allocation size of the smallest bucket
+        static const std::size_t numBuckets     = 15;           // Power-of-two bucket sizes: 4 KiB .. 64 MiB
+        static const std::size_t maxPooledSize  = 0x4000000;    // Upper bound (64 MiB) of memory the pool retains
+
+    private:
+
+        std::mutex              mutex_;
+        std::vector<ByteBuffer> buckets_[numBuckets];
+        std::size_t             pooledSize_         = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
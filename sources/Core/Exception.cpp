@@ -8,6 +8,11 @@
 #include "Exception.h"
 #include <stdexcept>
 
+#ifdef LLGL_DISABLE_EXCEPTIONS
+#   include <LLGL/Log.h>
+#   include <cstdlib>
+#endif
+
 
 namespace LLGL
 {
@@ -20,6 +25,28 @@ static void AddFuncName(std::string& s, const char* funcName)
     s += "': ";
 }
 
+#ifdef LLGL_DISABLE_EXCEPTIONS
+
+/*
+If exceptions are disabled (e.g. for embedded builds with -fno-exceptions),
+the error message is posted to the log and the process is aborted,
+so none of these helpers requires stack unwinding support.
+*/
+[[noreturn]]
+static void TrapExcept(const std::string& s)
+{
+    Log::PostReport(Log::ReportType::Error, s);
+    std::abort();
+}
+
+#define LLGL_THROW_EXCEPT(EXCEPTION, MESSAGE) TrapExcept(MESSAGE)
+
+#else
+
+#define LLGL_THROW_EXCEPT(EXCEPTION, MESSAGE) throw EXCEPTION(MESSAGE)
+
+#endif // /LLGL_DISABLE_EXCEPTIONS
+
 [[noreturn]]
 LLGL_EXPORT void ThrowNotSupportedExcept(const char* funcName, const char* featureName)
 {
@@ -29,7 +56,7 @@ LLGL_EXPORT void ThrowNotSupportedExcept(const char* funcName, const char* featu
         s += featureName;
         s += " not supported";
     }
-    throw std::runtime_error(s);
+    LLGL_THROW_EXCEPT(std::runtime_error, s);
 }
 
 [[noreturn]]
@@ -42,7 +69,7 @@ LLGL_EXPORT void ThrowRenderingFeatureNotSupportedExcept(const char* funcName, c
         s += featureName;
         s += " not supported";
     }
-    throw std::runtime_error(s);
+    LLGL_THROW_EXCEPT(std::runtime_error, s);
 }
 
 [[noreturn]]
@@ -55,7 +82,7 @@ LLGL_EXPORT void ThrowGLExtensionNotSupportedExcept(const char* funcName, const
         s += extensionName;
         s += "' not supported";
     }
-    throw std::runtime_error(s);
+    LLGL_THROW_EXCEPT(std::runtime_error, s);
 }
 
 [[noreturn]]
@@ -68,7 +95,7 @@ LLGL_EXPORT void ThrowVKExtensionNotSupportedExcept(const char* funcName, const
         s += extensionName;
         s += "' not supported";
     }
-    throw std::runtime_error(s);
+    LLGL_THROW_EXCEPT(std::runtime_error, s);
 }
 
 [[noreturn]]
@@ -79,7 +106,7 @@ LLGL_EXPORT void ThrowNotImplementedExcept(const char* funcName)
         AddFuncName(s, funcName);
         s += "not implemented yet";
     }
-    throw std::runtime_error(std::string(funcName) + ": not implemented yet");
+    LLGL_THROW_EXCEPT(std::runtime_error, std::string(funcName) + ": not implemented yet");
 }
 
 [[noreturn]]
@@ -92,7 +119,7 @@ LLGL_EXPORT void ThrowNullPointerExcept(const char* funcName, const char* paramN
         s += paramName;
         s += "' must not be a null pointer";
     }
-    throw std::runtime_error(s);
+    LLGL_THROW_EXCEPT(std::runtime_error, s);
 }
 
 [[noreturn]]
@@ -109,7 +136,7 @@ LLGL_EXPORT void ThrowExceededUpperBoundExcept(const char* funcName, const char*
         s += std::to_string(upperBound);
         s += ")";
     }
-    throw std::out_of_range(s);
+    LLGL_THROW_EXCEPT(std::out_of_range, s);
 }
 
 [[noreturn]]
@@ -126,7 +153,7 @@ LLGL_EXPORT void ThrowExceededMaximumExcept(const char* funcName, const char* pa
         s += std::to_string(maximum);
         s += "]";
     }
-    throw std::out_of_range(s);
+    LLGL_THROW_EXCEPT(std::out_of_range, s);
 }
 
 
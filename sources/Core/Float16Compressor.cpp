@@ -7,6 +7,18 @@
 
 #include "Float16Compressor.h"
 
+/*
+Vectorized half-float conversion: F16C (vcvtps2ph/vcvtph2ps) on x86 and the native NEON
+conversion instructions on ARM, with the scalar compressor as generic fallback.
+*/
+#if defined __F16C__ || defined __AVX2__
+#   include <immintrin.h>
+#   define LLGL_SIMD_F16C 1
+#elif defined __aarch64__ || defined _M_ARM64 || ((defined __ARM_NEON || defined __ARM_NEON__) && defined __ARM_FP && (__ARM_FP & 2) != 0)
+#   include <arm_neon.h>
+#   define LLGL_SIMD_NEON_FP16 1
+#endif
+
 
 namespace LLGL
 {
@@ -103,6 +115,49 @@ LLGL_EXPORT float DecompressFloat16(std::uint16_t value)
     return Float16Compressor::Decompress(value);
 }
 
+LLGL_EXPORT void CompressFloat16(std::uint16_t* dst, const float* src, std::size_t count)
+{
+    std::size_t i = 0;
+
+    #if LLGL_SIMD_F16C
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i v = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+
+    #elif LLGL_SIMD_NEON_FP16
+
+    for (; i + 4 <= count; i += 4)
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+
+    #endif
+
+    for (; i < count; ++i)
+        dst[i] = Float16Compressor::Compress(src[i]);
+}
+
+LLGL_EXPORT void DecompressFloat16(float* dst, const std::uint16_t* src, std::size_t count)
+{
+    std::size_t i = 0;
+
+    #if LLGL_SIMD_F16C
+
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+
+    #elif LLGL_SIMD_NEON_FP16
+
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+
+    #endif
+
+    for (; i < count; ++i)
+        dst[i] = Float16Compressor::Decompress(src[i]);
+}
+
 
 } // /namespace LLGL
 
@@ -6,73 +6,26 @@
  */
 
 #include <LLGL/Image.h>
+#include "ByteBufferPool.h"
+#include "Float16Compressor.h"
+#include "../Renderer/TextureUtils.h"
 #include <algorithm>
 #include <string.h>
 
+/* Vectorized kernel for the common RGBA8 downsampling case; the scalar box filter remains as generic fallback */
+#if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define LLGL_SIMD_SSE2 1
+#elif defined __ARM_NEON || defined __ARM_NEON__ || defined _M_ARM64
+#   include <arm_neon.h>
+#   define LLGL_SIMD_NEON 1
+#endif
+
 
 namespace LLGL
 {
 
 
-static void BitBlit(
-    const Extent3D& copyExtent,
-    std::uint32_t   bpp,
-    char*           dst,
-    std::uint32_t   dstRowStride,
-    std::uint32_t   dstDepthStride,
-    const char*     src,
-    std::uint32_t   srcRowStride,
-    std::uint32_t   srcDepthStride)
-{
-    const auto copyRowStride    = bpp * copyExtent.width;
-    const auto copyDepthStride  = copyRowStride * copyExtent.height;
-
-    if (srcRowStride == dstRowStride && copyRowStride == dstRowStride)
-    {
-        if (srcDepthStride == dstDepthStride && copyDepthStride && dstDepthStride)
-        {
-            /* Copy region directly into output data */
-            ::memcpy(dst, src, copyDepthStride * copyExtent.depth);
-        }
-        else
-        {
-            /* Copy region directly into output data */
-            for (std::uint32_t z = 0; z < copyExtent.depth; ++z)
-            {
-                /* Copy current slice */
-                ::memcpy(dst, src, copyDepthStride);
-
-                /* Move pointers to next slice */
-                dst += dstDepthStride;
-                src += srcDepthStride;
-            }
-        }
-    }
-    else
-    {
-        /* Adjust depth stride */
-        srcDepthStride -= srcRowStride * copyExtent.height;
-
-        /* Copy region directly into output data */
-        for (std::uint32_t z = 0; z < copyExtent.depth; ++z)
-        {
-            /* Copy current slice */
-            for (std::uint32_t y = 0; y < copyExtent.height; ++y)
-            {
-                /* Copy current row */
-                ::memcpy(dst, src, copyRowStride);
-
-                /* Move pointers to next row */
-                dst += dstRowStride;
-                src += srcRowStride;
-            }
-
-            /* Move pointers to next slice */
-            src += srcDepthStride;
-        }
-    }
-}
-
 /* ----- Common ----- */
 
 Image::Image(const Extent3D& extent, const ImageFormat format, const DataType dataType) :
@@ -99,6 +52,15 @@ Image::Image(const Extent3D& extent, const ImageFormat format, const DataType da
 {
 }
 
+Image::Image(const Extent3D& extent, const ImageFormat format, const DataType dataType, void* data) :
+    extent_   { extent                           },
+    format_   { format                           },
+    dataType_ { dataType                         },
+    data_     { reinterpret_cast<char*>(data)    },
+    ownsData_ { false                            }
+{
+}
+
 Image::Image(const Image& rhs) :
     Image { rhs.GetExtent(), rhs.GetFormat(), rhs.GetDataType() }
 {
@@ -109,15 +71,23 @@ Image::Image(Image&& rhs) :
     extent_   { rhs.extent_          },
     format_   { rhs.format_          },
     dataType_ { rhs.dataType_        },
-    data_     { std::move(rhs.data_) }
+    data_     { std::move(rhs.data_) },
+    ownsData_ { rhs.ownsData_        }
 {
     rhs.ResetAttributes();
+    rhs.ownsData_ = true;
+}
+
+Image::~Image()
+{
+    DetachExternalBuffer();
 }
 
 /* ----- Operators ----- */
 
 Image& Image::operator = (const Image& rhs)
 {
+    DetachExternalBuffer();
     extent_     = rhs.GetExtent();
     format_     = rhs.GetFormat();
     dataType_   = rhs.GetDataType();
@@ -128,8 +98,13 @@ Image& Image::operator = (const Image& rhs)
 
 Image& Image::operator = (Image&& rhs)
 {
-    Reset(rhs.GetExtent(), rhs.GetFormat(), rhs.GetDataType(), std::move(rhs.data_));
-    rhs.ResetAttributes();
+    if (&rhs != this)
+    {
+        Reset(rhs.GetExtent(), rhs.GetFormat(), rhs.GetDataType(), std::move(rhs.data_));
+        ownsData_ = rhs.ownsData_;
+        rhs.ResetAttributes();
+        rhs.ownsData_ = true;
+    }
     return *this;
 }
 
@@ -137,11 +112,20 @@ Image& Image::operator = (Image&& rhs)
 
 void Image::Convert(const ImageFormat format, const DataType dataType, std::size_t threadCount)
 {
-    /* Convert image buffer (if necessary) */
+    /* Convert image buffer (if necessary); compressed formats are routed through the extent-aware transcoding path */
     if (data_)
     {
-        if (auto convertedData = ConvertImageBuffer(GetSrcDesc(), format, dataType, threadCount))
+        auto convertedData =
+        (
+            IsCompressedFormat(GetFormat()) || IsCompressedFormat(format)
+                ? ConvertImageBuffer(GetSrcDesc(), GetExtent(), format, dataType, threadCount)
+                : ConvertImageBuffer(GetSrcDesc(), format, dataType, threadCount)
+        );
+        if (convertedData)
+        {
+            DetachExternalBuffer();
             data_ = std::move(convertedData);
+        }
     }
 
     /* Store new attributes */
@@ -152,6 +136,7 @@ void Image::Convert(const ImageFormat format, const DataType dataType, std::size
 void Image::Resize(const Extent3D& extent)
 {
     /* Allocate new image buffer or release it if the extent is zero */
+    DetachExternalBuffer();
     extent_ = extent;
     if (extent.width > 0 && extent.height > 0 && extent.depth > 0)
         data_ = GenerateEmptyByteBuffer(GetDataSize(), false);
@@ -164,6 +149,7 @@ void Image::Resize(const Extent3D& extent, const ColorRGBAd& fillColor)
     if (extent_ != extent)
     {
         /* Generate new image buffer with fill color */
+        DetachExternalBuffer();
         extent_ = extent;
         data_   = GenerateImageBuffer(GetFormat(), GetDataType(), GetNumPixels(), fillColor);
     }
@@ -185,6 +171,8 @@ void Image::Resize(const Extent3D& extent, const ColorRGBAd& fillColor, const Of
         prevImage.format_   = GetFormat();
         prevImage.dataType_ = GetDataType();
         prevImage.data_     = std::move(data_);
+        prevImage.ownsData_ = ownsData_;
+        ownsData_           = true;
 
         if ( extent.width  > GetExtent().width  ||
              extent.height > GetExtent().height ||
@@ -217,16 +205,19 @@ void Image::Swap(Image& rhs)
     std::swap(format_,   rhs.format_  );
     std::swap(dataType_, rhs.dataType_);
     std::swap(data_,     rhs.data_    );
+    std::swap(ownsData_, rhs.ownsData_);
 }
 
 void Image::Reset()
 {
     ResetAttributes();
+    DetachExternalBuffer();
     data_.reset();
 }
 
 void Image::Reset(const Extent3D& extent, const ImageFormat format, const DataType dataType, ByteBuffer&& data)
 {
+    DetachExternalBuffer();
     extent_     = extent;
     format_     = format;
     dataType_   = dataType;
@@ -236,6 +227,7 @@ void Image::Reset(const Extent3D& extent, const ImageFormat format, const DataTy
 ByteBuffer Image::Release()
 {
     ResetAttributes();
+    DetachExternalBuffer();
     return std::move(data_);
 }
 
@@ -315,10 +307,17 @@ void Image::Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRe
             Image srcImageTemp;
             const Image* srcImageRef = &srcImage;
 
+            ByteBuffer tempBuffer;
+            std::size_t tempBufferSize = 0;
+
             if (srcImageRef == this && Overlap3DRegion(dstRegionOffset, srcRegionOffset, srcRegionExtent))
             {
-                /* Copy source image */
-                srcImageTemp = *this;
+                /* Copy source image into pooled buffer and refer to it with a non-owning view */
+                tempBufferSize  = GetDataSize();
+                tempBuffer      = ByteBufferPool::Get().Alloc(tempBufferSize);
+                ::memcpy(tempBuffer.get(), data_.get(), tempBufferSize);
+
+                srcImageTemp = Image{ GetExtent(), GetFormat(), GetDataType(), tempBuffer.get() };
                 srcImageRef = &srcImageTemp;
             }
 
@@ -339,6 +338,10 @@ void Image::Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRe
                 dst, dstRowStride, dstDepthStride,
                 src, srcRowStride, srcDepthStride
             );
+
+            /* Return temporary copy to the pool */
+            if (tempBuffer)
+                ByteBufferPool::Get().Recycle(std::move(tempBuffer), tempBufferSize);
         }
     }
 }
@@ -472,6 +475,294 @@ void Image::WritePixels(const Offset3D& offset, const Extent3D& extent, const Sr
     }
 }
 
+/*
+Box filter kernels for the "GenerateMipChain" function.
+Edge samples of odd sized levels are clamped, i.e. they are weighted twice.
+*/
+
+static Extent3D NextMipExtent(const Extent3D& extent)
+{
+    return Extent3D
+    {
+        std::max(1u, extent.width  / 2),
+        std::max(1u, extent.height / 2),
+        std::max(1u, extent.depth  / 2)
+    };
+}
+
+// Reads the specified pixel component as double precision value (without normalization).
+static double ReadPixelComponent(DataType dataType, const void* data, std::size_t idx)
+{
+    switch (dataType)
+    {
+        case DataType::Undefined:
+            break;
+        case DataType::Int8:
+            return static_cast<double>(reinterpret_cast<const std::int8_t*>(data)[idx]);
+        case DataType::UInt8:
+            return static_cast<double>(reinterpret_cast<const std::uint8_t*>(data)[idx]);
+        case DataType::Int16:
+            return static_cast<double>(reinterpret_cast<const std::int16_t*>(data)[idx]);
+        case DataType::UInt16:
+            return static_cast<double>(reinterpret_cast<const std::uint16_t*>(data)[idx]);
+        case DataType::Int32:
+            return static_cast<double>(reinterpret_cast<const std::int32_t*>(data)[idx]);
+        case DataType::UInt32:
+            return static_cast<double>(reinterpret_cast<const std::uint32_t*>(data)[idx]);
+        case DataType::Float16:
+            return static_cast<double>(DecompressFloat16(reinterpret_cast<const std::uint16_t*>(data)[idx]));
+        case DataType::Float32:
+            return static_cast<double>(reinterpret_cast<const float*>(data)[idx]);
+        case DataType::Float64:
+            return reinterpret_cast<const double*>(data)[idx];
+    }
+    return 0.0;
+}
+
+// Writes the specified pixel component from a double precision value (rounded to nearest for integral types).
+static void WritePixelComponent(DataType dataType, void* data, std::size_t idx, double value)
+{
+    const double rounded = (value < 0.0 ? value - 0.5 : value + 0.5);
+    switch (dataType)
+    {
+        case DataType::Undefined:
+            break;
+        case DataType::Int8:
+            reinterpret_cast<std::int8_t*>(data)[idx] = static_cast<std::int8_t>(rounded);
+            break;
+        case DataType::UInt8:
+            reinterpret_cast<std::uint8_t*>(data)[idx] = static_cast<std::uint8_t>(rounded);
+            break;
+        case DataType::Int16:
+            reinterpret_cast<std::int16_t*>(data)[idx] = static_cast<std::int16_t>(rounded);
+            break;
+        case DataType::UInt16:
+            reinterpret_cast<std::uint16_t*>(data)[idx] = static_cast<std::uint16_t>(rounded);
+            break;
+        case DataType::Int32:
+            reinterpret_cast<std::int32_t*>(data)[idx] = static_cast<std::int32_t>(rounded);
+            break;
+        case DataType::UInt32:
+            reinterpret_cast<std::uint32_t*>(data)[idx] = static_cast<std::uint32_t>(rounded);
+            break;
+        case DataType::Float16:
+            reinterpret_cast<std::uint16_t*>(data)[idx] = CompressFloat16(static_cast<float>(value));
+            break;
+        case DataType::Float32:
+            reinterpret_cast<float*>(data)[idx] = static_cast<float>(value);
+            break;
+        case DataType::Float64:
+            reinterpret_cast<double*>(data)[idx] = value;
+            break;
+    }
+}
+
+// Downsamples the source MIP-map level into the destination level with a box filter.
+static void DownsampleMipLevel(
+    std::uint32_t   numComponents,
+    DataType        dataType,
+    const void*     src,
+    const Extent3D& srcExtent,
+    void*           dst,
+    const Extent3D& dstExtent)
+{
+    const std::size_t srcRowStride      = static_cast<std::size_t>(srcExtent.width) * numComponents;
+    const std::size_t srcDepthStride    = srcRowStride * srcExtent.height;
+
+    std::size_t dstIdx = 0;
+
+    for (std::uint32_t z = 0; z < dstExtent.depth; ++z)
+    {
+        const std::size_t z0 = (z*2u) * srcDepthStride;
+        const std::size_t z1 = std::min(z*2u + 1u, srcExtent.depth - 1u) * srcDepthStride;
+
+        for (std::uint32_t y = 0; y < dstExtent.height; ++y)
+        {
+            const std::size_t y0 = (y*2u) * srcRowStride;
+            const std::size_t y1 = std::min(y*2u + 1u, srcExtent.height - 1u) * srcRowStride;
+
+            for (std::uint32_t x = 0; x < dstExtent.width; ++x)
+            {
+                const std::size_t x0 = static_cast<std::size_t>(x*2u) * numComponents;
+                const std::size_t x1 = std::min(x*2u + 1u, srcExtent.width - 1u) * static_cast<std::size_t>(numComponents);
+
+                for (std::uint32_t c = 0; c < numComponents; ++c)
+                {
+                    const double sum =
+                    (
+                        ReadPixelComponent(dataType, src, z0 + y0 + x0 + c) +
+                        ReadPixelComponent(dataType, src, z0 + y0 + x1 + c) +
+                        ReadPixelComponent(dataType, src, z0 + y1 + x0 + c) +
+                        ReadPixelComponent(dataType, src, z0 + y1 + x1 + c) +
+                        ReadPixelComponent(dataType, src, z1 + y0 + x0 + c) +
+                        ReadPixelComponent(dataType, src, z1 + y0 + x1 + c) +
+                        ReadPixelComponent(dataType, src, z1 + y1 + x0 + c) +
+                        ReadPixelComponent(dataType, src, z1 + y1 + x1 + c)
+                    );
+                    WritePixelComponent(dataType, dst, dstIdx++, sum / 8.0);
+                }
+            }
+        }
+    }
+}
+
+// Downsamples the source MIP-map level of unsigned bytes into the destination level with a box filter.
+static void DownsampleMipLevelUInt8(
+    std::uint32_t       numComponents,
+    const std::uint8_t* src,
+    const Extent3D&     srcExtent,
+    std::uint8_t*       dst,
+    const Extent3D&     dstExtent)
+{
+    #if LLGL_SIMD_SSE2 || LLGL_SIMD_NEON
+
+    if (numComponents == 4 && srcExtent.depth == 1 && srcExtent.width % 2 == 0 && srcExtent.height % 2 == 0)
+    {
+        /* Average 2x2 blocks of 4-component pixels with the vectorized kernel */
+        const std::size_t srcRowStride = static_cast<std::size_t>(srcExtent.width) * 4;
+
+        for (std::uint32_t y = 0; y < dstExtent.height; ++y)
+        {
+            const auto* row0    = src + (y*2u     ) * srcRowStride;
+            const auto* row1    = src + (y*2u + 1u) * srcRowStride;
+            auto*       out     = dst + static_cast<std::size_t>(y) * dstExtent.width * 4;
+
+            std::uint32_t x = 0;
+
+            #if LLGL_SIMD_SSE2
+
+            for (; x + 2 <= dstExtent.width; x += 2)
+            {
+                __m128i v = _mm_avg_epu8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x*8)),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x*8))
+                );
+                __m128i w = _mm_avg_epu8(
+                    _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 1, 3, 1))
+                );
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(out + x*4), w);
+            }
+
+            #elif LLGL_SIMD_NEON
+
+            for (; x + 4 <= dstExtent.width; x += 4)
+            {
+                uint8x16_t v0 = vrhaddq_u8(vld1q_u8(row0 + x*8), vld1q_u8(row1 + x*8));
+                uint8x16_t v1 = vrhaddq_u8(vld1q_u8(row0 + x*8 + 16), vld1q_u8(row1 + x*8 + 16));
+                uint32x4x2_t uz = vuzpq_u32(vreinterpretq_u32_u8(v0), vreinterpretq_u32_u8(v1));
+                vst1q_u8(out + x*4, vrhaddq_u8(vreinterpretq_u8_u32(uz.val[0]), vreinterpretq_u8_u32(uz.val[1])));
+            }
+
+            #endif
+
+            /* Average remaining pixels of this row pair */
+            for (; x < dstExtent.width; ++x)
+            {
+                for (std::uint32_t c = 0; c < 4; ++c)
+                {
+                    const std::uint32_t sum = row0[x*8 + c] + row0[x*8 + 4 + c] + row1[x*8 + c] + row1[x*8 + 4 + c];
+                    out[x*4 + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+                }
+            }
+        }
+
+        return;
+    }
+
+    #endif // /LLGL_SIMD_SSE2 || LLGL_SIMD_NEON
+
+    const std::size_t srcRowStride      = static_cast<std::size_t>(srcExtent.width) * numComponents;
+    const std::size_t srcDepthStride    = srcRowStride * srcExtent.height;
+
+    std::size_t dstIdx = 0;
+
+    for (std::uint32_t z = 0; z < dstExtent.depth; ++z)
+    {
+        const std::size_t z0 = (z*2u) * srcDepthStride;
+        const std::size_t z1 = std::min(z*2u + 1u, srcExtent.depth - 1u) * srcDepthStride;
+
+        for (std::uint32_t y = 0; y < dstExtent.height; ++y)
+        {
+            const std::size_t y0 = (y*2u) * srcRowStride;
+            const std::size_t y1 = std::min(y*2u + 1u, srcExtent.height - 1u) * srcRowStride;
+
+            for (std::uint32_t x = 0; x < dstExtent.width; ++x)
+            {
+                const std::size_t x0 = static_cast<std::size_t>(x*2u) * numComponents;
+                const std::size_t x1 = std::min(x*2u + 1u, srcExtent.width - 1u) * static_cast<std::size_t>(numComponents);
+
+                for (std::uint32_t c = 0; c < numComponents; ++c)
+                {
+                    const std::uint32_t sum =
+                    (
+                        src[z0 + y0 + x0 + c] + src[z0 + y0 + x1 + c] +
+                        src[z0 + y1 + x0 + c] + src[z0 + y1 + x1 + c] +
+                        src[z1 + y0 + x0 + c] + src[z1 + y0 + x1 + c] +
+                        src[z1 + y1 + x0 + c] + src[z1 + y1 + x1 + c]
+                    );
+                    dst[dstIdx++] = static_cast<std::uint8_t>((sum + 4) / 8);
+                }
+            }
+        }
+    }
+}
+
+ByteBuffer Image::GenerateMipChain(std::uint32_t numMipLevels) const
+{
+    if (!data_)
+        return nullptr;
+
+    /* Determine number of MIP-map levels and total chain size */
+    const auto maxNumMipLevels = NumMipLevels(extent_.width, extent_.height, extent_.depth);
+    if (numMipLevels == 0 || numMipLevels > maxNumMipLevels)
+        numMipLevels = maxNumMipLevels;
+
+    const auto bpp = GetBytesPerPixel();
+
+    std::size_t chainSize   = 0;
+    auto        extent      = extent_;
+
+    for (std::uint32_t level = 0; level < numMipLevels; ++level)
+    {
+        chainSize += static_cast<std::size_t>(extent.width) * extent.height * extent.depth * bpp;
+        extent = NextMipExtent(extent);
+    }
+
+    /* Allocate contiguous chain buffer and copy base level */
+    auto mipChain = GenerateEmptyByteBuffer(chainSize, false);
+    ::memcpy(mipChain.get(), data_.get(), GetDataSize());
+
+    /* Downsample each subsequent level from the previous one */
+    const auto  numComponents   = ImageFormatSize(format_);
+    auto        srcExtent       = extent_;
+    const char* src             = mipChain.get();
+    char*       dst             = mipChain.get() + GetDataSize();
+
+    for (std::uint32_t level = 1; level < numMipLevels; ++level)
+    {
+        const auto dstExtent = NextMipExtent(srcExtent);
+
+        if (dataType_ == DataType::UInt8)
+        {
+            DownsampleMipLevelUInt8(
+                numComponents,
+                reinterpret_cast<const std::uint8_t*>(src), srcExtent,
+                reinterpret_cast<std::uint8_t*>(dst), dstExtent
+            );
+        }
+        else
+            DownsampleMipLevel(numComponents, dataType_, src, srcExtent, dst, dstExtent);
+
+        /* Move pointers to next level */
+        src         = dst;
+        srcExtent   = dstExtent;
+        dst         += static_cast<std::size_t>(dstExtent.width) * dstExtent.height * dstExtent.depth * bpp;
+    }
+
+    return mipChain;
+}
+
 void Image::MirrorYZPlane()
 {
     //TODO
@@ -565,6 +856,16 @@ void Image::ResetAttributes()
     extent_     = { 0, 0, 0 };
 }
 
+void Image::DetachExternalBuffer()
+{
+    /* Drop the buffer pointer without deleting it if this image does not own its buffer */
+    if (!ownsData_)
+    {
+        data_.release();
+        ownsData_ = true;
+    }
+}
+
 std::size_t Image::GetDataPtrOffset(const Offset3D& offset) const
 {
     const auto bpp  = static_cast<std::size_t>(GetBytesPerPixel());
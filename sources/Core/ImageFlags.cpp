@@ -14,8 +14,25 @@
 #include <cstring>
 #include "../Core/Helper.h"
 #include "../Core/Assertion.h"
+#include "ByteBufferPool.h"
 #include "Float16Compressor.h"
 
+/*
+Vectorized kernels for the hot conversion pairs (UByte <-> Float and byte pixel swizzles).
+The instruction set is selected for the current build target with the scalar loops as generic fallback.
+*/
+#if defined __AVX2__
+#   include <immintrin.h>
+#   define LLGL_SIMD_AVX2 1
+#   define LLGL_SIMD_SSE2 1
+#elif defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define LLGL_SIMD_SSE2 1
+#elif defined __ARM_NEON || defined __ARM_NEON__ || defined _M_ARM64
+#   include <arm_neon.h>
+#   define LLGL_SIMD_NEON 1
+#endif
+
 
 namespace LLGL
 {
@@ -83,6 +100,257 @@ union VariantConstBuffer
 using VariantColor = ColorRGBAT<Variant>;
 
 
+/* ----- Vectorized conversion kernels ----- */
+
+#if LLGL_SIMD_SSE2 || LLGL_SIMD_NEON
+
+// Converts a range of normalized unsigned bytes to 32-bit floats; returns the index where scalar conversion must continue.
+static std::size_t ConvertUInt8ToFloat32(const std::uint8_t* src, float* dst, std::size_t idxBegin, std::size_t idxEnd)
+{
+    std::size_t i = idxBegin;
+
+    #if LLGL_SIMD_AVX2
+
+    const __m256 scale = _mm256_set1_ps(1.0f / 255.0f);
+    for (; i + 8 <= idxEnd; i += 8)
+    {
+        __m256i v32 = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(v32), scale));
+    }
+
+    #elif LLGL_SIMD_SSE2
+
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128  scale = _mm_set1_ps(1.0f / 255.0f);
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        __m128i v8   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i v16l = _mm_unpacklo_epi8(v8, zero);
+        __m128i v16h = _mm_unpackhi_epi8(v8, zero);
+        _mm_storeu_ps(dst + i     , _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v16l, zero)), scale));
+        _mm_storeu_ps(dst + i +  4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v16l, zero)), scale));
+        _mm_storeu_ps(dst + i +  8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v16h, zero)), scale));
+        _mm_storeu_ps(dst + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v16h, zero)), scale));
+    }
+
+    #elif LLGL_SIMD_NEON
+
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        uint8x16_t v8   = vld1q_u8(src + i);
+        uint16x8_t v16l = vmovl_u8(vget_low_u8(v8));
+        uint16x8_t v16h = vmovl_u8(vget_high_u8(v8));
+        vst1q_f32(dst + i     , vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16 (v16l))), 1.0f / 255.0f));
+        vst1q_f32(dst + i +  4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v16l))), 1.0f / 255.0f));
+        vst1q_f32(dst + i +  8, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16 (v16h))), 1.0f / 255.0f));
+        vst1q_f32(dst + i + 12, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(v16h))), 1.0f / 255.0f));
+    }
+
+    #endif
+
+    return i;
+}
+
+// Converts a range of 32-bit floats to normalized unsigned bytes; returns the index where scalar conversion must continue.
+static std::size_t ConvertFloat32ToUInt8(const float* src, std::uint8_t* dst, std::size_t idxBegin, std::size_t idxEnd)
+{
+    std::size_t i = idxBegin;
+
+    #if LLGL_SIMD_SSE2
+
+    const __m128 scale = _mm_set1_ps(255.0f);
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        __m128i v0 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i     ), scale));
+        __m128i v1 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i +  4), scale));
+        __m128i v2 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i +  8), scale));
+        __m128i v3 = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src + i + 12), scale));
+        __m128i v8 = _mm_packus_epi16(_mm_packs_epi32(v0, v1), _mm_packs_epi32(v2, v3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v8);
+    }
+
+    #elif LLGL_SIMD_NEON
+
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        uint32x4_t v0 = vcvtq_u32_f32(vmulq_n_f32(vld1q_f32(src + i     ), 255.0f));
+        uint32x4_t v1 = vcvtq_u32_f32(vmulq_n_f32(vld1q_f32(src + i +  4), 255.0f));
+        uint32x4_t v2 = vcvtq_u32_f32(vmulq_n_f32(vld1q_f32(src + i +  8), 255.0f));
+        uint32x4_t v3 = vcvtq_u32_f32(vmulq_n_f32(vld1q_f32(src + i + 12), 255.0f));
+        uint16x8_t v16l = vcombine_u16(vqmovn_u32(v0), vqmovn_u32(v1));
+        uint16x8_t v16h = vcombine_u16(vqmovn_u32(v2), vqmovn_u32(v3));
+        vst1q_u8(dst + i, vcombine_u8(vqmovn_u16(v16l), vqmovn_u16(v16h)));
+    }
+
+    #endif
+
+    return i;
+}
+
+#endif // /LLGL_SIMD_SSE2 || LLGL_SIMD_NEON
+
+// Swaps two byte channels in a range of 4-component byte pixels; 'channel' must be 0 (e.g. RGBA <-> BGRA) or 1 (e.g. ARGB <-> ABGR).
+static void SwapChannels4(const std::uint8_t* src, std::uint8_t* dst, unsigned channel, std::size_t idxBegin, std::size_t idxEnd)
+{
+    const unsigned      shift   = channel * 8;
+    const std::uint32_t loMask  = (0x000000FFu << shift);
+    const std::uint32_t hiMask  = (0x00FF0000u << shift);
+
+    std::size_t i = idxBegin;
+
+    #if LLGL_SIMD_SSE2
+
+    const __m128i keep  = _mm_set1_epi32(static_cast<int>(~(loMask | hiMask)));
+    const __m128i lo    = _mm_set1_epi32(static_cast<int>(loMask));
+    const __m128i hi    = _mm_set1_epi32(static_cast<int>(hiMask));
+    for (; i + 4 <= idxEnd; i += 4)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i*4));
+        __m128i w = _mm_or_si128(
+            _mm_and_si128(v, keep),
+            _mm_or_si128(
+                _mm_slli_epi32(_mm_and_si128(v, lo), 16),
+                _mm_srli_epi32(_mm_and_si128(v, hi), 16)
+            )
+        );
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*4), w);
+    }
+
+    #elif LLGL_SIMD_NEON
+
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        uint8x16x4_t v = vld4q_u8(src + i*4);
+        uint8x16_t tmp = v.val[channel];
+        v.val[channel] = v.val[channel + 2];
+        v.val[channel + 2] = tmp;
+        vst4q_u8(dst + i*4, v);
+    }
+
+    #endif
+
+    for (; i < idxEnd; ++i)
+    {
+        std::uint32_t v;
+        ::memcpy(&v, src + i*4, sizeof(v));
+        v = (v & ~(loMask | hiMask)) | ((v & loMask) << 16) | ((v & hiMask) >> 16);
+        ::memcpy(dst + i*4, &v, sizeof(v));
+    }
+}
+
+// Expands a range of 3-component byte pixels to 4-component pixels with an opaque alpha channel.
+static void ExpandChannels3To4(const std::uint8_t* src, std::uint8_t* dst, bool swapRedBlue, std::size_t idxBegin, std::size_t idxEnd)
+{
+    std::size_t i = idxBegin;
+
+    #if LLGL_SIMD_NEON
+
+    uint8x16x4_t w;
+    w.val[3] = vdupq_n_u8(0xFF);
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        uint8x16x3_t v = vld3q_u8(src + i*3);
+        w.val[0] = v.val[swapRedBlue ? 2 : 0];
+        w.val[1] = v.val[1];
+        w.val[2] = v.val[swapRedBlue ? 0 : 2];
+        vst4q_u8(dst + i*4, w);
+    }
+
+    #endif
+
+    for (; i < idxEnd; ++i)
+    {
+        const auto* s = src + i*3;
+        auto*       d = dst + i*4;
+        d[0] = s[swapRedBlue ? 2 : 0];
+        d[1] = s[1];
+        d[2] = s[swapRedBlue ? 0 : 2];
+        d[3] = 0xFF;
+    }
+}
+
+// Trims a range of 4-component byte pixels to 3-component pixels by dropping the alpha channel.
+static void TrimChannels4To3(const std::uint8_t* src, std::uint8_t* dst, bool swapRedBlue, std::size_t idxBegin, std::size_t idxEnd)
+{
+    std::size_t i = idxBegin;
+
+    #if LLGL_SIMD_NEON
+
+    uint8x16x3_t w;
+    for (; i + 16 <= idxEnd; i += 16)
+    {
+        uint8x16x4_t v = vld4q_u8(src + i*4);
+        w.val[0] = v.val[swapRedBlue ? 2 : 0];
+        w.val[1] = v.val[1];
+        w.val[2] = v.val[swapRedBlue ? 0 : 2];
+        vst3q_u8(dst + i*3, w);
+    }
+
+    #endif
+
+    for (; i < idxEnd; ++i)
+    {
+        const auto* s = src + i*4;
+        auto*       d = dst + i*3;
+        d[0] = s[swapRedBlue ? 2 : 0];
+        d[1] = s[1];
+        d[2] = s[swapRedBlue ? 0 : 2];
+    }
+}
+
+// Attempts to convert the specified pixel range with one of the swizzle kernels; returns false if no fast path applies.
+static bool ConvertImageBufferFormatFastPath(
+    ImageFormat                 srcFormat,
+    DataType                    srcDataType,
+    const VariantConstBuffer&   srcBuffer,
+    ImageFormat                 dstFormat,
+    VariantBuffer&              dstBuffer,
+    std::size_t                 idxBegin,
+    std::size_t                 idxEnd)
+{
+    /* Only normalized unsigned bytes have a trivial channel layout and a constant opaque alpha of 0xFF */
+    if (srcDataType != DataType::UInt8)
+        return false;
+
+    const auto* src = srcBuffer.uint8;
+    auto*       dst = dstBuffer.uint8;
+
+    if ((srcFormat == ImageFormat::RGBA && dstFormat == ImageFormat::BGRA) ||
+        (srcFormat == ImageFormat::BGRA && dstFormat == ImageFormat::RGBA))
+    {
+        SwapChannels4(src, dst, 0, idxBegin, idxEnd);
+        return true;
+    }
+
+    if ((srcFormat == ImageFormat::ARGB && dstFormat == ImageFormat::ABGR) ||
+        (srcFormat == ImageFormat::ABGR && dstFormat == ImageFormat::ARGB))
+    {
+        SwapChannels4(src, dst, 1, idxBegin, idxEnd);
+        return true;
+    }
+
+    if ((srcFormat == ImageFormat::RGB || srcFormat == ImageFormat::BGR) &&
+        (dstFormat == ImageFormat::RGBA || dstFormat == ImageFormat::BGRA))
+    {
+        const bool srcIsBGR = (srcFormat == ImageFormat::BGR);
+        const bool dstIsBGR = (dstFormat == ImageFormat::BGRA);
+        ExpandChannels3To4(src, dst, (srcIsBGR != dstIsBGR), idxBegin, idxEnd);
+        return true;
+    }
+
+    if ((srcFormat == ImageFormat::RGBA || srcFormat == ImageFormat::BGRA) &&
+        (dstFormat == ImageFormat::RGB || dstFormat == ImageFormat::BGR))
+    {
+        const bool srcIsBGR = (srcFormat == ImageFormat::BGRA);
+        const bool dstIsBGR = (dstFormat == ImageFormat::BGR);
+        TrimChannels4To3(src, dst, (srcIsBGR != dstIsBGR), idxBegin, idxEnd);
+        return true;
+    }
+
+    return false;
+}
+
+
 /* ----- Internal functions ----- */
 
 // Reads the specified source variant and returns it to the normalized range [0, 1].
@@ -176,6 +444,26 @@ static void ConvertImageBufferDataTypeWorker(
     std::size_t                 idxBegin,
     std::size_t                 idxEnd)
 {
+    /* Route half-float conversions through the batch compressor */
+    if (srcDataType == DataType::Float32 && dstDataType == DataType::Float16)
+    {
+        CompressFloat16(dstBuffer.uint16 + idxBegin, srcBuffer.real32 + idxBegin, idxEnd - idxBegin);
+        return;
+    }
+    if (srcDataType == DataType::Float16 && dstDataType == DataType::Float32)
+    {
+        DecompressFloat16(dstBuffer.real32 + idxBegin, srcBuffer.uint16 + idxBegin, idxEnd - idxBegin);
+        return;
+    }
+
+    #if LLGL_SIMD_SSE2 || LLGL_SIMD_NEON
+    /* Convert the bulk of the range with the vectorized kernels and leave the remainder to the scalar loop */
+    if (srcDataType == DataType::UInt8 && dstDataType == DataType::Float32)
+        idxBegin = ConvertUInt8ToFloat32(srcBuffer.uint8, dstBuffer.real32, idxBegin, idxEnd);
+    else if (srcDataType == DataType::Float32 && dstDataType == DataType::UInt8)
+        idxBegin = ConvertFloat32ToUInt8(srcBuffer.real32, dstBuffer.uint8, idxBegin, idxEnd);
+    #endif
+
     double value = 0.0;
 
     for (auto i = idxBegin; i < idxEnd; ++i)
@@ -188,8 +476,8 @@ static void ConvertImageBufferDataTypeWorker(
     }
 }
 
-// Minimal number of entries each worker thread shall process
-static const std::size_t g_threadMinWorkSize = 64;
+// Minimal number of entries each worker thread shall process; spawning a thread for less work costs more than it saves
+static const std::size_t g_threadMinWorkSize = 4096;
 
 static void ConvertImageBufferDataType(
     DataType    srcDataType,
@@ -436,6 +724,10 @@ static void ConvertImageBufferFormatWorker(
     std::size_t                 idxBegin,
     std::size_t                 idxEnd)
 {
+    /* Try the swizzle kernels for the hot conversion pairs first */
+    if (ConvertImageBufferFormatFastPath(srcFormat, srcDataType, srcBuffer, dstFormat, dstBuffer, idxBegin, idxEnd))
+        return;
+
     /* Get size for source and destination formats */
     auto srcFormatSize  = ImageFormatSize(srcFormat);
     auto dstFormatSize  = ImageFormatSize(dstFormat);
@@ -543,6 +835,470 @@ static void ConvertImageBufferFormat(
 }
 
 
+/* ----- Block compression (BCn) codecs ----- */
+
+// Returns the block size (in bytes) of the specified block-compressed format, or 0 if the format is not block-compressed
+static std::uint32_t GetCompressedBlockSize(const ImageFormat format)
+{
+    switch (format)
+    {
+        case ImageFormat::BC1:  return 8;
+        case ImageFormat::BC2:  return 16;
+        case ImageFormat::BC3:  return 16;
+        case ImageFormat::BC4:  return 8;
+        case ImageFormat::BC5:  return 16;
+        case ImageFormat::BC7:  return 16;
+        default:                return 0;
+    }
+}
+
+// Expands a 5:6:5 packed color to 8 bit per component
+static void DecodeRGB565(std::uint16_t color, std::uint8_t (&rgb)[3])
+{
+    rgb[0] = static_cast<std::uint8_t>(((color >> 11) & 0x1Fu) * 255u / 31u);
+    rgb[1] = static_cast<std::uint8_t>(((color >>  5) & 0x3Fu) * 255u / 63u);
+    rgb[2] = static_cast<std::uint8_t>(( color        & 0x1Fu) * 255u / 31u);
+}
+
+// Packs an 8 bit per component color to 5:6:5
+static std::uint16_t EncodeRGB565(const std::uint8_t* rgb)
+{
+    return static_cast<std::uint16_t>(((rgb[0] >> 3) << 11) | ((rgb[1] >> 2) << 5) | (rgb[2] >> 3));
+}
+
+/*
+Decodes the color portion shared by BC1/BC2/BC3 blocks (8 bytes) into a 4x4 RGBA8 tile.
+BC1 selects the 3-color mode with a transparent 4th entry when color0 <= color1;
+within BC2/BC3 blocks the color portion is always decoded in 4-color mode.
+*/
+static void DecodeBC1ColorBlock(const std::uint8_t* block, std::uint8_t (&tile)[64], bool allowTransparency)
+{
+    /* Read both endpoint colors and expand them to the first two palette entries */
+    auto c0 = static_cast<std::uint16_t>(block[0] | (block[1] << 8));
+    auto c1 = static_cast<std::uint16_t>(block[2] | (block[3] << 8));
+
+    std::uint8_t rgb0[3], rgb1[3];
+    DecodeRGB565(c0, rgb0);
+    DecodeRGB565(c1, rgb1);
+
+    std::uint8_t palette[4][4];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        palette[0][i] = rgb0[i];
+        palette[1][i] = rgb1[i];
+    }
+    palette[0][3] = 255;
+    palette[1][3] = 255;
+
+    /* Derive the interpolated palette entries depending on the block mode */
+    if (c0 > c1 || !allowTransparency)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            palette[2][i] = static_cast<std::uint8_t>((2u * rgb0[i] + rgb1[i]) / 3u);
+            palette[3][i] = static_cast<std::uint8_t>((rgb0[i] + 2u * rgb1[i]) / 3u);
+        }
+        palette[2][3] = 255;
+        palette[3][3] = 255;
+    }
+    else
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            palette[2][i] = static_cast<std::uint8_t>((rgb0[i] + rgb1[i]) / 2u);
+            palette[3][i] = 0;
+        }
+        palette[2][3] = 255;
+        palette[3][3] = 0;
+    }
+
+    /* Resolve the 2-bit palette index of each texel */
+    auto indices = static_cast<std::uint32_t>(block[4]) | (static_cast<std::uint32_t>(block[5]) << 8) |
+                   (static_cast<std::uint32_t>(block[6]) << 16) | (static_cast<std::uint32_t>(block[7]) << 24);
+
+    for (int i = 0; i < 16; ++i)
+        ::memcpy(&tile[i*4], palette[(indices >> (i*2)) & 0x3u], 4);
+}
+
+// Decodes a BC2 block (16 bytes): 64 bits of explicit 4-bit alpha followed by a BC1 color block
+static void DecodeBC2Block(const std::uint8_t* block, std::uint8_t (&tile)[64])
+{
+    DecodeBC1ColorBlock(block + 8, tile, false);
+
+    for (int i = 0; i < 16; ++i)
+    {
+        auto alpha = static_cast<std::uint8_t>((block[i/2] >> ((i % 2)*4)) & 0xFu);
+        tile[i*4 + 3] = static_cast<std::uint8_t>(alpha * 17u); // expand 4 bits to 8 bits (0xF * 17 = 0xFF)
+    }
+}
+
+// Decodes a BC3 block (16 bytes): two alpha endpoints with 48 bits of 3-bit indices followed by a BC1 color block
+static void DecodeBC3Block(const std::uint8_t* block, std::uint8_t (&tile)[64])
+{
+    DecodeBC1ColorBlock(block + 8, tile, false);
+
+    /* Derive the 8-entry alpha palette from both endpoints */
+    const std::uint32_t a0 = block[0];
+    const std::uint32_t a1 = block[1];
+
+    std::uint8_t alphaPalette[8];
+
+    alphaPalette[0] = static_cast<std::uint8_t>(a0);
+    alphaPalette[1] = static_cast<std::uint8_t>(a1);
+
+    if (a0 > a1)
+    {
+        for (std::uint32_t i = 1; i <= 6; ++i)
+            alphaPalette[1 + i] = static_cast<std::uint8_t>(((7u - i)*a0 + i*a1) / 7u);
+    }
+    else
+    {
+        for (std::uint32_t i = 1; i <= 4; ++i)
+            alphaPalette[1 + i] = static_cast<std::uint8_t>(((5u - i)*a0 + i*a1) / 5u);
+        alphaPalette[6] = 0;
+        alphaPalette[7] = 255;
+    }
+
+    /* Resolve the 3-bit alpha palette index of each texel */
+    std::uint64_t indices = 0;
+    for (int i = 0; i < 6; ++i)
+        indices |= (static_cast<std::uint64_t>(block[2 + i]) << (i*8));
+
+    for (int i = 0; i < 16; ++i)
+        tile[i*4 + 3] = alphaPalette[(indices >> (i*3)) & 0x7u];
+}
+
+// Encodes a 4x4 RGBA8 tile into a BC1 block (8 bytes) with a fast color bounding-box endpoint fit; alpha is ignored
+static void EncodeBC1Block(const std::uint8_t (&tile)[64], std::uint8_t* block)
+{
+    /* Determine the color bounding box of the tile as palette endpoints */
+    std::uint8_t minColor[3] = { 255, 255, 255 };
+    std::uint8_t maxColor[3] = {   0,   0,   0 };
+
+    for (int i = 0; i < 16; ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            minColor[c] = std::min(minColor[c], tile[i*4 + c]);
+            maxColor[c] = std::max(maxColor[c], tile[i*4 + c]);
+        }
+    }
+
+    auto c0 = EncodeRGB565(maxColor);
+    auto c1 = EncodeRGB565(minColor);
+
+    /* Keep color0 > color1 to stay in the opaque 4-color mode */
+    if (c0 < c1)
+        std::swap(c0, c1);
+
+    block[0] = static_cast<std::uint8_t>(c0 & 0xFF);
+    block[1] = static_cast<std::uint8_t>(c0 >> 8);
+    block[2] = static_cast<std::uint8_t>(c1 & 0xFF);
+    block[3] = static_cast<std::uint8_t>(c1 >> 8);
+
+    if (c0 == c1)
+    {
+        /* Solid color block: all texels select the first palette entry */
+        block[4] = block[5] = block[6] = block[7] = 0;
+        return;
+    }
+
+    /* Reconstruct the quantized palette the decoder will see */
+    std::uint8_t rgb0[3], rgb1[3];
+    DecodeRGB565(c0, rgb0);
+    DecodeRGB565(c1, rgb1);
+
+    std::uint8_t palette[4][3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        palette[0][i] = rgb0[i];
+        palette[1][i] = rgb1[i];
+        palette[2][i] = static_cast<std::uint8_t>((2u * rgb0[i] + rgb1[i]) / 3u);
+        palette[3][i] = static_cast<std::uint8_t>((rgb0[i] + 2u * rgb1[i]) / 3u);
+    }
+
+    /* Map each texel to the nearest palette entry by squared distance */
+    std::uint32_t indices = 0;
+
+    for (int i = 0; i < 16; ++i)
+    {
+        std::uint32_t bestIndex = 0;
+        std::uint32_t bestDist  = ~0u;
+
+        for (std::uint32_t j = 0; j < 4; ++j)
+        {
+            std::uint32_t dist = 0;
+            for (int c = 0; c < 3; ++c)
+            {
+                auto diff = static_cast<std::int32_t>(tile[i*4 + c]) - static_cast<std::int32_t>(palette[j][c]);
+                dist += static_cast<std::uint32_t>(diff * diff);
+            }
+            if (dist < bestDist)
+            {
+                bestDist  = dist;
+                bestIndex = j;
+            }
+        }
+
+        indices |= (bestIndex << (i*2));
+    }
+
+    block[4] = static_cast<std::uint8_t>( indices        & 0xFF);
+    block[5] = static_cast<std::uint8_t>((indices >>  8) & 0xFF);
+    block[6] = static_cast<std::uint8_t>((indices >> 16) & 0xFF);
+    block[7] = static_cast<std::uint8_t>((indices >> 24) & 0xFF);
+}
+
+// Copies the 4x4 tile at the specified block origin from the RGBA8 image and replicates the border texels for partial blocks
+static void LoadRGBA8Tile(
+    const std::uint8_t* image,
+    std::uint32_t       width,
+    std::uint32_t       height,
+    std::uint32_t       x0,
+    std::uint32_t       y0,
+    std::uint8_t        (&tile)[64])
+{
+    for (std::uint32_t y = 0; y < 4; ++y)
+    {
+        const auto yc = std::min(y0 + y, height - 1);
+        for (std::uint32_t x = 0; x < 4; ++x)
+        {
+            const auto xc = std::min(x0 + x, width - 1);
+            ::memcpy(&tile[(y*4 + x)*4], &image[(yc*width + xc)*4], 4);
+        }
+    }
+}
+
+// Copies the 4x4 tile to the specified block origin in the RGBA8 image and clips texels outside the image for partial blocks
+static void StoreRGBA8Tile(
+    std::uint8_t*       image,
+    std::uint32_t       width,
+    std::uint32_t       height,
+    std::uint32_t       x0,
+    std::uint32_t       y0,
+    const std::uint8_t  (&tile)[64])
+{
+    for (std::uint32_t y = 0; y < 4 && y0 + y < height; ++y)
+    {
+        for (std::uint32_t x = 0; x < 4 && x0 + x < width; ++x)
+            ::memcpy(&image[((y0 + y)*width + (x0 + x))*4], &tile[(y*4 + x)*4], 4);
+    }
+}
+
+// Worker thread procedure for the "DecodeCompressedImageBuffer" function; decodes the block range [blockBegin, blockEnd)
+static void DecodeCompressedImageBufferWorker(
+    ImageFormat         srcFormat,
+    const std::uint8_t* srcBlocks,
+    std::uint8_t*       dstImage,
+    std::uint32_t       width,
+    std::uint32_t       height,
+    std::size_t         blockBegin,
+    std::size_t         blockEnd)
+{
+    const auto blockSize        = GetCompressedBlockSize(srcFormat);
+    const auto numBlocksX       = (width  + 3) / 4;
+    const auto numBlocksY       = (height + 3) / 4;
+    const auto blocksPerSlice   = static_cast<std::size_t>(numBlocksX) * numBlocksY;
+    const auto slicePixels      = static_cast<std::size_t>(width) * height;
+
+    std::uint8_t tile[64];
+
+    for (auto block = blockBegin; block < blockEnd; ++block)
+    {
+        /* Decompress the next block into the local tile */
+        const auto* src = srcBlocks + block * blockSize;
+
+        switch (srcFormat)
+        {
+            case ImageFormat::BC1:
+                DecodeBC1ColorBlock(src, tile, true);
+                break;
+            case ImageFormat::BC2:
+                DecodeBC2Block(src, tile);
+                break;
+            case ImageFormat::BC3:
+                DecodeBC3Block(src, tile);
+                break;
+            default:
+                return;
+        }
+
+        /* Scatter the tile into its destination slice */
+        const auto sliceIndex   = block / blocksPerSlice;
+        const auto sliceBlock   = block % blocksPerSlice;
+
+        StoreRGBA8Tile(
+            dstImage + sliceIndex * slicePixels * 4,
+            width,
+            height,
+            static_cast<std::uint32_t>(sliceBlock % numBlocksX) * 4,
+            static_cast<std::uint32_t>(sliceBlock / numBlocksX) * 4,
+            tile
+        );
+    }
+}
+
+// Worker thread procedure for the "EncodeBC1ImageBuffer" function; encodes the block range [blockBegin, blockEnd)
+static void EncodeBC1ImageBufferWorker(
+    const std::uint8_t* srcImage,
+    std::uint8_t*       dstBlocks,
+    std::uint32_t       width,
+    std::uint32_t       height,
+    std::size_t         blockBegin,
+    std::size_t         blockEnd)
+{
+    const auto numBlocksX       = (width  + 3) / 4;
+    const auto numBlocksY       = (height + 3) / 4;
+    const auto blocksPerSlice   = static_cast<std::size_t>(numBlocksX) * numBlocksY;
+    const auto slicePixels      = static_cast<std::size_t>(width) * height;
+
+    std::uint8_t tile[64];
+
+    for (auto block = blockBegin; block < blockEnd; ++block)
+    {
+        /* Gather the tile from its source slice */
+        const auto sliceIndex   = block / blocksPerSlice;
+        const auto sliceBlock   = block % blocksPerSlice;
+
+        LoadRGBA8Tile(
+            srcImage + sliceIndex * slicePixels * 4,
+            width,
+            height,
+            static_cast<std::uint32_t>(sliceBlock % numBlocksX) * 4,
+            static_cast<std::uint32_t>(sliceBlock / numBlocksX) * 4,
+            tile
+        );
+
+        /* Compress the tile into the next block */
+        EncodeBC1Block(tile, dstBlocks + block * 8);
+    }
+}
+
+// Returns the total number of 4x4 blocks for the specified extent; depth slices are compressed independently
+static std::size_t GetNumCompressedBlocks(const Extent3D& extent)
+{
+    const auto numBlocksX = (extent.width  + 3) / 4;
+    const auto numBlocksY = (extent.height + 3) / 4;
+    return (static_cast<std::size_t>(numBlocksX) * numBlocksY * extent.depth);
+}
+
+// Generic worker split over compressed blocks; shared by the decoding and encoding pass
+template <typename TWorker>
+void ProcessCompressedBlocksMultiThreaded(std::size_t numBlocks, std::size_t threadCount, const TWorker& worker)
+{
+    /* Each block covers 16 texels, so scale the per-thread minimum accordingly */
+    threadCount = std::min(threadCount, (numBlocks * 16) / g_threadMinWorkSize);
+
+    if (threadCount > 1)
+    {
+        /* Create worker threads */
+        std::vector<std::thread> workers(threadCount);
+
+        auto workSize       = numBlocks / threadCount;
+        auto workSizeRemain = numBlocks % threadCount;
+
+        std::size_t offset = 0;
+
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            workers[i] = std::thread(worker, offset, offset + workSize);
+            offset += workSize;
+        }
+
+        /* Execute conversion of remaining work on main thread */
+        if (workSizeRemain > 0)
+            worker(offset, offset + workSizeRemain);
+
+        /* Join worker threads */
+        for (auto& w : workers)
+            w.join();
+    }
+    else
+    {
+        /* Execute conversion only on main thread */
+        worker(0, numBlocks);
+    }
+}
+
+// Decodes the block-compressed source image into a new RGBA8 image buffer of the specified extent
+static ByteBuffer DecodeCompressedImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    const Extent3D&             extent,
+    std::size_t                 threadCount)
+{
+    if (srcImageDesc.format != ImageFormat::BC1 && srcImageDesc.format != ImageFormat::BC2 && srcImageDesc.format != ImageFormat::BC3)
+        throw std::invalid_argument("compressed image format decoding is only supported for BC1, BC2, and BC3");
+    if (srcImageDesc.dataType != DataType::UInt8)
+        throw std::invalid_argument("compressed image data must have data type UInt8");
+
+    /* Validate source buffer size against the block layout */
+    const auto numBlocks = GetNumCompressedBlocks(extent);
+
+    if (srcImageDesc.dataSize < numBlocks * GetCompressedBlockSize(srcImageDesc.format))
+        throw std::invalid_argument("source image data size does not match the block layout of the compressed image format");
+
+    /* Allocate destination RGBA8 image and decode all blocks */
+    const auto numPixels    = static_cast<std::size_t>(extent.width) * extent.height * extent.depth;
+    auto dstImage           = MakeUniqueArray<char>(numPixels * 4);
+
+    auto srcBlocks  = reinterpret_cast<const std::uint8_t*>(srcImageDesc.data);
+    auto dstPixels  = reinterpret_cast<std::uint8_t*>(dstImage.get());
+
+    ProcessCompressedBlocksMultiThreaded(
+        numBlocks,
+        threadCount,
+        [&](std::size_t blockBegin, std::size_t blockEnd)
+        {
+            DecodeCompressedImageBufferWorker(
+                srcImageDesc.format,
+                srcBlocks,
+                dstPixels,
+                extent.width,
+                extent.height,
+                blockBegin,
+                blockEnd
+            );
+        }
+    );
+
+    return dstImage;
+}
+
+// Encodes the RGBA8 source image of the specified extent into a new BC1 block buffer
+static ByteBuffer EncodeBC1ImageBuffer(
+    const void*     srcImage,
+    const Extent3D& extent,
+    std::size_t     threadCount)
+{
+    /* Allocate destination block buffer and encode all blocks */
+    const auto numBlocks    = GetNumCompressedBlocks(extent);
+    auto dstImage           = MakeUniqueArray<char>(numBlocks * 8);
+
+    auto srcPixels  = reinterpret_cast<const std::uint8_t*>(srcImage);
+    auto dstBlocks  = reinterpret_cast<std::uint8_t*>(dstImage.get());
+
+    ProcessCompressedBlocksMultiThreaded(
+        numBlocks,
+        threadCount,
+        [&](std::size_t blockBegin, std::size_t blockEnd)
+        {
+            EncodeBC1ImageBufferWorker(
+                srcPixels,
+                dstBlocks,
+                extent.width,
+                extent.height,
+                blockBegin,
+                blockEnd
+            );
+        }
+    );
+
+    return dstImage;
+}
+
+
 /* ----- Public functions ----- */
 
 LLGL_EXPORT std::uint32_t ImageFormatSize(const ImageFormat imageFormat)
@@ -565,6 +1321,7 @@ LLGL_EXPORT std::uint32_t ImageFormatSize(const ImageFormat imageFormat)
         case ImageFormat::BC3:              return 0; // no conversion supported yet
         case ImageFormat::BC4:              return 0; // no conversion supported yet
         case ImageFormat::BC5:              return 0; // no conversion supported yet
+        case ImageFormat::BC7:              return 0; // no conversion supported yet
     }
     return 0;
 }
@@ -576,7 +1333,7 @@ LLGL_EXPORT std::uint32_t ImageDataSize(const ImageFormat imageFormat, const Dat
 
 LLGL_EXPORT bool IsCompressedFormat(const ImageFormat imageFormat)
 {
-    return (imageFormat >= ImageFormat::BC1 && imageFormat <= ImageFormat::BC5);
+    return (imageFormat >= ImageFormat::BC1 && imageFormat <= ImageFormat::BC7);
 }
 
 LLGL_EXPORT bool IsDepthStencilFormat(const ImageFormat imageFormat)
@@ -612,9 +1369,9 @@ LLGL_EXPORT bool ConvertImageBuffer(
 
     if (srcImageDesc.dataType != dstImageDesc.dataType && srcImageDesc.format != dstImageDesc.format)
     {
-        /* Convert image data type with intermediate buffer */
+        /* Convert image data type with pooled intermediate buffer */
         auto intermediateBufferSize = srcImageDesc.dataSize / DataTypeSize(srcImageDesc.dataType) * DataTypeSize(dstImageDesc.dataType);
-        auto intermediateBuffer     = MakeUniqueArray<char>(intermediateBufferSize);
+        auto intermediateBuffer     = ByteBufferPool::Get().Alloc(intermediateBufferSize);
 
         ConvertImageBufferDataType(
             srcImageDesc.dataType,
@@ -638,6 +1395,8 @@ LLGL_EXPORT bool ConvertImageBuffer(
         /* Convert image format */
         ConvertImageBufferFormat(intermediateImageDesc, dstImageDesc, threadCount);
 
+        ByteBufferPool::Get().Recycle(std::move(intermediateBuffer), intermediateBufferSize);
+
         return true;
     }
     else if (srcImageDesc.dataType != dstImageDesc.dataType)
@@ -691,9 +1450,9 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     {
         auto dstImage = MakeUniqueArray<char>(dstImageDesc.dataSize);
         {
-            /* Convert image data type with intermediate buffer */
+            /* Convert image data type with pooled intermediate buffer */
             auto intermediateBufferSize = srcImageDesc.dataSize / DataTypeSize(srcImageDesc.dataType) * DataTypeSize(dstDataType);
-            auto intermediateBuffer     = MakeUniqueArray<char>(intermediateBufferSize);
+            auto intermediateBuffer     = ByteBufferPool::Get().Alloc(intermediateBufferSize);
 
             ConvertImageBufferDataType(
                 srcImageDesc.dataType,
@@ -717,6 +1476,8 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
             /* Convert image format */
             dstImageDesc.data = dstImage.get();
             ConvertImageBufferFormat(intermediateImageDesc, dstImageDesc, threadCount);
+
+            ByteBufferPool::Get().Recycle(std::move(intermediateBuffer), intermediateBufferSize);
         }
         return dstImage;
     }
@@ -752,6 +1513,62 @@ LLGL_EXPORT ByteBuffer ConvertImageBuffer(
     return nullptr;
 }
 
+LLGL_EXPORT ByteBuffer ConvertImageBuffer(
+    const SrcImageDescriptor&   srcImageDesc,
+    const Extent3D&             extent,
+    ImageFormat                 dstFormat,
+    DataType                    dstDataType,
+    std::size_t                 threadCount)
+{
+    /* Forward to the flat conversion path when no compressed format is involved */
+    if (!IsCompressedFormat(srcImageDesc.format) && !IsCompressedFormat(dstFormat))
+        return ConvertImageBuffer(srcImageDesc, dstFormat, dstDataType, threadCount);
+
+    /* Validate input parameters */
+    LLGL_ASSERT_PTR(srcImageDesc.data);
+
+    if (IsDepthStencilFormat(srcImageDesc.format) || IsDepthStencilFormat(dstFormat))
+        throw std::invalid_argument("cannot convert depth-stencil image formats");
+    if (IsCompressedFormat(dstFormat) && dstDataType != DataType::UInt8)
+        throw std::invalid_argument("compressed image data must have data type UInt8");
+
+    if (threadCount >= Constants::maxThreadCount)
+        threadCount = std::thread::hardware_concurrency();
+
+    const auto numPixels = static_cast<std::size_t>(extent.width) * extent.height * extent.depth;
+
+    /* Decode a compressed source into an intermediate RGBA8 image; the decoding pass throws for unsupported codecs */
+    ByteBuffer intermediateImage;
+    SrcImageDescriptor rgbaImageDesc = srcImageDesc;
+
+    if (IsCompressedFormat(srcImageDesc.format))
+    {
+        intermediateImage   = DecodeCompressedImageBuffer(srcImageDesc, extent, threadCount);
+        rgbaImageDesc       = SrcImageDescriptor { ImageFormat::RGBA, DataType::UInt8, intermediateImage.get(), numPixels * 4 };
+    }
+
+    if (IsCompressedFormat(dstFormat))
+    {
+        if (dstFormat != ImageFormat::BC1)
+            throw std::invalid_argument("compressed image format encoding is only supported for BC1");
+
+        /* The encoder consumes RGBA8 texels, so convert an uncompressed source into that layout first */
+        if (rgbaImageDesc.format != ImageFormat::RGBA || rgbaImageDesc.dataType != DataType::UInt8)
+        {
+            intermediateImage   = ConvertImageBuffer(rgbaImageDesc, ImageFormat::RGBA, DataType::UInt8, threadCount);
+            rgbaImageDesc       = SrcImageDescriptor { ImageFormat::RGBA, DataType::UInt8, intermediateImage.get(), numPixels * 4 };
+        }
+
+        return EncodeBC1ImageBuffer(rgbaImageDesc.data, extent, threadCount);
+    }
+
+    /* Convert the decoded RGBA8 image into the requested destination layout */
+    if (dstFormat == ImageFormat::RGBA && dstDataType == DataType::UInt8)
+        return intermediateImage;
+
+    return ConvertImageBuffer(rgbaImageDesc, dstFormat, dstDataType, threadCount);
+}
+
 LLGL_EXPORT ByteBuffer GenerateImageBuffer(
     ImageFormat         format,
     DataType            dataType,
@@ -0,0 +1,45 @@
+/*
+ * Instrumentation.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/Instrumentation.h>
+
+
+namespace LLGL
+{
+
+namespace Instrumentation
+{
+
+
+struct EventCallbackState
+{
+    EventCallback   callback;
+    void*           userData    = nullptr;
+};
+
+static EventCallbackState g_eventCallbackState;
+
+LLGL_EXPORT void SetEventCallback(const EventCallback& callback, void* userData)
+{
+    g_eventCallbackState.callback = callback;
+    g_eventCallbackState.userData = userData;
+}
+
+LLGL_EXPORT void PostEvent(EventType event, const char* info, std::uint64_t value)
+{
+    if (g_eventCallbackState.callback)
+        g_eventCallbackState.callback(event, info, value, g_eventCallbackState.userData);
+}
+
+
+} // /namespace Instrumentation
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -12,6 +12,7 @@
 #include <LLGL/Input.h>
 #include <LLGL/Timer.h>
 #include <LLGL/Display.h>
+#include <LLGL/MappedFile.h>
 
 
 namespace LLGL
@@ -40,9 +41,11 @@ LLGL_IMPLEMENT_INTERFACE( Canvas,                   Surface                 )
 LLGL_IMPLEMENT_INTERFACE( Canvas::EventListener,    Interface               )
 LLGL_IMPLEMENT_INTERFACE( Timer,                    Interface               )
 LLGL_IMPLEMENT_INTERFACE( Display,                  Interface               )
+LLGL_IMPLEMENT_INTERFACE( MappedFile,               Interface               )
 LLGL_IMPLEMENT_INTERFACE( ResourceHeap,             RenderSystemChild       )
 LLGL_IMPLEMENT_INTERFACE( Resource,                 RenderSystemChild       )
 LLGL_IMPLEMENT_INTERFACE( Texture,                  Resource                )
+LLGL_IMPLEMENT_INTERFACE( TextureReadback,          RenderSystemChild       )
 LLGL_IMPLEMENT_INTERFACE( Buffer,                   Resource                )
 LLGL_IMPLEMENT_INTERFACE( Sampler,                  Resource                )
 LLGL_IMPLEMENT_INTERFACE( CommandBuffer,            RenderSystemChild       )
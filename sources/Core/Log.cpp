@@ -1,12 +1,18 @@
 /*
  * Log.cpp
- * 
+ *
  * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
  * See "LICENSE.txt" for license information.
  */
 
 #include <LLGL/Log.h>
+#include "Helper.h"
 #include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <cstdint>
 
 
 namespace LLGL
@@ -16,44 +22,209 @@ namespace Log
 {
 
 
+/* ----- AsyncReportQueue class ----- */
+
+/*
+Bounded lock-free multi-producer/single-consumer queue for report records.
+Each slot carries a sequence number that tells whether it is ready to be written or read,
+so producers never block each other or the consumer; a full queue rejects the record instead.
+*/
+class AsyncReportQueue
+{
+
+    public:
+
+        struct Record
+        {
+            ReportType  type        = ReportType::Information;
+            std::string message;
+            std::string contextInfo;
+        };
+
+        AsyncReportQueue(std::size_t capacity)
+        {
+            /* Round capacity up to a power of two, so the slot index can be computed with a bitmask */
+            std::size_t capacityPow2 = 1;
+            while (capacityPow2 < capacity)
+                capacityPow2 <<= 1;
+
+            slots_ = std::vector<Slot>(capacityPow2);
+            mask_ = capacityPow2 - 1;
+
+            for (std::size_t i = 0; i < capacityPow2; ++i)
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        // Enqueues the specified record; returns false if the queue is full. This may be called by multiple threads.
+        bool TryEnqueue(Record&& record)
+        {
+            auto pos = head_.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                auto& slot = slots_[pos & mask_];
+                auto seq = slot.sequence.load(std::memory_order_acquire);
+                auto diff = (static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos));
+
+                if (diff == 0)
+                {
+                    /* Slot is free => try to claim it */
+                    if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        slot.record = std::move(record);
+                        slot.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    /* Slot still holds an unconsumed record => queue is full */
+                    return false;
+                }
+                else
+                {
+                    /* Slot was claimed by another producer => reload position */
+                    pos = head_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Dequeues the next record; returns false if the queue is empty. This must only be called by the writer thread.
+        bool TryDequeue(Record& record)
+        {
+            auto pos = tail_.load(std::memory_order_relaxed);
+
+            auto& slot = slots_[pos & mask_];
+            auto seq = slot.sequence.load(std::memory_order_acquire);
+
+            if (static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1) < 0)
+                return false;
+
+            record = std::move(slot.record);
+            slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+            tail_.store(pos + 1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+    private:
+
+        struct Slot
+        {
+            std::atomic<std::size_t>    sequence { 0 };
+            Record                      record;
+        };
+
+        std::vector<Slot>           slots_;
+        std::size_t                 mask_   = 0;
+        std::atomic<std::size_t>    head_   { 0 };
+        std::atomic<std::size_t>    tail_   { 0 };
+
+};
+
+
+/* ----- Internal structures ----- */
+
 struct LogState
 {
-    std::mutex      reportMutex;
-    ReportCallback  reportCallback  = nullptr;
-    std::ostream*   outputStream    = nullptr;
-    void*           userData        = nullptr;
-    std::size_t     limit           = 0;
-    std::size_t     counter         = 0;
+    std::mutex                          reportMutex;
+    ReportCallback                      reportCallback  = nullptr;
+    std::ostream*                       outputStream    = nullptr;
+    void*                               userData        = nullptr;
+    std::atomic<std::size_t>            limit           { 0 };
+    std::atomic<std::size_t>            counter         { 0 };
+
+    std::atomic<bool>                   asyncEnabled    { false };
+    std::unique_ptr<AsyncReportQueue>   asyncQueue;
+    std::thread                         asyncThread;
+    std::atomic<bool>                   asyncQuit       { false };
+    std::atomic<std::size_t>            numDropped      { 0 };
 };
 
 static LogState g_logState;
 
 
-/* ----- Functions ----- */
+/* ----- Internal functions ----- */
 
-LLGL_EXPORT void PostReport(ReportType type, const std::string& message, const std::string& contextInfo)
+static void InvokeReportCallback(const AsyncReportQueue::Record& record)
 {
     ReportCallback  callback;
-    void*           userData    = nullptr;
-    bool            ignore      = false;
+    void*           userData = nullptr;
 
     /* Get callback and user data with a lock guard */
     {
         std::lock_guard<std::mutex> guard { g_logState.reportMutex };
-
-        /* Get callback and user data */
         callback = g_logState.reportCallback;
         userData = g_logState.userData;
+    }
+
+    if (callback != nullptr)
+        callback(record.type, record.message, record.contextInfo, userData);
+}
+
+// Drains the asynchronous report queue until the quit flag is set and no pending records remain
+static void AsyncWriterThreadFunc()
+{
+    AsyncReportQueue::Record record;
 
-        /* Increase report counter and check if the report must be ignored */
-        g_logState.counter++;
-        if (g_logState.limit > 0 && g_logState.counter > g_logState.limit)
-            ignore = true;
+    for (;;)
+    {
+        if (g_logState.asyncQueue->TryDequeue(record))
+            InvokeReportCallback(record);
+        else if (g_logState.asyncQuit.load(std::memory_order_acquire))
+            break;
+        else
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
+}
+
+
+/* ----- Functions ----- */
+
+LLGL_EXPORT void PostReport(ReportType type, const std::string& message, const std::string& contextInfo)
+{
+    if (g_logState.asyncEnabled.load(std::memory_order_acquire))
+    {
+        /* Increase report counter and check if the report must be ignored; no lock, to keep the posting threads wait-free */
+        auto counter    = g_logState.counter.fetch_add(1, std::memory_order_relaxed) + 1;
+        auto limit      = g_logState.limit.load(std::memory_order_relaxed);
+        if (limit > 0 && counter > limit)
+            return;
+
+        /* Enqueue record for the writer thread; drop and count the report if the queue is full */
+        AsyncReportQueue::Record record;
+        {
+            record.type         = type;
+            record.message      = message;
+            record.contextInfo  = contextInfo;
+        }
+        if (!g_logState.asyncQueue->TryEnqueue(std::move(record)))
+            g_logState.numDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        ReportCallback  callback;
+        void*           userData    = nullptr;
+        bool            ignore      = false;
 
-    /* Post report to callback */
-    if (!ignore && callback != nullptr)
-        callback(type, message, contextInfo, userData);
+        /* Get callback and user data with a lock guard */
+        {
+            std::lock_guard<std::mutex> guard { g_logState.reportMutex };
+
+            /* Get callback and user data */
+            callback = g_logState.reportCallback;
+            userData = g_logState.userData;
+
+            /* Increase report counter and check if the report must be ignored */
+            g_logState.counter++;
+            if (g_logState.limit > 0 && g_logState.counter > g_logState.limit)
+                ignore = true;
+        }
+
+        /* Post report to callback */
+        if (!ignore && callback != nullptr)
+            callback(type, message, contextInfo, userData);
+    }
 }
 
 LLGL_EXPORT void SetReportCallback(const ReportCallback& callback, void* userData)
@@ -78,8 +249,38 @@ LLGL_EXPORT void SetReportCallbackStd(std::ostream& stream)
 
 LLGL_EXPORT void SetReportLimit(std::size_t maxCount)
 {
-    std::lock_guard<std::mutex> guard { g_logState.reportMutex };
-    g_logState.limit = maxCount;
+    g_logState.limit.store(maxCount, std::memory_order_relaxed);
+}
+
+LLGL_EXPORT void SetAsyncReportEnabled(bool enabled, std::size_t queueSize)
+{
+    if (enabled)
+    {
+        if (!g_logState.asyncEnabled.load(std::memory_order_relaxed))
+        {
+            /* Create report queue and start writer thread before producers may enqueue records */
+            g_logState.asyncQueue   = MakeUnique<AsyncReportQueue>(queueSize);
+            g_logState.asyncQuit.store(false, std::memory_order_relaxed);
+            g_logState.asyncThread  = std::thread(AsyncWriterThreadFunc);
+            g_logState.asyncEnabled.store(true, std::memory_order_release);
+        }
+    }
+    else
+    {
+        if (g_logState.asyncEnabled.load(std::memory_order_relaxed))
+        {
+            /* Stop producers first, then let the writer thread drain all pending records */
+            g_logState.asyncEnabled.store(false, std::memory_order_release);
+            g_logState.asyncQuit.store(true, std::memory_order_release);
+            g_logState.asyncThread.join();
+            g_logState.asyncQueue.reset();
+        }
+    }
+}
+
+LLGL_EXPORT std::size_t GetNumDroppedReports()
+{
+    return g_logState.numDropped.load(std::memory_order_relaxed);
 }
 
 
@@ -0,0 +1,314 @@
+/*
+ * SmallVector.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SMALL_VECTOR_H
+#define LLGL_SMALL_VECTOR_H
+
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <initializer_list>
+
+
+namespace LLGL
+{
+
+
+/*
+Small-size-optimized replacement for std::vector in hot paths.
+The first 'LocalCapacity' elements live in an inline buffer, so short-lived arrays
+(viewport conversions, clear attachments, descriptor pool sizes etc.) never touch the heap.
+Only grows to a heap allocation when the inline capacity is exceeded.
+*/
+template <typename T, std::size_t LocalCapacity = 16>
+class SmallVector
+{
+
+    public:
+
+        using value_type        = T;
+        using size_type         = std::size_t;
+        using iterator          = T*;
+        using const_iterator    = const T*;
+
+    public:
+
+        SmallVector() = default;
+
+        explicit SmallVector(size_type count)
+        {
+            resize(count);
+        }
+
+        SmallVector(size_type count, const T& value)
+        {
+            resize(count, value);
+        }
+
+        SmallVector(std::initializer_list<T> list)
+        {
+            reserve(list.size());
+            for (const auto& entry : list)
+                push_back(entry);
+        }
+
+        SmallVector(const SmallVector& rhs)
+        {
+            reserve(rhs.size_);
+            for (size_type i = 0; i < rhs.size_; ++i)
+                push_back(rhs.data_[i]);
+        }
+
+        SmallVector(SmallVector&& rhs)
+        {
+            operator = (std::move(rhs));
+        }
+
+        ~SmallVector()
+        {
+            clear();
+            ReleaseHeap();
+        }
+
+        SmallVector& operator = (const SmallVector& rhs)
+        {
+            if (&rhs != this)
+            {
+                clear();
+                reserve(rhs.size_);
+                for (size_type i = 0; i < rhs.size_; ++i)
+                    push_back(rhs.data_[i]);
+            }
+            return *this;
+        }
+
+        SmallVector& operator = (SmallVector&& rhs)
+        {
+            if (&rhs != this)
+            {
+                clear();
+                if (rhs.data_ != rhs.LocalData())
+                {
+                    /* Adopt heap allocation of source vector */
+                    ReleaseHeap();
+                    data_       = rhs.data_;
+                    capacity_   = rhs.capacity_;
+                    size_       = rhs.size_;
+                }
+                else
+                {
+                    /* Move elements out of inline buffer of source vector */
+                    reserve(rhs.size_);
+                    for (size_type i = 0; i < rhs.size_; ++i)
+                        push_back(std::move(rhs.data_[i]));
+                    rhs.clear();
+                }
+                rhs.data_       = rhs.LocalData();
+                rhs.capacity_   = LocalCapacity;
+                rhs.size_       = 0;
+            }
+            return *this;
+        }
+
+        void push_back(const T& value)
+        {
+            emplace_back(value);
+        }
+
+        void push_back(T&& value)
+        {
+            emplace_back(std::move(value));
+        }
+
+        template <typename... Args>
+        void emplace_back(Args&&... args)
+        {
+            if (size_ == capacity_)
+                Grow(capacity_ * 2);
+            ::new (data_ + size_) T(std::forward<Args>(args)...);
+            ++size_;
+        }
+
+        void pop_back()
+        {
+            --size_;
+            data_[size_].~T();
+        }
+
+        void clear()
+        {
+            for (size_type i = 0; i < size_; ++i)
+                data_[i].~T();
+            size_ = 0;
+        }
+
+        void reserve(size_type capacity)
+        {
+            if (capacity > capacity_)
+                Grow(capacity);
+        }
+
+        void resize(size_type size)
+        {
+            resize(size, T{});
+        }
+
+        void resize(size_type size, const T& value)
+        {
+            reserve(size);
+            while (size_ > size)
+                pop_back();
+            while (size_ < size)
+                push_back(value);
+        }
+
+        iterator erase(iterator first, iterator last)
+        {
+            if (first != last)
+            {
+                /* Shift successors down and destroy the vacated tail elements */
+                auto newEnd = std::move(last, end(), first);
+                while (end() != newEnd)
+                    pop_back();
+            }
+            return first;
+        }
+
+        // Accessors
+
+        inline bool empty() const
+        {
+            return (size_ == 0);
+        }
+
+        inline size_type size() const
+        {
+            return size_;
+        }
+
+        inline size_type capacity() const
+        {
+            return capacity_;
+        }
+
+        inline T* data()
+        {
+            return data_;
+        }
+
+        inline const T* data() const
+        {
+            return data_;
+        }
+
+        inline T& operator [] (size_type index)
+        {
+            return data_[index];
+        }
+
+        inline const T& operator [] (size_type index) const
+        {
+            return data_[index];
+        }
+
+        inline T& front()
+        {
+            return data_[0];
+        }
+
+        inline const T& front() const
+        {
+            return data_[0];
+        }
+
+        inline T& back()
+        {
+            return data_[size_ - 1];
+        }
+
+        inline const T& back() const
+        {
+            return data_[size_ - 1];
+        }
+
+        inline iterator begin()
+        {
+            return data_;
+        }
+
+        inline const_iterator begin() const
+        {
+            return data_;
+        }
+
+        inline iterator end()
+        {
+            return (data_ + size_);
+        }
+
+        inline const_iterator end() const
+        {
+            return (data_ + size_);
+        }
+
+    private:
+
+        // Returns the pointer to the inline element buffer.
+        inline T* LocalData()
+        {
+            return reinterpret_cast<T*>(localBuffer_);
+        }
+
+        // Moves all elements into a heap allocation of at least the specified capacity.
+        void Grow(size_type capacity)
+        {
+            capacity = std::max<size_type>(capacity, LocalCapacity);
+            if (capacity > capacity_)
+            {
+                auto newData = reinterpret_cast<T*>(::operator new (sizeof(T) * capacity));
+
+                for (size_type i = 0; i < size_; ++i)
+                {
+                    ::new (newData + i) T(std::move(data_[i]));
+                    data_[i].~T();
+                }
+
+                ReleaseHeap();
+                data_       = newData;
+                capacity_   = capacity;
+            }
+        }
+
+        // Frees the heap allocation (if any); does not destroy elements.
+        void ReleaseHeap()
+        {
+            if (data_ != LocalData())
+                ::operator delete (data_);
+        }
+
+    private:
+
+        alignas(alignof(T)) std::uint8_t    localBuffer_[sizeof(T) * LocalCapacity];
+
+        T*                                  data_       = LocalData();
+        size_type                           capacity_   = LocalCapacity;
+        size_type                           size_       = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
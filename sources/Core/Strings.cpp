@@ -25,6 +25,8 @@ LLGL_EXPORT const char* ToString(const ShaderType t)
         case T::Geometry:       return "geometry";
         case T::Fragment:       return "fragment";
         case T::Compute:        return "compute";
+        case T::Task:           return "task";
+        case T::Mesh:           return "mesh";
     }
 
     return nullptr;
@@ -226,6 +228,8 @@ LLGL_EXPORT const char* ToString(const Format t)
         case T::BC4SNorm:           return "BC4SNorm";
         case T::BC5UNorm:           return "BC5UNorm";
         case T::BC5SNorm:           return "BC5SNorm";
+        case T::BC7UNorm:           return "BC7UNorm";
+        case T::BC7UNorm_sRGB:      return "BC7UNorm_sRGB";
     }
 
     return nullptr;
@@ -0,0 +1,80 @@
+/*
+ * ThreadPool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max<std::size_t>(1u, std::thread::hardware_concurrency());
+
+    workers_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        workers_.emplace_back(std::thread { &ThreadPool::WorkerLoop, this });
+}
+
+ThreadPool::~ThreadPool()
+{
+    /* Notify all worker threads to terminate after the remaining tasks are processed */
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        terminate_ = true;
+    }
+    var_.notify_all();
+
+    for (auto& worker : workers_)
+        worker.join();
+}
+
+void ThreadPool::Enqueue(std::function<void()>&& task)
+{
+    {
+        std::lock_guard<std::mutex> guard { mutex_ };
+        tasks_.push(std::move(task));
+    }
+    var_.notify_one();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void ThreadPool::WorkerLoop()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+
+        /* Wait until either a new task was enqueued or the pool is terminated */
+        {
+            std::unique_lock<std::mutex> lock { mutex_ };
+            var_.wait(lock, [this]{ return (terminate_ || !tasks_.empty()); });
+
+            if (tasks_.empty())
+                return;
+
+            task = std::move(tasks_.front());
+            tasks_.pop();
+        }
+
+        task();
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,66 @@
+/*
+ * ThreadPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_THREAD_POOL_H
+#define LLGL_THREAD_POOL_H
+
+
+#include <LLGL/Export.h>
+#include <functional>
+#include <queue>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+
+namespace LLGL
+{
+
+
+// Pool of worker threads that process enqueued tasks in submission order.
+class LLGL_EXPORT ThreadPool
+{
+
+    public:
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator = (const ThreadPool&) = delete;
+
+        /**
+        Initializes the pool with the specified amount of worker threads.
+        If 'threadCount' is zero, the number of threads is determined by the hardware concurrency.
+        */
+        ThreadPool(std::size_t threadCount = 0);
+
+        // Waits until all pending tasks are processed, then joins all worker threads.
+        ~ThreadPool();
+
+        // Enqueues the specified task to be processed by one of the worker threads.
+        void Enqueue(std::function<void()>&& task);
+
+    private:
+
+        void WorkerLoop();
+
+        std::vector<std::thread>            workers_;
+        std::queue<std::function<void()>>   tasks_;
+        std::mutex                          mutex_;
+        std::condition_variable             var_;
+        bool                                terminate_  = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -12,6 +12,7 @@
 #include <LLGL/Texture.h>
 #include <LLGL/Sampler.h>
 #include <LLGL/Shader.h>
+#include <LLGL/MappedFile.h>
 #include <LLGL/VertexFormat.h>
 #include <cstring>
 #include <cctype>
@@ -200,6 +201,17 @@ LLGL_EXPORT BufferDescriptor StorageBufferDesc(std::uint64_t size, const Storage
 
 /* ----- ShaderDescriptor utility functions ----- */
 
+// Returns true if the specified filename extension refers to a text-based shader source file
+static bool IsShaderSourceTextFile(const char* fileExt)
+{
+    for (auto ext : { "hlsl", "fx", "glsl", "vert", "tesc", "tese", "geom", "frag", "comp", "metal" })
+    {
+        if (std::strcmp(fileExt, ext) == 0)
+            return true;
+    }
+    return false;
+}
+
 LLGL_EXPORT ShaderDescriptor ShaderDescFromFile(const ShaderType type, const char* filename, const char* entryPoint, const char* profile, long flags)
 {
     ShaderDescriptor desc;
@@ -209,16 +221,7 @@ LLGL_EXPORT ShaderDescriptor ShaderDescFromFile(const ShaderType type, const cha
         if (auto fileExt = std::strrchr(filename, '.'))
         {
             /* Check if filename refers to a text-based source file */
-            bool isTextFile = false;
-
-            for (auto ext : { "hlsl", "fx", "glsl", "vert", "tesc", "tese", "geom", "frag", "comp", "metal" })
-            {
-                if (std::strcmp(fileExt + 1, ext) == 0)
-                {
-                    isTextFile = true;
-                    break;
-                }
-            }
+            bool isTextFile = IsShaderSourceTextFile(fileExt + 1);
 
             /* Initialize descriptor */
             desc.type       = type;
@@ -234,6 +237,28 @@ LLGL_EXPORT ShaderDescriptor ShaderDescFromFile(const ShaderType type, const cha
     return desc;
 }
 
+LLGL_EXPORT ShaderDescriptor ShaderDescFromMappedFile(const ShaderType type, const MappedFile& mappedFile, const char* entryPoint, const char* profile, long flags)
+{
+    ShaderDescriptor desc;
+
+    if (auto fileExt = std::strrchr(mappedFile.GetFilename(), '.'))
+    {
+        /* Check if the mapped file refers to a text-based source file */
+        bool isTextFile = IsShaderSourceTextFile(fileExt + 1);
+
+        /* Initialize descriptor with mapped file contents (not null terminated, so the source size must be specified) */
+        desc.type       = type;
+        desc.source     = reinterpret_cast<const char*>(mappedFile.GetData());
+        desc.sourceSize = mappedFile.GetSize();
+        desc.sourceType = (isTextFile ? ShaderSourceType::CodeString : ShaderSourceType::BinaryBuffer);
+        desc.entryPoint = entryPoint;
+        desc.profile    = profile;
+        desc.flags      = flags;
+    }
+
+    return desc;
+}
+
 /* ----- ShaderProgramDescriptor utility functions ----- */
 
 static void AssignShaderToDesc(ShaderProgramDescriptor& desc, Shader* shader)
@@ -263,6 +288,12 @@ static void AssignShaderToDesc(ShaderProgramDescriptor& desc, Shader* shader)
             case ShaderType::Compute:
                 desc.computeShader = shader;
                 break;
+            case ShaderType::Task:
+                desc.taskShader = shader;
+                break;
+            case ShaderType::Mesh:
+                desc.meshShader = shader;
+                break;
         }
     }
 }
@@ -7,7 +7,9 @@
 
 #include "AMD64Assembler.h"
 #include "AMD64Opcode.h"
+#include <algorithm>
 #include <limits.h>
+#include <limits>
 
 #include <fstream>//!!!
 #include <iomanip>
@@ -54,6 +56,16 @@ static const Reg g_amd64TempReg     = Reg::RAX;
 static const std::size_t g_amd64IntParamsCount = sizeof(g_amd64IntParams)/sizeof(g_amd64IntParams[0]);
 static const std::size_t g_amd64FltParamsCount = sizeof(g_amd64FltParams)/sizeof(g_amd64FltParams[0]);
 
+/*
+Callee-saved registers that are used to cache repeated 64-bit constants (see AMD64Assembler::FindOrPromoteConst).
+R12-R15 are preserved for the caller in both the Microsoft x64 and the System V calling convention,
+so cached constants survive all function calls of the generated program.
+*/
+static const Reg g_amd64CacheRegs[] = { Reg::R12, Reg::R13, Reg::R14, Reg::R15 };
+
+// Maximum number of promotion candidates that are tracked at a time, to bound compilation time for long command streams.
+static const std::size_t g_amd64MaxConstSeen = 64;
+
 
 /*
  * Internal functions
@@ -85,6 +97,12 @@ void AMD64Assembler::Begin()
     localStackSize_ = 128;//0;
     paramStackSize_ = 0;
 
+    /* Reset cache of constants held in callee-saved registers */
+    for (std::size_t i = 0; i < numConstCacheRegs; ++i)
+        constCache_[i] = { g_amd64CacheRegs[i], 0, false };
+    constSeen_.clear();
+    nextConstReg_ = 0;
+
     /* Write entry point prologue */
     WritePrologue();
     WriteStackFrame(GetEntryVarArgs(), GetStackAllocs());
@@ -156,7 +174,10 @@ void AMD64Assembler::WriteFuncCall(const void* addr, JITCallConv conv, bool farC
         else if (dstReg >= Reg::R8 && dstReg <= Reg::R15)
         {
             /* R8-R15 registers are only supported for 64-bit operand size */
-            MovRegImm64(dstReg, arg.value.i64);
+            if (arg.type == ArgType::QWord || arg.type == ArgType::Ptr)
+                MovRegImmCached(dstReg, arg.value.i64);
+            else
+                MovRegImm64(dstReg, arg.value.i64);
         }
         else
         {
@@ -173,10 +194,8 @@ void AMD64Assembler::WriteFuncCall(const void* addr, JITCallConv conv, bool farC
                     MovRegImm32(dstReg, arg.value.i32);
                     break;
                 case ArgType::QWord:
-                    MovRegImm64(dstReg, arg.value.i64);
-                    break;
                 case ArgType::Ptr:
-                    MovRegImm64(dstReg, arg.value.i64);
+                    MovRegImmCached(dstReg, arg.value.i64);
                     break;
                 case ArgType::StackPtr:
                     MovReg(dstReg, Reg::RBP);
@@ -221,6 +240,16 @@ void AMD64Assembler::WriteFuncCall(const void* addr, JITCallConv conv, bool farC
                 break;
             case ArgType::QWord:
             case ArgType::Ptr:
+                /* Store cached constant register directly if possible, otherwise via temporary register */
+                if (auto slot = (arg.value.i64 != 0 ? FindOrPromoteConst(arg.value.i64) : nullptr))
+                    MovMemReg(Reg::RSP, slot->reg, stackDisp);
+                else
+                {
+                    MovRegImm64(g_amd64TempReg, arg.value.i64);
+                    MovMemReg(Reg::RSP, g_amd64TempReg, stackDisp);
+                }
+                stackDisp.disp8 += 8;
+                break;
             case ArgType::Double:
                 MovRegImm64(g_amd64TempReg, arg.value.i64);
                 MovMemReg(Reg::RSP, g_amd64TempReg, stackDisp);
@@ -235,9 +264,14 @@ void AMD64Assembler::WriteFuncCall(const void* addr, JITCallConv conv, bool farC
         }
     }
 
-    /* Write 'call' instruction */
-    MovRegImm64(g_amd64TempReg, reinterpret_cast<std::uint64_t>(addr));
-    CallNear(g_amd64TempReg);
+    /* Write 'call' instruction; function addresses repeat frequently, so they are prime candidates for the constant cache */
+    if (auto slot = FindOrPromoteConst(reinterpret_cast<std::uint64_t>(addr)))
+        CallNear(slot->reg);
+    else
+    {
+        MovRegImm64(g_amd64TempReg, reinterpret_cast<std::uint64_t>(addr));
+        CallNear(g_amd64TempReg);
+    }
 }
 
 
@@ -285,10 +319,18 @@ void AMD64Assembler::WritePrologue()
     //TODO: determine which registers must be stored
     PushReg(Reg::RBX);
     #endif
+
+    /* Store callee-saved registers that are used as constant cache (see FindOrPromoteConst) */
+    for (const auto& slot : constCache_)
+        PushReg(slot.reg);
 }
 
 void AMD64Assembler::WriteEpilogue()
 {
+    /* Restore callee-saved registers of the constant cache (in reverse push order) */
+    for (std::size_t i = numConstCacheRegs; i > 0; --i)
+        PopReg(constCache_[i - 1].reg);
+
     #if 1
     /* Restore general purpose registers */
     //TODO: determine which registers must be restored
@@ -317,7 +359,7 @@ void AMD64Assembler::WriteStackFrame(
     /* Allocate local stack */
     localStackSize_ += varArgSize;
 
-    std::uint32_t chunkStackOffset = localStackSize_ + 8;
+    std::uint32_t chunkStackOffset = localStackSize_ + 8 + static_cast<std::uint32_t>(8 * numConstCacheRegs);
 
     localStackSize_ += stackChunksSize;
 
@@ -327,7 +369,7 @@ void AMD64Assembler::WriteStackFrame(
     /* Store parameters in local stack */
     std::size_t numIntRegs = 0, numFltRegs = 0;
     std::int8_t paramStackOffset = 16; // first parameter at [EBP+16]
-    std::int8_t localStackOffset = -16; // local variables after preserved EBX
+    std::int8_t localStackOffset = -16 - 8 * static_cast<std::int8_t>(numConstCacheRegs); // local variables after preserved RBX and constant cache registers
 
     for (auto type : varArgTypes)
     {
@@ -450,6 +492,45 @@ void AMD64Assembler::ApplySupplements()
     }
 }
 
+/*
+Returns the callee-saved register slot that holds the specified constant,
+or null if the constant has not been promoted into a register yet.
+A constant is only promoted on its second occurrence, so one-off values
+do not evict frequently repeated ones (e.g. object pointers and function addresses).
+*/
+AMD64Assembler::ConstReg* AMD64Assembler::FindOrPromoteConst(std::uint64_t qword)
+{
+    /* Check if constant is already held in one of the cache registers */
+    for (auto& slot : constCache_)
+    {
+        if (slot.loaded && slot.value == qword)
+            return &slot;
+    }
+
+    /* Promote constant into the next cache register (round-robin) on its second occurrence */
+    auto it = std::find(constSeen_.begin(), constSeen_.end(), qword);
+    if (it != constSeen_.end())
+    {
+        constSeen_.erase(it);
+
+        auto& slot = constCache_[nextConstReg_];
+        nextConstReg_ = (nextConstReg_ + 1) % numConstCacheRegs;
+
+        MovRegImm64(slot.reg, qword);
+        slot.value  = qword;
+        slot.loaded = true;
+
+        return &slot;
+    }
+
+    /* Remember constant as promotion candidate for its next occurrence */
+    if (constSeen_.size() == g_amd64MaxConstSeen)
+        constSeen_.erase(constSeen_.begin());
+    constSeen_.push_back(qword);
+
+    return nullptr;
+}
+
 void AMD64Assembler::ErrInvalidUseOfRSP()
 {
     #ifdef LLGL_DEBUG
@@ -517,7 +598,22 @@ void AMD64Assembler::Pop(Reg dstReg)
 // Opcode: 89 /r
 void AMD64Assembler::MovReg(Reg dstReg, Reg srcReg)
 {
-    WriteOptREX(dstReg);
+    /* Peephole: moving a register into itself is a no-op */
+    if (dstReg == srcReg)
+        return;
+
+    std::uint8_t prefix = 0;
+
+    if (Is64Reg(dstReg))
+        prefix |= REX_W;
+    if (IsExtReg(srcReg))
+        prefix |= REX_R;
+    if (IsExtReg(dstReg))
+        prefix |= REX_B;
+
+    if (prefix != 0)
+        WriteByte(REX_Prefix | prefix);
+
     WriteByte(Opcode_MovMemReg);
     WriteByte(Operand_Mod11 | RegByte(srcReg) << 3 | RegByte(dstReg));
 }
@@ -545,6 +641,20 @@ void AMD64Assembler::MovRegImm64(Reg dstReg, std::uint64_t qword)
         XOrReg(dstReg, dstReg);
 }
 
+// Same as MovRegImm64, but reuses a callee-saved register if it already holds the specified constant (see FindOrPromoteConst)
+void AMD64Assembler::MovRegImmCached(Reg dstReg, std::uint64_t qword)
+{
+    if (qword != 0)
+    {
+        if (auto slot = FindOrPromoteConst(qword))
+            MovReg(dstReg, slot->reg);
+        else
+            MovRegImm64(dstReg, qword);
+    }
+    else
+        XOrReg(dstReg, dstReg);
+}
+
 void AMD64Assembler::MovMemImm32(Reg dstMemReg, std::uint32_t dword, const Displacement& disp)
 {
     WriteOptREX(dstMemReg); // prefix
@@ -557,7 +667,19 @@ void AMD64Assembler::MovMemImm32(Reg dstMemReg, std::uint32_t dword, const Displ
 
 void AMD64Assembler::MovMemReg(Reg dstMemReg, Reg srcReg, const Displacement& disp)
 {
-    WriteOptREX(srcReg); // prefix
+    /* R8-R15 occupy the <reg> field of the ModR/M byte here, i.e. they require the REX.R bit (not REX.B) */
+    std::uint8_t prefix = 0;
+
+    if (Is64Reg(srcReg))
+        prefix |= REX_W;
+    if (IsExtReg(srcReg))
+        prefix |= REX_R;
+    if (IsExtReg(dstMemReg))
+        prefix |= REX_B;
+
+    if (prefix != 0)
+        WriteByte(REX_Prefix | prefix);
+
     WriteByte(Opcode_MovMemReg);
     WriteByte(ModRM(DispMod(disp), srcReg, dstMemReg));
     WriteOptSIB(dstMemReg);
@@ -566,7 +688,19 @@ void AMD64Assembler::MovMemReg(Reg dstMemReg, Reg srcReg, const Displacement& di
 
 void AMD64Assembler::MovRegMem(Reg dstReg, Reg srcMemReg, const Displacement& disp)
 {
-    WriteOptREX(dstReg);
+    /* R8-R15 occupy the <reg> field of the ModR/M byte here, i.e. they require the REX.R bit (not REX.B) */
+    std::uint8_t prefix = 0;
+
+    if (Is64Reg(dstReg))
+        prefix |= REX_W;
+    if (IsExtReg(dstReg))
+        prefix |= REX_R;
+    if (IsExtReg(srcMemReg))
+        prefix |= REX_B;
+
+    if (prefix != 0)
+        WriteByte(REX_Prefix | prefix);
+
     WriteByte(Opcode_MovRegMem);
     WriteByte(ModRM(DispMod(disp), dstReg, srcMemReg));
     WriteOptSIB(srcMemReg);
@@ -39,6 +39,7 @@ class AMD64Assembler final : public JITCompiler
     private:
 
         struct Displacement;
+        struct ConstReg;
 
         std::uint8_t DispMod(const Displacement& disp) const;
         std::uint8_t ModRM(std::uint8_t mode, Reg r0, Reg r1) const;
@@ -59,6 +60,8 @@ class AMD64Assembler final : public JITCompiler
         void EndSupplement();
         void ApplySupplements();
 
+        ConstReg* FindOrPromoteConst(std::uint64_t qword);
+
         void ErrInvalidUseOfRSP();
 
     private:
@@ -75,6 +78,7 @@ class AMD64Assembler final : public JITCompiler
         void MovReg(Reg dstReg, Reg srcReg);
         void MovRegImm32(Reg dstReg, std::uint32_t dword);
         void MovRegImm64(Reg dstReg, std::uint64_t qword);
+        void MovRegImmCached(Reg dstReg, std::uint64_t qword);
         void MovMemImm32(Reg dstMemReg, std::uint32_t dword, const Displacement& disp);
         void MovMemReg(Reg dstMemReg, Reg srcReg, const Displacement& disp);
         void MovRegMem(Reg dstReg, Reg srcMemReg, const Displacement& disp);
@@ -116,6 +120,14 @@ class AMD64Assembler final : public JITCompiler
             std::size_t     dstOffset;  // Destination byte offset where the instruction must be updated
         };
 
+        // Cached 64-bit constant that is held in a callee-saved register across function calls (see FindOrPromoteConst)
+        struct ConstReg
+        {
+            Reg             reg;    // Callee-saved register that holds the constant (R12-R15)
+            std::uint64_t   value;  // Constant value the register currently holds
+            bool            loaded; // True, if the register has been loaded with the value
+        };
+
         struct Displacement
         {
             Displacement();
@@ -140,6 +152,11 @@ class AMD64Assembler final : public JITCompiler
             Disp32(std::int32_t disp);
         };
 
+    private:
+
+        // Number of callee-saved registers that are used to cache repeated 64-bit constants (R12-R15)
+        static const std::size_t numConstCacheRegs = 4;
+
     private:
 
         std::uint32_t           	localStackSize_ = 0;
@@ -155,6 +172,11 @@ class AMD64Assembler final : public JITCompiler
         // Base pointer offsets of stack allocations
         std::vector<std::uint32_t>  stackChunkOffsets_;
 
+        // Cache of constants held in callee-saved registers, and constants seen once (promotion candidates)
+        ConstReg                    constCache_[numConstCacheRegs];
+        std::vector<std::uint64_t>  constSeen_;
+        std::size_t                 nextConstReg_   = 0;
+
 };
 
 
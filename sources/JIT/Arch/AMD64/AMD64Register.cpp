@@ -73,6 +73,11 @@ bool Is64Reg(const Reg reg)
     return (reg >= Reg::RAX && reg <= Reg::R15);
 }
 
+bool IsExtReg(const Reg reg)
+{
+    return (reg >= Reg::R8 && reg <= Reg::R15);
+}
+
 bool IsFltReg(const Reg reg)
 {
     return (reg >= Reg::XMM0 && reg <= Reg::XMM15);
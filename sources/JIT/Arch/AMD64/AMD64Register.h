@@ -74,6 +74,9 @@ std::uint8_t RegByte(const Reg reg);
 // Returns true, if 'reg' is a 64-bit register (i.e. RAX-RSP and R8-R15).
 bool Is64Reg(const Reg reg);
 
+// Returns true, if 'reg' is an extended 64-bit register (i.e. R8-R15), which requires a REX prefix bit.
+bool IsExtReg(const Reg reg);
+
 // Returns true, if 'reg' denotes a floating-point register (i.e. XMM0-XMM15).
 bool IsFltReg(const Reg reg);
 
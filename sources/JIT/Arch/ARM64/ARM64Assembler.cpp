@@ -0,0 +1,296 @@
+/*
+ * ARM64Assembler.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ARM64Assembler.h"
+#include "ARM64Opcode.h"
+#include <limits.h>
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+
+/*
+ * Internal members
+ */
+
+/*
+AAPCS64 calling convention (Linux, Android)
+Integral and pointer arguments are passed in X0-X7, floating-point arguments in V0-V7.
+Preserved for caller: X19-X28, V8-V15 (lower 64 bits), FP (X29), LR (X30)
+NOTE: Apple's AArch64 ABI passes variadic arguments on the stack; since the JIT program
+      entry point is declared variadic (see JITProgram::EntryPointPtr), the entry point
+      parameters are only fetched correctly with the standard AAPCS64 convention.
+*/
+static const std::uint8_t g_arm64TempReg        = 9;    // X9 (caller-saved scratch register)
+static const std::uint8_t g_arm64CallReg        = 16;   // X16 (intra-procedure-call register IP0)
+
+static const std::size_t g_arm64IntParamsCount  = 8;    // X0-X7
+static const std::size_t g_arm64FltParamsCount  = 8;    // V0-V7
+
+// Size (in bytes) of the outgoing argument area at the bottom of the stack frame.
+static const std::uint32_t g_arm64OutArgSize    = 64;
+
+
+/*
+ * ARM64Assembler class
+ */
+
+void ARM64Assembler::Begin()
+{
+    /* Reset data about local stack */
+    localStackSize_ = 0;
+    varArgOffsets_.clear();
+    stackChunkOffsets_.clear();
+
+    /* Write entry point prologue */
+    WritePrologue();
+    WriteStackFrame(GetEntryVarArgs(), GetStackAllocs());
+}
+
+void ARM64Assembler::End()
+{
+    /* Write entry point epilogue */
+    WriteEpilogue();
+}
+
+void ARM64Assembler::WriteFuncCall(const void* addr, JITCallConv /*conv*/, bool /*farCall*/)
+{
+    const auto& args = GetArgs();
+
+    /* Assign arguments to registers (X0-X7 for integrals/pointers, V0-V7 for floats), spill the rest */
+    std::size_t     numIntRegs      = 0;
+    std::size_t     numFltRegs      = 0;
+    std::uint32_t   stackArgOffset  = 0;
+
+    for (const auto& arg : args)
+    {
+        const bool isFloat = IsFloat(arg.type);
+
+        if (isFloat && numFltRegs < g_arm64FltParamsCount)
+        {
+            const auto dstReg = static_cast<std::uint8_t>(numFltRegs++);
+            if (arg.param < 0xF && arg.param < varArgOffsets_.size())
+            {
+                /* Load parameter from its spill slot into destination register */
+                LdrFpRegSp(dstReg, varArgOffsets_[arg.param], (arg.type == ArgType::Double));
+            }
+            else
+            {
+                /* Materialize bit pattern in temporary register and move it into the FP register */
+                if (arg.type == ArgType::Double)
+                    MovRegImm64(g_arm64TempReg, arg.value.i64);
+                else
+                    MovRegImm64(g_arm64TempReg, arg.value.i32);
+                FMovFpReg(dstReg, g_arm64TempReg, (arg.type == ArgType::Double));
+            }
+        }
+        else if (!isFloat && numIntRegs < g_arm64IntParamsCount)
+        {
+            const auto dstReg = static_cast<std::uint8_t>(numIntRegs++);
+            if (arg.param < 0xF && arg.param < varArgOffsets_.size())
+            {
+                /* Load parameter from its spill slot into destination register */
+                LdrRegSp(dstReg, varArgOffsets_[arg.param]);
+            }
+            else if (arg.type == ArgType::StackPtr)
+            {
+                /* Compute address of stack allocation */
+                AddRegSpImm(dstReg, stackChunkOffsets_[arg.value.i8]);
+            }
+            else
+            {
+                /* Move value into destination register (upper bits of sub-64-bit values are zero) */
+                MovRegImm64(dstReg, arg.value.i64);
+            }
+        }
+        else
+        {
+            /* Write argument into the outgoing argument area (8 bytes per slot) */
+            if (arg.param < 0xF && arg.param < varArgOffsets_.size())
+                LdrRegSp(g_arm64TempReg, varArgOffsets_[arg.param]);
+            else if (arg.type == ArgType::StackPtr)
+                AddRegSpImm(g_arm64TempReg, stackChunkOffsets_[arg.value.i8]);
+            else
+                MovRegImm64(g_arm64TempReg, arg.value.i64);
+            StrRegSp(g_arm64TempReg, stackArgOffset);
+            stackArgOffset += 8;
+        }
+    }
+
+    /* Write 'blr' instruction with function address in IP0 */
+    MovRegImm64(g_arm64CallReg, reinterpret_cast<std::uint64_t>(addr));
+    Blr(g_arm64CallReg);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool ARM64Assembler::IsLittleEndian() const
+{
+    /* A64 instructions are always emitted little-endian */
+    return true;
+}
+
+void ARM64Assembler::WritePrologue()
+{
+    /* Store frame pointer (X29) and link register (X30) */
+    WriteInstr(OpcodeStpPreX29X30);
+    WriteInstr(OpcodeMovX29Sp);
+}
+
+void ARM64Assembler::WriteEpilogue()
+{
+    /* Pop local stack and restore frame pointer and link register */
+    if (localStackSize_ > 0)
+        AddSpImm(localStackSize_);
+    WriteInstr(OpcodeLdpPostX29X30);
+    WriteInstr(OpcodeRet);
+}
+
+void ARM64Assembler::WriteStackFrame(
+    const std::vector<JIT::ArgType>&    varArgTypes,
+    const std::vector<std::uint32_t>&   stackChunks)
+{
+    /* Reserve outgoing argument area at the bottom of the frame */
+    localStackSize_ = g_arm64OutArgSize;
+
+    /* Determine stack pointer offsets for stack allocations */
+    for (auto chunk : stackChunks)
+    {
+        stackChunkOffsets_.push_back(localStackSize_);
+        localStackSize_ += ((chunk + 7) & ~7u);
+    }
+
+    /* Determine stack pointer offsets for spilled entry point parameters (8 bytes each) */
+    for (std::size_t i = 0; i < varArgTypes.size(); ++i)
+    {
+        varArgOffsets_.push_back(localStackSize_);
+        localStackSize_ += 8;
+    }
+
+    /* Keep stack pointer 16-byte aligned */
+    localStackSize_ = ((localStackSize_ + 15) & ~15u);
+
+    /* Allocate local stack */
+    if (localStackSize_ > 0)
+        SubSpImm(localStackSize_);
+
+    /* Spill entry point parameters from their argument registers into the local stack */
+    std::size_t numIntRegs = 0, numFltRegs = 0;
+
+    for (std::size_t i = 0; i < varArgTypes.size(); ++i)
+    {
+        if (IsFloat(varArgTypes[i]))
+        {
+            if (numFltRegs < g_arm64FltParamsCount)
+                StrFpRegSp(static_cast<std::uint8_t>(numFltRegs++), varArgOffsets_[i], (varArgTypes[i] == ArgType::Double));
+        }
+        else
+        {
+            if (numIntRegs < g_arm64IntParamsCount)
+                StrRegSp(static_cast<std::uint8_t>(numIntRegs++), varArgOffsets_[i]);
+        }
+    }
+}
+
+void ARM64Assembler::WriteInstr(std::uint32_t instr)
+{
+    WriteDWord(instr);
+}
+
+void ARM64Assembler::AddSpImm(std::uint32_t value)
+{
+    /* 'add sp, sp, #imm12' only encodes 12 bits; larger offsets are split into multiple instructions */
+    while (value > 0)
+    {
+        const std::uint32_t imm12 = (value < 0x1000 ? value : 0xFFF);
+        WriteInstr(OpcodeAddSpImm | (imm12 << 10));
+        value -= imm12;
+    }
+}
+
+void ARM64Assembler::SubSpImm(std::uint32_t value)
+{
+    while (value > 0)
+    {
+        const std::uint32_t imm12 = (value < 0x1000 ? value : 0xFFF);
+        WriteInstr(OpcodeSubSpImm | (imm12 << 10));
+        value -= imm12;
+    }
+}
+
+void ARM64Assembler::AddRegSpImm(std::uint8_t dstReg, std::uint32_t value)
+{
+    WriteInstr(OpcodeAddRegSpImm | ((value & 0xFFF) << 10) | dstReg);
+}
+
+void ARM64Assembler::MovRegImm64(std::uint8_t dstReg, std::uint64_t value)
+{
+    /* Write 'movz' for the lowest half-word and 'movk' for all non-zero upper half-words */
+    WriteInstr(OpcodeMovZ | (static_cast<std::uint32_t>(value & 0xFFFF) << 5) | dstReg);
+
+    for (std::uint32_t hw = 1; hw < 4; ++hw)
+    {
+        const auto imm16 = static_cast<std::uint32_t>((value >> (hw * 16)) & 0xFFFF);
+        if (imm16 != 0)
+            WriteInstr(OpcodeMovK | (hw << 21) | (imm16 << 5) | dstReg);
+    }
+}
+
+void ARM64Assembler::StrRegSp(std::uint8_t srcReg, std::uint32_t offset)
+{
+    WriteInstr(OpcodeStrRegSpImm | (((offset / 8) & 0xFFF) << 10) | srcReg);
+}
+
+void ARM64Assembler::LdrRegSp(std::uint8_t dstReg, std::uint32_t offset)
+{
+    WriteInstr(OpcodeLdrRegSpImm | (((offset / 8) & 0xFFF) << 10) | dstReg);
+}
+
+void ARM64Assembler::StrFpRegSp(std::uint8_t srcReg, std::uint32_t offset, bool isDouble)
+{
+    if (isDouble)
+        WriteInstr(OpcodeStrFpDSpImm | (((offset / 8) & 0xFFF) << 10) | srcReg);
+    else
+        WriteInstr(OpcodeStrFpSSpImm | (((offset / 4) & 0xFFF) << 10) | srcReg);
+}
+
+void ARM64Assembler::LdrFpRegSp(std::uint8_t dstReg, std::uint32_t offset, bool isDouble)
+{
+    if (isDouble)
+        WriteInstr(OpcodeLdrFpDSpImm | (((offset / 8) & 0xFFF) << 10) | dstReg);
+    else
+        WriteInstr(OpcodeLdrFpSSpImm | (((offset / 4) & 0xFFF) << 10) | dstReg);
+}
+
+void ARM64Assembler::FMovFpReg(std::uint8_t dstFpReg, std::uint8_t srcReg, bool isDouble)
+{
+    if (isDouble)
+        WriteInstr(OpcodeFMovDReg | (static_cast<std::uint32_t>(srcReg) << 5) | dstFpReg);
+    else
+        WriteInstr(OpcodeFMovSReg | (static_cast<std::uint32_t>(srcReg) << 5) | dstFpReg);
+}
+
+void ARM64Assembler::Blr(std::uint8_t reg)
+{
+    WriteInstr(OpcodeBlr | (static_cast<std::uint32_t>(reg) << 5));
+}
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,88 @@
+/*
+ * ARM64Assembler.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_ARM64_ASSEMBLER_H
+#define LLGL_ARM64_ASSEMBLER_H
+
+
+#include "../../JITCompiler.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+
+// AArch64 (a.k.a. ARM64) assembly code generator.
+class ARM64Assembler final : public JITCompiler
+{
+
+    public:
+
+        void Begin() override;
+        void End() override;
+
+    private:
+
+        bool IsLittleEndian() const override;
+        void WriteFuncCall(const void* addr, JITCallConv conv, bool farCall) override;
+
+    private:
+
+        void WritePrologue();
+        void WriteEpilogue();
+        void WriteStackFrame(
+            const std::vector<JIT::ArgType>&    varArgTypes,
+            const std::vector<std::uint32_t>&   stackChunks
+        );
+
+        /* Emits a single A64 instruction (always 32 bits, little-endian) */
+        void WriteInstr(std::uint32_t instr);
+
+        void AddSpImm(std::uint32_t value);
+        void SubSpImm(std::uint32_t value);
+        void AddRegSpImm(std::uint8_t dstReg, std::uint32_t value);
+
+        void MovRegImm64(std::uint8_t dstReg, std::uint64_t value);
+
+        void StrRegSp(std::uint8_t srcReg, std::uint32_t offset);
+        void LdrRegSp(std::uint8_t dstReg, std::uint32_t offset);
+        void StrFpRegSp(std::uint8_t srcReg, std::uint32_t offset, bool isDouble);
+        void LdrFpRegSp(std::uint8_t dstReg, std::uint32_t offset, bool isDouble);
+
+        void FMovFpReg(std::uint8_t dstFpReg, std::uint8_t srcReg, bool isDouble);
+
+        void Blr(std::uint8_t reg);
+
+    private:
+
+        // Size (in bytes) of the local stack frame (outgoing arguments, stack chunks, spilled entry parameters).
+        std::uint32_t               localStackSize_     = 0;
+
+        // Stack pointer offsets of the spilled entry point parameters.
+        std::vector<std::uint32_t>  varArgOffsets_;
+
+        // Stack pointer offsets of the stack allocations.
+        std::vector<std::uint32_t>  stackChunkOffsets_;
+
+};
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
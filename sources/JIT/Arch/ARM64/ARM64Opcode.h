@@ -0,0 +1,64 @@
+/*
+ * ARM64Opcode.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_ARM64_OPCODE_H
+#define LLGL_ARM64_OPCODE_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+namespace JIT
+{
+
+/*
+AArch64 (A64) instructions have a fixed size of 32 bits and are always emitted little-endian.
+The constants below are the base encodings with all register/immediate fields set to zero;
+the assembler ORs the respective fields into them (see ARM64Assembler).
+*/
+
+enum ARM64Opcode : std::uint32_t
+{
+    OpcodeStpPreX29X30      = 0xA9BF7BFD, // stp x29, x30, [sp, #-16]!
+    OpcodeLdpPostX29X30     = 0xA8C17BFD, // ldp x29, x30, [sp], #16
+    OpcodeMovX29Sp          = 0x910003FD, // mov x29, sp
+    OpcodeRet               = 0xD65F03C0, // ret
+
+    OpcodeAddSpImm          = 0x910003FF, // add sp, sp, #<imm12>
+    OpcodeSubSpImm          = 0xD10003FF, // sub sp, sp, #<imm12>
+    OpcodeAddRegSpImm       = 0x910003E0, // add <Xd>, sp, #<imm12>
+
+    OpcodeMovZ              = 0xD2800000, // movz <Xd>, #<imm16>, lsl #<hw*16>
+    OpcodeMovK              = 0xF2800000, // movk <Xd>, #<imm16>, lsl #<hw*16>
+
+    OpcodeStrRegSpImm       = 0xF90003E0, // str <Xt>, [sp, #<imm12>*8]
+    OpcodeLdrRegSpImm       = 0xF94003E0, // ldr <Xt>, [sp, #<imm12>*8]
+    OpcodeStrFpDSpImm       = 0xFD0003E0, // str <Dt>, [sp, #<imm12>*8]
+    OpcodeLdrFpDSpImm       = 0xFD4003E0, // ldr <Dt>, [sp, #<imm12>*8]
+    OpcodeStrFpSSpImm       = 0xBD0003E0, // str <St>, [sp, #<imm12>*4]
+    OpcodeLdrFpSSpImm       = 0xBD4003E0, // ldr <St>, [sp, #<imm12>*4]
+
+    OpcodeFMovDReg          = 0x9E670000, // fmov <Dd>, <Xn>
+    OpcodeFMovSReg          = 0x1E270000, // fmov <Sd>, <Wn>
+
+    OpcodeBlr               = 0xD63F0000, // blr <Xn>
+};
+
+
+} // /namespace JIT
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -41,6 +41,14 @@ POSIXJITProgram::POSIXJITProgram(const void* code, std::size_t size) :
     /* Copy code into executable memory space */
     ::memcpy(addr_, code, size);
 
+    #if defined __GNUC__ || defined __clang__
+    /* Flush instruction cache for the new code (required on architectures without coherent I/D caches, e.g. ARM) */
+    __builtin___clear_cache(
+        reinterpret_cast<char*>(addr_),
+        reinterpret_cast<char*>(addr_) + size_
+    );
+    #endif
+
     /* Set function pointer to executable memory address */
     SetEntryPoint(addr_);
 }
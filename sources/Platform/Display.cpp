@@ -7,12 +7,67 @@
 
 #include <LLGL/Display.h>
 #include <algorithm>
+#include <mutex>
 
 
 namespace LLGL
 {
 
 
+/* ----- Internal structures ----- */
+
+// Cached display topology (see Display::GetCachedList).
+struct DisplayCache
+{
+    std::mutex                              mutex;
+    std::vector<std::unique_ptr<Display>>   displayList;
+    bool                                    valid       = false;
+    Display::TopologyChangedCallback        callback;
+};
+
+static DisplayCache g_displayCache;
+
+
+/* ----- Global functions ----- */
+
+const std::vector<std::unique_ptr<Display>>& Display::GetCachedList()
+{
+    std::lock_guard<std::mutex> guard { g_displayCache.mutex };
+
+    /* Re-enumerate display list only if the cache has been invalidated */
+    if (!g_displayCache.valid)
+    {
+        g_displayCache.displayList  = InstantiateList();
+        g_displayCache.valid        = true;
+    }
+
+    return g_displayCache.displayList;
+}
+
+void Display::InvalidateCachedList()
+{
+    TopologyChangedCallback callback;
+    {
+        std::lock_guard<std::mutex> guard { g_displayCache.mutex };
+
+        /* Only notify on the transition to the invalid state, so a topology change reported by multiple windows is coalesced */
+        if (!g_displayCache.valid)
+            return;
+
+        g_displayCache.valid    = false;
+        callback                = g_displayCache.callback;
+    }
+    if (callback)
+        callback();
+}
+
+void Display::SetTopologyChangedCallback(const TopologyChangedCallback& callback)
+{
+    std::lock_guard<std::mutex> guard { g_displayCache.mutex };
+    g_displayCache.callback = callback;
+}
+
+
 /*
  * ======= Protected: =======
  */
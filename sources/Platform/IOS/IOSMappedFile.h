@@ -0,0 +1,45 @@
+/*
+ * IOSMappedFile.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_IOS_MAPPED_FILE_H
+#define LLGL_IOS_MAPPED_FILE_H
+
+
+#include <LLGL/MappedFile.h>
+
+
+namespace LLGL
+{
+
+
+class IOSMappedFile : public MappedFile
+{
+
+    public:
+
+        IOSMappedFile(const char* filename);
+        ~IOSMappedFile();
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    private:
+
+        void*       data_   = nullptr;
+        std::size_t size_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
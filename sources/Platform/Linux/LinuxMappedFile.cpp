@@ -0,0 +1,81 @@
+/*
+ * LinuxMappedFile.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "LinuxMappedFile.h"
+#include "../../Core/Helper.h"
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+namespace LLGL
+{
+
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* filename)
+{
+    auto mappedFile = MakeUnique<LinuxMappedFile>(filename);
+    mappedFile->filename_ = filename;
+    return std::move(mappedFile);
+}
+
+LinuxMappedFile::LinuxMappedFile(const char* filename)
+{
+    /* Open file for reading only */
+    auto fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("failed to open file for memory mapping: \"" + std::string(filename) + "\"");
+
+    /* Query file size */
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        throw std::runtime_error("failed to query file size for memory mapping: \"" + std::string(filename) + "\"");
+    }
+
+    size_ = static_cast<std::size_t>(fileStat.st_size);
+
+    /* Map file contents into process memory; empty files cannot be mapped and are represented by a null pointer */
+    if (size_ > 0)
+    {
+        data_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data_ == MAP_FAILED)
+        {
+            close(fd);
+            throw std::runtime_error("failed to map file into memory: \"" + std::string(filename) + "\"");
+        }
+    }
+
+    /* Close file descriptor; the mapping keeps its own reference to the file */
+    close(fd);
+}
+
+LinuxMappedFile::~LinuxMappedFile()
+{
+    if (data_ != nullptr)
+        munmap(data_, size_);
+}
+
+const void* LinuxMappedFile::GetData() const
+{
+    return data_;
+}
+
+std::size_t LinuxMappedFile::GetSize() const
+{
+    return size_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,45 @@
+/*
+ * LinuxMappedFile.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_LINUX_MAPPED_FILE_H
+#define LLGL_LINUX_MAPPED_FILE_H
+
+
+#include <LLGL/MappedFile.h>
+
+
+namespace LLGL
+{
+
+
+class LinuxMappedFile : public MappedFile
+{
+
+    public:
+
+        LinuxMappedFile(const char* filename);
+        ~LinuxMappedFile();
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    private:
+
+        void*       data_   = nullptr;
+        std::size_t size_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
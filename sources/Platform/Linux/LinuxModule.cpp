@@ -48,13 +48,8 @@ std::string Module::GetModuleFilename(const char* moduleName)
 
 bool Module::IsAvailable(const char* moduleFilename)
 {
-    /* Check if Linux shared library can be loaded properly */
-    if (auto handle = dlopen(moduleFilename, RTLD_LAZY))
-    {
-        dlclose(handle);
-        return true;
-    }
-    return false;
+    /* Only check for file existence; a full dlopen would load and relocate the entire module just to discard it */
+    return (access(moduleFilename, F_OK) == 0);
 }
 
 std::unique_ptr<Module> Module::Load(const char* moduleFilename)
@@ -10,6 +10,7 @@
 #include "LinuxWindow.h"
 #include "MapKey.h"
 #include <exception>
+#include <X11/extensions/Xrandr.h>
 
 
 namespace LLGL
@@ -181,6 +182,12 @@ void LinuxWindow::OnProcessEvents()
             case ClientMessage:
                 ProcessClientMessage(event.xclient);
                 break;
+
+            default:
+                /* Invalidate cached display list when the display topology changed (Xrandr) */
+                if (rrEventBase_ >= 0 && event.type == rrEventBase_ + RRScreenChangeNotify)
+                    Display::InvalidateCachedList();
+                break;
         }
     }
 
@@ -276,8 +283,15 @@ void LinuxWindow::OpenWindow()
     }
     
     /* Enable WM_DELETE_WINDOW protocol */
-    closeWndAtom_ = XInternAtom(display_, "WM_DELETE_WINDOW", False); 
+    closeWndAtom_ = XInternAtom(display_, "WM_DELETE_WINDOW", False);
     XSetWMProtocols(display_, wnd_, &closeWndAtom_, 1);
+
+    /* Register for Xrandr screen change notifications to invalidate the cached display list */
+    int rrErrorBase = 0;
+    if (XRRQueryExtension(display_, &rrEventBase_, &rrErrorBase))
+        XRRSelectInput(display_, wnd_, RRScreenChangeNotifyMask);
+    else
+        rrEventBase_ = -1;
 }
 
 void LinuxWindow::ProcessKeyEvent(XKeyEvent& event, bool down)
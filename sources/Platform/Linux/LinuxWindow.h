@@ -71,9 +71,11 @@ class LinuxWindow : public Window
         ::XVisualInfo*      visual_         = nullptr;
         
         ::Atom              closeWndAtom_;
-        
+
         Offset2D            prevMousePos_;
 
+        int                 rrEventBase_    = -1;   // Xrandr event base, or -1 if the extension is not available
+
 };
 
 
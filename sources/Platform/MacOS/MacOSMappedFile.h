@@ -0,0 +1,45 @@
+/*
+ * MacOSMappedFile.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_MACOS_MAPPED_FILE_H
+#define LLGL_MACOS_MAPPED_FILE_H
+
+
+#include <LLGL/MappedFile.h>
+
+
+namespace LLGL
+{
+
+
+class MacOSMappedFile : public MappedFile
+{
+
+    public:
+
+        MacOSMappedFile(const char* filename);
+        ~MacOSMappedFile();
+
+        const void* GetData() const override;
+        std::size_t GetSize() const override;
+
+    private:
+
+        void*       data_   = nullptr;
+        std::size_t size_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,6 +8,7 @@
 #include "MacOSModule.h"
 #include "../../Core/Helper.h"
 #include <dlfcn.h>
+#include <unistd.h>
 
 
 namespace LLGL
@@ -28,14 +29,8 @@ std::string Module::GetModuleFilename(const char* moduleName)
 
 bool Module::IsAvailable(const char* moduleFilename)
 {
-    /* Check if MacOS dynamic library can be loaded properly */
-    auto handle = dlopen(moduleFilename, RTLD_LAZY);
-    if (handle)
-    {
-        dlclose(handle);
-        return true;
-    }
-    return false;
+    /* Only check for file existence; a full dlopen would load and relocate the entire module just to discard it */
+    return (access(moduleFilename, F_OK) == 0);
 }
 
 std::unique_ptr<Module> Module::Load(const char* moduleFilename)
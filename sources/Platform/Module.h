@@ -34,7 +34,7 @@ class Module : public NonCopyable
         // Converts the module name into a specific filename (e.g. "OpenGL" to "LLGL_OpenGL.dll" on Windows).
         static std::string GetModuleFilename(const char* moduleName);
 
-        // Returns true if the specified module is available.
+        // Returns true if the specified module file is available. This only checks for file existence and does not load the module.
         static bool IsAvailable(const char* moduleFilename);
 
         // Returns the specified module or null if it is not available.
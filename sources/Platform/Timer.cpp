@@ -6,6 +6,7 @@
  */
 
 #include <LLGL/Timer.h>
+#include <thread>
 
 
 namespace LLGL
@@ -19,6 +20,64 @@ void Timer::MeasureTime()
     deltaTime_ = static_cast<double>(elapsed) / static_cast<double>(GetFrequency());
 }
 
+void Timer::SetFrameInterval(double interval)
+{
+    /* Notify platform implementation when frame pacing is enabled or disabled */
+    if ((frameInterval_ > 0.0) != (interval > 0.0))
+        OnFramePacingChanged(interval > 0.0);
+
+    /* Store new interval and restart schedule */
+    frameInterval_  = interval;
+    nextFrameTime_  = std::chrono::steady_clock::time_point {};
+    wakeUpError_    = 0.0;
+}
+
+void Timer::PaceFrame()
+{
+    using Clock = std::chrono::steady_clock;
+
+    if (frameInterval_ <= 0.0)
+        return;
+
+    const auto interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double> { frameInterval_ });
+
+    auto now = Clock::now();
+
+    /* Restart schedule on the first call and whenever the frame time exceeded the target interval */
+    if (nextFrameTime_ == Clock::time_point {} || now > nextFrameTime_ + interval)
+        nextFrameTime_ = now;
+
+    /* Sleep while more than the scheduler granularity remains */
+    const auto sleepGranularity = std::chrono::milliseconds(2);
+
+    while (nextFrameTime_ - now > sleepGranularity)
+    {
+        std::this_thread::sleep_for(nextFrameTime_ - now - sleepGranularity);
+        now = Clock::now();
+    }
+
+    /* Spin for the remainder to hit the target time precisely */
+    while (now < nextFrameTime_)
+    {
+        std::this_thread::yield();
+        now = Clock::now();
+    }
+
+    /* Store measured wake-up error and advance schedule by one interval */
+    wakeUpError_ = std::chrono::duration<double>(now - nextFrameTime_).count();
+    nextFrameTime_ += interval;
+}
+
+
+/*
+ * ======= Protected: =======
+ */
+
+void Timer::OnFramePacingChanged(bool enabled)
+{
+    // dummy
+}
+
 
 } // /namespace LLGL
 
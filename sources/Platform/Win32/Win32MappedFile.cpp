@@ -0,0 +1,85 @@
+/*
+ * Win32MappedFile.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "Win32MappedFile.h"
+#include "../../Core/Helper.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* filename)
+{
+    auto mappedFile = MakeUnique<Win32MappedFile>(filename);
+    mappedFile->filename_ = filename;
+    return std::move(mappedFile);
+}
+
+Win32MappedFile::Win32MappedFile(const char* filename)
+{
+    /* Open file for reading only with a hint for sequential access */
+    file_ = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("failed to open file for memory mapping: \"" + std::string(filename) + "\"");
+
+    /* Query file size */
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file_, &fileSize))
+    {
+        CloseHandle(file_);
+        file_ = INVALID_HANDLE_VALUE;
+        throw std::runtime_error("failed to query file size for memory mapping: \"" + std::string(filename) + "\"");
+    }
+
+    size_ = static_cast<std::size_t>(fileSize.QuadPart);
+
+    /* Map file contents into process memory; empty files cannot be mapped and are represented by a null pointer */
+    if (size_ > 0)
+    {
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ != nullptr)
+            data_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+
+        if (data_ == nullptr)
+        {
+            if (mapping_ != nullptr)
+                CloseHandle(mapping_);
+            CloseHandle(file_);
+            file_ = INVALID_HANDLE_VALUE;
+            throw std::runtime_error("failed to map file into memory: \"" + std::string(filename) + "\"");
+        }
+    }
+}
+
+Win32MappedFile::~Win32MappedFile()
+{
+    if (data_ != nullptr)
+        UnmapViewOfFile(data_);
+    if (mapping_ != nullptr)
+        CloseHandle(mapping_);
+    if (file_ != INVALID_HANDLE_VALUE)
+        CloseHandle(file_);
+}
+
+const void* Win32MappedFile::GetData() const
+{
+    return data_;
+}
+
+std::size_t Win32MappedFile::GetSize() const
+{
+    return size_;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -47,13 +47,8 @@ static HMODULE LoadLibrarySafe(LPCSTR filename)
 
 bool Module::IsAvailable(const char* moduleFilename)
 {
-    /* Check if Win32 dynamic link library can be loaded properly */
-    if (auto handle = LoadLibrarySafe(moduleFilename))
-    {
-        FreeLibrary(handle);
-        return true;
-    }
-    return false;
+    /* Only search the module file along the DLL search path; a full LoadLibrary would load and relocate the entire module just to discard it */
+    return (SearchPathA(nullptr, moduleFilename, nullptr, 0, nullptr, nullptr) != 0);
 }
 
 std::unique_ptr<Module> Module::Load(const char* moduleFilename)
@@ -29,6 +29,13 @@ Win32Timer::Win32Timer()
     QueryPerformanceFrequency(&clockFrequency_);
 }
 
+Win32Timer::~Win32Timer()
+{
+    /* Restore scheduler granularity if frame pacing is still active */
+    if (framePacing_)
+        timeEndPeriod(1);
+}
+
 void Win32Timer::Start()
 {
     /* Query current performance counter ticks */
@@ -92,6 +99,24 @@ bool Win32Timer::IsRunning() const
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+void Win32Timer::OnFramePacingChanged(bool enabled)
+{
+    /* Increase scheduler granularity to 1 ms while frame pacing is active, so the hybrid wait can sleep close to its target */
+    if (enabled != framePacing_)
+    {
+        if (enabled)
+            timeBeginPeriod(1);
+        else
+            timeEndPeriod(1);
+        framePacing_ = enabled;
+    }
+}
+
+
 } // /namespace LLGL
 
 
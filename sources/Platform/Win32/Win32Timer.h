@@ -23,6 +23,7 @@ class Win32Timer final : public Timer
     public:
 
         Win32Timer();
+        ~Win32Timer();
 
         void Start() override;
         std::uint64_t Stop() override;
@@ -31,6 +32,10 @@ class Win32Timer final : public Timer
 
         bool IsRunning() const override;
 
+    private:
+
+        void OnFramePacingChanged(bool enabled) override;
+
     private:
 
         LARGE_INTEGER   clockFrequency_;
@@ -41,6 +46,7 @@ class Win32Timer final : public Timer
         LONGLONG        prevElapsedTime_    = 0;
 
         bool            running_            = false;
+        bool            framePacing_        = false;
 
 };
 
@@ -10,6 +10,9 @@
 #include "../../Core/Helper.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/Platform/Platform.h>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
 
 
 namespace LLGL
@@ -119,14 +122,23 @@ std::unique_ptr<Window> Window::Create(const WindowDescriptor& desc)
 }
 
 Win32Window::Win32Window(const WindowDescriptor& desc) :
-    contextHandle_ { 0                        },
-    wnd_           { CreateWindowHandle(desc) }
+    contextHandle_ { 0 }
 {
+    if (desc.threadedEventLoop)
+    {
+        /* Queue all events, so they can be dispatched on the thread that calls "ProcessEvents" */
+        SetQueuedEventsEnabled(true);
+        StartEventLoopThread(desc);
+    }
+    else
+        wnd_ = CreateWindowHandle(desc);
 }
 
 Win32Window::~Win32Window()
 {
-    if (wnd_)
+    if (eventLoopThread_.joinable())
+        StopEventLoopThread();
+    else if (wnd_)
         DestroyWindow(wnd_);
 }
 
@@ -140,8 +152,17 @@ void Win32Window::ResetPixelFormat()
 {
     /* Destroy previous window handle and create a new one with current descriptor settings */
     auto desc = GetDesc();
-    DestroyWindow(wnd_);
-    wnd_ = CreateWindowHandle(desc);
+    if (eventLoopThread_.joinable())
+    {
+        /* Restart the event loop thread, because the window must be destroyed and re-created on the thread that owns it */
+        StopEventLoopThread();
+        StartEventLoopThread(desc);
+    }
+    else
+    {
+        DestroyWindow(wnd_);
+        wnd_ = CreateWindowHandle(desc);
+    }
 }
 
 Extent2D Win32Window::GetContentSize() const
@@ -252,6 +273,7 @@ WindowDescriptor Win32Window::GetDesc() const
     desc.acceptDropFiles        = ((windowFlags & WM_DROPFILES) != 0);
     desc.preventForPowerSafe    = false; //todo...
     desc.centered               = (centerPoint.x == desc.position.x && centerPoint.y == desc.position.y);
+    desc.threadedEventLoop      = eventLoopThread_.joinable();
 
     desc.windowContext          = (contextHandle_.parentWindow != 0 ? (&contextHandle_) : nullptr);
 
@@ -332,16 +354,32 @@ void Win32Window::SetDesc(const WindowDescriptor& desc)
     }
 }
 
-void Win32Window::OnProcessEvents()
+void Win32Window::AccumulateGlobalMotion(int dx, int dy)
 {
-    /* Peek all queued messages */
-    MSG message;
+    rawMotionX_.fetch_add(dx, std::memory_order_relaxed);
+    rawMotionY_.fetch_add(dy, std::memory_order_relaxed);
+}
 
-    while (PeekMessage(&message, nullptr, 0, 0, PM_REMOVE))
+void Win32Window::OnProcessEvents()
+{
+    /* The event loop thread runs its own message pump (see StartEventLoopThread) */
+    if (!eventLoopThread_.joinable())
     {
-        TranslateMessage(&message);
-        DispatchMessage(&message);
+        /* Peek all queued messages */
+        MSG message;
+
+        while (PeekMessage(&message, nullptr, 0, 0, PM_REMOVE))
+        {
+            TranslateMessage(&message);
+            DispatchMessage(&message);
+        }
     }
+
+    /* Post the accumulated raw mouse motion as a single coalesced event */
+    Offset2D motion { rawMotionX_.exchange(0), rawMotionY_.exchange(0) };
+
+    if (motion.x != 0 || motion.y != 0)
+        PostGlobalMotion(motion);
 }
 
 
@@ -398,6 +436,75 @@ HWND Win32Window::CreateWindowHandle(const WindowDescriptor& desc)
     return wnd;
 }
 
+void Win32Window::StartEventLoopThread(const WindowDescriptor& desc)
+{
+    std::mutex              creationMutex;
+    std::condition_variable creationCondVar;
+    bool                    creationDone        = false;
+    std::exception_ptr      creationException;
+
+    eventLoopThread_ = std::thread(
+        [&, desc]()
+        {
+            /* Create window handle on this thread, so all its window messages are sent to this thread */
+            try
+            {
+                wnd_ = CreateWindowHandle(desc);
+            }
+            catch (...)
+            {
+                creationException = std::current_exception();
+            }
+
+            eventLoopThreadId_ = GetCurrentThreadId();
+
+            /* Notify constructor that the window handle is available */
+            {
+                std::lock_guard<std::mutex> guard { creationMutex };
+                creationDone = true;
+                creationCondVar.notify_one();
+            }
+
+            if (!wnd_)
+                return;
+
+            /* Run message pump until WM_QUIT is received (see StopEventLoopThread) */
+            MSG message;
+
+            while (GetMessage(&message, nullptr, 0, 0) > 0)
+            {
+                TranslateMessage(&message);
+                DispatchMessage(&message);
+            }
+
+            /* Window must be destroyed on the thread that created it */
+            DestroyWindow(wnd_);
+            wnd_ = nullptr;
+        }
+    );
+
+    /* Wait until the window handle has been created */
+    {
+        std::unique_lock<std::mutex> lock { creationMutex };
+        creationCondVar.wait(lock, [&]() { return creationDone; });
+    }
+
+    /* Forward exception from window creation to the calling thread */
+    if (creationException)
+    {
+        eventLoopThread_.join();
+        std::rethrow_exception(creationException);
+    }
+}
+
+void Win32Window::StopEventLoopThread()
+{
+    /* Post quit message to the event loop thread, which destroys the window before it terminates */
+    PostThreadMessage(eventLoopThreadId_, WM_QUIT, 0, 0);
+    eventLoopThread_.join();
+    eventLoopThreadId_ = 0;
+}
+
 
 } // /namespace LLGL
 
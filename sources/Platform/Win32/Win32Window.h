@@ -11,6 +11,8 @@
 
 #include <LLGL/Window.h>
 #include <LLGL/Platform/NativeHandle.h>
+#include <atomic>
+#include <thread>
 
 
 namespace LLGL
@@ -47,17 +49,29 @@ class Win32Window final : public Window
 
         void SetDesc(const WindowDescriptor& desc) override;
 
+        // Accumulates the specified raw mouse motion; posted as a single coalesced event during "OnProcessEvents" (see Win32WindowCallback).
+        void AccumulateGlobalMotion(int dx, int dy);
+
     private:
 
         void OnProcessEvents() override;
 
         HWND CreateWindowHandle(const WindowDescriptor& desc);
 
+        void StartEventLoopThread(const WindowDescriptor& desc);
+        void StopEventLoopThread();
+
     private:
 
         WindowDescriptor    desc_;
-        NativeContextHandle contextHandle_;             // Must be initialized before "wnd_" member!
-        HWND                wnd_            = nullptr;
+        NativeContextHandle contextHandle_;                 // Must be initialized before "wnd_" member!
+        HWND                wnd_                = nullptr;
+
+        std::thread         eventLoopThread_;               // Dedicated thread that owns "wnd_" and runs the message pump
+        DWORD               eventLoopThreadId_  = 0;
+
+        std::atomic<int>    rawMotionX_         { 0 };      // Accumulated raw mouse motion (written by the message pump)
+        std::atomic<int>    rawMotionY_         { 0 };
 
 };
 
@@ -8,6 +8,7 @@
 #include "Win32WindowCallback.h"
 #include "Win32Window.h"
 #include "MapKey.h"
+#include <LLGL/Display.h>
 
 #include <windowsx.h>
 
@@ -164,11 +165,14 @@ static void PostGlobalMouseMotion(HWND wnd, LPARAM lParam)
 
             if (mouse.usFlags == MOUSE_MOVE_RELATIVE)
             {
-                /* Post global mouse motion event */
+                /*
+                Accumulate raw mouse motion instead of posting a separate event per message;
+                high-frequency mice would otherwise cause hundreds of listener dispatches per frame
+                */
                 int dx = mouse.lLastX;
                 int dy = mouse.lLastY;
 
-                window->PostGlobalMotion({ dx, dy });
+                window->AccumulateGlobalMotion(dx, dy);
             }
         }
     }
@@ -209,6 +213,13 @@ LRESULT CALLBACK Win32WindowCallback(HWND wnd, UINT msg, WPARAM wParam, LPARAM l
         }
         break;
 
+        case WM_DISPLAYCHANGE:
+        {
+            /* Invalidate cached display list when the display topology changed */
+            Display::InvalidateCachedList();
+        }
+        break;
+
         case WM_CLOSE:
         {
             /* Post close event to window */
@@ -7,12 +7,48 @@
 
 #include <LLGL/Window.h>
 #include "../Core/Helper.h"
+#include <mutex>
 
 
 namespace LLGL
 {
 
 
+/* ----- WindowEventQueue class ----- */
+
+// Thread-safe queue of deferred window events (see WindowDescriptor::threadedEventLoop).
+class WindowEventQueue
+{
+
+    public:
+
+        // Appends the specified event dispatch function to the queue.
+        void Enqueue(std::function<void()>&& event)
+        {
+            std::lock_guard<std::mutex> guard { mutex_ };
+            events_.push_back(std::move(event));
+        }
+
+        // Dispatches and removes all queued events.
+        void Flush()
+        {
+            std::vector<std::function<void()>> events;
+            {
+                std::lock_guard<std::mutex> guard { mutex_ };
+                events.swap(events_);
+            }
+            for (const auto& event : events)
+                event();
+        }
+
+    private:
+
+        std::mutex                          mutex_;
+        std::vector<std::function<void()>>  events_;
+
+};
+
+
 /* ----- Window EventListener class ----- */
 
 void Window::EventListener::OnProcessEvents(Window& sender)
@@ -140,9 +176,29 @@ bool Window::ProcessEvents()
 {
     FOREACH_LISTENER_CALL( OnProcessEvents(*this) );
     OnProcessEvents();
+
+    /* Dispatch all events that have been queued by another thread */
+    if (eventQueue_)
+        eventQueue_->Flush();
+
     return !HasQuit();
 }
 
+void Window::SetQueuedEventsEnabled(bool enabled)
+{
+    if (enabled)
+    {
+        if (!eventQueue_)
+            eventQueue_ = std::make_shared<WindowEventQueue>();
+    }
+    else if (eventQueue_)
+    {
+        /* Dispatch pending events before the queue is discarded */
+        eventQueue_->Flush();
+        eventQueue_.reset();
+    }
+}
+
 /* --- Event handling --- */
 
 void Window::AddEventListener(const std::shared_ptr<EventListener>& eventListener)
@@ -157,79 +213,107 @@ void Window::RemoveEventListener(const EventListener* eventListener)
 
 void Window::PostQuit()
 {
-    if (!HasQuit())
-    {
-        bool canQuit = true;
-        for (const auto& lst : eventListeners_)
+    PostOrDispatchEvent(
+        [this]()
         {
-            bool veto = false;
-            lst->OnQuit(*this, veto);
-            canQuit = (canQuit && !veto);
+            if (!HasQuit())
+            {
+                bool canQuit = true;
+                for (const auto& lst : eventListeners_)
+                {
+                    bool veto = false;
+                    lst->OnQuit(*this, veto);
+                    canQuit = (canQuit && !veto);
+                }
+                quit_ = canQuit;
+            }
         }
-        quit_ = canQuit;
-    }
+    );
 }
 
 void Window::PostKeyDown(Key keyCode)
 {
-    FOREACH_LISTENER_CALL( OnKeyDown(*this, keyCode) );
+    PostOrDispatchEvent([this, keyCode](){ FOREACH_LISTENER_CALL( OnKeyDown(*this, keyCode) ); });
 }
 
 void Window::PostKeyUp(Key keyCode)
 {
-    FOREACH_LISTENER_CALL( OnKeyUp(*this, keyCode) );
+    PostOrDispatchEvent([this, keyCode](){ FOREACH_LISTENER_CALL( OnKeyUp(*this, keyCode) ); });
 }
 
 void Window::PostDoubleClick(Key keyCode)
 {
-    FOREACH_LISTENER_CALL( OnDoubleClick(*this, keyCode) );
+    PostOrDispatchEvent([this, keyCode](){ FOREACH_LISTENER_CALL( OnDoubleClick(*this, keyCode) ); });
 }
 
 void Window::PostChar(wchar_t chr)
 {
-    FOREACH_LISTENER_CALL( OnChar(*this, chr) );
+    PostOrDispatchEvent([this, chr](){ FOREACH_LISTENER_CALL( OnChar(*this, chr) ); });
 }
 
 void Window::PostWheelMotion(int motion)
 {
-    FOREACH_LISTENER_CALL( OnWheelMotion(*this, motion) );
+    PostOrDispatchEvent([this, motion](){ FOREACH_LISTENER_CALL( OnWheelMotion(*this, motion) ); });
 }
 
 void Window::PostLocalMotion(const Offset2D& position)
 {
-    FOREACH_LISTENER_CALL( OnLocalMotion(*this, position) );
+    PostOrDispatchEvent([this, position](){ FOREACH_LISTENER_CALL( OnLocalMotion(*this, position) ); });
 }
 
 void Window::PostGlobalMotion(const Offset2D& motion)
 {
-    FOREACH_LISTENER_CALL( OnGlobalMotion(*this, motion) );
+    PostOrDispatchEvent([this, motion](){ FOREACH_LISTENER_CALL( OnGlobalMotion(*this, motion) ); });
 }
 
 void Window::PostResize(const Extent2D& clientAreaSize)
 {
-    FOREACH_LISTENER_CALL( OnResize(*this, clientAreaSize) );
+    PostOrDispatchEvent([this, clientAreaSize](){ FOREACH_LISTENER_CALL( OnResize(*this, clientAreaSize) ); });
 }
 
 void Window::PostGetFocus()
 {
-    focus_ = true;
-    FOREACH_LISTENER_CALL( OnGetFocus(*this) );
+    PostOrDispatchEvent(
+        [this]()
+        {
+            focus_ = true;
+            FOREACH_LISTENER_CALL( OnGetFocus(*this) );
+        }
+    );
 }
 
 void Window::PostLostFocus()
 {
-    focus_ = false;
-    FOREACH_LISTENER_CALL( OnLostFocus(*this) );
+    PostOrDispatchEvent(
+        [this]()
+        {
+            focus_ = false;
+            FOREACH_LISTENER_CALL( OnLostFocus(*this) );
+        }
+    );
 }
 
 void Window::PostTimer(std::uint32_t timerID)
 {
-    FOREACH_LISTENER_CALL( OnTimer(*this, timerID) );
+    PostOrDispatchEvent([this, timerID](){ FOREACH_LISTENER_CALL( OnTimer(*this, timerID) ); });
 }
 
 #undef FOREACH_LISTENER_CALL
 
 
+/*
+ * ======= Private: =======
+ */
+
+void Window::PostOrDispatchEvent(std::function<void()>&& event)
+{
+    if (eventQueue_)
+        eventQueue_->Enqueue(std::move(event));
+    else
+        event();
+}
+
+
 } // /namespace LLGL
 
 
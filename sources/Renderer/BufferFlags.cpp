@@ -6,6 +6,7 @@
  */
 
 #include <LLGL/BufferFlags.h>
+#include <LLGL/VertexFormatHandle.h>
 
 
 namespace LLGL
@@ -45,6 +46,14 @@ LLGL_EXPORT bool IsByteAddressBuffer(const StorageBufferType type)
     );
 }
 
+LLGL_EXPORT const std::vector<VertexAttribute>& GetBufferVertexAttribs(const BufferDescriptor& desc)
+{
+    if (desc.vertexFormatHandle != nullptr)
+        return desc.vertexFormatHandle->GetAttributes();
+    else
+        return desc.vertexAttribs;
+}
+
 
 } // /namespace LLGL
 
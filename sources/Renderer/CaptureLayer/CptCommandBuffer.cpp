@@ -0,0 +1,844 @@
+/*
+ * CptCommandBuffer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CptCommandBuffer.h"
+#include "CptRenderSystem.h"
+#include "CptRenderContext.h"
+#include "../CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+CptCommandBuffer::CptCommandBuffer(CommandBuffer& instance, CptRenderSystem& renderSystem, std::uint32_t objectID) :
+    instance      { instance                     },
+    renderSystem_ { renderSystem                 },
+    writer_       { renderSystem.GetTraceWriter() },
+    objectID_     { objectID                     }
+{
+}
+
+/* ----- Encoding ----- */
+
+void CptCommandBuffer::Begin()
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdBegin);
+    }
+    instance.Begin();
+}
+
+void CptCommandBuffer::End()
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdEnd);
+    }
+    instance.End();
+}
+
+void CptCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
+{
+    auto& commandBufferCpt = LLGL_CAST(CptCommandBuffer&, deferredCommandBuffer);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdExecute);
+        writer_.Write(commandBufferCpt.GetObjectID());
+    }
+    instance.Execute(commandBufferCpt.instance);
+}
+
+/* ----- Blitting ----- */
+
+void CptCommandBuffer::UpdateBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint16_t dataSize)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdUpdateBuffer);
+        writer_.Write(renderSystem_.GetObjectID(&dstBuffer));
+        writer_.Write(dstOffset);
+        writer_.WriteBlob(data, dataSize);
+    }
+    instance.UpdateBuffer(dstBuffer, dstOffset, data, dataSize);
+}
+
+void CptCommandBuffer::CopyBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdCopyBuffer);
+        writer_.Write(renderSystem_.GetObjectID(&dstBuffer));
+        writer_.Write(dstOffset);
+        writer_.Write(renderSystem_.GetObjectID(&srcBuffer));
+        writer_.Write(srcOffset);
+        writer_.Write(size);
+    }
+    instance.CopyBuffer(dstBuffer, dstOffset, srcBuffer, srcOffset, size);
+}
+
+void CptCommandBuffer::CopyTexture(
+    Texture& dstTexture, const TextureLocation& dstLocation, Texture& srcTexture, const TextureLocation& srcLocation, const Extent3D& extent)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdCopyTexture);
+        writer_.Write(renderSystem_.GetObjectID(&dstTexture));
+        writer_.Write(dstLocation);
+        writer_.Write(renderSystem_.GetObjectID(&srcTexture));
+        writer_.Write(srcLocation);
+        writer_.Write(extent);
+    }
+    instance.CopyTexture(dstTexture, dstLocation, srcTexture, srcLocation, extent);
+}
+
+void CptCommandBuffer::BeginCopyBatch()
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdBeginCopyBatch);
+    }
+    instance.BeginCopyBatch();
+}
+
+void CptCommandBuffer::EndCopyBatch()
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdEndCopyBatch);
+    }
+    instance.EndCopyBatch();
+}
+
+void CptCommandBuffer::GenerateMips(Texture& texture)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdGenerateMips);
+        writer_.Write(renderSystem_.GetObjectID(&texture));
+    }
+    instance.GenerateMips(texture);
+}
+
+void CptCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdGenerateMipsRange);
+        writer_.Write(renderSystem_.GetObjectID(&texture));
+        writer_.Write(subresource);
+    }
+    instance.GenerateMips(texture, subresource);
+}
+
+/* ----- Viewport and Scissor ----- */
+
+void CptCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetViewport);
+        writer_.Write(viewport);
+    }
+    instance.SetViewport(viewport);
+}
+
+void CptCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetViewports);
+        writer_.Write(numViewports);
+        for (std::uint32_t i = 0; i < numViewports; ++i)
+            writer_.Write(viewports[i]);
+    }
+    instance.SetViewports(numViewports, viewports);
+}
+
+void CptCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetScissor);
+        writer_.Write(scissor);
+    }
+    instance.SetScissor(scissor);
+}
+
+void CptCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetScissors);
+        writer_.Write(numScissors);
+        for (std::uint32_t i = 0; i < numScissors; ++i)
+            writer_.Write(scissors[i]);
+    }
+    instance.SetScissors(numScissors, scissors);
+}
+
+/* ----- Clear ----- */
+
+void CptCommandBuffer::SetClearColor(const ColorRGBAf& color)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetClearColor);
+        writer_.Write(color);
+    }
+    instance.SetClearColor(color);
+}
+
+void CptCommandBuffer::SetClearDepth(float depth)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetClearDepth);
+        writer_.Write(depth);
+    }
+    instance.SetClearDepth(depth);
+}
+
+void CptCommandBuffer::SetClearStencil(std::uint32_t stencil)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetClearStencil);
+        writer_.Write(stencil);
+    }
+    instance.SetClearStencil(stencil);
+}
+
+void CptCommandBuffer::Clear(long flags)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdClear);
+        writer_.Write(static_cast<std::int64_t>(flags));
+    }
+    instance.Clear(flags);
+}
+
+void CptCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdClearAttachments);
+        writer_.Write(numAttachments);
+        for (std::uint32_t i = 0; i < numAttachments; ++i)
+            writer_.Write(attachments[i]);
+    }
+    instance.ClearAttachments(numAttachments, attachments);
+}
+
+/* ----- Input Assembly ------ */
+
+void CptCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetVertexBuffer);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+    }
+    instance.SetVertexBuffer(buffer);
+}
+
+void CptCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetVertexBufferArray);
+        writer_.Write(renderSystem_.GetObjectID(&bufferArray));
+    }
+    instance.SetVertexBufferArray(bufferArray);
+}
+
+void CptCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetIndexBuffer);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+    }
+    instance.SetIndexBuffer(buffer);
+}
+
+void CptCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetIndexBufferExt);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+        writer_.Write(format);
+        writer_.Write(offset);
+    }
+    instance.SetIndexBuffer(buffer, format, offset);
+}
+
+/* ----- Stream Output Buffers ------ */
+
+void CptCommandBuffer::SetStreamOutputBuffer(Buffer& buffer)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetStreamOutputBuffer);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+    }
+    instance.SetStreamOutputBuffer(buffer);
+}
+
+void CptCommandBuffer::SetStreamOutputBufferArray(BufferArray& bufferArray)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetStreamOutputBufferArray);
+        writer_.Write(renderSystem_.GetObjectID(&bufferArray));
+    }
+    instance.SetStreamOutputBufferArray(bufferArray);
+}
+
+void CptCommandBuffer::BeginStreamOutput(const PrimitiveType primitiveType)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdBeginStreamOutput);
+        writer_.Write(primitiveType);
+    }
+    instance.BeginStreamOutput(primitiveType);
+}
+
+void CptCommandBuffer::EndStreamOutput()
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdEndStreamOutput);
+    }
+    instance.EndStreamOutput();
+}
+
+/* ----- Resources ----- */
+
+void CptCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetGraphicsResourceHeap);
+        writer_.Write(renderSystem_.GetObjectID(&resourceHeap));
+        writer_.Write(firstSet);
+    }
+    instance.SetGraphicsResourceHeap(resourceHeap, firstSet);
+}
+
+void CptCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetComputeResourceHeap);
+        writer_.Write(renderSystem_.GetObjectID(&resourceHeap));
+        writer_.Write(firstSet);
+    }
+    instance.SetComputeResourceHeap(resourceHeap, firstSet);
+}
+
+void CptCommandBuffer::SetGraphicsResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetGraphicsResourceHeapDynamic);
+        writer_.Write(renderSystem_.GetObjectID(&resourceHeap));
+        writer_.Write(firstSet);
+        writer_.Write(numDynamicOffsets);
+        writer_.WriteBlob(dynamicOffsets, sizeof(std::uint32_t) * numDynamicOffsets);
+    }
+    instance.SetGraphicsResourceHeap(resourceHeap, firstSet, numDynamicOffsets, dynamicOffsets);
+}
+
+void CptCommandBuffer::SetComputeResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetComputeResourceHeapDynamic);
+        writer_.Write(renderSystem_.GetObjectID(&resourceHeap));
+        writer_.Write(firstSet);
+        writer_.Write(numDynamicOffsets);
+        writer_.WriteBlob(dynamicOffsets, sizeof(std::uint32_t) * numDynamicOffsets);
+    }
+    instance.SetComputeResourceHeap(resourceHeap, firstSet, numDynamicOffsets, dynamicOffsets);
+}
+
+void CptCommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetResource);
+        writer_.Write(renderSystem_.GetObjectID(&resource));
+        writer_.Write(slot);
+        writer_.Write(static_cast<std::int64_t>(bindFlags));
+        writer_.Write(static_cast<std::int64_t>(stageFlags));
+    }
+    instance.SetResource(resource, slot, bindFlags, stageFlags);
+}
+
+void CptCommandBuffer::ResetResourceSlots(
+    const ResourceType resourceType, std::uint32_t firstSlot, std::uint32_t numSlots, long bindFlags, long stageFlags)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdResetResourceSlots);
+        writer_.Write(resourceType);
+        writer_.Write(firstSlot);
+        writer_.Write(numSlots);
+        writer_.Write(static_cast<std::int64_t>(bindFlags));
+        writer_.Write(static_cast<std::int64_t>(stageFlags));
+    }
+    instance.ResetResourceSlots(resourceType, firstSlot, numSlots, bindFlags, stageFlags);
+}
+
+void CptCommandBuffer::BeginResourceTransition(Resource& resource, long bindFlags)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdBeginResourceTransition);
+        writer_.Write(renderSystem_.GetObjectID(&resource));
+        writer_.Write(static_cast<std::int64_t>(bindFlags));
+    }
+    instance.BeginResourceTransition(resource, bindFlags);
+}
+
+void CptCommandBuffer::EndResourceTransition(Resource& resource, long bindFlags)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdEndResourceTransition);
+        writer_.Write(renderSystem_.GetObjectID(&resource));
+        writer_.Write(static_cast<std::int64_t>(bindFlags));
+    }
+    instance.EndResourceTransition(resource, bindFlags);
+}
+
+/* ----- Render Passes ----- */
+
+void CptCommandBuffer::BeginRenderPass(
+    RenderTarget& renderTarget, const RenderPass* renderPass, std::uint32_t numClearValues, const ClearValue* clearValues)
+{
+    /* Resolve the wrapped instance for render contexts; render targets are not wrapped */
+    RenderTarget*   renderTargetInstance    = &renderTarget;
+    std::uint32_t   renderTargetID          = cptInvalidID;
+
+    if (renderTarget.IsRenderContext())
+    {
+        auto& renderContextCpt = LLGL_CAST(CptRenderContext&, renderTarget);
+        renderTargetInstance    = &(renderContextCpt.instance);
+        renderTargetID          = renderContextCpt.GetObjectID();
+    }
+    else
+        renderTargetID = renderSystem_.GetObjectID(&renderTarget);
+
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdBeginRenderPass);
+        writer_.Write(renderTargetID);
+        writer_.Write(renderSystem_.GetObjectID(renderPass));
+        writer_.Write(numClearValues);
+        for (std::uint32_t i = 0; i < numClearValues; ++i)
+            writer_.Write(clearValues[i]);
+    }
+
+    instance.BeginRenderPass(*renderTargetInstance, renderPass, numClearValues, clearValues);
+}
+
+void CptCommandBuffer::EndRenderPass()
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdEndRenderPass);
+    }
+    instance.EndRenderPass();
+}
+
+/* ----- Pipeline States ----- */
+
+void CptCommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetGraphicsPipeline);
+        writer_.Write(renderSystem_.GetObjectID(&graphicsPipeline));
+    }
+    instance.SetGraphicsPipeline(graphicsPipeline);
+}
+
+void CptCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetComputePipeline);
+        writer_.Write(renderSystem_.GetObjectID(&computePipeline));
+    }
+    instance.SetComputePipeline(computePipeline);
+}
+
+void CptCommandBuffer::SetUniform(UniformLocation location, const void* data, std::uint32_t dataSize)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetUniform);
+        writer_.Write(location);
+        writer_.WriteBlob(data, dataSize);
+    }
+    instance.SetUniform(location, data, dataSize);
+}
+
+void CptCommandBuffer::SetUniforms(UniformLocation location, std::uint32_t count, const void* data, std::uint32_t dataSize)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdSetUniforms);
+        writer_.Write(location);
+        writer_.Write(count);
+        writer_.WriteBlob(data, dataSize);
+    }
+    instance.SetUniforms(location, count, data, dataSize);
+}
+
+/* ----- Queries ----- */
+
+void CptCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdBeginQuery);
+        writer_.Write(renderSystem_.GetObjectID(&queryHeap));
+        writer_.Write(query);
+    }
+    instance.BeginQuery(queryHeap, query);
+}
+
+void CptCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdEndQuery);
+        writer_.Write(renderSystem_.GetObjectID(&queryHeap));
+        writer_.Write(query);
+    }
+    instance.EndQuery(queryHeap, query);
+}
+
+void CptCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdBeginRenderCondition);
+        writer_.Write(renderSystem_.GetObjectID(&queryHeap));
+        writer_.Write(query);
+        writer_.Write(mode);
+    }
+    instance.BeginRenderCondition(queryHeap, query, mode);
+}
+
+void CptCommandBuffer::EndRenderCondition()
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdEndRenderCondition);
+    }
+    instance.EndRenderCondition();
+}
+
+/* ----- Drawing ----- */
+
+void CptCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDraw);
+        writer_.Write(numVertices);
+        writer_.Write(firstVertex);
+    }
+    instance.Draw(numVertices, firstVertex);
+}
+
+void CptCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndexed);
+        writer_.Write(numIndices);
+        writer_.Write(firstIndex);
+    }
+    instance.DrawIndexed(numIndices, firstIndex);
+}
+
+void CptCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndexedExt);
+        writer_.Write(numIndices);
+        writer_.Write(firstIndex);
+        writer_.Write(vertexOffset);
+    }
+    instance.DrawIndexed(numIndices, firstIndex, vertexOffset);
+}
+
+void CptCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawInstanced);
+        writer_.Write(numVertices);
+        writer_.Write(firstVertex);
+        writer_.Write(numInstances);
+    }
+    instance.DrawInstanced(numVertices, firstVertex, numInstances);
+}
+
+void CptCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawInstancedExt);
+        writer_.Write(numVertices);
+        writer_.Write(firstVertex);
+        writer_.Write(numInstances);
+        writer_.Write(firstInstance);
+    }
+    instance.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+}
+
+void CptCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndexedInstanced);
+        writer_.Write(numIndices);
+        writer_.Write(numInstances);
+        writer_.Write(firstIndex);
+    }
+    instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex);
+}
+
+void CptCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndexedInstancedExt);
+        writer_.Write(numIndices);
+        writer_.Write(numInstances);
+        writer_.Write(firstIndex);
+        writer_.Write(vertexOffset);
+    }
+    instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset);
+}
+
+void CptCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndexedInstancedExt2);
+        writer_.Write(numIndices);
+        writer_.Write(numInstances);
+        writer_.Write(firstIndex);
+        writer_.Write(vertexOffset);
+        writer_.Write(firstInstance);
+    }
+    instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+}
+
+void CptCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndirect);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+        writer_.Write(offset);
+    }
+    instance.DrawIndirect(buffer, offset);
+}
+
+void CptCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndirectExt);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+        writer_.Write(offset);
+        writer_.Write(numCommands);
+        writer_.Write(stride);
+    }
+    instance.DrawIndirect(buffer, offset, numCommands, stride);
+}
+
+void CptCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndirectCount);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+        writer_.Write(offset);
+        writer_.Write(renderSystem_.GetObjectID(&countBuffer));
+        writer_.Write(countOffset);
+        writer_.Write(maxNumCommands);
+        writer_.Write(stride);
+    }
+    instance.DrawIndirect(buffer, offset, countBuffer, countOffset, maxNumCommands, stride);
+}
+
+void CptCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndexedIndirect);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+        writer_.Write(offset);
+    }
+    instance.DrawIndexedIndirect(buffer, offset);
+}
+
+void CptCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndexedIndirectExt);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+        writer_.Write(offset);
+        writer_.Write(numCommands);
+        writer_.Write(stride);
+    }
+    instance.DrawIndexedIndirect(buffer, offset, numCommands, stride);
+}
+
+void CptCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndexedIndirectCount);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+        writer_.Write(offset);
+        writer_.Write(renderSystem_.GetObjectID(&countBuffer));
+        writer_.Write(countOffset);
+        writer_.Write(maxNumCommands);
+        writer_.Write(stride);
+    }
+    instance.DrawIndexedIndirect(buffer, offset, countBuffer, countOffset, maxNumCommands, stride);
+}
+
+void CptCommandBuffer::DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawMulti);
+        writer_.Write(numCommands);
+        writer_.WriteBlob(commands, sizeof(DrawIndirectArguments) * numCommands);
+    }
+    instance.DrawMulti(numCommands, commands);
+}
+
+void CptCommandBuffer::DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawIndexedMulti);
+        writer_.Write(numCommands);
+        writer_.WriteBlob(commands, sizeof(DrawIndexedIndirectArguments) * numCommands);
+    }
+    instance.DrawIndexedMulti(numCommands, commands);
+}
+
+void CptCommandBuffer::DrawMeshTasks(std::uint32_t numWorkGroups, std::uint32_t firstWorkGroup)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDrawMeshTasks);
+        writer_.Write(numWorkGroups);
+        writer_.Write(firstWorkGroup);
+    }
+    instance.DrawMeshTasks(numWorkGroups, firstWorkGroup);
+}
+
+/* ----- Compute ----- */
+
+void CptCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDispatch);
+        writer_.Write(numWorkGroupsX);
+        writer_.Write(numWorkGroupsY);
+        writer_.Write(numWorkGroupsZ);
+    }
+    instance.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+}
+
+void CptCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdDispatchIndirect);
+        writer_.Write(renderSystem_.GetObjectID(&buffer));
+        writer_.Write(offset);
+    }
+    instance.DispatchIndirect(buffer, offset);
+}
+
+/* ----- Debugging ----- */
+
+void CptCommandBuffer::PushDebugGroup(const char* name)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdPushDebugGroup);
+        writer_.WriteString(name);
+    }
+    instance.PushDebugGroup(name);
+}
+
+void CptCommandBuffer::PopDebugGroup()
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        BeginCmd(CptOpcode::CmdPopDebugGroup);
+    }
+    instance.PopDebugGroup();
+}
+
+/* ----- Extensions ----- */
+
+void CptCommandBuffer::SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize)
+{
+    /* Backend specific state cannot be replayed portably */
+    renderSystem_.PostUncapturedCall("SetGraphicsAPIDependentState");
+    instance.SetGraphicsAPIDependentState(stateDesc, stateDescSize);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void CptCommandBuffer::BeginCmd(const CptOpcode opcode)
+{
+    writer_.WriteOp(opcode);
+    writer_.Write(objectID_);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,236 @@
+/*
+ * CptCommandBuffer.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CPT_COMMAND_BUFFER_H
+#define LLGL_CPT_COMMAND_BUFFER_H
+
+
+#include <LLGL/CommandBuffer.h>
+#include "CptTrace.h"
+
+
+namespace LLGL
+{
+
+
+class CptRenderSystem;
+
+class CptCommandBuffer final : public CommandBuffer
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        CptCommandBuffer(CommandBuffer& instance, CptRenderSystem& renderSystem, std::uint32_t objectID);
+
+        /* ----- Encoding ----- */
+
+        void Begin() override;
+        void End() override;
+
+        void Execute(CommandBuffer& deferredCommandBuffer) override;
+
+        /* ----- Blitting ----- */
+
+        void UpdateBuffer(
+            Buffer&         dstBuffer,
+            std::uint64_t   dstOffset,
+            const void*     data,
+            std::uint16_t   dataSize
+        ) override;
+
+        void CopyBuffer(
+            Buffer&         dstBuffer,
+            std::uint64_t   dstOffset,
+            Buffer&         srcBuffer,
+            std::uint64_t   srcOffset,
+            std::uint64_t   size
+        ) override;
+
+        void CopyTexture(
+            Texture&                dstTexture,
+            const TextureLocation&  dstLocation,
+            Texture&                srcTexture,
+            const TextureLocation&  srcLocation,
+            const Extent3D&         extent
+        ) override;
+
+        void BeginCopyBatch() override;
+        void EndCopyBatch() override;
+
+        void GenerateMips(Texture& texture) override;
+        void GenerateMips(Texture& texture, const TextureSubresource& subresource) override;
+
+        /* ----- Viewport and Scissor ----- */
+
+        void SetViewport(const Viewport& viewport) override;
+        void SetViewports(std::uint32_t numViewports, const Viewport* viewports) override;
+
+        void SetScissor(const Scissor& scissor) override;
+        void SetScissors(std::uint32_t numScissors, const Scissor* scissors) override;
+
+        /* ----- Clear ----- */
+
+        void SetClearColor(const ColorRGBAf& color) override;
+        void SetClearDepth(float depth) override;
+        void SetClearStencil(std::uint32_t stencil) override;
+
+        void Clear(long flags) override;
+        void ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments) override;
+
+        /* ----- Input Assembly ------ */
+
+        void SetVertexBuffer(Buffer& buffer) override;
+        void SetVertexBufferArray(BufferArray& bufferArray) override;
+
+        void SetIndexBuffer(Buffer& buffer) override;
+        void SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset = 0) override;
+
+        /* ----- Stream Output Buffers ------ */
+
+        void SetStreamOutputBuffer(Buffer& buffer) override;
+        void SetStreamOutputBufferArray(BufferArray& bufferArray) override;
+
+        void BeginStreamOutput(const PrimitiveType primitiveType) override;
+        void EndStreamOutput() override;
+
+        /* ----- Resources ----- */
+
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
+
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets) override;
+
+        void SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags = StageFlags::AllStages) override;
+
+        void ResetResourceSlots(
+            const ResourceType  resourceType,
+            std::uint32_t       firstSlot,
+            std::uint32_t       numSlots,
+            long                bindFlags,
+            long                stageFlags      = StageFlags::AllStages
+        ) override;
+
+        void BeginResourceTransition(Resource& resource, long bindFlags) override;
+        void EndResourceTransition(Resource& resource, long bindFlags) override;
+
+        /* ----- Render Passes ----- */
+
+        void BeginRenderPass(
+            RenderTarget&       renderTarget,
+            const RenderPass*   renderPass      = nullptr,
+            std::uint32_t       numClearValues  = 0,
+            const ClearValue*   clearValues     = nullptr
+        ) override;
+
+        void EndRenderPass() override;
+
+        /* ----- Pipeline States ----- */
+
+        void SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline) override;
+        void SetComputePipeline(ComputePipeline& computePipeline) override;
+
+        void SetUniform(
+            UniformLocation location,
+            const void*     data,
+            std::uint32_t   dataSize
+        ) override;
+
+        void SetUniforms(
+            UniformLocation location,
+            std::uint32_t   count,
+            const void*     data,
+            std::uint32_t   dataSize
+        ) override;
+
+        /* ----- Queries ----- */
+
+        void BeginQuery(QueryHeap& queryHeap, std::uint32_t query = 0) override;
+        void EndQuery(QueryHeap& queryHeap, std::uint32_t query = 0) override;
+
+        void BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query = 0, const RenderConditionMode mode = RenderConditionMode::Wait) override;
+        void EndRenderCondition() override;
+
+        /* ----- Drawing ----- */
+
+        void Draw(std::uint32_t numVertices, std::uint32_t firstVertex) override;
+
+        void DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex) override;
+        void DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset) override;
+
+        void DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances) override;
+        void DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance) override;
+
+        void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex) override;
+        void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset) override;
+        void DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance) override;
+
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset) override;
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands) override;
+        void DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands) override;
+
+        void DrawMeshTasks(std::uint32_t numWorkGroups, std::uint32_t firstWorkGroup = 0) override;
+
+        /* ----- Compute ----- */
+
+        void Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ) override;
+        void DispatchIndirect(Buffer& buffer, std::uint64_t offset) override;
+
+        /* ----- Debugging ----- */
+
+        void PushDebugGroup(const char* name) override;
+        void PopDebugGroup() override;
+
+        /* ----- Extensions ----- */
+
+        void SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize) override;
+
+    public:
+
+        /* ----- Internal ----- */
+
+        // Returns the object ID of this command buffer within the trace.
+        inline std::uint32_t GetObjectID() const
+        {
+            return objectID_;
+        }
+
+    public:
+
+        CommandBuffer& instance;
+
+    private:
+
+        // Writes the opcode and the ID of this command buffer; the writer mutex must be held.
+        void BeginCmd(const CptOpcode opcode);
+
+    private:
+
+        CptRenderSystem&    renderSystem_;
+        CptTraceWriter&     writer_;
+        std::uint32_t       objectID_ = cptInvalidID;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,183 @@
+/*
+ * CptCommandQueue.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CptCommandQueue.h"
+#include "CptCommandBuffer.h"
+#include "CptRenderSystem.h"
+#include "../CheckedCast.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+CptCommandQueue::CptCommandQueue(CommandQueue& instance, CptRenderSystem& renderSystem) :
+    instance_     { instance     },
+    renderSystem_ { renderSystem }
+{
+}
+
+/* ----- Command Buffers ----- */
+
+void CptCommandQueue::Submit(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferCpt = LLGL_CAST(CptCommandBuffer&, commandBuffer);
+    {
+        auto& writer = renderSystem_.GetTraceWriter();
+        std::lock_guard<std::mutex> guard { writer.GetMutex() };
+        writer.WriteOp(CptOpcode::QueueSubmit);
+        writer.Write(commandBufferCpt.GetObjectID());
+    }
+    instance_.Submit(commandBufferCpt.instance);
+}
+
+void CptCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    {
+        auto& writer = renderSystem_.GetTraceWriter();
+        std::lock_guard<std::mutex> guard { writer.GetMutex() };
+        writer.WriteOp(CptOpcode::QueueSubmitBatch);
+        writer.Write(numCommandBuffers);
+        for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+        {
+            auto commandBufferCpt = LLGL_CAST(CptCommandBuffer*, commandBuffers[i]);
+            writer.Write(commandBufferCpt->GetObjectID());
+        }
+    }
+
+    /* Unwrap command buffers and forward the entire batch to the instance queue */
+    std::vector<CommandBuffer*> instanceCommandBuffers;
+    instanceCommandBuffers.reserve(numCommandBuffers);
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferCpt = LLGL_CAST(CptCommandBuffer*, commandBuffers[i]);
+        instanceCommandBuffers.push_back(&(commandBufferCpt->instance));
+    }
+
+    instance_.Submit(numCommandBuffers, instanceCommandBuffers.data());
+}
+
+/* ----- Queries ----- */
+
+bool CptCommandQueue::QueryResult(
+    QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize)
+{
+    /* Query results are an output of the workload; nothing to capture */
+    return instance_.QueryResult(queryHeap, firstQuery, numQueries, data, dataSize);
+}
+
+bool CptCommandQueue::QueryResultAvailable(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries)
+{
+    return instance_.QueryResultAvailable(queryHeap, firstQuery, numQueries);
+}
+
+/* ----- Fences ----- */
+
+void CptCommandQueue::Submit(Fence& fence)
+{
+    {
+        auto& writer = renderSystem_.GetTraceWriter();
+        std::lock_guard<std::mutex> guard { writer.GetMutex() };
+        writer.WriteOp(CptOpcode::QueueSubmitFence);
+        writer.Write(renderSystem_.GetObjectID(&fence));
+    }
+    instance_.Submit(fence);
+}
+
+void CptCommandQueue::Wait(Fence& fence)
+{
+    {
+        auto& writer = renderSystem_.GetTraceWriter();
+        std::lock_guard<std::mutex> guard { writer.GetMutex() };
+        writer.WriteOp(CptOpcode::QueueWaitFenceGpu);
+        writer.Write(renderSystem_.GetObjectID(&fence));
+    }
+    instance_.Wait(fence);
+}
+
+bool CptCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
+{
+    {
+        auto& writer = renderSystem_.GetTraceWriter();
+        std::lock_guard<std::mutex> guard { writer.GetMutex() };
+        writer.WriteOp(CptOpcode::QueueWaitFence);
+        writer.Write(renderSystem_.GetObjectID(&fence));
+        writer.Write(timeout);
+    }
+    return instance_.WaitFence(fence, timeout);
+}
+
+bool CptCommandQueue::WaitFences(std::uint32_t numFences, Fence* const * fences, bool waitAll, std::uint64_t timeout)
+{
+    {
+        auto& writer = renderSystem_.GetTraceWriter();
+        std::lock_guard<std::mutex> guard { writer.GetMutex() };
+        writer.WriteOp(CptOpcode::QueueWaitFences);
+        writer.Write(numFences);
+        for (std::uint32_t i = 0; i < numFences; ++i)
+            writer.Write(renderSystem_.GetObjectID(fences[i]));
+        writer.Write(static_cast<std::uint8_t>(waitAll ? 1 : 0));
+        writer.Write(timeout);
+    }
+    return instance_.WaitFences(numFences, fences, waitAll, timeout);
+}
+
+bool CptCommandQueue::IsSignaled(Fence& fence)
+{
+    /* Fence status is an output of the workload; nothing to capture */
+    return instance_.IsSignaled(fence);
+}
+
+void CptCommandQueue::Signal(Fence& fence, std::uint64_t value)
+{
+    {
+        auto& writer = renderSystem_.GetTraceWriter();
+        std::lock_guard<std::mutex> guard { writer.GetMutex() };
+        writer.WriteOp(CptOpcode::QueueSignalFence);
+        writer.Write(renderSystem_.GetObjectID(&fence));
+        writer.Write(value);
+    }
+    instance_.Signal(fence, value);
+}
+
+bool CptCommandQueue::WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    {
+        auto& writer = renderSystem_.GetTraceWriter();
+        std::lock_guard<std::mutex> guard { writer.GetMutex() };
+        writer.WriteOp(CptOpcode::QueueWaitFenceValue);
+        writer.Write(renderSystem_.GetObjectID(&fence));
+        writer.Write(value);
+        writer.Write(timeout);
+    }
+    return instance_.WaitFenceValue(fence, value, timeout);
+}
+
+std::uint64_t CptCommandQueue::GetFenceValue(Fence& fence)
+{
+    /* Fence values are an output of the workload; nothing to capture */
+    return instance_.GetFenceValue(fence);
+}
+
+void CptCommandQueue::WaitIdle()
+{
+    {
+        auto& writer = renderSystem_.GetTraceWriter();
+        std::lock_guard<std::mutex> guard { writer.GetMutex() };
+        writer.WriteOp(CptOpcode::QueueWaitIdle);
+    }
+    instance_.WaitIdle();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,81 @@
+/*
+ * CptCommandQueue.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CPT_COMMAND_QUEUE_H
+#define LLGL_CPT_COMMAND_QUEUE_H
+
+
+#include <LLGL/CommandQueue.h>
+
+
+namespace LLGL
+{
+
+
+class CptRenderSystem;
+
+class CptCommandQueue final : public CommandQueue
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        CptCommandQueue(CommandQueue& instance, CptRenderSystem& renderSystem);
+
+        /* ----- Command Buffers ----- */
+
+        void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        /* ----- Queries ----- */
+
+        bool QueryResult(
+            QueryHeap&      queryHeap,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries,
+            void*           data,
+            std::size_t     dataSize
+        ) override;
+
+        bool QueryResultAvailable(
+            QueryHeap&      queryHeap,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries
+        ) override;
+
+        /* ----- Fences ----- */
+
+        void Submit(Fence& fence) override;
+        void Wait(Fence& fence) override;
+
+        bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+        bool WaitFences(std::uint32_t numFences, Fence* const * fences, bool waitAll, std::uint64_t timeout) override;
+        bool IsSignaled(Fence& fence) override;
+
+        void Signal(Fence& fence, std::uint64_t value) override;
+        bool WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout) override;
+        std::uint64_t GetFenceValue(Fence& fence) override;
+
+        void WaitIdle() override;
+
+    private:
+
+        CommandQueue&       instance_;
+        CptRenderSystem&    renderSystem_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
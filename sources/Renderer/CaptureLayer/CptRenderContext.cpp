@@ -0,0 +1,72 @@
+/*
+ * CptRenderContext.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CptRenderContext.h"
+
+
+namespace LLGL
+{
+
+
+CptRenderContext::CptRenderContext(RenderContext& instance, CptTraceWriter& writer, std::uint32_t objectID) :
+    instance  { instance },
+    writer_   { writer   },
+    objectID_ { objectID }
+{
+    ShareSurfaceAndConfig(instance);
+}
+
+void CptRenderContext::Present()
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::ContextPresent);
+        writer_.Write(objectID_);
+    }
+    instance.Present();
+}
+
+Format CptRenderContext::GetColorFormat() const
+{
+    return instance.GetColorFormat();
+}
+
+Format CptRenderContext::GetDepthStencilFormat() const
+{
+    return instance.GetDepthStencilFormat();
+}
+
+const RenderPass* CptRenderContext::GetRenderPass() const
+{
+    return instance.GetRenderPass();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool CptRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
+{
+    auto result = instance.SetVideoMode(videoModeDesc);
+    ShareSurfaceAndConfig(instance);
+    return result;
+}
+
+bool CptRenderContext::OnSetVsync(const VsyncDescriptor& vsyncDesc)
+{
+    auto result = instance.SetVsync(vsyncDesc);
+    ShareSurfaceAndConfig(instance);
+    return result;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,66 @@
+/*
+ * CptRenderContext.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CPT_RENDER_CONTEXT_H
+#define LLGL_CPT_RENDER_CONTEXT_H
+
+
+#include <LLGL/RenderContext.h>
+#include "CptTrace.h"
+
+
+namespace LLGL
+{
+
+
+class CptRenderContext final : public RenderContext
+{
+
+    public:
+
+        void Present() override;
+
+        Format GetColorFormat() const override;
+        Format GetDepthStencilFormat() const override;
+
+        const RenderPass* GetRenderPass() const override;
+
+    public:
+
+        CptRenderContext(RenderContext& instance, CptTraceWriter& writer, std::uint32_t objectID);
+
+        // Returns the object ID of this render context within the trace.
+        inline std::uint32_t GetObjectID() const
+        {
+            return objectID_;
+        }
+
+    public:
+
+        RenderContext& instance;
+
+    private:
+
+        bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
+        bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
+
+    private:
+
+        CptTraceWriter& writer_;
+        std::uint32_t   objectID_ = cptInvalidID;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
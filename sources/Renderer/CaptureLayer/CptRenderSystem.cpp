@@ -0,0 +1,713 @@
+/*
+ * CptRenderSystem.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CptRenderSystem.h"
+#include "../CheckedCast.h"
+#include "../../Core/Helper.h"
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Log.h>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/*
+~~~~~~ INFO ~~~~~~
+This is the capture layer render system. All calls are forwarded to the wrapped
+instance and serialized to a binary trace file (see CptTrace.h). Only render
+contexts and command buffers are wrapped into "Cpt..." objects (they must
+intercept further calls); all other objects are returned unmodified and merely
+registered in the object ID table to refer to them within the trace.
+*/
+
+CptRenderSystem::CptRenderSystem(const std::shared_ptr<RenderSystem>& instance, const char* filename) :
+    instance_ { instance }
+{
+    writer_.Open(filename, instance_->GetRendererID());
+}
+
+CptRenderSystem::~CptRenderSystem()
+{
+    if (uncapturedCalls_ > 0)
+    {
+        Log::PostReport(
+            Log::ReportType::Information,
+            "capture layer: " + std::to_string(uncapturedCalls_) + " call(s) with uncapturable input data were forwarded but not recorded"
+        );
+    }
+}
+
+/* ----- Render Context ----- */
+
+RenderContext* CptRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
+{
+    auto renderContextInstance = instance_->CreateRenderContext(desc, surface);
+
+    if (!commandQueue_)
+    {
+        /* Store meta data about render system */
+        SetRendererInfo(instance_->GetRendererInfo());
+        SetRenderingCaps(instance_->GetRenderingCaps());
+
+        /* Instantiate command queue */
+        commandQueue_ = MakeUnique<CptCommandQueue>(*(instance_->GetCommandQueue()), *this);
+    }
+
+    auto renderContextCpt = MakeUnique<CptRenderContext>(*renderContextInstance, writer_, RegisterObject(nullptr));
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateRenderContext);
+        writer_.Write(renderContextCpt->GetObjectID());
+        writer_.Write(desc);
+    }
+
+    return TakeOwnership(renderContexts_, std::move(renderContextCpt));
+}
+
+void CptRenderSystem::Release(RenderContext& renderContext)
+{
+    auto& renderContextCpt = LLGL_CAST(CptRenderContext&, renderContext);
+    RecordRelease(renderContextCpt.GetObjectID());
+    instance_->Release(renderContextCpt.instance);
+    RemoveFromUniqueSet(renderContexts_, &renderContext);
+}
+
+/* ----- Command queues ----- */
+
+CommandQueue* CptRenderSystem::GetCommandQueue()
+{
+    return commandQueue_.get();
+}
+
+std::uint32_t CptRenderSystem::GetNumCommandQueues(const CommandQueueType queueType)
+{
+    /* Trace operations do not record a queue identity, so only the primary queue is exposed while capturing */
+    return (queueType == CommandQueueType::Graphics ? 1u : 0u);
+}
+
+CommandQueue* CptRenderSystem::GetCommandQueue(const CommandQueueType queueType, std::uint32_t index)
+{
+    if (queueType == CommandQueueType::Graphics && index == 0)
+        return commandQueue_.get();
+    else
+        return nullptr;
+}
+
+/* ----- Command buffers ----- */
+
+CommandBuffer* CptRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
+{
+    auto commandBufferCpt = MakeUnique<CptCommandBuffer>(*instance_->CreateCommandBuffer(desc), *this, RegisterObject(nullptr));
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateCommandBuffer);
+        writer_.Write(commandBufferCpt->GetObjectID());
+        writer_.Write(static_cast<std::int64_t>(desc.flags));
+        writer_.Write(desc.numNativeBuffers);
+    }
+    return TakeOwnership(commandBuffers_, std::move(commandBufferCpt));
+}
+
+void CptRenderSystem::Release(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferCpt = LLGL_CAST(CptCommandBuffer&, commandBuffer);
+    RecordRelease(commandBufferCpt.GetObjectID());
+    instance_->Release(commandBufferCpt.instance);
+    RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
+}
+
+/* ----- Buffers ------ */
+
+Buffer* CptRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
+{
+    auto buffer = instance_->CreateBuffer(desc, initialData);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateBuffer);
+        writer_.Write(RegisterObject(buffer));
+        writer_.Write(desc.size);
+        writer_.Write(static_cast<std::int64_t>(desc.bindFlags));
+        writer_.Write(static_cast<std::int64_t>(desc.cpuAccessFlags));
+        writer_.Write(static_cast<std::int64_t>(desc.miscFlags));
+        WriteVertexAttributes(GetBufferVertexAttribs(desc));
+        writer_.Write(desc.indexFormat);
+        writer_.Write(desc.storageBuffer);
+        writer_.WriteBlob(initialData, (initialData != nullptr ? desc.size : 0));
+    }
+    return buffer;
+}
+
+BufferArray* CptRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    auto bufferArrayInstance = instance_->CreateBufferArray(numBuffers, bufferArray);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateBufferArray);
+        writer_.Write(RegisterObject(bufferArrayInstance));
+        writer_.Write(numBuffers);
+        for (std::uint32_t i = 0; i < numBuffers; ++i)
+            writer_.Write(GetObjectID(bufferArray[i]));
+    }
+    return bufferArrayInstance;
+}
+
+void CptRenderSystem::Release(Buffer& buffer)
+{
+    ReleaseObject(&buffer);
+    instance_->Release(buffer);
+}
+
+void CptRenderSystem::Release(BufferArray& bufferArray)
+{
+    ReleaseObject(&bufferArray);
+    instance_->Release(bufferArray);
+}
+
+void CptRenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::WriteBuffer);
+        writer_.Write(GetObjectID(&dstBuffer));
+        writer_.Write(dstOffset);
+        writer_.WriteBlob(data, dataSize);
+    }
+    instance_->WriteBuffer(dstBuffer, dstOffset, data, dataSize);
+}
+
+void* CptRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
+{
+    /* Buffer content written through the mapped pointer cannot be captured */
+    if (access != CPUAccess::ReadOnly)
+        PostUncapturedCall("MapBuffer");
+    return instance_->MapBuffer(buffer, access);
+}
+
+void CptRenderSystem::UnmapBuffer(Buffer& buffer)
+{
+    instance_->UnmapBuffer(buffer);
+}
+
+/* ----- Textures ----- */
+
+Texture* CptRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
+{
+    auto texture = instance_->CreateTexture(textureDesc, imageDesc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateTexture);
+        writer_.Write(RegisterObject(texture));
+        writer_.Write(textureDesc.type);
+        writer_.Write(static_cast<std::int64_t>(textureDesc.bindFlags));
+        writer_.Write(static_cast<std::int64_t>(textureDesc.cpuAccessFlags));
+        writer_.Write(static_cast<std::int64_t>(textureDesc.miscFlags));
+        writer_.Write(textureDesc.format);
+        writer_.Write(textureDesc.extent);
+        writer_.Write(textureDesc.arrayLayers);
+        writer_.Write(textureDesc.mipLevels);
+        writer_.Write(textureDesc.samples);
+        WriteImageData(imageDesc);
+    }
+    return texture;
+}
+
+Texture* CptRenderSystem::CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc)
+{
+    auto texture = instance_->CreateTextureView(sharedTexture, textureViewDesc);
+    if (texture != nullptr)
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateTextureView);
+        writer_.Write(RegisterObject(texture));
+        writer_.Write(GetObjectID(&sharedTexture));
+        writer_.Write(textureViewDesc);
+    }
+    return texture;
+}
+
+void CptRenderSystem::Release(Texture& texture)
+{
+    ReleaseObject(&texture);
+    instance_->Release(texture);
+}
+
+void CptRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::WriteTexture);
+        writer_.Write(GetObjectID(&texture));
+        writer_.Write(textureRegion);
+        WriteImageData(&imageDesc);
+    }
+    instance_->WriteTexture(texture, textureRegion, imageDesc);
+}
+
+void CptRenderSystem::WriteTextureMulti(Texture& texture, const TextureWriteDescriptor* writeDescs, std::uint32_t numWriteDescs)
+{
+    /* Trace each region as an individual write so the trace format remains unchanged */
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        for (std::uint32_t i = 0; i < numWriteDescs; ++i)
+        {
+            writer_.WriteOp(CptOpcode::WriteTexture);
+            writer_.Write(GetObjectID(&texture));
+            writer_.Write(writeDescs[i].textureRegion);
+            WriteImageData(&(writeDescs[i].imageDesc));
+        }
+    }
+    instance_->WriteTextureMulti(texture, writeDescs, numWriteDescs);
+}
+
+void CptRenderSystem::SetTextureMinLod(Texture& texture, float minLod)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::SetTextureMinLod);
+        writer_.Write(GetObjectID(&texture));
+        writer_.Write(minLod);
+    }
+    instance_->SetTextureMinLod(texture, minLod);
+}
+
+bool CptRenderSystem::IsTextureUploadComplete(Texture& texture)
+{
+    /* Readiness polls are an output of the workload; nothing to capture */
+    return instance_->IsTextureUploadComplete(texture);
+}
+
+void CptRenderSystem::WaitForTextureUpload(Texture& texture)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::WaitForTextureUpload);
+        writer_.Write(GetObjectID(&texture));
+    }
+    instance_->WaitForTextureUpload(texture);
+}
+
+void CptRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
+{
+    /* Texture read-backs are an output of the workload; nothing to capture */
+    instance_->ReadTexture(texture, mipLevel, imageDesc);
+}
+
+/* ----- Sampler States ---- */
+
+Sampler* CptRenderSystem::CreateSampler(const SamplerDescriptor& desc)
+{
+    auto sampler = instance_->CreateSampler(desc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateSampler);
+        writer_.Write(RegisterObject(sampler));
+        writer_.Write(desc);
+    }
+    return sampler;
+}
+
+void CptRenderSystem::Release(Sampler& sampler)
+{
+    ReleaseObject(&sampler);
+    instance_->Release(sampler);
+}
+
+/* ----- Resource Views ----- */
+
+ResourceHeap* CptRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& desc)
+{
+    auto resourceHeap = instance_->CreateResourceHeap(desc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateResourceHeap);
+        writer_.Write(RegisterObject(resourceHeap));
+        writer_.Write(GetObjectID(desc.pipelineLayout));
+        writer_.Write(static_cast<std::uint32_t>(desc.resourceViews.size()));
+        for (const auto& resourceView : desc.resourceViews)
+        {
+            writer_.Write(GetObjectID(resourceView.resource));
+            writer_.Write(resourceView.textureView);
+        }
+    }
+    return resourceHeap;
+}
+
+void CptRenderSystem::Release(ResourceHeap& resourceViewHeap)
+{
+    ReleaseObject(&resourceViewHeap);
+    instance_->Release(resourceViewHeap);
+}
+
+void CptRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews)
+{
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::WriteResourceHeap);
+        writer_.Write(GetObjectID(&resourceHeap));
+        writer_.Write(firstDescriptor);
+        writer_.Write(numResourceViews);
+        for (std::uint32_t i = 0; i < numResourceViews; ++i)
+        {
+            writer_.Write(GetObjectID(resourceViews[i].resource));
+            writer_.Write(resourceViews[i].textureView);
+        }
+    }
+    instance_->WriteResourceHeap(resourceHeap, firstDescriptor, numResourceViews, resourceViews);
+}
+
+/* ----- Render Passes ----- */
+
+RenderPass* CptRenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
+{
+    auto renderPass = instance_->CreateRenderPass(desc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateRenderPass);
+        writer_.Write(RegisterObject(renderPass));
+        writer_.Write(static_cast<std::uint32_t>(desc.colorAttachments.size()));
+        for (const auto& attachment : desc.colorAttachments)
+            writer_.Write(attachment);
+        writer_.Write(desc.depthAttachment);
+        writer_.Write(desc.stencilAttachment);
+    }
+    return renderPass;
+}
+
+void CptRenderSystem::Release(RenderPass& renderPass)
+{
+    ReleaseObject(&renderPass);
+    instance_->Release(renderPass);
+}
+
+/* ----- Render Targets ----- */
+
+RenderTarget* CptRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
+{
+    auto renderTarget = instance_->CreateRenderTarget(desc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateRenderTarget);
+        writer_.Write(RegisterObject(renderTarget));
+        writer_.Write(GetObjectID(desc.renderPass));
+        writer_.Write(desc.resolution);
+        writer_.Write(desc.multiSampling);
+        writer_.Write(desc.customMultiSampling);
+        writer_.Write(static_cast<std::uint32_t>(desc.attachments.size()));
+        for (const auto& attachment : desc.attachments)
+        {
+            writer_.Write(attachment.type);
+            writer_.Write(GetObjectID(attachment.texture));
+            writer_.Write(attachment.mipLevel);
+            writer_.Write(attachment.arrayLayer);
+        }
+    }
+    return renderTarget;
+}
+
+void CptRenderSystem::Release(RenderTarget& renderTarget)
+{
+    ReleaseObject(&renderTarget);
+    instance_->Release(renderTarget);
+}
+
+/* ----- Shader ----- */
+
+Shader* CptRenderSystem::CreateShader(const ShaderDescriptor& desc)
+{
+    auto shader = instance_->CreateShader(desc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateShader);
+        writer_.Write(RegisterObject(shader));
+        writer_.Write(desc.type);
+        writer_.Write(desc.sourceType);
+
+        /* Null terminated source code has no explicit size */
+        auto sourceSize = desc.sourceSize;
+        if (sourceSize == 0 && desc.source != nullptr)
+            sourceSize = std::strlen(desc.source);
+        writer_.WriteBlob(desc.source, sourceSize);
+
+        writer_.WriteString(desc.entryPoint);
+        writer_.WriteString(desc.profile);
+
+        /* Count null terminated array of macro definitions */
+        std::uint32_t numDefines = 0;
+        if (desc.defines != nullptr)
+        {
+            while (desc.defines[numDefines].name != nullptr)
+                ++numDefines;
+        }
+        writer_.Write(numDefines);
+        for (std::uint32_t i = 0; i < numDefines; ++i)
+        {
+            writer_.WriteString(desc.defines[i].name);
+            writer_.WriteString(desc.defines[i].definition);
+        }
+
+        writer_.Write(static_cast<std::int64_t>(desc.flags));
+        WriteVertexAttributes(desc.vertex.inputAttribs);
+        WriteVertexAttributes(desc.vertex.outputAttribs);
+
+        writer_.Write(static_cast<std::uint32_t>(desc.fragment.outputAttribs.size()));
+        for (const auto& attrib : desc.fragment.outputAttribs)
+        {
+            writer_.WriteString(attrib.name);
+            writer_.Write(attrib.format);
+            writer_.Write(attrib.location);
+            writer_.Write(attrib.systemValue);
+        }
+    }
+    return shader;
+}
+
+ShaderProgram* CptRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
+{
+    auto shaderProgram = instance_->CreateShaderProgram(desc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateShaderProgram);
+        writer_.Write(RegisterObject(shaderProgram));
+        writer_.Write(GetObjectID(desc.vertexShader));
+        writer_.Write(GetObjectID(desc.tessControlShader));
+        writer_.Write(GetObjectID(desc.tessEvaluationShader));
+        writer_.Write(GetObjectID(desc.geometryShader));
+        writer_.Write(GetObjectID(desc.fragmentShader));
+        writer_.Write(GetObjectID(desc.computeShader));
+        writer_.Write(GetObjectID(desc.taskShader));
+        writer_.Write(GetObjectID(desc.meshShader));
+    }
+    return shaderProgram;
+}
+
+void CptRenderSystem::Release(Shader& shader)
+{
+    ReleaseObject(&shader);
+    instance_->Release(shader);
+}
+
+void CptRenderSystem::Release(ShaderProgram& shaderProgram)
+{
+    ReleaseObject(&shaderProgram);
+    instance_->Release(shaderProgram);
+}
+
+/* ----- Pipeline Layouts ----- */
+
+PipelineLayout* CptRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
+{
+    auto pipelineLayout = instance_->CreatePipelineLayout(desc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreatePipelineLayout);
+        writer_.Write(RegisterObject(pipelineLayout));
+        writer_.Write(static_cast<std::uint32_t>(desc.bindings.size()));
+        for (const auto& binding : desc.bindings)
+        {
+            writer_.WriteString(binding.name);
+            writer_.Write(binding.type);
+            writer_.Write(static_cast<std::int64_t>(binding.bindFlags));
+            writer_.Write(static_cast<std::int64_t>(binding.stageFlags));
+            writer_.Write(binding.slot);
+            writer_.Write(binding.arraySize);
+            writer_.Write(std::uint8_t(binding.dynamicOffset ? 1 : 0));
+        }
+    }
+    return pipelineLayout;
+}
+
+void CptRenderSystem::Release(PipelineLayout& pipelineLayout)
+{
+    ReleaseObject(&pipelineLayout);
+    instance_->Release(pipelineLayout);
+}
+
+/* ----- Pipeline States ----- */
+
+GraphicsPipeline* CptRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
+{
+    auto graphicsPipeline = instance_->CreateGraphicsPipeline(desc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateGraphicsPipeline);
+        writer_.Write(RegisterObject(graphicsPipeline));
+        writer_.Write(GetObjectID(desc.shaderProgram));
+        writer_.Write(GetObjectID(desc.renderPass));
+        writer_.Write(GetObjectID(desc.pipelineLayout));
+        writer_.Write(desc.primitiveTopology);
+        writer_.Write(static_cast<std::uint32_t>(desc.viewports.size()));
+        for (const auto& viewport : desc.viewports)
+            writer_.Write(viewport);
+        writer_.Write(static_cast<std::uint32_t>(desc.scissors.size()));
+        for (const auto& scissor : desc.scissors)
+            writer_.Write(scissor);
+        writer_.Write(desc.depth);
+        writer_.Write(desc.stencil);
+        writer_.Write(desc.rasterizer);
+        writer_.Write(desc.blend);
+    }
+    return graphicsPipeline;
+}
+
+ComputePipeline* CptRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
+{
+    auto computePipeline = instance_->CreateComputePipeline(desc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateComputePipeline);
+        writer_.Write(RegisterObject(computePipeline));
+        writer_.Write(GetObjectID(desc.shaderProgram));
+        writer_.Write(GetObjectID(desc.pipelineLayout));
+    }
+    return computePipeline;
+}
+
+void CptRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
+{
+    ReleaseObject(&graphicsPipeline);
+    instance_->Release(graphicsPipeline);
+}
+
+void CptRenderSystem::Release(ComputePipeline& computePipeline)
+{
+    ReleaseObject(&computePipeline);
+    instance_->Release(computePipeline);
+}
+
+/* ----- Queries ----- */
+
+QueryHeap* CptRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& desc)
+{
+    auto queryHeap = instance_->CreateQueryHeap(desc);
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateQueryHeap);
+        writer_.Write(RegisterObject(queryHeap));
+        writer_.Write(desc);
+    }
+    return queryHeap;
+}
+
+void CptRenderSystem::Release(QueryHeap& queryHeap)
+{
+    ReleaseObject(&queryHeap);
+    instance_->Release(queryHeap);
+}
+
+/* ----- Fences ----- */
+
+Fence* CptRenderSystem::CreateFence()
+{
+    auto fence = instance_->CreateFence();
+    {
+        std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+        writer_.WriteOp(CptOpcode::CreateFence);
+        writer_.Write(RegisterObject(fence));
+    }
+    return fence;
+}
+
+void CptRenderSystem::Release(Fence& fence)
+{
+    ReleaseObject(&fence);
+    instance_->Release(fence);
+}
+
+/* ----- Internal functions ----- */
+
+std::uint32_t CptRenderSystem::GetObjectID(const void* object) const
+{
+    if (object != nullptr)
+    {
+        std::lock_guard<std::mutex> guard { objectIDsMutex_ };
+        auto it = objectIDs_.find(object);
+        if (it != objectIDs_.end())
+            return it->second;
+    }
+    return cptInvalidID;
+}
+
+void CptRenderSystem::PostUncapturedCall(const char* name)
+{
+    std::lock_guard<std::mutex> guard { objectIDsMutex_ };
+    ++uncapturedCalls_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::uint32_t CptRenderSystem::RegisterObject(const void* object)
+{
+    std::lock_guard<std::mutex> guard { objectIDsMutex_ };
+    const auto id = ++nextObjectID_;
+    if (object != nullptr)
+        objectIDs_[object] = id;
+    return id;
+}
+
+void CptRenderSystem::ReleaseObject(const void* object)
+{
+    std::uint32_t id = cptInvalidID;
+    {
+        std::lock_guard<std::mutex> guard { objectIDsMutex_ };
+        auto it = objectIDs_.find(object);
+        if (it != objectIDs_.end())
+        {
+            id = it->second;
+            objectIDs_.erase(it);
+        }
+    }
+    RecordRelease(id);
+}
+
+void CptRenderSystem::RecordRelease(std::uint32_t objectID)
+{
+    std::lock_guard<std::mutex> guard { writer_.GetMutex() };
+    writer_.WriteOp(CptOpcode::ReleaseObject);
+    writer_.Write(objectID);
+}
+
+void CptRenderSystem::WriteVertexAttributes(const std::vector<VertexAttribute>& attributes)
+{
+    writer_.Write(static_cast<std::uint32_t>(attributes.size()));
+    for (const auto& attrib : attributes)
+    {
+        writer_.WriteString(attrib.name);
+        writer_.Write(attrib.format);
+        writer_.Write(attrib.location);
+        writer_.Write(attrib.semanticIndex);
+        writer_.Write(attrib.systemValue);
+        writer_.Write(attrib.slot);
+        writer_.Write(attrib.offset);
+        writer_.Write(attrib.stride);
+        writer_.Write(attrib.instanceDivisor);
+    }
+}
+
+void CptRenderSystem::WriteImageData(const SrcImageDescriptor* imageDesc)
+{
+    if (imageDesc != nullptr)
+    {
+        writer_.Write(std::uint8_t(1));
+        writer_.Write(imageDesc->format);
+        writer_.Write(imageDesc->dataType);
+        writer_.WriteBlob(imageDesc->data, imageDesc->dataSize);
+    }
+    else
+        writer_.Write(std::uint8_t(0));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
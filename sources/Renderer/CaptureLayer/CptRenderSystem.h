@@ -0,0 +1,210 @@
+/*
+ * CptRenderSystem.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CPT_RENDER_SYSTEM_H
+#define LLGL_CPT_RENDER_SYSTEM_H
+
+
+#include <LLGL/RenderSystem.h>
+#include "CptTrace.h"
+#include "CptRenderContext.h"
+#include "CptCommandBuffer.h"
+#include "CptCommandQueue.h"
+#include "../ContainerTypes.h"
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+/*
+Capture layer render system: forwards all calls to the wrapped instance and serializes
+the call stream plus resource data to a binary trace file (see CptTrace.h), so captured
+workloads can be re-executed offline with ReplayRenderSystemTrace. Calls whose input
+data cannot be captured (e.g. buffer content written through MapBuffer) are forwarded
+but counted, and the number of uncaptured calls is reported when the trace is closed.
+*/
+class CptRenderSystem final : public RenderSystem
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        CptRenderSystem(const std::shared_ptr<RenderSystem>& instance, const char* filename);
+        ~CptRenderSystem();
+
+        /* ----- Render Context ------ */
+
+        RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
+
+        void Release(RenderContext& renderContext) override;
+
+        /* ----- Command queues ----- */
+
+        CommandQueue* GetCommandQueue() override;
+
+        std::uint32_t GetNumCommandQueues(const CommandQueueType queueType) override;
+        CommandQueue* GetCommandQueue(const CommandQueueType queueType, std::uint32_t index = 0) override;
+
+        /* ----- Command buffers ----- */
+
+        CommandBuffer* CreateCommandBuffer(const CommandBufferDescriptor& desc = {}) override;
+
+        void Release(CommandBuffer& commandBuffer) override;
+
+        /* ----- Buffers ------ */
+
+        Buffer* CreateBuffer(const BufferDescriptor& desc, const void* initialData = nullptr) override;
+        BufferArray* CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray) override;
+
+        void Release(Buffer& buffer) override;
+        void Release(BufferArray& bufferArray) override;
+
+        void WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize) override;
+
+        void* MapBuffer(Buffer& buffer, const CPUAccess access) override;
+        void UnmapBuffer(Buffer& buffer) override;
+
+        /* ----- Textures ----- */
+
+        Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
+        Texture* CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc) override;
+
+        void Release(Texture& texture) override;
+
+        void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
+        void WriteTextureMulti(Texture& texture, const TextureWriteDescriptor* writeDescs, std::uint32_t numWriteDescs) override;
+        void SetTextureMinLod(Texture& texture, float minLod) override;
+        bool IsTextureUploadComplete(Texture& texture) override;
+        void WaitForTextureUpload(Texture& texture) override;
+        void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
+
+        /* ----- Sampler States ---- */
+
+        Sampler* CreateSampler(const SamplerDescriptor& desc) override;
+
+        void Release(Sampler& sampler) override;
+
+        /* ----- Resource Views ----- */
+
+        ResourceHeap* CreateResourceHeap(const ResourceHeapDescriptor& desc) override;
+
+        void Release(ResourceHeap& resourceViewHeap) override;
+
+        void WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews) override;
+
+        /* ----- Render Passes ----- */
+
+        RenderPass* CreateRenderPass(const RenderPassDescriptor& desc) override;
+
+        void Release(RenderPass& renderPass) override;
+
+        /* ----- Render Targets ----- */
+
+        RenderTarget* CreateRenderTarget(const RenderTargetDescriptor& desc) override;
+
+        void Release(RenderTarget& renderTarget) override;
+
+        /* ----- Shader ----- */
+
+        Shader* CreateShader(const ShaderDescriptor& desc) override;
+
+        ShaderProgram* CreateShaderProgram(const ShaderProgramDescriptor& desc) override;
+
+        void Release(Shader& shader) override;
+        void Release(ShaderProgram& shaderProgram) override;
+
+        /* ----- Pipeline Layouts ----- */
+
+        PipelineLayout* CreatePipelineLayout(const PipelineLayoutDescriptor& desc) override;
+
+        void Release(PipelineLayout& pipelineLayout) override;
+
+        /* ----- Pipeline States ----- */
+
+        GraphicsPipeline* CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc) override;
+        ComputePipeline* CreateComputePipeline(const ComputePipelineDescriptor& desc) override;
+
+        void Release(GraphicsPipeline& graphicsPipeline) override;
+        void Release(ComputePipeline& computePipeline) override;
+
+        /* ----- Queries ----- */
+
+        QueryHeap* CreateQueryHeap(const QueryHeapDescriptor& desc) override;
+
+        void Release(QueryHeap& queryHeap) override;
+
+        /* ----- Fences ----- */
+
+        Fence* CreateFence() override;
+
+        void Release(Fence& fence) override;
+
+    public:
+
+        /* ----- Internal ----- */
+
+        // Returns the trace writer of this capture layer.
+        inline CptTraceWriter& GetTraceWriter()
+        {
+            return writer_;
+        }
+
+        // Returns the trace ID of the specified object, or cptInvalidID if the object is unknown.
+        std::uint32_t GetObjectID(const void* object) const;
+
+        // Counts a call whose input data could not be captured.
+        void PostUncapturedCall(const char* name);
+
+    private:
+
+        // Assigns a new trace ID to the specified object.
+        std::uint32_t RegisterObject(const void* object);
+
+        // Removes the specified object from the ID table and records its release.
+        void ReleaseObject(const void* object);
+
+        // Records the release of the specified trace ID.
+        void RecordRelease(std::uint32_t objectID);
+
+        void WriteVertexAttributes(const std::vector<VertexAttribute>& attributes);
+        void WriteImageData(const SrcImageDescriptor* imageDesc);
+
+    private:
+
+        /* ----- Common objects ----- */
+
+        std::shared_ptr<RenderSystem>           instance_;
+
+        CptTraceWriter                          writer_;
+        std::unique_ptr<CptCommandQueue>        commandQueue_;
+
+        /* ----- Object identities ----- */
+
+        mutable std::mutex                      objectIDsMutex_;
+        std::unordered_map<const void*, std::uint32_t> objectIDs_;
+        std::uint32_t                           nextObjectID_   = cptInvalidID;
+        std::uint64_t                           uncapturedCalls_ = 0;
+
+        /* ----- Hardware object containers ----- */
+
+        HWObjectContainer<CptRenderContext>     renderContexts_;
+        HWObjectContainer<CptCommandBuffer>     commandBuffers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,1275 @@
+/*
+ * CptReplay.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CptReplay.h"
+#include "CptTrace.h"
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Log.h>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Trace replayer: reads the flat operation stream (see CptTrace.h) and re-executes each
+operation on the target render system. Object references in the trace are resolved
+through an ID table that is rebuilt as the creation operations are replayed. The reader
+must mirror the capture functions in CptRenderSystem and CptCommandBuffer exactly.
+*/
+class CptTraceReplayer
+{
+
+    public:
+
+        void Replay(RenderSystem& renderSystem, const char* filename);
+
+    private:
+
+        // Kind of a replayed object; determines the "Release" overload for ReleaseObject operations.
+        enum class ObjectKind
+        {
+            RenderContext,
+            CommandBuffer,
+            Buffer,
+            BufferArray,
+            Texture,
+            Sampler,
+            ResourceHeap,
+            RenderPass,
+            RenderTarget,
+            Shader,
+            ShaderProgram,
+            PipelineLayout,
+            GraphicsPipeline,
+            ComputePipeline,
+            QueryHeap,
+            Fence,
+        };
+
+        struct ObjectEntry
+        {
+            ObjectKind  kind;
+            void*       obj;
+        };
+
+        void ReplayOp(const CptOpcode opcode);
+        void ReplayCmdOp(const CptOpcode opcode, CommandBuffer& cmdBuffer);
+
+        void ReleaseObject(std::uint32_t id);
+
+        void RegisterObject(std::uint32_t id, const ObjectKind kind, void* obj);
+
+        // Returns the object with the specified ID, or null if the ID is cptInvalidID.
+        template <typename T>
+        T* GetObject(const ObjectKind kind, std::uint32_t id) const
+        {
+            if (id != cptInvalidID)
+            {
+                auto it = objects_.find(id);
+                if (it == objects_.end() || it->second.kind != kind)
+                    throw std::runtime_error("invalid object reference in trace file (ID " + std::to_string(id) + ")");
+                return reinterpret_cast<T*>(it->second.obj);
+            }
+            return nullptr;
+        }
+
+        // Returns the object with the specified ID as generic resource.
+        Resource* GetResource(std::uint32_t id) const;
+
+        // Returns the object with the specified ID as render target; accepts render contexts.
+        RenderTarget* GetRenderTarget(std::uint32_t id) const;
+
+        std::vector<VertexAttribute> ReadVertexAttributes();
+
+        // Reads an optional image data block; returns null if no image data was captured.
+        const SrcImageDescriptor* ReadImageData(SrcImageDescriptor& imageDesc, std::vector<char>& imageData);
+
+    private:
+
+        RenderSystem*                                   renderSystem_   = nullptr;
+        CptTraceReader                                  reader_;
+        std::unordered_map<std::uint32_t, ObjectEntry>  objects_;
+
+};
+
+void CptTraceReplayer::Replay(RenderSystem& renderSystem, const char* filename)
+{
+    renderSystem_ = &renderSystem;
+    reader_.Open(filename);
+
+    if (reader_.GetRendererID() != static_cast<std::uint32_t>(renderSystem.GetRendererID()))
+    {
+        Log::PostReport(
+            Log::ReportType::Warning,
+            "capture layer: trace was captured with a different renderer; replay may fail due to incompatible shader code"
+        );
+    }
+
+    CptOpcode opcode = CptOpcode::Nop;
+    while (reader_.ReadOp(opcode))
+        ReplayOp(opcode);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void CptTraceReplayer::ReplayOp(const CptOpcode opcode)
+{
+    switch (opcode)
+    {
+        case CptOpcode::Nop:
+        {
+        }
+        break;
+
+        /* ----- Render system ----- */
+
+        case CptOpcode::CreateRenderContext:
+        {
+            const auto id   = reader_.Read<std::uint32_t>();
+            const auto desc = reader_.Read<RenderContextDescriptor>();
+            RegisterObject(id, ObjectKind::RenderContext, renderSystem_->CreateRenderContext(desc));
+        }
+        break;
+
+        case CptOpcode::CreateCommandBuffer:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            CommandBufferDescriptor desc;
+            desc.flags              = static_cast<long>(reader_.Read<std::int64_t>());
+            desc.numNativeBuffers   = reader_.Read<std::uint32_t>();
+            RegisterObject(id, ObjectKind::CommandBuffer, renderSystem_->CreateCommandBuffer(desc));
+        }
+        break;
+
+        case CptOpcode::CreateBuffer:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            BufferDescriptor desc;
+            desc.size           = reader_.Read<std::uint64_t>();
+            desc.bindFlags      = static_cast<long>(reader_.Read<std::int64_t>());
+            desc.cpuAccessFlags = static_cast<long>(reader_.Read<std::int64_t>());
+            desc.miscFlags      = static_cast<long>(reader_.Read<std::int64_t>());
+            desc.vertexAttribs  = ReadVertexAttributes();
+            desc.indexFormat    = reader_.Read<Format>();
+            desc.storageBuffer  = reader_.Read<BufferDescriptor::StorageBuffer>();
+            const auto initialData = reader_.ReadBlob();
+            RegisterObject(
+                id, ObjectKind::Buffer,
+                renderSystem_->CreateBuffer(desc, (initialData.empty() ? nullptr : initialData.data()))
+            );
+        }
+        break;
+
+        case CptOpcode::CreateBufferArray:
+        {
+            const auto id           = reader_.Read<std::uint32_t>();
+            const auto numBuffers   = reader_.Read<std::uint32_t>();
+            std::vector<Buffer*> buffers(numBuffers);
+            for (std::uint32_t i = 0; i < numBuffers; ++i)
+                buffers[i] = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            RegisterObject(id, ObjectKind::BufferArray, renderSystem_->CreateBufferArray(numBuffers, buffers.data()));
+        }
+        break;
+
+        case CptOpcode::CreateTexture:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            TextureDescriptor desc;
+            desc.type           = reader_.Read<TextureType>();
+            desc.bindFlags      = static_cast<long>(reader_.Read<std::int64_t>());
+            desc.cpuAccessFlags = static_cast<long>(reader_.Read<std::int64_t>());
+            desc.miscFlags      = static_cast<long>(reader_.Read<std::int64_t>());
+            desc.format         = reader_.Read<Format>();
+            desc.extent         = reader_.Read<Extent3D>();
+            desc.arrayLayers    = reader_.Read<std::uint32_t>();
+            desc.mipLevels      = reader_.Read<std::uint32_t>();
+            desc.samples        = reader_.Read<std::uint32_t>();
+
+            SrcImageDescriptor  imageDesc;
+            std::vector<char>   imageData;
+            RegisterObject(id, ObjectKind::Texture, renderSystem_->CreateTexture(desc, ReadImageData(imageDesc, imageData)));
+        }
+        break;
+
+        case CptOpcode::CreateTextureView:
+        {
+            const auto id           = reader_.Read<std::uint32_t>();
+            auto sharedTexture      = GetObject<Texture>(ObjectKind::Texture, reader_.Read<std::uint32_t>());
+            const auto desc         = reader_.Read<TextureViewDescriptor>();
+            RegisterObject(id, ObjectKind::Texture, renderSystem_->CreateTextureView(*sharedTexture, desc));
+        }
+        break;
+
+        case CptOpcode::CreateSampler:
+        {
+            const auto id   = reader_.Read<std::uint32_t>();
+            const auto desc = reader_.Read<SamplerDescriptor>();
+            RegisterObject(id, ObjectKind::Sampler, renderSystem_->CreateSampler(desc));
+        }
+        break;
+
+        case CptOpcode::CreateResourceHeap:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            ResourceHeapDescriptor desc;
+            desc.pipelineLayout = GetObject<PipelineLayout>(ObjectKind::PipelineLayout, reader_.Read<std::uint32_t>());
+            const auto numResourceViews = reader_.Read<std::uint32_t>();
+            desc.resourceViews.resize(numResourceViews);
+            for (auto& resourceView : desc.resourceViews)
+            {
+                resourceView.resource       = GetResource(reader_.Read<std::uint32_t>());
+                resourceView.textureView    = reader_.Read<TextureViewDescriptor>();
+            }
+            RegisterObject(id, ObjectKind::ResourceHeap, renderSystem_->CreateResourceHeap(desc));
+        }
+        break;
+
+        case CptOpcode::CreateRenderPass:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            RenderPassDescriptor desc;
+            const auto numColorAttachments = reader_.Read<std::uint32_t>();
+            desc.colorAttachments.resize(numColorAttachments);
+            for (auto& attachment : desc.colorAttachments)
+                attachment = reader_.Read<AttachmentFormatDescriptor>();
+            desc.depthAttachment    = reader_.Read<AttachmentFormatDescriptor>();
+            desc.stencilAttachment  = reader_.Read<AttachmentFormatDescriptor>();
+            RegisterObject(id, ObjectKind::RenderPass, renderSystem_->CreateRenderPass(desc));
+        }
+        break;
+
+        case CptOpcode::CreateRenderTarget:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            RenderTargetDescriptor desc;
+            desc.renderPass             = GetObject<RenderPass>(ObjectKind::RenderPass, reader_.Read<std::uint32_t>());
+            desc.resolution             = reader_.Read<Extent2D>();
+            desc.multiSampling          = reader_.Read<MultiSamplingDescriptor>();
+            desc.customMultiSampling    = reader_.Read<bool>();
+            const auto numAttachments = reader_.Read<std::uint32_t>();
+            desc.attachments.resize(numAttachments);
+            for (auto& attachment : desc.attachments)
+            {
+                attachment.type         = reader_.Read<AttachmentType>();
+                attachment.texture      = GetObject<Texture>(ObjectKind::Texture, reader_.Read<std::uint32_t>());
+                attachment.mipLevel     = reader_.Read<std::uint32_t>();
+                attachment.arrayLayer   = reader_.Read<std::uint32_t>();
+            }
+            RegisterObject(id, ObjectKind::RenderTarget, renderSystem_->CreateRenderTarget(desc));
+        }
+        break;
+
+        case CptOpcode::CreateShader:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            ShaderDescriptor desc;
+            desc.type       = reader_.Read<ShaderType>();
+            desc.sourceType = reader_.Read<ShaderSourceType>();
+
+            auto source = reader_.ReadBlob();
+            source.push_back('\0');
+            desc.source     = source.data();
+            desc.sourceSize = source.size() - 1;
+
+            const auto entryPoint   = reader_.ReadString();
+            const auto profile      = reader_.ReadString();
+            desc.entryPoint = (entryPoint.empty() ? nullptr : entryPoint.c_str());
+            desc.profile    = (profile.empty() ? nullptr : profile.c_str());
+
+            const auto numDefines = reader_.Read<std::uint32_t>();
+            std::vector<std::string> defineStrings;
+            defineStrings.reserve(numDefines * 2);
+            std::vector<ShaderMacro> defines;
+            for (std::uint32_t i = 0; i < numDefines; ++i)
+            {
+                defineStrings.push_back(reader_.ReadString());
+                const auto* name = defineStrings.back().c_str();
+                defineStrings.push_back(reader_.ReadString());
+                const auto& definition = defineStrings.back();
+                defines.push_back(ShaderMacro{ name, (definition.empty() ? nullptr : definition.c_str()) });
+            }
+            if (!defines.empty())
+            {
+                defines.push_back(ShaderMacro{});
+                desc.defines = defines.data();
+            }
+
+            desc.flags                  = static_cast<long>(reader_.Read<std::int64_t>());
+            desc.vertex.inputAttribs    = ReadVertexAttributes();
+            desc.vertex.outputAttribs   = ReadVertexAttributes();
+
+            const auto numFragmentAttribs = reader_.Read<std::uint32_t>();
+            std::vector<std::string> fragmentAttribNames;
+            fragmentAttribNames.reserve(numFragmentAttribs);
+            desc.fragment.outputAttribs.resize(numFragmentAttribs);
+            for (auto& attrib : desc.fragment.outputAttribs)
+            {
+                fragmentAttribNames.push_back(reader_.ReadString());
+                attrib.name         = fragmentAttribNames.back().c_str();
+                attrib.format       = reader_.Read<Format>();
+                attrib.location     = reader_.Read<std::uint32_t>();
+                attrib.systemValue  = reader_.Read<SystemValue>();
+            }
+
+            RegisterObject(id, ObjectKind::Shader, renderSystem_->CreateShader(desc));
+        }
+        break;
+
+        case CptOpcode::CreateShaderProgram:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            ShaderProgramDescriptor desc;
+            desc.vertexShader           = GetObject<Shader>(ObjectKind::Shader, reader_.Read<std::uint32_t>());
+            desc.tessControlShader      = GetObject<Shader>(ObjectKind::Shader, reader_.Read<std::uint32_t>());
+            desc.tessEvaluationShader   = GetObject<Shader>(ObjectKind::Shader, reader_.Read<std::uint32_t>());
+            desc.geometryShader         = GetObject<Shader>(ObjectKind::Shader, reader_.Read<std::uint32_t>());
+            desc.fragmentShader         = GetObject<Shader>(ObjectKind::Shader, reader_.Read<std::uint32_t>());
+            desc.computeShader          = GetObject<Shader>(ObjectKind::Shader, reader_.Read<std::uint32_t>());
+            desc.taskShader             = GetObject<Shader>(ObjectKind::Shader, reader_.Read<std::uint32_t>());
+            desc.meshShader             = GetObject<Shader>(ObjectKind::Shader, reader_.Read<std::uint32_t>());
+            RegisterObject(id, ObjectKind::ShaderProgram, renderSystem_->CreateShaderProgram(desc));
+        }
+        break;
+
+        case CptOpcode::CreatePipelineLayout:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            PipelineLayoutDescriptor desc;
+            const auto numBindings = reader_.Read<std::uint32_t>();
+            desc.bindings.resize(numBindings);
+            for (auto& binding : desc.bindings)
+            {
+                binding.name        = reader_.ReadString();
+                binding.type        = reader_.Read<ResourceType>();
+                binding.bindFlags   = static_cast<long>(reader_.Read<std::int64_t>());
+                binding.stageFlags  = static_cast<long>(reader_.Read<std::int64_t>());
+                binding.slot            = reader_.Read<std::uint32_t>();
+                binding.arraySize       = reader_.Read<std::uint32_t>();
+                binding.dynamicOffset   = (reader_.Read<std::uint8_t>() != 0);
+            }
+            RegisterObject(id, ObjectKind::PipelineLayout, renderSystem_->CreatePipelineLayout(desc));
+        }
+        break;
+
+        case CptOpcode::CreateGraphicsPipeline:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            GraphicsPipelineDescriptor desc;
+            desc.shaderProgram      = GetObject<ShaderProgram>(ObjectKind::ShaderProgram, reader_.Read<std::uint32_t>());
+            desc.renderPass         = GetObject<RenderPass>(ObjectKind::RenderPass, reader_.Read<std::uint32_t>());
+            desc.pipelineLayout     = GetObject<PipelineLayout>(ObjectKind::PipelineLayout, reader_.Read<std::uint32_t>());
+            desc.primitiveTopology  = reader_.Read<PrimitiveTopology>();
+            const auto numViewports = reader_.Read<std::uint32_t>();
+            desc.viewports.resize(numViewports);
+            for (auto& viewport : desc.viewports)
+                viewport = reader_.Read<Viewport>();
+            const auto numScissors = reader_.Read<std::uint32_t>();
+            desc.scissors.resize(numScissors);
+            for (auto& scissor : desc.scissors)
+                scissor = reader_.Read<Scissor>();
+            desc.depth      = reader_.Read<DepthDescriptor>();
+            desc.stencil    = reader_.Read<StencilDescriptor>();
+            desc.rasterizer = reader_.Read<RasterizerDescriptor>();
+            desc.blend      = reader_.Read<BlendDescriptor>();
+            RegisterObject(id, ObjectKind::GraphicsPipeline, renderSystem_->CreateGraphicsPipeline(desc));
+        }
+        break;
+
+        case CptOpcode::CreateComputePipeline:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            ComputePipelineDescriptor desc;
+            desc.shaderProgram  = GetObject<ShaderProgram>(ObjectKind::ShaderProgram, reader_.Read<std::uint32_t>());
+            desc.pipelineLayout = GetObject<PipelineLayout>(ObjectKind::PipelineLayout, reader_.Read<std::uint32_t>());
+            RegisterObject(id, ObjectKind::ComputePipeline, renderSystem_->CreateComputePipeline(desc));
+        }
+        break;
+
+        case CptOpcode::CreateQueryHeap:
+        {
+            const auto id   = reader_.Read<std::uint32_t>();
+            const auto desc = reader_.Read<QueryHeapDescriptor>();
+            RegisterObject(id, ObjectKind::QueryHeap, renderSystem_->CreateQueryHeap(desc));
+        }
+        break;
+
+        case CptOpcode::CreateFence:
+        {
+            const auto id = reader_.Read<std::uint32_t>();
+            RegisterObject(id, ObjectKind::Fence, renderSystem_->CreateFence());
+        }
+        break;
+
+        case CptOpcode::WriteBuffer:
+        {
+            auto dstBuffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto dstOffset    = reader_.Read<std::uint64_t>();
+            const auto data         = reader_.ReadBlob();
+            renderSystem_->WriteBuffer(*dstBuffer, dstOffset, data.data(), data.size());
+        }
+        break;
+
+        case CptOpcode::WriteTexture:
+        {
+            auto texture = GetObject<Texture>(ObjectKind::Texture, reader_.Read<std::uint32_t>());
+            const auto textureRegion = reader_.Read<TextureRegion>();
+
+            SrcImageDescriptor  imageDesc;
+            std::vector<char>   imageData;
+            if (ReadImageData(imageDesc, imageData) != nullptr)
+                renderSystem_->WriteTexture(*texture, textureRegion, imageDesc);
+        }
+        break;
+
+        case CptOpcode::WriteResourceHeap:
+        {
+            auto resourceHeap = GetObject<ResourceHeap>(ObjectKind::ResourceHeap, reader_.Read<std::uint32_t>());
+            const auto firstDescriptor  = reader_.Read<std::uint32_t>();
+            const auto numResourceViews = reader_.Read<std::uint32_t>();
+
+            std::vector<ResourceViewDescriptor> resourceViews;
+            resourceViews.resize(numResourceViews);
+            for (auto& resourceView : resourceViews)
+            {
+                resourceView.resource       = GetResource(reader_.Read<std::uint32_t>());
+                resourceView.textureView    = reader_.Read<TextureViewDescriptor>();
+            }
+            renderSystem_->WriteResourceHeap(*resourceHeap, firstDescriptor, numResourceViews, resourceViews.data());
+        }
+        break;
+
+        case CptOpcode::SetTextureMinLod:
+        {
+            auto texture = GetObject<Texture>(ObjectKind::Texture, reader_.Read<std::uint32_t>());
+            const auto minLod = reader_.Read<float>();
+            renderSystem_->SetTextureMinLod(*texture, minLod);
+        }
+        break;
+
+        case CptOpcode::WaitForTextureUpload:
+        {
+            auto texture = GetObject<Texture>(ObjectKind::Texture, reader_.Read<std::uint32_t>());
+            renderSystem_->WaitForTextureUpload(*texture);
+        }
+        break;
+
+        case CptOpcode::ReleaseObject:
+        {
+            ReleaseObject(reader_.Read<std::uint32_t>());
+        }
+        break;
+
+        /* ----- Command queue ----- */
+
+        case CptOpcode::QueueSubmit:
+        {
+            auto commandBuffer = GetObject<CommandBuffer>(ObjectKind::CommandBuffer, reader_.Read<std::uint32_t>());
+            renderSystem_->GetCommandQueue()->Submit(*commandBuffer);
+        }
+        break;
+
+        case CptOpcode::QueueSubmitBatch:
+        {
+            const auto numCommandBuffers = reader_.Read<std::uint32_t>();
+            std::vector<CommandBuffer*> commandBuffers(numCommandBuffers);
+            for (auto& commandBuffer : commandBuffers)
+                commandBuffer = GetObject<CommandBuffer>(ObjectKind::CommandBuffer, reader_.Read<std::uint32_t>());
+            renderSystem_->GetCommandQueue()->Submit(numCommandBuffers, commandBuffers.data());
+        }
+        break;
+
+        case CptOpcode::QueueSubmitFence:
+        {
+            auto fence = GetObject<Fence>(ObjectKind::Fence, reader_.Read<std::uint32_t>());
+            renderSystem_->GetCommandQueue()->Submit(*fence);
+        }
+        break;
+
+        case CptOpcode::QueueWaitFence:
+        {
+            auto fence          = GetObject<Fence>(ObjectKind::Fence, reader_.Read<std::uint32_t>());
+            const auto timeout  = reader_.Read<std::uint64_t>();
+            renderSystem_->GetCommandQueue()->WaitFence(*fence, timeout);
+        }
+        break;
+
+        case CptOpcode::QueueSignalFence:
+        {
+            auto fence = GetObject<Fence>(ObjectKind::Fence, reader_.Read<std::uint32_t>());
+            const auto value = reader_.Read<std::uint64_t>();
+            renderSystem_->GetCommandQueue()->Signal(*fence, value);
+        }
+        break;
+
+        case CptOpcode::QueueWaitFenceValue:
+        {
+            auto fence = GetObject<Fence>(ObjectKind::Fence, reader_.Read<std::uint32_t>());
+            const auto value    = reader_.Read<std::uint64_t>();
+            const auto timeout  = reader_.Read<std::uint64_t>();
+            renderSystem_->GetCommandQueue()->WaitFenceValue(*fence, value, timeout);
+        }
+        break;
+
+        case CptOpcode::QueueWaitFences:
+        {
+            const auto numFences = reader_.Read<std::uint32_t>();
+            std::vector<Fence*> fences;
+            fences.reserve(numFences);
+            for (std::uint32_t i = 0; i < numFences; ++i)
+                fences.push_back(GetObject<Fence>(ObjectKind::Fence, reader_.Read<std::uint32_t>()));
+            const bool waitAll  = (reader_.Read<std::uint8_t>() != 0);
+            const auto timeout  = reader_.Read<std::uint64_t>();
+            renderSystem_->GetCommandQueue()->WaitFences(numFences, fences.data(), waitAll, timeout);
+        }
+        break;
+
+        case CptOpcode::QueueWaitFenceGpu:
+        {
+            auto fence = GetObject<Fence>(ObjectKind::Fence, reader_.Read<std::uint32_t>());
+            renderSystem_->GetCommandQueue()->Wait(*fence);
+        }
+        break;
+
+        case CptOpcode::QueueWaitIdle:
+        {
+            renderSystem_->GetCommandQueue()->WaitIdle();
+        }
+        break;
+
+        /* ----- Render context ----- */
+
+        case CptOpcode::ContextPresent:
+        {
+            auto renderContext = GetObject<RenderContext>(ObjectKind::RenderContext, reader_.Read<std::uint32_t>());
+            renderContext->Present();
+        }
+        break;
+
+        /* ----- Command buffer ----- */
+
+        default:
+        {
+            auto commandBuffer = GetObject<CommandBuffer>(ObjectKind::CommandBuffer, reader_.Read<std::uint32_t>());
+            ReplayCmdOp(opcode, *commandBuffer);
+        }
+        break;
+    }
+}
+
+void CptTraceReplayer::ReplayCmdOp(const CptOpcode opcode, CommandBuffer& cmdBuffer)
+{
+    switch (opcode)
+    {
+        case CptOpcode::CmdBegin:
+        {
+            cmdBuffer.Begin();
+        }
+        break;
+
+        case CptOpcode::CmdEnd:
+        {
+            cmdBuffer.End();
+        }
+        break;
+
+        case CptOpcode::CmdExecute:
+        {
+            auto deferredCommandBuffer = GetObject<CommandBuffer>(ObjectKind::CommandBuffer, reader_.Read<std::uint32_t>());
+            cmdBuffer.Execute(*deferredCommandBuffer);
+        }
+        break;
+
+        case CptOpcode::CmdUpdateBuffer:
+        {
+            auto dstBuffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto dstOffset    = reader_.Read<std::uint64_t>();
+            const auto data         = reader_.ReadBlob();
+            cmdBuffer.UpdateBuffer(*dstBuffer, dstOffset, data.data(), static_cast<std::uint16_t>(data.size()));
+        }
+        break;
+
+        case CptOpcode::CmdCopyBuffer:
+        {
+            auto dstBuffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto dstOffset = reader_.Read<std::uint64_t>();
+            auto srcBuffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto srcOffset    = reader_.Read<std::uint64_t>();
+            const auto size         = reader_.Read<std::uint64_t>();
+            cmdBuffer.CopyBuffer(*dstBuffer, dstOffset, *srcBuffer, srcOffset, size);
+        }
+        break;
+
+        case CptOpcode::CmdCopyTexture:
+        {
+            auto dstTexture = GetObject<Texture>(ObjectKind::Texture, reader_.Read<std::uint32_t>());
+            const auto dstLocation = reader_.Read<TextureLocation>();
+            auto srcTexture = GetObject<Texture>(ObjectKind::Texture, reader_.Read<std::uint32_t>());
+            const auto srcLocation  = reader_.Read<TextureLocation>();
+            const auto extent       = reader_.Read<Extent3D>();
+            cmdBuffer.CopyTexture(*dstTexture, dstLocation, *srcTexture, srcLocation, extent);
+        }
+        break;
+
+        case CptOpcode::CmdBeginCopyBatch:
+        {
+            cmdBuffer.BeginCopyBatch();
+        }
+        break;
+
+        case CptOpcode::CmdEndCopyBatch:
+        {
+            cmdBuffer.EndCopyBatch();
+        }
+        break;
+
+        case CptOpcode::CmdGenerateMips:
+        {
+            auto texture = GetObject<Texture>(ObjectKind::Texture, reader_.Read<std::uint32_t>());
+            cmdBuffer.GenerateMips(*texture);
+        }
+        break;
+
+        case CptOpcode::CmdGenerateMipsRange:
+        {
+            auto texture = GetObject<Texture>(ObjectKind::Texture, reader_.Read<std::uint32_t>());
+            const auto subresource = reader_.Read<TextureSubresource>();
+            cmdBuffer.GenerateMips(*texture, subresource);
+        }
+        break;
+
+        case CptOpcode::CmdSetViewport:
+        {
+            cmdBuffer.SetViewport(reader_.Read<Viewport>());
+        }
+        break;
+
+        case CptOpcode::CmdSetViewports:
+        {
+            const auto numViewports = reader_.Read<std::uint32_t>();
+            std::vector<Viewport> viewports(numViewports);
+            for (auto& viewport : viewports)
+                viewport = reader_.Read<Viewport>();
+            cmdBuffer.SetViewports(numViewports, viewports.data());
+        }
+        break;
+
+        case CptOpcode::CmdSetScissor:
+        {
+            cmdBuffer.SetScissor(reader_.Read<Scissor>());
+        }
+        break;
+
+        case CptOpcode::CmdSetScissors:
+        {
+            const auto numScissors = reader_.Read<std::uint32_t>();
+            std::vector<Scissor> scissors(numScissors);
+            for (auto& scissor : scissors)
+                scissor = reader_.Read<Scissor>();
+            cmdBuffer.SetScissors(numScissors, scissors.data());
+        }
+        break;
+
+        case CptOpcode::CmdSetClearColor:
+        {
+            cmdBuffer.SetClearColor(reader_.Read<ColorRGBAf>());
+        }
+        break;
+
+        case CptOpcode::CmdSetClearDepth:
+        {
+            cmdBuffer.SetClearDepth(reader_.Read<float>());
+        }
+        break;
+
+        case CptOpcode::CmdSetClearStencil:
+        {
+            cmdBuffer.SetClearStencil(reader_.Read<std::uint32_t>());
+        }
+        break;
+
+        case CptOpcode::CmdClear:
+        {
+            cmdBuffer.Clear(static_cast<long>(reader_.Read<std::int64_t>()));
+        }
+        break;
+
+        case CptOpcode::CmdClearAttachments:
+        {
+            const auto numAttachments = reader_.Read<std::uint32_t>();
+            std::vector<AttachmentClear> attachments(numAttachments);
+            for (auto& attachment : attachments)
+                attachment = reader_.Read<AttachmentClear>();
+            cmdBuffer.ClearAttachments(numAttachments, attachments.data());
+        }
+        break;
+
+        case CptOpcode::CmdSetVertexBuffer:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            cmdBuffer.SetVertexBuffer(*buffer);
+        }
+        break;
+
+        case CptOpcode::CmdSetVertexBufferArray:
+        {
+            auto bufferArray = GetObject<BufferArray>(ObjectKind::BufferArray, reader_.Read<std::uint32_t>());
+            cmdBuffer.SetVertexBufferArray(*bufferArray);
+        }
+        break;
+
+        case CptOpcode::CmdSetIndexBuffer:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            cmdBuffer.SetIndexBuffer(*buffer);
+        }
+        break;
+
+        case CptOpcode::CmdSetIndexBufferExt:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto format = reader_.Read<Format>();
+            const auto offset = reader_.Read<std::uint64_t>();
+            cmdBuffer.SetIndexBuffer(*buffer, format, offset);
+        }
+        break;
+
+        case CptOpcode::CmdSetStreamOutputBuffer:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            cmdBuffer.SetStreamOutputBuffer(*buffer);
+        }
+        break;
+
+        case CptOpcode::CmdSetStreamOutputBufferArray:
+        {
+            auto bufferArray = GetObject<BufferArray>(ObjectKind::BufferArray, reader_.Read<std::uint32_t>());
+            cmdBuffer.SetStreamOutputBufferArray(*bufferArray);
+        }
+        break;
+
+        case CptOpcode::CmdBeginStreamOutput:
+        {
+            cmdBuffer.BeginStreamOutput(reader_.Read<PrimitiveType>());
+        }
+        break;
+
+        case CptOpcode::CmdEndStreamOutput:
+        {
+            cmdBuffer.EndStreamOutput();
+        }
+        break;
+
+        case CptOpcode::CmdSetGraphicsResourceHeap:
+        {
+            auto resourceHeap = GetObject<ResourceHeap>(ObjectKind::ResourceHeap, reader_.Read<std::uint32_t>());
+            const auto firstSet = reader_.Read<std::uint32_t>();
+            cmdBuffer.SetGraphicsResourceHeap(*resourceHeap, firstSet);
+        }
+        break;
+
+        case CptOpcode::CmdSetComputeResourceHeap:
+        {
+            auto resourceHeap = GetObject<ResourceHeap>(ObjectKind::ResourceHeap, reader_.Read<std::uint32_t>());
+            const auto firstSet = reader_.Read<std::uint32_t>();
+            cmdBuffer.SetComputeResourceHeap(*resourceHeap, firstSet);
+        }
+        break;
+
+        case CptOpcode::CmdSetGraphicsResourceHeapDynamic:
+        {
+            auto resourceHeap = GetObject<ResourceHeap>(ObjectKind::ResourceHeap, reader_.Read<std::uint32_t>());
+            const auto firstSet             = reader_.Read<std::uint32_t>();
+            const auto numDynamicOffsets    = reader_.Read<std::uint32_t>();
+            const auto dynamicOffsets       = reader_.ReadBlob();
+            cmdBuffer.SetGraphicsResourceHeap(*resourceHeap, firstSet, numDynamicOffsets, reinterpret_cast<const std::uint32_t*>(dynamicOffsets.data()));
+        }
+        break;
+
+        case CptOpcode::CmdSetComputeResourceHeapDynamic:
+        {
+            auto resourceHeap = GetObject<ResourceHeap>(ObjectKind::ResourceHeap, reader_.Read<std::uint32_t>());
+            const auto firstSet             = reader_.Read<std::uint32_t>();
+            const auto numDynamicOffsets    = reader_.Read<std::uint32_t>();
+            const auto dynamicOffsets       = reader_.ReadBlob();
+            cmdBuffer.SetComputeResourceHeap(*resourceHeap, firstSet, numDynamicOffsets, reinterpret_cast<const std::uint32_t*>(dynamicOffsets.data()));
+        }
+        break;
+
+        case CptOpcode::CmdSetResource:
+        {
+            auto resource = GetResource(reader_.Read<std::uint32_t>());
+            const auto slot         = reader_.Read<std::uint32_t>();
+            const auto bindFlags    = static_cast<long>(reader_.Read<std::int64_t>());
+            const auto stageFlags   = static_cast<long>(reader_.Read<std::int64_t>());
+            cmdBuffer.SetResource(*resource, slot, bindFlags, stageFlags);
+        }
+        break;
+
+        case CptOpcode::CmdResetResourceSlots:
+        {
+            const auto resourceType = reader_.Read<ResourceType>();
+            const auto firstSlot    = reader_.Read<std::uint32_t>();
+            const auto numSlots     = reader_.Read<std::uint32_t>();
+            const auto bindFlags    = static_cast<long>(reader_.Read<std::int64_t>());
+            const auto stageFlags   = static_cast<long>(reader_.Read<std::int64_t>());
+            cmdBuffer.ResetResourceSlots(resourceType, firstSlot, numSlots, bindFlags, stageFlags);
+        }
+        break;
+
+        case CptOpcode::CmdBeginResourceTransition:
+        {
+            auto resource = GetResource(reader_.Read<std::uint32_t>());
+            const auto bindFlags = static_cast<long>(reader_.Read<std::int64_t>());
+            cmdBuffer.BeginResourceTransition(*resource, bindFlags);
+        }
+        break;
+
+        case CptOpcode::CmdEndResourceTransition:
+        {
+            auto resource = GetResource(reader_.Read<std::uint32_t>());
+            const auto bindFlags = static_cast<long>(reader_.Read<std::int64_t>());
+            cmdBuffer.EndResourceTransition(*resource, bindFlags);
+        }
+        break;
+
+        case CptOpcode::CmdBeginRenderPass:
+        {
+            auto renderTarget = GetRenderTarget(reader_.Read<std::uint32_t>());
+            auto renderPass = GetObject<RenderPass>(ObjectKind::RenderPass, reader_.Read<std::uint32_t>());
+            const auto numClearValues = reader_.Read<std::uint32_t>();
+            std::vector<ClearValue> clearValues(numClearValues);
+            for (auto& clearValue : clearValues)
+                clearValue = reader_.Read<ClearValue>();
+            cmdBuffer.BeginRenderPass(*renderTarget, renderPass, numClearValues, clearValues.data());
+        }
+        break;
+
+        case CptOpcode::CmdEndRenderPass:
+        {
+            cmdBuffer.EndRenderPass();
+        }
+        break;
+
+        case CptOpcode::CmdSetGraphicsPipeline:
+        {
+            auto graphicsPipeline = GetObject<GraphicsPipeline>(ObjectKind::GraphicsPipeline, reader_.Read<std::uint32_t>());
+            cmdBuffer.SetGraphicsPipeline(*graphicsPipeline);
+        }
+        break;
+
+        case CptOpcode::CmdSetComputePipeline:
+        {
+            auto computePipeline = GetObject<ComputePipeline>(ObjectKind::ComputePipeline, reader_.Read<std::uint32_t>());
+            cmdBuffer.SetComputePipeline(*computePipeline);
+        }
+        break;
+
+        case CptOpcode::CmdSetUniform:
+        {
+            const auto location = reader_.Read<UniformLocation>();
+            const auto data     = reader_.ReadBlob();
+            cmdBuffer.SetUniform(location, data.data(), static_cast<std::uint32_t>(data.size()));
+        }
+        break;
+
+        case CptOpcode::CmdSetUniforms:
+        {
+            const auto location = reader_.Read<UniformLocation>();
+            const auto count    = reader_.Read<std::uint32_t>();
+            const auto data     = reader_.ReadBlob();
+            cmdBuffer.SetUniforms(location, count, data.data(), static_cast<std::uint32_t>(data.size()));
+        }
+        break;
+
+        case CptOpcode::CmdBeginQuery:
+        {
+            auto queryHeap = GetObject<QueryHeap>(ObjectKind::QueryHeap, reader_.Read<std::uint32_t>());
+            const auto query = reader_.Read<std::uint32_t>();
+            cmdBuffer.BeginQuery(*queryHeap, query);
+        }
+        break;
+
+        case CptOpcode::CmdEndQuery:
+        {
+            auto queryHeap = GetObject<QueryHeap>(ObjectKind::QueryHeap, reader_.Read<std::uint32_t>());
+            const auto query = reader_.Read<std::uint32_t>();
+            cmdBuffer.EndQuery(*queryHeap, query);
+        }
+        break;
+
+        case CptOpcode::CmdBeginRenderCondition:
+        {
+            auto queryHeap = GetObject<QueryHeap>(ObjectKind::QueryHeap, reader_.Read<std::uint32_t>());
+            const auto query    = reader_.Read<std::uint32_t>();
+            const auto mode     = reader_.Read<RenderConditionMode>();
+            cmdBuffer.BeginRenderCondition(*queryHeap, query, mode);
+        }
+        break;
+
+        case CptOpcode::CmdEndRenderCondition:
+        {
+            cmdBuffer.EndRenderCondition();
+        }
+        break;
+
+        case CptOpcode::CmdDraw:
+        {
+            const auto numVertices  = reader_.Read<std::uint32_t>();
+            const auto firstVertex  = reader_.Read<std::uint32_t>();
+            cmdBuffer.Draw(numVertices, firstVertex);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndexed:
+        {
+            const auto numIndices   = reader_.Read<std::uint32_t>();
+            const auto firstIndex   = reader_.Read<std::uint32_t>();
+            cmdBuffer.DrawIndexed(numIndices, firstIndex);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndexedExt:
+        {
+            const auto numIndices   = reader_.Read<std::uint32_t>();
+            const auto firstIndex   = reader_.Read<std::uint32_t>();
+            const auto vertexOffset = reader_.Read<std::int32_t>();
+            cmdBuffer.DrawIndexed(numIndices, firstIndex, vertexOffset);
+        }
+        break;
+
+        case CptOpcode::CmdDrawInstanced:
+        {
+            const auto numVertices  = reader_.Read<std::uint32_t>();
+            const auto firstVertex  = reader_.Read<std::uint32_t>();
+            const auto numInstances = reader_.Read<std::uint32_t>();
+            cmdBuffer.DrawInstanced(numVertices, firstVertex, numInstances);
+        }
+        break;
+
+        case CptOpcode::CmdDrawInstancedExt:
+        {
+            const auto numVertices      = reader_.Read<std::uint32_t>();
+            const auto firstVertex      = reader_.Read<std::uint32_t>();
+            const auto numInstances     = reader_.Read<std::uint32_t>();
+            const auto firstInstance    = reader_.Read<std::uint32_t>();
+            cmdBuffer.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndexedInstanced:
+        {
+            const auto numIndices   = reader_.Read<std::uint32_t>();
+            const auto numInstances = reader_.Read<std::uint32_t>();
+            const auto firstIndex   = reader_.Read<std::uint32_t>();
+            cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndexedInstancedExt:
+        {
+            const auto numIndices   = reader_.Read<std::uint32_t>();
+            const auto numInstances = reader_.Read<std::uint32_t>();
+            const auto firstIndex   = reader_.Read<std::uint32_t>();
+            const auto vertexOffset = reader_.Read<std::int32_t>();
+            cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndexedInstancedExt2:
+        {
+            const auto numIndices       = reader_.Read<std::uint32_t>();
+            const auto numInstances     = reader_.Read<std::uint32_t>();
+            const auto firstIndex       = reader_.Read<std::uint32_t>();
+            const auto vertexOffset     = reader_.Read<std::int32_t>();
+            const auto firstInstance    = reader_.Read<std::uint32_t>();
+            cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndirect:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto offset = reader_.Read<std::uint64_t>();
+            cmdBuffer.DrawIndirect(*buffer, offset);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndirectExt:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto offset       = reader_.Read<std::uint64_t>();
+            const auto numCommands  = reader_.Read<std::uint32_t>();
+            const auto stride       = reader_.Read<std::uint32_t>();
+            cmdBuffer.DrawIndirect(*buffer, offset, numCommands, stride);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndirectCount:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto offset = reader_.Read<std::uint64_t>();
+            auto countBuffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto countOffset      = reader_.Read<std::uint64_t>();
+            const auto maxNumCommands   = reader_.Read<std::uint32_t>();
+            const auto stride           = reader_.Read<std::uint32_t>();
+            cmdBuffer.DrawIndirect(*buffer, offset, *countBuffer, countOffset, maxNumCommands, stride);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndexedIndirect:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto offset = reader_.Read<std::uint64_t>();
+            cmdBuffer.DrawIndexedIndirect(*buffer, offset);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndexedIndirectExt:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto offset       = reader_.Read<std::uint64_t>();
+            const auto numCommands  = reader_.Read<std::uint32_t>();
+            const auto stride       = reader_.Read<std::uint32_t>();
+            cmdBuffer.DrawIndexedIndirect(*buffer, offset, numCommands, stride);
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndexedIndirectCount:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto offset = reader_.Read<std::uint64_t>();
+            auto countBuffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto countOffset      = reader_.Read<std::uint64_t>();
+            const auto maxNumCommands   = reader_.Read<std::uint32_t>();
+            const auto stride           = reader_.Read<std::uint32_t>();
+            cmdBuffer.DrawIndexedIndirect(*buffer, offset, *countBuffer, countOffset, maxNumCommands, stride);
+        }
+        break;
+
+        case CptOpcode::CmdDrawMulti:
+        {
+            const auto numCommands  = reader_.Read<std::uint32_t>();
+            const auto commands     = reader_.ReadBlob();
+            cmdBuffer.DrawMulti(numCommands, reinterpret_cast<const DrawIndirectArguments*>(commands.data()));
+        }
+        break;
+
+        case CptOpcode::CmdDrawIndexedMulti:
+        {
+            const auto numCommands  = reader_.Read<std::uint32_t>();
+            const auto commands     = reader_.ReadBlob();
+            cmdBuffer.DrawIndexedMulti(numCommands, reinterpret_cast<const DrawIndexedIndirectArguments*>(commands.data()));
+        }
+        break;
+
+        case CptOpcode::CmdDrawMeshTasks:
+        {
+            const auto numWorkGroups    = reader_.Read<std::uint32_t>();
+            const auto firstWorkGroup   = reader_.Read<std::uint32_t>();
+            cmdBuffer.DrawMeshTasks(numWorkGroups, firstWorkGroup);
+        }
+        break;
+
+        case CptOpcode::CmdDispatch:
+        {
+            const auto numWorkGroupsX = reader_.Read<std::uint32_t>();
+            const auto numWorkGroupsY = reader_.Read<std::uint32_t>();
+            const auto numWorkGroupsZ = reader_.Read<std::uint32_t>();
+            cmdBuffer.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+        }
+        break;
+
+        case CptOpcode::CmdDispatchIndirect:
+        {
+            auto buffer = GetObject<Buffer>(ObjectKind::Buffer, reader_.Read<std::uint32_t>());
+            const auto offset = reader_.Read<std::uint64_t>();
+            cmdBuffer.DispatchIndirect(*buffer, offset);
+        }
+        break;
+
+        case CptOpcode::CmdPushDebugGroup:
+        {
+            const auto name = reader_.ReadString();
+            cmdBuffer.PushDebugGroup(name.c_str());
+        }
+        break;
+
+        case CptOpcode::CmdPopDebugGroup:
+        {
+            cmdBuffer.PopDebugGroup();
+        }
+        break;
+
+        default:
+        {
+            throw std::runtime_error("invalid opcode in trace file (code " + std::to_string(static_cast<int>(opcode)) + ")");
+        }
+        break;
+    }
+}
+
+void CptTraceReplayer::ReleaseObject(std::uint32_t id)
+{
+    if (id == cptInvalidID)
+        return;
+
+    auto it = objects_.find(id);
+    if (it == objects_.end())
+        return;
+
+    const auto entry = it->second;
+    objects_.erase(it);
+
+    switch (entry.kind)
+    {
+        case ObjectKind::RenderContext:
+            renderSystem_->Release(*reinterpret_cast<RenderContext*>(entry.obj));
+            break;
+        case ObjectKind::CommandBuffer:
+            renderSystem_->Release(*reinterpret_cast<CommandBuffer*>(entry.obj));
+            break;
+        case ObjectKind::Buffer:
+            renderSystem_->Release(*reinterpret_cast<Buffer*>(entry.obj));
+            break;
+        case ObjectKind::BufferArray:
+            renderSystem_->Release(*reinterpret_cast<BufferArray*>(entry.obj));
+            break;
+        case ObjectKind::Texture:
+            renderSystem_->Release(*reinterpret_cast<Texture*>(entry.obj));
+            break;
+        case ObjectKind::Sampler:
+            renderSystem_->Release(*reinterpret_cast<Sampler*>(entry.obj));
+            break;
+        case ObjectKind::ResourceHeap:
+            renderSystem_->Release(*reinterpret_cast<ResourceHeap*>(entry.obj));
+            break;
+        case ObjectKind::RenderPass:
+            renderSystem_->Release(*reinterpret_cast<RenderPass*>(entry.obj));
+            break;
+        case ObjectKind::RenderTarget:
+            renderSystem_->Release(*reinterpret_cast<RenderTarget*>(entry.obj));
+            break;
+        case ObjectKind::Shader:
+            renderSystem_->Release(*reinterpret_cast<Shader*>(entry.obj));
+            break;
+        case ObjectKind::ShaderProgram:
+            renderSystem_->Release(*reinterpret_cast<ShaderProgram*>(entry.obj));
+            break;
+        case ObjectKind::PipelineLayout:
+            renderSystem_->Release(*reinterpret_cast<PipelineLayout*>(entry.obj));
+            break;
+        case ObjectKind::GraphicsPipeline:
+            renderSystem_->Release(*reinterpret_cast<GraphicsPipeline*>(entry.obj));
+            break;
+        case ObjectKind::ComputePipeline:
+            renderSystem_->Release(*reinterpret_cast<ComputePipeline*>(entry.obj));
+            break;
+        case ObjectKind::QueryHeap:
+            renderSystem_->Release(*reinterpret_cast<QueryHeap*>(entry.obj));
+            break;
+        case ObjectKind::Fence:
+            renderSystem_->Release(*reinterpret_cast<Fence*>(entry.obj));
+            break;
+    }
+}
+
+void CptTraceReplayer::RegisterObject(std::uint32_t id, const ObjectKind kind, void* obj)
+{
+    objects_[id] = ObjectEntry{ kind, obj };
+}
+
+Resource* CptTraceReplayer::GetResource(std::uint32_t id) const
+{
+    if (id != cptInvalidID)
+    {
+        auto it = objects_.find(id);
+        if (it != objects_.end())
+        {
+            switch (it->second.kind)
+            {
+                case ObjectKind::Buffer:
+                    return reinterpret_cast<Buffer*>(it->second.obj);
+                case ObjectKind::Texture:
+                    return reinterpret_cast<Texture*>(it->second.obj);
+                case ObjectKind::Sampler:
+                    return reinterpret_cast<Sampler*>(it->second.obj);
+                default:
+                    break;
+            }
+        }
+        throw std::runtime_error("invalid resource reference in trace file (ID " + std::to_string(id) + ")");
+    }
+    return nullptr;
+}
+
+RenderTarget* CptTraceReplayer::GetRenderTarget(std::uint32_t id) const
+{
+    auto it = objects_.find(id);
+    if (it != objects_.end())
+    {
+        if (it->second.kind == ObjectKind::RenderTarget)
+            return reinterpret_cast<RenderTarget*>(it->second.obj);
+        if (it->second.kind == ObjectKind::RenderContext)
+            return reinterpret_cast<RenderContext*>(it->second.obj);
+    }
+    throw std::runtime_error("invalid render target reference in trace file (ID " + std::to_string(id) + ")");
+}
+
+std::vector<VertexAttribute> CptTraceReplayer::ReadVertexAttributes()
+{
+    const auto numAttribs = reader_.Read<std::uint32_t>();
+    std::vector<VertexAttribute> attribs(numAttribs);
+    for (auto& attrib : attribs)
+    {
+        attrib.name             = reader_.ReadString();
+        attrib.format           = reader_.Read<Format>();
+        attrib.location         = reader_.Read<std::uint32_t>();
+        attrib.semanticIndex    = reader_.Read<std::uint32_t>();
+        attrib.systemValue      = reader_.Read<SystemValue>();
+        attrib.slot             = reader_.Read<std::uint32_t>();
+        attrib.offset           = reader_.Read<std::uint32_t>();
+        attrib.stride           = reader_.Read<std::uint32_t>();
+        attrib.instanceDivisor  = reader_.Read<std::uint32_t>();
+    }
+    return attribs;
+}
+
+const SrcImageDescriptor* CptTraceReplayer::ReadImageData(SrcImageDescriptor& imageDesc, std::vector<char>& imageData)
+{
+    if (reader_.Read<std::uint8_t>() != 0)
+    {
+        imageDesc.format    = reader_.Read<ImageFormat>();
+        imageDesc.dataType  = reader_.Read<DataType>();
+        imageData           = reader_.ReadBlob();
+        imageDesc.data      = imageData.data();
+        imageDesc.dataSize  = imageData.size();
+        return &imageDesc;
+    }
+    return nullptr;
+}
+
+
+void CptReplayTrace(RenderSystem& renderSystem, const char* filename)
+{
+    CptTraceReplayer replayer;
+    replayer.Replay(renderSystem, filename);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
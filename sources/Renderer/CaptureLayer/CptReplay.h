@@ -0,0 +1,30 @@
+/*
+ * CptReplay.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CPT_REPLAY_H
+#define LLGL_CPT_REPLAY_H
+
+
+#include <LLGL/RenderSystem.h>
+
+
+namespace LLGL
+{
+
+
+// Reads the specified trace file and re-executes all captured operations on the specified render system.
+void CptReplayTrace(RenderSystem& renderSystem, const char* filename);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,121 @@
+/*
+ * CptTrace.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CptTrace.h"
+#include <cstring>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+static const char* g_traceMagic = "LLGLTRC";
+
+
+/*
+ * CptTraceWriter class
+ */
+
+void CptTraceWriter::Open(const char* filename, std::uint32_t rendererID)
+{
+    stream_.open(filename, std::ios::binary);
+    if (!stream_.good())
+        throw std::runtime_error("failed to open trace file for writing: \"" + std::string(filename) + "\"");
+
+    CptTraceHeader header;
+    {
+        std::memcpy(header.magic, g_traceMagic, sizeof(header.magic));
+        header.version      = CptTraceWriter::formatVersion;
+        header.rendererID   = rendererID;
+    }
+    Write(header);
+}
+
+void CptTraceWriter::WriteOp(const CptOpcode opcode)
+{
+    Write(opcode);
+}
+
+void CptTraceWriter::WriteString(const std::string& s)
+{
+    WriteBlob(s.data(), s.size());
+}
+
+void CptTraceWriter::WriteString(const char* s)
+{
+    if (s != nullptr)
+        WriteBlob(s, std::strlen(s));
+    else
+        WriteBlob(nullptr, 0);
+}
+
+void CptTraceWriter::WriteBlob(const void* data, std::uint64_t size)
+{
+    Write(size);
+    if (size > 0)
+        stream_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+}
+
+
+/*
+ * CptTraceReader class
+ */
+
+void CptTraceReader::Open(const char* filename)
+{
+    stream_.open(filename, std::ios::binary);
+    if (!stream_.good())
+        throw std::runtime_error("failed to open trace file for reading: \"" + std::string(filename) + "\"");
+
+    const auto header = Read<CptTraceHeader>();
+
+    if (std::memcmp(header.magic, g_traceMagic, sizeof(header.magic)) != 0)
+        throw std::runtime_error("invalid trace file: \"" + std::string(filename) + "\"");
+    if (header.version != CptTraceWriter::formatVersion)
+    {
+        throw std::runtime_error(
+            "unsupported trace format version " + std::to_string(header.version) +
+            " (expected " + std::to_string(CptTraceWriter::formatVersion) + ")"
+        );
+    }
+
+    rendererID_ = header.rendererID;
+}
+
+bool CptTraceReader::ReadOp(CptOpcode& opcode)
+{
+    char c = 0;
+    if (stream_.read(&c, 1))
+    {
+        opcode = static_cast<CptOpcode>(c);
+        return true;
+    }
+    return false;
+}
+
+std::string CptTraceReader::ReadString()
+{
+    const auto blob = ReadBlob();
+    return std::string(blob.begin(), blob.end());
+}
+
+std::vector<char> CptTraceReader::ReadBlob()
+{
+    const auto size = Read<std::uint64_t>();
+    std::vector<char> blob(static_cast<std::size_t>(size));
+    if (size > 0)
+        stream_.read(blob.data(), static_cast<std::streamsize>(size));
+    return blob;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
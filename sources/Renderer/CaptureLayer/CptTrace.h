@@ -0,0 +1,242 @@
+/*
+ * CptTrace.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_CPT_TRACE_H
+#define LLGL_CPT_TRACE_H
+
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Binary trace format of the capture layer. A trace file consists of a fixed header
+followed by a flat stream of operations, each encoded as a one-byte opcode and its
+arguments in the order the capture functions write them (the reader must mirror the
+writer exactly). Traces are intended for offline analysis on the same platform and
+LLGL revision; the format is versioned but not portable across architectures.
+*/
+
+// Invalid object ID; used for null object references (e.g. no pipeline layout).
+static const std::uint32_t cptInvalidID = 0;
+
+// Trace operation codes.
+enum class CptOpcode : std::uint8_t
+{
+    Nop = 0,
+
+    /* ----- Render system ----- */
+    CreateRenderContext,
+    CreateCommandBuffer,
+    CreateBuffer,
+    CreateBufferArray,
+    CreateTexture,
+    CreateTextureView,
+    CreateSampler,
+    CreateResourceHeap,
+    CreateRenderPass,
+    CreateRenderTarget,
+    CreateShader,
+    CreateShaderProgram,
+    CreatePipelineLayout,
+    CreateGraphicsPipeline,
+    CreateComputePipeline,
+    CreateQueryHeap,
+    CreateFence,
+    WriteBuffer,
+    WriteTexture,
+    WriteResourceHeap,
+    SetTextureMinLod,
+    WaitForTextureUpload,
+    ReleaseObject,
+
+    /* ----- Command queue ----- */
+    QueueSubmit,
+    QueueSubmitBatch,
+    QueueSubmitFence,
+    QueueWaitFence,
+    QueueSignalFence,
+    QueueWaitFenceValue,
+    QueueWaitFenceGpu,
+    QueueWaitFences,
+    QueueWaitIdle,
+
+    /* ----- Render context ----- */
+    ContextPresent,
+
+    /* ----- Command buffer; each op starts with the command buffer ID ----- */
+    CmdBegin,
+    CmdEnd,
+    CmdExecute,
+    CmdUpdateBuffer,
+    CmdCopyBuffer,
+    CmdCopyTexture,
+    CmdBeginCopyBatch,
+    CmdEndCopyBatch,
+    CmdGenerateMips,
+    CmdGenerateMipsRange,
+    CmdSetViewport,
+    CmdSetViewports,
+    CmdSetScissor,
+    CmdSetScissors,
+    CmdSetClearColor,
+    CmdSetClearDepth,
+    CmdSetClearStencil,
+    CmdClear,
+    CmdClearAttachments,
+    CmdSetVertexBuffer,
+    CmdSetVertexBufferArray,
+    CmdSetIndexBuffer,
+    CmdSetIndexBufferExt,
+    CmdSetStreamOutputBuffer,
+    CmdSetStreamOutputBufferArray,
+    CmdBeginStreamOutput,
+    CmdEndStreamOutput,
+    CmdSetGraphicsResourceHeap,
+    CmdSetComputeResourceHeap,
+    CmdSetGraphicsResourceHeapDynamic,
+    CmdSetComputeResourceHeapDynamic,
+    CmdSetResource,
+    CmdResetResourceSlots,
+    CmdBeginResourceTransition,
+    CmdEndResourceTransition,
+    CmdBeginRenderPass,
+    CmdEndRenderPass,
+    CmdSetGraphicsPipeline,
+    CmdSetComputePipeline,
+    CmdSetUniform,
+    CmdSetUniforms,
+    CmdBeginQuery,
+    CmdEndQuery,
+    CmdBeginRenderCondition,
+    CmdEndRenderCondition,
+    CmdDraw,
+    CmdDrawIndexed,
+    CmdDrawIndexedExt,
+    CmdDrawInstanced,
+    CmdDrawInstancedExt,
+    CmdDrawIndexedInstanced,
+    CmdDrawIndexedInstancedExt,
+    CmdDrawIndexedInstancedExt2,
+    CmdDrawIndirect,
+    CmdDrawIndirectExt,
+    CmdDrawIndirectCount,
+    CmdDrawIndexedIndirect,
+    CmdDrawIndexedIndirectExt,
+    CmdDrawIndexedIndirectCount,
+    CmdDrawMulti,
+    CmdDrawIndexedMulti,
+    CmdDrawMeshTasks,
+    CmdDispatch,
+    CmdDispatchIndirect,
+    CmdPushDebugGroup,
+    CmdPopDebugGroup,
+};
+
+// Fixed file header at the beginning of each trace.
+struct CptTraceHeader
+{
+    char            magic[8];       // "LLGLTRC\0"
+    std::uint32_t   version;        // format version (see CptTraceWriter)
+    std::uint32_t   rendererID;     // renderer ID of the captured render system (see RendererID)
+};
+
+// Serializer for trace files; all writes must be guarded by the writer mutex.
+class CptTraceWriter
+{
+
+    public:
+
+        // Current trace format version.
+        static const std::uint32_t formatVersion = 7;
+
+        // Opens the trace file and writes the header; throws std::runtime_error on failure.
+        void Open(const char* filename, std::uint32_t rendererID);
+
+        // Writes the operation code of the next operation.
+        void WriteOp(const CptOpcode opcode);
+
+        // Writes a trivially-copyable value verbatim.
+        template <typename T>
+        void Write(const T& value)
+        {
+            stream_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        // Writes a length-prefixed string.
+        void WriteString(const std::string& s);
+        void WriteString(const char* s);
+
+        // Writes a length-prefixed binary blob; 'data' may be null if 'size' is zero.
+        void WriteBlob(const void* data, std::uint64_t size);
+
+        // Returns the mutex that must be held while an operation is written.
+        inline std::mutex& GetMutex()
+        {
+            return mutex_;
+        }
+
+    private:
+
+        std::ofstream   stream_;
+        std::mutex      mutex_;
+
+};
+
+// Deserializer for trace files; mirrors CptTraceWriter.
+class CptTraceReader
+{
+
+    public:
+
+        // Opens the trace file and validates the header; throws std::runtime_error on failure.
+        void Open(const char* filename);
+
+        // Reads the operation code of the next operation; returns false at the end of the trace.
+        bool ReadOp(CptOpcode& opcode);
+
+        template <typename T>
+        T Read()
+        {
+            T value;
+            stream_.read(reinterpret_cast<char*>(&value), sizeof(T));
+            return value;
+        }
+
+        std::string ReadString();
+
+        std::vector<char> ReadBlob();
+
+        // Returns the renderer ID the trace was captured with.
+        inline std::uint32_t GetRendererID() const
+        {
+            return rendererID_;
+        }
+
+    private:
+
+        std::ifstream   stream_;
+        std::uint32_t   rendererID_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,64 @@
+/*
+ * CaptureReplay.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/CaptureReplay.h>
+#include <LLGL/Log.h>
+#include <stdexcept>
+
+#ifdef LLGL_ENABLE_CAPTURE_LAYER
+#   include "CaptureLayer/CptRenderSystem.h"
+#   include "CaptureLayer/CptReplay.h"
+#   include "../Core/Helper.h"
+#endif
+
+
+namespace LLGL
+{
+
+
+LLGL_EXPORT std::unique_ptr<RenderSystem> CaptureRenderSystem(std::unique_ptr<RenderSystem>&& renderSystem, const char* filename)
+{
+    #ifdef LLGL_ENABLE_CAPTURE_LAYER
+
+    /* Keep renderer identity of the wrapped render system (assigned by RenderSystem::Load) */
+    const auto rendererID   = renderSystem->GetRendererID();
+    const auto name         = renderSystem->GetName();
+
+    auto renderSystemCpt = MakeUnique<CptRenderSystem>(std::move(renderSystem), filename);
+    {
+        renderSystemCpt->rendererID_    = rendererID;
+        renderSystemCpt->name_          = name;
+    }
+    return std::move(renderSystemCpt);
+
+    #else
+
+    Log::PostReport(Log::ReportType::Error, "LLGL was not compiled with capture layer support");
+    return std::move(renderSystem);
+
+    #endif // /LLGL_ENABLE_CAPTURE_LAYER
+}
+
+LLGL_EXPORT void ReplayRenderSystemTrace(RenderSystem& renderSystem, const char* filename)
+{
+    #ifdef LLGL_ENABLE_CAPTURE_LAYER
+
+    CptReplayTrace(renderSystem, filename);
+
+    #else
+
+    throw std::runtime_error("LLGL was not compiled with capture layer support");
+
+    #endif // /LLGL_ENABLE_CAPTURE_LAYER
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
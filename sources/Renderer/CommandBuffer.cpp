@@ -0,0 +1,279 @@
+/*
+ * CommandBuffer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/CommandBuffer.h>
+#include "../Core/Exception.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+/*
+Decodes and dispatches a single command of a tokenized command stream;
+returns the size (in bytes) of the command payload (including trailing data).
+see include/LLGL/CommandStream.h for the stream format
+*/
+static std::size_t ExecuteStreamCommand(const CmdOpcode opcode, const void* pc, CommandBuffer& cmdBuffer)
+{
+    switch (opcode)
+    {
+        case CmdOpcodeSetViewport:
+        {
+            auto cmd = reinterpret_cast<const CmdSetViewport*>(pc);
+            cmdBuffer.SetViewport(Viewport{ cmd->x, cmd->y, cmd->width, cmd->height, cmd->minDepth, cmd->maxDepth });
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeSetScissor:
+        {
+            auto cmd = reinterpret_cast<const CmdSetScissor*>(pc);
+            cmdBuffer.SetScissor(Scissor{ cmd->x, cmd->y, cmd->width, cmd->height });
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeSetClearColor:
+        {
+            auto cmd = reinterpret_cast<const CmdSetClearColor*>(pc);
+            cmdBuffer.SetClearColor({ cmd->color[0], cmd->color[1], cmd->color[2], cmd->color[3] });
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeSetClearDepth:
+        {
+            auto cmd = reinterpret_cast<const CmdSetClearDepth*>(pc);
+            cmdBuffer.SetClearDepth(cmd->depth);
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeSetClearStencil:
+        {
+            auto cmd = reinterpret_cast<const CmdSetClearStencil*>(pc);
+            cmdBuffer.SetClearStencil(cmd->stencil);
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeClear:
+        {
+            auto cmd = reinterpret_cast<const CmdClear*>(pc);
+            cmdBuffer.Clear(cmd->flags);
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeUpdateBuffer:
+        {
+            auto cmd = reinterpret_cast<const CmdUpdateBuffer*>(pc);
+            cmdBuffer.UpdateBuffer(*(cmd->dstBuffer), cmd->dstOffset, cmd + 1, cmd->dataSize);
+            return (sizeof(*cmd) + cmd->dataSize);
+        }
+        case CmdOpcodeSetVertexBuffer:
+        {
+            auto cmd = reinterpret_cast<const CmdSetVertexBuffer*>(pc);
+            cmdBuffer.SetVertexBuffer(*(cmd->buffer));
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeSetVertexBufferArray:
+        {
+            auto cmd = reinterpret_cast<const CmdSetVertexBufferArray*>(pc);
+            cmdBuffer.SetVertexBufferArray(*(cmd->bufferArray));
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeSetIndexBuffer:
+        {
+            auto cmd = reinterpret_cast<const CmdSetIndexBuffer*>(pc);
+            cmdBuffer.SetIndexBuffer(*(cmd->buffer));
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeSetIndexBufferFormat:
+        {
+            auto cmd = reinterpret_cast<const CmdSetIndexBufferFormat*>(pc);
+            cmdBuffer.SetIndexBuffer(*(cmd->buffer), cmd->format, cmd->offset);
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeSetGraphicsResourceHeap:
+        {
+            auto cmd = reinterpret_cast<const CmdSetGraphicsResourceHeap*>(pc);
+            cmdBuffer.SetGraphicsResourceHeap(*(cmd->resourceHeap), cmd->firstSet);
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeSetComputeResourceHeap:
+        {
+            auto cmd = reinterpret_cast<const CmdSetComputeResourceHeap*>(pc);
+            cmdBuffer.SetComputeResourceHeap(*(cmd->resourceHeap), cmd->firstSet);
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeBeginRenderPass:
+        {
+            auto cmd = reinterpret_cast<const CmdBeginRenderPass*>(pc);
+            auto clearValues = reinterpret_cast<const ClearValue*>(cmd + 1);
+            cmdBuffer.BeginRenderPass(*(cmd->renderTarget), cmd->renderPass, cmd->numClearValues, clearValues);
+            return (sizeof(*cmd) + sizeof(ClearValue) * cmd->numClearValues);
+        }
+        case CmdOpcodeEndRenderPass:
+        {
+            cmdBuffer.EndRenderPass();
+            return 0;
+        }
+        case CmdOpcodeSetGraphicsPipeline:
+        {
+            auto cmd = reinterpret_cast<const CmdSetGraphicsPipeline*>(pc);
+            cmdBuffer.SetGraphicsPipeline(*(cmd->graphicsPipeline));
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeSetComputePipeline:
+        {
+            auto cmd = reinterpret_cast<const CmdSetComputePipeline*>(pc);
+            cmdBuffer.SetComputePipeline(*(cmd->computePipeline));
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeDraw:
+        {
+            auto cmd = reinterpret_cast<const CmdDraw*>(pc);
+            cmdBuffer.Draw(cmd->numVertices, cmd->firstVertex);
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeDrawIndexed:
+        {
+            auto cmd = reinterpret_cast<const CmdDrawIndexed*>(pc);
+            cmdBuffer.DrawIndexed(cmd->numIndices, cmd->firstIndex, cmd->vertexOffset);
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeDrawInstanced:
+        {
+            auto cmd = reinterpret_cast<const CmdDrawInstanced*>(pc);
+            cmdBuffer.DrawInstanced(cmd->numVertices, cmd->firstVertex, cmd->numInstances, cmd->firstInstance);
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeDrawIndexedInstanced:
+        {
+            auto cmd = reinterpret_cast<const CmdDrawIndexedInstanced*>(pc);
+            cmdBuffer.DrawIndexedInstanced(cmd->numIndices, cmd->numInstances, cmd->firstIndex, cmd->vertexOffset, cmd->firstInstance);
+            return sizeof(*cmd);
+        }
+        case CmdOpcodeDispatch:
+        {
+            auto cmd = reinterpret_cast<const CmdDispatch*>(pc);
+            cmdBuffer.Dispatch(cmd->groupSizeX, cmd->groupSizeY, cmd->groupSizeZ);
+            return sizeof(*cmd);
+        }
+        default:
+        {
+            throw std::invalid_argument("LLGL::CommandBuffer::ExecuteStream: unknown command opcode");
+        }
+    }
+}
+
+void CommandBuffer::ExecuteStream(const void* stream, std::size_t size)
+{
+    if (stream == nullptr)
+        ThrowNullPointerExcept(__FUNCTION__, "stream");
+
+    /* Decode and dispatch all commands of the stream */
+    auto pc     = reinterpret_cast<const std::int8_t*>(stream);
+    auto pcEnd  = pc + size;
+
+    while (pc != pcEnd)
+    {
+        const auto opcode = static_cast<CmdOpcode>(*pc);
+        ++pc;
+        pc += ExecuteStreamCommand(opcode, pc, *this);
+    }
+}
+
+
+void CommandBuffer::DrawIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    ThrowNotSupportedExcept(__FUNCTION__, "indirect draw commands with a GPU-provided draw count");
+}
+
+void CommandBuffer::BeginCopyBatch()
+{
+    // dummy: copy commands are encoded individually
+}
+
+void CommandBuffer::EndCopyBatch()
+{
+    // dummy: copy commands are encoded individually
+}
+
+void CommandBuffer::BeginResourceTransition(Resource& /*resource*/, long /*bindFlags*/)
+{
+    // dummy: resource transitions are handled implicitly
+}
+
+void CommandBuffer::EndResourceTransition(Resource& /*resource*/, long /*bindFlags*/)
+{
+    // dummy: resource transitions are handled implicitly
+}
+
+void CommandBuffer::SetGraphicsResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           /*numDynamicOffsets*/,
+    const std::uint32_t*    /*dynamicOffsets*/)
+{
+    /* Ignore dynamic offsets for renderers that do not support them; buffers are bound at their base offset */
+    SetGraphicsResourceHeap(resourceHeap, firstSet);
+}
+
+void CommandBuffer::SetComputeResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           /*numDynamicOffsets*/,
+    const std::uint32_t*    /*dynamicOffsets*/)
+{
+    /* Ignore dynamic offsets for renderers that do not support them; buffers are bound at their base offset */
+    SetComputeResourceHeap(resourceHeap, firstSet);
+}
+
+void CommandBuffer::DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands)
+{
+    for (std::uint32_t i = 0; i < numCommands; ++i)
+    {
+        const auto& args = commands[i];
+        if (args.numInstances == 1 && args.firstInstance == 0)
+            Draw(args.numVertices, args.firstVertex);
+        else
+            DrawInstanced(args.numVertices, args.firstVertex, args.numInstances, args.firstInstance);
+    }
+}
+
+void CommandBuffer::DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands)
+{
+    for (std::uint32_t i = 0; i < numCommands; ++i)
+    {
+        const auto& args = commands[i];
+        if (args.numInstances == 1 && args.firstInstance == 0)
+            DrawIndexed(args.numIndices, args.firstIndex, args.vertexOffset);
+        else
+            DrawIndexedInstanced(args.numIndices, args.numInstances, args.firstIndex, args.vertexOffset, args.firstInstance);
+    }
+}
+
+void CommandBuffer::DrawIndexedIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    ThrowNotSupportedExcept(__FUNCTION__, "indirect draw commands with a GPU-provided draw count");
+}
+
+void CommandBuffer::DrawMeshTasks(std::uint32_t /*numWorkGroups*/, std::uint32_t /*firstWorkGroup*/)
+{
+    ThrowNotSupportedExcept(__FUNCTION__, "mesh shading draw commands");
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,151 @@
+/*
+ * CommandQueue.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/CommandQueue.h>
+#include <LLGL/Fence.h>
+#include <chrono>
+#include <thread>
+
+
+namespace LLGL
+{
+
+
+void CommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Submit command buffers one after another to retain the order of the input array */
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        if (auto commandBuffer = commandBuffers[i])
+            Submit(*commandBuffer);
+    }
+}
+
+bool CommandQueue::BindSparseTexture(Texture& /*texture*/, std::uint32_t /*baseMipLevel*/, std::uint32_t /*numMipLevels*/, bool /*resident*/)
+{
+    return false; // dummy
+}
+
+bool CommandQueue::QueryResultAvailable(QueryHeap& /*queryHeap*/, std::uint32_t /*firstQuery*/, std::uint32_t /*numQueries*/)
+{
+    /* Renderers without a dedicated probe rely on "QueryResult" returning false for unavailable results */
+    return true;
+}
+
+void CommandQueue::Wait(Fence& /*fence*/)
+{
+    // dummy: single-queue renderers execute all submissions in order
+}
+
+// Returns the timeout that is left from the specified timeout after the specified start time point (in nanoseconds)
+static std::uint64_t GetRemainingTimeout(std::uint64_t timeout, const std::chrono::steady_clock::time_point& startTime)
+{
+    if (timeout == ~0ull)
+        return timeout;
+    const auto elapsed = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count()
+    );
+    return (elapsed < timeout ? timeout - elapsed : 0);
+}
+
+bool CommandQueue::WaitFences(std::uint32_t numFences, Fence* const * fences, bool waitAll, std::uint64_t timeout)
+{
+    if (numFences == 0 || fences == nullptr)
+        return false;
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    if (waitAll)
+    {
+        /* Wait for the fences one at a time; the remaining timeout applies to whatever is still pending */
+        for (std::uint32_t i = 0; i < numFences; ++i)
+        {
+            if (!WaitFence(*fences[i], GetRemainingTimeout(timeout, startTime)))
+                return false;
+        }
+        return true;
+    }
+    else
+    {
+        /* Poll all fences until at least one of them has been signaled */
+        for (;;)
+        {
+            for (std::uint32_t i = 0; i < numFences; ++i)
+            {
+                if (IsSignaled(*fences[i]))
+                    return true;
+            }
+            if (GetRemainingTimeout(timeout, startTime) == 0)
+                return false;
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool CommandQueue::IsSignaled(Fence& fence)
+{
+    return WaitFence(fence, 0);
+}
+
+void CommandQueue::RaiseCompletedFenceValue(Fence& fence, std::uint64_t value)
+{
+    auto completed = fence.completedValue_.load();
+    while (completed < value && !fence.completedValue_.compare_exchange_weak(completed, value))
+    {
+        // repeat until another thread stored an equal or greater value
+    }
+}
+
+void CommandQueue::Signal(Fence& fence, std::uint64_t value)
+{
+    /* Emulation on top of binary fences: keep at most one signal in flight per fence */
+    const auto pending = fence.pendingValue_.load();
+    if (pending > fence.completedValue_.load())
+    {
+        WaitFence(fence, ~0ull);
+        RaiseCompletedFenceValue(fence, pending);
+    }
+    fence.pendingValue_.store(value);
+    Submit(fence);
+}
+
+bool CommandQueue::WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    if (fence.completedValue_.load() >= value)
+        return true;
+
+    /* The emulation can only wait for values whose signal has already been submitted */
+    const auto pending = fence.pendingValue_.load();
+    if (pending >= value)
+    {
+        if (WaitFence(fence, timeout))
+        {
+            RaiseCompletedFenceValue(fence, pending);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::uint64_t CommandQueue::GetFenceValue(Fence& fence)
+{
+    /* Probe the binary fence without blocking to retire a pending signal */
+    const auto pending = fence.pendingValue_.load();
+    if (pending > fence.completedValue_.load())
+    {
+        if (WaitFence(fence, 0))
+            RaiseCompletedFenceValue(fence, pending);
+    }
+    return fence.completedValue_.load();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
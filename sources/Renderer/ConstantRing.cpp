@@ -0,0 +1,131 @@
+/*
+ * ConstantRing.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/ConstantRing.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandQueue.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+// Rounds the specified value up to the next multiple of the alignment (which must be a power of two)
+static std::uint64_t AlignValue(std::uint64_t value, std::uint64_t alignment)
+{
+    return ((value + alignment - 1) & ~(alignment - 1));
+}
+
+ConstantRing::ConstantRing(
+    RenderSystem&   renderSystem,
+    std::uint64_t   sizePerFrame,
+    std::uint32_t   numFrames,
+    std::uint32_t   alignment)
+:
+    renderSystem_ { renderSystem },
+    numFrames_    { numFrames    },
+    alignment_    { alignment    }
+{
+    if (sizePerFrame == 0)
+        throw std::invalid_argument("cannot create constant ring with zero region size");
+    if (numFrames == 0)
+        throw std::invalid_argument("cannot create constant ring with zero frames");
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+        throw std::invalid_argument("cannot create constant ring with alignment that is not a power of two");
+
+    /* Round region size up, so all regions start at aligned offsets */
+    sizePerFrame_ = AlignValue(sizePerFrame, alignment_);
+
+    /* Create constant buffer that covers all per-frame regions */
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size         = sizePerFrame_ * numFrames_;
+        bufferDesc.bindFlags    = BindFlags::ConstantBuffer;
+        bufferDesc.miscFlags    = MiscFlags::DynamicUsage;
+    }
+    buffer_ = renderSystem_.CreateBuffer(bufferDesc);
+
+    /* Create one fence per region to guard against reuse while the GPU still reads from it */
+    fences_.resize(numFrames_);
+    for (auto& fence : fences_)
+        fence = renderSystem_.CreateFence();
+    fencesInFlight_.resize(numFrames_, false);
+
+    /* Allocate CPU side shadow copy for the allocations of the current frame */
+    shadowData_.resize(static_cast<std::size_t>(sizePerFrame_));
+}
+
+ConstantRing::~ConstantRing()
+{
+    for (auto fence : fences_)
+        renderSystem_.Release(*fence);
+    renderSystem_.Release(*buffer_);
+}
+
+void* ConstantRing::Allocate(std::uint64_t size, std::uint32_t* offset)
+{
+    if (size == 0)
+        throw std::invalid_argument("cannot allocate zero bytes from constant ring");
+
+    /* Align allocation start and validate against region size */
+    const auto alignedOffset = AlignValue(writeOffset_, alignment_);
+    if (size > sizePerFrame_ || alignedOffset > sizePerFrame_ - size)
+        throw std::out_of_range("per-frame region of constant ring exhausted");
+
+    writeOffset_ = alignedOffset + size;
+
+    /* Return buffer relative offset for use as dynamic offset */
+    if (offset != nullptr)
+        *offset = static_cast<std::uint32_t>(sizePerFrame_ * frameIndex_ + alignedOffset);
+
+    return (shadowData_.data() + alignedOffset);
+}
+
+void ConstantRing::Flush()
+{
+    if (flushedOffset_ < writeOffset_)
+    {
+        /* Upload pending allocations into the region of the current frame */
+        renderSystem_.WriteBuffer(
+            *buffer_,
+            sizePerFrame_ * frameIndex_ + flushedOffset_,
+            shadowData_.data() + flushedOffset_,
+            writeOffset_ - flushedOffset_
+        );
+        flushedOffset_ = writeOffset_;
+    }
+}
+
+void ConstantRing::NextFrame(CommandQueue& commandQueue)
+{
+    /* Upload whatever has not been flushed explicitly */
+    Flush();
+
+    /* Fence the region of the current frame */
+    commandQueue.Submit(*fences_[frameIndex_]);
+    fencesInFlight_[frameIndex_] = true;
+
+    /* Advance to the next region and wait until the GPU no longer reads from it */
+    frameIndex_ = (frameIndex_ + 1) % numFrames_;
+
+    if (fencesInFlight_[frameIndex_])
+    {
+        commandQueue.WaitFence(*fences_[frameIndex_], ~0ull);
+        fencesInFlight_[frameIndex_] = false;
+    }
+
+    writeOffset_    = 0;
+    flushedOffset_  = 0;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
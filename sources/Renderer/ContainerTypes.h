@@ -1,6 +1,6 @@
 /*
  * ContainerTypes.h
- * 
+ *
  * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
  * See "LICENSE.txt" for license information.
  */
@@ -9,8 +9,12 @@
 #define LLGL_CONTAINER_TYPES_H
 
 
-#include <set>
 #include <memory>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
 
 
 namespace LLGL
@@ -20,8 +24,395 @@ namespace LLGL
 template <typename T>
 using HWObjectInstance = std::unique_ptr<T>;
 
+/*
+Pooled slot-map container for hardware object instances.
+Object slots are stored in fixed-size chunks, so slot references remain stable
+and neither insertion nor removal causes any tree rebalancing.
+Insertion pops a slot from the free-list and removal pushes it back,
+i.e. both operations run in O(1) (amortized for the slot lookup).
+Each slot carries a generation counter that is incremented when the slot is
+recycled, so stale object references can be detected in O(1) (see valid).
+*/
+template <typename T>
+class HWObjectContainer
+{
+
+    public:
+
+        static const std::size_t chunkSize = 64;
+
+        HWObjectContainer() = default;
+
+        HWObjectContainer(const HWObjectContainer&) = delete;
+        HWObjectContainer& operator = (const HWObjectContainer&) = delete;
+
+        // Takes ownership of the specified object and returns a non-owning raw pointer to it.
+        template <typename TSub>
+        TSub* emplace(HWObjectInstance<TSub>&& object)
+        {
+            auto ref = object.get();
+
+            /* Pop next free slot from free-list, or append a new chunk of slots */
+            std::size_t slot = 0;
+            if (!freeList_.empty())
+            {
+                slot = freeList_.back();
+                freeList_.pop_back();
+            }
+            else
+            {
+                slot = chunks_.size() * chunkSize;
+                chunks_.emplace_back(new HWObjectInstance<T>[chunkSize]);
+                generations_.resize(generations_.size() + chunkSize);
+                for (std::size_t i = chunkSize - 1; i > 0; --i)
+                    freeList_.push_back(slot + i);
+            }
+
+            SlotRef(slot) = std::move(object);
+            slotMap_[ref] = slot;
+            ++count_;
+
+            return ref;
+        }
+
+        // Destroys the specified object and recycles its slot. The entry pointer may be of any base class of <T>.
+        template <typename TBase>
+        void erase(const TBase* entry)
+        {
+            auto it = slotMap_.find(static_cast<const T*>(entry));
+            if (it != slotMap_.end())
+            {
+                auto slot = it->second;
+                SlotRef(slot).reset();
+                ++generations_[slot];
+                slotMap_.erase(it);
+                freeList_.push_back(slot);
+                --count_;
+            }
+        }
+
+        // Detaches ownership of the specified object without destroying it and recycles its slot (see deferred destruction).
+        template <typename TBase>
+        HWObjectInstance<T> extract(const TBase* entry)
+        {
+            HWObjectInstance<T> object;
+            auto it = slotMap_.find(static_cast<const T*>(entry));
+            if (it != slotMap_.end())
+            {
+                auto slot = it->second;
+                object = std::move(SlotRef(slot));
+                ++generations_[slot];
+                slotMap_.erase(it);
+                freeList_.push_back(slot);
+                --count_;
+            }
+            return object;
+        }
+
+        // Returns the generation handle of the specified live object, or 0 if the object is not registered.
+        template <typename TBase>
+        std::uint64_t handle(const TBase* entry) const
+        {
+            auto it = slotMap_.find(static_cast<const T*>(entry));
+            if (it != slotMap_.end())
+            {
+                auto slot = it->second;
+                return ((static_cast<std::uint64_t>(slot) << 32) | (generations_[slot] + 1));
+            }
+            return 0;
+        }
+
+        // Returns true if the specified generation handle still refers to the specified live object, i.e. its slot has neither been released nor recycled.
+        template <typename TBase>
+        bool valid(std::uint64_t handle, const TBase* entry) const
+        {
+            auto slot = static_cast<std::size_t>(handle >> 32);
+            if (handle != 0 && slot < generations_.size())
+            {
+                auto generation = static_cast<std::uint32_t>(handle & 0xFFFFFFFFull);
+                return (generations_[slot] + 1 == generation && SlotRef(slot).get() == static_cast<const T*>(entry));
+            }
+            return false;
+        }
+
+        // Destroys all objects and releases the chunk storage.
+        void clear()
+        {
+            chunks_.clear();
+            generations_.clear();
+            freeList_.clear();
+            slotMap_.clear();
+            count_ = 0;
+        }
+
+        bool empty() const
+        {
+            return (count_ == 0);
+        }
+
+        std::size_t size() const
+        {
+            return count_;
+        }
+
+        // Forward iterator over all live objects; dereferences to a raw pointer of type <T*>.
+        class const_iterator
+        {
+
+            public:
+
+                const_iterator(const HWObjectContainer<T>* container, std::size_t slot) :
+                    container_ { container },
+                    slot_      { slot      }
+                {
+                    SkipEmptySlots();
+                }
+
+                T* operator * () const
+                {
+                    return container_->SlotRef(slot_).get();
+                }
+
+                const_iterator& operator ++ ()
+                {
+                    ++slot_;
+                    SkipEmptySlots();
+                    return *this;
+                }
+
+                bool operator == (const const_iterator& rhs) const
+                {
+                    return (slot_ == rhs.slot_);
+                }
+
+                bool operator != (const const_iterator& rhs) const
+                {
+                    return (slot_ != rhs.slot_);
+                }
+
+            private:
+
+                void SkipEmptySlots()
+                {
+                    const auto numSlots = container_->chunks_.size() * chunkSize;
+                    while (slot_ < numSlots && container_->SlotRef(slot_).get() == nullptr)
+                        ++slot_;
+                }
+
+                const HWObjectContainer<T>*  container_;
+                std::size_t                 slot_;
+
+        };
+
+        const_iterator begin() const
+        {
+            return const_iterator { this, 0 };
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator { this, chunks_.size() * chunkSize };
+        }
+
+    private:
+
+        HWObjectInstance<T>& SlotRef(std::size_t slot)
+        {
+            return chunks_[slot / chunkSize][slot % chunkSize];
+        }
+
+        const HWObjectInstance<T>& SlotRef(std::size_t slot) const
+        {
+            return chunks_[slot / chunkSize][slot % chunkSize];
+        }
+
+        std::vector<std::unique_ptr<HWObjectInstance<T>[]>> chunks_;
+        std::vector<std::uint32_t>                          generations_;
+        std::vector<std::size_t>                            freeList_;
+        std::unordered_map<const T*, std::size_t>           slotMap_;
+        std::size_t                                         count_      = 0;
+
+};
+
+/*
+Sharded thread-safe variant of HWObjectContainer (see RenderingFeatures::hasConcurrentResourceCreation).
+Entries are distributed over a fixed number of independently locked sub-containers by pointer hash,
+so concurrent insertions and removals from different threads rarely contend on the same mutex.
+*/
 template <typename T>
-using HWObjectContainer = std::set<HWObjectInstance<T>>;
+class HWObjectContainerConcurrent
+{
+
+    public:
+
+        static const std::size_t numShards = 8;
+
+        HWObjectContainerConcurrent() = default;
+
+        HWObjectContainerConcurrent(const HWObjectContainerConcurrent&) = delete;
+        HWObjectContainerConcurrent& operator = (const HWObjectContainerConcurrent&) = delete;
+
+        // Takes ownership of the specified object and returns a non-owning raw pointer to it.
+        template <typename TSub>
+        TSub* emplace(HWObjectInstance<TSub>&& object)
+        {
+            auto& shard = ShardFor(object.get());
+            std::lock_guard<std::mutex> guard { shard.mutex };
+            return shard.container.emplace(std::move(object));
+        }
+
+        // Destroys the specified object and recycles its slot. The entry pointer may be of any base class of <T>.
+        template <typename TBase>
+        void erase(const TBase* entry)
+        {
+            auto& shard = ShardFor(static_cast<const T*>(entry));
+            std::lock_guard<std::mutex> guard { shard.mutex };
+            shard.container.erase(entry);
+        }
+
+        // Detaches ownership of the specified object without destroying it and recycles its slot (see deferred destruction).
+        template <typename TBase>
+        HWObjectInstance<T> extract(const TBase* entry)
+        {
+            auto& shard = ShardFor(static_cast<const T*>(entry));
+            std::lock_guard<std::mutex> guard { shard.mutex };
+            return shard.container.extract(entry);
+        }
+
+        // Destroys all objects. This must not be called concurrently with any other member function.
+        void clear()
+        {
+            for (auto& shard : shards_)
+            {
+                std::lock_guard<std::mutex> guard { shard.mutex };
+                shard.container.clear();
+            }
+        }
+
+        std::size_t size() const
+        {
+            std::size_t n = 0;
+            for (auto& shard : shards_)
+            {
+                std::lock_guard<std::mutex> guard { shard.mutex };
+                n += shard.container.size();
+            }
+            return n;
+        }
+
+        bool empty() const
+        {
+            return (size() == 0);
+        }
+
+    private:
+
+        struct Shard
+        {
+            mutable std::mutex      mutex;
+            HWObjectContainer<T>    container;
+        };
+
+        Shard& ShardFor(const void* entry)
+        {
+            /* Discard the low pointer bits, which are mostly constant due to the allocation alignment */
+            auto hash = (reinterpret_cast<std::uintptr_t>(entry) >> 6);
+            return shards_[hash % numShards];
+        }
+
+        const Shard& ShardFor(const void* entry) const
+        {
+            auto hash = (reinterpret_cast<std::uintptr_t>(entry) >> 6);
+            return shards_[hash % numShards];
+        }
+
+        Shard shards_[numShards];
+
+};
+
+/*
+Descriptor-hash deduplication cache for hardware objects (see RenderSystemConfiguration::pipelineDeduplication).
+Only stores non-owning references with a reference count; ownership remains in the respective HWObjectContainer.
+*/
+template <typename T>
+class HWObjectDedupCache
+{
+
+    public:
+
+        // Returns the object that is registered under the specified descriptor hash and increments its reference count, or null if there is no such object.
+        T* Find(std::uint64_t descHash)
+        {
+            auto it = entries_.find(descHash);
+            if (it != entries_.end())
+            {
+                ++(it->second.refCount);
+                return it->second.object;
+            }
+            return nullptr;
+        }
+
+        // Registers the specified object under the descriptor hash with an initial reference count of 1.
+        void Register(std::uint64_t descHash, T* object)
+        {
+            entries_[descHash] = { object, 1 };
+        }
+
+        // Decrements the reference count of the specified object; returns true if the object must be destroyed, i.e. it is not registered or its last reference was dropped.
+        bool Release(const T* object)
+        {
+            for (auto it = entries_.begin(); it != entries_.end(); ++it)
+            {
+                if (it->second.object == object)
+                {
+                    if (--(it->second.refCount) > 0)
+                        return false;
+                    entries_.erase(it);
+                    return true;
+                }
+            }
+            return true;
+        }
+
+    private:
+
+        struct Entry
+        {
+            T*          object;
+            std::size_t refCount;
+        };
+
+        std::unordered_map<std::uint64_t, Entry> entries_;
+
+};
+
+/* Compatibility overloads for the hardware object ownership helpers (see Core/Helper.h) */
+
+template <typename BaseType, typename SubType>
+SubType* TakeOwnership(HWObjectContainer<BaseType>& objectContainer, std::unique_ptr<SubType>&& object)
+{
+    return objectContainer.emplace(std::move(object));
+}
+
+template <typename T, typename TBase>
+void RemoveFromUniqueSet(HWObjectContainer<T>& cont, const TBase* entry)
+{
+    if (entry)
+        cont.erase(entry);
+}
+
+template <typename BaseType, typename SubType>
+SubType* TakeOwnership(HWObjectContainerConcurrent<BaseType>& objectContainer, std::unique_ptr<SubType>&& object)
+{
+    return objectContainer.emplace(std::move(object));
+}
+
+template <typename T, typename TBase>
+void RemoveFromUniqueSet(HWObjectContainerConcurrent<T>& cont, const TBase* entry)
+{
+    if (entry)
+        cont.erase(entry);
+}
 
 
 } // /namespace LLGL
@@ -340,6 +340,14 @@ void DXGetRenderingCaps(RenderingCapabilities& caps, D3D_FEATURE_LEVEL featureLe
         );
     }
 
+    if (featureLevel >= D3D_FEATURE_LEVEL_11_0)
+    {
+        caps.textureFormats.insert(
+            caps.textureFormats.end(),
+            { Format::BC7UNorm, Format::BC7UNorm_sRGB }
+        );
+    }
+
     /* Query features */
     caps.features.hasRenderTargets                  = true;
     caps.features.has3DTextures                     = true;
@@ -474,6 +482,42 @@ UINT DXGetCompilerFlags(int flags)
     return dxFlags;
 }
 
+const D3D_SHADER_MACRO* DXGetShaderMacros(
+    const ShaderMacro*              defines,
+    const ShaderSpecialization*     specializations,
+    std::vector<D3D_SHADER_MACRO>&  macros,
+    std::vector<std::string>&       valueStrings)
+{
+    /* Without specialization constants, <ShaderMacro> is layout compatible with <D3D_SHADER_MACRO> */
+    if (specializations == nullptr)
+        return reinterpret_cast<const D3D_SHADER_MACRO*>(defines);
+
+    /* Copy macro definitions into combined array */
+    if (defines != nullptr)
+    {
+        for (; defines->name != nullptr; ++defines)
+            macros.push_back({ defines->name, defines->definition });
+    }
+
+    /* Reserve value strings first, so their C-string pointers remain valid while the array grows */
+    std::size_t numSpecializations = 0;
+    for (auto entry = specializations; entry->name != nullptr; ++entry)
+        ++numSpecializations;
+    valueStrings.reserve(numSpecializations);
+
+    /* Append one macro definition for each specialization constant */
+    for (; specializations->name != nullptr; ++specializations)
+    {
+        valueStrings.push_back(std::to_string(specializations->value));
+        macros.push_back({ specializations->name, valueStrings.back().c_str() });
+    }
+
+    /* Terminate array (as required by "D3DCompile") */
+    macros.push_back({ nullptr, nullptr });
+
+    return macros.data();
+}
+
 VideoAdapterDescriptor DXGetVideoAdapterDesc(IDXGIAdapter* adapter)
 {
     ComPtr<IDXGIOutput> output;
@@ -488,6 +532,8 @@ VideoAdapterDescriptor DXGetVideoAdapterDesc(IDXGIAdapter* adapter)
     videoAdapterDesc.name           = std::wstring(desc.Description);
     videoAdapterDesc.vendor         = GetVendorByID(desc.VendorId);
     videoAdapterDesc.videoMemory    = static_cast<uint64_t>(desc.DedicatedVideoMemory);
+    videoAdapterDesc.vendorID       = desc.VendorId;
+    videoAdapterDesc.deviceID       = desc.DeviceId;
 
     /* Enumerate over all adapter outputs */
     for (UINT j = 0; adapter->EnumOutputs(j, &output) != DXGI_ERROR_NOT_FOUND; ++j)
@@ -13,6 +13,7 @@
 #include <LLGL/RenderSystemFlags.h>
 #include <LLGL/VideoAdapter.h>
 #include <LLGL/ImageFlags.h>
+#include <LLGL/ShaderFlags.h>
 #include "ComPtr.h"
 #include <dxgi.h>
 #include <string>
@@ -82,6 +83,17 @@ const char* DXFeatureLevelToShaderModel(D3D_FEATURE_LEVEL featureLevel);
 // Returns the compiler flags for the 'ShaderCompileFlags' enumeration values.
 UINT DXGetCompilerFlags(int flags);
 
+/*
+Returns the array of D3D shader macros for the specified macro definitions and specialization constants, or null if both are null.
+The 'macros' and 'valueStrings' containers serve as storage for the combined array and must outlive the returned pointer.
+*/
+const D3D_SHADER_MACRO* DXGetShaderMacros(
+    const ShaderMacro*              defines,
+    const ShaderSpecialization*     specializations,
+    std::vector<D3D_SHADER_MACRO>&  macros,
+    std::vector<std::string>&       valueStrings
+);
+
 // Returns the video adapter descriptor from the specified DXGI adapter.
 VideoAdapterDescriptor DXGetVideoAdapterDesc(IDXGIAdapter* adapter);
 
@@ -35,9 +35,10 @@ class DbgBuffer final : public Buffer
         Buffer&                 instance;
         const BufferDescriptor  desc;
         std::string             label;
-        std::uint64_t           elements    = 0;
-        bool                    initialized = false;
-        bool                    mapped      = false;
+        std::uint64_t           registryHandle  = 0;
+        std::uint64_t           elements        = 0;
+        bool                    initialized     = false;
+        bool                    mapped          = false;
 
 };
 
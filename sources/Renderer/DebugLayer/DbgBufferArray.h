@@ -29,6 +29,7 @@ class DbgBufferArray final : public BufferArray
 
         BufferArray&                    instance;
         const std::vector<DbgBuffer*>   buffers;
+        std::uint64_t                   registryHandle  = 0;
 
 };
 
@@ -19,6 +19,7 @@
 #include "DbgQueryHeap.h"
 #include "DbgComputePipeline.h"
 
+#include <LLGL/RenderSystem.h>
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/IndirectArguments.h>
 #include <LLGL/Strings.h>
@@ -37,18 +38,46 @@ static const char* GetLabelOrDefault(const std::string& label, const char* defau
         return label.c_str();
 }
 
+// Maximum number of time records (and timer queries) per command buffer encoding; excess records are dropped
+static const std::uint32_t g_maxNumTimeRecords = 64;
+
+// Maximum number of pipeline-statistics queries per command buffer encoding; excess top-level debug groups are dropped
+static const std::uint32_t g_maxNumStatsQueries = 64;
+
 DbgCommandBuffer::DbgCommandBuffer(
+    RenderSystem&                   renderSystemInstance,
     CommandBuffer&                  instance,
     RenderingDebugger*              debugger,
+    RenderingProfiler*              profiler,
     const CommandBufferDescriptor&  desc,
     const RenderingCapabilities&    caps)
 :
-    instance      { instance      },
-    desc          { desc          },
-    debugger_     { debugger      },
-    features_     { caps.features },
-    limits_       { caps.limits   }
+    instance              { instance             },
+    desc                  { desc                 },
+    renderSystemInstance_ { renderSystemInstance },
+    debuggerInstance_     { debugger             },
+    debugger_             { debugger             },
+    profiler_             { profiler             },
+    features_             { caps.features        },
+    limits_               { caps.limits          }
+{
+}
+
+DbgCommandBuffer::~DbgCommandBuffer()
 {
+    /* Release internal timer query heaps */
+    for (auto queryHeap : timeQueryHeaps_)
+    {
+        if (queryHeap != nullptr)
+            renderSystemInstance_.Release(*queryHeap);
+    }
+
+    /* Release internal pipeline-statistics query heaps */
+    for (auto queryHeap : statsQueryHeaps_)
+    {
+        if (queryHeap != nullptr)
+            renderSystemInstance_.Release(*queryHeap);
+    }
 }
 
 /* ----- Encoding ----- */
@@ -57,6 +86,24 @@ void DbgCommandBuffer::Begin()
 {
     ResetFrameProfile();
 
+    /* Discard time records and pipeline-statistics queries of a previous encoding that was never submitted */
+    pendingTimeRecords_.clear();
+    timeRecordOpen_         = false;
+    numPendingStatsQueries_ = 0;
+    statsRecordOpen_        = false;
+
+    /* Discard split resource transitions and copy batch of a previous encoding */
+    pendingResourceTransitions_.clear();
+    states_.insideCopyBatch = false;
+
+    /* Latch validation sampling and categories for the entire encoding; pass through cheaply while sampled out */
+    if (debuggerInstance_ != nullptr && debuggerInstance_->IsFrameValidationEnabled())
+        debugger_ = debuggerInstance_;
+    else
+        debugger_ = nullptr;
+
+    validationCategories_ = (debugger_ != nullptr ? debugger_->GetValidationCategories() : 0);
+
     if (debugger_)
         EnableRecording(true);
 
@@ -67,6 +114,10 @@ void DbgCommandBuffer::Begin()
 
 void DbgCommandBuffer::End()
 {
+    /* Close records of an unbalanced debug group */
+    EndTimeRecord();
+    EndStatsRecord();
+
     if (debugger_)
         EnableRecording(false);
     instance.End();
@@ -157,6 +208,40 @@ void DbgCommandBuffer::CopyTexture(
     profile_.textureCopies++;
 }
 
+void DbgCommandBuffer::BeginCopyBatch()
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+
+        if (states_.insideRenderPass)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot begin copy batch inside render pass");
+        if (states_.insideCopyBatch)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "copy batches must not be nested");
+    }
+
+    states_.insideCopyBatch = true;
+
+    instance.BeginCopyBatch();
+}
+
+void DbgCommandBuffer::EndCopyBatch()
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+
+        if (!states_.insideCopyBatch)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot end copy batch without a prior call to <BeginCopyBatch>");
+    }
+
+    states_.insideCopyBatch = false;
+
+    instance.EndCopyBatch();
+}
+
 void DbgCommandBuffer::GenerateMips(Texture& texture)
 {
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
@@ -481,6 +566,48 @@ void DbgCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::u
     profile_.computeResourceHeapBindings++;
 }
 
+void DbgCommandBuffer::SetGraphicsResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    LLGL_DBG_SOURCE;
+    AssertRecording();
+
+    if (numDynamicOffsets > 0 && dynamicOffsets == nullptr)
+    {
+        if (debugger_)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "dynamic offset array must not be a null pointer");
+        numDynamicOffsets = 0;
+    }
+
+    instance.SetGraphicsResourceHeap(resourceHeap, firstSet, numDynamicOffsets, dynamicOffsets);
+
+    profile_.graphicsResourceHeapBindings++;
+}
+
+void DbgCommandBuffer::SetComputeResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    LLGL_DBG_SOURCE;
+    AssertRecording();
+
+    if (numDynamicOffsets > 0 && dynamicOffsets == nullptr)
+    {
+        if (debugger_)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "dynamic offset array must not be a null pointer");
+        numDynamicOffsets = 0;
+    }
+
+    instance.SetComputeResourceHeap(resourceHeap, firstSet, numDynamicOffsets, dynamicOffsets);
+
+    profile_.computeResourceHeapBindings++;
+}
+
 void DbgCommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags)
 {
     if (debugger_)
@@ -579,6 +706,79 @@ void DbgCommandBuffer::ResetResourceSlots(
     instance.ResetResourceSlots(resourceType, firstSlot, numSlots, bindFlags, stageFlags);
 }
 
+void DbgCommandBuffer::BeginResourceTransition(Resource& resource, long bindFlags)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+
+        if (states_.insideRenderPass)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot begin split resource transition inside render pass");
+
+        auto it = std::find(pendingResourceTransitions_.begin(), pendingResourceTransitions_.end(), &resource);
+        if (it != pendingResourceTransitions_.end())
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "split resource transition has already begun for the specified resource");
+        else
+            pendingResourceTransitions_.push_back(&resource);
+    }
+
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto& bufferDbg = LLGL_CAST(DbgBuffer&, resource);
+            instance.BeginResourceTransition(bufferDbg.instance, bindFlags);
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureDbg = LLGL_CAST(DbgTexture&, resource);
+            instance.BeginResourceTransition(textureDbg.instance, bindFlags);
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+void DbgCommandBuffer::EndResourceTransition(Resource& resource, long bindFlags)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertRecording();
+
+        auto it = std::find(pendingResourceTransitions_.begin(), pendingResourceTransitions_.end(), &resource);
+        if (it == pendingResourceTransitions_.end())
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "no split resource transition has begun for the specified resource");
+        else
+            pendingResourceTransitions_.erase(it);
+    }
+
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto& bufferDbg = LLGL_CAST(DbgBuffer&, resource);
+            instance.EndResourceTransition(bufferDbg.instance, bindFlags);
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureDbg = LLGL_CAST(DbgTexture&, resource);
+            instance.EndResourceTransition(textureDbg.instance, bindFlags);
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void DbgCommandBuffer::BeginRenderPass(
@@ -918,6 +1118,30 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::u
     profile_.drawCommands += numCommands;
 }
 
+void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    auto& bufferDbg         = LLGL_CAST(DbgBuffer&, buffer);
+    auto& countBufferDbg    = LLGL_CAST(DbgBuffer&, countBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertDrawIndirectCountSupported();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, stride*maxNumCommands);
+        ValidateBufferRange(countBufferDbg, countOffset, sizeof(std::uint32_t));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(countOffset, 4, "<countOffset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    instance.DrawIndirect(bufferDbg.instance, offset, countBufferDbg.instance, countOffset, maxNumCommands, stride);
+
+    /* The actual draw count is only known by the GPU, so assume the maximum for profiling */
+    profile_.drawCommands += maxNumCommands;
+}
+
 void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
@@ -955,6 +1179,84 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
     profile_.drawCommands += numCommands;
 }
 
+void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    auto& bufferDbg         = LLGL_CAST(DbgBuffer&, buffer);
+    auto& countBufferDbg    = LLGL_CAST(DbgBuffer&, countBuffer);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertDrawIndirectCountSupported();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, stride*maxNumCommands);
+        ValidateBufferRange(countBufferDbg, countOffset, sizeof(std::uint32_t));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(countOffset, 4, "<countOffset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    instance.DrawIndexedIndirect(bufferDbg.instance, offset, countBufferDbg.instance, countOffset, maxNumCommands, stride);
+
+    /* The actual draw count is only known by the GPU, so assume the maximum for profiling */
+    profile_.drawCommands += maxNumCommands;
+}
+
+void DbgCommandBuffer::DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (numCommands > 0 && commands == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "argument array of multi draw command must not be a null pointer");
+        else
+        {
+            for (std::uint32_t i = 0; i < numCommands; ++i)
+                ValidateDrawCmd(commands[i].numVertices, commands[i].firstVertex, commands[i].numInstances, commands[i].firstInstance);
+        }
+    }
+
+    instance.DrawMulti(numCommands, commands);
+
+    profile_.drawCommands += numCommands;
+}
+
+void DbgCommandBuffer::DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (numCommands > 0 && commands == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "argument array of multi draw command must not be a null pointer");
+        else
+        {
+            for (std::uint32_t i = 0; i < numCommands; ++i)
+                ValidateDrawIndexedCmd(commands[i].numIndices, commands[i].numInstances, commands[i].firstIndex, commands[i].vertexOffset, commands[i].firstInstance);
+        }
+    }
+
+    instance.DrawIndexedMulti(numCommands, commands);
+
+    profile_.drawCommands += numCommands;
+}
+
+void DbgCommandBuffer::DrawMeshTasks(std::uint32_t numWorkGroups, std::uint32_t firstWorkGroup)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        AssertMeshShadersSupported();
+        AssertRecording();
+        AssertInsideRenderPass();
+        AssertGraphicsPipelineBound();
+    }
+
+    instance.DrawMeshTasks(numWorkGroups, firstWorkGroup);
+
+    profile_.drawCommands++;
+}
+
 /* ----- Compute ----- */
 
 void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -1010,10 +1312,27 @@ void DbgCommandBuffer::PushDebugGroup(const char* name)
 
     debugGroups_.push(name);
     instance.PushDebugGroup(name);
+
+    /* Split GPU timing of the enclosing group and start timing the new group scope */
+    if (IsTimeRecordingEnabled())
+    {
+        EndTimeRecord();
+        BeginTimeRecord(name, static_cast<std::uint32_t>(debugGroups_.size()) - 1);
+    }
+
+    /* Surround top-level debug groups with a pipeline-statistics query */
+    if (IsStatsRecordingEnabled() && debugGroups_.size() == 1)
+        BeginStatsRecord();
 }
 
 void DbgCommandBuffer::PopDebugGroup()
 {
+    EndTimeRecord();
+
+    /* Close pipeline-statistics query of a top-level debug group */
+    if (debugGroups_.size() == 1)
+        EndStatsRecord();
+
     instance.PopDebugGroup();
     debugGroups_.pop();
 
@@ -1024,6 +1343,10 @@ void DbgCommandBuffer::PopDebugGroup()
         else
             debugger_->SetDebugGroup(debugGroups_.top().c_str());
     }
+
+    /* Resume GPU timing of the enclosing group with a new segment */
+    if (IsTimeRecordingEnabled() && !debugGroups_.empty())
+        BeginTimeRecord(debugGroups_.top().c_str(), static_cast<std::uint32_t>(debugGroups_.size()) - 1);
 }
 
 /* ----- Extensions ----- */
@@ -1055,6 +1378,28 @@ void DbgCommandBuffer::NextProfile(FrameProfile& outputProfile)
 {
     /* Copy frame profile values to output profile */
     std::copy(std::begin(profile_.values), std::end(profile_.values), std::begin(outputProfile.values));
+
+    /* Resolve time records and pipeline statistics of the previously submitted encoding */
+    ResolveQueriedTimeRecords(outputProfile.timeRecords);
+    ResolveQueriedStatsRecords(outputProfile.pipelineStats);
+
+    /* Defer time records of this encoding until their query results are available, and flip timer query heaps */
+    if (!pendingTimeRecords_.empty())
+    {
+        queriedTimeRecords_ = std::move(pendingTimeRecords_);
+        pendingTimeRecords_.clear();
+        queriedTimeQueryHeap_   = activeTimeQueryHeap_;
+        activeTimeQueryHeap_    = (activeTimeQueryHeap_ + 1) % 2;
+    }
+
+    /* Defer pipeline-statistics queries of this encoding likewise */
+    if (numPendingStatsQueries_ > 0)
+    {
+        numQueriedStatsQueries_ = numPendingStatsQueries_;
+        numPendingStatsQueries_ = 0;
+        queriedStatsQueryHeap_  = activeStatsQueryHeap_;
+        activeStatsQueryHeap_   = (activeStatsQueryHeap_ + 1) % 2;
+    }
 }
 
 
@@ -1064,6 +1409,9 @@ void DbgCommandBuffer::NextProfile(FrameProfile& outputProfile)
 
 void DbgCommandBuffer::ValidateGenerateMips(DbgTexture& textureDbg, const TextureSubresource* subresource)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::Bindings))
+        return;
+
     if ((textureDbg.desc.bindFlags & BindFlags::ColorAttachment) == 0)
     {
         LLGL_DBG_ERROR(
@@ -1126,6 +1474,9 @@ void DbgCommandBuffer::ValidateGenerateMips(DbgTexture& textureDbg, const Textur
 
 void DbgCommandBuffer::ValidateViewport(const Viewport& viewport)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (viewport.width < 0.0f || viewport.height < 0.0f)
         LLGL_DBG_ERROR(ErrorType::UndefinedBehavior, "viewport of negative width or negative height");
     if (viewport.width == 0.0f || viewport.height == 0.0f)
@@ -1147,6 +1498,9 @@ void DbgCommandBuffer::ValidateViewport(const Viewport& viewport)
 
 void DbgCommandBuffer::ValidateAttachmentClear(const AttachmentClear& attachment)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::DrawState))
+        return;
+
     if (bindings_.renderContext != nullptr)
     {
         if ((attachment.flags & ClearFlags::Color) != 0)
@@ -1180,6 +1534,9 @@ void DbgCommandBuffer::ValidateAttachmentClear(const AttachmentClear& attachment
 
 void DbgCommandBuffer::ValidateVertexLayout()
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::DrawState))
+        return;
+
     if (bindings_.graphicsPipeline && bindings_.numVertexBuffers > 0)
     {
         auto shaderProgramDbg = LLGL_CAST(const DbgShaderProgram*, bindings_.graphicsPipeline->desc.shaderProgram);
@@ -1220,6 +1577,9 @@ void DbgCommandBuffer::ValidateVertexLayoutAttributes(const std::vector<VertexAt
 
 void DbgCommandBuffer::ValidateNumVertices(std::uint32_t numVertices)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (numVertices == 0)
         LLGL_DBG_WARN(WarningType::PointlessOperation, "no vertices will be generated");
 
@@ -1290,12 +1650,18 @@ void DbgCommandBuffer::ValidateNumVertices(std::uint32_t numVertices)
 
 void DbgCommandBuffer::ValidateNumInstances(std::uint32_t numInstances)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (numInstances == 0)
         LLGL_DBG_WARN(WarningType::PointlessOperation, "no instances will be generated");
 }
 
 void DbgCommandBuffer::ValidateVertexID(std::uint32_t firstVertex)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (firstVertex > 0)
     {
         if (auto shaderProgramDbg = bindings_.shaderProgram_)
@@ -1313,6 +1679,9 @@ void DbgCommandBuffer::ValidateVertexID(std::uint32_t firstVertex)
 
 void DbgCommandBuffer::ValidateInstanceID(std::uint32_t firstInstance)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (firstInstance > 0)
     {
         if (auto shaderProgramDbg = bindings_.shaderProgram_)
@@ -1364,6 +1733,9 @@ void DbgCommandBuffer::ValidateDrawIndexedCmd(
 
 void DbgCommandBuffer::ValidateVertexLimit(std::uint32_t vertexCount, std::uint32_t vertexLimit)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (vertexCount > vertexLimit)
     {
         LLGL_DBG_ERROR(
@@ -1376,6 +1748,9 @@ void DbgCommandBuffer::ValidateVertexLimit(std::uint32_t vertexCount, std::uint3
 
 void DbgCommandBuffer::ValidateThreadGroupLimit(std::uint32_t size, std::uint32_t limit)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (size > limit)
     {
         LLGL_DBG_ERROR(
@@ -1388,6 +1763,9 @@ void DbgCommandBuffer::ValidateThreadGroupLimit(std::uint32_t size, std::uint32_
 
 void DbgCommandBuffer::ValidateAttachmentLimit(std::uint32_t attachmentIndex, std::uint32_t attachmentUpperBound)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (attachmentIndex >= attachmentUpperBound)
     {
         LLGL_DBG_ERROR(
@@ -1447,6 +1825,9 @@ static std::string BindFlagsToStringList(long bindFlags)
 
 void DbgCommandBuffer::ValidateBindFlags(long resourceFlags, long bindFlags, long validFlags, const char* resourceName)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::Bindings))
+        return;
+
     /* Determine invalid and missing bit flags */
     const long invalidFlags = (bindFlags & ~validFlags);
     const long missingFlags = ((resourceFlags & bindFlags) ^ bindFlags) & (~invalidFlags);
@@ -1477,6 +1858,9 @@ void DbgCommandBuffer::ValidateBindBufferFlags(DbgBuffer& bufferDbg, long bindFl
 
 void DbgCommandBuffer::ValidateIndexType(const Format format)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (format != Format::R16UInt && format != Format::R32UInt)
     {
         if (auto formatName = ToString(format))
@@ -1488,6 +1872,9 @@ void DbgCommandBuffer::ValidateIndexType(const Format format)
 
 void DbgCommandBuffer::ValidateStageFlags(long stageFlags, long validFlags)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::Bindings))
+        return;
+
     if ((stageFlags & validFlags) == 0)
         LLGL_DBG_WARN(WarningType::PointlessOperation, "no shader stage is specified");
     if ((stageFlags & (~validFlags)) != 0)
@@ -1496,6 +1883,9 @@ void DbgCommandBuffer::ValidateStageFlags(long stageFlags, long validFlags)
 
 void DbgCommandBuffer::ValidateBufferRange(DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (offset + size > bufferDbg.desc.size)
     {
         LLGL_DBG_ERROR(
@@ -1508,6 +1898,9 @@ void DbgCommandBuffer::ValidateBufferRange(DbgBuffer& bufferDbg, std::uint64_t o
 
 void DbgCommandBuffer::ValidateAddressAlignment(std::uint64_t address, std::uint64_t alignment, const char* addressName)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return;
+
     if (alignment > 0 && (address % alignment != 0))
     {
         LLGL_DBG_ERROR(
@@ -1519,6 +1912,9 @@ void DbgCommandBuffer::ValidateAddressAlignment(std::uint64_t address, std::uint
 
 bool DbgCommandBuffer::ValidateQueryIndex(DbgQueryHeap& queryHeapDbg, std::uint32_t query)
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::ValueLimits))
+        return true;
+
     if (query >= queryHeapDbg.states.size())
     {
         LLGL_DBG_ERROR(
@@ -1541,30 +1937,45 @@ DbgQueryHeap::State* DbgCommandBuffer::GetAndValidateQueryState(DbgQueryHeap& qu
 
 void DbgCommandBuffer::AssertRecording()
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::Threading))
+        return;
+
     if (!states_.recording)
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "command buffer must be in record mode: missing call to <LLGL::CommandQueue::Begin>");
 }
 
 void DbgCommandBuffer::AssertInsideRenderPass()
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::DrawState))
+        return;
+
     if (!states_.insideRenderPass)
         LLGL_DBG_ERROR(ErrorType::InvalidState, "operation is only allowed inside a render pass: missing call to <LLGL::CommandBuffer::BeginRenderPass>");
 }
 
 void DbgCommandBuffer::AssertGraphicsPipelineBound()
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::DrawState))
+        return;
+
     if (!bindings_.graphicsPipeline)
         LLGL_DBG_ERROR(ErrorType::InvalidState, "no graphics pipeline is bound: missing call to <LLGL::CommandBuffer::SetGraphicsPipeline>");
 }
 
 void DbgCommandBuffer::AssertComputePipelineBound()
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::DrawState))
+        return;
+
     if (!bindings_.computePipeline)
         LLGL_DBG_ERROR(ErrorType::InvalidState, "no compute pipeline is bound: missing call to <LLGL::CommandBuffer::SetComputePipeline>");
 }
 
 void DbgCommandBuffer::AssertVertexBufferBound()
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::DrawState))
+        return;
+
     if (bindings_.numVertexBuffers > 0)
     {
         for (std::uint32_t i = 0; i < bindings_.numVertexBuffers; ++i)
@@ -1583,6 +1994,9 @@ void DbgCommandBuffer::AssertVertexBufferBound()
 
 void DbgCommandBuffer::AssertIndexBufferBound()
 {
+    if (!IsValidationEnabled(ValidationCategoryFlags::DrawState))
+        return;
+
     if (auto buffer = bindings_.indexBuffer)
     {
         if (!buffer->initialized)
@@ -1612,6 +2026,18 @@ void DbgCommandBuffer::AssertIndirectDrawingSupported()
         LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing");
 }
 
+void DbgCommandBuffer::AssertMeshShadersSupported()
+{
+    if (!features_.hasMeshShaders)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("mesh shaders");
+}
+
+void DbgCommandBuffer::AssertDrawIndirectCountSupported()
+{
+    if (!features_.hasDrawIndirectCount)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing with GPU-provided draw count");
+}
+
 void DbgCommandBuffer::AssertNullPointer(const void* ptr, const char* name)
 {
     if (ptr == nullptr)
@@ -1638,6 +2064,149 @@ void DbgCommandBuffer::ResetFrameProfile()
     std::fill(std::begin(profile_.values), std::end(profile_.values), 0);
 }
 
+bool DbgCommandBuffer::IsTimeRecordingEnabled() const
+{
+    return (profiler_ != nullptr && profiler_->timeRecordingEnabled);
+}
+
+void DbgCommandBuffer::BeginTimeRecord(const char* annotation, std::uint32_t level)
+{
+    /* Create timer query heaps on first use */
+    if (timeQueryHeaps_[0] == nullptr)
+    {
+        QueryHeapDescriptor queryHeapDesc;
+        queryHeapDesc.type          = QueryType::TimeElapsed;
+        queryHeapDesc.numQueries    = g_maxNumTimeRecords;
+
+        timeQueryHeaps_[0] = renderSystemInstance_.CreateQueryHeap(queryHeapDesc);
+        timeQueryHeaps_[1] = renderSystemInstance_.CreateQueryHeap(queryHeapDesc);
+    }
+
+    if (pendingTimeRecords_.size() < g_maxNumTimeRecords)
+    {
+        /* Store annotation and nesting level; the query index equals the record index */
+        const auto query = static_cast<std::uint32_t>(pendingTimeRecords_.size());
+
+        ProfileTimeRecord record;
+        record.annotation   = annotation;
+        record.level        = level;
+        pendingTimeRecords_.push_back(std::move(record));
+
+        /* Begin timer query for the new segment */
+        instance.BeginQuery(*timeQueryHeaps_[activeTimeQueryHeap_], query);
+        timeRecordOpen_ = true;
+    }
+}
+
+void DbgCommandBuffer::EndTimeRecord()
+{
+    if (timeRecordOpen_)
+    {
+        const auto query = static_cast<std::uint32_t>(pendingTimeRecords_.size()) - 1;
+        instance.EndQuery(*timeQueryHeaps_[activeTimeQueryHeap_], query);
+        timeRecordOpen_ = false;
+    }
+}
+
+void DbgCommandBuffer::ResolveQueriedTimeRecords(std::vector<ProfileTimeRecord>& outputRecords)
+{
+    if (!queriedTimeRecords_.empty())
+    {
+        auto commandQueue = renderSystemInstance_.GetCommandQueue();
+        auto& queryHeap = *timeQueryHeaps_[queriedTimeQueryHeap_];
+
+        for (std::size_t i = 0; i < queriedTimeRecords_.size(); ++i)
+        {
+            const auto query = static_cast<std::uint32_t>(i);
+
+            std::uint64_t elapsedTime = 0;
+            if (!commandQueue->QueryResult(queryHeap, query, 1, &elapsedTime, sizeof(elapsedTime)))
+            {
+                /* Results lag one submission behind; wait for the GPU if they are still in flight */
+                commandQueue->WaitIdle();
+                if (!commandQueue->QueryResult(queryHeap, query, 1, &elapsedTime, sizeof(elapsedTime)))
+                    continue;
+            }
+
+            queriedTimeRecords_[i].elapsedTime = elapsedTime;
+            outputRecords.push_back(std::move(queriedTimeRecords_[i]));
+        }
+
+        queriedTimeRecords_.clear();
+    }
+}
+
+bool DbgCommandBuffer::IsStatsRecordingEnabled() const
+{
+    return (profiler_ != nullptr && profiler_->pipelineStatsRecordingEnabled);
+}
+
+void DbgCommandBuffer::BeginStatsRecord()
+{
+    /* Create pipeline-statistics query heaps on first use */
+    if (statsQueryHeaps_[0] == nullptr)
+    {
+        QueryHeapDescriptor queryHeapDesc;
+        queryHeapDesc.type          = QueryType::PipelineStatistics;
+        queryHeapDesc.numQueries    = g_maxNumStatsQueries;
+
+        statsQueryHeaps_[0] = renderSystemInstance_.CreateQueryHeap(queryHeapDesc);
+        statsQueryHeaps_[1] = renderSystemInstance_.CreateQueryHeap(queryHeapDesc);
+    }
+
+    if (numPendingStatsQueries_ < g_maxNumStatsQueries)
+    {
+        instance.BeginQuery(*statsQueryHeaps_[activeStatsQueryHeap_], numPendingStatsQueries_);
+        numPendingStatsQueries_++;
+        statsRecordOpen_ = true;
+    }
+}
+
+void DbgCommandBuffer::EndStatsRecord()
+{
+    if (statsRecordOpen_)
+    {
+        instance.EndQuery(*statsQueryHeaps_[activeStatsQueryHeap_], numPendingStatsQueries_ - 1);
+        statsRecordOpen_ = false;
+    }
+}
+
+void DbgCommandBuffer::ResolveQueriedStatsRecords(QueryPipelineStatistics& outputStats)
+{
+    if (numQueriedStatsQueries_ > 0)
+    {
+        auto commandQueue = renderSystemInstance_.GetCommandQueue();
+        auto& queryHeap = *statsQueryHeaps_[queriedStatsQueryHeap_];
+
+        for (std::uint32_t query = 0; query < numQueriedStatsQueries_; ++query)
+        {
+            QueryPipelineStatistics stats;
+            if (!commandQueue->QueryResult(queryHeap, query, 1, &stats, sizeof(stats)))
+            {
+                /* Results lag one submission behind; wait for the GPU if they are still in flight */
+                commandQueue->WaitIdle();
+                if (!commandQueue->QueryResult(queryHeap, query, 1, &stats, sizeof(stats)))
+                    continue;
+            }
+
+            /* Accumulate statistics of all top-level debug groups */
+            outputStats.inputAssemblyVertices           += stats.inputAssemblyVertices;
+            outputStats.inputAssemblyPrimitives         += stats.inputAssemblyPrimitives;
+            outputStats.vertexShaderInvocations         += stats.vertexShaderInvocations;
+            outputStats.geometryShaderInvocations       += stats.geometryShaderInvocations;
+            outputStats.geometryShaderPrimitives        += stats.geometryShaderPrimitives;
+            outputStats.clippingInvocations             += stats.clippingInvocations;
+            outputStats.clippingPrimitives              += stats.clippingPrimitives;
+            outputStats.fragmentShaderInvocations       += stats.fragmentShaderInvocations;
+            outputStats.tessControlShaderInvocations    += stats.tessControlShaderInvocations;
+            outputStats.tessEvaluationShaderInvocations += stats.tessEvaluationShaderInvocations;
+            outputStats.computeShaderInvocations        += stats.computeShaderInvocations;
+        }
+
+        numQueriedStatsQueries_ = 0;
+    }
+}
+
 
 } // /namespace LLGL
 
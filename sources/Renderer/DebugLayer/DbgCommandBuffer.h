@@ -16,12 +16,14 @@
 #include <cstdint>
 #include <string>
 #include <stack>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+class RenderSystem;
 class DbgBuffer;
 class DbgTexture;
 class DbgRenderContext;
@@ -38,12 +40,16 @@ class DbgCommandBuffer final : public CommandBuffer
         /* ----- Common ----- */
 
         DbgCommandBuffer(
+            RenderSystem&                   renderSystemInstance,
             CommandBuffer&                  instance,
             RenderingDebugger*              debugger,
+            RenderingProfiler*              profiler,
             const CommandBufferDescriptor&  desc,
             const RenderingCapabilities&    caps
         );
 
+        ~DbgCommandBuffer();
+
         /* ----- Encoding ----- */
 
         void Begin() override;
@@ -76,6 +82,9 @@ class DbgCommandBuffer final : public CommandBuffer
             const Extent3D&         extent
         ) override;
 
+        void BeginCopyBatch() override;
+        void EndCopyBatch() override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, const TextureSubresource& subresource) override;
 
@@ -117,6 +126,9 @@ class DbgCommandBuffer final : public CommandBuffer
         void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
         void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
 
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets) override;
+
         void SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags = StageFlags::AllStages) override;
 
         void ResetResourceSlots(
@@ -127,6 +139,9 @@ class DbgCommandBuffer final : public CommandBuffer
             long                stageFlags      = StageFlags::AllStages
         ) override;
 
+        void BeginResourceTransition(Resource& resource, long bindFlags) override;
+        void EndResourceTransition(Resource& resource, long bindFlags) override;
+
         /* ----- Render Passes ----- */
 
         void BeginRenderPass(
@@ -180,9 +195,16 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void DrawIndirect(Buffer& buffer, std::uint64_t offset) override;
         void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
 
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands) override;
+        void DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands) override;
+
+        void DrawMeshTasks(std::uint32_t numWorkGroups, std::uint32_t firstWorkGroup = 0) override;
 
         /* ----- Compute ----- */
 
@@ -212,6 +234,7 @@ class DbgCommandBuffer final : public CommandBuffer
 
         CommandBuffer&                  instance;
         const CommandBufferDescriptor   desc;
+        std::uint64_t                   registryHandle  = 0;
 
     private:
 
@@ -255,24 +278,72 @@ class DbgCommandBuffer final : public CommandBuffer
         void AssertInstancingSupported();
         void AssertOffsetInstancingSupported();
         void AssertIndirectDrawingSupported();
+        void AssertMeshShadersSupported();
+        void AssertDrawIndirectCountSupported();
 
         void AssertNullPointer(const void* ptr, const char* name);
 
+        // Returns true if all specified validation categories are enabled for this encoding (see RenderingDebugger::SetValidationCategories)
+        inline bool IsValidationEnabled(long categories) const
+        {
+            return ((validationCategories_ & categories) == categories);
+        }
+
         void WarnImproperVertices(const std::string& topologyName, std::uint32_t unusedVertices);
 
         void ResetFrameProfile();
 
+        bool IsTimeRecordingEnabled() const;
+        void BeginTimeRecord(const char* annotation, std::uint32_t level);
+        void EndTimeRecord();
+        void ResolveQueriedTimeRecords(std::vector<ProfileTimeRecord>& outputRecords);
+
+        bool IsStatsRecordingEnabled() const;
+        void BeginStatsRecord();
+        void EndStatsRecord();
+        void ResolveQueriedStatsRecords(QueryPipelineStatistics& outputStats);
+
     private:
 
         /* ----- Common objects ----- */
 
+        RenderSystem&                   renderSystemInstance_;
+
+        // Debugger this command buffer was created with; 'debugger_' is latched from
+        // this at Begin() and is null while validation is sampled out for the frame.
+        RenderingDebugger*              debuggerInstance_       = nullptr;
+
         RenderingDebugger*              debugger_               = nullptr;
+        RenderingProfiler*              profiler_               = nullptr;
+
+        // Validation category bitmask; latched together with 'debugger_' at Begin()
+        long                            validationCategories_   = 0;
 
         const RenderingFeatures&        features_;
         const RenderingLimits&          limits_;
 
         std::stack<std::string>         debugGroups_;
 
+        /* ----- GPU timing ----- */
+
+        // Double-buffered timer query heaps, so the results of the previously
+        // submitted encoding can be resolved while the next one is recorded.
+        QueryHeap*                      timeQueryHeaps_[2]      = {};
+        std::uint32_t                   activeTimeQueryHeap_    = 0;
+        std::uint32_t                   queriedTimeQueryHeap_   = 0;
+        bool                            timeRecordOpen_         = false;
+
+        std::vector<ProfileTimeRecord>  pendingTimeRecords_;
+        std::vector<ProfileTimeRecord>  queriedTimeRecords_;
+
+        // Double-buffered pipeline-statistics query heaps for top-level debug groups.
+        QueryHeap*                      statsQueryHeaps_[2]     = {};
+        std::uint32_t                   activeStatsQueryHeap_   = 0;
+        std::uint32_t                   queriedStatsQueryHeap_  = 0;
+        std::uint32_t                   numPendingStatsQueries_ = 0;
+        std::uint32_t                   numQueriedStatsQueries_ = 0;
+        bool                            statsRecordOpen_        = false;
+
         /* ----- Render states ----- */
 
         FrameProfile                    profile_;
@@ -300,10 +371,14 @@ class DbgCommandBuffer final : public CommandBuffer
         {
             bool recording          = false;
             bool insideRenderPass   = false;
+            bool insideCopyBatch    = false;
             bool streamOutputBusy   = false;
         }
         states_;
 
+        // Resources with a begun but not yet ended split transition
+        std::vector<const Resource*>    pendingResourceTransitions_;
+
 };
 
 
@@ -11,6 +11,7 @@
 #include "../CheckedCast.h"
 #include <LLGL/RenderingProfiler.h>
 #include <LLGL/RenderingDebugger.h>
+#include <vector>
 
 
 namespace LLGL
@@ -35,11 +36,53 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
     if (profiler_)
     {
         /* Merge frame profile values into rendering profiler */
-        FrameProfile profile;
-        commandBufferDbg.NextProfile(profile);
-        profile.commandBufferSubmittions++;
+        submittedProfile_.Clear();
+        commandBufferDbg.NextProfile(submittedProfile_);
+        submittedProfile_.commandBufferSubmittions++;
 
-        profiler_->Accumulate(profile);
+        profiler_->Accumulate(submittedProfile_);
+    }
+}
+
+void DbgCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (numCommandBuffers == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "no command buffers are specified to submit");
+        if (commandBuffers == nullptr && numCommandBuffers > 0)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer passed to batched command buffer submission");
+            return;
+        }
+    }
+
+    /* Unwrap command buffers and forward the entire batch to the instance queue */
+    std::vector<CommandBuffer*> instanceCommandBuffers;
+    instanceCommandBuffers.reserve(numCommandBuffers);
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffers[i]);
+        instanceCommandBuffers.push_back(&(commandBufferDbg->instance));
+    }
+
+    instance.Submit(numCommandBuffers, instanceCommandBuffers.data());
+
+    if (profiler_)
+    {
+        /* Merge frame profile values of all submitted command buffers into rendering profiler */
+        for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+        {
+            auto commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffers[i]);
+
+            submittedProfile_.Clear();
+            commandBufferDbg->NextProfile(submittedProfile_);
+            submittedProfile_.commandBufferSubmittions++;
+
+            profiler_->Accumulate(submittedProfile_);
+        }
     }
 }
 
@@ -58,6 +101,19 @@ bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery
     return instance.QueryResult(queryHeapDbg.instance, firstQuery, numQueries, data, dataSize);
 }
 
+bool DbgCommandQueue::QueryResultAvailable(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries)
+{
+    auto& queryHeapDbg = LLGL_CAST(DbgQueryHeap&, queryHeap);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateQueryRange(queryHeapDbg, firstQuery, numQueries);
+    }
+
+    return instance.QueryResultAvailable(queryHeapDbg.instance, firstQuery, numQueries);
+}
+
 /* ----- Fences ----- */
 
 void DbgCommandQueue::Submit(Fence& fence)
@@ -67,11 +123,51 @@ void DbgCommandQueue::Submit(Fence& fence)
         profiler_->frameProfile.fenceSubmissions++;
 }
 
+void DbgCommandQueue::Wait(Fence& fence)
+{
+    instance.Wait(fence);
+}
+
 bool DbgCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
     return instance.WaitFence(fence, timeout);
 }
 
+bool DbgCommandQueue::WaitFences(std::uint32_t numFences, Fence* const * fences, bool waitAll, std::uint64_t timeout)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (numFences == 0)
+            LLGL_DBG_WARN(WarningType::ImproperArgument, "waiting for fences has no effect: <numFences> is zero");
+        if (fences == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot wait for fences with <fences> parameter being a null pointer");
+    }
+    return instance.WaitFences(numFences, fences, waitAll, timeout);
+}
+
+bool DbgCommandQueue::IsSignaled(Fence& fence)
+{
+    return instance.IsSignaled(fence);
+}
+
+void DbgCommandQueue::Signal(Fence& fence, std::uint64_t value)
+{
+    instance.Signal(fence, value);
+    if (profiler_)
+        profiler_->frameProfile.fenceSubmissions++;
+}
+
+bool DbgCommandQueue::WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    return instance.WaitFenceValue(fence, value, timeout);
+}
+
+std::uint64_t DbgCommandQueue::GetFenceValue(Fence& fence)
+{
+    return instance.GetFenceValue(fence);
+}
+
 void DbgCommandQueue::WaitIdle()
 {
     instance.WaitIdle();
@@ -114,6 +210,15 @@ void DbgCommandQueue::ValidateQueryResult(
         }
     }
     else
+        ValidateQueryRange(queryHeap, firstQuery, numQueries);
+}
+
+void DbgCommandQueue::ValidateQueryRange(
+    DbgQueryHeap&   queryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries)
+{
+    if (firstQuery + numQueries > queryHeap.states.size())
     {
         LLGL_DBG_ERROR(
             ErrorType::InvalidArgument,
@@ -10,13 +10,13 @@
 
 
 #include <LLGL/CommandQueue.h>
+#include <LLGL/RenderingProfiler.h>
 
 
 namespace LLGL
 {
 
 
-class RenderingProfiler;
 class RenderingDebugger;
 class DbgQueryHeap;
 
@@ -36,6 +36,7 @@ class DbgCommandQueue final : public CommandQueue
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
 
         /* ----- Queries ----- */
 
@@ -47,11 +48,25 @@ class DbgCommandQueue final : public CommandQueue
             std::size_t     dataSize
         ) override;
 
+        bool QueryResultAvailable(
+            QueryHeap&      queryHeap,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries
+        ) override;
+
         /* ----- Fences ----- */
 
         void Submit(Fence& fence) override;
+        void Wait(Fence& fence) override;
 
         bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+        bool WaitFences(std::uint32_t numFences, Fence* const * fences, bool waitAll, std::uint64_t timeout) override;
+        bool IsSignaled(Fence& fence) override;
+
+        void Signal(Fence& fence, std::uint64_t value) override;
+        bool WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout) override;
+        std::uint64_t GetFenceValue(Fence& fence) override;
+
         void WaitIdle() override;
 
     public:
@@ -70,11 +85,20 @@ class DbgCommandQueue final : public CommandQueue
             std::size_t     dataSize
         );
 
+        void ValidateQueryRange(
+            DbgQueryHeap&   queryHeap,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries
+        );
+
     private:
 
         RenderingProfiler* profiler_ = nullptr;
         RenderingDebugger* debugger_ = nullptr;
 
+        // Scratch profile for merging submitted command buffer profiles; reused to avoid per-submit allocations
+        FrameProfile submittedProfile_;
+
 };
 
 
@@ -34,6 +34,7 @@ class DbgComputePipeline final : public ComputePipeline
         ComputePipeline&                instance;
         const ComputePipelineDescriptor desc;
         std::string                     label;
+        std::uint64_t                   registryHandle  = 0;
 
 };
 
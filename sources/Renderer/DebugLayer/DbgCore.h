@@ -20,11 +20,25 @@ namespace LLGL
 #define LLGL_DBG_SOURCE \
     DbgSetSource(debugger_, __FUNCTION__)
 
-#define LLGL_DBG_ERROR(TYPE, MESSAGE) \
-    DbgPostError(debugger_, (TYPE), (MESSAGE))
-
-#define LLGL_DBG_WARN(TYPE, MESSAGE) \
-    DbgPostWarning(debugger_, (TYPE), (MESSAGE))
+/*
+The message expression is only evaluated while the call site may still report this frame,
+so throttled violations are counted without constructing any message strings.
+*/
+#define LLGL_DBG_ERROR(TYPE, MESSAGE)                       \
+    do                                                      \
+    {                                                       \
+        if (DbgAcquireReport(debugger_))                    \
+            DbgPostError(debugger_, (TYPE), (MESSAGE));     \
+    }                                                       \
+    while (false)
+
+#define LLGL_DBG_WARN(TYPE, MESSAGE)                        \
+    do                                                      \
+    {                                                       \
+        if (DbgAcquireReport(debugger_))                    \
+            DbgPostWarning(debugger_, (TYPE), (MESSAGE));   \
+    }                                                       \
+    while (false)
 
 #define LLGL_DBG_ERROR_NOT_SUPPORTED(FEATURE) \
     LLGL_DBG_ERROR(ErrorType::UnsupportedFeature, std::string(FEATURE) + " not supported")
@@ -36,6 +50,11 @@ inline void DbgSetSource(RenderingDebugger* debugger, const char* source)
         debugger->SetSource(source);
 }
 
+inline bool DbgAcquireReport(RenderingDebugger* debugger)
+{
+    return (debugger != nullptr && debugger->AcquireReport());
+}
+
 inline void DbgPostError(RenderingDebugger* debugger, ErrorType type, const std::string& message)
 {
     if (debugger)
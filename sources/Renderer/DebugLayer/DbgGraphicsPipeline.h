@@ -34,6 +34,7 @@ class DbgGraphicsPipeline final : public GraphicsPipeline
         GraphicsPipeline&                   instance;
         const GraphicsPipelineDescriptor    desc;
         std::string                         label;
+        std::uint64_t                       registryHandle  = 0;
 
 };
 
@@ -34,6 +34,7 @@ class DbgPipelineLayout final : public PipelineLayout
         PipelineLayout&                 instance;
         const PipelineLayoutDescriptor  desc;
         std::string                     label;
+        std::uint64_t                   registryHandle  = 0;
 
 };
 
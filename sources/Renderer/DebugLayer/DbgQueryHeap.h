@@ -43,6 +43,7 @@ class DbgQueryHeap final : public QueryHeap
         QueryHeap&                  instance;
         const QueryHeapDescriptor   desc;
         std::string                 label;
+        std::uint64_t               registryHandle  = 0;
         std::vector<State>          states;
 
 };
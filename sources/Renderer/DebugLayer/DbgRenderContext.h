@@ -17,6 +17,7 @@ namespace LLGL
 
 
 class DbgBuffer;
+class RenderingDebugger;
 
 class DbgRenderContext final : public RenderContext
 {
@@ -32,17 +33,22 @@ class DbgRenderContext final : public RenderContext
 
     public:
 
-        DbgRenderContext(RenderContext& instance);
+        DbgRenderContext(RenderContext& instance, RenderingDebugger* debugger);
 
     public:
 
-        RenderContext& instance;
+        RenderContext&  instance;
+        std::uint64_t   registryHandle  = 0;
 
     private:
 
         bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
         bool OnSetVsync(const VsyncDescriptor& vsyncDesc) override;
 
+    private:
+
+        RenderingDebugger* debugger_ = nullptr;
+
 };
 
 
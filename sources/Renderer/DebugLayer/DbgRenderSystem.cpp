@@ -45,6 +45,16 @@ void DbgRenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
     instance_->SetConfiguration(config);
 }
 
+std::vector<VideoMemoryBudget> DbgRenderSystem::QueryVideoMemoryBudgets() const
+{
+    return instance_->QueryVideoMemoryBudgets();
+}
+
+std::vector<DeviceMemoryStats> DbgRenderSystem::QueryDeviceMemoryStats() const
+{
+    return instance_->QueryDeviceMemoryStats();
+}
+
 /* ----- Render Context ----- */
 
 RenderContext* DbgRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
@@ -62,7 +72,7 @@ RenderContext* DbgRenderSystem::CreateRenderContext(const RenderContextDescripto
         commandQueue_ = MakeUnique<DbgCommandQueue>(*(instance_->GetCommandQueue()), profiler_, debugger_);
     }
 
-    return TakeOwnership(renderContexts_, MakeUnique<DbgRenderContext>(*renderContextInstance));
+    return RegisterDbg(renderContexts_, MakeUnique<DbgRenderContext>(*renderContextInstance, debugger_));
 }
 
 void DbgRenderSystem::Release(RenderContext& renderContext)
@@ -77,14 +87,42 @@ CommandQueue* DbgRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* DbgRenderSystem::GetComputeCommandQueue()
+{
+    return GetCommandQueue(CommandQueueType::Compute);
+}
+
+std::uint32_t DbgRenderSystem::GetNumCommandQueues(const CommandQueueType queueType)
+{
+    return instance_->GetNumCommandQueues(queueType);
+}
+
+CommandQueue* DbgRenderSystem::GetCommandQueue(const CommandQueueType queueType, std::uint32_t index)
+{
+    /* The primary graphics queue is wrapped once the first render context is created */
+    if (queueType == CommandQueueType::Graphics && index == 0)
+        return GetCommandQueue();
+
+    auto queueInstance = instance_->GetCommandQueue(queueType, index);
+    if (queueInstance == nullptr)
+        return nullptr;
+
+    /* Instantiate wrapper for dedicated queues on first use */
+    auto it = typedCommandQueues_.find(queueInstance);
+    if (it == typedCommandQueues_.end())
+        it = typedCommandQueues_.emplace(queueInstance, MakeUnique<DbgCommandQueue>(*queueInstance, profiler_, debugger_)).first;
+
+    return it->second.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
-    return TakeOwnership(
+    return RegisterDbg(
         commandBuffers_,
         MakeUnique<DbgCommandBuffer>(
-            *instance_->CreateCommandBuffer(desc), debugger_, desc, GetRenderingCaps()
+            *instance_, *instance_->CreateCommandBuffer(desc), debugger_, profiler_, desc, GetRenderingCaps()
         )
     );
 }
@@ -107,14 +145,17 @@ Buffer* DbgRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void*
         ValidateBufferDesc(desc, &formatSize);
     }
 
-    /* Create buffer object */
-    auto bufferDbg = MakeUnique<DbgBuffer>(*instance_->CreateBuffer(desc, initialData), desc);
+    /* Create buffer object; materialize vertex format handle so draw-time validation can see the attributes */
+    auto storedDesc = desc;
+    if (desc.vertexFormatHandle != nullptr)
+        storedDesc.vertexAttribs = GetBufferVertexAttribs(desc);
+    auto bufferDbg = MakeUnique<DbgBuffer>(*instance_->CreateBuffer(desc, initialData), storedDesc);
 
     /* Store settings */
     bufferDbg->elements     = (formatSize > 0 ? desc.size / formatSize : 0);
     bufferDbg->initialized  = (initialData != nullptr);
 
-    return TakeOwnership(buffers_, std::move(bufferDbg));
+    return RegisterDbg(buffers_, std::move(bufferDbg));
 }
 
 BufferArray* DbgRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
@@ -138,7 +179,7 @@ BufferArray* DbgRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer
     auto bufferArrayInstance    = instance_->CreateBufferArray(numBuffers, bufferInstanceArray.data());
     auto bufferArrayDbg         = MakeUnique<DbgBufferArray>(*bufferArrayInstance, bindFlags, std::move(bufferDbgArray));
 
-    return TakeOwnership(bufferArrays_, std::move(bufferArrayDbg));
+    return RegisterDbg(bufferArrays_, std::move(bufferArrayDbg));
 }
 
 void DbgRenderSystem::Release(Buffer& buffer)
@@ -158,6 +199,7 @@ void DbgRenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, co
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
+        ValidateObjectHandle(buffers_, dstBuffer, "buffer");
 
         /* Make a rough approximation if the buffer is now being initialized */
         if (!dstBufferDbg.initialized)
@@ -185,6 +227,7 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
+        ValidateObjectHandle(buffers_, buffer, "buffer");
         ValidateResourceCPUAccess(bufferDbg.desc.cpuAccessFlags, access, "buffer");
         ValidateBufferMapping(bufferDbg, true);
     }
@@ -206,6 +249,7 @@ void DbgRenderSystem::UnmapBuffer(Buffer& buffer)
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
+        ValidateObjectHandle(buffers_, buffer, "buffer");
         ValidateBufferMapping(bufferDbg, false);
     }
 
@@ -223,7 +267,26 @@ Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, co
         LLGL_DBG_SOURCE;
         ValidateTextureDesc(textureDesc, imageDesc);
     }
-    return TakeOwnership(textures_, MakeUnique<DbgTexture>(*instance_->CreateTexture(textureDesc, imageDesc), textureDesc));
+    return RegisterDbg(textures_, MakeUnique<DbgTexture>(*instance_->CreateTexture(textureDesc, imageDesc), textureDesc));
+}
+
+Texture* DbgRenderSystem::CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc)
+{
+    auto& sharedTextureDbg = LLGL_CAST(DbgTexture&, sharedTexture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateObjectHandle(textures_, sharedTexture, "texture");
+        ValidateTextureView(sharedTextureDbg, textureViewDesc);
+    }
+
+    /* Instance may return null if the renderer does not support stand-alone texture-views */
+    auto textureInstance = instance_->CreateTextureView(sharedTextureDbg.instance, textureViewDesc);
+    if (textureInstance == nullptr)
+        return nullptr;
+
+    return RegisterDbg(textures_, MakeUnique<DbgTexture>(*textureInstance, &sharedTextureDbg, textureViewDesc));
 }
 
 void DbgRenderSystem::Release(Texture& texture)
@@ -238,6 +301,7 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textur
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
+        ValidateObjectHandle(textures_, texture, "texture");
         ValidateMipLevelLimit(textureRegion.subresource.baseMipLevel, textureRegion.subresource.numMipLevels, textureDbg.mipLevels);
         ValidateTextureRegion(textureDbg, textureRegion);
     }
@@ -248,6 +312,55 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textur
         profiler_->frameProfile.textureWrites++;
 }
 
+void DbgRenderSystem::WriteTextureMulti(Texture& texture, const TextureWriteDescriptor* writeDescs, std::uint32_t numWriteDescs)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateObjectHandle(textures_, texture, "texture");
+        for (std::uint32_t i = 0; i < numWriteDescs; ++i)
+        {
+            const auto& textureRegion = writeDescs[i].textureRegion;
+            ValidateMipLevelLimit(textureRegion.subresource.baseMipLevel, textureRegion.subresource.numMipLevels, textureDbg.mipLevels);
+            ValidateTextureRegion(textureDbg, textureRegion);
+        }
+    }
+
+    instance_->WriteTextureMulti(textureDbg.instance, writeDescs, numWriteDescs);
+
+    if (profiler_)
+        profiler_->frameProfile.textureWrites += numWriteDescs;
+}
+
+void DbgRenderSystem::SetTextureMinLod(Texture& texture, float minLod)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        ValidateObjectHandle(textures_, texture, "texture");
+        if (minLod > static_cast<float>(textureDbg.mipLevels))
+            LLGL_DBG_WARN(WarningType::ImproperArgument, "minimum LOD clamp exceeds number of MIP-map levels");
+    }
+
+    instance_->SetTextureMinLod(textureDbg.instance, minLod);
+}
+
+bool DbgRenderSystem::IsTextureUploadComplete(Texture& texture)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+    return instance_->IsTextureUploadComplete(textureDbg.instance);
+}
+
+void DbgRenderSystem::WaitForTextureUpload(Texture& texture)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+    instance_->WaitForTextureUpload(textureDbg.instance);
+}
+
 void DbgRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
 {
     auto& textureDbg = LLGL_CAST(const DbgTexture&, texture);
@@ -255,6 +368,7 @@ void DbgRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel
     if (debugger_)
     {
         LLGL_DBG_SOURCE;
+        ValidateObjectHandle(textures_, texture, "texture");
 
         /* Validate MIP-level */
         ValidateMipLevelLimit(mipLevel, 1, textureDbg.mipLevels);
@@ -281,7 +395,7 @@ void DbgRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel
 Sampler* DbgRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
     return instance_->CreateSampler(desc);
-    //return TakeOwnership(samplers_, MakeUnique<DbgSampler>());
+    //return RegisterDbg(samplers_, MakeUnique<DbgSampler>());
 }
 
 void DbgRenderSystem::Release(Sampler& sampler)
@@ -337,6 +451,45 @@ void DbgRenderSystem::Release(ResourceHeap& resourceViewHeap)
     return instance_->Release(resourceViewHeap);
 }
 
+void DbgRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews)
+{
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (!resourceViews && numResourceViews > 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer passed to array of <ResourceViewDescriptor> entries");
+    }
+
+    /* Create copy of resource views to pass native renderer object references */
+    std::vector<ResourceViewDescriptor> instanceResourceViews { resourceViews, resourceViews + numResourceViews };
+
+    for (auto& resourceView : instanceResourceViews)
+    {
+        if (auto resource = resourceView.resource)
+        {
+            switch (resource->GetResourceType())
+            {
+                case ResourceType::Buffer:
+                    resourceView.resource = &(LLGL_CAST(DbgBuffer*, resourceView.resource)->instance);
+                    break;
+                case ResourceType::Texture:
+                    resourceView.resource = &(LLGL_CAST(DbgTexture*, resourceView.resource)->instance);
+                    break;
+                case ResourceType::Sampler:
+                    //TODO: DbgSampler
+                    break;
+                default:
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid resource type passed to <ResourceViewDescriptor>");
+                    break;
+            }
+        }
+        else
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer passed to <ResourceViewDescriptor>");
+    }
+
+    instance_->WriteResourceHeap(resourceHeap, firstDescriptor, numResourceViews, instanceResourceViews.data());
+}
+
 /* ----- Render Passes ----- */
 
 RenderPass* DbgRenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
@@ -368,7 +521,7 @@ RenderTarget* DbgRenderSystem::CreateRenderTarget(const RenderTargetDescriptor&
         }
     }
 
-    return TakeOwnership(
+    return RegisterDbg(
         renderTargets_,
         MakeUnique<DbgRenderTarget>(*instance_->CreateRenderTarget(instanceDesc), debugger_, desc)
     );
@@ -383,7 +536,7 @@ void DbgRenderSystem::Release(RenderTarget& renderTarget)
 
 Shader* DbgRenderSystem::CreateShader(const ShaderDescriptor& desc)
 {
-    return TakeOwnership(shaders_, MakeUnique<DbgShader>(*instance_->CreateShader(desc), desc));
+    return RegisterDbg(shaders_, MakeUnique<DbgShader>(*instance_->CreateShader(desc), desc));
 }
 
 static Shader* GetInstanceShader(Shader* shader)
@@ -406,8 +559,10 @@ ShaderProgram* DbgRenderSystem::CreateShaderProgram(const ShaderProgramDescripto
         instanceDesc.geometryShader         = GetInstanceShader(desc.geometryShader);
         instanceDesc.fragmentShader         = GetInstanceShader(desc.fragmentShader);
         instanceDesc.computeShader          = GetInstanceShader(desc.computeShader);
+        instanceDesc.taskShader             = GetInstanceShader(desc.taskShader);
+        instanceDesc.meshShader             = GetInstanceShader(desc.meshShader);
     }
-    return TakeOwnership(shaderPrograms_, MakeUnique<DbgShaderProgram>(*instance_->CreateShaderProgram(instanceDesc), debugger_, desc, caps_));
+    return RegisterDbg(shaderPrograms_, MakeUnique<DbgShaderProgram>(*instance_->CreateShaderProgram(instanceDesc), debugger_, desc, caps_));
 }
 
 void DbgRenderSystem::Release(Shader& shader)
@@ -424,7 +579,7 @@ void DbgRenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* DbgRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return TakeOwnership(pipelineLayouts_, MakeUnique<DbgPipelineLayout>(*instance_->CreatePipelineLayout(desc), desc));
+    return RegisterDbg(pipelineLayouts_, MakeUnique<DbgPipelineLayout>(*instance_->CreatePipelineLayout(desc), desc));
 }
 
 void DbgRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -449,7 +604,7 @@ GraphicsPipeline* DbgRenderSystem::CreateGraphicsPipeline(const GraphicsPipeline
             if (desc.pipelineLayout != nullptr)
                 instanceDesc.pipelineLayout = &(LLGL_CAST(const DbgPipelineLayout*, desc.pipelineLayout)->instance);
         }
-        return TakeOwnership(graphicsPipelines_, MakeUnique<DbgGraphicsPipeline>(*instance_->CreateGraphicsPipeline(instanceDesc), desc));
+        return RegisterDbg(graphicsPipelines_, MakeUnique<DbgGraphicsPipeline>(*instance_->CreateGraphicsPipeline(instanceDesc), desc));
     }
     else
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
@@ -469,7 +624,7 @@ ComputePipeline* DbgRenderSystem::CreateComputePipeline(const ComputePipelineDes
             if (desc.pipelineLayout != nullptr)
                 instanceDesc.pipelineLayout = &(LLGL_CAST(const DbgPipelineLayout*, desc.pipelineLayout)->instance);
         }
-        return TakeOwnership(computePipelines_, MakeUnique<DbgComputePipeline>(*instance_->CreateComputePipeline(instanceDesc), desc));
+        return RegisterDbg(computePipelines_, MakeUnique<DbgComputePipeline>(*instance_->CreateComputePipeline(instanceDesc), desc));
     }
     else
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "shader program must not be null");
@@ -491,7 +646,7 @@ void DbgRenderSystem::Release(ComputePipeline& computePipeline)
 
 QueryHeap* DbgRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& desc)
 {
-    return TakeOwnership(queryHeaps_, MakeUnique<DbgQueryHeap>(*instance_->CreateQueryHeap(desc), desc));
+    return RegisterDbg(queryHeaps_, MakeUnique<DbgQueryHeap>(*instance_->CreateQueryHeap(desc), desc));
 }
 
 void DbgRenderSystem::Release(QueryHeap& queryHeap)
@@ -613,17 +768,19 @@ void DbgRenderSystem::ValidateBufferDesc(const BufferDescriptor& desc, std::uint
 
     std::uint32_t formatSize = 0;
 
-    if ((desc.bindFlags & BindFlags::VertexBuffer) != 0 && !desc.vertexAttribs.empty())
+    const auto& vertexAttribs = GetBufferVertexAttribs(desc);
+
+    if ((desc.bindFlags & BindFlags::VertexBuffer) != 0 && !vertexAttribs.empty())
     {
-        /* Validate all vertex attributes have the same binding slot */
-        if (desc.vertexAttribs.size() >= 2)
+        /* Validate all vertex attributes have the same binding slot; pre-validated vertex format handles can be skipped */
+        if (vertexAttribs.size() >= 2 && desc.vertexFormatHandle == nullptr)
         {
-            for (std::size_t i = 0; i + 1 < desc.vertexAttribs.size(); ++i)
-                ValidateVertexAttributesForBuffer(desc.vertexAttribs[i], desc.vertexAttribs[i + 1]);
+            for (std::size_t i = 0; i + 1 < vertexAttribs.size(); ++i)
+                ValidateVertexAttributesForBuffer(vertexAttribs[i], vertexAttribs[i + 1]);
         }
 
         /* Validate buffer size for specified vertex format */
-        formatSize = desc.vertexAttribs.front().stride;
+        formatSize = vertexAttribs.front().stride;
         if (formatSize > 0 && desc.size % formatSize != 0)
             LLGL_DBG_WARN(WarningType::ImproperArgument, "improper vertex buffer size with vertex format of " + std::to_string(formatSize) + " bytes");
     }
@@ -793,7 +950,26 @@ void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& desc, const S
     ValidateArrayTextureLayers(desc.type, desc.arrayLayers);
     ValidateBindFlags(desc.bindFlags);
     ValidateCPUAccessFlags(desc.cpuAccessFlags, CPUAccessFlags::ReadWrite, "texture");
-    ValidateMiscFlags(desc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData), "texture");
+    ValidateMiscFlags(
+        desc.miscFlags,
+        ( MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips |
+          MiscFlags::NoInitialData | MiscFlags::Transient | MiscFlags::SparseResidency |
+          MiscFlags::DeferredUpload ),
+        "texture"
+    );
+
+    /* Check if initial sparse residency is consistent */
+    if (desc.sparseResidentMipLevels > 0)
+    {
+        if ((desc.miscFlags & MiscFlags::SparseResidency) == 0)
+            LLGL_DBG_WARN(WarningType::ImproperArgument, "field 'sparseResidentMipLevels' is ignored for textures without the 'LLGL::MiscFlags::SparseResidency' flag");
+        else if (desc.sparseResidentMipLevels > NumMipLevels(desc))
+            LLGL_DBG_WARN(WarningType::ImproperArgument, "field 'sparseResidentMipLevels' exceeds number of MIP-map levels");
+    }
+
+    /* Check if deferred upload has any data to defer */
+    if ((desc.miscFlags & MiscFlags::DeferredUpload) != 0 && (desc.miscFlags & MiscFlags::NoInitialData) != 0)
+        LLGL_DBG_WARN(WarningType::ImproperArgument, "flag 'LLGL::MiscFlags::DeferredUpload' is ignored for textures with the 'LLGL::MiscFlags::NoInitialData' flag");
 
     /* Check if MIP-map generation is requested  */
     if ((desc.miscFlags & MiscFlags::GenerateMips) != 0)
@@ -1372,10 +1548,46 @@ void DbgRenderSystem::AssertMultiSampleTextures()
         LLGL_DBG_ERROR_NOT_SUPPORTED("multi-sample textures");
 }
 
+// Takes ownership of the specified object and stores its generation handle for O(1) lifetime validation (see HWObjectContainer::valid)
+template <typename T, typename TSub>
+TSub* DbgRenderSystem::RegisterDbg(HWObjectContainer<T>& cont, std::unique_ptr<TSub>&& entry)
+{
+    auto ref = TakeOwnership(cont, std::move(entry));
+    ref->registryHandle = cont.handle(ref);
+    return ref;
+}
+
+// Validates in O(1) that the specified object is still registered, i.e. it has neither been released nor does it belong to another render system
 template <typename T, typename TBase>
-void DbgRenderSystem::ReleaseDbg(std::set<std::unique_ptr<T>>& cont, TBase& entry)
+bool DbgRenderSystem::ValidateObjectHandle(const HWObjectContainer<T>& cont, const TBase& entry, const char* objectTypeName)
+{
+    auto& entryDbg = LLGL_CAST(const T&, entry);
+    if (!cont.valid(entryDbg.registryHandle, &entry))
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidState,
+            "invalid " + std::string(objectTypeName) + " object: already released or not created by this render system"
+        );
+        return false;
+    }
+    return true;
+}
+
+template <typename T, typename TBase>
+void DbgRenderSystem::ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry)
 {
     auto& entryDbg = LLGL_CAST(T&, entry);
+
+    if (debugger_)
+    {
+        LLGL_DBG_SOURCE;
+        if (!cont.valid(entryDbg.registryHandle, &entry))
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "invalid object released: already released or not created by this render system");
+            return;
+        }
+    }
+
     instance_->Release(entryDbg.instance);
     RemoveFromUniqueSet(cont, &entry);
 }
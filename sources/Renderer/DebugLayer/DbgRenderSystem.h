@@ -26,6 +26,7 @@
 #include "DbgQueryHeap.h"
 
 #include "../ContainerTypes.h"
+#include <map>
 
 
 namespace LLGL
@@ -43,6 +44,9 @@ class DbgRenderSystem final : public RenderSystem
 
         void SetConfiguration(const RenderSystemConfiguration& config) override;
 
+        std::vector<VideoMemoryBudget> QueryVideoMemoryBudgets() const override;
+        std::vector<DeviceMemoryStats> QueryDeviceMemoryStats() const override;
+
         /* ----- Render Context ------ */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -52,6 +56,10 @@ class DbgRenderSystem final : public RenderSystem
         /* ----- Command queues ----- */
 
         CommandQueue* GetCommandQueue() override;
+        CommandQueue* GetComputeCommandQueue() override;
+
+        std::uint32_t GetNumCommandQueues(const CommandQueueType queueType) override;
+        CommandQueue* GetCommandQueue(const CommandQueueType queueType, std::uint32_t index = 0) override;
 
         /* ----- Command buffers ----- */
 
@@ -75,10 +83,15 @@ class DbgRenderSystem final : public RenderSystem
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
+        Texture* CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc) override;
 
         void Release(Texture& texture) override;
 
         void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
+        void WriteTextureMulti(Texture& texture, const TextureWriteDescriptor* writeDescs, std::uint32_t numWriteDescs) override;
+        void SetTextureMinLod(Texture& texture, float minLod) override;
+        bool IsTextureUploadComplete(Texture& texture) override;
+        void WaitForTextureUpload(Texture& texture) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
         /* ----- Sampler States ---- */
@@ -93,6 +106,8 @@ class DbgRenderSystem final : public RenderSystem
 
         void Release(ResourceHeap& resourceViewHeap) override;
 
+        void WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews) override;
+
         /* ----- Render Passes ----- */
 
         RenderPass* CreateRenderPass(const RenderPassDescriptor& desc) override;
@@ -190,8 +205,14 @@ class DbgRenderSystem final : public RenderSystem
         void AssertCubeArrayTextures();
         void AssertMultiSampleTextures();
 
+        template <typename T, typename TSub>
+        TSub* RegisterDbg(HWObjectContainer<T>& cont, std::unique_ptr<TSub>&& entry);
+
         template <typename T, typename TBase>
-        void ReleaseDbg(std::set<std::unique_ptr<T>>& cont, TBase& entry);
+        bool ValidateObjectHandle(const HWObjectContainer<T>& cont, const TBase& entry, const char* objectTypeName);
+
+        template <typename T, typename TBase>
+        void ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry);
 
     private:
 
@@ -210,6 +231,10 @@ class DbgRenderSystem final : public RenderSystem
 
         HWObjectContainer<DbgRenderContext>     renderContexts_;
         HWObjectInstance<DbgCommandQueue>       commandQueue_;
+
+        // Wrappers for the dedicated compute and transfer queues; instantiated on first use
+        std::map<CommandQueue*, std::unique_ptr<DbgCommandQueue>> typedCommandQueues_;
+
         HWObjectContainer<DbgCommandBuffer>     commandBuffers_;
         HWObjectContainer<DbgBuffer>            buffers_;
         HWObjectContainer<DbgBufferArray>       bufferArrays_;
@@ -43,6 +43,7 @@ class DbgRenderTarget final : public RenderTarget
         RenderTarget&                   instance;
         const RenderTargetDescriptor    desc;
         std::string                     label;
+        std::uint64_t                   registryHandle  = 0;
 
 };
 
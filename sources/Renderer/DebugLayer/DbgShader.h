@@ -43,6 +43,7 @@ class DbgShader final : public Shader
         Shader&                 instance;
         const ShaderDescriptor  desc;
         std::string             label;
+        std::uint64_t           registryHandle  = 0;
 
 };
 
@@ -34,6 +34,8 @@ DbgShaderProgram::DbgShaderProgram(
         ValidateShaderAttachment(desc.geometryShader, ShaderType::Geometry);
         ValidateShaderAttachment(desc.fragmentShader, ShaderType::Fragment);
         ValidateShaderAttachment(desc.computeShader, ShaderType::Compute);
+        ValidateShaderAttachment(desc.taskShader, ShaderType::Task);
+        ValidateShaderAttachment(desc.meshShader, ShaderType::Mesh);
         ValidateShaderComposition();
         QueryInstanceAndVertexIDs(caps);
     }
@@ -102,6 +104,8 @@ const char* DbgShaderProgram::GetInstanceID() const
 #define LLGL_DS_MASK                LLGL_SHADERTYPE_MASK(ShaderType::TessEvaluation)
 #define LLGL_GS_MASK                LLGL_SHADERTYPE_MASK(ShaderType::Geometry)
 #define LLGL_CS_MASK                LLGL_SHADERTYPE_MASK(ShaderType::Compute)
+#define LLGL_AS_MASK                LLGL_SHADERTYPE_MASK(ShaderType::Task)
+#define LLGL_MS_MASK                LLGL_SHADERTYPE_MASK(ShaderType::Mesh)
 
 void DbgShaderProgram::ValidateShaderAttachment(Shader* shader, const ShaderType type)
 {
@@ -145,6 +149,10 @@ void DbgShaderProgram::ValidateShaderComposition()
         case ( LLGL_VS_MASK | LLGL_HS_MASK | LLGL_DS_MASK |                LLGL_PS_MASK ):
         case ( LLGL_VS_MASK | LLGL_HS_MASK | LLGL_DS_MASK | LLGL_GS_MASK | LLGL_PS_MASK ):
         case ( LLGL_CS_MASK ):
+        case ( LLGL_MS_MASK                               ):
+        case ( LLGL_MS_MASK |                LLGL_PS_MASK ):
+        case ( LLGL_MS_MASK | LLGL_AS_MASK                ):
+        case ( LLGL_MS_MASK | LLGL_AS_MASK | LLGL_PS_MASK ):
             break;
         default:
             LLGL_DBG_ERROR(ErrorType::InvalidState, "invalid shader composition");
@@ -182,6 +190,8 @@ void DbgShaderProgram::QueryInstanceAndVertexIDs(const RenderingCapabilities& ca
 #undef LLGL_DS_MASK
 #undef LLGL_GS_MASK
 #undef LLGL_CS_MASK
+#undef LLGL_AS_MASK
+#undef LLGL_MS_MASK
 
 
 } // /namespace LLGL
@@ -73,7 +73,8 @@ class DbgShaderProgram final : public ShaderProgram
 
     public:
 
-        ShaderProgram& instance;
+        ShaderProgram&  instance;
+        std::uint64_t   registryHandle  = 0;
 
     private:
 
@@ -40,6 +40,7 @@ class DbgTexture final : public Texture
         TextureViewDescriptor   viewDesc;
         std::uint32_t           mipLevels           = 1;        // Actual number of MIP-map levels.
         std::string             label;
+        std::uint64_t           registryHandle      = 0;
         const bool              isTextureView       = false;
 
     private:
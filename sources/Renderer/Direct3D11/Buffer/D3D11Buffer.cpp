@@ -6,6 +6,7 @@
  */
 
 #include "D3D11Buffer.h"
+#include "../Direct3D11.h"
 #include "../D3D11Types.h"
 #include "../D3D11ResourceFlags.h"
 #include "../D3D11ObjectUtils.h"
@@ -63,11 +64,6 @@ BufferDescriptor D3D11Buffer::GetDesc() const
     return bufferDesc;
 }
 
-static D3D11_MAP GetD3DMapWrite(bool mapPartial)
-{
-    return (mapPartial ? D3D11_MAP_WRITE : D3D11_MAP_WRITE_DISCARD);
-}
-
 void D3D11Buffer::UpdateSubresource(ID3D11DeviceContext* context, const void* data, UINT dataSize, UINT offset)
 {
     /* Validate parameters */
@@ -75,9 +71,9 @@ void D3D11Buffer::UpdateSubresource(ID3D11DeviceContext* context, const void* da
 
     if (GetUsage() == D3D11_USAGE_DYNAMIC)
     {
-        /* Update partial subresource by mapping buffer from GPU into CPU memory space */
+        /* Update subresource by mapping buffer from GPU into CPU memory space */
         D3D11_MAPPED_SUBRESOURCE subresource;
-        context->Map(GetNative(), 0, GetD3DMapWrite(dataSize < GetSize()), 0, &subresource);
+        context->Map(GetNative(), 0, GetMapWriteRing(offset, dataSize), 0, &subresource);
         {
             ::memcpy(reinterpret_cast<char*>(subresource.pData) + offset, data, dataSize);
         }
@@ -133,7 +129,9 @@ void* D3D11Buffer::Map(ID3D11DeviceContext* context, const CPUAccess access)
     }
     else
     {
-        /* Map buffer */
+        /* Map buffer; a full write invalidates the ring of sub-range updates */
+        if (HasWriteAccess(access))
+            writeEnd_ = GetSize();
         hr = context->Map(GetNative(), 0, D3D11Types::Map(access), 0, &mapppedSubresource);
     }
 
@@ -172,6 +170,35 @@ static UINT GetD3DBufferSize(const BufferDescriptor& desc)
         return size;
 }
 
+/*
+Returns true if the specified dynamic buffer can be mapped with D3D11_MAP_WRITE_NO_OVERWRITE.
+This has always been supported for vertex and index buffers,
+but for constant buffers and SRV buffers it requires Direct3D 11.1.
+*/
+static bool SupportsMapNoOverwrite(ID3D11Device* device, const D3D11_BUFFER_DESC& desc)
+{
+    if ((desc.BindFlags & (D3D11_BIND_CONSTANT_BUFFER | D3D11_BIND_SHADER_RESOURCE)) != 0)
+    {
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+
+        D3D11_FEATURE_DATA_D3D11_OPTIONS featureData;
+        if (FAILED(device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &featureData, sizeof(featureData))))
+            return false;
+
+        if ((desc.BindFlags & D3D11_BIND_CONSTANT_BUFFER) != 0 && !featureData.MapNoOverwriteOnDynamicConstantBuffer)
+            return false;
+        if ((desc.BindFlags & D3D11_BIND_SHADER_RESOURCE) != 0 && !featureData.MapNoOverwriteOnDynamicBufferSRV)
+            return false;
+
+        #else
+
+        return false;
+
+        #endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
+    }
+    return true;
+}
+
 void D3D11Buffer::CreateNativeBuffer(ID3D11Device* device, const BufferDescriptor& desc, const void* initialData)
 {
     /* Initialize native buffer descriptor */
@@ -210,9 +237,20 @@ void D3D11Buffer::CreateNativeBuffer(ID3D11Device* device, const BufferDescripto
 
     /* Store buffer creation attributes */
     size_   = descD3D.ByteWidth;
-    stride_ = (desc.vertexAttribs.empty() ? 0 : desc.vertexAttribs.front().stride);
+    const auto& vertexAttribs = GetBufferVertexAttribs(desc);
+    stride_ = (vertexAttribs.empty() ? 0 : vertexAttribs.front().stride);
     format_ = D3D11Types::Map(desc.indexFormat);
     usage_  = descD3D.Usage;
+
+    /* Determine whether sub-range updates can use ring-buffer semantics (see GetMapWriteRing) */
+    if (usage_ == D3D11_USAGE_DYNAMIC)
+    {
+        supportsNoOverwrite_ = SupportsMapNoOverwrite(device, descD3D);
+
+        /* Initial data counts as written, so the first sub-range update discards it */
+        if (initialData)
+            writeEnd_ = size_;
+    }
 }
 
 void D3D11Buffer::CreateCPUAccessBuffer(ID3D11Device* device, const BufferDescriptor& desc)
@@ -231,6 +269,27 @@ void D3D11Buffer::CreateCPUAccessBuffer(ID3D11Device* device, const BufferDescri
     DXThrowIfCreateFailed(hr, "ID3D11Buffer", "for CPU-access buffer");
 }
 
+/*
+Returns the map type for a sub-range update of a dynamic buffer with ring-buffer semantics:
+ranges beyond the region that was written since the last discard are mapped with NO_OVERWRITE,
+which avoids buffer renaming in the driver; only rewinding to a lower offset (wrap) forces a DISCARD.
+*/
+D3D11_MAP D3D11Buffer::GetMapWriteRing(UINT offset, UINT dataSize)
+{
+    if (supportsNoOverwrite_ && dataSize < GetSize() && offset >= writeEnd_)
+    {
+        /* Sub-range has not been written since the last discard */
+        writeEnd_ = offset + dataSize;
+        return D3D11_MAP_WRITE_NO_OVERWRITE;
+    }
+    else
+    {
+        /* Discard the entire buffer and restart the ring */
+        writeEnd_ = offset + dataSize;
+        return D3D11_MAP_WRITE_DISCARD;
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -76,15 +76,20 @@ class D3D11Buffer : public Buffer
 
         void CreateCPUAccessBuffer(ID3D11Device* device, const BufferDescriptor& desc);
 
+        D3D11_MAP GetMapWriteRing(UINT offset, UINT dataSize);
+
     private:
 
         ComPtr<ID3D11Buffer>    buffer_;
         ComPtr<ID3D11Buffer>    cpuAccessBuffer_;
 
-        UINT                    size_               = 0;
-        UINT                    stride_             = 0;
-        DXGI_FORMAT             format_             = DXGI_FORMAT_UNKNOWN;
-        D3D11_USAGE             usage_              = D3D11_USAGE_DEFAULT;
+        UINT                    size_                   = 0;
+        UINT                    stride_                 = 0;
+        DXGI_FORMAT             format_                 = DXGI_FORMAT_UNKNOWN;
+        D3D11_USAGE             usage_                  = D3D11_USAGE_DEFAULT;
+
+        UINT                    writeEnd_               = 0;        // End of the region written since the last discard (for ring-buffer updates)
+        bool                    supportsNoOverwrite_    = false;    // True if this buffer can be mapped with D3D11_MAP_WRITE_NO_OVERWRITE
 
 };
 
@@ -74,7 +74,9 @@ D3D11CommandBuffer::D3D11CommandBuffer(
 
 void D3D11CommandBuffer::Begin()
 {
-    // dummy
+    /* Context state may have changed since the last encoding, so all resource heap segments and individual bindings must be re-submitted */
+    bindingCache_.Invalidate();
+    slotCache_.Invalidate();
 }
 
 void D3D11CommandBuffer::End()
@@ -353,18 +355,27 @@ void D3D11CommandBuffer::EndStreamOutput()
 
 void D3D11CommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*firstSet*/)
 {
+    /* Resource heaps overwrite binding slots directly, so the per-slot cache no longer reflects the context state */
+    slotCache_.Invalidate();
+
     auto& resourceHeapD3D = LLGL_CAST(D3D11ResourceHeap&, resourceHeap);
-    resourceHeapD3D.BindForGraphicsPipeline(context_.Get());
+    resourceHeapD3D.BindForGraphicsPipeline(context_.Get(), bindingCache_);
 }
 
 void D3D11CommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t /*firstSet*/)
 {
+    /* Resource heaps overwrite binding slots directly, so the per-slot cache no longer reflects the context state */
+    slotCache_.Invalidate();
+
     auto& resourceHeapD3D = LLGL_CAST(D3D11ResourceHeap&, resourceHeap);
-    resourceHeapD3D.BindForComputePipeline(context_.Get());
+    resourceHeapD3D.BindForComputePipeline(context_.Get(), bindingCache_);
 }
 
 void D3D11CommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags)
 {
+    /* Individual bindings bypass the resource heaps, so the binding cache no longer reflects the context state */
+    bindingCache_.Invalidate();
+
     switch (resource.GetResourceType())
     {
         case ResourceType::Undefined:
@@ -390,6 +401,10 @@ void D3D11CommandBuffer::ResetResourceSlots(
 {
     if (numSlots > 0)
     {
+        /* Resetting slots bypasses the resource heaps, so neither binding cache reflects the context state anymore */
+        bindingCache_.Invalidate();
+        slotCache_.Invalidate();
+
         /* Reset resource binding slots */
         switch (resourceType)
         {
@@ -416,18 +431,17 @@ void D3D11CommandBuffer::BeginRenderPass(
     std::uint32_t       numClearValues,
     const ClearValue*   clearValues)
 {
-    /* Bind render target/context */
+    auto renderPassD3D = (renderPass != nullptr ? LLGL_CAST(const D3D11RenderPass*, renderPass) : nullptr);
+
+    /* Bind render target/context; read-only DSVs are only supported for render targets */
     if (renderTarget.IsRenderContext())
         BindRenderContext(LLGL_CAST(D3D11RenderContext&, renderTarget));
     else
-        BindRenderTarget(LLGL_CAST(D3D11RenderTarget&, renderTarget));
+        BindRenderTarget(LLGL_CAST(D3D11RenderTarget&, renderTarget), (renderPassD3D != nullptr && renderPassD3D->IsReadOnlyDepthStencil()));
 
     /* Clear attachments */
-    if (renderPass)
-    {
-        auto renderPassD3D = LLGL_CAST(const D3D11RenderPass*, renderPass);
+    if (renderPassD3D)
         ClearAttachmentsWithRenderPass(*renderPassD3D, numClearValues, clearValues);
-    }
 }
 
 void D3D11CommandBuffer::EndRenderPass()
@@ -651,14 +665,16 @@ void D3D11CommandBuffer::SetBuffer(Buffer& buffer, std::uint32_t slot, long bind
         if ((bindFlags & BindFlags::ConstantBuffer) != 0)
         {
             ID3D11Buffer* cbv[] = { bufferD3D.GetNative() };
-            SetConstantBuffersOnStages(slot, 1, cbv, stageFlags);
+            if (slotCache_.RequiresBindingCBV(slot, cbv[0], stageFlags))
+                SetConstantBuffersOnStages(slot, 1, cbv, stageFlags);
         }
 
         /* Set SRVs to specified shader stages */
         if ((bindFlags & BindFlags::Sampled) != 0)
         {
             ID3D11ShaderResourceView* srv[] = { bufferD3D.GetSRV() };
-            SetShaderResourcesOnStages(slot, 1, srv, stageFlags);
+            if (slotCache_.RequiresBindingSRV(slot, srv[0], stageFlags))
+                SetShaderResourcesOnStages(slot, 1, srv, stageFlags);
         }
 
         /* Set UAVs to specified shader stages */
@@ -677,7 +693,8 @@ void D3D11CommandBuffer::SetBuffer(Buffer& buffer, std::uint32_t slot, long bind
         if ((bindFlags & BindFlags::ConstantBuffer) != 0)
         {
             ID3D11Buffer* cbv[] = { bufferD3D.GetNative() };
-            SetConstantBuffersOnStages(slot, 1, cbv, stageFlags);
+            if (slotCache_.RequiresBindingCBV(slot, cbv[0], stageFlags))
+                SetConstantBuffersOnStages(slot, 1, cbv, stageFlags);
         }
     }
 }
@@ -690,7 +707,8 @@ void D3D11CommandBuffer::SetTexture(Texture& texture, std::uint32_t slot, long b
     if ((bindFlags & BindFlags::Sampled) != 0)
     {
         ID3D11ShaderResourceView* srv[] = { textureD3D.GetSRV() };
-        SetShaderResourcesOnStages(slot, 1, srv, stageFlags);
+        if (slotCache_.RequiresBindingSRV(slot, srv[0], stageFlags))
+            SetShaderResourcesOnStages(slot, 1, srv, stageFlags);
     }
 
     /* Set texture UAV to all shader stages */
@@ -708,7 +726,8 @@ void D3D11CommandBuffer::SetSampler(Sampler& sampler, std::uint32_t slot, long s
     auto& samplerD3D = LLGL_CAST(D3D11Sampler&, sampler);
 
     ID3D11SamplerState* samplerStates[] = { samplerD3D.GetNative() };
-    SetSamplersOnStages(slot, 1, samplerStates, stageFlags);
+    if (slotCache_.RequiresBindingSampler(slot, samplerStates[0], stageFlags))
+        SetSamplersOnStages(slot, 1, samplerStates, stageFlags);
 }
 
 void D3D11CommandBuffer::SetConstantBuffersOnStages(UINT startSlot, UINT count, ID3D11Buffer* const* buffers, long stageFlags)
@@ -904,6 +923,9 @@ void D3D11CommandBuffer::ResolveBoundRenderTarget()
 
 void D3D11CommandBuffer::BindFramebufferView()
 {
+    /* Binding render targets unbinds all UAVs from the output-merger, so cached UAV segments are no longer valid */
+    bindingCache_.Invalidate();
+
     context_->OMSetRenderTargets(
         static_cast<UINT>(framebufferView_.rtvList.size()),
         framebufferView_.rtvList.data(),
@@ -911,14 +933,14 @@ void D3D11CommandBuffer::BindFramebufferView()
     );
 }
 
-void D3D11CommandBuffer::BindRenderTarget(D3D11RenderTarget& renderTargetD3D)
+void D3D11CommandBuffer::BindRenderTarget(D3D11RenderTarget& renderTargetD3D, bool readOnlyDepthStencil)
 {
     /* Resolve previously bound render target (in case mutli-sampling is used) */
     ResolveBoundRenderTarget();
 
     /* Set RTV list and DSV in framebuffer view */
     framebufferView_.rtvList    = renderTargetD3D.GetRenderTargetViews();
-    framebufferView_.dsv        = renderTargetD3D.GetDepthStencilView();
+    framebufferView_.dsv        = renderTargetD3D.GetDepthStencilView(readOnlyDepthStencil);
 
     BindFramebufferView();
 
@@ -1010,6 +1032,66 @@ void D3D11CommandBuffer::ClearColorBuffers(
 }
 
 
+/*
+ * D3D11SlotCache structure
+ */
+
+/*
+Returns true if 'object' must be (re-)submitted to the specified slot; the binding is redundant only if
+the same object is already bound to all requested stages. Binding a different object to a subset of the
+stages leaves the old object on the remaining stages, so only the requested stages are recorded then.
+*/
+bool D3D11CommandBuffer::D3D11SlotCache::RequiresBindingToSlot(
+    Slot*           slots,
+    std::uint32_t   numSlots,
+    std::uint32_t   slot,
+    const void*     object,
+    long            stageFlags)
+{
+    if (slot < numSlots)
+    {
+        auto& entry = slots[slot];
+        if (entry.object == object)
+        {
+            if ((entry.stages & stageFlags) == stageFlags)
+                return false;
+            entry.stages |= stageFlags;
+        }
+        else
+        {
+            entry.object = object;
+            entry.stages = stageFlags;
+        }
+    }
+    return true;
+}
+
+void D3D11CommandBuffer::D3D11SlotCache::Invalidate()
+{
+    for (auto& entry : constantBuffers)
+        entry = {};
+    for (auto& entry : shaderResources)
+        entry = {};
+    for (auto& entry : samplers)
+        entry = {};
+}
+
+bool D3D11CommandBuffer::D3D11SlotCache::RequiresBindingCBV(std::uint32_t slot, const void* object, long stageFlags)
+{
+    return RequiresBindingToSlot(constantBuffers, D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, slot, object, stageFlags);
+}
+
+bool D3D11CommandBuffer::D3D11SlotCache::RequiresBindingSRV(std::uint32_t slot, const void* object, long stageFlags)
+{
+    return RequiresBindingToSlot(shaderResources, D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT, slot, object, stageFlags);
+}
+
+bool D3D11CommandBuffer::D3D11SlotCache::RequiresBindingSampler(std::uint32_t slot, const void* object, long stageFlags)
+{
+    return RequiresBindingToSlot(samplers, D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT, slot, object, stageFlags);
+}
+
+
 } // /namespace LLGL
 
 
@@ -12,6 +12,7 @@
 #include <LLGL/CommandBuffer.h>
 #include "../DXCommon/ComPtr.h"
 #include "../DXCommon/DXCore.h"
+#include "RenderState/D3D11ResourceHeap.h"
 #include "Direct3D11.h"
 #include <dxgi.h>
 #include <vector>
@@ -194,6 +195,22 @@ class D3D11CommandBuffer final : public CommandBuffer
 
         void SetGraphicsAPIDependentState(const void* stateDesc, std::size_t stateDescSize) override;
 
+    public:
+
+        /* ----- Internal ----- */
+
+        // Returns true if this command buffer is encoded with a deferred device context.
+        inline bool HasDeferredContext() const
+        {
+            return hasDeferredContext_;
+        }
+
+        // Returns the encoded command list of the deferred context, or null if this command buffer has not been encoded yet.
+        inline ID3D11CommandList* GetDeferredCommandList() const
+        {
+            return commandList_.Get();
+        }
+
     private:
 
         void SetBuffer(Buffer& buffer, std::uint32_t slot, long bindFlags, long stageFlags);
@@ -214,7 +231,7 @@ class D3D11CommandBuffer final : public CommandBuffer
 
         void ResolveBoundRenderTarget();
         void BindFramebufferView();
-        void BindRenderTarget(D3D11RenderTarget& renderTargetD3D);
+        void BindRenderTarget(D3D11RenderTarget& renderTargetD3D, bool readOnlyDepthStencil);
         void BindRenderContext(D3D11RenderContext& renderContextD3D);
 
         void ClearAttachmentsWithRenderPass(
@@ -240,6 +257,33 @@ class D3D11CommandBuffer final : public CommandBuffer
             ID3D11DepthStencilView*                 dsv = nullptr;
         };
 
+        /*
+        Per-slot cache of individual resource bindings (see SetResource); used to elide redundant driver calls.
+        UAV slots are not cached, because re-binding a UAV also resets its hidden append/consume counter.
+        */
+        struct D3D11SlotCache
+        {
+            struct Slot
+            {
+                const void* object = nullptr;   // native object last bound to this slot
+                long        stages = 0;         // stage flags the object is currently bound to
+            };
+
+            // Invalidates all cached slots, so the next individual binding is always re-submitted.
+            void Invalidate();
+
+            // Returns true if the object must be (re-)submitted to the specified slot, and updates the cache entry accordingly.
+            bool RequiresBindingCBV(std::uint32_t slot, const void* object, long stageFlags);
+            bool RequiresBindingSRV(std::uint32_t slot, const void* object, long stageFlags);
+            bool RequiresBindingSampler(std::uint32_t slot, const void* object, long stageFlags);
+
+            static bool RequiresBindingToSlot(Slot* slots, std::uint32_t numSlots, std::uint32_t slot, const void* object, long stageFlags);
+
+            Slot constantBuffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+            Slot shaderResources[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
+            Slot samplers[D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT];
+        };
+
         ComPtr<ID3D11DeviceContext>         context_;
         bool                                hasDeferredContext_ = false;
         ComPtr<ID3D11CommandList>           commandList_;
@@ -253,6 +297,9 @@ class D3D11CommandBuffer final : public CommandBuffer
         D3D11FramebufferView                framebufferView_;
         D3D11RenderTarget*                  boundRenderTarget_  = nullptr;
 
+        D3D11ResourceHeap::BindingCache     bindingCache_;
+        D3D11SlotCache                      slotCache_;
+
         ClearValue                          clearValue_;
 
 };
@@ -6,6 +6,7 @@
  */
 
 #include "D3D11CommandQueue.h"
+#include "D3D11CommandBuffer.h"
 #include "RenderState/D3D11Fence.h"
 #include "RenderState/D3D11QueryHeap.h"
 #include "../CheckedCast.h"
@@ -23,9 +24,18 @@ D3D11CommandQueue::D3D11CommandQueue(ID3D11Device* device, ComPtr<ID3D11DeviceCo
 
 /* ----- Command Buffers ----- */
 
-void D3D11CommandQueue::Submit(CommandBuffer& /*commandBuffer*/)
+void D3D11CommandQueue::Submit(CommandBuffer& commandBuffer)
 {
-    // dummy
+    auto& commandBufferD3D = LLGL_CAST(D3D11CommandBuffer&, commandBuffer);
+    if (auto commandList = commandBufferD3D.GetDeferredCommandList())
+    {
+        /*
+        Execute encoded command list with immediate context;
+        command buffers with an immediate context have already been executed at this point.
+        The command list is not consumed, so command buffers with the MultiSubmit flag can be submitted again.
+        */
+        context_->ExecuteCommandList(commandList, TRUE);
+    }
 }
 
 /* ----- Queries ----- */
@@ -42,6 +52,25 @@ bool D3D11CommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQue
     return false;
 }
 
+bool D3D11CommandQueue::QueryResultAvailable(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries)
+{
+    auto& queryHeapD3D = LLGL_CAST(D3D11QueryHeap&, queryHeap);
+
+    /* Probe each native query without copying any data and without forcing a command buffer flush */
+    const auto groupSize = queryHeapD3D.GetGroupSize();
+
+    for (std::uint32_t i = firstQuery * groupSize, n = (firstQuery + numQueries) * groupSize; i < n; ++i)
+    {
+        ID3D11Asynchronous* nativeQuery = queryHeapD3D.GetNative(i);
+        if (nativeQuery == nullptr)
+            nativeQuery = queryHeapD3D.GetPredicate(i);
+        if (context_->GetData(nativeQuery, nullptr, 0, D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK)
+            return false;
+    }
+
+    return true;
+}
+
 /* ----- Fences ----- */
 
 void D3D11CommandQueue::Submit(Fence& fence)
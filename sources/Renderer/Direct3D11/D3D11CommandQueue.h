@@ -43,6 +43,12 @@ class D3D11CommandQueue final : public CommandQueue
             std::size_t     dataSize
         ) override;
 
+        bool QueryResultAvailable(
+            QueryHeap&      queryHeap,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries
+        ) override;
+
         /* ----- Fences ----- */
 
         void Submit(Fence& fence) override;
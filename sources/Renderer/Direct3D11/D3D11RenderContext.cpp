@@ -12,6 +12,8 @@
 #include "../../Core/Helper.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/Log.h>
+#include <algorithm>
+#include <dxgi1_5.h>
 
 
 namespace LLGL
@@ -36,6 +38,14 @@ D3D11RenderContext::D3D11RenderContext(
     CreateSwapChain(factory);
     CreateBackBuffer(GetVideoMode());
 
+    /* Limit frame queuing if a maximum frame latency was specified */
+    if (desc.frameLatency > 0)
+    {
+        ComPtr<IDXGIDevice1> dxgiDevice;
+        if (SUCCEEDED(device_.As(&dxgiDevice)))
+            dxgiDevice->SetMaximumFrameLatency(std::min(desc.frameLatency, 3u));
+    }
+
     /* Initialize v-sync */
     OnSetVsync(desc.vsync);
 }
@@ -62,7 +72,9 @@ void D3D11RenderContext::SetName(const char* name)
 
 void D3D11RenderContext::Present()
 {
-    swapChain_->Present(swapChainInterval_, 0);
+    /* Tearing presents are only allowed with v-sync disabled and in windowed mode */
+    const bool tearing = (hasTearingSupport_ && swapChainInterval_ == 0 && !GetVideoMode().fullscreen);
+    swapChain_->Present(swapChainInterval_, (tearing ? DXGI_PRESENT_ALLOW_TEARING : 0));
 }
 
 Format D3D11RenderContext::GetColorFormat() const
@@ -116,6 +128,18 @@ bool D3D11RenderContext::OnSetVsync(const VsyncDescriptor& vsyncDesc)
  * ======= Private: =======
  */
 
+static bool CheckTearingSupport(IDXGIFactory* factory)
+{
+    ComPtr<IDXGIFactory5> factory5;
+    if (SUCCEEDED(factory->QueryInterface(IID_PPV_ARGS(factory5.ReleaseAndGetAddressOf()))))
+    {
+        BOOL allowTearing = FALSE;
+        if (SUCCEEDED(factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &allowTearing, sizeof(allowTearing))))
+            return (allowTearing != FALSE);
+    }
+    return false;
+}
+
 static UINT FintSuitableMultisamples(ID3D11Device* device, DXGI_FORMAT format, UINT sampleCount)
 {
     for (; sampleCount > 1; --sampleCount)
@@ -153,6 +177,13 @@ void D3D11RenderContext::CreateSwapChain(IDXGIFactory* factory)
         swapChainSamples_ = sampleCount;
     }
 
+    /*
+    Use flip-model presentation whenever possible, i.e. without multi-sampling,
+    since flip-model swap chains do not support multi-sampled back buffers
+    */
+    hasFlipModel_       = (swapChainSamples_ == 1);
+    hasTearingSupport_  = (hasFlipModel_ && CheckTearingSupport(factory));
+
     /* Create swap chain for window handle */
     NativeHandle wndHandle;
     GetSurface().GetNativeHandle(&wndHandle);
@@ -168,12 +199,34 @@ void D3D11RenderContext::CreateSwapChain(IDXGIFactory* factory)
         swapChainDesc.SampleDesc.Count                      = swapChainSamples_;
         swapChainDesc.SampleDesc.Quality                    = 0;
         swapChainDesc.BufferUsage                           = DXGI_USAGE_RENDER_TARGET_OUTPUT;
-        swapChainDesc.BufferCount                           = (videoMode.swapChainSize == 3 ? 2 : 1);
         swapChainDesc.OutputWindow                          = wndHandle.window;
         swapChainDesc.Windowed                              = TRUE;//(videoMode.fullscreen ? FALSE : TRUE);
-        swapChainDesc.SwapEffect                            = DXGI_SWAP_EFFECT_DISCARD;
+        if (hasFlipModel_)
+        {
+            /* Flip-model swap chains require at least two buffers */
+            swapChainDesc.BufferCount                       = std::max(2u, videoMode.swapChainSize);
+            swapChainDesc.SwapEffect                        = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+            swapChainDesc.Flags                             = (hasTearingSupport_ ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0);
+        }
+        else
+        {
+            swapChainDesc.BufferCount                       = (videoMode.swapChainSize == 3 ? 2 : 1);
+            swapChainDesc.SwapEffect                        = DXGI_SWAP_EFFECT_DISCARD;
+        }
     }
     auto hr = factory->CreateSwapChain(device_.Get(), &swapChainDesc, swapChain_.ReleaseAndGetAddressOf());
+
+    if (FAILED(hr) && hasFlipModel_)
+    {
+        /* Fall back to blit-model swap effect on systems without flip-model support */
+        hasFlipModel_                   = false;
+        hasTearingSupport_              = false;
+        swapChainDesc.BufferCount       = (videoMode.swapChainSize == 3 ? 2 : 1);
+        swapChainDesc.SwapEffect        = DXGI_SWAP_EFFECT_DISCARD;
+        swapChainDesc.Flags             = 0;
+        hr = factory->CreateSwapChain(device_.Get(), &swapChainDesc, swapChain_.ReleaseAndGetAddressOf());
+    }
+
     DXThrowIfFailed(hr, "failed to create DXGI swap chain");
 }
 
@@ -243,8 +296,8 @@ void D3D11RenderContext::ResizeBackBuffer(const VideoModeDescriptor& videoModeDe
     backBuffer_.depthStencil.Reset();
     backBuffer_.dsv.Reset();
 
-    /* Resize swap-chain buffers, let DXGI find out the client area, and preserve buffer count and format */
-    auto hr = swapChain_->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN, 0);
+    /* Resize swap-chain buffers, let DXGI find out the client area, and preserve buffer count, format, and creation flags */
+    auto hr = swapChain_->ResizeBuffers(0, 0, 0, DXGI_FORMAT_UNKNOWN, (hasTearingSupport_ ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0));
     DXThrowIfFailed(hr, "failed to resize DXGI swap-chain buffers");
 
     /* Recreate back buffer and reset default render target */
@@ -77,6 +77,8 @@ class D3D11RenderContext final : public RenderContext
         ComPtr<IDXGISwapChain>      swapChain_;
         UINT                        swapChainInterval_  = 0;
         UINT                        swapChainSamples_   = 1;
+        bool                        hasFlipModel_       = false;
+        bool                        hasTearingSupport_  = false;
 
         D3D11BackBuffer             backBuffer_;
 
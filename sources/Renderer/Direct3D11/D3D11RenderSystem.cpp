@@ -17,6 +17,7 @@
 #include <sstream>
 #include <iomanip>
 #include <limits>
+#include <dxgi1_4.h>
 
 #include "Buffer/D3D11Buffer.h"
 #include "Buffer/D3D11BufferArray.h"
@@ -53,6 +54,56 @@ D3D11RenderSystem::~D3D11RenderSystem()
     D3D11MipGenerator::Get().Clear();
 }
 
+std::vector<VideoAdapterDescriptor> D3D11RenderSystem::QueryVideoAdapters() const
+{
+    return videoAdatperDescs_;
+}
+
+std::vector<VideoMemoryBudget> D3D11RenderSystem::QueryVideoMemoryBudgets() const
+{
+    std::vector<VideoMemoryBudget> budgets;
+
+    /* Get extended adapter interface (DXGI 1.4) for the adapter the device was created with */
+    ComPtr<IDXGIDevice> dxgiDevice;
+    if (FAILED(device_->QueryInterface(IID_PPV_ARGS(dxgiDevice.ReleaseAndGetAddressOf()))))
+        return budgets;
+
+    ComPtr<IDXGIAdapter> adapter;
+    if (FAILED(dxgiDevice->GetAdapter(adapter.ReleaseAndGetAddressOf())))
+        return budgets;
+
+    ComPtr<IDXGIAdapter3> videoAdapter;
+    if (FAILED(adapter->QueryInterface(IID_PPV_ARGS(videoAdapter.ReleaseAndGetAddressOf()))))
+        return budgets;
+
+    DXGI_ADAPTER_DESC adapterDesc;
+    InitMemory(adapterDesc);
+    videoAdapter->GetDesc(&adapterDesc);
+
+    /* Query budgets of local (video memory) and non-local (shared system memory) segment groups */
+    const DXGI_MEMORY_SEGMENT_GROUP segmentGroups[] = { DXGI_MEMORY_SEGMENT_GROUP_LOCAL, DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL };
+
+    for (auto segmentGroup : segmentGroups)
+    {
+        DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo;
+        InitMemory(memoryInfo);
+
+        if (SUCCEEDED(videoAdapter->QueryVideoMemoryInfo(0, segmentGroup, &memoryInfo)))
+        {
+            VideoMemoryBudget budget;
+            {
+                budget.usage        = memoryInfo.CurrentUsage;
+                budget.budget       = memoryInfo.Budget;
+                budget.heapSize     = (segmentGroup == DXGI_MEMORY_SEGMENT_GROUP_LOCAL ? adapterDesc.DedicatedVideoMemory : adapterDesc.SharedSystemMemory);
+                budget.deviceLocal  = (segmentGroup == DXGI_MEMORY_SEGMENT_GROUP_LOCAL);
+            }
+            budgets.push_back(budget);
+        }
+    }
+
+    return budgets;
+}
+
 /* ----- Render Context ----- */
 
 RenderContext* D3D11RenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
@@ -79,6 +130,7 @@ CommandQueue* D3D11RenderSystem::GetCommandQueue()
 
 CommandBuffer* D3D11RenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
+    std::lock_guard<std::mutex> guard { commandBufferMutex_ };
     if ((desc.flags & CommandBufferFlags::DeferredSubmit) != 0)
     {
         /* Create deferred D3D11 device context */
@@ -104,6 +156,7 @@ CommandBuffer* D3D11RenderSystem::CreateCommandBuffer(const CommandBufferDescrip
 
 void D3D11RenderSystem::Release(CommandBuffer& commandBuffer)
 {
+    std::lock_guard<std::mutex> guard { commandBufferMutex_ };
     RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
 }
 
@@ -204,6 +257,17 @@ Texture* D3D11RenderSystem::CreateTexture(const TextureDescriptor& textureDesc,
     return TakeOwnership(textures_, std::move(texture));
 }
 
+Texture* D3D11RenderSystem::CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc)
+{
+    auto& sharedTextureD3D = LLGL_CAST(D3D11Texture&, sharedTexture);
+
+    /* Create texture object that shares the native resource of the shared texture */
+    auto texture = MakeUnique<D3D11Texture>(textureViewDesc.type);
+    texture->CreateTextureView(device_.Get(), sharedTextureD3D, textureViewDesc);
+
+    return TakeOwnership(textures_, std::move(texture));
+}
+
 void D3D11RenderSystem::Release(Texture& texture)
 {
     RemoveFromUniqueSet(textures_, &texture);
@@ -274,6 +338,12 @@ void D3D11RenderSystem::WriteTexture(Texture& texture, const TextureRegion& text
     }
 }
 
+void D3D11RenderSystem::SetTextureMinLod(Texture& texture, float minLod)
+{
+    auto& textureD3D = LLGL_CAST(D3D11Texture&, texture);
+    context_->SetResourceMinLOD(textureD3D.GetNative().resource.Get(), minLod);
+}
+
 static void ValidateImageDataSize(std::size_t dataSize, std::size_t requiredDataSize)
 {
     if (dataSize < requiredDataSize)
@@ -358,6 +428,12 @@ void D3D11RenderSystem::Release(ResourceHeap& resourceHeap)
     RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
 }
 
+void D3D11RenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews)
+{
+    auto& resourceHeapD3D = LLGL_CAST(D3D11ResourceHeap&, resourceHeap);
+    resourceHeapD3D.WriteResourceViews(firstDescriptor, numResourceViews, resourceViews);
+}
+
 /* ----- Render Passes ----- */
 
 RenderPass* D3D11RenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
@@ -426,7 +502,7 @@ GraphicsPipeline* D3D11RenderSystem::CreateGraphicsPipeline(const GraphicsPipeli
     if (device3_)
     {
         /* Create graphics pipeline for Direct3D 11.3 */
-        return TakeOwnership(graphicsPipelines_, MakeUnique<D3D11GraphicsPipeline3>(device3_.Get(), desc));
+        return TakeOwnership(graphicsPipelines_, MakeUnique<D3D11GraphicsPipeline3>(device3_.Get(), stateObjectCache_, desc));
     }
     #endif
 
@@ -434,7 +510,7 @@ GraphicsPipeline* D3D11RenderSystem::CreateGraphicsPipeline(const GraphicsPipeli
     if (device2_)
     {
         /* Create graphics pipeline for Direct3D 11.1 (there is no dedicated class for 11.2) */
-        return TakeOwnership(graphicsPipelines_, MakeUnique<D3D11GraphicsPipeline1>(device2_.Get(), desc));
+        return TakeOwnership(graphicsPipelines_, MakeUnique<D3D11GraphicsPipeline1>(device2_.Get(), stateObjectCache_, desc));
     }
     #endif
 
@@ -442,12 +518,12 @@ GraphicsPipeline* D3D11RenderSystem::CreateGraphicsPipeline(const GraphicsPipeli
     if (device1_)
     {
         /* Create graphics pipeline for Direct3D 11.1 */
-        return TakeOwnership(graphicsPipelines_, MakeUnique<D3D11GraphicsPipeline1>(device1_.Get(), desc));
+        return TakeOwnership(graphicsPipelines_, MakeUnique<D3D11GraphicsPipeline1>(device1_.Get(), stateObjectCache_, desc));
     }
     #endif
 
     /* Create graphics pipeline for Direct3D 11.0 */
-    return TakeOwnership(graphicsPipelines_, MakeUnique<D3D11GraphicsPipeline>(device_.Get(), desc));
+    return TakeOwnership(graphicsPipelines_, MakeUnique<D3D11GraphicsPipeline>(device_.Get(), stateObjectCache_, desc));
 }
 
 ComputePipeline* D3D11RenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
@@ -27,6 +27,7 @@
 #include "RenderState/D3D11ResourceHeap.h"
 #include "RenderState/D3D11RenderPass.h"
 #include "RenderState/D3D11PipelineLayout.h"
+#include "RenderState/D3D11StateObjectCache.h"
 
 #include "Shader/D3D11Shader.h"
 #include "Shader/D3D11ShaderProgram.h"
@@ -39,6 +40,7 @@
 #include "../DXCommon/ComPtr.h"
 
 #include <dxgi.h>
+#include <mutex>
 #include "Direct3D11.h"
 
 
@@ -56,6 +58,10 @@ class D3D11RenderSystem final : public RenderSystem
         D3D11RenderSystem();
         ~D3D11RenderSystem();
 
+        std::vector<VideoAdapterDescriptor> QueryVideoAdapters() const override;
+
+        std::vector<VideoMemoryBudget> QueryVideoMemoryBudgets() const override;
+
         /* ----- Render Context ------ */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -88,10 +94,12 @@ class D3D11RenderSystem final : public RenderSystem
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
+        Texture* CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc) override;
 
         void Release(Texture& texture) override;
 
         void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
+        void SetTextureMinLod(Texture& texture, float minLod) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
         /* ----- Sampler States ---- */
@@ -106,6 +114,8 @@ class D3D11RenderSystem final : public RenderSystem
 
         void Release(ResourceHeap& resourceHeap) override;
 
+        void WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews) override;
+
         /* ----- Render Passes ----- */
 
         RenderPass* CreateRenderPass(const RenderPassDescriptor& desc) override;
@@ -243,11 +253,14 @@ class D3D11RenderSystem final : public RenderSystem
 
         std::shared_ptr<D3D11StateManager>              stateMngr_;
 
+        D3D11StateObjectCache                           stateObjectCache_;
+
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<D3D11RenderContext>           renderContexts_;
         HWObjectInstance<D3D11CommandQueue>             commandQueue_;
         HWObjectContainer<D3D11CommandBuffer>           commandBuffers_;
+        std::mutex                                      commandBufferMutex_;
         HWObjectContainer<D3D11Buffer>                  buffers_;
         HWObjectContainer<D3D11BufferArray>             bufferArrays_;
         HWObjectContainer<D3D11Texture>                 textures_;
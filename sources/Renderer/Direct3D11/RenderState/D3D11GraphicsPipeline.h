@@ -16,22 +16,18 @@ namespace LLGL
 {
 
 
+class D3D11StateObjectCache;
+
 // GraphicsPipeline implementation for Direct3D 11.0
 class D3D11GraphicsPipeline final : public D3D11GraphicsPipelineBase
 {
 
     public:
 
-        D3D11GraphicsPipeline(ID3D11Device* device, const GraphicsPipelineDescriptor& desc);
+        D3D11GraphicsPipeline(ID3D11Device* device, D3D11StateObjectCache& stateObjectCache, const GraphicsPipelineDescriptor& desc);
 
         void Bind(D3D11StateManager& stateMngr) override;
 
-    private:
-
-        void CreateDepthStencilState(ID3D11Device* device, const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc);
-        void CreateRasterizerState(ID3D11Device* device, const RasterizerDescriptor& desc);
-        void CreateBlendState(ID3D11Device* device, const BlendDescriptor& desc);
-
     private:
 
         ComPtr<ID3D11DepthStencilState> depthStencilState_;
@@ -19,22 +19,18 @@ namespace LLGL
 {
 
 
+class D3D11StateObjectCache;
+
 // GraphicsPipeline implementation for Direct3D 11.3
 class D3D11GraphicsPipeline3 final : public D3D11GraphicsPipelineBase
 {
 
     public:
 
-        D3D11GraphicsPipeline3(ID3D11Device3* device, const GraphicsPipelineDescriptor& desc);
+        D3D11GraphicsPipeline3(ID3D11Device3* device, D3D11StateObjectCache& stateObjectCache, const GraphicsPipelineDescriptor& desc);
 
         void Bind(D3D11StateManager& stateMngr) override;
 
-    private:
-
-        void CreateDepthStencilState(ID3D11Device3* device, const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc);
-        void CreateRasterizerState(ID3D11Device3* device, const RasterizerDescriptor& desc);
-        void CreateBlendState(ID3D11Device3* device, const BlendDescriptor& desc);
-
     private:
 
         ComPtr<ID3D11DepthStencilState> depthStencilState_;
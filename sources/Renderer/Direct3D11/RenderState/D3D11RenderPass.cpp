@@ -14,7 +14,8 @@ namespace LLGL
 {
 
 
-D3D11RenderPass::D3D11RenderPass(const RenderPassDescriptor& desc)
+D3D11RenderPass::D3D11RenderPass(const RenderPassDescriptor& desc) :
+    readOnlyDepthStencil_ { desc.readOnlyDepthStencil }
 {
     /* Check which color attachment must be cleared */
     FillClearColorAttachmentIndices(clearColorAttachments_, desc);
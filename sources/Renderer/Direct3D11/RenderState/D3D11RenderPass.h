@@ -39,10 +39,17 @@ class D3D11RenderPass final : public RenderPass
             return clearColorAttachments_;
         }
 
+        // Returns true if the depth-stencil view (DSV) is bound as read-only within this render pass.
+        inline bool IsReadOnlyDepthStencil() const
+        {
+            return readOnlyDepthStencil_;
+        }
+
     private:
 
         UINT            clearFlagsDSV_                                          = 0;
         std::uint8_t    clearColorAttachments_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]  = {};
+        bool            readOnlyDepthStencil_                                   = false;
 
 };
 
@@ -14,6 +14,8 @@
 #include "../../CheckedCast.h"
 #include "../../ResourceBindingIterator.h"
 #include "../../../Core/Helper.h"
+#include <LLGL/Instrumentation.h>
+#include <cstring>
 
 
 namespace LLGL
@@ -90,11 +92,9 @@ struct D3DResourceBinding
  * D3D11ResourceHeap class
  */
 
-D3D11ResourceHeap::D3D11ResourceHeap(const ResourceHeapDescriptor& desc)
+D3D11ResourceHeap::D3D11ResourceHeap(const ResourceHeapDescriptor& desc) :
+    desc_ { desc }
 {
-    /* Initialize segmentation header */
-    InitMemory(segmentationHeader_);
-
     /* Get pipeline layout object */
     auto pipelineLayoutD3D = LLGL_CAST(D3D11PipelineLayout*, desc.pipelineLayout);
     if (!pipelineLayoutD3D)
@@ -105,40 +105,77 @@ D3D11ResourceHeap::D3D11ResourceHeap(const ResourceHeapDescriptor& desc)
     if (desc.resourceViews.size() != bindings.size())
         throw std::invalid_argument("failed to create resource heap due to mismatch between number of resources and bindings");
 
-    /* Build buffer segments (stage after stage, so the internal buffer is constructed in the correct order) */
-    ResourceBindingIterator resourceIterator { desc.resourceViews, bindings };
-
-    BuildSegmentsForStage(resourceIterator, StageFlags::VertexStage);
-    BuildSegmentsForStage(resourceIterator, StageFlags::TessControlStage);
-    BuildSegmentsForStage(resourceIterator, StageFlags::TessEvaluationStage);
-    BuildSegmentsForStage(resourceIterator, StageFlags::GeometryStage);
-    BuildSegmentsForStage(resourceIterator, StageFlags::FragmentStage);
-
-    /* Store buffer offset for compute shader and check for boundary */
-    if (buffer_.size() > static_cast<std::size_t>(std::numeric_limits<std::uint16_t>::max()))
-        throw std::out_of_range("internal buffer for resource heap exceeded limit of 2^16 (65536) bytes");
-
-    bufferOffsetCS_ = static_cast<std::uint16_t>(buffer_.size());
-    BuildSegmentsForStage(resourceIterator, StageFlags::ComputeStage);
+    BuildAllResourceViews();
+}
 
-    StoreResourceUsage();
+void D3D11ResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews)
+{
+    /* Validate descriptor range */
+    if (firstDescriptor + numResourceViews > desc_.resourceViews.size())
+        throw std::invalid_argument("failed to update resource heap due to out-of-bounds descriptor range");
+
+    /* Patch the stored resource views */
+    for (std::uint32_t i = 0; i < numResourceViews; ++i)
+        desc_.resourceViews[firstDescriptor + i] = resourceViews[i];
+
+    /*
+    The internal buffer is a tightly packed emulation of a descriptor heap,
+    so an in-place update is performed by rebuilding its segments from the patched resource views;
+    the binding cache compares raw segment bytes, so updated views are re-submitted on the next bind call
+    */
+    buffer_.clear();
+    BuildAllResourceViews();
 }
 
-void D3D11ResourceHeap::BindForGraphicsPipeline(ID3D11DeviceContext* context)
+void D3D11ResourceHeap::BindForGraphicsPipeline(ID3D11DeviceContext* context, BindingCache& bindingCache)
 {
     auto byteAlignedBuffer = buffer_.data();
-    if (segmentationHeader_.hasVSResources) { BindVSResources(context, byteAlignedBuffer); }
-    if (segmentationHeader_.hasHSResources) { BindHSResources(context, byteAlignedBuffer); }
-    if (segmentationHeader_.hasDSResources) { BindDSResources(context, byteAlignedBuffer); }
-    if (segmentationHeader_.hasGSResources) { BindGSResources(context, byteAlignedBuffer); }
-    if (segmentationHeader_.hasPSResources) { BindPSResources(context, byteAlignedBuffer); }
+
+    /* Walk the cached segments in lock-step if the previously bound heap shares the same segmentation */
+    const std::int8_t* cachedBuffer     = nullptr;
+    const std::int8_t* cachedBufferEnd  = nullptr;
+
+    if (bindingCache.hasGraphicsSegments &&
+        std::memcmp(&(bindingCache.graphicsHeader), &segmentationHeader_, sizeof(SegmentationHeader)) == 0)
+    {
+        cachedBuffer    = bindingCache.graphicsSegments.data();
+        cachedBufferEnd = cachedBuffer + bindingCache.graphicsSegments.size();
+    }
+
+    if (segmentationHeader_.hasVSResources) { BindVSResources(context, byteAlignedBuffer, cachedBuffer, cachedBufferEnd); }
+    if (segmentationHeader_.hasHSResources) { BindHSResources(context, byteAlignedBuffer, cachedBuffer, cachedBufferEnd); }
+    if (segmentationHeader_.hasDSResources) { BindDSResources(context, byteAlignedBuffer, cachedBuffer, cachedBufferEnd); }
+    if (segmentationHeader_.hasGSResources) { BindGSResources(context, byteAlignedBuffer, cachedBuffer, cachedBufferEnd); }
+    if (segmentationHeader_.hasPSResources) { BindPSResources(context, byteAlignedBuffer, cachedBuffer, cachedBufferEnd); }
+
+    /* Store shadow copy of the submitted segments for the next bind call */
+    std::memcpy(&(bindingCache.graphicsHeader), &segmentationHeader_, sizeof(SegmentationHeader));
+    bindingCache.graphicsSegments.assign(buffer_.data(), buffer_.data() + bufferOffsetCS_);
+    bindingCache.hasGraphicsSegments = true;
 }
 
-void D3D11ResourceHeap::BindForComputePipeline(ID3D11DeviceContext* context)
+void D3D11ResourceHeap::BindForComputePipeline(ID3D11DeviceContext* context, BindingCache& bindingCache)
 {
     auto byteAlignedBuffer = buffer_.data();
     byteAlignedBuffer += bufferOffsetCS_;
-    if (segmentationHeader_.hasCSResources) { BindCSResources(context, byteAlignedBuffer); }
+
+    /* Walk the cached segments in lock-step if the previously bound heap shares the same segmentation */
+    const std::int8_t* cachedBuffer     = nullptr;
+    const std::int8_t* cachedBufferEnd  = nullptr;
+
+    if (bindingCache.hasComputeSegments &&
+        std::memcmp(&(bindingCache.computeHeader), &segmentationHeader_, sizeof(SegmentationHeader)) == 0)
+    {
+        cachedBuffer    = bindingCache.computeSegments.data();
+        cachedBufferEnd = cachedBuffer + bindingCache.computeSegments.size();
+    }
+
+    if (segmentationHeader_.hasCSResources) { BindCSResources(context, byteAlignedBuffer, cachedBuffer, cachedBufferEnd); }
+
+    /* Store shadow copy of the submitted segments for the next bind call */
+    std::memcpy(&(bindingCache.computeHeader), &segmentationHeader_, sizeof(SegmentationHeader));
+    bindingCache.computeSegments.assign(buffer_.data() + bufferOffsetCS_, buffer_.data() + buffer_.size());
+    bindingCache.hasComputeSegments = true;
 }
 
 
@@ -181,6 +218,34 @@ static std::vector<D3DResourceBinding> CollectD3DResourceBindings(
     return resourceBindings;
 }
 
+void D3D11ResourceHeap::BuildAllResourceViews()
+{
+    /* Initialize segmentation header */
+    InitMemory(segmentationHeader_);
+
+    auto pipelineLayoutD3D = LLGL_CAST(D3D11PipelineLayout*, desc_.pipelineLayout);
+
+    /* Build buffer segments (stage after stage, so the internal buffer is constructed in the correct order) */
+    ResourceBindingIterator resourceIterator { desc_.resourceViews, pipelineLayoutD3D->GetBindings() };
+
+    BuildSegmentsForStage(resourceIterator, StageFlags::VertexStage);
+    BuildSegmentsForStage(resourceIterator, StageFlags::TessControlStage);
+    BuildSegmentsForStage(resourceIterator, StageFlags::TessEvaluationStage);
+    BuildSegmentsForStage(resourceIterator, StageFlags::GeometryStage);
+    BuildSegmentsForStage(resourceIterator, StageFlags::FragmentStage);
+
+    /* Store buffer offset for compute shader and check for boundary */
+    if (buffer_.size() > static_cast<std::size_t>(std::numeric_limits<std::uint16_t>::max()))
+        throw std::out_of_range("internal buffer for resource heap exceeded limit of 2^16 (65536) bytes");
+
+    bufferOffsetCS_ = static_cast<std::uint16_t>(buffer_.size());
+    BuildSegmentsForStage(resourceIterator, StageFlags::ComputeStage);
+
+    StoreResourceUsage();
+
+    LLGL_INSTRUMENT_EVENT(ResourceHeapBuild, "D3D11ResourceHeap", buffer_.size());
+}
+
 void D3D11ResourceHeap::BuildSegmentsForStage(ResourceBindingIterator& resourceIterator, long stage)
 {
     BuildConstantBufferSegments(resourceIterator, stage);
@@ -519,6 +584,28 @@ static ID3D11UnorderedAccessView* const* CastToD3D11UnorderedAccessView(const st
     return CastToD3DViews<ID3D11UnorderedAccessView>(byteAlignedBuffer);
 }
 
+/*
+Returns true if the specified segment differs from the cached segment that was previously submitted at the same walk position,
+and advances the cached segment pointer. Walking both buffers in lock-step is valid, since the caller only passes a cache
+whose segmentation header equals the one of this resource heap (see BindForGraphicsPipeline).
+*/
+static bool IsSegmentDirty(const std::int8_t* segment, std::size_t segmentSize, const std::int8_t*& cachedSegment, const std::int8_t* cachedSegmentEnd)
+{
+    if (cachedSegment == nullptr || cachedSegment + sizeof(D3DResourceViewHeapSegment1) > cachedSegmentEnd)
+        return true;
+
+    /* Both segment types store their size in the first field */
+    const auto cachedSegmentSize = reinterpret_cast<const D3DResourceViewHeapSegment1*>(cachedSegment)->segmentSize;
+    if (cachedSegment + cachedSegmentSize > cachedSegmentEnd)
+        return true;
+
+    /* Compare the entire segment, i.e. its register range and all view pointers */
+    const bool dirty = (cachedSegmentSize != segmentSize || std::memcmp(segment, cachedSegment, segmentSize) != 0);
+    cachedSegment += cachedSegmentSize;
+
+    return dirty;
+}
+
 void D3D11ResourceHeap::StoreResourceUsage()
 {
     /* Store information for which stages any resources have been specified */
@@ -546,13 +633,14 @@ void D3D11ResourceHeap::StoreResourceUsage()
         segmentationHeader_.hasCSResources = 1;
 }
 
-void D3D11ResourceHeap::BindVSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer)
+void D3D11ResourceHeap::BindVSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd)
 {
     /* Bind all constant buffers */
     for (std::uint8_t i = 0; i < segmentationHeader_.numVSConstantBufferSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->VSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->VSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -560,7 +648,8 @@ void D3D11ResourceHeap::BindVSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numVSSamplerSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->VSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->VSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -568,18 +657,20 @@ void D3D11ResourceHeap::BindVSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numVSShaderResourceViewSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->VSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->VSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 }
 
-void D3D11ResourceHeap::BindHSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer)
+void D3D11ResourceHeap::BindHSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd)
 {
     /* Bind all constant buffers */
     for (std::uint8_t i = 0; i < segmentationHeader_.numHSConstantBufferSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->HSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->HSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -587,7 +678,8 @@ void D3D11ResourceHeap::BindHSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numHSSamplerSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->HSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->HSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -595,18 +687,20 @@ void D3D11ResourceHeap::BindHSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numHSShaderResourceViewSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->HSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->HSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 }
 
-void D3D11ResourceHeap::BindDSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer)
+void D3D11ResourceHeap::BindDSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd)
 {
     /* Bind all constant buffers */
     for (std::uint8_t i = 0; i < segmentationHeader_.numDSConstantBufferSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->DSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->DSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -614,7 +708,8 @@ void D3D11ResourceHeap::BindDSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numDSSamplerSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->DSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->DSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -622,18 +717,20 @@ void D3D11ResourceHeap::BindDSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numDSShaderResourceViewSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->DSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->DSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 }
 
-void D3D11ResourceHeap::BindGSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer)
+void D3D11ResourceHeap::BindGSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd)
 {
     /* Bind all constant buffers */
     for (std::uint8_t i = 0; i < segmentationHeader_.numGSConstantBufferSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->GSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->GSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -641,7 +738,8 @@ void D3D11ResourceHeap::BindGSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numGSSamplerSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->GSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->GSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -649,18 +747,20 @@ void D3D11ResourceHeap::BindGSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numGSShaderResourceViewSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->GSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->GSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 }
 
-void D3D11ResourceHeap::BindPSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer)
+void D3D11ResourceHeap::BindPSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd)
 {
     /* Bind all constant buffers */
     for (std::uint8_t i = 0; i < segmentationHeader_.numPSConstantBufferSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->PSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->PSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -668,7 +768,8 @@ void D3D11ResourceHeap::BindPSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numPSSamplerSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->PSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->PSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -676,7 +777,8 @@ void D3D11ResourceHeap::BindPSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numPSShaderResourceViewSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->PSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->PSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -684,26 +786,30 @@ void D3D11ResourceHeap::BindPSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numPSUnorderedAccessViewSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment2*>(byteAlignedBuffer);
-        context->OMSetRenderTargetsAndUnorderedAccessViews(
-            D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL,
-            nullptr,
-            nullptr,
-            segment->startSlot,
-            segment->numViews,
-            reinterpret_cast<ID3D11UnorderedAccessView* const*>(byteAlignedBuffer + sizeof(D3DResourceViewHeapSegment2)),
-            reinterpret_cast<const UINT*>(byteAlignedBuffer + segment->offsetEnd0)
-        );
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+        {
+            context->OMSetRenderTargetsAndUnorderedAccessViews(
+                D3D11_KEEP_RENDER_TARGETS_AND_DEPTH_STENCIL,
+                nullptr,
+                nullptr,
+                segment->startSlot,
+                segment->numViews,
+                reinterpret_cast<ID3D11UnorderedAccessView* const*>(byteAlignedBuffer + sizeof(D3DResourceViewHeapSegment2)),
+                reinterpret_cast<const UINT*>(byteAlignedBuffer + segment->offsetEnd0)
+            );
+        }
         byteAlignedBuffer += segment->segmentSize;
     }
 }
 
-void D3D11ResourceHeap::BindCSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer)
+void D3D11ResourceHeap::BindCSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd)
 {
     /* Bind all constant buffers */
     for (std::uint8_t i = 0; i < segmentationHeader_.numCSConstantBufferSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->CSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->CSSetConstantBuffers(segment->startSlot, segment->numViews, CastToD3D11Buffers(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -711,7 +817,8 @@ void D3D11ResourceHeap::BindCSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numCSSamplerSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->CSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->CSSetSamplers(segment->startSlot, segment->numViews, CastToD3D11SamplerStates(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -719,7 +826,8 @@ void D3D11ResourceHeap::BindCSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numCSShaderResourceViewSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment1*>(byteAlignedBuffer);
-        context->CSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+            context->CSSetShaderResources(segment->startSlot, segment->numViews, CastToD3D11ShaderResourceViews(byteAlignedBuffer));
         byteAlignedBuffer += segment->segmentSize;
     }
 
@@ -727,17 +835,31 @@ void D3D11ResourceHeap::BindCSResources(ID3D11DeviceContext* context, std::int8_
     for (std::uint8_t i = 0; i < segmentationHeader_.numCSUnorderedAccessViewSegments; ++i)
     {
         auto segment = reinterpret_cast<const D3DResourceViewHeapSegment2*>(byteAlignedBuffer);
-        context->CSSetUnorderedAccessViews(
-            segment->startSlot,
-            segment->numViews,
-            reinterpret_cast<ID3D11UnorderedAccessView* const*>(byteAlignedBuffer + sizeof(D3DResourceViewHeapSegment2)),
-            reinterpret_cast<const UINT*>(byteAlignedBuffer + segment->offsetEnd0)
-        );
+        if (IsSegmentDirty(byteAlignedBuffer, segment->segmentSize, cachedBuffer, cachedBufferEnd))
+        {
+            context->CSSetUnorderedAccessViews(
+                segment->startSlot,
+                segment->numViews,
+                reinterpret_cast<ID3D11UnorderedAccessView* const*>(byteAlignedBuffer + sizeof(D3DResourceViewHeapSegment2)),
+                reinterpret_cast<const UINT*>(byteAlignedBuffer + segment->offsetEnd0)
+            );
+        }
         byteAlignedBuffer += segment->segmentSize;
     }
 }
 
 
+/*
+ * BindingCache structure
+ */
+
+void D3D11ResourceHeap::BindingCache::Invalidate()
+{
+    hasGraphicsSegments = false;
+    hasComputeSegments  = false;
+}
+
+
 } // /namespace LLGL
 
 
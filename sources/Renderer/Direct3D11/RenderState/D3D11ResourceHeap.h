@@ -10,6 +10,7 @@
 
 
 #include <LLGL/ResourceHeap.h>
+#include <LLGL/ResourceHeapFlags.h>
 #include <LLGL/ResourceFlags.h>
 #include <vector>
 #include <functional>
@@ -30,55 +31,6 @@ by binding all shader resources within one bind call in the command buffer.
 class D3D11ResourceHeap final : public ResourceHeap
 {
 
-    public:
-
-        D3D11ResourceHeap(const ResourceHeapDescriptor& desc);
-
-        void BindForGraphicsPipeline(ID3D11DeviceContext* context);
-        void BindForComputePipeline(ID3D11DeviceContext* context);
-
-    private:
-
-        using D3DResourceBindingIter = std::vector<D3DResourceBinding>::const_iterator;
-        using BuildSegmentFunc = std::function<void(D3DResourceBindingIter begin, UINT count)>;
-
-        void BuildSegmentsForStage(ResourceBindingIterator& resourceIterator, long stage);
-        void BuildConstantBufferSegments(ResourceBindingIterator& resourceIterator, long stage);
-        void BuildShaderResourceViewSegments(ResourceBindingIterator& resourceIterator, long stage);
-        void BuildUnorderedAccessViewSegments(ResourceBindingIterator& resourceIterator, long stage);
-        void BuildSamplerSegments(ResourceBindingIterator& resourceIterator, long stage);
-
-        void BuildAllSegments(
-            const std::vector<D3DResourceBinding>&  resourceBindings,
-            const BuildSegmentFunc&                 buildSegmentFunc,
-            long                                    affectedStage,
-            std::uint8_t&                           numSegments
-        );
-
-        void BuildAllSegmentsType1(
-            const std::vector<D3DResourceBinding>&  resourceBindings,
-            long                                    affectedStage,
-            std::uint8_t&                           numSegments
-        );
-
-        void BuildAllSegmentsType2(
-            const std::vector<D3DResourceBinding>&  resourceBindings,
-            long                                    affectedStage,
-            std::uint8_t&                           numSegments
-        );
-
-        void BuildSegment1(D3DResourceBindingIter it, UINT count);
-        void BuildSegment2(D3DResourceBindingIter it, UINT count);
-
-        void StoreResourceUsage();
-
-        void BindVSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer);
-        void BindHSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer);
-        void BindDSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer);
-        void BindGSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer);
-        void BindPSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer);
-        void BindCSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer);
-
     private:
 
         /*
@@ -123,8 +75,83 @@ class D3D11ResourceHeap final : public ResourceHeap
             std::uint8_t numCSShaderResourceViewSegments;
         };
 
+    public:
+
+        /*
+        Shadow copy of the segments that were last submitted to a device context.
+        It allows a subsequent bind call to skip all register ranges that are already bound,
+        since consecutive resource heaps of the same pipeline layout usually differ in only a few views.
+        The cache must be invalidated whenever resources are bound to the context outside of a resource heap.
+        */
+        struct BindingCache
+        {
+            // Invalidates the cached segments, so the next bind call re-submits all register ranges.
+            void Invalidate();
+
+            SegmentationHeader          graphicsHeader;
+            SegmentationHeader          computeHeader;
+            std::vector<std::int8_t>    graphicsSegments;
+            std::vector<std::int8_t>    computeSegments;
+            bool                        hasGraphicsSegments = false;
+            bool                        hasComputeSegments  = false;
+        };
+
+    public:
+
+        D3D11ResourceHeap(const ResourceHeapDescriptor& desc);
+
+        // Updates the specified range of resource views in place by rebuilding the internal buffer segments.
+        void WriteResourceViews(std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews);
+
+        void BindForGraphicsPipeline(ID3D11DeviceContext* context, BindingCache& bindingCache);
+        void BindForComputePipeline(ID3D11DeviceContext* context, BindingCache& bindingCache);
+
+    private:
+
+        using D3DResourceBindingIter = std::vector<D3DResourceBinding>::const_iterator;
+        using BuildSegmentFunc = std::function<void(D3DResourceBindingIter begin, UINT count)>;
+
+        void BuildAllResourceViews();
+        void BuildSegmentsForStage(ResourceBindingIterator& resourceIterator, long stage);
+        void BuildConstantBufferSegments(ResourceBindingIterator& resourceIterator, long stage);
+        void BuildShaderResourceViewSegments(ResourceBindingIterator& resourceIterator, long stage);
+        void BuildUnorderedAccessViewSegments(ResourceBindingIterator& resourceIterator, long stage);
+        void BuildSamplerSegments(ResourceBindingIterator& resourceIterator, long stage);
+
+        void BuildAllSegments(
+            const std::vector<D3DResourceBinding>&  resourceBindings,
+            const BuildSegmentFunc&                 buildSegmentFunc,
+            long                                    affectedStage,
+            std::uint8_t&                           numSegments
+        );
+
+        void BuildAllSegmentsType1(
+            const std::vector<D3DResourceBinding>&  resourceBindings,
+            long                                    affectedStage,
+            std::uint8_t&                           numSegments
+        );
+
+        void BuildAllSegmentsType2(
+            const std::vector<D3DResourceBinding>&  resourceBindings,
+            long                                    affectedStage,
+            std::uint8_t&                           numSegments
+        );
+
+        void BuildSegment1(D3DResourceBindingIter it, UINT count);
+        void BuildSegment2(D3DResourceBindingIter it, UINT count);
+
+        void StoreResourceUsage();
+
+        void BindVSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd);
+        void BindHSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd);
+        void BindDSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd);
+        void BindGSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd);
+        void BindPSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd);
+        void BindCSResources(ID3D11DeviceContext* context, std::int8_t*& byteAlignedBuffer, const std::int8_t*& cachedBuffer, const std::int8_t* cachedBufferEnd);
+
     private:
 
+        ResourceHeapDescriptor      desc_;                  // Copy of the descriptor; kept to rebuild segments for in-place updates
         SegmentationHeader          segmentationHeader_;
         std::uint16_t               bufferOffsetCS_         = 0;
         std::vector<std::int8_t>    buffer_;
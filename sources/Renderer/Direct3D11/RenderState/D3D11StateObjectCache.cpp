@@ -0,0 +1,145 @@
+/*
+ * D3D11StateObjectCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "D3D11StateObjectCache.h"
+#include "../D3D11Types.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/Helper.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal functions ----- */
+
+// Returns a content hash of the specified D3D state descriptor (FNV-1a, 64 bit)
+template <typename TDesc>
+static std::uint64_t HashStateDesc(const TDesc& desc)
+{
+    auto bytes = reinterpret_cast<const std::uint8_t*>(&desc);
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    for (std::size_t i = 0; i < sizeof(TDesc); ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+
+/* ----- D3D11StateObjectCache class ----- */
+
+/*
+All descriptors are zero-initialized before conversion,
+so their padding bytes hash deterministically
+*/
+
+ComPtr<ID3D11DepthStencilState> D3D11StateObjectCache::GetOrCreateDepthStencilState(ID3D11Device* device, const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc)
+{
+    D3D11_DEPTH_STENCIL_DESC descDX;
+    InitMemory(descDX);
+    D3D11Types::Convert(descDX, depthDesc, stencilDesc);
+
+    auto& state = depthStencilStates_[HashStateDesc(descDX)];
+    if (!state)
+    {
+        auto hr = device->CreateDepthStencilState(&descDX, state.ReleaseAndGetAddressOf());
+        DXThrowIfFailed(hr, "failed to create D3D11 depth-stencil state");
+    }
+    return state;
+}
+
+ComPtr<ID3D11RasterizerState> D3D11StateObjectCache::GetOrCreateRasterizerState(ID3D11Device* device, const RasterizerDescriptor& desc)
+{
+    D3D11_RASTERIZER_DESC descDX;
+    InitMemory(descDX);
+    D3D11Types::Convert(descDX, desc);
+
+    auto& state = rasterizerStates_[HashStateDesc(descDX)];
+    if (!state)
+    {
+        auto hr = device->CreateRasterizerState(&descDX, state.ReleaseAndGetAddressOf());
+        DXThrowIfFailed(hr, "failed to create D3D11 rasterizer state");
+    }
+    return state;
+}
+
+ComPtr<ID3D11BlendState> D3D11StateObjectCache::GetOrCreateBlendState(ID3D11Device* device, const BlendDescriptor& desc)
+{
+    D3D11_BLEND_DESC descDX;
+    InitMemory(descDX);
+    D3D11Types::Convert(descDX, desc);
+
+    auto& state = blendStates_[HashStateDesc(descDX)];
+    if (!state)
+    {
+        auto hr = device->CreateBlendState(&descDX, state.ReleaseAndGetAddressOf());
+        DXThrowIfFailed(hr, "failed to create D3D11 blend state");
+    }
+    return state;
+}
+
+#if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+
+ComPtr<ID3D11BlendState1> D3D11StateObjectCache::GetOrCreateBlendState1(ID3D11Device1* device, const BlendDescriptor& desc)
+{
+    D3D11_BLEND_DESC1 descDX;
+    InitMemory(descDX);
+    D3D11Types::Convert(descDX, desc);
+
+    auto& state = blendStates1_[HashStateDesc(descDX)];
+    if (!state)
+    {
+        auto hr = device->CreateBlendState1(&descDX, state.ReleaseAndGetAddressOf());
+        DXThrowIfFailed(hr, "failed to create D3D11 blend state");
+    }
+    return state;
+}
+
+#endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
+
+#if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+
+ComPtr<ID3D11RasterizerState2> D3D11StateObjectCache::GetOrCreateRasterizerState2(ID3D11Device3* device, const RasterizerDescriptor& desc)
+{
+    D3D11_RASTERIZER_DESC2 descDX;
+    InitMemory(descDX);
+    D3D11Types::Convert(descDX, desc);
+
+    auto& state = rasterizerStates2_[HashStateDesc(descDX)];
+    if (!state)
+    {
+        auto hr = device->CreateRasterizerState2(&descDX, state.ReleaseAndGetAddressOf());
+        DXThrowIfFailed(hr, "failed to create D3D11 rasterizer state");
+    }
+    return state;
+}
+
+#endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
+
+void D3D11StateObjectCache::Clear()
+{
+    depthStencilStates_.clear();
+    rasterizerStates_.clear();
+    blendStates_.clear();
+
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+    blendStates1_.clear();
+    #endif
+
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+    rasterizerStates2_.clear();
+    #endif
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
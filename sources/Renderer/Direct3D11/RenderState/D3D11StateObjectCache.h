@@ -0,0 +1,83 @@
+/*
+ * D3D11StateObjectCache.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_D3D11_STATE_OBJECT_CACHE_H
+#define LLGL_D3D11_STATE_OBJECT_CACHE_H
+
+
+#include <LLGL/GraphicsPipelineFlags.h>
+#include "../../DXCommon/ComPtr.h"
+#include "../Direct3D11.h"
+#include <cstdint>
+#include <map>
+
+
+namespace LLGL
+{
+
+
+/*
+Cache of content-hashed D3D11 render state objects (depth-stencil, rasterizer, and blend states).
+D3D11 limits the number of each of these state objects to 4096 per device and their creation is slow,
+while most graphics pipelines only differ in their shaders. Pipelines with identical state descriptors
+therefore share a single state object.
+*/
+class D3D11StateObjectCache
+{
+
+    public:
+
+        /* ----- Render states for Direct3D 11.0 ----- */
+
+        ComPtr<ID3D11DepthStencilState> GetOrCreateDepthStencilState(ID3D11Device* device, const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc);
+        ComPtr<ID3D11RasterizerState>   GetOrCreateRasterizerState(ID3D11Device* device, const RasterizerDescriptor& desc);
+        ComPtr<ID3D11BlendState>        GetOrCreateBlendState(ID3D11Device* device, const BlendDescriptor& desc);
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+
+        /* ----- Render states for Direct3D 11.1 ----- */
+
+        ComPtr<ID3D11BlendState1>       GetOrCreateBlendState1(ID3D11Device1* device, const BlendDescriptor& desc);
+
+        #endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+
+        /* ----- Render states for Direct3D 11.3 ----- */
+
+        ComPtr<ID3D11RasterizerState2>  GetOrCreateRasterizerState2(ID3D11Device3* device, const RasterizerDescriptor& desc);
+
+        #endif // /LLGL_D3D11_ENABLE_FEATURELEVEL
+
+        // Releases all cached state objects.
+        void Clear();
+
+    private:
+
+        std::map<std::uint64_t, ComPtr<ID3D11DepthStencilState>>    depthStencilStates_;
+        std::map<std::uint64_t, ComPtr<ID3D11RasterizerState>>      rasterizerStates_;
+        std::map<std::uint64_t, ComPtr<ID3D11BlendState>>           blendStates_;
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+        std::map<std::uint64_t, ComPtr<ID3D11BlendState1>>          blendStates1_;
+        #endif
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+        std::map<std::uint64_t, ComPtr<ID3D11RasterizerState2>>     rasterizerStates2_;
+        #endif
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -159,9 +159,13 @@ bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& sh
     /* Get parameter from union */
     const char* entry   = shaderDesc.entryPoint;
     const char* target  = (shaderDesc.profile != nullptr ? shaderDesc.profile : "");
-    auto        defines = reinterpret_cast<const D3D_SHADER_MACRO*>(shaderDesc.defines);
     auto        flags   = shaderDesc.flags;
 
+    /* Get macro definitions (including specialization constants) */
+    std::vector<D3D_SHADER_MACRO>   macros;
+    std::vector<std::string>        macroValues;
+    auto defines = DXGetShaderMacros(shaderDesc.defines, shaderDesc.specializations, macros, macroValues);
+
     /* Compile shader code */
     auto hr = D3DCompile(
         sourceCode,
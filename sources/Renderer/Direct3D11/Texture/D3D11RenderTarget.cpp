@@ -319,6 +319,15 @@ void D3D11RenderTarget::AttachTextureColor(D3D11Texture& textureD3D, const Attac
     }
 }
 
+// Returns the DSV flags to bind the specified depth-stencil format as read-only
+static UINT GetReadOnlyFlagsDSV(DXGI_FORMAT format)
+{
+    UINT flags = D3D11_DSV_READ_ONLY_DEPTH;
+    if (DXTypes::HasStencilComponent(format))
+        flags |= D3D11_DSV_READ_ONLY_STENCIL;
+    return flags;
+}
+
 void D3D11RenderTarget::AttachTextureDepthStencil(D3D11Texture& textureD3D, const AttachmentDescriptor& attachmentDesc)
 {
     /* Create DSV for texture */
@@ -329,6 +338,16 @@ void D3D11RenderTarget::AttachTextureDepthStencil(D3D11Texture& textureD3D, cons
         attachmentDesc.arrayLayer,
         1
     );
+
+    /* Create read-only DSV for render passes that sample the depth buffer while it is bound */
+    textureD3D.CreateSubresourceDSV(
+        device_,
+        depthStencilViewReadOnly_.ReleaseAndGetAddressOf(),
+        attachmentDesc.mipLevel,
+        attachmentDesc.arrayLayer,
+        1,
+        GetReadOnlyFlagsDSV(D3D11Types::ToDXGIFormatDSV(textureD3D.GetFormat()))
+    );
 }
 
 void D3D11RenderTarget::CreateDepthStencilAndDSV(DXGI_FORMAT format)
@@ -355,6 +374,16 @@ void D3D11RenderTarget::CreateDepthStencilAndDSV(DXGI_FORMAT format)
     hr = device_->CreateDepthStencilView(depthStencil_.Get(), nullptr, depthStencilView_.ReleaseAndGetAddressOf());
     DXThrowIfCreateFailed(hr, "ID3D11DepthStencilView",  "for render-target");
 
+    /* Create read-only DSV for render passes that sample the depth buffer while it is bound */
+    D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
+    {
+        dsvDesc.Format          = format;
+        dsvDesc.ViewDimension   = (texDesc.SampleDesc.Count > 1 ? D3D11_DSV_DIMENSION_TEXTURE2DMS : D3D11_DSV_DIMENSION_TEXTURE2D);
+        dsvDesc.Flags           = GetReadOnlyFlagsDSV(format);
+    }
+    hr = device_->CreateDepthStencilView(depthStencil_.Get(), &dsvDesc, depthStencilViewReadOnly_.ReleaseAndGetAddressOf());
+    DXThrowIfCreateFailed(hr, "ID3D11DepthStencilView",  "for render-target (read-only)");
+
     /* Store native depth-stencil format */
     depthStencilFormat_ = format;
 }
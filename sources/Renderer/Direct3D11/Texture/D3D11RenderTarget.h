@@ -51,10 +51,10 @@ class D3D11RenderTarget final : public RenderTarget
             return renderTargetViewsRef_;
         }
 
-        // Returns the native depth stencil view (DSV).
-        inline ID3D11DepthStencilView* GetDepthStencilView() const
+        // Returns the native depth stencil view (DSV); optionally the read-only DSV, so the depth buffer can be sampled while bound.
+        inline ID3D11DepthStencilView* GetDepthStencilView(bool readOnly = false) const
         {
-            return depthStencilView_.Get();
+            return (readOnly ? depthStencilViewReadOnly_.Get() : depthStencilView_.Get());
         }
 
     private:
@@ -83,6 +83,7 @@ class D3D11RenderTarget final : public RenderTarget
 
         ComPtr<ID3D11Texture2D>                     depthStencil_;
         ComPtr<ID3D11DepthStencilView>              depthStencilView_;
+        ComPtr<ID3D11DepthStencilView>              depthStencilViewReadOnly_;
         DXGI_FORMAT                                 depthStencilFormat_         = DXGI_FORMAT_UNKNOWN;
 
         // Members for multi-sampled render-targets
@@ -269,6 +269,29 @@ void D3D11Texture::CreateTexture3D(
     CreateDefaultResourceViews(device, srvDesc, uavDesc, desc.bindFlags);
 }
 
+void D3D11Texture::CreateTextureView(
+    ID3D11Device*                   device,
+    D3D11Texture&                   sharedTexture,
+    const TextureViewDescriptor&    textureViewDesc)
+{
+    /* Share the native resource of the shared texture (kept alive by reference counting) */
+    native_.resource = sharedTexture.native_.resource;
+
+    /* Store parameters of the view's subresource range */
+    const auto& subresource = textureViewDesc.subresource;
+    SetResourceParams(D3D11Types::Map(textureViewDesc.format), Extent3D{}, subresource.numMipLevels, subresource.numArrayLayers);
+
+    /* Create SRV with the view's own type, format, and subresource range */
+    CreateSubresourceSRV(
+        device,
+        srv_.ReleaseAndGetAddressOf(),
+        subresource.baseMipLevel,
+        subresource.numMipLevels,
+        subresource.baseArrayLayer,
+        subresource.numArrayLayers
+    );
+}
+
 void D3D11Texture::UpdateSubresource(
     ID3D11DeviceContext*        context,
     UINT                        mipLevel,
@@ -487,12 +510,13 @@ void D3D11Texture::CreateSubresourceDSV(
     ID3D11DepthStencilView**    dsvOutput,
     UINT                        baseMipLevel,
     UINT                        baseArrayLayer,
-    UINT                        numArrayLayers)
+    UINT                        numArrayLayers,
+    UINT                        dsvFlags)
 {
     D3D11_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
     {
         dsvDesc.Format  = D3D11Types::ToDXGIFormatDSV(GetFormat());
-        dsvDesc.Flags   = 0;
+        dsvDesc.Flags   = dsvFlags;
 
         switch (GetType())
         {
@@ -78,6 +78,16 @@ class D3D11Texture final : public Texture
             const D3D11_UNORDERED_ACCESS_VIEW_DESC* uavDesc     = nullptr
         );
 
+        /*
+        Initializes this texture as a texture-view that shares the native resource of the specified texture.
+        Only a shader-resource-view (SRV) is created for the view's subresource range; texture-views are for sampling only.
+        */
+        void CreateTextureView(
+            ID3D11Device*                   device,
+            D3D11Texture&                   sharedTexture,
+            const TextureViewDescriptor&    textureViewDesc
+        );
+
         void UpdateSubresource(
             ID3D11DeviceContext*        context,
             UINT                        mipLevel,
@@ -112,7 +122,8 @@ class D3D11Texture final : public Texture
             ID3D11DepthStencilView**    dsvOutput,
             UINT                        baseMipLevel,
             UINT                        baseArrayLayer,
-            UINT                        numArrayLayers
+            UINT                        numArrayLayers,
+            UINT                        dsvFlags = 0
         );
 
         // Returns the subresource index for the specified MIP-map level and array layer.
@@ -173,7 +173,8 @@ void D3D12Buffer::CreateVertexBufferView(const BufferDescriptor& desc)
 {
     vertexBufferView_.BufferLocation    = GetNative()->GetGPUVirtualAddress();
     vertexBufferView_.SizeInBytes       = static_cast<UINT>(GetBufferSize());
-    vertexBufferView_.StrideInBytes     = (desc.vertexAttribs.empty() ? 0 : desc.vertexAttribs.front().stride);
+    const auto& vertexAttribs = GetBufferVertexAttribs(desc);
+    vertexBufferView_.StrideInBytes     = (vertexAttribs.empty() ? 0 : vertexAttribs.front().stride);
 }
 
 void D3D12Buffer::CreateIndexBufferView(const BufferDescriptor& desc)
@@ -20,8 +20,12 @@ D3D12BufferArray::D3D12BufferArray(long bindFlags, std::uint32_t numBuffers, Buf
 {
     /* Store the strides and offests of each D3D12VertexBuffer inside the arrays */
     vertexBufferViews_.reserve(numBuffers);
+    residencySet_.reserve(numBuffers);
     while (auto next = NextArrayResource<D3D12Buffer>(numBuffers, bufferArray))
+    {
         vertexBufferViews_.push_back(next->GetVertexBufferView());
+        residencySet_.push_back(next->GetNative());
+    }
 }
 
 
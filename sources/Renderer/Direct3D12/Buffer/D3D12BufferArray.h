@@ -33,9 +33,16 @@ class D3D12BufferArray final : public BufferArray
             return vertexBufferViews_;
         }
 
+        // Returns the list of native buffer resources; used for residency tracking.
+        inline const std::vector<ID3D12Pageable*>& GetResidencySet() const
+        {
+            return residencySet_;
+        }
+
     private:
 
-        std::vector<D3D12_VERTEX_BUFFER_VIEW> vertexBufferViews_;
+        std::vector<D3D12_VERTEX_BUFFER_VIEW>   vertexBufferViews_;
+        std::vector<ID3D12Pageable*>            residencySet_;
 
 };
 
@@ -22,18 +22,22 @@ D3D12StagingBuffer::D3D12StagingBuffer(ID3D12Device* device, UINT64 size)
 
 D3D12StagingBuffer::D3D12StagingBuffer(D3D12StagingBuffer&& rhs) :
     native_ { std::move(rhs.native_) },
+    mapped_ { rhs.mapped_            },
     size_   { rhs.size_              },
     offset_ { rhs.offset_            }
 {
+    rhs.mapped_ = nullptr;
 }
 
 D3D12StagingBuffer& D3D12StagingBuffer::operator = (D3D12StagingBuffer&& rhs)
 {
     if (this != &rhs)
     {
-        native_ = std::move(rhs.native_);
-        size_   = rhs.size_;
-        offset_ = rhs.offset_;
+        native_     = std::move(rhs.native_);
+        mapped_     = rhs.mapped_;
+        size_       = rhs.size_;
+        offset_     = rhs.offset_;
+        rhs.mapped_ = nullptr;
     }
     return *this;
 }
@@ -51,6 +55,10 @@ void D3D12StagingBuffer::Create(ID3D12Device* device, UINT64 size)
     );
     DXThrowIfCreateFailed(hr, "failed to create D3D12 committed resource for upload buffer");
 
+    /* Map upload buffer persistently; upload heaps can remain mapped for the lifetime of the resource */
+    hr = native_->Map(0, nullptr, reinterpret_cast<void**>(&mapped_));
+    DXThrowIfFailed(hr, "failed to map D3D12 upload buffer");
+
     /* Store new size and reset write offset */
     size_   = size;
     offset_ = 0;
@@ -58,6 +66,11 @@ void D3D12StagingBuffer::Create(ID3D12Device* device, UINT64 size)
 
 void D3D12StagingBuffer::Release()
 {
+    if (mapped_ != nullptr)
+    {
+        native_->Unmap(0, nullptr);
+        mapped_ = nullptr;
+    }
     native_.Reset();
 }
 
@@ -78,17 +91,7 @@ void D3D12StagingBuffer::Write(
     const void*                 data,
     UINT64                      dataSize)
 {
-    /* Copy CPU-memory to upload buffer */
-    char* intermediateData = nullptr;
-    HRESULT hr = native_->Map(0, nullptr, reinterpret_cast<void**>(&intermediateData));
-    if (SUCCEEDED(hr))
-    {
-        ::memcpy(intermediateData + offset_, data, static_cast<std::size_t>(dataSize));
-        native_->Unmap(0, nullptr);
-    }
-
-    /* Encode copy buffer command */
-    commandList->CopyBufferRegion(dstBuffer, dstOffset, native_.Get(), offset_, dataSize);
+    WriteAt(commandList, dstBuffer, dstOffset, data, dataSize, offset_);
 }
 
 void D3D12StagingBuffer::WriteAndIncrementOffset(
@@ -102,6 +105,21 @@ void D3D12StagingBuffer::WriteAndIncrementOffset(
     offset_ += dataSize;
 }
 
+void D3D12StagingBuffer::WriteAt(
+    ID3D12GraphicsCommandList*  commandList,
+    ID3D12Resource*             dstBuffer,
+    UINT64                      dstOffset,
+    const void*                 data,
+    UINT64                      dataSize,
+    UINT64                      srcOffset)
+{
+    /* Copy CPU-memory into persistently mapped upload buffer */
+    ::memcpy(mapped_ + srcOffset, data, static_cast<std::size_t>(dataSize));
+
+    /* Encode copy buffer command */
+    commandList->CopyBufferRegion(dstBuffer, dstOffset, native_.Get(), srcOffset, dataSize);
+}
+
 
 } // /namespace LLGL
 
@@ -18,7 +18,7 @@ namespace LLGL
 
 
 /*
-Instance of this class represents a single chunk in the staging buffer pool
+Instance of this class represents a persistently mapped upload buffer
 to handle dynamic buffer updates during command buffer recording.
 */
 class D3D12StagingBuffer
@@ -37,7 +37,7 @@ class D3D12StagingBuffer
         D3D12StagingBuffer(const D3D12StagingBuffer&) = delete;
         D3D12StagingBuffer& operator = (const D3D12StagingBuffer&) = delete;
 
-        // Creates a new resource and resets the writing offset.
+        // Creates a new resource, maps it persistently, and resets the writing offset.
         void Create(ID3D12Device* device, UINT64 size);
 
         // Release the native buffer resource.
@@ -67,6 +67,16 @@ class D3D12StagingBuffer
             UINT64                      dataSize
         );
 
+        // Writes the specified data to the native D3D upload buffer at an explicit source offset, ignoring the write offset.
+        void WriteAt(
+            ID3D12GraphicsCommandList*  commandList,
+            ID3D12Resource*             dstBuffer,
+            UINT64                      dstOffset,
+            const void*                 data,
+            UINT64                      dataSize,
+            UINT64                      srcOffset
+        );
+
         // Returns the native D3D resource.
         inline ID3D12Resource* GetNative() const
         {
@@ -88,6 +98,7 @@ class D3D12StagingBuffer
     private:
 
         ComPtr<ID3D12Resource>  native_;
+        char*                   mapped_ = nullptr;
         UINT64                  size_   = 0;
         UINT64                  offset_ = 0;
 
@@ -1,6 +1,6 @@
 /*
  * D3D12StagingBufferPool.cpp
- * 
+ *
  * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
  * See "LICENSE.txt" for license information.
  */
@@ -8,6 +8,7 @@
 #include "D3D12StagingBufferPool.h"
 #include "../Command/D3D12CommandContext.h"
 #include "../D3D12Resource.h"
+#include "../../DXCommon/DXCore.h"
 #include "../../../Core/Helper.h"
 #include <algorithm>
 
@@ -16,23 +17,50 @@ namespace LLGL
 {
 
 
-D3D12StagingBufferPool::D3D12StagingBufferPool(ID3D12Device* device, UINT64 chunkSize) :
-    device_    { device    },
-    chunkSize_ { chunkSize }
+// Alignment of the ring write position; must cover the constant buffer alignment for per-draw constant updates.
+static const UINT64 g_stagingRingAlignment = 256ull;
+
+// Minimal size of the upload ring.
+static const UINT64 g_minStagingRingSize = 65536ull;
+
+// Returns the smallest power of two that is greater than or equal to the specified value.
+static UINT64 NextPowerOfTwo(UINT64 value)
+{
+    UINT64 size = 1;
+    while (size < value)
+        size <<= 1;
+    return size;
+}
+
+D3D12StagingBufferPool::D3D12StagingBufferPool(ID3D12Device* device, UINT64 chunkSize)
+{
+    InitializeDevice(device, chunkSize);
+}
+
+D3D12StagingBufferPool::~D3D12StagingBufferPool()
 {
+    /* Wait until all pending frames have completed before their upload buffers are released */
+    while (ReclaimFrame(true))
+    {
+    }
+
+    if (fenceEvent_ != 0)
+        CloseHandle(fenceEvent_);
 }
 
 void D3D12StagingBufferPool::InitializeDevice(ID3D12Device* device, UINT64 chunkSize)
 {
-    device_    = device;
-    chunkSize_ = chunkSize;
+    device_ = device;
+    GrowRing(std::max(chunkSize, g_minStagingRingSize));
+    CreateFence();
 }
 
 void D3D12StagingBufferPool::Reset()
 {
-    for (auto& chunk : chunks_)
-        chunk.Reset();
-    chunkIdx_ = 0;
+    /* Reclaim the ring space of all frames that have already completed */
+    while (ReclaimFrame(false))
+    {
+    }
 }
 
 void D3D12StagingBufferPool::WriteStaged(
@@ -42,23 +70,18 @@ void D3D12StagingBufferPool::WriteStaged(
     const void*             data,
     UINT64                  dataSize)
 {
-    /* Check if a new chunk must be allocated */
-    if (chunkIdx_ == chunks_.size())
-        AllocChunk(dataSize);
-    else if (!chunks_[chunkIdx_].Capacity(dataSize))
-    {
-        ++chunkIdx_;
-        if (chunkIdx_ == chunks_.size())
-            AllocChunk(dataSize);
-    }
+    /* Grow ring in power-of-two steps if the data does not fit into it at all */
+    if (dataSize > ring_.GetSize())
+        GrowRing(dataSize);
+
+    /* Copy data into the ring at the reserved offset */
+    const auto srcOffset = ReserveRange(dataSize);
 
-    /* Write data to current chunk */
     commandContext.TransitionResource(dstBuffer, D3D12_RESOURCE_STATE_COPY_DEST, true);
     {
-        auto& chunk = chunks_[chunkIdx_];
-        chunk.WriteAndIncrementOffset(commandContext.GetCommandList(), dstBuffer.Get(), dstOffset, data, dataSize);
+        ring_.WriteAt(commandContext.GetCommandList(), dstBuffer.Get(), dstOffset, data, dataSize, srcOffset);
     }
-    commandContext.TransitionResource(dstBuffer, dstBuffer.usageState, true);
+    commandContext.TransitionResource(dstBuffer, dstBuffer.usageState);
 }
 
 void D3D12StagingBufferPool::WriteImmediate(
@@ -87,7 +110,21 @@ void D3D12StagingBufferPool::WriteImmediate(
     {
         globalUploadBuffer_.Write(commandContext.GetCommandList(), dstBuffer.Get(), dstOffset, data, dataSize);
     }
-    commandContext.TransitionResource(dstBuffer, dstBuffer.usageState, true);
+    commandContext.TransitionResource(dstBuffer, dstBuffer.usageState);
+}
+
+void D3D12StagingBufferPool::SignalFrame(ID3D12CommandQueue* commandQueue)
+{
+    /* Schedule fence signal to retire the ring space written since the last signal */
+    auto hr = commandQueue->Signal(fence_.Get(), ++fenceValue_);
+    DXThrowIfFailed(hr, "failed to signal D3D12 fence for staging buffer pool");
+
+    Frame frame;
+    {
+        frame.fenceValue    = fenceValue_;
+        frame.writeEnd      = writePos_;
+    }
+    pendingFrames_.push(frame);
 }
 
 
@@ -95,10 +132,108 @@ void D3D12StagingBufferPool::WriteImmediate(
  * ======= Private: =======
  */
 
-void D3D12StagingBufferPool::AllocChunk(UINT64 minChunkSize)
+void D3D12StagingBufferPool::CreateFence()
 {
-    chunks_.emplace_back(device_, std::max(chunkSize_, minChunkSize));
-    chunkIdx_ = chunks_.size() - 1;
+    auto hr = device_->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(fence_.ReleaseAndGetAddressOf()));
+    DXThrowIfFailed(hr, "failed to create D3D12 fence for staging buffer pool");
+
+    fenceEvent_ = CreateEventEx(nullptr, nullptr, 0, EVENT_ALL_ACCESS);
+}
+
+void D3D12StagingBufferPool::GrowRing(UINT64 minSize)
+{
+    /* Retire the outgrown ring buffer; it is released after the frame it was last referenced by (i.e. the next signal) has completed */
+    if (ring_.GetNative() != nullptr)
+        retiredBuffers_.emplace_back(std::move(ring_), fenceValue_ + 1);
+
+    /* Allocate new ring buffer and restart the virtual write positions */
+    ring_.Create(device_, NextPowerOfTwo(std::max(minSize, g_minStagingRingSize)));
+
+    writePos_       = 0;
+    reclaimedPos_   = 0;
+
+    /* Forget pending frames of the old ring buffer; their space is no longer referenced by new writes */
+    while (!pendingFrames_.empty())
+        pendingFrames_.pop();
+}
+
+bool D3D12StagingBufferPool::ReclaimFrame(bool wait)
+{
+    PurgeRetiredBuffers();
+
+    if (pendingFrames_.empty())
+        return false;
+
+    auto& frame = pendingFrames_.front();
+
+    /* Check (or wait for) the frame fence */
+    if (fence_->GetCompletedValue() < frame.fenceValue)
+    {
+        if (!wait)
+            return false;
+
+        auto hr = fence_->SetEventOnCompletion(frame.fenceValue, fenceEvent_);
+        DXThrowIfFailed(hr, "failed to set 'on completion'-event for D3D12 fence of staging buffer pool");
+        WaitForSingleObject(fenceEvent_, INFINITE);
+    }
+
+    /* Reclaim ring space of the frame */
+    reclaimedPos_ = frame.writeEnd;
+    pendingFrames_.pop();
+
+    return true;
+}
+
+void D3D12StagingBufferPool::PurgeRetiredBuffers()
+{
+    if (!retiredBuffers_.empty())
+    {
+        const auto completedValue = fence_->GetCompletedValue();
+        retiredBuffers_.erase(
+            std::remove_if(
+                retiredBuffers_.begin(),
+                retiredBuffers_.end(),
+                [completedValue](const RetiredBuffer& entry)
+                {
+                    return (entry.releaseFenceValue <= completedValue);
+                }
+            ),
+            retiredBuffers_.end()
+        );
+    }
+}
+
+UINT64 D3D12StagingBufferPool::ReserveRange(UINT64 size)
+{
+    /* Align write position, and skip the padding at the end of the ring if the range would wrap around */
+    writePos_ = GetAlignedSize(writePos_, g_stagingRingAlignment);
+
+    auto ringSize           = ring_.GetSize();
+    const auto wrapOffset   = writePos_ % ringSize;
+
+    if (wrapOffset + size > ringSize)
+        writePos_ += (ringSize - wrapOffset);
+
+    /* Wait for the oldest pending frames until the ring has enough free space; only happens when the ring is over-committed */
+    while (writePos_ + size > reclaimedPos_ + ringSize)
+    {
+        if (!ReclaimFrame(true))
+        {
+            /*
+            All live ranges were staged during the current recording, so the ring cannot be reclaimed
+            without overwriting ranges the unsubmitted command list still references; grow the ring instead.
+            The outgrown buffer is retired by GrowRing and released after the next signal, so those ranges stay valid.
+            */
+            GrowRing(ringSize * 2);
+            ringSize = ring_.GetSize();
+            break;
+        }
+    }
+
+    const auto offset = writePos_ % ringSize;
+    writePos_ += size;
+
+    return offset;
 }
 
 
@@ -1,6 +1,6 @@
 /*
  * D3D12StagingBufferPool.h
- * 
+ *
  * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
  * See "LICENSE.txt" for license information.
  */
@@ -11,7 +11,9 @@
 
 #include "D3D12StagingBuffer.h"
 #include <d3d12.h>
+#include <queue>
 #include <vector>
+#include <utility>
 
 
 namespace LLGL
@@ -21,6 +23,13 @@ namespace LLGL
 struct D3D12Resource;
 class D3D12CommandContext;
 
+/*
+Persistently mapped upload ring for dynamic buffer updates during command buffer recording.
+Upload data is copied into the ring at a monotonically increasing write position,
+so each staged write is a plain pointer bump into mapped memory.
+The ring space of a frame is reclaimed once its fence value has been crossed (see SignalFrame),
+and the ring grows in power-of-two steps when a frame pushes more dynamic data than the ring can hold.
+*/
 class D3D12StagingBufferPool
 {
 
@@ -29,13 +38,18 @@ class D3D12StagingBufferPool
         D3D12StagingBufferPool() = default;
         D3D12StagingBufferPool(ID3D12Device* device, UINT64 chunkSize);
 
-        // Initializes the device object and chunk size.
+        ~D3D12StagingBufferPool();
+
+        D3D12StagingBufferPool(const D3D12StagingBufferPool&) = delete;
+        D3D12StagingBufferPool& operator = (const D3D12StagingBufferPool&) = delete;
+
+        // Initializes the device object and initial ring size.
         void InitializeDevice(ID3D12Device* device, UINT64 chunkSize);
 
-        // Resets all chunks in the pool.
+        // Reclaims the ring space of all frames whose fences have been crossed.
         void Reset();
 
-        // Writes the specified data to the destination buffer using the staging pool.
+        // Writes the specified data to the destination buffer using the upload ring.
         void WriteStaged(
             D3D12CommandContext&    commandContext,
             D3D12Resource&          dstBuffer,
@@ -54,18 +68,60 @@ class D3D12StagingBufferPool
             UINT64                  alignment   = 256u
         );
 
+        // Signals the end of a frame on the specified queue; the ring space written since the last signal is retired by this fence.
+        void SignalFrame(ID3D12CommandQueue* commandQueue);
+
     private:
 
-        // Allocates a new chunk with the specified minimal size.
-        void AllocChunk(UINT64 minChunkSize);
+        // Pending frame whose ring space is reclaimed when its fence value has been crossed.
+        struct Frame
+        {
+            UINT64 fenceValue   = 0;
+            UINT64 writeEnd     = 0; // Virtual write position that is reclaimed when the fence value has been crossed
+        };
 
-    private:
+        // Outgrown ring buffer that is kept alive until the frame it was last referenced by has completed.
+        struct RetiredBuffer
+        {
+            RetiredBuffer(D3D12StagingBuffer&& buffer, UINT64 releaseFenceValue) :
+                buffer            { std::move(buffer)  },
+                releaseFenceValue { releaseFenceValue  }
+            {
+            }
+
+            D3D12StagingBuffer  buffer;
+            UINT64              releaseFenceValue   = 0;
+        };
+
+        // Creates the fence used to retire frames.
+        void CreateFence();
+
+        // Replaces the ring buffer by one of at least the specified size, rounded up to a power of two.
+        void GrowRing(UINT64 minSize);
+
+        // Reclaims the ring space of the oldest pending frame; returns false if there is none, or its fence has not been crossed yet (and 'wait' is disabled).
+        bool ReclaimFrame(bool wait);
+
+        // Releases all retired ring buffers whose release fence values have been crossed.
+        void PurgeRetiredBuffers();
+
+        // Reserves the specified number of bytes in the ring and returns their buffer offset.
+        UINT64 ReserveRange(UINT64 size);
+
+        ID3D12Device*                           device_         = nullptr;
+
+        D3D12StagingBuffer                      ring_;
+        UINT64                                  writePos_       = 0; // Virtual write position (monotonically increasing)
+        UINT64                                  reclaimedPos_   = 0; // Virtual write position up to which all frames have completed
+
+        ComPtr<ID3D12Fence>                     fence_;
+        HANDLE                                  fenceEvent_     = 0;
+        UINT64                                  fenceValue_     = 0;
+
+        std::queue<Frame>                       pendingFrames_;
+        std::vector<RetiredBuffer>              retiredBuffers_;
 
-        ID3D12Device*                   device_             = nullptr;
-        std::vector<D3D12StagingBuffer> chunks_;
-        std::size_t                     chunkIdx_           = 0;
-        UINT64                          chunkSize_          = 0;
-        D3D12StagingBuffer              globalUploadBuffer_;
+        D3D12StagingBuffer                      globalUploadBuffer_;
 
 };
 
@@ -39,7 +39,9 @@ namespace LLGL
 
 D3D12CommandBuffer::D3D12CommandBuffer(D3D12RenderSystem& renderSystem, const CommandBufferDescriptor& desc) :
     commandSignaturePool_ { &(renderSystem.GetCommandSignaturePool())       },
-    stagingBufferPool_    { renderSystem.GetDevice().GetNative(), USHRT_MAX }
+    stagingBufferPool_    { renderSystem.GetDevice().GetNative(), USHRT_MAX },
+    descriptorHeapPool_   { renderSystem.GetDevice().GetNative()            },
+    residencyManager_     { &(renderSystem.GetResidencyManager())           }
 {
     CreateDevices(renderSystem, desc);
 }
@@ -57,10 +59,15 @@ void D3D12CommandBuffer::Begin()
     NextCommandAllocator();
     commandContext_.Reset(GetCommandAllocator());
     stagingBufferPool_.Reset();
+    descriptorHeapPool_.Reset();
+    residencySet_.clear();
 }
 
 void D3D12CommandBuffer::End()
 {
+    /* End copy batch if it was not ended explicitly */
+    EndCopyBatch();
+
     /* Close command context and reset intermediate states */
     commandContext_.Close();
     numBoundScissorRects_ = 0;
@@ -70,6 +77,10 @@ void D3D12CommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
     auto& cmdBufferD3D = LLGL_CAST(D3D12CommandBuffer&, deferredCommandBuffer);
     commandList_->ExecuteBundle(cmdBufferD3D.GetNative());
+
+    /* Adopt the residency set of the bundle; bundles are never submitted to a queue themselves */
+    const auto& bundleResidencySet = cmdBufferD3D.GetResidencySet();
+    residencySet_.insert(residencySet_.end(), bundleResidencySet.begin(), bundleResidencySet.end());
 }
 
 /* ----- Blitting ----- */
@@ -82,6 +93,7 @@ void D3D12CommandBuffer::UpdateBuffer(
 {
     auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
     //dstBufferD3D.UpdateDynamicSubresource(commandContext_, data, static_cast<UINT64>(dataSize), dstOffset);
+    TrackResidency(dstBufferD3D.GetNative());
     stagingBufferPool_.WriteStaged(commandContext_, dstBufferD3D.GetResource(), dstOffset, data, dataSize);
 }
 
@@ -95,10 +107,24 @@ void D3D12CommandBuffer::CopyBuffer(
 {
     auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
     auto& srcBufferD3D = LLGL_CAST(D3D12Buffer&, srcBuffer);
+    TrackResidency(dstBufferD3D.GetNative());
+    TrackResidency(srcBufferD3D.GetNative());
+
+    /* Transition both buffers into their copy states; restores are hoisted to the batch edge inside a copy batch */
+    const auto oldDstState = TransitionForCopy(dstBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
+    const auto oldSrcState = TransitionForCopy(srcBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE);
+    commandContext_.FlushResourceBarrieres();
+
     commandList_->CopyBufferRegion(dstBufferD3D.GetNative(), dstOffset, srcBufferD3D.GetNative(), srcOffset, size);
+
+    if (!insideCopyBatch_)
+    {
+        /* Restore previous states; the barriers are flushed lazily with the next command that requires them */
+        commandContext_.TransitionResource(dstBufferD3D.GetResource(), oldDstState);
+        commandContext_.TransitionResource(srcBufferD3D.GetResource(), oldSrcState);
+    }
 }
 
-//TODO: resource transition and barrieres
 void D3D12CommandBuffer::CopyTexture(
     Texture&                dstTexture,
     const TextureLocation&  dstLocation,
@@ -109,11 +135,19 @@ void D3D12CommandBuffer::CopyTexture(
     auto& dstTextureD3D = LLGL_CAST(D3D12Texture&, dstTexture);
     auto& srcTextureD3D = LLGL_CAST(D3D12Texture&, srcTexture);
 
+    TrackResidency(dstTextureD3D.GetNative());
+    TrackResidency(srcTextureD3D.GetNative());
+
     const D3D12_TEXTURE_COPY_LOCATION dstLocationD3D = dstTextureD3D.CalcCopyLocation(dstLocation);
     const D3D12_TEXTURE_COPY_LOCATION srcLocationD3D = dstTextureD3D.CalcCopyLocation(dstLocation);
 
     const D3D12_BOX srcBox = srcTextureD3D.CalcRegion(srcLocation.offset, extent);
 
+    /* Transition both textures into their copy states; restores are hoisted to the batch edge inside a copy batch */
+    const auto oldDstState = TransitionForCopy(dstTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
+    const auto oldSrcState = TransitionForCopy(srcTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE);
+    commandContext_.FlushResourceBarrieres();
+
     commandList_->CopyTextureRegion(
         &dstLocationD3D,                            // pDst
         static_cast<UINT>(dstLocation.offset.x),    // DstX
@@ -122,17 +156,49 @@ void D3D12CommandBuffer::CopyTexture(
         &srcLocationD3D,                            // pSrc
         &srcBox                                     // pSrcBox
     );
+
+    if (!insideCopyBatch_)
+    {
+        /* Restore previous states; the barriers are flushed lazily with the next command that requires them */
+        commandContext_.TransitionResource(dstTextureD3D.GetResource(), oldDstState);
+        commandContext_.TransitionResource(srcTextureD3D.GetResource(), oldSrcState);
+    }
+}
+
+void D3D12CommandBuffer::BeginCopyBatch()
+{
+    insideCopyBatch_ = true;
+}
+
+void D3D12CommandBuffer::EndCopyBatch()
+{
+    if (insideCopyBatch_)
+    {
+        /* Restore the previous states of all transitioned resources with a single barrier batch */
+        for (const auto& restoreState : copyBatchRestoreStates_)
+            commandContext_.TransitionResource(*restoreState.first, restoreState.second);
+        commandContext_.FlushResourceBarrieres();
+        copyBatchRestoreStates_.clear();
+
+        insideCopyBatch_ = false;
+    }
 }
 
 void D3D12CommandBuffer::GenerateMips(Texture& texture)
 {
+    /* Mip-map generation binds its own descriptor heaps */
+    descriptorHeapPool_.InvalidateBoundHeaps();
     auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+    TrackResidency(textureD3D.GetNative());
     D3D12MipGenerator::Get().GenerateMips(commandContext_, textureD3D, textureD3D.GetWholeSubresource());
 }
 
 void D3D12CommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
+    /* Mip-map generation binds its own descriptor heaps */
+    descriptorHeapPool_.InvalidateBoundHeaps();
     auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+    TrackResidency(textureD3D.GetNative());
     D3D12MipGenerator::Get().GenerateMips(commandContext_, textureD3D, subresource);
 }
 
@@ -145,6 +211,10 @@ void D3D12CommandBuffer::SetViewport(const Viewport& viewport)
 
 void D3D12CommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
+    /* Viewports cannot be recorded into bundles; they are inherited from the primary command list */
+    if (isBundle_)
+        return;
+
     numViewports = std::min(numViewports, std::uint32_t(D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE));
 
     /* Check if D3D12_VIEWPORT and Viewport structures can be safely reinterpret-casted */
@@ -192,6 +262,10 @@ void D3D12CommandBuffer::SetScissor(const Scissor& scissor)
 
 void D3D12CommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
+    /* Scissor rectangles cannot be recorded into bundles; they are inherited from the primary command list */
+    if (isBundle_)
+        return;
+
     numScissors = std::min(numScissors, std::uint32_t(D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE));
 
     D3D12_RECT scissorsD3D[D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
@@ -305,12 +379,15 @@ void D3D12CommandBuffer::ClearAttachments(std::uint32_t numAttachments, const At
 void D3D12CommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    TrackResidency(bufferD3D.GetNative());
     commandList_->IASetVertexBuffers(0, 1, &(bufferD3D.GetVertexBufferView()));
 }
 
 void D3D12CommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
     auto& bufferArrayD3D = LLGL_CAST(D3D12BufferArray&, bufferArray);
+    const auto& arrayResidencySet = bufferArrayD3D.GetResidencySet();
+    residencySet_.insert(residencySet_.end(), arrayResidencySet.begin(), arrayResidencySet.end());
     commandList_->IASetVertexBuffers(
         0,
         static_cast<UINT>(bufferArrayD3D.GetVertexBufferViews().size()),
@@ -321,12 +398,14 @@ void D3D12CommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 void D3D12CommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    TrackResidency(bufferD3D.GetNative());
     commandList_->IASetIndexBuffer(&(bufferD3D.GetIndexBufferView()));
 }
 
 void D3D12CommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    TrackResidency(bufferD3D.GetNative());
     auto indexBufferView = bufferD3D.GetIndexBufferView();
     if (indexBufferView.SizeInBytes > offset)
     {
@@ -364,40 +443,20 @@ void D3D12CommandBuffer::EndStreamOutput()
 
 void D3D12CommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
 {
-    /* Get descriptor heaps */
+    /* Copy descriptors into the shader-visible heap rings and bind root descriptor tables to graphics pipeline */
     auto& resourceHeapD3D = LLGL_CAST(D3D12ResourceHeap&, resourceHeap);
-
-    auto descHeaps = resourceHeapD3D.GetDescriptorHeaps();
-    auto heapCount = resourceHeapD3D.GetNumDescriptorHeaps();
-
-    if (heapCount > 0)
-    {
-        /* Bind descriptor heaps */
-        commandList_->SetDescriptorHeaps(heapCount, descHeaps);
-
-        /* Bind root descriptor tables to graphics pipeline */
-        for (UINT i = 0; i < heapCount; ++i)
-            commandList_->SetGraphicsRootDescriptorTable(i, descHeaps[i]->GetGPUDescriptorHandleForHeapStart());
-    }
+    const auto& heapResidencySet = resourceHeapD3D.GetResidencySet();
+    residencySet_.insert(residencySet_.end(), heapResidencySet.begin(), heapResidencySet.end());
+    descriptorHeapPool_.BindResourceHeap(commandList_.Get(), resourceHeapD3D, true);
 }
 
 void D3D12CommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
 {
-    /* Get descriptor heaps */
+    /* Copy descriptors into the shader-visible heap rings and bind root descriptor tables to compute pipeline */
     auto& resourceHeapD3D = LLGL_CAST(D3D12ResourceHeap&, resourceHeap);
-
-    auto descHeaps = resourceHeapD3D.GetDescriptorHeaps();
-    auto heapCount = resourceHeapD3D.GetNumDescriptorHeaps();
-
-    if (heapCount > 0)
-    {
-        /* Bind descriptor heaps */
-        commandList_->SetDescriptorHeaps(heapCount, descHeaps);
-
-        /* Bind root descriptor tables to compute pipeline */
-        for (UINT i = 0; i < heapCount; ++i)
-            commandList_->SetComputeRootDescriptorTable(i, descHeaps[i]->GetGPUDescriptorHandleForHeapStart());
-    }
+    const auto& heapResidencySet = resourceHeapD3D.GetResidencySet();
+    residencySet_.insert(residencySet_.end(), heapResidencySet.begin(), heapResidencySet.end());
+    descriptorHeapPool_.BindResourceHeap(commandList_.Get(), resourceHeapD3D, false);
 }
 
 void D3D12CommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags)
@@ -415,6 +474,62 @@ void D3D12CommandBuffer::ResetResourceSlots(
     // dummy
 }
 
+// Returns the native resource of the specified buffer or texture, or null for other resource types
+static D3D12Resource* GetD3DResource(Resource& resource)
+{
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto& bufferD3D = LLGL_CAST(D3D12Buffer&, resource);
+            return &(bufferD3D.GetResource());
+        }
+        case ResourceType::Texture:
+        {
+            auto& textureD3D = LLGL_CAST(D3D12Texture&, resource);
+            return &(textureD3D.GetResource());
+        }
+        default:
+            return nullptr;
+    }
+}
+
+static D3D12_RESOURCE_STATES GetD3DTransitionState(long bindFlags)
+{
+    D3D12_RESOURCE_STATES statesD3D = D3D12_RESOURCE_STATE_COMMON;
+
+    if ((bindFlags & (BindFlags::VertexBuffer | BindFlags::ConstantBuffer)) != 0)
+        statesD3D |= D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER;
+    if ((bindFlags & BindFlags::IndexBuffer) != 0)
+        statesD3D |= D3D12_RESOURCE_STATE_INDEX_BUFFER;
+    if ((bindFlags & BindFlags::Sampled) != 0)
+        statesD3D |= (D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+    if ((bindFlags & BindFlags::Storage) != 0)
+        statesD3D |= D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+    if ((bindFlags & BindFlags::StreamOutputBuffer) != 0)
+        statesD3D |= D3D12_RESOURCE_STATE_STREAM_OUT;
+    if ((bindFlags & BindFlags::IndirectBuffer) != 0)
+        statesD3D |= D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT;
+    if ((bindFlags & BindFlags::ColorAttachment) != 0)
+        statesD3D |= D3D12_RESOURCE_STATE_RENDER_TARGET;
+    if ((bindFlags & BindFlags::DepthStencilAttachment) != 0)
+        statesD3D |= D3D12_RESOURCE_STATE_DEPTH_WRITE;
+
+    return statesD3D;
+}
+
+void D3D12CommandBuffer::BeginResourceTransition(Resource& resource, long bindFlags)
+{
+    if (auto resourceD3D = GetD3DResource(resource))
+        commandContext_.TransitionResourceBegin(*resourceD3D, GetD3DTransitionState(bindFlags));
+}
+
+void D3D12CommandBuffer::EndResourceTransition(Resource& resource, long bindFlags)
+{
+    if (auto resourceD3D = GetD3DResource(resource))
+        commandContext_.TransitionResourceEnd(*resourceD3D, GetD3DTransitionState(bindFlags));
+}
+
 /* ----- Render Passes ----- */
 
 void D3D12CommandBuffer::BeginRenderPass(
@@ -425,18 +540,17 @@ void D3D12CommandBuffer::BeginRenderPass(
 {
     boundRenderTarget_ = &(renderTarget);
 
-    /* Bind render target/context */
+    auto renderPassD3D = (renderPass != nullptr ? LLGL_CAST(const D3D12RenderPass*, renderPass) : nullptr);
+
+    /* Bind render target/context; read-only DSVs are only supported for render targets */
     if (renderTarget.IsRenderContext())
         BindRenderContext(LLGL_CAST(D3D12RenderContext&, renderTarget));
     else
-        BindRenderTarget(LLGL_CAST(D3D12RenderTarget&, renderTarget));
+        BindRenderTarget(LLGL_CAST(D3D12RenderTarget&, renderTarget), (renderPassD3D != nullptr && renderPassD3D->IsReadOnlyDepthStencil()));
 
     /* Clear attachments */
-    if (renderPass)
-    {
-        auto renderPassD3D = LLGL_CAST(const D3D12RenderPass*, renderPass);
+    if (renderPassD3D != nullptr)
         ClearAttachmentsWithRenderPass(*renderPassD3D, numClearValues, clearValues);
-    }
 }
 
 void D3D12CommandBuffer::EndRenderPass()
@@ -467,8 +581,13 @@ void D3D12CommandBuffer::SetGraphicsPipeline(GraphicsPipeline& graphicsPipeline)
 
     /* Scissor rectangle must be updated (if scissor test is disabled) */
     scissorEnabled_ = graphicsPipelineD3D.IsScissorEnabled();
-    if (!scissorEnabled_ && commandList_->GetType() == D3D12_COMMAND_LIST_TYPE_DIRECT)
+    if (!scissorEnabled_ && !isBundle_)
         SetScissorRectsToDefault(graphicsPipelineD3D.NumDefaultScissorRects());
+
+    /* Store root constant range of the pipeline layout for SetUniforms */
+    rootConstantsIndex_         = graphicsPipelineD3D.GetRootConstantsIndex();
+    numRootConstants_           = graphicsPipelineD3D.GetNumRootConstants();
+    rootConstantsForGraphics_   = true;
 }
 
 void D3D12CommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
@@ -476,6 +595,11 @@ void D3D12CommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
     /* Set compute root signature, graphics pipeline state, and primitive topology */
     auto& computePipelineD3D = LLGL_CAST(D3D12ComputePipeline&, computePipeline);
     computePipelineD3D.Bind(commandContext_);
+
+    /* Store root constant range of the pipeline layout for SetUniforms */
+    rootConstantsIndex_         = computePipelineD3D.GetRootConstantsIndex();
+    numRootConstants_           = computePipelineD3D.GetNumRootConstants();
+    rootConstantsForGraphics_   = false;
 }
 
 void D3D12CommandBuffer::SetUniform(
@@ -492,7 +616,17 @@ void D3D12CommandBuffer::SetUniforms(
     const void*     data,
     std::uint32_t   dataSize)
 {
-    //TODO
+    /* The uniform location specifies the offset (in 32-bit words) within the root constant range */
+    const auto firstValue = static_cast<UINT>(location);
+    const auto numValues  = dataSize / 4;
+
+    if (numRootConstants_ > 0 && firstValue + numValues <= numRootConstants_)
+    {
+        if (rootConstantsForGraphics_)
+            commandList_->SetGraphicsRoot32BitConstants(rootConstantsIndex_, numValues, data, firstValue);
+        else
+            commandList_->SetComputeRoot32BitConstants(rootConstantsIndex_, numValues, data, firstValue);
+    }
 }
 
 /* ----- Queries ----- */
@@ -537,47 +671,57 @@ void D3D12CommandBuffer::EndRenderCondition()
 
 void D3D12CommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
+    commandContext_.FlushResourceBarrieres();
     commandList_->DrawInstanced(numVertices, 1, firstVertex, 0);
 }
 
 void D3D12CommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
+    commandContext_.FlushResourceBarrieres();
     commandList_->DrawIndexedInstanced(numIndices, 1, firstIndex, 0, 0);
 }
 
 void D3D12CommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    commandContext_.FlushResourceBarrieres();
     commandList_->DrawIndexedInstanced(numIndices, 1, firstIndex, vertexOffset, 0);
 }
 
 void D3D12CommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
+    commandContext_.FlushResourceBarrieres();
     commandList_->DrawInstanced(numVertices, numInstances, firstVertex, 0);
 }
 
 void D3D12CommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    commandContext_.FlushResourceBarrieres();
     commandList_->DrawInstanced(numVertices, numInstances, firstVertex, firstInstance);
 }
 
 void D3D12CommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
+    commandContext_.FlushResourceBarrieres();
     commandList_->DrawIndexedInstanced(numIndices, numInstances, firstIndex, 0, 0);
 }
 
 void D3D12CommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    commandContext_.FlushResourceBarrieres();
     commandList_->DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, 0);
 }
 
 void D3D12CommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    commandContext_.FlushResourceBarrieres();
     commandList_->DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 }
 
 void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    TrackResidency(bufferD3D.GetNative());
+    commandContext_.FlushResourceBarrieres();
     commandList_->ExecuteIndirect(
         commandSignaturePool_->GetSignatureDrawIndirect(), 1, bufferD3D.GetNative(), offset, nullptr, 0
     );
@@ -586,6 +730,8 @@ void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    TrackResidency(bufferD3D.GetNative());
+    commandContext_.FlushResourceBarrieres();
     while (numCommands-- > 0)
     {
         commandList_->ExecuteIndirect(
@@ -598,14 +744,31 @@ void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std:
 void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    TrackResidency(bufferD3D.GetNative());
+    commandContext_.FlushResourceBarrieres();
     commandList_->ExecuteIndirect(
         commandSignaturePool_->GetSignatureDrawIndexedIndirect(), 1, bufferD3D.GetNative(), offset, nullptr, 0
     );
 }
 
+void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    auto& bufferD3D         = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& countBufferD3D    = LLGL_CAST(D3D12Buffer&, countBuffer);
+    TrackResidency(bufferD3D.GetNative());
+    TrackResidency(countBufferD3D.GetNative());
+    commandContext_.FlushResourceBarrieres();
+    commandList_->ExecuteIndirect(
+        commandSignaturePool_->GetSignatureDrawIndirect(stride), maxNumCommands,
+        bufferD3D.GetNative(), offset, countBufferD3D.GetNative(), countOffset
+    );
+}
+
 void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    TrackResidency(bufferD3D.GetNative());
+    commandContext_.FlushResourceBarrieres();
     while (numCommands-- > 0)
     {
         commandList_->ExecuteIndirect(
@@ -615,16 +778,53 @@ void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offse
     }
 }
 
+void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    auto& bufferD3D         = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& countBufferD3D    = LLGL_CAST(D3D12Buffer&, countBuffer);
+    TrackResidency(bufferD3D.GetNative());
+    TrackResidency(countBufferD3D.GetNative());
+    commandContext_.FlushResourceBarrieres();
+    commandList_->ExecuteIndirect(
+        commandSignaturePool_->GetSignatureDrawIndexedIndirect(stride), maxNumCommands,
+        bufferD3D.GetNative(), offset, countBufferD3D.GetNative(), countOffset
+    );
+}
+
+void D3D12CommandBuffer::DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands)
+{
+    /* Record all draw commands with a tight loop to amortize the per-call overhead */
+    commandContext_.FlushResourceBarrieres();
+    for (std::uint32_t i = 0; i < numCommands; ++i)
+    {
+        const auto& args = commands[i];
+        commandList_->DrawInstanced(args.numVertices, args.numInstances, args.firstVertex, args.firstInstance);
+    }
+}
+
+void D3D12CommandBuffer::DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands)
+{
+    commandContext_.FlushResourceBarrieres();
+    for (std::uint32_t i = 0; i < numCommands; ++i)
+    {
+        const auto& args = commands[i];
+        commandList_->DrawIndexedInstanced(args.numIndices, args.numInstances, args.firstIndex, args.vertexOffset, args.firstInstance);
+    }
+}
+
 /* ----- Compute ----- */
 
 void D3D12CommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
+    commandContext_.FlushResourceBarrieres();
     commandList_->Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
 }
 
 void D3D12CommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    TrackResidency(bufferD3D.GetNative());
+    commandContext_.FlushResourceBarrieres();
     commandList_->ExecuteIndirect(
         commandSignaturePool_->GetSignatureDispatchIndirect(), 1, bufferD3D.GetNative(), offset, nullptr, 0
     );
@@ -660,6 +860,10 @@ static D3D12_COMMAND_LIST_TYPE GetD3DCommandListType(const CommandBufferDescript
 {
     if ((desc.flags & CommandBufferFlags::DeferredSubmit) != 0)
         return D3D12_COMMAND_LIST_TYPE_BUNDLE;
+    else if ((desc.flags & CommandBufferFlags::ComputeOnly) != 0)
+        return D3D12_COMMAND_LIST_TYPE_COMPUTE;
+    else if ((desc.flags & CommandBufferFlags::TransferOnly) != 0)
+        return D3D12_COMMAND_LIST_TYPE_COPY;
     else
         return D3D12_COMMAND_LIST_TYPE_DIRECT;
 }
@@ -673,6 +877,7 @@ void D3D12CommandBuffer::CreateDevices(D3D12RenderSystem& renderSystem, const Co
 
     /* Create command allocators */
     auto listType = GetD3DCommandListType(desc);
+    isBundle_ = (listType == D3D12_COMMAND_LIST_TYPE_BUNDLE);
 
     for (std::uint32_t i = 0; i < numAllocators_; ++i)
     {
@@ -702,6 +907,30 @@ void D3D12CommandBuffer::NextCommandAllocator()
     DXThrowIfFailed(hr, "failed to reset D3D12 command allocator");
 }
 
+D3D12_RESOURCE_STATES D3D12CommandBuffer::TransitionForCopy(D3D12Resource& resource, D3D12_RESOURCE_STATES copyState)
+{
+    const auto oldState = resource.transitionState;
+
+    if (insideCopyBatch_ && oldState != copyState)
+    {
+        /* Remember restore state on first use within the batch; consecutive copies reuse the transitioned state */
+        auto it = std::find_if(
+            copyBatchRestoreStates_.begin(),
+            copyBatchRestoreStates_.end(),
+            [&resource](const std::pair<D3D12Resource*, D3D12_RESOURCE_STATES>& entry)
+            {
+                return (entry.first == &resource);
+            }
+        );
+        if (it == copyBatchRestoreStates_.end())
+            copyBatchRestoreStates_.push_back({ &resource, oldState });
+    }
+
+    commandContext_.TransitionResource(resource, copyState);
+
+    return oldState;
+}
+
 void D3D12CommandBuffer::SetScissorRectsToDefault(UINT numScissorRects)
 {
     numScissorRects = std::min(numScissorRects, UINT(D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE));
@@ -726,16 +955,16 @@ void D3D12CommandBuffer::SetScissorRectsToDefault(UINT numScissorRects)
     }
 }
 
-void D3D12CommandBuffer::BindRenderTarget(D3D12RenderTarget& renderTargetD3D)
+void D3D12CommandBuffer::BindRenderTarget(D3D12RenderTarget& renderTargetD3D, bool readOnlyDepthStencil)
 {
     /* Transition resources to state ready for output merger */
-    renderTargetD3D.TransitionToOutputMerger(commandContext_);
+    renderTargetD3D.TransitionToOutputMerger(commandContext_, readOnlyDepthStencil);
 
     /* Set current back buffer as RTV and optional DSV */
     const UINT numRenderTargets = renderTargetD3D.GetNumColorAttachments();
 
     rtvDescHandle_ = renderTargetD3D.GetCPUDescriptorHandleForRTV();
-    dsvDescHandle_ = renderTargetD3D.GetCPUDescriptorHandleForDSV();
+    dsvDescHandle_ = renderTargetD3D.GetCPUDescriptorHandleForDSV(readOnlyDepthStencil);
 
     if (dsvDescHandle_.ptr != 0)
         commandList_->OMSetRenderTargets(numRenderTargets, &rtvDescHandle_, TRUE, &dsvDescHandle_);
@@ -13,11 +13,14 @@
 #include <cstddef>
 #include "D3D12CommandContext.h"
 #include "../Buffer/D3D12StagingBufferPool.h"
+#include "../RenderState/D3D12DescriptorHeapPool.h"
 #include "../../DXCommon/ComPtr.h"
 #include "../../DXCommon/DXCore.h"
 
 #include <d3d12.h>
 #include <dxgi1_4.h>
+#include <vector>
+#include <utility>
 
 
 namespace LLGL
@@ -29,6 +32,7 @@ class D3D12RenderContext;
 class D3D12RenderTarget;
 class D3D12RenderPass;
 class D3D12CommandSignaturePool;
+class D3D12ResidencyManager;
 struct D3D12Resource;
 
 class D3D12CommandBuffer final : public CommandBuffer
@@ -74,6 +78,9 @@ class D3D12CommandBuffer final : public CommandBuffer
             const Extent3D&         extent
         ) override;
 
+        void BeginCopyBatch() override;
+        void EndCopyBatch() override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, const TextureSubresource& subresource) override;
 
@@ -125,6 +132,9 @@ class D3D12CommandBuffer final : public CommandBuffer
             long                stageFlags      = StageFlags::AllStages
         ) override;
 
+        void BeginResourceTransition(Resource& resource, long bindFlags) override;
+        void EndResourceTransition(Resource& resource, long bindFlags) override;
+
         /* ----- Render Passes ----- */
 
         void BeginRenderPass(
@@ -178,9 +188,14 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         void DrawIndirect(Buffer& buffer, std::uint64_t offset) override;
         void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
 
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands) override;
+        void DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands) override;
 
         /* ----- Compute ----- */
 
@@ -206,6 +221,36 @@ class D3D12CommandBuffer final : public CommandBuffer
             return commandList_.Get();
         }
 
+        // Returns true if this command buffer is recorded as D3D12 bundle (i.e. replayed via ExecuteBundle).
+        inline bool IsBundle() const
+        {
+            return isBundle_;
+        }
+
+        // Returns the staging buffer pool of this command buffer, e.g. to retire its upload ring frames on submission.
+        inline D3D12StagingBufferPool& GetStagingBufferPool()
+        {
+            return stagingBufferPool_;
+        }
+
+        // Returns the descriptor heap pool of this command buffer, e.g. to retire its ring frames on submission.
+        inline D3D12DescriptorHeapPool& GetDescriptorHeapPool()
+        {
+            return descriptorHeapPool_;
+        }
+
+        // Returns the residency manager of the render system this command buffer was created with.
+        inline D3D12ResidencyManager& GetResidencyManager()
+        {
+            return *residencyManager_;
+        }
+
+        // Returns the resources referenced by this command buffer; resolved by the residency manager on submission.
+        inline const std::vector<ID3D12Pageable*>& GetResidencySet() const
+        {
+            return residencySet_;
+        }
+
     private:
 
         void CreateDevices(D3D12RenderSystem& renderSystem, const CommandBufferDescriptor& desc);
@@ -214,7 +259,7 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         void SetScissorRectsToDefault(UINT numScissorRects);
 
-        void BindRenderTarget(D3D12RenderTarget& renderTargetD3D);
+        void BindRenderTarget(D3D12RenderTarget& renderTargetD3D, bool readOnlyDepthStencil);
         void BindRenderContext(D3D12RenderContext& renderContextD3D);
 
         void ClearAttachmentsWithRenderPass(
@@ -235,6 +280,19 @@ class D3D12CommandBuffer final : public CommandBuffer
             return cmdAllocators_[currentAllocator_].Get();
         }
 
+        // Adds the specified resource to the residency set of this command buffer.
+        inline void TrackResidency(ID3D12Pageable* pageable)
+        {
+            residencySet_.push_back(pageable);
+        }
+
+        /*
+        Transitions the specified resource into the copy state and returns its previous transition state.
+        Inside a copy batch, the restore transition is deferred until EndCopyBatch and hoisted into a single barrier batch;
+        otherwise the caller must restore the returned state after the copy command.
+        */
+        D3D12_RESOURCE_STATES TransitionForCopy(D3D12Resource& resource, D3D12_RESOURCE_STATES copyState);
+
     private:
 
         static const std::uint32_t g_maxNumAllocators = 3;
@@ -248,6 +306,10 @@ class D3D12CommandBuffer final : public CommandBuffer
         const D3D12CommandSignaturePool*    commandSignaturePool_               = nullptr;
 
         D3D12StagingBufferPool              stagingBufferPool_;
+        D3D12DescriptorHeapPool             descriptorHeapPool_;
+
+        D3D12ResidencyManager*              residencyManager_                   = nullptr;
+        std::vector<ID3D12Pageable*>        residencySet_;
 
         D3D12_CPU_DESCRIPTOR_HANDLE         rtvDescHandle_                      = {};
         UINT                                rtvDescSize_                        = 0;
@@ -256,11 +318,20 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         ClearValue                          clearValue_;
 
+        bool                                isBundle_                           = false;
         bool                                scissorEnabled_                     = false;
         UINT                                numBoundScissorRects_               = 0;
 
+        UINT                                rootConstantsIndex_                 = ~0u;
+        UINT                                numRootConstants_                   = 0;
+        bool                                rootConstantsForGraphics_           = false;
+
         RenderTarget*                       boundRenderTarget_                  = nullptr;
 
+        // Resources transitioned for a copy batch with their states to restore at EndCopyBatch
+        bool                                insideCopyBatch_                    = false;
+        std::vector<std::pair<D3D12Resource*, D3D12_RESOURCE_STATES>> copyBatchRestoreStates_;
+
 };
 
 
@@ -58,23 +58,74 @@ void D3D12CommandContext::TransitionResource(D3D12Resource& resource, D3D12_RESO
 {
     auto oldState = resource.transitionState;
     if (oldState != newState)
+    {
+        if (auto pendingBarrier = FindPendingTransitionBarrier(resource.native.Get()))
+        {
+            /* Merge with the pending transition barrier of this resource; drop it entirely if the transition became a no-op */
+            if (pendingBarrier->Transition.StateBefore == newState)
+                RemovePendingBarrier(pendingBarrier);
+            else
+                pendingBarrier->Transition.StateAfter = newState;
+        }
+        else
+        {
+            auto& barrier = NextResourceBarrier();
+
+            /* Initialize resource barrier for resource transition */
+            barrier.Type                    = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+            barrier.Flags                   = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+            barrier.Transition.pResource    = resource.native.Get();
+            barrier.Transition.Subresource  = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+            barrier.Transition.StateBefore  = oldState;
+            barrier.Transition.StateAfter   = newState;
+        }
+
+        /* Store new state in resource */
+        resource.transitionState = newState;
+    }
+
+    /* Flush resource barrieres if required, e.g. when a copy command depends on them */
+    if (flushImmediate)
+        FlushResourceBarrieres();
+}
+
+void D3D12CommandContext::TransitionResourceBegin(D3D12Resource& resource, D3D12_RESOURCE_STATES newState)
+{
+    if (resource.transitionState != newState)
     {
         auto& barrier = NextResourceBarrier();
 
-        /* Initialize resource barrier for resource transition */
+        /* Initialize begin-only barrier for split resource transition; the transition state is updated at the end-only barrier */
         barrier.Type                    = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-        barrier.Flags                   = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+        barrier.Flags                   = D3D12_RESOURCE_BARRIER_FLAG_BEGIN_ONLY;
         barrier.Transition.pResource    = resource.native.Get();
         barrier.Transition.Subresource  = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-        barrier.Transition.StateBefore  = oldState;
+        barrier.Transition.StateBefore  = resource.transitionState;
+        barrier.Transition.StateAfter   = newState;
+
+        /* Flush immediately so the begin-only barrier cannot be merged with later transitions of this resource */
+        FlushResourceBarrieres();
+    }
+}
+
+void D3D12CommandContext::TransitionResourceEnd(D3D12Resource& resource, D3D12_RESOURCE_STATES newState)
+{
+    if (resource.transitionState != newState)
+    {
+        auto& barrier = NextResourceBarrier();
+
+        /* Initialize end-only barrier to complete the split resource transition */
+        barrier.Type                    = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+        barrier.Flags                   = D3D12_RESOURCE_BARRIER_FLAG_END_ONLY;
+        barrier.Transition.pResource    = resource.native.Get();
+        barrier.Transition.Subresource  = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+        barrier.Transition.StateBefore  = resource.transitionState;
         barrier.Transition.StateAfter   = newState;
 
         /* Store new state in resource */
         resource.transitionState = newState;
 
-        /* Flush resource barrieres if required */
-        if (flushImmediate)
-            FlushResourceBarrieres();
+        FlushResourceBarrieres();
     }
 }
 
@@ -179,6 +230,25 @@ D3D12_RESOURCE_BARRIER& D3D12CommandContext::NextResourceBarrier()
     return resourceBarriers_[numResourceBarriers_++];
 }
 
+D3D12_RESOURCE_BARRIER* D3D12CommandContext::FindPendingTransitionBarrier(ID3D12Resource* resource)
+{
+    for (UINT i = 0; i < numResourceBarriers_; ++i)
+    {
+        auto& barrier = resourceBarriers_[i];
+        if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION && barrier.Transition.pResource == resource)
+            return &barrier;
+    }
+    return nullptr;
+}
+
+void D3D12CommandContext::RemovePendingBarrier(D3D12_RESOURCE_BARRIER* barrier)
+{
+    /* Move the last pending barrier into the vacant slot; the barriers of a single flush are applied as an unordered set */
+    --numResourceBarriers_;
+    if (barrier != &(resourceBarriers_[numResourceBarriers_]))
+        *barrier = resourceBarriers_[numResourceBarriers_];
+}
+
 void D3D12CommandContext::ClearCache()
 {
     stateCache_.dirtyBits.value = ~0u;
@@ -55,6 +55,8 @@ class D3D12CommandContext
         }
 
         void TransitionResource(D3D12Resource& resource, D3D12_RESOURCE_STATES newState, bool flushImmediate = false);
+        void TransitionResourceBegin(D3D12Resource& resource, D3D12_RESOURCE_STATES newState);
+        void TransitionResourceEnd(D3D12Resource& resource, D3D12_RESOURCE_STATES newState);
         void InsertUAVBarrier(D3D12Resource& resource, bool flushImmediate = false);
         void FlushResourceBarrieres();
 
@@ -98,6 +100,12 @@ class D3D12CommandContext
 
         D3D12_RESOURCE_BARRIER& NextResourceBarrier();
 
+        // Returns the pending (i.e. not yet flushed) transition barrier for the specified resource, or null if there is none.
+        D3D12_RESOURCE_BARRIER* FindPendingTransitionBarrier(ID3D12Resource* resource);
+
+        // Removes the specified pending barrier from the batch.
+        void RemovePendingBarrier(D3D12_RESOURCE_BARRIER* barrier);
+
         void ClearCache();
 
     private:
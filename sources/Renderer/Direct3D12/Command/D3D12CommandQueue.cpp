@@ -13,6 +13,7 @@
 #include "../RenderState/D3D12QueryHeap.h"
 #include "../../CheckedCast.h"
 #include "../../DXCommon/DXCore.h"
+#include <vector>
 
 
 namespace LLGL
@@ -34,10 +35,58 @@ void D3D12CommandQueue::SetName(const char* name)
 
 void D3D12CommandQueue::Submit(CommandBuffer& commandBuffer)
 {
-    /* Execute command list */
     auto& commandBufferD3D = LLGL_CAST(D3D12CommandBuffer&, commandBuffer);
-    ID3D12CommandList* cmdLists[] = { commandBufferD3D.GetNative() };
-    native_->ExecuteCommandLists(1, cmdLists);
+
+    /* Bundles cannot be submitted to a command queue; they are replayed via ExecuteBundle from a primary command buffer */
+    if (!commandBufferD3D.IsBundle())
+    {
+        /* Stamp last use of all referenced resources and page evicted ones back in before execution */
+        commandBufferD3D.GetResidencyManager().SubmitResidencySet(native_, commandBufferD3D.GetResidencySet());
+
+        /* Execute command list */
+        ID3D12CommandList* cmdLists[] = { commandBufferD3D.GetNative() };
+        native_->ExecuteCommandLists(1, cmdLists);
+
+        /* Retire the upload ring and descriptor ring space this submission has written */
+        commandBufferD3D.GetStagingBufferPool().SignalFrame(native_);
+        commandBufferD3D.GetDescriptorHeapPool().SignalFrame(native_);
+    }
+}
+
+void D3D12CommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Gather native command lists; bundles cannot be submitted to a command queue */
+    std::vector<D3D12CommandBuffer*> commandBuffersD3D;
+    std::vector<ID3D12CommandList*> cmdLists;
+    commandBuffersD3D.reserve(numCommandBuffers);
+    cmdLists.reserve(numCommandBuffers);
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferD3D = LLGL_CAST(D3D12CommandBuffer*, commandBuffers[i]);
+        if (!commandBufferD3D->IsBundle())
+        {
+            commandBuffersD3D.push_back(commandBufferD3D);
+            cmdLists.push_back(commandBufferD3D->GetNative());
+        }
+    }
+
+    if (cmdLists.empty())
+        return;
+
+    /* Stamp last use of all referenced resources and page evicted ones back in before execution */
+    for (auto commandBufferD3D : commandBuffersD3D)
+        commandBufferD3D->GetResidencyManager().SubmitResidencySet(native_, commandBufferD3D->GetResidencySet());
+
+    /* Execute all command lists in a single call */
+    native_->ExecuteCommandLists(static_cast<UINT>(cmdLists.size()), cmdLists.data());
+
+    /* Retire the upload ring and descriptor ring space these submissions have written */
+    for (auto commandBufferD3D : commandBuffersD3D)
+    {
+        commandBufferD3D->GetStagingBufferPool().SignalFrame(native_);
+        commandBufferD3D->GetDescriptorHeapPool().SignalFrame(native_);
+    }
 }
 
 /* ----- Queries ----- */
@@ -92,12 +141,85 @@ void D3D12CommandQueue::Submit(Fence& fence)
     DXThrowIfFailed(hr, "failed to signal D3D12 fence with command queue");
 }
 
+void D3D12CommandQueue::Wait(Fence& fence)
+{
+    /* Schedule GPU-side wait for the last signal of the fence; used to synchronize with the compute queue */
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    auto hr = native_->Wait(fenceD3D.GetNative(), fenceD3D.GetValue());
+    DXThrowIfFailed(hr, "failed to let D3D12 command queue wait for fence");
+}
+
 bool D3D12CommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
     auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
     return fenceD3D.Wait(timeout);
 }
 
+// Converts the specified amount of nanoseconds into milliseconds (rounded up)
+static DWORD NanosecsToMillisecs(std::uint64_t t)
+{
+    if (t == ~0ull)
+        return INFINITE;
+    else
+        return static_cast<DWORD>((t + 999999) / 1000000);
+}
+
+bool D3D12CommandQueue::WaitFences(std::uint32_t numFences, Fence* const * fences, bool waitAll, std::uint64_t timeout)
+{
+    if (numFences == 0 || fences == nullptr)
+        return false;
+
+    /* Win32 cannot wait for more than MAXIMUM_WAIT_OBJECTS events at once; defer to the generic emulation */
+    if (numFences > MAXIMUM_WAIT_OBJECTS)
+        return CommandQueue::WaitFences(numFences, fences, waitAll, timeout);
+
+    /* Register completion events for all fences that are still pending */
+    HANDLE events[MAXIMUM_WAIT_OBJECTS];
+    DWORD numEvents = 0;
+
+    for (std::uint32_t i = 0; i < numFences; ++i)
+    {
+        auto fenceD3D = LLGL_CAST(D3D12Fence*, fences[i]);
+        if (auto event = fenceD3D->ScheduleCompletionEvent())
+            events[numEvents++] = event;
+        else if (!waitAll)
+            return true;
+    }
+
+    if (numEvents == 0)
+        return true;
+
+    auto result = WaitForMultipleObjects(numEvents, events, (waitAll ? TRUE : FALSE), NanosecsToMillisecs(timeout));
+    return (result >= WAIT_OBJECT_0 && result < WAIT_OBJECT_0 + numEvents);
+}
+
+bool D3D12CommandQueue::IsSignaled(Fence& fence)
+{
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    return (fenceD3D.GetCompletedValue() >= fenceD3D.GetValue());
+}
+
+void D3D12CommandQueue::Signal(Fence& fence, std::uint64_t value)
+{
+    /* Schedule signal command with the explicit timeline value; ID3D12Fence supports timeline values natively */
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    auto hr = native_->Signal(fenceD3D.GetNative(), value);
+    DXThrowIfFailed(hr, "failed to signal D3D12 fence with command queue");
+    fenceD3D.UpdateValue(value);
+}
+
+bool D3D12CommandQueue::WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout)
+{
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    return fenceD3D.WaitValue(value, timeout);
+}
+
+std::uint64_t D3D12CommandQueue::GetFenceValue(Fence& fence)
+{
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    return fenceD3D.GetCompletedValue();
+}
+
 void D3D12CommandQueue::WaitIdle()
 {
     /* Submit intermediate fence and wait for it to be signaled */
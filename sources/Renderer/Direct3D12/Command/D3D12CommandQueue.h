@@ -35,6 +35,7 @@ class D3D12CommandQueue final : public CommandQueue
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
 
         /* ----- Queries ----- */
 
@@ -49,8 +50,16 @@ class D3D12CommandQueue final : public CommandQueue
         /* ----- Fences ----- */
 
         void Submit(Fence& fence) override;
+        void Wait(Fence& fence) override;
 
         bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+        bool WaitFences(std::uint32_t numFences, Fence* const * fences, bool waitAll, std::uint64_t timeout) override;
+        bool IsSignaled(Fence& fence) override;
+
+        void Signal(Fence& fence, std::uint64_t value) override;
+        bool WaitFenceValue(Fence& fence, std::uint64_t value, std::uint64_t timeout) override;
+        std::uint64_t GetFenceValue(Fence& fence) override;
+
         void WaitIdle() override;
 
         /* ----- Extended functions ----- */
@@ -33,11 +33,56 @@ static void DXCreateCommandSignature(ID3D12Device* device, ComPtr<ID3D12CommandS
 
 void D3D12CommandSignaturePool::CreateDefaultSignatures(ID3D12Device* device)
 {
+    device_ = device;
     DXCreateCommandSignature(device, signatureDrawIndirect_,        D3D12_INDIRECT_ARGUMENT_TYPE_DRAW,         sizeof(D3D12_DRAW_ARGUMENTS        ));
     DXCreateCommandSignature(device, signatureDrawIndexedIndirect_, D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, sizeof(D3D12_DRAW_INDEXED_ARGUMENTS));
     DXCreateCommandSignature(device, signatureDispatchIndirect_,    D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH,     sizeof(D3D12_DISPATCH_ARGUMENTS    ));
 }
 
+ID3D12CommandSignature* D3D12CommandSignaturePool::GetSignatureDrawIndirect(UINT stride) const
+{
+    if (stride == sizeof(D3D12_DRAW_ARGUMENTS))
+        return GetSignatureDrawIndirect();
+    else
+        return GetOrCreateStridedSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW, stride);
+}
+
+ID3D12CommandSignature* D3D12CommandSignaturePool::GetSignatureDrawIndexedIndirect(UINT stride) const
+{
+    if (stride == sizeof(D3D12_DRAW_INDEXED_ARGUMENTS))
+        return GetSignatureDrawIndexedIndirect();
+    else
+        return GetOrCreateStridedSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, stride);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+ID3D12CommandSignature* D3D12CommandSignaturePool::GetOrCreateStridedSignature(D3D12_INDIRECT_ARGUMENT_TYPE argumentType, UINT stride) const
+{
+    /* Lock cache access; command buffers may be recorded by multiple threads */
+    std::lock_guard<std::mutex> guard { stridedSignaturesMutex_ };
+
+    for (const auto& entry : stridedSignatures_)
+    {
+        if (entry.argumentType == argumentType && entry.stride == stride)
+            return entry.signature.Get();
+    }
+
+    /* Create new command signature with the specified stride and cache it */
+    StridedSignature entry;
+    {
+        entry.argumentType  = argumentType;
+        entry.stride        = stride;
+        DXCreateCommandSignature(device_, entry.signature, argumentType, stride);
+    }
+    stridedSignatures_.push_back(entry);
+
+    return stridedSignatures_.back().signature.Get();
+}
+
 
 } // /namespace LLGL
 
@@ -11,6 +11,8 @@
 
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
+#include <mutex>
+#include <vector>
 
 
 namespace LLGL
@@ -39,11 +41,36 @@ class D3D12CommandSignaturePool
             return signatureDispatchIndirect_.Get();
         }
 
+        // Returns a draw signature with the specified byte stride; creates and caches it on demand.
+        ID3D12CommandSignature* GetSignatureDrawIndirect(UINT stride) const;
+
+        // Returns an indexed draw signature with the specified byte stride; creates and caches it on demand.
+        ID3D12CommandSignature* GetSignatureDrawIndexedIndirect(UINT stride) const;
+
+    private:
+
+        // Command signature with a non-default byte stride, e.g. for indirect draws with interleaved argument data.
+        struct StridedSignature
+        {
+            D3D12_INDIRECT_ARGUMENT_TYPE    argumentType;
+            UINT                            stride;
+            ComPtr<ID3D12CommandSignature>  signature;
+        };
+
     private:
 
-        ComPtr<ID3D12CommandSignature> signatureDrawIndirect_;
-        ComPtr<ID3D12CommandSignature> signatureDrawIndexedIndirect_;
-        ComPtr<ID3D12CommandSignature> signatureDispatchIndirect_;
+        ID3D12CommandSignature* GetOrCreateStridedSignature(D3D12_INDIRECT_ARGUMENT_TYPE argumentType, UINT stride) const;
+
+    private:
+
+        ID3D12Device*                           device_ = nullptr;
+
+        ComPtr<ID3D12CommandSignature>          signatureDrawIndirect_;
+        ComPtr<ID3D12CommandSignature>          signatureDrawIndexedIndirect_;
+        ComPtr<ID3D12CommandSignature>          signatureDispatchIndirect_;
+
+        mutable std::vector<StridedSignature>   stridedSignatures_;
+        mutable std::mutex                      stridedSignaturesMutex_;
 
 };
 
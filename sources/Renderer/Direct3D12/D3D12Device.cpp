@@ -32,14 +32,14 @@ bool D3D12Device::CreateDXDevice(HRESULT& hr, IDXGIAdapter* adapter, const std::
     return false;
 }
 
-ComPtr<ID3D12CommandQueue> D3D12Device::CreateDXCommandQueue()
+ComPtr<ID3D12CommandQueue> D3D12Device::CreateDXCommandQueue(D3D12_COMMAND_LIST_TYPE type)
 {
     ComPtr<ID3D12CommandQueue> cmdQueue;
 
     D3D12_COMMAND_QUEUE_DESC queueDesc = {};
     {
         queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
-        queueDesc.Type  = D3D12_COMMAND_LIST_TYPE_DIRECT;
+        queueDesc.Type  = type;
     }
     auto hr = device_->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(cmdQueue.ReleaseAndGetAddressOf()));
     DXThrowIfCreateFailed(hr, "ID3D12CommandQueue");
@@ -0,0 +1,198 @@
+/*
+ * D3D12HeapPool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "D3D12HeapPool.h"
+#include "../DXCommon/DXCore.h"
+#include "../../Core/Helper.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Size of each pooled heap chunk (64 MB)
+static const UINT64 g_heapChunkSize         = 64ull * 1024 * 1024;
+
+// Resources larger than this are created as committed resources instead (half the chunk size, to bound fragmentation)
+static const UINT64 g_maxPlacedResourceSize = g_heapChunkSize / 2;
+
+void D3D12HeapPool::InitializeDevice(ID3D12Device* device)
+{
+    device_ = device;
+}
+
+D3D12HeapRegion D3D12HeapPool::Allocate(const D3D12_RESOURCE_DESC& resourceDesc, const D3D12_RESOURCE_ALLOCATION_INFO& allocInfo)
+{
+    if (device_ == nullptr)
+        return {};
+
+    /* Reject allocations that do not fit the pool: over-sized or multi-sampled (requires 4MB placement alignment) */
+    if (allocInfo.SizeInBytes > g_maxPlacedResourceSize ||
+        allocInfo.Alignment   > D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT)
+    {
+        return {};
+    }
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Pick heap category: resource heap tier 1 requires RT/DS textures to be separated from all other textures */
+    if ((resourceDesc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0)
+        return AllocateFromHeaps(heapsRtDs_, D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES, allocInfo.SizeInBytes, allocInfo.Alignment);
+    else
+        return AllocateFromHeaps(heapsNonRtDs_, D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES, allocInfo.SizeInBytes, allocInfo.Alignment);
+}
+
+void D3D12HeapPool::Release(const D3D12HeapRegion& region)
+{
+    if (region.heap == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    for (auto heaps : { &heapsNonRtDs_, &heapsRtDs_ })
+    {
+        for (auto it = heaps->begin(); it != heaps->end(); ++it)
+        {
+            if (it->native.Get() != region.heap)
+                continue;
+
+            /* Insert free region sorted by offset */
+            auto& freeRegions = it->freeRegions;
+
+            auto pos = std::lower_bound(
+                freeRegions.begin(), freeRegions.end(), region.offset,
+                [](const FreeRegion& lhs, UINT64 offset)
+                {
+                    return (lhs.offset < offset);
+                }
+            );
+            pos = freeRegions.insert(pos, { region.offset, region.size });
+
+            /* Merge with successor */
+            auto next = pos + 1;
+            if (next != freeRegions.end() && pos->offset + pos->size == next->offset)
+            {
+                pos->size += next->size;
+                freeRegions.erase(next);
+            }
+
+            /* Merge with predecessor */
+            if (pos != freeRegions.begin())
+            {
+                auto prev = pos - 1;
+                if (prev->offset + prev->size == pos->offset)
+                {
+                    prev->size += pos->size;
+                    freeRegions.erase(pos);
+                }
+            }
+
+            /* Release heap chunk if it became entirely free and is not the last one of its category */
+            if (heaps->size() > 1 &&
+                it->freeRegions.size() == 1 &&
+                it->freeRegions.front().size == it->size)
+            {
+                heaps->erase(it);
+            }
+
+            return;
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+D3D12HeapRegion D3D12HeapPool::AllocateFromHeaps(std::vector<Heap>& heaps, D3D12_HEAP_FLAGS heapFlags, UINT64 size, UINT64 alignment)
+{
+    /* First-fit search over all pooled heaps of this category */
+    D3D12HeapRegion region;
+
+    for (auto& heap : heaps)
+    {
+        if (AllocateFromHeap(heap, size, alignment, region))
+            return region;
+    }
+
+    /* No free region fits; create a new heap chunk */
+    auto& heap = AppendHeapChunk(heaps, heapFlags, size);
+    AllocateFromHeap(heap, size, alignment, region);
+
+    return region;
+}
+
+bool D3D12HeapPool::AllocateFromHeap(Heap& heap, UINT64 size, UINT64 alignment, D3D12HeapRegion& outRegion)
+{
+    for (auto it = heap.freeRegions.begin(); it != heap.freeRegions.end(); ++it)
+    {
+        const UINT64 alignedOffset = GetAlignedSize(it->offset, alignment);
+        if (alignedOffset + size > it->offset + it->size)
+            continue;
+
+        /* Carve allocation out of this free region */
+        outRegion.heap      = heap.native.Get();
+        outRegion.offset    = alignedOffset;
+        outRegion.size      = size;
+
+        const UINT64 frontPadding   = alignedOffset - it->offset;
+        const UINT64 tailSize       = (it->offset + it->size) - (alignedOffset + size);
+
+        if (frontPadding > 0)
+        {
+            /* Keep alignment padding as small free region in front, and insert tail region behind (if any) */
+            it->size = frontPadding;
+            if (tailSize > 0)
+                heap.freeRegions.insert(it + 1, { alignedOffset + size, tailSize });
+        }
+        else if (tailSize > 0)
+        {
+            /* Shrink free region to its tail */
+            it->offset  = alignedOffset + size;
+            it->size    = tailSize;
+        }
+        else
+            heap.freeRegions.erase(it);
+
+        return true;
+    }
+    return false;
+}
+
+D3D12HeapPool::Heap& D3D12HeapPool::AppendHeapChunk(std::vector<Heap>& heaps, D3D12_HEAP_FLAGS heapFlags, UINT64 minSize)
+{
+    Heap heap;
+    heap.size = std::max(g_heapChunkSize, minSize);
+
+    D3D12_HEAP_DESC heapDesc;
+    {
+        heapDesc.SizeInBytes                        = heap.size;
+        heapDesc.Properties.Type                    = D3D12_HEAP_TYPE_DEFAULT;
+        heapDesc.Properties.CPUPageProperty         = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+        heapDesc.Properties.MemoryPoolPreference    = D3D12_MEMORY_POOL_UNKNOWN;
+        heapDesc.Properties.CreationNodeMask        = 0;
+        heapDesc.Properties.VisibleNodeMask         = 0;
+        heapDesc.Alignment                          = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        heapDesc.Flags                              = heapFlags;
+    }
+    auto hr = device_->CreateHeap(&heapDesc, IID_PPV_ARGS(heap.native.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12Heap", "for placed texture resources");
+
+    heap.freeRegions.push_back({ 0, heap.size });
+
+    heaps.push_back(std::move(heap));
+    return heaps.back();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,107 @@
+/*
+ * D3D12HeapPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_D3D12_HEAP_POOL_H
+#define LLGL_D3D12_HEAP_POOL_H
+
+
+#include "../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+// Region within a pooled ID3D12Heap; a region with a null heap denotes a committed resource.
+struct D3D12HeapRegion
+{
+    ID3D12Heap* heap    = nullptr;
+    UINT64      offset  = 0;
+    UINT64      size    = 0;
+};
+
+/*
+Pool of ID3D12Heap objects to create textures as placed resources.
+Creating a committed resource implies a heap allocation and therefore a kernel call,
+which shows up as frame spikes when many textures are created per second (e.g. for texture streaming).
+This pool sub-allocates regions from large pre-created heaps with a free list per heap,
+so most texture creations reduce to CreatePlacedResource without any new allocation.
+Heaps are separated by category (non-RT/DS versus RT/DS textures),
+which satisfies the restrictions of D3D12_RESOURCE_HEAP_TIER_1 and is also valid on tier 2.
+*/
+class D3D12HeapPool
+{
+
+    public:
+
+        D3D12HeapPool() = default;
+
+        D3D12HeapPool(const D3D12HeapPool&) = delete;
+        D3D12HeapPool& operator = (const D3D12HeapPool&) = delete;
+
+        // Initializes the device object to create heaps with.
+        void InitializeDevice(ID3D12Device* device);
+
+        /*
+        Tries to sub-allocate a heap region for a placed resource with the specified allocation requirements.
+        Returns a region with a null heap if the allocation does not fit into the pool
+        (e.g. too large or multi-sampled); the caller must then create a committed resource.
+        */
+        D3D12HeapRegion Allocate(const D3D12_RESOURCE_DESC& resourceDesc, const D3D12_RESOURCE_ALLOCATION_INFO& allocInfo);
+
+        // Returns the specified region to its heap's free list; must not be called before the placed resource was released.
+        void Release(const D3D12HeapRegion& region);
+
+    private:
+
+        struct FreeRegion
+        {
+            UINT64 offset;
+            UINT64 size;
+        };
+
+        struct Heap
+        {
+            ComPtr<ID3D12Heap>      native;
+            UINT64                  size;
+            std::vector<FreeRegion> freeRegions;    // sorted by offset; adjacent regions are merged on release
+        };
+
+    private:
+
+        // Tries to sub-allocate from the specified heap list, and creates a new heap chunk if no free region fits.
+        D3D12HeapRegion AllocateFromHeaps(std::vector<Heap>& heaps, D3D12_HEAP_FLAGS heapFlags, UINT64 size, UINT64 alignment);
+
+        // Tries to sub-allocate from the free regions of the specified heap.
+        bool AllocateFromHeap(Heap& heap, UINT64 size, UINT64 alignment, D3D12HeapRegion& outRegion);
+
+        // Appends a new heap chunk that is large enough for the specified allocation.
+        Heap& AppendHeapChunk(std::vector<Heap>& heaps, D3D12_HEAP_FLAGS heapFlags, UINT64 minSize);
+
+    private:
+
+        ID3D12Device*       device_         = nullptr;
+
+        std::vector<Heap>   heapsNonRtDs_;  // heaps for non-RT/DS textures
+        std::vector<Heap>   heapsRtDs_;     // heaps for RT/DS textures
+
+        std::mutex          mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,20 +6,83 @@
  */
 
 #include "D3D12ObjectUtils.h"
-#include <string>
+#include "../../Core/SmallVector.h"
+#include <cstdio>
 #include <cstring>
-#include <codecvt>
 
 
 namespace LLGL
 {
 
 
+// Decodes the specified UTF-8 string into UTF-16 and appends it to the output buffer (invalid sequences are skipped).
+static void ConvertUTF8toUTF16(SmallVector<wchar_t, 128>& dst, const char* src)
+{
+    const auto* s = reinterpret_cast<const unsigned char*>(src);
+    while (*s != 0)
+    {
+        /* Determine sequence length and initial code point bits */
+        std::uint32_t code = 0;
+        int len = 0;
+
+        if (s[0] < 0x80)
+        {
+            code = s[0];
+            len = 1;
+        }
+        else if ((s[0] & 0xE0) == 0xC0)
+        {
+            code = (s[0] & 0x1F);
+            len = 2;
+        }
+        else if ((s[0] & 0xF0) == 0xE0)
+        {
+            code = (s[0] & 0x0F);
+            len = 3;
+        }
+        else if ((s[0] & 0xF8) == 0xF0)
+        {
+            code = (s[0] & 0x07);
+            len = 4;
+        }
+        else
+        {
+            ++s;
+            continue;
+        }
+
+        /* Accumulate continuation bytes */
+        int i = 1;
+        for (; i < len; ++i)
+        {
+            if ((s[i] & 0xC0) != 0x80)
+                break;
+            code = (code << 6) | (s[i] & 0x3F);
+        }
+        s += i;
+
+        if (i != len)
+            continue;
+
+        /* Encode code point as UTF-16 */
+        if (code < 0x10000)
+            dst.push_back(static_cast<wchar_t>(code));
+        else
+        {
+            code -= 0x10000;
+            dst.push_back(static_cast<wchar_t>(0xD800 + (code >> 10)));
+            dst.push_back(static_cast<wchar_t>(0xDC00 + (code & 0x3FF)));
+        }
+    }
+    dst.push_back(L'\0');
+}
+
 static void D3D12SetObjectNameUTF8toUTF16(ID3D12Object* obj, const char* name)
 {
-    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-    std::wstring nameWStr = converter.from_bytes(name);
-    obj->SetName(nameWStr.c_str());
+    /* Convert name into inline buffer; avoids heap allocations for typical name lengths */
+    SmallVector<wchar_t, 128> nameUTF16;
+    ConvertUTF8toUTF16(nameUTF16, name);
+    obj->SetName(nameUTF16.data());
 }
 
 void D3D12SetObjectName(ID3D12Object* obj, const char* name)
@@ -39,9 +102,16 @@ void D3D12SetObjectNameSubscript(ID3D12Object* obj, const char* name, const char
     {
         if (name != nullptr)
         {
-            std::string nameWithSubscript = name;
-            nameWithSubscript += subscript;
-            D3D12SetObjectNameUTF8toUTF16(obj, nameWithSubscript.c_str());
+            /* Append subscript to name within inline buffer */
+            const auto nameLen      = std::strlen(name);
+            const auto subscriptLen = std::strlen(subscript);
+
+            SmallVector<char, 128> nameWithSubscript(nameLen + subscriptLen + 1);
+
+            ::memcpy(nameWithSubscript.data(), name, nameLen);
+            ::memcpy(nameWithSubscript.data() + nameLen, subscript, subscriptLen + 1);
+
+            D3D12SetObjectNameUTF8toUTF16(obj, nameWithSubscript.data());
         }
         else
             obj->SetName(nullptr);
@@ -53,8 +123,9 @@ void D3D12SetObjectNameIndexed(ID3D12Object* obj, const char* name, std::uint32_
     if (name != nullptr)
     {
         /* Append subscript to label */
-        std::string subscript = std::to_string(index);
-        D3D12SetObjectNameSubscript(obj, name, subscript.c_str());
+        char subscript[16];
+        ::snprintf(subscript, sizeof(subscript), "%u", index);
+        D3D12SetObjectNameSubscript(obj, name, subscript);
     }
     else
         obj->SetName(nullptr);
@@ -18,6 +18,7 @@
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/Log.h>
 #include "D3DX12/d3dx12.h"
+#include <dxgi1_5.h>
 #include <algorithm>
 
 
@@ -32,11 +33,17 @@ D3D12RenderContext::D3D12RenderContext(
 :
     RenderContext     { desc.videoMode, desc.vsync       },
     renderSystem_     { renderSystem                     },
-    swapChainSamples_ { desc.multiSampling.SampleCount() }
+    swapChainSamples_ { desc.multiSampling.SampleCount() },
+    maxFrameLatency_  { std::min(desc.frameLatency, 3u)  },
+    presentMode_      { desc.presentMode                 }
 {
     /* Setup surface for the render context */
     SetOrCreateSurface(surface, GetVideoMode(), nullptr);
 
+    /* Determine tearing support for immediate presentation before the swap chain is created */
+    if (presentMode_ == PresentMode::Immediate)
+        tearingSupported_ = renderSystem.IsTearingSupported();
+
     /* Create device resources and window dependent resource */
     CreateDeviceResources();
     CreateWindowSizeDependentResources(GetVideoMode());
@@ -49,6 +56,9 @@ D3D12RenderContext::~D3D12RenderContext()
 {
     /* Ensure the GPU is no longer referencing resources that are about to be released */
     MoveToNextFrame();
+
+    if (frameLatencyWaitableObject_ != 0)
+        CloseHandle(frameLatencyWaitableObject_);
 }
 
 void D3D12RenderContext::SetName(const char* name)
@@ -71,14 +81,45 @@ void D3D12RenderContext::SetName(const char* name)
 
 void D3D12RenderContext::Present()
 {
-    /* Present swap-chain with vsync interval */
-    auto hr = swapChain_->Present(swapChainInterval_, 0);
+    /* Determine sync interval and present flags from the configured presentation mode */
+    UINT syncInterval   = swapChainInterval_;
+    UINT presentFlags   = 0;
+
+    switch (presentMode_)
+    {
+        case PresentMode::Fifo:
+            syncInterval = std::max(1u, swapChainInterval_);
+            break;
+        case PresentMode::Mailbox:
+            syncInterval = 0;
+            break;
+        case PresentMode::Immediate:
+            syncInterval = 0;
+            if (tearingSupported_)
+                presentFlags = DXGI_PRESENT_ALLOW_TEARING;
+            break;
+        default:
+            break;
+    }
+
+    /* Present swap-chain */
+    auto hr = swapChain_->Present(syncInterval, presentFlags);
     DXThrowIfFailed(hr, "failed to present DXGI swap chain");
 
+    /* Advance residency frame fence and evict resources while over the video memory budget */
+    renderSystem_.GetResidencyManager().NextFrame(renderSystem_.GetDevice().GetQueue());
+
     /* Advance frame counter */
     MoveToNextFrame();
 }
 
+void D3D12RenderContext::WaitForFrameLatency()
+{
+    /* Block until the swap chain signals that a new frame can be queued */
+    if (frameLatencyWaitableObject_ != 0)
+        WaitForSingleObjectEx(frameLatencyWaitableObject_, 1000, TRUE);
+}
+
 Format D3D12RenderContext::GetColorFormat() const
 {
     return DXTypes::Unmap(colorFormat_);
@@ -188,8 +229,17 @@ bool D3D12RenderContext::OnSetVsync(const VsyncDescriptor& vsyncDesc)
 
 void D3D12RenderContext::CreateWindowSizeDependentResources(const VideoModeDescriptor& videoModeDesc)
 {
-    /* Wait until all previous GPU work is complete */
-    SyncGPU();
+    /*
+    Wait only until the frames that still reference the back buffers have drained;
+    unlike a full GPU sync, this does not block on work that was queued after the last presentation
+    */
+    UINT64 lastPresentedFenceValue = 0;
+    for (UINT i = 0; i < numFrames_; ++i)
+    {
+        if (i != currentFrame_)
+            lastPresentedFenceValue = std::max(lastPresentedFenceValue, fenceValues_[i]);
+    }
+    renderSystem_.WaitForFenceValue(lastPresentedFenceValue);
 
     /* Release previous window size dependent resources, and reset fence values to current value */
     for (UINT i = 0; i < numFrames_; ++i)
@@ -200,8 +250,6 @@ void D3D12RenderContext::CreateWindowSizeDependentResources(const VideoModeDescr
     }
 
     depthStencil_.native.Reset();
-    rtvDescHeap_.Reset();
-    dsvDescHeap_.Reset();
 
     /* Setup swap chain meta data */
     numFrames_ = std::max(1u, std::min(videoModeDesc.swapChainSize, g_maxSwapChainSize));
@@ -218,7 +266,7 @@ void D3D12RenderContext::CreateWindowSizeDependentResources(const VideoModeDescr
             framebufferWidth,
             framebufferHeight,
             colorFormat_,
-            0
+            (maxFrameLatency_ > 0 ? DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT : 0)
         );
 
         if (hr == DXGI_ERROR_DEVICE_REMOVED || hr == DXGI_ERROR_DEVICE_RESET)
@@ -248,11 +296,20 @@ void D3D12RenderContext::CreateWindowSizeDependentResources(const VideoModeDescr
             swapChainDesc.Scaling               = DXGI_SCALING_NONE;
             swapChainDesc.SwapEffect            = DXGI_SWAP_EFFECT_FLIP_DISCARD;
             swapChainDesc.AlphaMode             = DXGI_ALPHA_MODE_IGNORE;
-            swapChainDesc.Flags                 = 0;
+            swapChainDesc.Flags                 = (maxFrameLatency_ > 0 ? DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT : 0);
+            if (tearingSupported_)
+                swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
         }
         auto swapChain = renderSystem_.CreateDXSwapChain(swapChainDesc, wndHandle.window);
 
         swapChain.As(&swapChain_);
+
+        /* Limit frame queuing and acquire frame-latency waitable object */
+        if (maxFrameLatency_ > 0)
+        {
+            swapChain_->SetMaximumFrameLatency(maxFrameLatency_);
+            frameLatencyWaitableObject_ = swapChain_->GetFrameLatencyWaitableObject();
+        }
     }
 
     /* Create color buffer render target views (RTV) */
@@ -272,15 +329,20 @@ void D3D12RenderContext::CreateColorBufferRTVs(const VideoModeDescriptor& videoM
 {
     auto device = renderSystem_.GetDXDevice();
 
-    /* Create RTV descriptor heap */
-    D3D12_DESCRIPTOR_HEAP_DESC descHeapDesc;
+    /* Create RTV descriptor heap; it is preserved across resizes while the swap-chain size is unchanged */
+    const UINT numRTVDescriptors = (HasMultiSampling() ? numFrames_ * 2 : numFrames_);
+
+    if (!rtvDescHeap_ || rtvDescHeap_->GetDesc().NumDescriptors != numRTVDescriptors)
     {
-        descHeapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
-        descHeapDesc.NumDescriptors = (HasMultiSampling() ? numFrames_ * 2 : numFrames_);
-        descHeapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
-        descHeapDesc.NodeMask       = 0;
+        D3D12_DESCRIPTOR_HEAP_DESC descHeapDesc;
+        {
+            descHeapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_RTV;
+            descHeapDesc.NumDescriptors = numRTVDescriptors;
+            descHeapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+            descHeapDesc.NodeMask       = 0;
+        }
+        rtvDescHeap_ = renderSystem_.GetDevice().CreateDXDescriptorHeap(descHeapDesc);
     }
-    rtvDescHeap_ = renderSystem_.GetDevice().CreateDXDescriptorHeap(descHeapDesc);
 
     /* Create color buffers */
     CD3DX12_CPU_DESCRIPTOR_HANDLE rtvDescHandle(rtvDescHeap_->GetCPUDescriptorHandleForHeapStart());
@@ -359,15 +421,18 @@ void D3D12RenderContext::CreateDepthStencil(const VideoModeDescriptor& videoMode
     /* Pick-depth stencil format */
     depthStencilFormat_ = DXPickDepthStencilFormat(videoModeDesc.depthBits, videoModeDesc.stencilBits);
 
-    /* Create DSV descriptor heap */
-    D3D12_DESCRIPTOR_HEAP_DESC descHeapDesc;
+    /* Create DSV descriptor heap on first use; the view is overwritten in place on resize */
+    if (!dsvDescHeap_)
     {
-        descHeapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_DSV;
-        descHeapDesc.NumDescriptors = 1;
-        descHeapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
-        descHeapDesc.NodeMask       = 0;
+        D3D12_DESCRIPTOR_HEAP_DESC descHeapDesc;
+        {
+            descHeapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_DSV;
+            descHeapDesc.NumDescriptors = 1;
+            descHeapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+            descHeapDesc.NodeMask       = 0;
+        }
+        dsvDescHeap_ = renderSystem_.GetDevice().CreateDXDescriptorHeap(descHeapDesc);
     }
-    dsvDescHeap_ = renderSystem_.GetDevice().CreateDXDescriptorHeap(descHeapDesc);
 
     /* Create depth-stencil buffer */
     auto tex2DDesc = CD3DX12_RESOURCE_DESC::Tex2D(
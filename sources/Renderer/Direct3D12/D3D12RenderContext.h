@@ -37,6 +37,8 @@ class D3D12RenderContext final : public RenderContext
 
         void Present() override;
 
+        void WaitForFrameLatency() override;
+
         Format GetColorFormat() const override;
         Format GetDepthStencilFormat() const override;
 
@@ -86,6 +88,10 @@ class D3D12RenderContext final : public RenderContext
         ComPtr<IDXGISwapChain3>         swapChain_;
         UINT                            swapChainInterval_                  = 0;
         UINT                            swapChainSamples_                   = 1;
+        UINT                            maxFrameLatency_                    = 0;
+        HANDLE                          frameLatencyWaitableObject_         = 0;
+        PresentMode                     presentMode_                        = PresentMode::Default;
+        bool                            tearingSupported_                   = false;
 
         ComPtr<ID3D12DescriptorHeap>    rtvDescHeap_;
         UINT                            rtvDescSize_                        = 0;
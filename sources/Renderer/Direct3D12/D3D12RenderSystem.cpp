@@ -9,11 +9,13 @@
 #include "D3D12Types.h"
 #include "../DXCommon/DXCore.h"
 #include "../TextureUtils.h"
+#include "../PipelineStateHash.h"
 #include "../CheckedCast.h"
 #include "../../Core/Vendor.h"
 #include "../../Core/Helper.h"
 #include "../../Core/Assertion.h"
 #include "D3DX12/d3dx12.h"
+#include <dxgi1_5.h>
 #include <limits>
 
 #include "Buffer/D3D12Buffer.h"
@@ -38,9 +40,15 @@ D3D12RenderSystem::D3D12RenderSystem()
     CreateDevice();
     CreateGPUSynchObjects();
 
-    /* Create command queue interface */
+    /* Create command queue interfaces; the compute queue runs concurrently to the graphics queue */
     commandQueue_ = MakeUnique<D3D12CommandQueue>(device_.GetNative(), device_.GetQueue());
 
+    nativeComputeQueue_ = device_.CreateDXCommandQueue(D3D12_COMMAND_LIST_TYPE_COMPUTE);
+    computeCommandQueue_ = MakeUnique<D3D12CommandQueue>(device_.GetNative(), nativeComputeQueue_.Get());
+
+    nativeTransferQueue_ = device_.CreateDXCommandQueue(D3D12_COMMAND_LIST_TYPE_COPY);
+    transferCommandQueue_ = MakeUnique<D3D12CommandQueue>(device_.GetNative(), nativeTransferQueue_.Get());
+
     /* Create command queue, command allocator, and graphics command list */
     graphicsCmdAlloc_   = device_.CreateDXCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT);
     graphicsCmdList_    = device_.CreateDXCommandList(D3D12_COMMAND_LIST_TYPE_DIRECT, graphicsCmdAlloc_.Get());
@@ -53,8 +61,14 @@ D3D12RenderSystem::D3D12RenderSystem()
     commandSignaturePool_.CreateDefaultSignatures(device_.GetNative());
     commandContext_.SetCommandList(graphicsCmdList_.Get());
     stagingBufferPool_.InitializeDevice(device_.GetNative(), 0);
+    heapPool_.InitializeDevice(device_.GetNative());
     D3D12MipGenerator::Get().InitializeDevice(device_.GetNative());
 
+    /* Initialize residency manager with the adapter the device was created with (null for budget queries if unavailable) */
+    ComPtr<IDXGIAdapter3> videoAdapter;
+    factory_->EnumAdapterByLuid(device_.GetNative()->GetAdapterLuid(), IID_PPV_ARGS(videoAdapter.ReleaseAndGetAddressOf()));
+    residencyManager_.InitializeDevice(device_.GetNative(), videoAdapter);
+
     /* Initialize renderer information */
     QueryRendererInfo();
     QueryRenderingCaps();
@@ -63,6 +77,8 @@ D3D12RenderSystem::D3D12RenderSystem()
 D3D12RenderSystem::~D3D12RenderSystem()
 {
     SyncGPU();
+    computeCommandQueue_->WaitIdle();
+    transferCommandQueue_->WaitIdle();
 
     /*
     Release render targets first, to ensure the GPU is no longer
@@ -80,6 +96,48 @@ D3D12RenderSystem::~D3D12RenderSystem()
     CloseHandle(fenceEvent_);
 }
 
+std::vector<VideoAdapterDescriptor> D3D12RenderSystem::QueryVideoAdapters() const
+{
+    return videoAdatperDescs_;
+}
+
+std::vector<VideoMemoryBudget> D3D12RenderSystem::QueryVideoMemoryBudgets() const
+{
+    std::vector<VideoMemoryBudget> budgets;
+
+    /* Get extended adapter interface for the adapter the device was created with */
+    ComPtr<IDXGIAdapter3> videoAdapter;
+    if (FAILED(factory_->EnumAdapterByLuid(device_.GetNative()->GetAdapterLuid(), IID_PPV_ARGS(videoAdapter.ReleaseAndGetAddressOf()))))
+        return budgets;
+
+    DXGI_ADAPTER_DESC adapterDesc;
+    InitMemory(adapterDesc);
+    videoAdapter->GetDesc(&adapterDesc);
+
+    /* Query budgets of local (video memory) and non-local (shared system memory) segment groups */
+    const DXGI_MEMORY_SEGMENT_GROUP segmentGroups[] = { DXGI_MEMORY_SEGMENT_GROUP_LOCAL, DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL };
+
+    for (auto segmentGroup : segmentGroups)
+    {
+        DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo;
+        InitMemory(memoryInfo);
+
+        if (SUCCEEDED(videoAdapter->QueryVideoMemoryInfo(0, segmentGroup, &memoryInfo)))
+        {
+            VideoMemoryBudget budget;
+            {
+                budget.usage        = memoryInfo.CurrentUsage;
+                budget.budget       = memoryInfo.Budget;
+                budget.heapSize     = (segmentGroup == DXGI_MEMORY_SEGMENT_GROUP_LOCAL ? adapterDesc.DedicatedVideoMemory : adapterDesc.SharedSystemMemory);
+                budget.deviceLocal  = (segmentGroup == DXGI_MEMORY_SEGMENT_GROUP_LOCAL);
+            }
+            budgets.push_back(budget);
+        }
+    }
+
+    return budgets;
+}
+
 /* ----- Render Context ----- */
 
 RenderContext* D3D12RenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
@@ -99,16 +157,45 @@ CommandQueue* D3D12RenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* D3D12RenderSystem::GetComputeCommandQueue()
+{
+    return computeCommandQueue_.get();
+}
+
+std::uint32_t D3D12RenderSystem::GetNumCommandQueues(const CommandQueueType queueType)
+{
+    return 1; // one dedicated queue per type
+}
+
+CommandQueue* D3D12RenderSystem::GetCommandQueue(const CommandQueueType queueType, std::uint32_t index)
+{
+    if (index > 0)
+        return nullptr;
+    switch (queueType)
+    {
+        case CommandQueueType::Graphics:
+            return commandQueue_.get();
+        case CommandQueueType::Compute:
+            return computeCommandQueue_.get();
+        case CommandQueueType::Transfer:
+            return transferCommandQueue_.get();
+        default:
+            return nullptr;
+    }
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* D3D12RenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
+    std::lock_guard<std::mutex> guard { commandBufferMutex_ };
     return TakeOwnership(commandBuffers_, MakeUnique<D3D12CommandBuffer>(*this, desc));
 }
 
 void D3D12RenderSystem::Release(CommandBuffer& commandBuffer)
 {
     SyncGPU();
+    std::lock_guard<std::mutex> guard { commandBufferMutex_ };
     RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
 }
 
@@ -119,6 +206,11 @@ std::unique_ptr<D3D12Buffer> D3D12RenderSystem::CreateGpuBuffer(const BufferDesc
 {
     auto bufferD3D = MakeUnique<D3D12Buffer>(device_.GetNative(), desc);
 
+    /* Serialize the upload below, since the single command context and staging pool are shared */
+    std::lock_guard<std::mutex> uploadGuard { uploadMutex_ };
+
+    residencyManager_.Register(bufferD3D->GetNative());
+
     if (initialData)
     {
         stagingBufferPool_.WriteImmediate(
@@ -129,11 +221,11 @@ std::unique_ptr<D3D12Buffer> D3D12RenderSystem::CreateGpuBuffer(const BufferDesc
             desc.size,
             bufferD3D->GetAlignment()
         );
-    }
 
-    /* Execute upload commands and wait for GPU to finish execution */
-    ExecuteCommandList();
-    SyncGPU();
+        /* Execute upload commands and wait for GPU to finish execution */
+        ExecuteCommandList();
+        SyncGPU();
+    }
 
     return bufferD3D;
 }
@@ -158,12 +250,16 @@ BufferArray* D3D12RenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buff
 
 void D3D12RenderSystem::Release(Buffer& buffer)
 {
+    std::lock_guard<std::mutex> uploadGuard { uploadMutex_ };
     SyncGPU();
+    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    residencyManager_.Unregister(bufferD3D.GetNative());
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
 void D3D12RenderSystem::Release(BufferArray& bufferArray)
 {
+    std::lock_guard<std::mutex> uploadGuard { uploadMutex_ };
     SyncGPU();
     RemoveFromUniqueSet(bufferArrays_, &bufferArray);
 }
@@ -172,6 +268,8 @@ void D3D12RenderSystem::Release(BufferArray& bufferArray)
 void D3D12RenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
 {
     auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+    std::lock_guard<std::mutex> uploadGuard { uploadMutex_ };
+    residencyManager_.UseResource(device_.GetQueue(), dstBufferD3D.GetNative());
     stagingBufferPool_.WriteImmediate(commandContext_, dstBufferD3D.GetResource(), dstOffset, data, dataSize);
     ExecuteCommandList();
 }
@@ -251,7 +349,14 @@ void D3D12RenderSystem::UpdateGpuTexture(
 
 Texture* D3D12RenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
-    auto textureD3D = MakeUnique<D3D12Texture>(device_.GetNative(), textureDesc);
+    /* Serialize the heap allocation and upload below, since the single command context and heap pool are shared */
+    std::lock_guard<std::mutex> uploadGuard { uploadMutex_ };
+
+    auto textureD3D = MakeUnique<D3D12Texture>(device_.GetNative(), textureDesc, &heapPool_);
+
+    /* Placed resources share the residency of their pooled heap, so only committed textures are tracked individually */
+    if (!textureD3D->IsPlacedResource())
+        residencyManager_.Register(textureD3D->GetNative());
 
     if (imageDesc != nullptr)
     {
@@ -279,13 +384,22 @@ Texture* D3D12RenderSystem::CreateTexture(const TextureDescriptor& textureDesc,
 
 void D3D12RenderSystem::Release(Texture& texture)
 {
+    std::lock_guard<std::mutex> uploadGuard { uploadMutex_ };
     SyncGPU();
+    auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+    residencyManager_.Unregister(textureD3D.GetNative());
+
+    /* Return the heap region of a placed resource to the pool after the resource was released */
+    const auto heapRegion = textureD3D.GetHeapRegion();
     RemoveFromUniqueSet(textures_, &texture);
+    heapPool_.Release(heapRegion);
 }
 
 void D3D12RenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
 {
     auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+    std::lock_guard<std::mutex> uploadGuard { uploadMutex_ };
+    residencyManager_.UseResource(device_.GetQueue(), textureD3D.GetNative());
 
     /* Execute upload commands and wait for GPU to finish execution */
     ComPtr<ID3D12Resource> uploadBuffer;
@@ -309,6 +423,7 @@ Sampler* D3D12RenderSystem::CreateSampler(const SamplerDescriptor& desc)
 
 void D3D12RenderSystem::Release(Sampler& sampler)
 {
+    std::lock_guard<std::mutex> uploadGuard { uploadMutex_ };
     SyncGPU();
     RemoveFromUniqueSet(samplers_, &sampler);
 }
@@ -326,6 +441,12 @@ void D3D12RenderSystem::Release(ResourceHeap& resourceHeap)
     RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
 }
 
+void D3D12RenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews)
+{
+    auto& resourceHeapD3D = LLGL_CAST(D3D12ResourceHeap&, resourceHeap);
+    resourceHeapD3D.WriteResourceViews(firstDescriptor, numResourceViews, resourceViews);
+}
+
 /* ----- Render Passes ----- */
 
 RenderPass* D3D12RenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
@@ -357,6 +478,7 @@ void D3D12RenderSystem::Release(RenderTarget& renderTarget)
 Shader* D3D12RenderSystem::CreateShader(const ShaderDescriptor& desc)
 {
     AssertCreateShader(desc);
+    std::lock_guard<std::mutex> guard { shaderMutex_ };
     return TakeOwnership(shaders_, MakeUnique<D3D12Shader>(desc));
 }
 
@@ -368,6 +490,7 @@ ShaderProgram* D3D12RenderSystem::CreateShaderProgram(const ShaderProgramDescrip
 
 void D3D12RenderSystem::Release(Shader& shader)
 {
+    std::lock_guard<std::mutex> guard { shaderMutex_ };
     RemoveFromUniqueSet(shaders_, &shader);
 }
 
@@ -393,30 +516,65 @@ void D3D12RenderSystem::Release(PipelineLayout& pipelineLayout)
 
 GraphicsPipeline* D3D12RenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
 {
-    return TakeOwnership(
+    std::lock_guard<std::mutex> guard { pipelineMutex_ };
+
+    /* Check deduplication cache for a pipeline with an identical descriptor first */
+    std::uint64_t descHash = 0;
+    if (GetConfiguration().pipelineDeduplication)
+    {
+        descHash = HashGraphicsPipelineDesc(desc);
+        if (auto sharedPipeline = graphicsPipelineDedupCache_.Find(descHash))
+            return sharedPipeline;
+    }
+
+    auto pipeline = TakeOwnership(
         graphicsPipelines_,
         MakeUnique<D3D12GraphicsPipeline>(device_, defaultPipelineLayout_.GetRootSignature(), desc)
     );
+
+    if (descHash != 0)
+        graphicsPipelineDedupCache_.Register(descHash, pipeline);
+
+    return pipeline;
 }
 
 ComputePipeline* D3D12RenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
 {
-    return TakeOwnership(
+    std::lock_guard<std::mutex> guard { pipelineMutex_ };
+
+    std::uint64_t descHash = 0;
+    if (GetConfiguration().pipelineDeduplication)
+    {
+        descHash = HashComputePipelineDesc(desc);
+        if (auto sharedPipeline = computePipelineDedupCache_.Find(descHash))
+            return sharedPipeline;
+    }
+
+    auto pipeline = TakeOwnership(
         computePipelines_,
         MakeUnique<D3D12ComputePipeline>(device_, defaultPipelineLayout_.GetRootSignature(), desc)
     );
+
+    if (descHash != 0)
+        computePipelineDedupCache_.Register(descHash, pipeline);
+
+    return pipeline;
 }
 
 void D3D12RenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
     SyncGPU();
-    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+    std::lock_guard<std::mutex> guard { pipelineMutex_ };
+    if (graphicsPipelineDedupCache_.Release(&graphicsPipeline))
+        RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
 }
 
 void D3D12RenderSystem::Release(ComputePipeline& computePipeline)
 {
     SyncGPU();
-    RemoveFromUniqueSet(computePipelines_, &computePipeline);
+    std::lock_guard<std::mutex> guard { pipelineMutex_ };
+    if (computePipelineDedupCache_.Release(&computePipeline))
+        RemoveFromUniqueSet(computePipelines_, &computePipeline);
 }
 
 /* ----- Queries ----- */
@@ -445,6 +603,16 @@ void D3D12RenderSystem::Release(Fence& fence)
     RemoveFromUniqueSet(fences_, &fence);
 }
 
+bool D3D12RenderSystem::SupportsConcurrentPipelineCreation() const
+{
+    return true;
+}
+
+bool D3D12RenderSystem::SupportsConcurrentShaderCompilation() const
+{
+    return true;
+}
+
 /* ----- Extended internal functions ----- */
 
 ComPtr<IDXGISwapChain1> D3D12RenderSystem::CreateDXSwapChain(const DXGI_SWAP_CHAIN_DESC1& desc, HWND wnd)
@@ -457,6 +625,18 @@ ComPtr<IDXGISwapChain1> D3D12RenderSystem::CreateDXSwapChain(const DXGI_SWAP_CHA
     return swapChain;
 }
 
+bool D3D12RenderSystem::IsTearingSupported() const
+{
+    ComPtr<IDXGIFactory5> factory5;
+    if (SUCCEEDED(factory_.As(&factory5)))
+    {
+        BOOL allowTearing = FALSE;
+        if (SUCCEEDED(factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &allowTearing, sizeof(allowTearing))))
+            return (allowTearing == TRUE);
+    }
+    return false;
+}
+
 void D3D12RenderSystem::SignalFenceValue(UINT64 fenceValue)
 {
     /* Schedule signal command into the qeue */
@@ -639,6 +819,8 @@ void D3D12RenderSystem::QueryRenderingCaps()
         /* Set extended attributes */
         caps.features.hasConservativeRasterization  = (GetFeatureLevel() >= D3D_FEATURE_LEVEL_12_0);
         caps.features.hasTextureViewSwizzle         = true;
+        caps.features.hasDrawIndirectCount          = true;
+        caps.features.hasConcurrentResourceCreation = true;
 
         caps.limits.maxViewports                    = D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
         caps.limits.maxViewportSize[0]              = D3D12_VIEWPORT_BOUNDS_MAX;
@@ -13,6 +13,8 @@
 #include <LLGL/VideoAdapter.h>
 
 #include "D3D12Device.h"
+#include "D3D12HeapPool.h"
+#include "D3D12ResidencyManager.h"
 #include "D3D12RenderContext.h"
 #include "Command/D3D12CommandQueue.h"
 #include "Command/D3D12CommandBuffer.h"
@@ -41,6 +43,7 @@
 #include "../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <dxgi1_4.h>
+#include <mutex>
 
 
 namespace LLGL
@@ -57,6 +60,10 @@ class D3D12RenderSystem final : public RenderSystem
         D3D12RenderSystem();
         ~D3D12RenderSystem();
 
+        std::vector<VideoAdapterDescriptor> QueryVideoAdapters() const override;
+
+        std::vector<VideoMemoryBudget> QueryVideoMemoryBudgets() const override;
+
         /* ----- Render Context ------ */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -66,6 +73,10 @@ class D3D12RenderSystem final : public RenderSystem
         /* ----- Command queues ----- */
 
         CommandQueue* GetCommandQueue() override;
+        CommandQueue* GetComputeCommandQueue() override;
+
+        std::uint32_t GetNumCommandQueues(const CommandQueueType queueType) override;
+        CommandQueue* GetCommandQueue(const CommandQueueType queueType, std::uint32_t index = 0) override;
 
         /* ----- Command buffers ----- */
 
@@ -108,6 +119,8 @@ class D3D12RenderSystem final : public RenderSystem
 
         void Release(ResourceHeap& resourceHeap) override;
 
+        void WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews) override;
+
         /* ----- Render Passes ----- */
 
         RenderPass* CreateRenderPass(const RenderPassDescriptor& desc) override;
@@ -154,12 +167,23 @@ class D3D12RenderSystem final : public RenderSystem
 
         void Release(Fence& fence) override;
 
+    protected:
+
+        //! D3D12 pipeline states can be created concurrently; see 'pipelineMutex_'.
+        bool SupportsConcurrentPipelineCreation() const override;
+
+        //! D3D12 shaders are compiled with D3DCompile, which is free-threaded; see 'shaderMutex_'.
+        bool SupportsConcurrentShaderCompilation() const override;
+
     public:
 
         /* ----- Extended internal functions ----- */
 
         ComPtr<IDXGISwapChain1> CreateDXSwapChain(const DXGI_SWAP_CHAIN_DESC1& desc, HWND wnd);
 
+        // Returns true if the DXGI factory supports tearing (i.e. presentation without vertical blank).
+        bool IsTearingSupported() const;
+
         // Internal fence
         void SignalFenceValue(UINT64 fenceValue);
         void WaitForFenceValue(UINT64 fenceValue);
@@ -204,6 +228,12 @@ class D3D12RenderSystem final : public RenderSystem
             return commandSignaturePool_;
         }
 
+        // Returns the residency manager that tracks all buffers and textures against the video memory budget.
+        inline D3D12ResidencyManager& GetResidencyManager()
+        {
+            return residencyManager_;
+        }
+
     private:
 
         #ifdef LLGL_DEBUG
@@ -243,6 +273,8 @@ class D3D12RenderSystem final : public RenderSystem
         D3D12CommandSignaturePool                   commandSignaturePool_;
         D3D12CommandContext                         commandContext_;
         D3D12StagingBufferPool                      stagingBufferPool_;
+        D3D12HeapPool                               heapPool_;
+        D3D12ResidencyManager                       residencyManager_;
 
         #ifdef LLGL_DEBUG
         //ComPtr<ID3D12Debug>                         debugDevice_;
@@ -253,18 +285,28 @@ class D3D12RenderSystem final : public RenderSystem
 
         HWObjectContainer<D3D12RenderContext>       renderContexts_;
         HWObjectInstance<D3D12CommandQueue>         commandQueue_;
+        ComPtr<ID3D12CommandQueue>                  nativeComputeQueue_;
+        HWObjectInstance<D3D12CommandQueue>         computeCommandQueue_;
+        ComPtr<ID3D12CommandQueue>                  nativeTransferQueue_;
+        HWObjectInstance<D3D12CommandQueue>         transferCommandQueue_;
         HWObjectContainer<D3D12CommandBuffer>       commandBuffers_;
-        HWObjectContainer<D3D12Buffer>              buffers_;
-        HWObjectContainer<BufferArray>              bufferArrays_;
-        HWObjectContainer<D3D12Texture>             textures_;
-        HWObjectContainer<D3D12Sampler>             samplers_;
+        std::mutex                                  commandBufferMutex_;
+        HWObjectContainerConcurrent<D3D12Buffer>    buffers_;
+        HWObjectContainerConcurrent<BufferArray>    bufferArrays_;
+        HWObjectContainerConcurrent<D3D12Texture>   textures_;
+        HWObjectContainerConcurrent<D3D12Sampler>   samplers_;
+        std::mutex                                  uploadMutex_;
         HWObjectContainer<D3D12RenderPass>          renderPasses_;
         HWObjectContainer<D3D12RenderTarget>        renderTargets_;
         HWObjectContainer<D3D12Shader>              shaders_;
+        std::mutex                                  shaderMutex_;
         HWObjectContainer<D3D12ShaderProgram>       shaderPrograms_;
         HWObjectContainer<D3D12PipelineLayout>      pipelineLayouts_;
         HWObjectContainer<D3D12GraphicsPipeline>    graphicsPipelines_;
         HWObjectContainer<D3D12ComputePipeline>     computePipelines_;
+        HWObjectDedupCache<GraphicsPipeline>        graphicsPipelineDedupCache_;
+        HWObjectDedupCache<ComputePipeline>         computePipelineDedupCache_;
+        std::mutex                                  pipelineMutex_;
         HWObjectContainer<D3D12ResourceHeap>        resourceHeaps_;
         HWObjectContainer<D3D12QueryHeap>           queryHeaps_;
         HWObjectContainer<D3D12Fence>               fences_;
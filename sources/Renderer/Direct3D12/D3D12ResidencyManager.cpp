@@ -0,0 +1,224 @@
+/*
+ * D3D12ResidencyManager.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "D3D12ResidencyManager.h"
+#include "../DXCommon/DXCore.h"
+#include <algorithm>
+#include <utility>
+
+
+namespace LLGL
+{
+
+
+/*
+Resources may still be referenced by command buffers that were recorded but not yet submitted,
+so only entries whose last use lies this many completed frames in the past are eligible for eviction.
+*/
+static const UINT64 g_residencyEvictLatency = 3;
+
+void D3D12ResidencyManager::InitializeDevice(ID3D12Device* device, const ComPtr<IDXGIAdapter3>& videoAdapter)
+{
+    device_         = device;
+    videoAdapter_   = videoAdapter;
+
+    #ifdef __ID3D12Device3_INTERFACE_DEFINED__
+    /* Query extended device interface for asynchronous paging; falls back to blocking MakeResident */
+    device->QueryInterface(IID_PPV_ARGS(device3_.ReleaseAndGetAddressOf()));
+    #endif
+
+    /* Create frame fence to track the last use of each entry */
+    auto hr = device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(frameFence_.ReleaseAndGetAddressOf()));
+    DXThrowIfFailed(hr, "failed to create D3D12 fence for residency frame tracking");
+
+    /* Create paging fence to synchronize command queues with asynchronous MakeResident operations */
+    hr = device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(residencyFence_.ReleaseAndGetAddressOf()));
+    DXThrowIfFailed(hr, "failed to create D3D12 fence for residency paging operations");
+}
+
+void D3D12ResidencyManager::Register(ID3D12Resource* resource)
+{
+    if (device_ == nullptr || resource == nullptr)
+        return;
+
+    /* Determine allocation size of the resource */
+    const D3D12_RESOURCE_DESC resourceDesc = resource->GetDesc();
+
+    UINT64 size = 0;
+    if (resourceDesc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER)
+        size = resourceDesc.Width;
+    else
+        size = device_->GetResourceAllocationInfo(0, 1, &resourceDesc).SizeInBytes;
+
+    /* Store new entry; committed resources are created resident */
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    Entry entry;
+    {
+        entry.size          = size;
+        entry.lastUseFrame  = frameValue_;
+        entry.resident      = true;
+    }
+    entries_[resource] = entry;
+}
+
+void D3D12ResidencyManager::Unregister(ID3D12Pageable* pageable)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    entries_.erase(pageable);
+}
+
+void D3D12ResidencyManager::SubmitResidencySet(ID3D12CommandQueue* commandQueue, const std::vector<ID3D12Pageable*>& residencySet)
+{
+    if (device_ == nullptr || residencySet.empty())
+        return;
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Stamp last use of all referenced entries and gather those that must be paged back in */
+    makeResidentList_.clear();
+
+    for (auto pageable : residencySet)
+    {
+        auto it = entries_.find(pageable);
+        if (it != entries_.end())
+        {
+            it->second.lastUseFrame = frameValue_ + 1;
+            if (!it->second.resident)
+            {
+                it->second.resident = true;
+                makeResidentList_.push_back(pageable);
+            }
+        }
+    }
+
+    if (!makeResidentList_.empty())
+        MakeEntriesResident(commandQueue);
+}
+
+void D3D12ResidencyManager::UseResource(ID3D12CommandQueue* commandQueue, ID3D12Pageable* pageable)
+{
+    if (device_ == nullptr || pageable == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    auto it = entries_.find(pageable);
+    if (it != entries_.end())
+    {
+        it->second.lastUseFrame = frameValue_ + 1;
+        if (!it->second.resident)
+        {
+            it->second.resident = true;
+            makeResidentList_.clear();
+            makeResidentList_.push_back(pageable);
+            MakeEntriesResident(commandQueue);
+        }
+    }
+}
+
+void D3D12ResidencyManager::NextFrame(ID3D12CommandQueue* commandQueue)
+{
+    if (device_ == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Signal frame fence; entries stamped with this value become evictable once the signal completed */
+    auto hr = commandQueue->Signal(frameFence_.Get(), ++frameValue_);
+    DXThrowIfFailed(hr, "failed to signal D3D12 fence for residency frame tracking");
+
+    EvictEntriesOverBudget();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void D3D12ResidencyManager::MakeEntriesResident(ID3D12CommandQueue* commandQueue)
+{
+    const auto numPageables = static_cast<UINT>(makeResidentList_.size());
+
+    #ifdef __ID3D12Device3_INTERFACE_DEFINED__
+    if (device3_)
+    {
+        /* Page entries back in asynchronously and let the command queue wait for the paging fence on the GPU timeline */
+        auto hr = device3_->EnqueueMakeResident(
+            D3D12_RESIDENCY_FLAG_NONE,
+            numPageables,
+            makeResidentList_.data(),
+            residencyFence_.Get(),
+            ++residencyFenceValue_
+        );
+        DXThrowIfFailed(hr, "failed to enqueue D3D12 make-resident operation");
+
+        hr = commandQueue->Wait(residencyFence_.Get(), residencyFenceValue_);
+        DXThrowIfFailed(hr, "failed to let D3D12 command queue wait for residency fence");
+        return;
+    }
+    #endif // /__ID3D12Device3_INTERFACE_DEFINED__
+
+    /* Page entries back in synchronously */
+    auto hr = device_->MakeResident(numPageables, makeResidentList_.data());
+    DXThrowIfFailed(hr, "failed to make D3D12 resources resident");
+}
+
+void D3D12ResidencyManager::EvictEntriesOverBudget()
+{
+    if (!videoAdapter_)
+        return;
+
+    /* Query video memory budget for the local segment group */
+    DXGI_QUERY_VIDEO_MEMORY_INFO videoMemoryInfo;
+    auto hr = videoAdapter_->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &videoMemoryInfo);
+    if (FAILED(hr) || videoMemoryInfo.CurrentUsage <= videoMemoryInfo.Budget)
+        return;
+
+    const UINT64 numBytesOverBudget = videoMemoryInfo.CurrentUsage - videoMemoryInfo.Budget;
+
+    /* Gather resident entries whose last use the GPU has completed (plus a latency margin for deferred submissions) */
+    const UINT64 completedFrame = frameFence_->GetCompletedValue();
+
+    std::vector<std::pair<UINT64, ID3D12Pageable*>> candidates;
+    for (const auto& entry : entries_)
+    {
+        if (entry.second.resident && entry.second.lastUseFrame + g_residencyEvictLatency <= completedFrame)
+            candidates.push_back({ entry.second.lastUseFrame, entry.first });
+    }
+
+    if (candidates.empty())
+        return;
+
+    /* Evict entries in least-recently-used order until enough memory was reclaimed */
+    std::sort(candidates.begin(), candidates.end());
+
+    std::vector<ID3D12Pageable*> evictList;
+    UINT64 numBytesEvicted = 0;
+
+    for (const auto& candidate : candidates)
+    {
+        if (numBytesEvicted >= numBytesOverBudget)
+            break;
+        evictList.push_back(candidate.second);
+        numBytesEvicted += entries_[candidate.second].size;
+    }
+
+    hr = device_->Evict(static_cast<UINT>(evictList.size()), evictList.data());
+    if (SUCCEEDED(hr))
+    {
+        for (auto pageable : evictList)
+            entries_[pageable].resident = false;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
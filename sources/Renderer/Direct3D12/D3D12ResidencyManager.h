@@ -0,0 +1,111 @@
+/*
+ * D3D12ResidencyManager.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_D3D12_RESIDENCY_MANAGER_H
+#define LLGL_D3D12_RESIDENCY_MANAGER_H
+
+
+#include "../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <dxgi1_4.h>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Manager for the residency of GPU resources against the video memory budget reported by DXGI.
+All buffers and textures are registered here on creation and tracked with the fence value of the
+frame that last referenced them. When the process exceeds its video memory budget, the entries
+whose last use the GPU has already completed are evicted in least-recently-used order.
+Evicted entries are paged back in before a command buffer that references them is executed;
+this uses ID3D12Device3::EnqueueMakeResident (when available) together with a GPU-side queue wait,
+so paging does not stall the CPU.
+*/
+class D3D12ResidencyManager
+{
+
+    public:
+
+        D3D12ResidencyManager() = default;
+
+        D3D12ResidencyManager(const D3D12ResidencyManager&) = delete;
+        D3D12ResidencyManager& operator = (const D3D12ResidencyManager&) = delete;
+
+        // Initializes the device objects; budget queries are disabled if 'videoAdapter' is null.
+        void InitializeDevice(ID3D12Device* device, const ComPtr<IDXGIAdapter3>& videoAdapter);
+
+        // Registers the specified resource for residency tracking; newly created resources are resident.
+        void Register(ID3D12Resource* resource);
+
+        // Removes the specified resource from residency tracking; must be called before the resource is released.
+        void Unregister(ID3D12Pageable* pageable);
+
+        /*
+        Declares that the specified resources are referenced by the next submission on the specified command queue.
+        Stamps their last use and schedules evicted entries to be made resident before the submission executes.
+        */
+        void SubmitResidencySet(ID3D12CommandQueue* commandQueue, const std::vector<ID3D12Pageable*>& residencySet);
+
+        // Single resource variant of SubmitResidencySet; used for the immediate upload path.
+        void UseResource(ID3D12CommandQueue* commandQueue, ID3D12Pageable* pageable);
+
+        // Signals the frame fence on the specified command queue and evicts entries while over the video memory budget.
+        void NextFrame(ID3D12CommandQueue* commandQueue);
+
+    private:
+
+        struct Entry
+        {
+            UINT64  size;           // allocation size (in bytes)
+            UINT64  lastUseFrame;   // frame fence value of the last submission that referenced the entry
+            bool    resident;
+        };
+
+    private:
+
+        // Makes the specified entries resident again; asynchronously if ID3D12Device3 is available.
+        void MakeEntriesResident(ID3D12CommandQueue* commandQueue);
+
+        // Evicts completed entries in LRU order while the current usage exceeds the video memory budget.
+        void EvictEntriesOverBudget();
+
+    private:
+
+        ID3D12Device*                               device_                 = nullptr;
+        ComPtr<IDXGIAdapter3>                       videoAdapter_;
+
+        #ifdef __ID3D12Device3_INTERFACE_DEFINED__
+        ComPtr<ID3D12Device3>                       device3_;               // optional; for EnqueueMakeResident
+        #endif
+
+        ComPtr<ID3D12Fence>                         frameFence_;            // signaled once per frame to track last use
+        UINT64                                      frameValue_             = 0;
+
+        ComPtr<ID3D12Fence>                         residencyFence_;        // signaled when an asynchronous paging operation completed
+        UINT64                                      residencyFenceValue_    = 0;
+
+        std::unordered_map<ID3D12Pageable*, Entry>  entries_;
+        std::vector<ID3D12Pageable*>                makeResidentList_;      // re-used scratch list
+
+        std::mutex                                  mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -39,6 +39,10 @@ D3D12ComputePipeline::D3D12ComputePipeline(
         /* Create pipeline state with root signature from pipeline layout */
         auto pipelineLayoutD3D = LLGL_CAST(const D3D12PipelineLayout*, pipelineLayout);
         CreatePipelineState(device, *shaderProgramD3D, pipelineLayoutD3D->GetRootSignature());
+
+        /* Store root constant range of pipeline layout for dynamic shader uniforms */
+        rootConstantsIndex_ = pipelineLayoutD3D->GetRootConstantsIndex();
+        numRootConstants_   = pipelineLayoutD3D->GetNumRootConstants();
     }
     else
     {
@@ -41,6 +41,18 @@ class D3D12ComputePipeline final : public ComputePipeline
 
         void Bind(D3D12CommandContext& commandContext);
 
+        // Returns the root parameter index of the 32-bit root constants, or 0xFFFFFFFF if the pipeline layout has no uniform range.
+        inline UINT GetRootConstantsIndex() const
+        {
+            return rootConstantsIndex_;
+        }
+
+        // Returns the number of 32-bit values in the root constant range.
+        inline UINT GetNumRootConstants() const
+        {
+            return numRootConstants_;
+        }
+
     private:
 
         void CreatePipelineState(
@@ -52,7 +64,9 @@ class D3D12ComputePipeline final : public ComputePipeline
     private:
 
         ComPtr<ID3D12PipelineState> pipelineState_;
-        ID3D12RootSignature*        rootSignature_  = nullptr;
+        ID3D12RootSignature*        rootSignature_      = nullptr;
+        UINT                        rootConstantsIndex_ = ~0u;
+        UINT                        numRootConstants_   = 0;
 
 };
 
@@ -0,0 +1,232 @@
+/*
+ * D3D12DescriptorHeapPool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "D3D12DescriptorHeapPool.h"
+#include "D3D12ResourceHeap.h"
+#include "../../DXCommon/DXCore.h"
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+// Capacity of the shader-visible CBV/SRV/UAV heap ring.
+static const UINT g_numRingDescriptorsCbvSrvUav = 16384u;
+
+// Capacity of the shader-visible sampler heap ring; limited to 2048 by D3D12.
+static const UINT g_numRingDescriptorsSampler   = 2048u;
+
+D3D12DescriptorHeapPool::D3D12DescriptorHeapPool(ID3D12Device* device)
+{
+    InitializeDevice(device);
+}
+
+D3D12DescriptorHeapPool::~D3D12DescriptorHeapPool()
+{
+    /* Wait until all pending frames have completed before the descriptor heaps are released */
+    while (ReclaimFrame(true))
+    {
+    }
+
+    if (fenceEvent_ != 0)
+        CloseHandle(fenceEvent_);
+}
+
+void D3D12DescriptorHeapPool::InitializeDevice(ID3D12Device* device)
+{
+    device_ = device;
+    CreateRing(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, g_numRingDescriptorsCbvSrvUav);
+    CreateRing(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, g_numRingDescriptorsSampler);
+    CreateFence();
+}
+
+void D3D12DescriptorHeapPool::Reset()
+{
+    /* Reclaim the ring space of all frames that have already completed */
+    while (ReclaimFrame(false))
+    {
+    }
+
+    /* Descriptor tables of the previous recording may be overwritten by now, so they must be copied again */
+    bindCache_.clear();
+    heapsBound_ = false;
+}
+
+void D3D12DescriptorHeapPool::BindResourceHeap(ID3D12GraphicsCommandList* commandList, const D3D12ResourceHeap& resourceHeap, bool isGraphicsPipeline)
+{
+    auto heapCount = resourceHeap.GetNumDescriptorHeaps();
+    if (heapCount == 0)
+        return;
+
+    /* Bind the shader-visible ring heaps once per recording */
+    if (!heapsBound_)
+    {
+        ID3D12DescriptorHeap* descHeaps[2] =
+        {
+            rings_[D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV].heap.Get(),
+            rings_[D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER].heap.Get()
+        };
+        commandList->SetDescriptorHeaps(2, descHeaps);
+        heapsBound_ = true;
+    }
+
+    /* Copy descriptors into the rings (if not already done) and bind the root descriptor tables */
+    for (UINT i = 0; i < heapCount; ++i)
+    {
+        auto gpuDescHandle = CopyDescriptorsIfChanged(resourceHeap.GetDescriptorHeaps()[i]);
+        if (isGraphicsPipeline)
+            commandList->SetGraphicsRootDescriptorTable(i, gpuDescHandle);
+        else
+            commandList->SetComputeRootDescriptorTable(i, gpuDescHandle);
+    }
+}
+
+void D3D12DescriptorHeapPool::SignalFrame(ID3D12CommandQueue* commandQueue)
+{
+    /* Schedule fence signal to retire the ring space written since the last signal */
+    auto hr = commandQueue->Signal(fence_.Get(), ++fenceValue_);
+    DXThrowIfFailed(hr, "failed to signal D3D12 fence for descriptor heap pool");
+
+    Frame frame;
+    {
+        frame.fenceValue    = fenceValue_;
+        frame.writeEnd[0]   = rings_[0].writePos;
+        frame.writeEnd[1]   = rings_[1].writePos;
+    }
+    pendingFrames_.push(frame);
+}
+
+void D3D12DescriptorHeapPool::InvalidateBoundHeaps()
+{
+    heapsBound_ = false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void D3D12DescriptorHeapPool::CreateFence()
+{
+    auto hr = device_->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(fence_.ReleaseAndGetAddressOf()));
+    DXThrowIfFailed(hr, "failed to create D3D12 fence for descriptor heap pool");
+
+    fenceEvent_ = CreateEventEx(nullptr, nullptr, 0, EVENT_ALL_ACCESS);
+}
+
+void D3D12DescriptorHeapPool::CreateRing(const D3D12_DESCRIPTOR_HEAP_TYPE type, UINT numDescriptors)
+{
+    auto& ring = rings_[type];
+
+    D3D12_DESCRIPTOR_HEAP_DESC heapDesc;
+    {
+        heapDesc.Type           = type;
+        heapDesc.NumDescriptors = numDescriptors;
+        heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+        heapDesc.NodeMask       = 0;
+    }
+    auto hr = device_->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(ring.heap.ReleaseAndGetAddressOf()));
+    DXThrowIfFailed(hr, "failed to create D3D12 shader-visible descriptor heap for descriptor heap pool");
+
+    ring.stride         = device_->GetDescriptorHandleIncrementSize(type);
+    ring.numDescriptors = numDescriptors;
+    ring.writePos       = 0;
+    ring.reclaimedPos   = 0;
+}
+
+bool D3D12DescriptorHeapPool::ReclaimFrame(bool wait)
+{
+    if (pendingFrames_.empty())
+        return false;
+
+    auto& frame = pendingFrames_.front();
+
+    /* Check (or wait for) the frame fence */
+    if (fence_->GetCompletedValue() < frame.fenceValue)
+    {
+        if (!wait)
+            return false;
+
+        auto hr = fence_->SetEventOnCompletion(frame.fenceValue, fenceEvent_);
+        DXThrowIfFailed(hr, "failed to set 'on completion'-event for D3D12 fence of descriptor heap pool");
+        WaitForSingleObject(fenceEvent_, INFINITE);
+    }
+
+    /* Reclaim ring space of the frame */
+    rings_[0].reclaimedPos = frame.writeEnd[0];
+    rings_[1].reclaimedPos = frame.writeEnd[1];
+    pendingFrames_.pop();
+
+    return true;
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorHeapPool::CopyDescriptorsIfChanged(ID3D12DescriptorHeap* srcHeap)
+{
+    /* Return cached descriptor table if the source heap was already copied during this recording */
+    for (const auto& entry : bindCache_)
+    {
+        if (entry.srcHeap == srcHeap)
+            return entry.gpuDescHandle;
+    }
+
+    const auto  heapDesc    = srcHeap->GetDesc();
+    auto&       ring        = rings_[heapDesc.Type];
+
+    /* Copy descriptors from the CPU-only source heap into the reserved ring range */
+    const auto offset = ReserveRange(ring, heapDesc.NumDescriptors);
+
+    auto cpuDescHandle = ring.heap->GetCPUDescriptorHandleForHeapStart();
+    cpuDescHandle.ptr += static_cast<SIZE_T>(offset) * ring.stride;
+
+    device_->CopyDescriptorsSimple(heapDesc.NumDescriptors, cpuDescHandle, srcHeap->GetCPUDescriptorHandleForHeapStart(), heapDesc.Type);
+
+    auto gpuDescHandle = ring.heap->GetGPUDescriptorHandleForHeapStart();
+    gpuDescHandle.ptr += offset * ring.stride;
+
+    /* Cache descriptor table so subsequent binds of the same resource heap only re-bind it */
+    CacheEntry entry;
+    {
+        entry.srcHeap       = srcHeap;
+        entry.gpuDescHandle = gpuDescHandle;
+    }
+    bindCache_.push_back(entry);
+
+    return gpuDescHandle;
+}
+
+UINT64 D3D12DescriptorHeapPool::ReserveRange(Ring& ring, UINT numDescriptors)
+{
+    const UINT64 ringSize = ring.numDescriptors;
+
+    if (numDescriptors > ringSize)
+        throw std::runtime_error("descriptor count of resource heap exceeds capacity of D3D12 descriptor heap pool");
+
+    /* Skip the padding at the end of the ring if the range would wrap around; descriptor tables must be contiguous */
+    const auto wrapOffset = ring.writePos % ringSize;
+    if (wrapOffset + numDescriptors > ringSize)
+        ring.writePos += (ringSize - wrapOffset);
+
+    /* Wait for the oldest pending frames until the ring has enough free space; only happens when the ring is over-committed */
+    while (ring.writePos + numDescriptors > ring.reclaimedPos + ringSize)
+    {
+        if (!ReclaimFrame(true))
+            throw std::runtime_error("exceeded capacity of D3D12 descriptor heap pool within a single command list recording");
+    }
+
+    const auto offset = ring.writePos % ringSize;
+    ring.writePos += numDescriptors;
+
+    return offset;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,123 @@
+/*
+ * D3D12DescriptorHeapPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_D3D12_DESCRIPTOR_HEAP_POOL_H
+#define LLGL_D3D12_DESCRIPTOR_HEAP_POOL_H
+
+
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <queue>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class D3D12ResourceHeap;
+
+/*
+Pool of shader-visible descriptor heaps, one heap per descriptor heap type (CBV/SRV/UAV and samplers).
+Each heap is managed as a ring allocator with virtual write positions: descriptors of a resource heap are copied
+into the ring when the resource heap is bound, and the ring space is reclaimed once the fence of the queue
+submission that referenced it has completed. Descriptor tables that were already copied during the current
+command list recording are only re-bound, not re-copied.
+*/
+class D3D12DescriptorHeapPool
+{
+
+    public:
+
+        D3D12DescriptorHeapPool() = default;
+        D3D12DescriptorHeapPool(ID3D12Device* device);
+
+        D3D12DescriptorHeapPool(const D3D12DescriptorHeapPool&) = delete;
+        D3D12DescriptorHeapPool& operator = (const D3D12DescriptorHeapPool&) = delete;
+
+        ~D3D12DescriptorHeapPool();
+
+        // Initializes the device object and creates the shader-visible descriptor heaps.
+        void InitializeDevice(ID3D12Device* device);
+
+        // Resets the pool for a new command list recording: reclaims completed frames and clears the bind cache.
+        void Reset();
+
+        // Copies the descriptors of the specified resource heap into the rings (unless already copied
+        // during this recording) and binds the root descriptor tables to the specified command list.
+        void BindResourceHeap(ID3D12GraphicsCommandList* commandList, const D3D12ResourceHeap& resourceHeap, bool isGraphicsPipeline);
+
+        // Signals the fence on the specified command queue to retire the ring space written since the last signal.
+        void SignalFrame(ID3D12CommandQueue* commandQueue);
+
+        // Invalidates the cached heap bindings, e.g. after an external SetDescriptorHeaps call (mip-map generation).
+        void InvalidateBoundHeaps();
+
+    private:
+
+        // Ring allocator within one shader-visible descriptor heap; positions are virtual (in descriptors) and must be taken modulo the heap size.
+        struct Ring
+        {
+            ComPtr<ID3D12DescriptorHeap>    heap;
+            UINT                            stride          = 0;
+            UINT                            numDescriptors  = 0;
+            UINT64                          writePos        = 0;
+            UINT64                          reclaimedPos    = 0;
+        };
+
+        // Ring space written by one queue submission; reclaimed once its fence value has completed.
+        struct Frame
+        {
+            UINT64 fenceValue;
+            UINT64 writeEnd[2];
+        };
+
+        // Descriptor table that was already copied into the rings during the current recording.
+        struct CacheEntry
+        {
+            ID3D12DescriptorHeap*       srcHeap;
+            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle;
+        };
+
+    private:
+
+        void CreateFence();
+        void CreateRing(const D3D12_DESCRIPTOR_HEAP_TYPE type, UINT numDescriptors);
+
+        bool ReclaimFrame(bool wait);
+
+        D3D12_GPU_DESCRIPTOR_HANDLE CopyDescriptorsIfChanged(ID3D12DescriptorHeap* srcHeap);
+
+        UINT64 ReserveRange(Ring& ring, UINT numDescriptors);
+
+    private:
+
+        ID3D12Device*           device_         = nullptr;
+
+        Ring                    rings_[2];                  // Indexed by D3D12_DESCRIPTOR_HEAP_TYPE (CBV_SRV_UAV and SAMPLER)
+
+        ComPtr<ID3D12Fence>     fence_;
+        HANDLE                  fenceEvent_     = 0;
+        UINT64                  fenceValue_     = 0;
+
+        std::queue<Frame>       pendingFrames_;
+        std::vector<CacheEntry> bindCache_;
+
+        bool                    heapsBound_     = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -50,17 +50,39 @@ static DWORD NanosecsToMillisecs(UINT64 t)
 }
 
 bool D3D12Fence::Wait(UINT64 timeout)
+{
+    return WaitValue(value_, timeout);
+}
+
+bool D3D12Fence::WaitValue(UINT64 value, UINT64 timeout)
 {
     /* Wait until the fence has been crossed */
-    if (fence_->GetCompletedValue() < value_)
+    if (fence_->GetCompletedValue() < value)
     {
-        auto hr = fence_->SetEventOnCompletion(value_, event_);
+        auto hr = fence_->SetEventOnCompletion(value, event_);
         DXThrowIfFailed(hr, "failed to set 'on completion'-event for D3D12 fence");
         return (WaitForSingleObject(event_, NanosecsToMillisecs(timeout)) == WAIT_OBJECT_0);
     }
     return true;
 }
 
+void D3D12Fence::UpdateValue(UINT64 value)
+{
+    if (value > value_)
+        value_ = value;
+}
+
+HANDLE D3D12Fence::ScheduleCompletionEvent()
+{
+    if (fence_->GetCompletedValue() < value_)
+    {
+        auto hr = fence_->SetEventOnCompletion(value_, event_);
+        DXThrowIfFailed(hr, "failed to set 'on completion'-event for D3D12 fence");
+        return event_;
+    }
+    return nullptr;
+}
+
 
 } // /namespace LLGL
 
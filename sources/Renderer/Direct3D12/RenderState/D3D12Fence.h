@@ -32,9 +32,30 @@ class D3D12Fence final : public Fence
 
         bool Wait(UINT64 timeout);
 
+        // Waits until the fence has reached the specified value.
+        bool WaitValue(UINT64 value, UINT64 timeout);
+
         // Returns the next value to be used as fence signal.
         UINT64 NextValue();
 
+        // Raises the value of the last scheduled fence signal to the specified value.
+        void UpdateValue(UINT64 value);
+
+        // Registers the fence event to fire once the last scheduled signal has completed; returns null if it already has.
+        HANDLE ScheduleCompletionEvent();
+
+        // Returns the value of the last scheduled fence signal.
+        inline UINT64 GetValue() const
+        {
+            return value_;
+        }
+
+        // Returns the last value the fence has reached on the GPU timeline.
+        inline UINT64 GetCompletedValue() const
+        {
+            return fence_->GetCompletedValue();
+        }
+
         // Returns the native ID3D12Fence object.
         inline ID3D12Fence* GetNative() const
         {
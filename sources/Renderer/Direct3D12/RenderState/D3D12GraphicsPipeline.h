@@ -51,6 +51,18 @@ class D3D12GraphicsPipeline final : public GraphicsPipeline
             return scissorEnabled_;
         }
 
+        // Returns the root parameter index of the 32-bit root constants, or 0xFFFFFFFF if the pipeline layout has no uniform range.
+        inline UINT GetRootConstantsIndex() const
+        {
+            return rootConstantsIndex_;
+        }
+
+        // Returns the number of 32-bit values in the root constant range.
+        inline UINT GetNumRootConstants() const
+        {
+            return numRootConstants_;
+        }
+
     private:
 
         void CreatePipelineState(
@@ -69,6 +81,8 @@ class D3D12GraphicsPipeline final : public GraphicsPipeline
 
         ComPtr<ID3D12PipelineState> pipelineState_;
         ID3D12RootSignature*        rootSignature_      = nullptr;
+        UINT                        rootConstantsIndex_ = ~0u;
+        UINT                        numRootConstants_   = 0;
 
         D3D12_PRIMITIVE_TOPOLOGY    primitiveTopology_  = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
         FLOAT                       blendFactor_[4]     = { 0.0f, 0.0f, 0.0f, 0.0f };
@@ -30,7 +30,7 @@ void D3D12PipelineLayout::SetName(const char* name)
 void D3D12PipelineLayout::CreateRootSignature(ID3D12Device* device, const PipelineLayoutDescriptor& desc)
 {
     D3D12RootSignature rootSignature;
-    rootSignature.Reset(static_cast<UINT>(desc.bindings.size()), 0);
+    rootSignature.Reset(static_cast<UINT>(desc.bindings.size()) + (desc.uniformRange.size > 0 ? 1 : 0), 0);
 
     /* Build root parameter for each descriptor range type */
     BuildRootParameter(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_CBV,     desc, ResourceType::Buffer,  BindFlags::ConstantBuffer );
@@ -40,6 +40,9 @@ void D3D12PipelineLayout::CreateRootSignature(ID3D12Device* device, const Pipeli
     BuildRootParameter(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     desc, ResourceType::Texture, BindFlags::Storage        );
     BuildRootParameter(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, desc, ResourceType::Sampler, 0                         );
 
+    /* Build root constants for the uniform range (if any) */
+    BuildRootConstants(rootSignature, desc);
+
     /* Get root signature flags */
     D3D12_ROOT_SIGNATURE_FLAGS signatureFlags = D3D12_ROOT_SIGNATURE_FLAG_NONE;
     BuildRootSignatureFlags(signatureFlags, desc);
@@ -93,6 +96,21 @@ void D3D12PipelineLayout::BuildRootParameter(
     }
 }
 
+void D3D12PipelineLayout::BuildRootConstants(
+    D3D12RootSignature&             rootSignature,
+    const PipelineLayoutDescriptor& layoutDesc)
+{
+    if (layoutDesc.uniformRange.size > 0)
+    {
+        /* Append root constants as last root parameter, so the indices of the descriptor tables are unaffected */
+        rootConstantsIndex_ = rootSignature.GetNumRootParameters();
+        numRootConstants_   = (layoutDesc.uniformRange.size + 3) / 4;
+
+        auto rootParam = rootSignature.AppendRootParameter();
+        rootParam->InitAsConstants(layoutDesc.uniformRange.slot, numRootConstants_);
+    }
+}
+
 //TODO: properly enable D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT and D3D12_ROOT_SIGNATURE_FLAG_ALLOW_STREAM_OUTPUT
 void D3D12PipelineLayout::BuildRootSignatureFlags(
     D3D12_ROOT_SIGNATURE_FLAGS&     signatureFlags,
@@ -101,7 +119,7 @@ void D3D12PipelineLayout::BuildRootSignatureFlags(
     signatureFlags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
 
     /* Determine which shader stages are not used for any binding points */
-    long stageFlags = 0;
+    long stageFlags = layoutDesc.uniformRange.stageFlags;
     for (const auto& binding : layoutDesc.bindings)
         stageFlags |= binding.stageFlags;
 
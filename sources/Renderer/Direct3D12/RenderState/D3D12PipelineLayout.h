@@ -46,6 +46,18 @@ class D3D12PipelineLayout final : public PipelineLayout
             return rootSignature_.Get();
         }
 
+        // Returns the root parameter index of the 32-bit root constants, or 0xFFFFFFFF if the layout has no uniform range.
+        inline UINT GetRootConstantsIndex() const
+        {
+            return rootConstantsIndex_;
+        }
+
+        // Returns the number of 32-bit values in the root constant range.
+        inline UINT GetNumRootConstants() const
+        {
+            return numRootConstants_;
+        }
+
     private:
 
         void BuildRootParameter(
@@ -56,6 +68,11 @@ class D3D12PipelineLayout final : public PipelineLayout
             long                            bindFlags
         );
 
+        void BuildRootConstants(
+            D3D12RootSignature&             rootSignature,
+            const PipelineLayoutDescriptor& layoutDesc
+        );
+
         void BuildRootSignatureFlags(
             D3D12_ROOT_SIGNATURE_FLAGS&     signatureFlags,
             const PipelineLayoutDescriptor& layoutDesc
@@ -65,6 +82,8 @@ class D3D12PipelineLayout final : public PipelineLayout
 
         ComPtr<ID3D12RootSignature> rootSignature_;
         std::vector<long>           bindFlags_;
+        UINT                        rootConstantsIndex_ = ~0u;
+        UINT                        numRootConstants_   = 0;
 
 };
 
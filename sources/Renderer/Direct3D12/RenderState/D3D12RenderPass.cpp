@@ -15,7 +15,8 @@ namespace LLGL
 
 
 D3D12RenderPass::D3D12RenderPass(const RenderPassDescriptor& desc) :
-    numColorAttachments_ { static_cast<UINT>(desc.colorAttachments.size()) }
+    numColorAttachments_  { static_cast<UINT>(desc.colorAttachments.size()) },
+    readOnlyDepthStencil_ { desc.readOnlyDepthStencil                       }
 {
     /* Check which color attachment must be cleared */
     FillClearColorAttachmentIndices(clearColorAttachments_, desc);
@@ -22,18 +22,33 @@ namespace LLGL
 {
 
 
-D3D12ResourceHeap::D3D12ResourceHeap(ID3D12Device* device, const ResourceHeapDescriptor& desc)
+D3D12ResourceHeap::D3D12ResourceHeap(ID3D12Device* device, const ResourceHeapDescriptor& desc) :
+    device_ { device },
+    desc_   { desc   }
 {
-    /* Create descriptor heaps */
-    auto cpuDescHandleCbvSrvUav = CreateHeapTypeCbvSrvUav(device, desc);
-    auto cpuDescHandleSampler   = CreateHeapTypeSampler(device, desc);
+    CreateAllDescriptors();
+}
 
-    /* Create descriptors */
-    std::size_t bindingIndex = 0;
-    CreateConstantBufferViews(device, desc, cpuDescHandleCbvSrvUav, bindingIndex);
-    CreateShaderResourceViews(device, desc, cpuDescHandleCbvSrvUav, bindingIndex);
-    CreateUnorderedAccessViews(device, desc, cpuDescHandleCbvSrvUav, bindingIndex);
-    CreateSamplers(device, desc, cpuDescHandleSampler);
+void D3D12ResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews)
+{
+    /* Validate descriptor range */
+    if (firstDescriptor + numResourceViews > desc_.resourceViews.size())
+        throw std::invalid_argument("failed to update resource heap due to out-of-bounds descriptor range");
+
+    /* Patch the stored resource views */
+    for (std::uint32_t i = 0; i < numResourceViews; ++i)
+        desc_.resourceViews[firstDescriptor + i] = resourceViews[i];
+
+    /*
+    The CPU-only descriptor heaps are only read when their descriptors are copied into a shader-visible
+    heap at bind time, so all descriptors can be rewritten from the patched resource views right away;
+    the heaps themselves are reused unless the mix of view and sampler descriptors has changed
+    */
+    numDescriptorHeaps_ = 0;
+    descriptorHeaps_[0] = nullptr;
+    descriptorHeaps_[1] = nullptr;
+
+    CreateAllDescriptors();
 }
 
 void D3D12ResourceHeap::SetName(const char* name)
@@ -52,6 +67,24 @@ static void ErrNullPointerInResource()
     throw std::invalid_argument("cannot create resource heap with null pointer in resource view");
 }
 
+void D3D12ResourceHeap::CreateAllDescriptors()
+{
+    /* Create descriptor heaps (or reuse them if their sizes are unchanged) */
+    auto cpuDescHandleCbvSrvUav = CreateHeapTypeCbvSrvUav(device_, desc_);
+    auto cpuDescHandleSampler   = CreateHeapTypeSampler(device_, desc_);
+
+    /* Create descriptors */
+    std::size_t bindingIndex = 0;
+    CreateConstantBufferViews(device_, desc_, cpuDescHandleCbvSrvUav, bindingIndex);
+    CreateShaderResourceViews(device_, desc_, cpuDescHandleCbvSrvUav, bindingIndex);
+    CreateUnorderedAccessViews(device_, desc_, cpuDescHandleCbvSrvUav, bindingIndex);
+    CreateSamplers(device_, desc_, cpuDescHandleSampler);
+
+    /* Gather referenced resources for residency tracking */
+    residencySet_.clear();
+    GatherResidencySet(desc_);
+}
+
 D3D12_CPU_DESCRIPTOR_HANDLE D3D12ResourceHeap::CreateHeapTypeCbvSrvUav(ID3D12Device* device, const ResourceHeapDescriptor& desc)
 {
     /* Determine number of view descriptors */
@@ -72,12 +105,19 @@ D3D12_CPU_DESCRIPTOR_HANDLE D3D12ResourceHeap::CreateHeapTypeCbvSrvUav(ID3D12Dev
 
     if (numDescriptors > 0)
     {
-        /* Create descriptor heap for views (CBV, SRV, UAV) */
+        /* Reuse the previous heap for an in-place update if its size is unchanged */
+        if (heapTypeCbvSrvUav_ != nullptr && heapTypeCbvSrvUav_->GetDesc().NumDescriptors == numDescriptors)
+        {
+            AppendDescriptorHeapToArray(heapTypeCbvSrvUav_.Get());
+            return heapTypeCbvSrvUav_->GetCPUDescriptorHandleForHeapStart();
+        }
+
+        /* Create CPU-only descriptor heap for views (CBV, SRV, UAV); descriptors are copied into a shader-visible heap when the resource heap is bound */
         D3D12_DESCRIPTOR_HEAP_DESC heapDesc;
         {
             heapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
             heapDesc.NumDescriptors = numDescriptors;
-            heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+            heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
             heapDesc.NodeMask       = 0;
         }
         auto hr = device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(heapTypeCbvSrvUav_.ReleaseAndGetAddressOf()));
@@ -111,12 +151,19 @@ D3D12_CPU_DESCRIPTOR_HANDLE D3D12ResourceHeap::CreateHeapTypeSampler(ID3D12Devic
 
     if (numDescriptors > 0)
     {
-        /* Create descriptor heap for samplers */
+        /* Reuse the previous heap for an in-place update if its size is unchanged */
+        if (heapTypeSampler_ != nullptr && heapTypeSampler_->GetDesc().NumDescriptors == numDescriptors)
+        {
+            AppendDescriptorHeapToArray(heapTypeSampler_.Get());
+            return heapTypeSampler_->GetCPUDescriptorHandleForHeapStart();
+        }
+
+        /* Create CPU-only descriptor heap for samplers; descriptors are copied into a shader-visible heap when the resource heap is bound */
         D3D12_DESCRIPTOR_HEAP_DESC heapDesc;
         {
             heapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER;
             heapDesc.NumDescriptors = numDescriptors;
-            heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+            heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
             heapDesc.NodeMask       = 0;
         }
         auto hr = device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(heapTypeSampler_.ReleaseAndGetAddressOf()));
@@ -295,6 +342,35 @@ void D3D12ResourceHeap::CreateSamplers(
     );
 }
 
+void D3D12ResourceHeap::GatherResidencySet(const ResourceHeapDescriptor& desc)
+{
+    for (const auto& resourceView : desc.resourceViews)
+    {
+        if (auto resource = resourceView.resource)
+        {
+            switch (resource->GetResourceType())
+            {
+                case ResourceType::Buffer:
+                {
+                    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, *resource);
+                    residencySet_.push_back(bufferD3D.GetNative());
+                }
+                break;
+
+                case ResourceType::Texture:
+                {
+                    auto& textureD3D = LLGL_CAST(D3D12Texture&, *resource);
+                    residencySet_.push_back(textureD3D.GetNative());
+                }
+                break;
+
+                default:
+                break;
+            }
+        }
+    }
+}
+
 void D3D12ResourceHeap::AppendDescriptorHeapToArray(ID3D12DescriptorHeap* descriptorHeap)
 {
     descriptorHeaps_[numDescriptorHeaps_++] = descriptorHeap;
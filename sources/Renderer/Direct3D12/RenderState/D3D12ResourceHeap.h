@@ -10,8 +10,10 @@
 
 
 #include <LLGL/ResourceHeap.h>
+#include <LLGL/ResourceHeapFlags.h>
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
+#include <vector>
 
 
 namespace LLGL
@@ -29,7 +31,10 @@ class D3D12ResourceHeap final : public ResourceHeap
 
         D3D12ResourceHeap(ID3D12Device* device, const ResourceHeapDescriptor& desc);
 
-        // Returns the array of D3D descriptor heaps.
+        // Updates the specified range of resource views in place by rewriting the descriptors in the CPU-only descriptor heaps.
+        void WriteResourceViews(std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews);
+
+        // Returns the array of CPU-only D3D descriptor heaps; their descriptors are copied into a shader-visible heap when the resource heap is bound.
         inline ID3D12DescriptorHeap* const* GetDescriptorHeaps() const
         {
             return descriptorHeaps_;
@@ -41,8 +46,18 @@ class D3D12ResourceHeap final : public ResourceHeap
             return numDescriptorHeaps_;
         }
 
+        // Returns the list of buffer and texture resources referenced by this resource heap; used for residency tracking.
+        inline const std::vector<ID3D12Pageable*>& GetResidencySet() const
+        {
+            return residencySet_;
+        }
+
     private:
 
+        void CreateAllDescriptors();
+
+        void GatherResidencySet(const ResourceHeapDescriptor& desc);
+
         D3D12_CPU_DESCRIPTOR_HANDLE CreateHeapTypeCbvSrvUav(ID3D12Device* device, const ResourceHeapDescriptor& desc);
         D3D12_CPU_DESCRIPTOR_HANDLE CreateHeapTypeSampler(ID3D12Device* device, const ResourceHeapDescriptor& desc);
 
@@ -77,12 +92,17 @@ class D3D12ResourceHeap final : public ResourceHeap
 
     private:
 
+        ID3D12Device*                   device_             = nullptr;  // Non-owning reference to the D3D device
+        ResourceHeapDescriptor          desc_;                          // Copy of the descriptor; kept to rewrite descriptors for in-place updates
+
         ComPtr<ID3D12DescriptorHeap>    heapTypeCbvSrvUav_;
         ComPtr<ID3D12DescriptorHeap>    heapTypeSampler_;
 
         ID3D12DescriptorHeap*           descriptorHeaps_[2] = {};   // References to the ComPtr objects
         UINT                            numDescriptorHeaps_ = 0;
 
+        std::vector<ID3D12Pageable*>    residencySet_;              // Buffer and texture resources referenced by this heap
+
 };
 
 
@@ -35,6 +35,12 @@ class D3D12RootSignature
 
         ComPtr<ID3D12RootSignature> Finalize(ID3D12Device* device, D3D12_ROOT_SIGNATURE_FLAGS flags = D3D12_ROOT_SIGNATURE_FLAG_NONE);
 
+        // Returns the number of root parameters that have been appended so far.
+        inline UINT GetNumRootParameters() const
+        {
+            return static_cast<UINT>(rootParams_.size());
+        }
+
         inline const D3D12RootParameter& operator [] (std::size_t idx) const
         {
             return rootParams_[idx];
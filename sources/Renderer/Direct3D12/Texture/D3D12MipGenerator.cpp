@@ -13,6 +13,7 @@
 #include "../D3DX12/d3dx12.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../DXCommon/DXTypes.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -257,7 +258,7 @@ void D3D12MipGenerator::GenerateMips1D(
             commandContext.SetPipelineState(pipelines1D_[nonPowerOfTwo].Get());
 
         /* Determine how many MIP-maps can be downsampled at once; must be in [1, 8] */
-        UINT numMips = (mipLevel + 8 >= mipLevelEnd ? mipLevelEnd - mipLevel : 8);
+        UINT numMips = std::min(8u, mipLevelEnd - mipLevel - 1);
 
         /* Run compute shader to generate next four MIP-maps */
         commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstWidth), 0);
@@ -280,7 +281,11 @@ void D3D12MipGenerator::GenerateMips1D(
         mipLevel += numMips;
     }
 
-    commandContext.TransitionResource(resource, resource.usageState, true);
+    /*
+    Defer transition back to the usage state, so that consecutive GenerateMips calls
+    (e.g. for batches of streamed textures) merge their barriers into a single flush
+    */
+    commandContext.TransitionResource(resource, resource.usageState);
 }
 
 void D3D12MipGenerator::GenerateMips2D(
@@ -329,7 +334,7 @@ void D3D12MipGenerator::GenerateMips2D(
             commandContext.SetPipelineState(pipelines2D_[nonPowerOfTwo].Get());
 
         /* Determine how many MIP-maps can be downsampled at once; must be in [1, 4] */
-        UINT numMips = (mipLevel + 4 >= mipLevelEnd ? mipLevelEnd - mipLevel : 4);
+        UINT numMips = std::min(4u, mipLevelEnd - mipLevel - 1);
 
         /* Run compute shader to generate next four MIP-maps */
         commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstWidth), 0);
@@ -353,7 +358,11 @@ void D3D12MipGenerator::GenerateMips2D(
         mipLevel += numMips;
     }
 
-    commandContext.TransitionResource(resource, resource.usageState, true);
+    /*
+    Defer transition back to the usage state, so that consecutive GenerateMips calls
+    (e.g. for batches of streamed textures) merge their barriers into a single flush
+    */
+    commandContext.TransitionResource(resource, resource.usageState);
 }
 
 void D3D12MipGenerator::GenerateMips3D(
@@ -404,7 +413,7 @@ void D3D12MipGenerator::GenerateMips3D(
             commandContext.SetPipelineState(pipelines3D_[nonPowerOfTwo].Get());
 
         /* Determine how many MIP-maps can be downsampled at once; must be in [1, 3] */
-        UINT numMips = (mipLevel + 3 >= mipLevelEnd ? mipLevelEnd - mipLevel : 3);
+        UINT numMips = std::min(3u, mipLevelEnd - mipLevel - 1);
 
         /* Run compute shader to generate next four MIP-maps */
         commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstWidth), 0);
@@ -428,7 +437,11 @@ void D3D12MipGenerator::GenerateMips3D(
         mipLevel += numMips;
     }
 
-    commandContext.TransitionResource(resource, resource.usageState, true);
+    /*
+    Defer transition back to the usage state, so that consecutive GenerateMips calls
+    (e.g. for batches of streamed textures) merge their barriers into a single flush
+    */
+    commandContext.TransitionResource(resource, resource.usageState);
 }
 
 
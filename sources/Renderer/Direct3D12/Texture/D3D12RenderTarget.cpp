@@ -60,13 +60,19 @@ const RenderPass* D3D12RenderTarget::GetRenderPass() const
     return nullptr; // dummy
 }
 
-void D3D12RenderTarget::TransitionToOutputMerger(D3D12CommandContext& commandContext)
+void D3D12RenderTarget::TransitionToOutputMerger(D3D12CommandContext& commandContext, bool readOnlyDepthStencil)
 {
     for (auto& resource : colorBuffers_)
         commandContext.TransitionResource(*resource, D3D12_RESOURCE_STATE_RENDER_TARGET);
 
     if (depthStencil_ != nullptr)
-        commandContext.TransitionResource(*depthStencil_, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+    {
+        /* With a read-only DSV, keep the depth buffer readable as shader resource while it is bound */
+        if (readOnlyDepthStencil)
+            commandContext.TransitionResource(*depthStencil_, D3D12_RESOURCE_STATE_DEPTH_READ | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+        else
+            commandContext.TransitionResource(*depthStencil_, D3D12_RESOURCE_STATE_DEPTH_WRITE);
+    }
 
     commandContext.FlushResourceBarrieres();
 }
@@ -107,12 +113,16 @@ D3D12_CPU_DESCRIPTOR_HANDLE D3D12RenderTarget::GetCPUDescriptorHandleForRTV() co
         return {};
 }
 
-D3D12_CPU_DESCRIPTOR_HANDLE D3D12RenderTarget::GetCPUDescriptorHandleForDSV() const
+D3D12_CPU_DESCRIPTOR_HANDLE D3D12RenderTarget::GetCPUDescriptorHandleForDSV(bool readOnly) const
 {
     if (dsvDescHeap_)
-        return dsvDescHeap_->GetCPUDescriptorHandleForHeapStart();
-    else
-        return {};
+    {
+        auto cpuDescHandle = dsvDescHeap_->GetCPUDescriptorHandleForHeapStart();
+        if (readOnly)
+            cpuDescHandle.ptr += dsvDescSize_;
+        return cpuDescHandle;
+    }
+    return {};
 }
 
 bool D3D12RenderTarget::HasMultiSampling() const
@@ -183,7 +193,7 @@ void D3D12RenderTarget::CreateDescriptorHeaps(D3D12Device& device, const RenderT
         D3D12_DESCRIPTOR_HEAP_DESC heapDesc;
         {
             heapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_DSV;
-            heapDesc.NumDescriptors = 1;
+            heapDesc.NumDescriptors = 2; // default DSV and read-only DSV
             heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
             heapDesc.NodeMask       = 0;
         }
@@ -191,6 +201,15 @@ void D3D12RenderTarget::CreateDescriptorHeaps(D3D12Device& device, const RenderT
     }
 }
 
+// Returns the DSV flags to bind the specified depth-stencil format as read-only
+static D3D12_DSV_FLAGS GetReadOnlyFlagsDSV(DXGI_FORMAT format)
+{
+    auto flags = D3D12_DSV_FLAG_READ_ONLY_DEPTH;
+    if (DXTypes::HasStencilComponent(format))
+        flags |= D3D12_DSV_FLAG_READ_ONLY_STENCIL;
+    return flags;
+}
+
 void D3D12RenderTarget::CreateAttachments(ID3D12Device* device, const RenderTargetDescriptor& desc)
 {
     /* Get CPU descriptor heap start for RTVs */
@@ -201,6 +220,9 @@ void D3D12RenderTarget::CreateAttachments(ID3D12Device* device, const RenderTarg
         rtvDescSize_    = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
     }
 
+    if (dsvDescHeap_)
+        dsvDescSize_ = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
+
     /* Create multi-sampled texture resources first */
     if (HasMultiSampling())
         CreateColorBuffersMS(device, desc, cpuDescHandle);
@@ -227,6 +249,16 @@ void D3D12RenderTarget::CreateAttachments(ID3D12Device* device, const RenderTarg
             /* Create internal depth-stencil buffer and default DSV */
             CreateDepthStencil(device, depthStencilFormat_);
             device->CreateDepthStencilView(depthStencilBuffer_.Get(), nullptr, dsvDescHeap_->GetCPUDescriptorHandleForHeapStart());
+
+            /* Create read-only DSV for render passes that sample the depth buffer while it is bound */
+            D3D12_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
+            {
+                dsvDesc.Format          = depthStencilFormat_;
+                dsvDesc.ViewDimension   = (HasMultiSampling() ? D3D12_DSV_DIMENSION_TEXTURE2DMS : D3D12_DSV_DIMENSION_TEXTURE2D);
+                dsvDesc.Flags           = GetReadOnlyFlagsDSV(depthStencilFormat_);
+            }
+            device->CreateDepthStencilView(depthStencilBuffer_.Get(), &dsvDesc, GetCPUDescriptorHandleForDSV(true));
+
             depthStencil_ = &depthStencilBuffer_;
         }
     }
@@ -448,6 +480,11 @@ void D3D12RenderTarget::CreateSubresourceDSV(
 
     /* Create DSV and store reference to resource */
     device->CreateDepthStencilView(resource.Get(), &dsvDesc, dsvDescHeap_->GetCPUDescriptorHandleForHeapStart());
+
+    /* Create read-only DSV for render passes that sample the depth buffer while it is bound */
+    dsvDesc.Flags = GetReadOnlyFlagsDSV(dsvDesc.Format);
+    device->CreateDepthStencilView(resource.Get(), &dsvDesc, GetCPUDescriptorHandleForDSV(true));
+
     depthStencil_ = &resource;
 }
 
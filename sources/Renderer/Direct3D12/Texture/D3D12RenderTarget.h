@@ -43,11 +43,13 @@ class D3D12RenderTarget final : public RenderTarget
 
         D3D12RenderTarget(D3D12Device& device, const RenderTargetDescriptor& desc);
 
-        void TransitionToOutputMerger(D3D12CommandContext& commandContext);
+        void TransitionToOutputMerger(D3D12CommandContext& commandContext, bool readOnlyDepthStencil = false);
         void ResolveRenderTarget(D3D12CommandContext& commandContext);
 
         D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForRTV() const;
-        D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForDSV() const;
+
+        // Returns the CPU descriptor handle for the DSV; optionally the read-only DSV, so the depth buffer can be sampled while bound.
+        D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForDSV(bool readOnly = false) const;
 
         bool HasMultiSampling() const;
 
@@ -106,6 +108,7 @@ class D3D12RenderTarget final : public RenderTarget
         UINT                            rtvDescSize_        = 0;
 
         ComPtr<ID3D12DescriptorHeap>    dsvDescHeap_;
+        UINT                            dsvDescSize_        = 0;
         D3D12Resource                   depthStencilBuffer_;
         DXGI_FORMAT                     depthStencilFormat_ = DXGI_FORMAT_UNKNOWN;
 
@@ -10,6 +10,7 @@
 #include "../D3DX12/d3dx12.h"
 #include "../../DXCommon/DXCore.h"
 #include "../D3D12Types.h"
+#include "../../../Core/Helper.h"
 #include <algorithm>
 
 
@@ -17,14 +18,15 @@ namespace LLGL
 {
 
 
-D3D12Texture::D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc) :
+D3D12Texture::D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc, D3D12HeapPool* heapPool) :
     Texture         { desc.type                    },
     format_         { D3D12Types::Map(desc.format) },
     numMipLevels_   { NumMipLevels(desc)           },
     numArrayLayers_ { desc.arrayLayers             },
     bindFlags_      { desc.bindFlags               }
 {
-    CreateNativeTexture(device, desc);
+    CreateNativeTexture(device, desc, heapPool);
+    CacheSubresourceFootprints(device);
     if (SupportsGenerateMips())
         CreateMipDescHeap(device);
 }
@@ -146,8 +148,10 @@ void D3D12Texture::UpdateSubresource(
     firstArrayLayer = std::min(firstArrayLayer, numArrayLayers_ - 1u);
     numArrayLayers  = std::min(numArrayLayers, numArrayLayers_ - firstArrayLayer);
 
-    /* Create the GPU upload buffer */
-    UINT64 uploadBufferSize     = GetRequiredIntermediateSize(resource_.native.Get(), 0, 1) * numArrayLayers;
+    /* Create the GPU upload buffer; all array layers of a MIP-map level share the same footprint */
+    const auto& footprint = GetSubresourceFootprint(CalcSubresource(mipLevel, firstArrayLayer));
+
+    UINT64 uploadBufferSize     = footprint.alignedSize * numArrayLayers;
     UINT64 uploadBufferOffset   = 0;
 
     auto hr = device->CreateCommittedResource(
@@ -163,22 +167,28 @@ void D3D12Texture::UpdateSubresource(
     /* Upload subresource for each array layer */
     for (UINT arrayLayer = 0; arrayLayer < numArrayLayers; ++arrayLayer)
     {
-        /* Update subresource for current array layer */
+        /* Update subresource for current array layer with the cached footprint instead of re-querying it from the device */
         UINT subresourceIndex = CalcSubresource(mipLevel, firstArrayLayer + arrayLayer);
 
+        auto placedFootprint = footprint.placedFootprint;
+        placedFootprint.Offset = uploadBufferOffset;
+
         UpdateSubresources(
             commandList,            // pCmdList
             resource_.native.Get(), // pDestinationResource
             uploadBuffer.Get(),     // pIntermediate
-            uploadBufferOffset,     // IntermediateOffset
             subresourceIndex,       // FirstSubresource
             1,                      // NumSubresources
+            footprint.alignedSize,  // RequiredSize
+            &placedFootprint,       // pLayouts
+            &(footprint.numRows),   // pNumRows
+            &(footprint.rowSize),   // pRowSizesInBytes
             &subresourceData        // pSrcData
         );
 
         /* Move to next buffer region */
         subresourceData.pData = (reinterpret_cast<const std::int8_t*>(subresourceData.pData) + subresourceData.SlicePitch);
-        uploadBufferOffset += subresourceData.SlicePitch;
+        uploadBufferOffset += footprint.alignedSize;
     }
 
     /* Transition texture resource for shader access */
@@ -519,7 +529,7 @@ static void Convert(D3D12_RESOURCE_DESC& dst, const TextureDescriptor& src)
     }
 }
 
-void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc)
+void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc, D3D12HeapPool* heapPool)
 {
     /* Setup resource descriptor by texture descriptor and create hardware resource */
     D3D12_RESOURCE_DESC descD3D;
@@ -544,16 +554,43 @@ void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescri
         optClearValue.DepthStencil.Stencil  = static_cast<UINT8>(desc.clearValue.stencil);
     }
 
-    /* Create hardware resource for the texture */
-    auto hr = device->CreateCommittedResource(
-        &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
-        D3D12_HEAP_FLAG_NONE,
-        &descD3D,
-        D3D12_RESOURCE_STATE_COPY_DEST,
-        (useClearValue ? &optClearValue : nullptr),
-        IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
-    );
-    DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 hardware texture");
+    /*
+    Try to place the texture into a pooled heap first to avoid an implicit heap allocation per texture.
+    RT/DS textures are excluded, since placed resources must be initialized with a clear or copy operation on first use,
+    which cannot be guaranteed for render target attachments.
+    */
+    if (heapPool != nullptr && !useClearValue)
+    {
+        const auto allocInfo = device->GetResourceAllocationInfo(0, 1, &descD3D);
+        heapRegion_ = heapPool->Allocate(descD3D, allocInfo);
+    }
+
+    if (heapRegion_.heap != nullptr)
+    {
+        /* Create hardware resource for the texture as placed resource within the pooled heap */
+        auto hr = device->CreatePlacedResource(
+            heapRegion_.heap,
+            heapRegion_.offset,
+            &descD3D,
+            D3D12_RESOURCE_STATE_COPY_DEST,
+            nullptr,
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 hardware texture (placed)");
+    }
+    else
+    {
+        /* Create hardware resource for the texture as committed resource */
+        auto hr = device->CreateCommittedResource(
+            &CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
+            D3D12_HEAP_FLAG_NONE,
+            &descD3D,
+            D3D12_RESOURCE_STATE_COPY_DEST,
+            (useClearValue ? &optClearValue : nullptr),
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 hardware texture");
+    }
 
     /* Determine resource usage */
     if ((desc.bindFlags & BindFlags::DepthStencilAttachment) != 0)
@@ -562,6 +599,39 @@ void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescri
         resource_.SetInitialState(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
 }
 
+void D3D12Texture::CacheSubresourceFootprints(ID3D12Device* device)
+{
+    const auto desc = resource_.native->GetDesc();
+
+    /* 3D textures have one subresource per MIP-map level; all other types have one per MIP-map level and array layer */
+    const UINT numSubresources = numMipLevels_ * (desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D ? 1u : desc.DepthOrArraySize);
+
+    std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT>  layouts(numSubresources);
+    std::vector<UINT>                                numRows(numSubresources);
+    std::vector<UINT64>                              rowSizes(numSubresources);
+
+    /* Query copyable footprints for all subresources once; the upload and readback paths only index the cached table */
+    device->GetCopyableFootprints(&desc, 0, numSubresources, 0, layouts.data(), numRows.data(), rowSizes.data(), nullptr);
+
+    subresourceFootprints_.resize(numSubresources);
+
+    for (UINT i = 0; i < numSubresources; ++i)
+    {
+        auto& footprint = subresourceFootprints_[i];
+
+        footprint.placedFootprint           = layouts[i];
+        footprint.placedFootprint.Offset    = 0;
+        footprint.numRows                   = numRows[i];
+        footprint.rowSize                   = rowSizes[i];
+
+        /* Round size up to the texture data placement alignment, so footprints can be packed into one upload buffer */
+        footprint.alignedSize = GetAlignedSize<UINT64>(
+            static_cast<UINT64>(layouts[i].Footprint.RowPitch) * numRows[i] * layouts[i].Footprint.Depth,
+            D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT
+        );
+    }
+}
+
 // Determine SRV dimension for descriptor heaps used in D3D12MipGenerator: either 1D array, 2D array, or 3D
 static D3D12_SRV_DIMENSION GetMipChainSRVDimension(const TextureType type)
 {
@@ -11,6 +11,7 @@
 
 #include <LLGL/Texture.h>
 #include "../D3D12Resource.h"
+#include "../D3D12HeapPool.h"
 #include <vector>
 
 
@@ -18,6 +19,16 @@ namespace LLGL
 {
 
 
+// Cached copyable footprint of a single texture subresource (see ID3D12Device::GetCopyableFootprints).
+struct D3D12SubresourceFootprint
+{
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT  placedFootprint;        // Footprint with zero base offset; patch 'Offset' per upload buffer
+    UINT                                numRows         = 0;    // Number of rows the subresource occupies
+    UINT64                              rowSize         = 0;    // Unpadded size of a single row (in bytes)
+    UINT64                              alignedSize     = 0;    // Aligned size the subresource occupies in an upload buffer (in bytes)
+};
+
+
 class D3D12Texture final : public Texture
 {
 
@@ -31,7 +42,7 @@ class D3D12Texture final : public Texture
 
     public:
 
-        D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc);
+        D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc, D3D12HeapPool* heapPool = nullptr);
 
         void UpdateSubresource(
             ID3D12Device*               device,
@@ -66,6 +77,12 @@ class D3D12Texture final : public Texture
         // Returns true if MIP-maps can be generated for this texture .
         bool SupportsGenerateMips() const;
 
+        // Returns the cached copyable footprint of the specified subresource (see CalcSubresource).
+        inline const D3D12SubresourceFootprint& GetSubresourceFootprint(UINT subresource) const
+        {
+            return subresourceFootprints_[subresource];
+        }
+
         // Returns the resource wrapper.
         inline D3D12Resource& GetResource()
         {
@@ -84,6 +101,18 @@ class D3D12Texture final : public Texture
             return resource_.native.Get();
         }
 
+        // Returns the pooled heap region this texture was placed in; the heap is null for committed resources.
+        inline const D3D12HeapRegion& GetHeapRegion() const
+        {
+            return heapRegion_;
+        }
+
+        // Returns true if this texture was created as placed resource within a pooled heap.
+        inline bool IsPlacedResource() const
+        {
+            return (heapRegion_.heap != nullptr);
+        }
+
         // Returns the hardware resource format.
         inline DXGI_FORMAT GetFormat() const
         {
@@ -122,7 +151,9 @@ class D3D12Texture final : public Texture
 
     private:
 
-        void CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc);
+        void CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc, D3D12HeapPool* heapPool);
+
+        void CacheSubresourceFootprints(ID3D12Device* device);
 
         void CreateShaderResourceViewPrimary(
             ID3D12Device*               device,
@@ -146,6 +177,7 @@ class D3D12Texture final : public Texture
     private:
 
         D3D12Resource                   resource_;
+        D3D12HeapRegion                 heapRegion_;
 
         DXGI_FORMAT                     format_         = DXGI_FORMAT_UNKNOWN;
         UINT                            numMipLevels_   = 0;
@@ -154,6 +186,8 @@ class D3D12Texture final : public Texture
 
         ComPtr<ID3D12DescriptorHeap>    mipDescHeap_;
 
+        std::vector<D3D12SubresourceFootprint> subresourceFootprints_;
+
 };
 
 
@@ -0,0 +1,592 @@
+/*
+ * FrameGraph.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/FrameGraph.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+// Returns true if both texture descriptors realize interchangeable texture objects
+static bool MatchTransientTextureDescs(const TextureDescriptor& lhs, const TextureDescriptor& rhs)
+{
+    return
+    (
+        lhs.type            == rhs.type             &&
+        lhs.bindFlags       == rhs.bindFlags        &&
+        lhs.cpuAccessFlags  == rhs.cpuAccessFlags   &&
+        lhs.miscFlags       == rhs.miscFlags        &&
+        lhs.format          == rhs.format           &&
+        lhs.extent          == rhs.extent           &&
+        lhs.arrayLayers     == rhs.arrayLayers      &&
+        lhs.mipLevels       == rhs.mipLevels        &&
+        lhs.samples         == rhs.samples
+    );
+}
+
+// Returns true if both buffer descriptors realize interchangeable buffer objects
+static bool MatchTransientBufferDescs(const BufferDescriptor& lhs, const BufferDescriptor& rhs)
+{
+    return
+    (
+        lhs.size                        == rhs.size                         &&
+        lhs.bindFlags                   == rhs.bindFlags                    &&
+        lhs.cpuAccessFlags              == rhs.cpuAccessFlags               &&
+        lhs.miscFlags                   == rhs.miscFlags                    &&
+        lhs.indexFormat                 == rhs.indexFormat                  &&
+        lhs.vertexAttribs               == rhs.vertexAttribs                &&
+        lhs.vertexFormatHandle          == rhs.vertexFormatHandle           &&
+        lhs.storageBuffer.storageType   == rhs.storageBuffer.storageType    &&
+        lhs.storageBuffer.format        == rhs.storageBuffer.format         &&
+        lhs.storageBuffer.stride        == rhs.storageBuffer.stride
+    );
+}
+
+FrameGraph::FrameGraph(RenderSystem& renderSystem) :
+    renderSystem_ { renderSystem }
+{
+}
+
+FrameGraph::~FrameGraph()
+{
+    for (auto& entry : resourcePool_)
+    {
+        if (entry.type == TransientType::Texture)
+            renderSystem_.Release(*static_cast<Texture*>(entry.resource));
+        else
+            renderSystem_.Release(*static_cast<Buffer*>(entry.resource));
+    }
+
+    if (graphicsCmdBuffer_ != nullptr)
+        renderSystem_.Release(*graphicsCmdBuffer_);
+    if (computeCmdBuffer_ != nullptr)
+        renderSystem_.Release(*computeCmdBuffer_);
+    if (computeFence_ != nullptr)
+        renderSystem_.Release(*computeFence_);
+}
+
+FrameGraphResource FrameGraph::DeclareTexture(const TextureDescriptor& desc)
+{
+    ResourceEntry entry;
+    {
+        entry.type          = TransientType::Texture;
+        entry.textureDesc   = desc;
+    }
+    resources_.push_back(std::move(entry));
+    return static_cast<FrameGraphResource>(resources_.size() - 1);
+}
+
+FrameGraphResource FrameGraph::DeclareBuffer(const BufferDescriptor& desc)
+{
+    ResourceEntry entry;
+    {
+        entry.type          = TransientType::Buffer;
+        entry.bufferDesc    = desc;
+    }
+    resources_.push_back(std::move(entry));
+    return static_cast<FrameGraphResource>(resources_.size() - 1);
+}
+
+FrameGraphResource FrameGraph::ImportResource(Resource& resource)
+{
+    ResourceEntry entry;
+    {
+        entry.type      = TransientType::Imported;
+        entry.realized  = &resource;
+    }
+    resources_.push_back(std::move(entry));
+    return static_cast<FrameGraphResource>(resources_.size() - 1);
+}
+
+std::uint32_t FrameGraph::AddPass(const FrameGraphPassDescriptor& desc, const PassCallback& callback)
+{
+    if (!callback)
+        throw std::invalid_argument("cannot add frame graph pass without callback");
+
+    for (const auto& usage : desc.reads)
+    {
+        if (usage.resource >= resources_.size())
+            throw std::invalid_argument("invalid resource handle in reads of frame graph pass");
+    }
+    for (const auto& usage : desc.writes)
+    {
+        if (usage.resource >= resources_.size())
+            throw std::invalid_argument("invalid resource handle in writes of frame graph pass");
+    }
+
+    PassEntry pass;
+    {
+        pass.desc       = desc;
+        pass.callback   = callback;
+    }
+    passes_.push_back(std::move(pass));
+
+    return static_cast<std::uint32_t>(passes_.size() - 1);
+}
+
+void FrameGraph::Execute()
+{
+    if (passes_.empty())
+        return;
+
+    /* Discard the split transitions of a previous execution of the same declarations */
+    for (auto& pass : passes_)
+    {
+        pass.beginTransitions.clear();
+        pass.endTransitions.clear();
+    }
+
+    /* Determine which passes contribute to observable outputs */
+    std::vector<bool> livePasses;
+    MarkLivePasses(livePasses);
+
+    /* Assign each live pass to the graphics (0) or the compute (1) timeline */
+    std::vector<int> timelines;
+    const bool graphicsWaitsOnCompute = AssignQueues(livePasses, timelines);
+
+    /* Build the per-timeline schedules; declaration order already satisfies all intra-timeline dependencies */
+    std::vector<std::size_t> schedules[2];
+    for (std::size_t i = 0; i < passes_.size(); ++i)
+    {
+        if (livePasses[i])
+            schedules[timelines[i]].push_back(i);
+    }
+
+    /* Realize the transient resources and recycle pool entries that fell out of use */
+    RealizeTransientResources(schedules);
+    ReleaseUnusedPoolEntries();
+
+    /* Determine the split transitions between producers and their first consumers */
+    RecordSplitTransitions(schedules[0]);
+    RecordSplitTransitions(schedules[1]);
+
+    /* Record and submit the compute timeline first, so the graphics queue can overlap or wait on it */
+    if (!schedules[1].empty())
+    {
+        auto computeCmdBuffer = GetOrCreateComputeCommandBuffer();
+
+        computeCmdBuffer->Begin();
+        RecordPasses(*computeCmdBuffer, schedules[1]);
+        computeCmdBuffer->End();
+
+        auto computeQueue = renderSystem_.GetCommandQueue(CommandQueueType::Compute);
+        computeQueue->Submit(*computeCmdBuffer);
+
+        /* Only synchronize the queues if a graphics pass actually consumes compute results */
+        if (graphicsWaitsOnCompute)
+        {
+            computeQueue->Submit(*computeFence_);
+            renderSystem_.GetCommandQueue()->Wait(*computeFence_);
+        }
+    }
+
+    if (!schedules[0].empty())
+    {
+        auto graphicsCmdBuffer = GetOrCreateGraphicsCommandBuffer();
+
+        graphicsCmdBuffer->Begin();
+        RecordPasses(*graphicsCmdBuffer, schedules[0]);
+        graphicsCmdBuffer->End();
+
+        renderSystem_.GetCommandQueue()->Submit(*graphicsCmdBuffer);
+    }
+}
+
+void FrameGraph::Reset()
+{
+    resources_.clear();
+    passes_.clear();
+}
+
+Texture* FrameGraph::GetTexture(FrameGraphResource resource) const
+{
+    if (resource < resources_.size())
+    {
+        const auto& entry = resources_[resource];
+        if (entry.realized != nullptr && entry.realized->GetResourceType() == ResourceType::Texture)
+            return static_cast<Texture*>(entry.realized);
+    }
+    return nullptr;
+}
+
+Buffer* FrameGraph::GetBuffer(FrameGraphResource resource) const
+{
+    if (resource < resources_.size())
+    {
+        const auto& entry = resources_[resource];
+        if (entry.realized != nullptr && entry.realized->GetResourceType() == ResourceType::Buffer)
+            return static_cast<Buffer*>(entry.realized);
+    }
+    return nullptr;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void FrameGraph::MarkLivePasses(std::vector<bool>& livePasses) const
+{
+    livePasses.resize(passes_.size());
+
+    std::vector<bool> neededResources(resources_.size(), false);
+
+    for (std::size_t i = passes_.size(); i-- > 0;)
+    {
+        const auto& pass = passes_[i];
+
+        /* A pass is live if it has declared side effects or produces no graph-visible outputs at all */
+        bool live = (pass.desc.hasSideEffects || pass.desc.writes.empty());
+
+        /* It is also live if it writes an imported resource or feeds a live pass */
+        for (const auto& write : pass.desc.writes)
+        {
+            if (resources_[write.resource].type == TransientType::Imported || neededResources[write.resource])
+            {
+                live = true;
+                break;
+            }
+        }
+
+        livePasses[i] = live;
+
+        if (live)
+        {
+            for (const auto& read : pass.desc.reads)
+                neededResources[read.resource] = true;
+
+            /* Writes also need the previous contents, since passes may write their targets only partially (e.g. blending) */
+            for (const auto& write : pass.desc.writes)
+                neededResources[write.resource] = true;
+        }
+    }
+}
+
+bool FrameGraph::AssignQueues(const std::vector<bool>& livePasses, std::vector<int>& timelines) const
+{
+    timelines.assign(passes_.size(), 0);
+
+    const bool hasComputeQueue = (renderSystem_.GetNumCommandQueues(CommandQueueType::Compute) > 0);
+
+    /* Per-resource state since the last write, to derive dependencies across the queue split */
+    struct ResourceState
+    {
+        bool written            = false;
+        bool writerOnCompute    = false;
+        bool hasGraphicsAccess  = false;
+        bool hasComputeAccess   = false;
+    };
+    std::vector<ResourceState> states(resources_.size());
+
+    bool graphicsWaitsOnCompute = false;
+
+    for (std::size_t i = 0; i < passes_.size(); ++i)
+    {
+        if (!livePasses[i])
+            continue;
+
+        const auto& pass = passes_[i];
+
+        /* A pass only moves to the compute queue if all of its producers run there as well */
+        bool onCompute = (pass.desc.queueType == CommandQueueType::Compute && hasComputeQueue);
+
+        if (onCompute)
+        {
+            for (const auto& read : pass.desc.reads)
+            {
+                const auto& state = states[read.resource];
+                if (state.written && !state.writerOnCompute)
+                    onCompute = false;
+            }
+            for (const auto& write : pass.desc.writes)
+            {
+                /* Writing a resource a graphics pass has touched would reorder that access behind the compute submission */
+                const auto& state = states[write.resource];
+                if ((state.written && !state.writerOnCompute) || state.hasGraphicsAccess)
+                    onCompute = false;
+            }
+        }
+
+        if (!onCompute)
+        {
+            /* Track whether any graphics pass consumes or overwrites compute results; only then must the graphics queue wait */
+            for (const auto& read : pass.desc.reads)
+            {
+                const auto& state = states[read.resource];
+                if (state.written && state.writerOnCompute)
+                    graphicsWaitsOnCompute = true;
+            }
+            for (const auto& write : pass.desc.writes)
+            {
+                const auto& state = states[write.resource];
+                if ((state.written && state.writerOnCompute) || state.hasComputeAccess)
+                    graphicsWaitsOnCompute = true;
+            }
+        }
+
+        /* Update the per-resource states with the accesses of this pass */
+        for (const auto& read : pass.desc.reads)
+        {
+            auto& state = states[read.resource];
+            if (onCompute)
+                state.hasComputeAccess = true;
+            else
+                state.hasGraphicsAccess = true;
+        }
+        for (const auto& write : pass.desc.writes)
+        {
+            auto& state = states[write.resource];
+            state.written           = true;
+            state.writerOnCompute   = onCompute;
+            state.hasGraphicsAccess = !onCompute;
+            state.hasComputeAccess  = onCompute;
+        }
+
+        timelines[i] = (onCompute ? 1 : 0);
+    }
+
+    return graphicsWaitsOnCompute;
+}
+
+void FrameGraph::RealizeTransientResources(const std::vector<std::size_t>* schedules)
+{
+    /* Determine the lifetime of each transient resource within its timeline */
+    struct UsageSpan
+    {
+        bool        used            = false;
+        bool        onBothTimelines = false;
+        int         timeline        = 0;
+        std::size_t first           = 0;
+        std::size_t last            = 0;
+    };
+    std::vector<UsageSpan> spans(resources_.size());
+
+    for (int timeline = 0; timeline < 2; ++timeline)
+    {
+        for (std::size_t pos = 0; pos < schedules[timeline].size(); ++pos)
+        {
+            const auto& pass = passes_[schedules[timeline][pos]];
+
+            auto MarkUsage = [&spans, timeline, pos](const FrameGraphResourceUsage& usage)
+            {
+                auto& span = spans[usage.resource];
+                if (!span.used)
+                {
+                    span.used       = true;
+                    span.timeline   = timeline;
+                    span.first      = pos;
+                    span.last       = pos;
+                }
+                else if (span.timeline != timeline)
+                    span.onBothTimelines = true;
+                else
+                    span.last = pos;
+            };
+
+            for (const auto& read : pass.desc.reads)
+                MarkUsage(read);
+            for (const auto& write : pass.desc.writes)
+                MarkUsage(write);
+        }
+    }
+
+    /* Mark all pool entries as free for this frame */
+    for (auto& entry : resourcePool_)
+        entry.timeline = -1;
+
+    /* Realize the transients in order of first use, so entries whose lifetimes have ended can be aliased */
+    for (int timeline = 0; timeline < 2; ++timeline)
+    {
+        for (std::size_t passIndex : schedules[timeline])
+        {
+            const auto& pass = passes_[passIndex];
+
+            auto RealizeUsage = [this, &spans](const FrameGraphResourceUsage& usage)
+            {
+                auto& resourceEntry = resources_[usage.resource];
+                if (resourceEntry.type == TransientType::Imported || resourceEntry.realized != nullptr)
+                    return;
+
+                /* Transients used on both timelines are realized, but never share an object within this frame */
+                const auto& span = spans[usage.resource];
+                const int entryTimeline = (span.onBothTimelines ? 2 : span.timeline);
+
+                auto poolEntry = FindPoolEntry(resourceEntry, entryTimeline, span.first);
+                if (poolEntry == nullptr)
+                {
+                    /* Create new pool entry for the transient resource */
+                    PoolEntry newEntry;
+                    {
+                        newEntry.type = resourceEntry.type;
+                        if (resourceEntry.type == TransientType::Texture)
+                        {
+                            newEntry.textureDesc    = resourceEntry.textureDesc;
+                            newEntry.resource       = renderSystem_.CreateTexture(resourceEntry.textureDesc);
+                        }
+                        else
+                        {
+                            newEntry.bufferDesc     = resourceEntry.bufferDesc;
+                            newEntry.resource       = renderSystem_.CreateBuffer(resourceEntry.bufferDesc);
+                        }
+                    }
+                    resourcePool_.push_back(std::move(newEntry));
+                    poolEntry = &(resourcePool_.back());
+                }
+
+                poolEntry->timeline         = entryTimeline;
+                poolEntry->lastUse          = span.last;
+                poolEntry->numIdleFrames    = 0;
+
+                resourceEntry.realized = poolEntry->resource;
+            };
+
+            for (const auto& read : pass.desc.reads)
+                RealizeUsage(read);
+            for (const auto& write : pass.desc.writes)
+                RealizeUsage(write);
+        }
+    }
+}
+
+void FrameGraph::ReleaseUnusedPoolEntries()
+{
+    /* Keep unused entries alive for a few frames, so alternating declarations do not re-allocate every frame */
+    static const std::uint32_t maxNumIdleFrames = 3;
+
+    for (auto it = resourcePool_.begin(); it != resourcePool_.end();)
+    {
+        if (it->timeline == -1 && ++(it->numIdleFrames) > maxNumIdleFrames)
+        {
+            if (it->type == TransientType::Texture)
+                renderSystem_.Release(*static_cast<Texture*>(it->resource));
+            else
+                renderSystem_.Release(*static_cast<Buffer*>(it->resource));
+            it = resourcePool_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+void FrameGraph::RecordSplitTransitions(const std::vector<std::size_t>& schedule)
+{
+    /* Last write to each resource on this timeline that has not been consumed yet */
+    struct WriteState
+    {
+        bool        written     = false;
+        bool        consumed    = false;
+        std::size_t writer      = 0;
+    };
+    std::vector<WriteState> writeStates(resources_.size());
+
+    for (std::size_t passIndex : schedule)
+    {
+        auto& pass = passes_[passIndex];
+
+        for (const auto& read : pass.desc.reads)
+        {
+            auto& state = writeStates[read.resource];
+            if (state.written && !state.consumed && state.writer != passIndex)
+            {
+                /* Begin the transition right after the producer and end it right before its first consumer;
+                   subsequent consumers rely on the implicit state tracking of the backend */
+                FrameGraphResourceUsage transition;
+                {
+                    transition.resource     = read.resource;
+                    transition.bindFlags    = read.bindFlags;
+                }
+                passes_[state.writer].beginTransitions.push_back(transition);
+                pass.endTransitions.push_back(transition);
+                state.consumed = true;
+            }
+        }
+
+        for (const auto& write : pass.desc.writes)
+        {
+            auto& state = writeStates[write.resource];
+            state.written   = true;
+            state.consumed  = false;
+            state.writer    = passIndex;
+        }
+    }
+}
+
+void FrameGraph::RecordPasses(CommandBuffer& commandBuffer, const std::vector<std::size_t>& schedule)
+{
+    for (std::size_t passIndex : schedule)
+    {
+        auto& pass = passes_[passIndex];
+
+        /* Finish the split transitions of the inputs of this pass */
+        for (const auto& usage : pass.endTransitions)
+            commandBuffer.EndResourceTransition(*(resources_[usage.resource].realized), usage.bindFlags);
+
+        pass.callback(commandBuffer);
+
+        /* Begin the transitions of the outputs towards their first consumers */
+        for (const auto& usage : pass.beginTransitions)
+            commandBuffer.BeginResourceTransition(*(resources_[usage.resource].realized), usage.bindFlags);
+    }
+}
+
+CommandBuffer* FrameGraph::GetOrCreateGraphicsCommandBuffer()
+{
+    if (graphicsCmdBuffer_ == nullptr)
+        graphicsCmdBuffer_ = renderSystem_.CreateCommandBuffer();
+    return graphicsCmdBuffer_;
+}
+
+CommandBuffer* FrameGraph::GetOrCreateComputeCommandBuffer()
+{
+    if (computeCmdBuffer_ == nullptr)
+    {
+        CommandBufferDescriptor computeCmdBufferDesc;
+        {
+            computeCmdBufferDesc.flags = CommandBufferFlags::ComputeOnly;
+        }
+        computeCmdBuffer_   = renderSystem_.CreateCommandBuffer(computeCmdBufferDesc);
+        computeFence_       = renderSystem_.CreateFence();
+    }
+    return computeCmdBuffer_;
+}
+
+FrameGraph::PoolEntry* FrameGraph::FindPoolEntry(const ResourceEntry& resourceEntry, int timeline, std::size_t firstUse)
+{
+    for (auto& entry : resourcePool_)
+    {
+        if (entry.type != resourceEntry.type)
+            continue;
+
+        if (entry.type == TransientType::Texture)
+        {
+            if (!MatchTransientTextureDescs(entry.textureDesc, resourceEntry.textureDesc))
+                continue;
+        }
+        else
+        {
+            if (!MatchTransientBufferDescs(entry.bufferDesc, resourceEntry.bufferDesc))
+                continue;
+        }
+
+        /* Reusable if untouched this frame, or aliasable if its lifetime on the same timeline has already ended */
+        if (entry.timeline == -1 || (timeline < 2 && entry.timeline == timeline && entry.lastUse < firstUse))
+            return &entry;
+    }
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
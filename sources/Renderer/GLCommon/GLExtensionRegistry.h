@@ -70,6 +70,7 @@ enum class GLExt
     ARB_texture_storage,
     ARB_texture_storage_multisample,
     ARB_buffer_storage,
+    ARB_map_buffer_range,               // GL 3.0
     ARB_copy_buffer,                    // GL 3.1
     ARB_copy_image,                     // GL 4.3
     ARB_polygon_offset_clamp,
@@ -79,6 +80,8 @@ enum class GLExt
     ARB_draw_indirect,
     ARB_multi_draw_indirect,
     ARB_direct_state_access,            // GL 4.5
+    ARB_bindless_texture,               // GL 4.0 (hardware dependent)
+    ARB_texture_barrier,                // GL 4.5
 
     /* Extensions without procedures */
     ARB_texture_cube_map,
@@ -87,6 +90,7 @@ enum class GLExt
     ARB_geometry_shader4,
     NV_conservative_raster,
     INTEL_conservative_rasterization,
+    NVX_gpu_memory_info,
 
     /* Enumeration entry counter */
     Count,
@@ -0,0 +1,100 @@
+/*
+ * GPUCullingPass.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/GPUCullingPass.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+GPUCullingPass::GPUCullingPass(RenderSystem& renderSystem, std::uint32_t maxNumDraws) :
+    renderSystem_ { renderSystem },
+    maxNumDraws_  { maxNumDraws  }
+{
+    if (maxNumDraws == 0)
+        throw std::invalid_argument("cannot create GPU culling pass with zero draw commands");
+
+    /* Create argument buffer the culling shader appends the visible draw commands to */
+    BufferDescriptor argumentBufferDesc;
+    {
+        argumentBufferDesc.size                 = sizeof(DrawIndexedIndirectArguments) * maxNumDraws;
+        argumentBufferDesc.bindFlags            = (BindFlags::IndirectBuffer | BindFlags::Storage);
+        argumentBufferDesc.storageBuffer.stride = sizeof(DrawIndexedIndirectArguments);
+    }
+    argumentBuffer_ = renderSystem_.CreateBuffer(argumentBufferDesc);
+
+    /* Create count buffer that holds the 32-bit draw count at offset zero */
+    BufferDescriptor countBufferDesc;
+    {
+        countBufferDesc.size                    = sizeof(std::uint32_t);
+        countBufferDesc.bindFlags               = (BindFlags::IndirectBuffer | BindFlags::Storage);
+        countBufferDesc.storageBuffer.stride    = sizeof(std::uint32_t);
+    }
+    countBuffer_ = renderSystem_.CreateBuffer(countBufferDesc);
+
+    /* Cache support for indirect draw counts to select the draw path in RecordDraws */
+    hasDrawIndirectCount_ = renderSystem_.GetRenderingCaps().features.hasDrawIndirectCount;
+}
+
+GPUCullingPass::~GPUCullingPass()
+{
+    renderSystem_.Release(*argumentBuffer_);
+    renderSystem_.Release(*countBuffer_);
+}
+
+void GPUCullingPass::RecordCulling(
+    CommandBuffer&      commandBuffer,
+    ComputePipeline&    pipeline,
+    ResourceHeap&       resourceHeap,
+    std::uint32_t       numInstances,
+    std::uint32_t       workGroupSize)
+{
+    if (workGroupSize == 0)
+        throw std::invalid_argument("cannot record GPU culling pass with zero work group size");
+
+    /* Reset draw count before the culling shader starts appending commands */
+    const std::uint32_t zeroCount = 0;
+    commandBuffer.UpdateBuffer(*countBuffer_, 0, &zeroCount, sizeof(zeroCount));
+
+    /* Dispatch culling pipeline with one invocation per instance */
+    commandBuffer.SetComputePipeline(pipeline);
+    commandBuffer.SetComputeResourceHeap(resourceHeap, 0);
+    commandBuffer.Dispatch((numInstances + workGroupSize - 1) / workGroupSize, 1, 1);
+
+    /* Begin transition of the output buffers towards their use as indirect argument sources */
+    commandBuffer.BeginResourceTransition(*argumentBuffer_, BindFlags::IndirectBuffer);
+    commandBuffer.BeginResourceTransition(*countBuffer_, BindFlags::IndirectBuffer);
+}
+
+void GPUCullingPass::RecordDraws(CommandBuffer& commandBuffer)
+{
+    /* Make the compute shader writes visible to the indirect draw */
+    commandBuffer.EndResourceTransition(*argumentBuffer_, BindFlags::IndirectBuffer);
+    commandBuffer.EndResourceTransition(*countBuffer_, BindFlags::IndirectBuffer);
+
+    if (hasDrawIndirectCount_)
+    {
+        /* Consume only as many commands as the culling shader emitted */
+        commandBuffer.DrawIndexedIndirect(*argumentBuffer_, 0, *countBuffer_, 0, maxNumDraws_, sizeof(DrawIndexedIndirectArguments));
+    }
+    else
+    {
+        /* Consume the entire argument buffer; culled slots must have been zero-filled by the culling shader */
+        commandBuffer.DrawIndexedIndirect(*argumentBuffer_, 0, maxNumDraws_, sizeof(DrawIndexedIndirectArguments));
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -18,6 +18,8 @@ namespace LLGL
 {
 
 
+class MTTransientHeapPool;
+
 class MTBuffer : public Buffer
 {
 
@@ -27,7 +29,7 @@ class MTBuffer : public Buffer
 
     public:
 
-        MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData);
+        MTBuffer(id<MTLDevice> device, MTTransientHeapPool& transientHeapPool, const BufferDescriptor& desc, const void* initialData);
         ~MTBuffer();
 
         void Write(NSUInteger dstOffset, const void* data, NSUInteger dataSize);
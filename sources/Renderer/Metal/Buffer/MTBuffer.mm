@@ -6,6 +6,7 @@
  */
 
 #include "MTBuffer.h"
+#include "../MTTransientHeapPool.h"
 #include <string.h>
 
 
@@ -23,7 +24,7 @@ static MTLResourceOptions GetMTLResourceOptions(const BufferDescriptor& desc)
         return MTLResourceStorageModeManaged;
 }
 
-MTBuffer::MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData) :
+MTBuffer::MTBuffer(id<MTLDevice> device, MTTransientHeapPool& transientHeapPool, const BufferDescriptor& desc, const void* initialData) :
     Buffer           { desc.bindFlags                        },
     indexType16Bits_ { (desc.indexFormat == Format::R16UInt) }
 {
@@ -33,6 +34,8 @@ MTBuffer::MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const voi
 
     if (initialData)
         native_ = [device newBufferWithBytes:initialData length:(NSUInteger)desc.size options:opt];
+    else if ((desc.miscFlags & MiscFlags::Transient) != 0)
+        native_ = transientHeapPool.CreateBuffer(device, (NSUInteger)desc.size, opt);
     else
         native_ = [device newBufferWithLength:(NSUInteger)desc.size options:opt];
 }
@@ -34,7 +34,7 @@ class MTCommandBuffer : public CommandBuffer
 
         /* ----- Common ----- */
 
-        MTCommandBuffer(id<MTLDevice> device, id<MTLCommandQueue> cmdQueue);
+        MTCommandBuffer(id<MTLDevice> device, id<MTLCommandQueue> cmdQueue, const CommandBufferDescriptor& desc);
         ~MTCommandBuffer();
 
         /* ----- Encoding ----- */
@@ -199,6 +199,12 @@ class MTCommandBuffer : public CommandBuffer
             return cmdBuffer_;
         }
 
+        // Returns true if this is a secondary command buffer that encodes into a parallel sub-encoder of a primary command buffer.
+        inline bool IsSecondaryCmdBuffer() const
+        {
+            return ((flags_ & CommandBufferFlags::DeferredSubmit) != 0);
+        }
+
     private:
 
         void SetIndexType(bool indexType16Bits);
@@ -222,6 +228,7 @@ class MTCommandBuffer : public CommandBuffer
 
         id<MTLCommandQueue>             cmdQueue_               = nil;
         id<MTLCommandBuffer>            cmdBuffer_              = nil;
+        long                            flags_                  = 0;
 
         MTEncoderScheduler              encoderScheduler_;
         std::vector<id<MTLDrawable>>    drawables_;
@@ -236,7 +243,11 @@ class MTCommandBuffer : public CommandBuffer
 
         MTClearValue                    clearValue_;
 
-        MTStagingBufferPool             stagingBufferPool_;
+        dispatch_semaphore_t            inFlightSemaphore_      = nil;
+        std::vector<MTStagingBufferPool> stagingBufferPools_;
+        std::size_t                     currentFrame_           = 0;
+
+        NSAutoreleasePool*              framePool_              = nil; // Scopes per-frame Objective-C temporaries to a single encoding (see Begin/End)
 
 };
 
@@ -28,14 +28,25 @@ namespace LLGL
 
 static const MTLSize g_defaultNumThreadsPerGroup { 1, 1, 1 };
 
-MTCommandBuffer::MTCommandBuffer(id<MTLDevice> device, id<MTLCommandQueue> cmdQueue) :
-    cmdQueue_          { cmdQueue          },
-    stagingBufferPool_ { device, USHRT_MAX }
+MTCommandBuffer::MTCommandBuffer(id<MTLDevice> device, id<MTLCommandQueue> cmdQueue, const CommandBufferDescriptor& desc) :
+    cmdQueue_ { cmdQueue   },
+    flags_    { desc.flags }
 {
+    /* Allow as many frames in flight as there are native command buffers (default is double-buffered) */
+    const auto maxNumFramesInFlight = std::max(1u, desc.numNativeBuffers);
+
+    inFlightSemaphore_ = dispatch_semaphore_create(maxNumFramesInFlight);
+
+    /* Create one staging buffer pool per frame in flight, so the GPU can still read the pools of previous frames */
+    stagingBufferPools_.reserve(maxNumFramesInFlight);
+    for (std::uint32_t i = 0; i < maxNumFramesInFlight; ++i)
+        stagingBufferPools_.emplace_back(device, USHRT_MAX);
 }
 
 MTCommandBuffer::~MTCommandBuffer()
 {
+    [framePool_ drain];
+    dispatch_release(inFlightSemaphore_);
     [cmdBuffer_ release];
 }
 
@@ -43,12 +54,33 @@ MTCommandBuffer::~MTCommandBuffer()
 
 void MTCommandBuffer::Begin()
 {
-    /* Allocate new command buffer from command queue */
-    cmdBuffer_ = [cmdQueue_ commandBuffer];
+    /* Open per-frame autorelease pool, so Objective-C temporaries of this encoding are drained at "End" instead of piling up in the caller's pool */
+    [framePool_ drain];
+    framePool_ = [[NSAutoreleasePool alloc] init];
+
+    if (!IsSecondaryCmdBuffer())
+    {
+        /* Wait until the next frame slot becomes available, so CPU encoding of this frame overlaps GPU execution of the previous ones */
+        dispatch_semaphore_wait(inFlightSemaphore_, DISPATCH_TIME_FOREVER);
 
-    /* Reset schedulers and pools */
-    encoderScheduler_.Reset(cmdBuffer_);
-    stagingBufferPool_.Reset();
+        /* Allocate new command buffer from command queue; must be retained as it has to outlive the per-frame pool for submission */
+        [cmdBuffer_ release];
+        cmdBuffer_ = [[cmdQueue_ commandBuffer] retain];
+
+        /* Release the frame slot as soon as the GPU has completed this command buffer */
+        dispatch_semaphore_t inFlightSemaphore = inFlightSemaphore_;
+        [cmdBuffer_ addCompletedHandler:^(id<MTLCommandBuffer>)
+        {
+            dispatch_semaphore_signal(inFlightSemaphore);
+        }];
+
+        /* Reset encoder scheduler; secondary command buffers encode into an adopted sub-encoder (see "Execute") */
+        encoderScheduler_.Reset(cmdBuffer_);
+    }
+
+    /* Rotate and reset per-frame staging buffer pool */
+    currentFrame_ = (currentFrame_ + 1) % stagingBufferPools_.size();
+    stagingBufferPools_[currentFrame_].Reset();
 
     /* Reset references */
     numThreadsPerGroup_ = &g_defaultNumThreadsPerGroup;
@@ -58,11 +90,24 @@ void MTCommandBuffer::End()
 {
     encoderScheduler_.Flush();
     PresentDrawables();
+
+    /* Drain per-frame autorelease pool; all native encoders have been ended and the drawables are queued for presentation */
+    [framePool_ drain];
+    framePool_ = nil;
 }
 
 void MTCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
-    //TODO
+    auto& commandBufferMT = LLGL_CAST(MTCommandBuffer&, deferredCommandBuffer);
+    if (commandBufferMT.IsSecondaryCmdBuffer())
+    {
+        /*
+        Hand a parallel sub-encoder of the current render pass over to the secondary command buffer;
+        its commands are executed at this point of the pass, but can be encoded concurrently on a
+        worker thread until the secondary command buffer is ended (which must precede "EndRenderPass").
+        */
+        commandBufferMT.encoderScheduler_.AdoptRenderEncoder(encoderScheduler_.MakeParallelSubEncoder());
+    }
 }
 
 /* ----- Blitting ----- */
@@ -79,7 +124,7 @@ void MTCommandBuffer::UpdateBuffer(
     id<MTLBuffer> srcBuffer = nil;
     NSUInteger srcOffset = 0;
 
-    stagingBufferPool_.Write(data, static_cast<NSUInteger>(dataSize), srcBuffer, srcOffset);
+    stagingBufferPools_[currentFrame_].Write(data, static_cast<NSUInteger>(dataSize), srcBuffer, srcOffset);
 
     /* Encode blit command to copy staging buffer region to destination buffer */
     encoderScheduler_.PauseRenderEncoder();
@@ -215,7 +260,7 @@ void MTCommandBuffer::SetClearStencil(std::uint32_t stencil)
 
 void MTCommandBuffer::Clear(long flags)
 {
-    if (encoderScheduler_.GetRenderEncoder() != nil && flags != 0)
+    if (encoderScheduler_.IsInsideRenderPass() && flags != 0)
     {
         /* Make new render pass descriptor with current clear values */
         auto renderPassDesc = encoderScheduler_.CopyRenderPassDesc();
@@ -270,7 +315,7 @@ static void FillMTRenderPassDesc(MTLRenderPassDescriptor* renderPassDesc, const
 
 void MTCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
-    if (encoderScheduler_.GetRenderEncoder() != nil && numAttachments > 0)
+    if (encoderScheduler_.IsInsideRenderPass() && numAttachments > 0)
     {
         /* Make new render pass descriptor with current clear values */
         auto renderPassDesc = encoderScheduler_.CopyRenderPassDesc();
@@ -351,8 +396,7 @@ void MTCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::u
 void MTCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
 {
     auto& resourceHeapMT = LLGL_CAST(MTResourceHeap&, resourceHeap);
-    encoderScheduler_.BindComputeEncoder();
-    resourceHeapMT.BindComputeResources(encoderScheduler_.GetComputeEncoder());
+    encoderScheduler_.SetComputeResourceHeap(&resourceHeapMT);
 }
 
 void MTCommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long /*bindFlags*/, long stageFlags)
@@ -434,8 +478,7 @@ void MTCommandBuffer::SetComputePipeline(ComputePipeline& computePipeline)
 {
     /* Set compute pipeline with encoder scheduler */
     auto& computePipelineMT = LLGL_CAST(MTComputePipeline&, computePipeline);
-    encoderScheduler_.BindComputeEncoder();
-    computePipelineMT.Bind(encoderScheduler_.GetComputeEncoder());
+    encoderScheduler_.SetComputePipeline(&computePipelineMT);
 
     /* Store reference to work group size of shader program */
     if (auto shaderProgram = computePipelineMT.GetShaderProgram())
@@ -847,9 +890,9 @@ void MTCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
 
 void MTCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
-    encoderScheduler_.BindComputeEncoder();
+    auto computeEncoder = encoderScheduler_.GetComputeEncoderAndFlushComputeState();
     MTLSize numGroups = { numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ };
-    [encoderScheduler_.GetComputeEncoder()
+    [computeEncoder
         dispatchThreadgroups:   numGroups
         threadsPerThreadgroup:  *numThreadsPerGroup_
     ];
@@ -857,9 +900,9 @@ void MTCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWo
 
 void MTCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    encoderScheduler_.BindComputeEncoder();
+    auto computeEncoder = encoderScheduler_.GetComputeEncoderAndFlushComputeState();
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
-    [encoderScheduler_.GetComputeEncoder()
+    [computeEncoder
         dispatchThreadgroupsWithIndirectBuffer: bufferMT.GetNative()
         indirectBufferOffset:                   static_cast<NSUInteger>(offset)
         threadsPerThreadgroup:                  *numThreadsPerGroup_
@@ -32,16 +32,23 @@ void MTCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
     auto& commandBufferMT = LLGL_CAST(MTCommandBuffer&, commandBuffer);
 
-    /* Commit command buffer into queue */
-    id<MTLCommandBuffer> cmdBuffer = commandBufferMT.GetNative();
-    [cmdBuffer commit];
+    /* Secondary command buffers cannot be submitted to a queue; they are encoded into a primary command buffer via the 'Execute' function */
+    if (commandBufferMT.IsSecondaryCmdBuffer())
+        return;
 
-    /* Hold reference to last submitted command buffer */
-    if (lastSubmittedCmdBuffer_ != cmdBuffer)
+    /* Commit command buffer into queue; scope Objective-C temporaries of the submission to this call */
+    @autoreleasepool
     {
-        if (lastSubmittedCmdBuffer_ != nil)
-            [lastSubmittedCmdBuffer_ release];
-        lastSubmittedCmdBuffer_ = [cmdBuffer retain];
+        id<MTLCommandBuffer> cmdBuffer = commandBufferMT.GetNative();
+        [cmdBuffer commit];
+
+        /* Hold reference to last submitted command buffer */
+        if (lastSubmittedCmdBuffer_ != cmdBuffer)
+        {
+            if (lastSubmittedCmdBuffer_ != nil)
+                [lastSubmittedCmdBuffer_ release];
+            lastSubmittedCmdBuffer_ = [cmdBuffer retain];
+        }
     }
 }
 
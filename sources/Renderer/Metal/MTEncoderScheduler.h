@@ -30,6 +30,8 @@ class MTEncoderScheduler
 
     public:
 
+        ~MTEncoderScheduler();
+
         // Resets the encoder scheduler with the new command buffer.
         void Reset(id<MTLCommandBuffer> cmdBuffer);
 
@@ -41,10 +43,22 @@ class MTEncoderScheduler
         id<MTLComputeCommandEncoder> BindComputeEncoder();
         id<MTLBlitCommandEncoder> BindBlitEncoder();
 
+        /*
+        Creates a sub-encoder of a parallel render command encoder for the current render pass.
+        The current render pass is migrated to an MTLParallelRenderCommandEncoder on the first call;
+        sub-encoders are executed in the order of their creation, but can be encoded concurrently.
+        */
+        id<MTLRenderCommandEncoder> MakeParallelSubEncoder();
+
+        // Adopts the specified render command encoder (i.e. a parallel sub-encoder created by another scheduler).
+        void AdoptRenderEncoder(id<MTLRenderCommandEncoder> renderEncoder);
+
         // Interrupts the render command encoder (if active).
         void PauseRenderEncoder();
+
+        // Resumes the render command encoder; the native encoder is re-created lazily on the next draw operation.
         void ResumeRenderEncoder();
-    
+
         // Retunrs a copy of the current render pass descriptor or null if there is none.
         MTLRenderPassDescriptor* CopyRenderPassDesc();
 
@@ -58,11 +72,18 @@ class MTEncoderScheduler
         void SetGraphicsPipeline(MTGraphicsPipeline* graphicsPipeline);
         void SetGraphicsResourceHeap(MTResourceHeap* resourceHeap);
 
+        // Stores the respective state in the internal compute encoder state.
+        void SetComputePipeline(MTComputePipeline* computePipeline);
+        void SetComputeResourceHeap(MTResourceHeap* resourceHeap);
+
     public:
     
         // Returns the current render command encoder and flushes the queued render pass.
         id<MTLRenderCommandEncoder> GetRenderEncoderAndFlushRenderPass();
 
+        // Returns the current compute command encoder and flushes the queued compute state.
+        id<MTLComputeCommandEncoder> GetComputeEncoderAndFlushComputeState();
+
         // Returns the current render command encoder.
         inline id<MTLRenderCommandEncoder> GetRenderEncoder() const
         {
@@ -80,12 +101,42 @@ class MTEncoderScheduler
         {
             return blitEncoder_;
         }
-    
+
+        // Returns true if a render pass is active, even if its native encoder is currently paused or deferred.
+        inline bool IsInsideRenderPass() const
+        {
+            return (renderEncoder_ != nil || isRenderEncoderPaused_ || isRenderEncoderDeferred_);
+        }
+
+        // Returns the number of render command encoders that have been created since the last call to "Reset".
+        inline std::uint32_t GetNumRenderEncoders() const
+        {
+            return numRenderEncoders_;
+        }
+
+        // Returns the number of compute command encoders that have been created since the last call to "Reset".
+        inline std::uint32_t GetNumComputeEncoders() const
+        {
+            return numComputeEncoders_;
+        }
+
+        // Returns the number of blit command encoders that have been created since the last call to "Reset".
+        inline std::uint32_t GetNumBlitEncoders() const
+        {
+            return numBlitEncoders_;
+        }
+
     private:
-    
+
+        MTLRenderPassDescriptor* GetOrCreateResumeRenderPassDesc();
+
+        void RebindDeferredRenderEncoder();
         void SubmitRenderEncoderState();
         void ResetRenderEncoderState();
 
+        void SubmitComputeEncoderState();
+        void ResetComputeEncoderState();
+
     private:
 
         static const NSUInteger g_maxNumVertexBuffers = 32;
@@ -103,6 +154,12 @@ class MTEncoderScheduler
             MTResourceHeap*     resourceHeap                                        = nullptr;
         };
 
+        struct MTComputeEncoderState
+        {
+            MTComputePipeline*  computePipeline = nullptr;
+            MTResourceHeap*     resourceHeap    = nullptr;
+        };
+
     private:
     
         id<MTLCommandBuffer>            cmdBuffer_              = nil;
@@ -110,11 +167,20 @@ class MTEncoderScheduler
         id<MTLRenderCommandEncoder>     renderEncoder_  	    = nil;
         id<MTLComputeCommandEncoder>    computeEncoder_         = nil;
         id<MTLBlitCommandEncoder>       blitEncoder_            = nil;
-    
+
+        id<MTLParallelRenderCommandEncoder> parallelEncoder_    = nil;
+
         MTLRenderPassDescriptor*        renderPassDesc_         = nullptr;
+        MTLRenderPassDescriptor*        resumeRenderPassDesc_   = nullptr; // Owned copy with all load actions set to 'load'; reused whenever the render pass is resumed
         MTRenderEncoderState            renderEncoderState_;
+        MTComputeEncoderState           computeEncoderState_;
 
-        bool                            isRenderEncoderPaused_  = false;
+        bool                            isRenderEncoderPaused_      = false;
+        bool                            isRenderEncoderDeferred_    = false;
+
+        std::uint32_t                   numRenderEncoders_          = 0;
+        std::uint32_t                   numComputeEncoders_         = 0;
+        std::uint32_t                   numBlitEncoders_            = 0;
 
         union
         {
@@ -130,6 +196,17 @@ class MTEncoderScheduler
         }
         dirtyBits_;
 
+        union
+        {
+            std::uint8_t bits;
+            struct
+            {
+                std::uint8_t computePipeline    : 1;
+                std::uint8_t resourceHeap       : 1;
+            };
+        }
+        computeDirtyBits_;
+
 };
 
 
@@ -17,11 +17,24 @@ namespace LLGL
 {
 
     
+MTEncoderScheduler::~MTEncoderScheduler()
+{
+    [resumeRenderPassDesc_ release];
+}
+
 void MTEncoderScheduler::Reset(id<MTLCommandBuffer> cmdBuffer)
 {
     cmdBuffer_ = cmdBuffer;
-    isRenderEncoderPaused_ = false;
+    [resumeRenderPassDesc_ release];
+    resumeRenderPassDesc_       = nullptr;
+    parallelEncoder_            = nil;
+    isRenderEncoderPaused_      = false;
+    isRenderEncoderDeferred_    = false;
+    numRenderEncoders_          = 0;
+    numComputeEncoders_         = 0;
+    numBlitEncoders_            = 0;
     ResetRenderEncoderState();
+    ResetComputeEncoderState();
 }
 
 void MTEncoderScheduler::Flush()
@@ -41,19 +54,33 @@ void MTEncoderScheduler::Flush()
         [blitEncoder_ endEncoding];
         blitEncoder_ = nil;
     }
+
+    /* End parallel render command encoder after its last sub-encoder has been ended */
+    if (parallelEncoder_ != nil)
+    {
+        [parallelEncoder_ endEncoding];
+        parallelEncoder_ = nil;
+    }
 }
 
 id<MTLRenderCommandEncoder> MTEncoderScheduler::BindRenderEncoder(MTLRenderPassDescriptor* renderPassDesc, bool primaryRenderPass)
 {
     Flush();
     renderEncoder_ = [cmdBuffer_ renderCommandEncoderWithDescriptor:renderPassDesc];
+    ++numRenderEncoders_;
 
-    /* Store descriptor for primary render pass */
+    /* Store descriptor for primary render pass and discard the cached resume descriptor of the previous pass */
     if (primaryRenderPass)
+    {
         renderPassDesc_ = renderPassDesc;
+        [resumeRenderPassDesc_ release];
+        resumeRenderPassDesc_ = nullptr;
+    }
 
-    /* A new render command encoder forces all pipeline states to be reset */
-    dirtyBits_.bits = ~0;
+    /* A new render command encoder supersedes a paused or deferred one and forces all pipeline states to be reset */
+    isRenderEncoderPaused_      = false;
+    isRenderEncoderDeferred_    = false;
+    dirtyBits_.bits             = ~0;
 
     return renderEncoder_;
 }
@@ -64,6 +91,10 @@ id<MTLComputeCommandEncoder> MTEncoderScheduler::BindComputeEncoder()
     {
         Flush();
         computeEncoder_ = [cmdBuffer_ computeCommandEncoder];
+        ++numComputeEncoders_;
+
+        /* A new compute command encoder forces all compute states to be reset */
+        computeDirtyBits_.bits = ~0;
     }
     return computeEncoder_;
 }
@@ -74,10 +105,39 @@ id<MTLBlitCommandEncoder> MTEncoderScheduler::BindBlitEncoder()
     {
         Flush();
         blitEncoder_ = [cmdBuffer_ blitCommandEncoder];
+        ++numBlitEncoders_;
     }
     return blitEncoder_;
 }
 
+id<MTLRenderCommandEncoder> MTEncoderScheduler::MakeParallelSubEncoder()
+{
+    if (parallelEncoder_ == nil)
+    {
+        /* Migrate current render pass to a parallel render command encoder by loading the previous attachment contents */
+        auto renderPassDesc = GetOrCreateResumeRenderPassDesc();
+        Flush();
+        parallelEncoder_ = [cmdBuffer_ parallelRenderCommandEncoderWithDescriptor:renderPassDesc];
+
+        /* Re-acquire an own sub-encoder lazily on the next draw operation */
+        isRenderEncoderDeferred_ = true;
+    }
+
+    ++numRenderEncoders_;
+    return [parallelEncoder_ renderCommandEncoder];
+}
+
+void MTEncoderScheduler::AdoptRenderEncoder(id<MTLRenderCommandEncoder> renderEncoder)
+{
+    Flush();
+    renderEncoder_ = renderEncoder;
+
+    /* A new render command encoder forces all pipeline states to be reset */
+    isRenderEncoderPaused_      = false;
+    isRenderEncoderDeferred_    = false;
+    dirtyBits_.bits             = ~0;
+}
+
 void MTEncoderScheduler::PauseRenderEncoder()
 {
     if (renderEncoder_ != nil && !isRenderEncoderPaused_)
@@ -88,15 +148,13 @@ void MTEncoderScheduler::ResumeRenderEncoder()
 {
     if (isRenderEncoderPaused_)
     {
-        auto renderPassDesc = CopyRenderPassDesc();
-        {
-            for (NSUInteger i = 0; i < 8; ++i)
-                renderPassDesc.colorAttachments[i].loadAction = MTLLoadActionLoad;
-            renderPassDesc.depthAttachment.loadAction = MTLLoadActionLoad;
-            renderPassDesc.stencilAttachment.loadAction = MTLLoadActionLoad;
-        }
-        BindRenderEncoder(renderPassDesc);
+        /*
+        Defer re-creation of the render command encoder until the next draw operation;
+        this allows consecutive interruptions (e.g. a series of blit commands) to share a single encoder.
+        */
         isRenderEncoderPaused_ = false;
+        if (renderEncoder_ == nil)
+            isRenderEncoderDeferred_ = true;
     }
 }
 
@@ -172,18 +230,70 @@ void MTEncoderScheduler::SetGraphicsResourceHeap(MTResourceHeap* resourceHeap)
     dirtyBits_.resourceHeap = 1;
 }
 
+void MTEncoderScheduler::SetComputePipeline(MTComputePipeline* computePipeline)
+{
+    computeEncoderState_.computePipeline = computePipeline;
+    computeDirtyBits_.computePipeline = 1;
+}
+
+void MTEncoderScheduler::SetComputeResourceHeap(MTResourceHeap* resourceHeap)
+{
+    computeEncoderState_.resourceHeap = resourceHeap;
+    computeDirtyBits_.resourceHeap = 1;
+}
+
 id<MTLRenderCommandEncoder> MTEncoderScheduler::GetRenderEncoderAndFlushRenderPass()
 {
+    if (isRenderEncoderDeferred_)
+        RebindDeferredRenderEncoder();
     if (dirtyBits_.bits != 0)
         SubmitRenderEncoderState();
     return GetRenderEncoder();
 }
 
+id<MTLComputeCommandEncoder> MTEncoderScheduler::GetComputeEncoderAndFlushComputeState()
+{
+    BindComputeEncoder();
+    if (computeDirtyBits_.bits != 0)
+        SubmitComputeEncoderState();
+    return GetComputeEncoder();
+}
+
 
 /*
  * ======= Private: =======
  */
 
+MTLRenderPassDescriptor* MTEncoderScheduler::GetOrCreateResumeRenderPassDesc()
+{
+    if (resumeRenderPassDesc_ == nullptr)
+    {
+        /* Pre-build a copy of the primary render pass descriptor that loads the previous attachment contents; reused for all subsequent resume points of this pass */
+        resumeRenderPassDesc_ = CopyRenderPassDesc();
+        for (NSUInteger i = 0; i < 8; ++i)
+            resumeRenderPassDesc_.colorAttachments[i].loadAction = MTLLoadActionLoad;
+        resumeRenderPassDesc_.depthAttachment.loadAction = MTLLoadActionLoad;
+        resumeRenderPassDesc_.stencilAttachment.loadAction = MTLLoadActionLoad;
+    }
+    return resumeRenderPassDesc_;
+}
+
+void MTEncoderScheduler::RebindDeferredRenderEncoder()
+{
+    /* Acquire an own sub-encoder if the render pass is encoded in parallel */
+    if (parallelEncoder_ != nil)
+    {
+        renderEncoder_ = [parallelEncoder_ renderCommandEncoder];
+        ++numRenderEncoders_;
+        isRenderEncoderDeferred_    = false;
+        dirtyBits_.bits             = ~0;
+        return;
+    }
+
+    /* Continue the interrupted render pass by loading the previous attachment contents */
+    BindRenderEncoder(GetOrCreateResumeRenderPassDesc());
+}
+
 void MTEncoderScheduler::SubmitRenderEncoderState()
 {
     if (renderEncoder_ != nil)
@@ -238,6 +348,32 @@ void MTEncoderScheduler::ResetRenderEncoderState()
     renderEncoderState_.resourceHeap                = nullptr;
 }
 
+void MTEncoderScheduler::SubmitComputeEncoderState()
+{
+    if (computeEncoder_ != nil)
+    {
+        if (computeEncoderState_.computePipeline != nullptr && computeDirtyBits_.computePipeline != 0)
+        {
+            /* Bind compute pipeline */
+            computeEncoderState_.computePipeline->Bind(computeEncoder_);
+        }
+        if (computeEncoderState_.resourceHeap != nullptr && computeDirtyBits_.resourceHeap != 0)
+        {
+            /* Bind resource heap */
+            computeEncoderState_.resourceHeap->BindComputeResources(computeEncoder_);
+        }
+
+        /* Reset all dirty bits */
+        computeDirtyBits_.bits = 0;
+    }
+}
+
+void MTEncoderScheduler::ResetComputeEncoderState()
+{
+    computeEncoderState_.computePipeline    = nullptr;
+    computeEncoderState_.resourceHeap       = nullptr;
+}
+
 
 } // /namespace LLGL
 
@@ -12,11 +12,13 @@
 #import <MetalKit/MetalKit.h>
 
 #include <LLGL/RenderSystem.h>
+#include <mutex>
 #include "../ContainerTypes.h"
 
 #include "MTCommandQueue.h"
 #include "MTCommandBuffer.h"
 #include "MTRenderContext.h"
+#include "MTTransientHeapPool.h"
 
 #include "Buffer/MTBuffer.h"
 #include "Buffer/MTBufferArray.h"
@@ -50,6 +52,8 @@ class MTRenderSystem : public RenderSystem
         MTRenderSystem();
         ~MTRenderSystem();
 
+        std::vector<VideoMemoryBudget> QueryVideoMemoryBudgets() const override;
+
         /* ----- Render Context ----- */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -161,11 +165,14 @@ class MTRenderSystem : public RenderSystem
 
         id<MTLDevice>                           device_             = nil;
 
+        MTTransientHeapPool                     transientHeapPool_;
+
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<MTRenderContext>      renderContexts_;
         HWObjectInstance<MTCommandQueue>        commandQueue_;
         HWObjectContainer<MTCommandBuffer>      commandBuffers_;
+        std::mutex                              commandBufferMutex_;
         HWObjectContainer<MTBuffer>             buffers_;
         HWObjectContainer<MTBufferArray>        bufferArrays_;
         HWObjectContainer<MTTexture>            textures_;
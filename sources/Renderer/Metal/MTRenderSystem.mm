@@ -32,6 +32,28 @@ MTRenderSystem::~MTRenderSystem()
     [device_ release];
 }
 
+std::vector<VideoMemoryBudget> MTRenderSystem::QueryVideoMemoryBudgets() const
+{
+    std::vector<VideoMemoryBudget> budgets;
+
+    if (@available(macOS 10.13, iOS 11.0, *))
+    {
+        VideoMemoryBudget budget;
+        {
+            budget.usage        = static_cast<std::uint64_t>(device_.currentAllocatedSize);
+            #ifdef LLGL_OS_MACOS
+            /* "recommendedMaxWorkingSetSize" is only available on macOS; iOS uses unified memory without a dedicated budget */
+            budget.budget       = static_cast<std::uint64_t>(device_.recommendedMaxWorkingSetSize);
+            budget.heapSize     = static_cast<std::uint64_t>(device_.recommendedMaxWorkingSetSize);
+            budget.deviceLocal  = ([device_ isLowPower] == NO);
+            #endif
+        }
+        budgets.push_back(budget);
+    }
+
+    return budgets;
+}
+
 /* ----- Render Context ----- */
 
 RenderContext* MTRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
@@ -53,13 +75,15 @@ CommandQueue* MTRenderSystem::GetCommandQueue()
 
 /* ----- Command buffers ----- */
 
-CommandBuffer* MTRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& /*desc*/)
+CommandBuffer* MTRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
-    return TakeOwnership(commandBuffers_, MakeUnique<MTCommandBuffer>(device_, commandQueue_->GetNative()));
+    std::lock_guard<std::mutex> guard { commandBufferMutex_ };
+    return TakeOwnership(commandBuffers_, MakeUnique<MTCommandBuffer>(device_, commandQueue_->GetNative(), desc));
 }
 
 void MTRenderSystem::Release(CommandBuffer& commandBuffer)
 {
+    std::lock_guard<std::mutex> guard { commandBufferMutex_ };
     RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
 }
 
@@ -67,7 +91,7 @@ void MTRenderSystem::Release(CommandBuffer& commandBuffer)
 
 Buffer* MTRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
 {
-    return TakeOwnership(buffers_, MakeUnique<MTBuffer>(device_, desc, initialData));
+    return TakeOwnership(buffers_, MakeUnique<MTBuffer>(device_, transientHeapPool_, desc, initialData));
 }
 
 BufferArray* MTRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
@@ -108,7 +132,7 @@ void MTRenderSystem::UnmapBuffer(Buffer& buffer)
 
 Texture* MTRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
-    auto textureMT = MakeUnique<MTTexture>(device_, textureDesc);
+    auto textureMT = MakeUnique<MTTexture>(device_, transientHeapPool_, textureDesc);
 
     if (imageDesc)
     {
@@ -120,19 +144,23 @@ Texture* MTRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
                 Offset3D{ 0, 0, 0 },
                 textureDesc.extent
             },
-            *imageDesc
+            *imageDesc,
+            GetConfiguration().threadCount
         );
 
-        /* Generate MIP-maps if enabled */
+        /* Generate MIP-maps if enabled; scope the autoreleased command buffer and encoder to this submission */
         if (MustGenerateMipsOnCreate(textureDesc))
         {
-            id<MTLCommandBuffer> cmdBuffer = [commandQueue_->GetNative() commandBuffer];
+            @autoreleasepool
             {
-                id<MTLBlitCommandEncoder> blitCmdEncoder = [cmdBuffer blitCommandEncoder];
-                [blitCmdEncoder generateMipmapsForTexture:textureMT->GetNative()];
-                [blitCmdEncoder endEncoding];
+                id<MTLCommandBuffer> cmdBuffer = [commandQueue_->GetNative() commandBuffer];
+                {
+                    id<MTLBlitCommandEncoder> blitCmdEncoder = [cmdBuffer blitCommandEncoder];
+                    [blitCmdEncoder generateMipmapsForTexture:textureMT->GetNative()];
+                    [blitCmdEncoder endEncoding];
+                }
+                [cmdBuffer commit];
             }
-            [cmdBuffer commit];
         }
     }
 
@@ -147,7 +175,7 @@ void MTRenderSystem::Release(Texture& texture)
 void MTRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
 {
     auto& textureMT = LLGL_CAST(MTTexture&, texture);
-    textureMT.Write(textureRegion, imageDesc);
+    textureMT.Write(textureRegion, imageDesc, GetConfiguration().threadCount);
 }
 
 void MTRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
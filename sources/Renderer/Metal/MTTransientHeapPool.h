@@ -0,0 +1,62 @@
+/*
+ * MTTransientHeapPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_MT_TRANSIENT_HEAP_POOL_H
+#define LLGL_MT_TRANSIENT_HEAP_POOL_H
+
+
+#import <Metal/Metal.h>
+
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Pool of MTLHeap objects that backs transient textures and buffers (see MiscFlags::Transient).
+Heap sub-allocation is cheaper than a standalone resource allocation and the heap is made resident as a whole.
+All resources allocated from this pool are immediately made aliasable,
+so subsequent transient allocations may share their memory.
+*/
+class MTTransientHeapPool
+{
+
+    public:
+
+        MTTransientHeapPool() = default;
+        ~MTTransientHeapPool();
+
+        MTTransientHeapPool(const MTTransientHeapPool&) = delete;
+        MTTransientHeapPool& operator = (const MTTransientHeapPool&) = delete;
+
+        // Creates a texture within a heap of this pool, or as standalone resource if its memory type does not support heaps.
+        id<MTLTexture> CreateTexture(id<MTLDevice> device, MTLTextureDescriptor* textureDesc);
+
+        // Creates a buffer within a heap of this pool, or as standalone resource if its memory type does not support heaps.
+        id<MTLBuffer> CreateBuffer(id<MTLDevice> device, NSUInteger length, MTLResourceOptions options);
+
+    private:
+
+        id<MTLHeap> GetOrCreateHeap(id<MTLDevice> device, const MTLSizeAndAlign& sizeAndAlign, MTLResourceOptions options);
+
+    private:
+
+        std::vector<id<MTLHeap>> heaps_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,102 @@
+/*
+ * MTTransientHeapPool.mm
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2018 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "MTTransientHeapPool.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Minimal size (in bytes) of each heap in the pool
+static const NSUInteger g_minTransientHeapSize = (16 << 20);
+
+MTTransientHeapPool::~MTTransientHeapPool()
+{
+    for (id<MTLHeap> heap : heaps_)
+        [heap release];
+}
+
+id<MTLTexture> MTTransientHeapPool::CreateTexture(id<MTLDevice> device, MTLTextureDescriptor* textureDesc)
+{
+    const auto sizeAndAlign = [device heapTextureSizeAndAlignWithDescriptor:textureDesc];
+    if (id<MTLHeap> heap = GetOrCreateHeap(device, sizeAndAlign, textureDesc.resourceOptions))
+    {
+        if (id<MTLTexture> texture = [heap newTextureWithDescriptor:textureDesc])
+        {
+            /* Allow subsequent transient allocations to alias this texture's memory */
+            [texture makeAliasable];
+            return texture;
+        }
+    }
+
+    /* Fall back to standalone allocation */
+    return [device newTextureWithDescriptor:textureDesc];
+}
+
+id<MTLBuffer> MTTransientHeapPool::CreateBuffer(id<MTLDevice> device, NSUInteger length, MTLResourceOptions options)
+{
+    const auto sizeAndAlign = [device heapBufferSizeAndAlignWithLength:length options:options];
+    if (id<MTLHeap> heap = GetOrCreateHeap(device, sizeAndAlign, options))
+    {
+        if (id<MTLBuffer> buffer = [heap newBufferWithLength:length options:options])
+        {
+            /* Allow subsequent transient allocations to alias this buffer's memory */
+            [buffer makeAliasable];
+            return buffer;
+        }
+    }
+
+    /* Fall back to standalone allocation */
+    return [device newBufferWithLength:length options:options];
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+id<MTLHeap> MTTransientHeapPool::GetOrCreateHeap(id<MTLDevice> device, const MTLSizeAndAlign& sizeAndAlign, MTLResourceOptions options)
+{
+    const auto storageMode  = static_cast<MTLStorageMode>((options & MTLResourceStorageModeMask) >> MTLResourceStorageModeShift);
+    const auto cpuCacheMode = static_cast<MTLCPUCacheMode>((options & MTLResourceCPUCacheModeMask) >> MTLResourceCPUCacheModeShift);
+
+    /* Try to find heap with a compatible memory type and enough available space */
+    for (id<MTLHeap> heap : heaps_)
+    {
+        if ( [heap storageMode]  == storageMode  &&
+             [heap cpuCacheMode] == cpuCacheMode &&
+             [heap maxAvailableSizeWithAlignment:sizeAndAlign.align] >= sizeAndAlign.size )
+        {
+            return heap;
+        }
+    }
+
+    /* Allocate new heap with enough space for at least the requested resource */
+    MTLHeapDescriptor* heapDesc = [[MTLHeapDescriptor alloc] init];
+    {
+        heapDesc.size           = std::max(g_minTransientHeapSize, sizeAndAlign.size + sizeAndAlign.align);
+        heapDesc.storageMode    = storageMode;
+        heapDesc.cpuCacheMode   = cpuCacheMode;
+    }
+    id<MTLHeap> heap = [device newHeapWithDescriptor:heapDesc];
+    [heapDesc release];
+
+    /* Heap creation can fail for memory types that do not support heaps; the caller falls back to a standalone allocation */
+    if (heap != nil)
+        heaps_.push_back(heap);
+
+    return heap;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -19,6 +19,7 @@ namespace LLGL
 
 
 struct SrcImageDescriptor;
+class MTTransientHeapPool;
 
 class MTTexture : public Texture
 {
@@ -31,10 +32,10 @@ class MTTexture : public Texture
 
     public:
 
-        MTTexture(id<MTLDevice> device, const TextureDescriptor& desc);
+        MTTexture(id<MTLDevice> device, MTTransientHeapPool& transientHeapPool, const TextureDescriptor& desc);
         ~MTTexture();
 
-        void Write(const TextureRegion& textureRegion, SrcImageDescriptor imageDesc);
+        void Write(const TextureRegion& textureRegion, SrcImageDescriptor imageDesc, std::size_t threadCount = 0);
 
         // Creats a new MTLTexture object as subresource view from this texture.
         id<MTLTexture> CreateSubresourceView(const TextureSubresource& subresource);
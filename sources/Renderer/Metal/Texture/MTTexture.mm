@@ -6,6 +6,7 @@
  */
 
 #include "MTTexture.h"
+#include "../MTTransientHeapPool.h"
 #include "../MTTypes.h"
 #include <LLGL/TextureFlags.h>
 #include <LLGL/ImageFlags.h>
@@ -42,7 +43,8 @@ static MTLResourceOptions GetResourceOptions(const TextureDescriptor& desc)
 {
     MTLResourceOptions opt = 0;
 
-    if (IsDepthStencilFormat(desc.format))
+    /* Transient textures are GPU-only by definition, so they always use private storage */
+    if (IsDepthStencilFormat(desc.format) || (desc.miscFlags & MiscFlags::Transient) != 0)
         opt |= MTLResourceStorageModePrivate;
     else
         opt |= MTLResourceStorageModeManaged;
@@ -64,12 +66,17 @@ static void Convert(MTLTextureDescriptor* dst, const TextureDescriptor& src)
     dst.resourceOptions     = GetResourceOptions(src);
 }
 
-MTTexture::MTTexture(id<MTLDevice> device, const TextureDescriptor& desc) :
+MTTexture::MTTexture(id<MTLDevice> device, MTTransientHeapPool& transientHeapPool, const TextureDescriptor& desc) :
     Texture { desc.type }
 {
     MTLTextureDescriptor* texDesc = [[MTLTextureDescriptor alloc] init];
     Convert(texDesc, desc);
-    native_ = [device newTextureWithDescriptor:texDesc];
+
+    if ((desc.miscFlags & MiscFlags::Transient) != 0)
+        native_ = transientHeapPool.CreateTexture(device, texDesc);
+    else
+        native_ = [device newTextureWithDescriptor:texDesc];
+
     [texDesc release];
 }
 
@@ -143,7 +150,7 @@ TextureDescriptor MTTexture::GetDesc() const
     return texDesc;
 }
 
-void MTTexture::Write(const TextureRegion& textureRegion, SrcImageDescriptor imageDesc)
+void MTTexture::Write(const TextureRegion& textureRegion, SrcImageDescriptor imageDesc, std::size_t threadCount)
 {
     /* Convert region to MTLRegion */
     MTLRegion region;
@@ -162,7 +169,7 @@ void MTTexture::Write(const TextureRegion& textureRegion, SrcImageDescriptor ima
     if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
     {
         /* Convert image format (will be null if no conversion is necessary) */
-        intermediateData = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, /*cfg.threadCount*/0);
+        intermediateData = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, threadCount);
         if (intermediateData)
         {
             /* User converted tempoary buffer as image source */
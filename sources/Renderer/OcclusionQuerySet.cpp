@@ -0,0 +1,114 @@
+/*
+ * OcclusionQuerySet.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/OcclusionQuerySet.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+static bool IsOcclusionQueryType(const QueryType queryType)
+{
+    return
+    (
+        queryType == QueryType::SamplesPassed               ||
+        queryType == QueryType::AnySamplesPassed            ||
+        queryType == QueryType::AnySamplesPassedConservative
+    );
+}
+
+OcclusionQuerySet::OcclusionQuerySet(RenderSystem& renderSystem, std::uint32_t numQueries, const QueryType queryType) :
+    renderSystem_ { renderSystem },
+    numQueries_   { numQueries   }
+{
+    if (numQueries == 0)
+        throw std::invalid_argument("cannot create occlusion query set with zero queries");
+    if (!IsOcclusionQueryType(queryType))
+        throw std::invalid_argument("cannot create occlusion query set with non-occlusion query type");
+
+    /* Create one query heap per frame in flight */
+    QueryHeapDescriptor queryHeapDesc;
+    {
+        queryHeapDesc.type          = queryType;
+        queryHeapDesc.numQueries    = numQueries;
+    }
+    queryHeaps_[0] = renderSystem_.CreateQueryHeap(queryHeapDesc);
+    queryHeaps_[1] = renderSystem_.CreateQueryHeap(queryHeapDesc);
+
+    /* Initialize all queries as visible until the first results have been resolved */
+    results_.resize(numQueries);
+    visibilityBits_.resize((numQueries + 63) / 64, ~0ull);
+}
+
+OcclusionQuerySet::~OcclusionQuerySet()
+{
+    renderSystem_.Release(*queryHeaps_[0]);
+    renderSystem_.Release(*queryHeaps_[1]);
+}
+
+void OcclusionQuerySet::Begin(CommandBuffer& commandBuffer, std::uint32_t query)
+{
+    commandBuffer.BeginQuery(*queryHeaps_[activeHeap_], query);
+}
+
+void OcclusionQuerySet::End(CommandBuffer& commandBuffer, std::uint32_t query)
+{
+    commandBuffer.EndQuery(*queryHeaps_[activeHeap_], query);
+}
+
+bool OcclusionQuerySet::Resolve(CommandQueue& commandQueue)
+{
+    bool newResults = false;
+
+    /* Resolve the results of the previous frame in one batch, but only if they are already available */
+    const auto prevHeap = 1 - activeHeap_;
+    if (heapRecorded_[prevHeap])
+    {
+        auto& queryHeap = *queryHeaps_[prevHeap];
+        if (commandQueue.QueryResultAvailable(queryHeap, 0, numQueries_))
+        {
+            if (commandQueue.QueryResult(queryHeap, 0, numQueries_, results_.data(), results_.size() * sizeof(std::uint64_t)))
+            {
+                /* Compact the per-query sample counts into the visibility bitset */
+                for (std::uint32_t i = 0; i < numQueries_; ++i)
+                {
+                    if (results_[i] != 0)
+                        visibilityBits_[i / 64] |= (1ull << (i % 64));
+                    else
+                        visibilityBits_[i / 64] &= ~(1ull << (i % 64));
+                }
+                newResults = true;
+            }
+        }
+    }
+
+    /* Swap query heaps; the next frame records into the heap that was just resolved */
+    heapRecorded_[activeHeap_] = true;
+    activeHeap_ = prevHeap;
+
+    return newResults;
+}
+
+bool OcclusionQuerySet::IsVisible(std::uint32_t query) const
+{
+    if (query < numQueries_)
+        return ((visibilityBits_[query / 64] & (1ull << (query % 64))) != 0);
+    else
+        return false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -269,6 +269,55 @@ void GLBuffer::UnmapBuffer()
     }
 }
 
+void* GLBuffer::MapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        return glMapNamedBufferRange(GetID(), offset, length, access);
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    #ifdef GL_ARB_map_buffer_range
+    if (HasExtension(GLExt::ARB_map_buffer_range))
+    {
+        GLStateManager::Get().BindGLBuffer(*this);
+        return glMapBufferRange(GetGLTarget(), offset, length, access);
+    }
+    else
+    #endif // /GL_ARB_map_buffer_range
+    {
+        return nullptr;
+    }
+}
+
+void GLBuffer::FlushMappedBufferRange(GLintptr offset, GLsizeiptr length)
+{
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        glFlushMappedNamedBufferRange(GetID(), offset, length);
+    }
+    else
+    #endif // /GL_ARB_direct_state_access
+    #ifdef GL_ARB_map_buffer_range
+    if (HasExtension(GLExt::ARB_map_buffer_range))
+    {
+        GLStateManager::Get().BindGLBuffer(*this);
+        glFlushMappedBufferRange(GetGLTarget(), offset, length);
+    }
+    #endif // /GL_ARB_map_buffer_range
+}
+
+void* GLBuffer::MapBufferPersistent(GLsizeiptr size, GLbitfield access)
+{
+    #ifdef GL_ARB_buffer_storage
+    if (persistentMappedMemory_ == nullptr && HasExtension(GLExt::ARB_buffer_storage))
+        persistentMappedMemory_ = MapBufferRange(0, size, access);
+    #endif // /GL_ARB_buffer_storage
+    return persistentMappedMemory_;
+}
+
 void GLBuffer::SetIndexType(const Format format)
 {
     indexType16Bits_ = (format == Format::R16UInt);
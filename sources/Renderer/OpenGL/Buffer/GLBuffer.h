@@ -45,6 +45,15 @@ class GLBuffer : public Buffer
         void* MapBuffer(GLenum access);
         void UnmapBuffer();
 
+        void* MapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield access);
+        void FlushMappedBufferRange(GLintptr offset, GLsizeiptr length);
+
+        /*
+        Maps the entire buffer persistently and stores the stable pointer for later retrieval.
+        The buffer storage must have been created with the GL_MAP_PERSISTENT_BIT flag (requires GL_ARB_buffer_storage).
+        */
+        void* MapBufferPersistent(GLsizeiptr size, GLbitfield access);
+
         // Returns the hardware buffer ID.
         inline GLuint GetID() const
         {
@@ -72,15 +81,21 @@ class GLBuffer : public Buffer
             return indexType16Bits_;
         }
 
-    private:
+        // Returns the stable pointer of a persistently mapped buffer, or null if the buffer is not persistently mapped.
+        inline void* GetPersistentMappedMemory() const
+        {
+            return persistentMappedMemory_;
+        }
 
+        // Queries the specified buffer parameters; null pointers are ignored.
         void GetBufferParams(GLint* size, GLint* usage, GLint* storageFlags) const;
 
     private:
 
-        GLuint          id_                 = 0;
-        GLBufferTarget  target_             = GLBufferTarget::ARRAY_BUFFER;
-        bool            indexType16Bits_    = false;
+        GLuint          id_                     = 0;
+        GLBufferTarget  target_                 = GLBufferTarget::ARRAY_BUFFER;
+        bool            indexType16Bits_        = false;
+        void*           persistentMappedMemory_ = nullptr;
 
 };
 
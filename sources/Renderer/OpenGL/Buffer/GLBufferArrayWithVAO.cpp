@@ -8,6 +8,7 @@
 #include "GLBufferArrayWithVAO.h"
 #include "GLBufferWithVAO.h"
 #include "../GLObjectUtils.h"
+#include "../Platform/GLContext.h"
 #include "../RenderState/GLStateManager.h"
 #include "../../CheckedCast.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
@@ -22,6 +23,11 @@ GLBufferArrayWithVAO::GLBufferArrayWithVAO(long bindFlags) :
 {
 }
 
+GLBufferArrayWithVAO::~GLBufferArrayWithVAO()
+{
+    ReleaseSharedVertexArray();
+}
+
 void GLBufferArrayWithVAO::SetName(const char* name)
 {
     #ifdef LLGL_GL_ENABLE_OPENGL2X
@@ -29,7 +35,36 @@ void GLBufferArrayWithVAO::SetName(const char* name)
     #endif
     {
         /* Set label for VAO */
-        GLSetObjectLabel(GL_VERTEX_ARRAY, vao_.GetID(), name);
+        GLSetObjectLabel(GL_VERTEX_ARRAY, GetVaoID(), name);
+    }
+}
+
+[[noreturn]]
+static void ThrowNoVertexBufferErr()
+{
+    throw std::invalid_argument(
+        "cannot build vertex array with buffer that was not created with the 'LLGL::BindFlags::VertexBuffer' flag"
+    );
+}
+
+/* Collects all vertex buffer bindings and validates the buffer types */
+static void CollectVertexBufferBindings(
+    std::vector<GLVertexArrayBufferBinding>&    bindings,
+    std::uint32_t                               numBuffers,
+    Buffer* const *                             bufferArray)
+{
+    bindings.reserve(numBuffers);
+
+    for (std::uint32_t i = 0; i < numBuffers; ++i)
+    {
+        if ((bufferArray[i]->GetBindFlags() & BindFlags::VertexBuffer) != 0)
+        {
+            auto vertexBufferGL = LLGL_CAST(GLBufferWithVAO*, bufferArray[i]);
+            const auto& vertexAttribs = vertexBufferGL->GetVertexAttribs();
+            bindings.push_back({ vertexBufferGL->GetID(), vertexAttribs.data(), vertexAttribs.size() });
+        }
+        else
+            ThrowNoVertexBufferErr();
     }
 }
 
@@ -44,9 +79,33 @@ void GLBufferArrayWithVAO::BuildVertexArray(std::uint32_t numBuffers, Buffer* co
     else
     #endif // /LLGL_GL_ENABLE_OPENGL2X
     {
-        /* Build vertex array with native VAO */
-        BuildVertexArrayWithVAO(numBuffers, bufferArray);
+        auto context = GLContext::Active();
+        if (context != nullptr && context->IsWorkerContext())
+        {
+            /* VAOs are not shared between GL contexts, so defer the build until first use on the render thread */
+            CollectVertexBufferBindings(deferredBindings_, numBuffers, bufferArray);
+            buildDeferred_ = true;
+        }
+        else
+        {
+            /* Build vertex array with native VAO */
+            std::vector<GLVertexArrayBufferBinding> bindings;
+            CollectVertexBufferBindings(bindings, numBuffers, bufferArray);
+            BuildVertexArrayWithVAO(bindings);
+        }
+    }
+}
+
+GLuint GLBufferArrayWithVAO::GetVaoID()
+{
+    if (buildDeferred_)
+    {
+        /* Build VAO that was deferred from a loader thread */
+        buildDeferred_ = false;
+        BuildVertexArrayWithVAO(deferredBindings_);
+        deferredBindings_.clear();
     }
+    return (vao_ != nullptr ? vao_->GetID() : 0);
 }
 
 
@@ -54,37 +113,43 @@ void GLBufferArrayWithVAO::BuildVertexArray(std::uint32_t numBuffers, Buffer* co
  * ======= Private: =======
  */
 
-[[noreturn]]
-static void ThrowNoVertexBufferErr()
+void GLBufferArrayWithVAO::BuildVertexArrayWithVAO(const std::vector<GLVertexArrayBufferBinding>& bindings)
 {
-    throw std::invalid_argument(
-        "cannot build vertex array with buffer that was not created with the 'LLGL::BindFlags::VertexBuffer' flag"
-    );
-}
+    /* Acquire shared VAO for these buffer bindings and attribute layouts */
+    ReleaseSharedVertexArray();
 
-void GLBufferArrayWithVAO::BuildVertexArrayWithVAO(std::uint32_t numBuffers, Buffer* const * bufferArray)
-{
-    /* Bind VAO */
-    GLStateManager::Get().BindVertexArray(GetVaoID());
+    vaoKey_ = GLVertexArrayCache::ComputeVertexArrayKey(bindings.data(), bindings.size());
+
+    bool isNewEntry = false;
+    vao_ = GLVertexArrayCache::Get().AcquireVertexArray(vaoKey_, bindings.data(), bindings.size(), isNewEntry);
+
+    if (isNewEntry)
     {
-        while (numBuffers-- > 0)
+        /* Bind VAO */
+        GLStateManager::Get().BindVertexArray(vao_->GetID());
         {
-            if (((*bufferArray)->GetBindFlags() & BindFlags::VertexBuffer) != 0)
+            for (const auto& binding : bindings)
             {
                 /* Bind VBO */
-                auto vertexBufferGL = LLGL_CAST(GLBufferWithVAO*, (*bufferArray++));
-                GLStateManager::Get().BindBuffer(GLBufferTarget::ARRAY_BUFFER, vertexBufferGL->GetID());
+                GLStateManager::Get().BindBuffer(GLBufferTarget::ARRAY_BUFFER, binding.bufferID);
 
                 /* Build each vertex attribute */
-                const auto& vertexAttribs = vertexBufferGL->GetVertexAttribs();
-                for (const auto& attrib : vertexAttribs)
-                    vao_.BuildVertexAttribute(attrib);
+                for (std::size_t i = 0; i < binding.numVertexAttribs; ++i)
+                    vao_->BuildVertexAttribute(binding.vertexAttribs[i]);
             }
-            else
-                ThrowNoVertexBufferErr();
         }
+        GLStateManager::Get().BindVertexArray(0);
+    }
+}
+
+void GLBufferArrayWithVAO::ReleaseSharedVertexArray()
+{
+    if (vao_ != nullptr)
+    {
+        GLVertexArrayCache::Get().ReleaseVertexArray(vaoKey_, vao_);
+        vao_    = nullptr;
+        vaoKey_ = 0;
     }
-    GLStateManager::Get().BindVertexArray(0);
 }
 
 #ifdef LLGL_GL_ENABLE_OPENGL2X
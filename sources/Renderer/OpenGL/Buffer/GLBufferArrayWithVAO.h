@@ -10,8 +10,9 @@
 
 
 #include "GLBufferArray.h"
-#include "GLVertexArrayObject.h"
+#include "GLVertexArrayCache.h"
 #include "GL2XVertexArray.h"
+#include <vector>
 
 
 namespace LLGL
@@ -28,14 +29,12 @@ class GLBufferArrayWithVAO final : public GLBufferArray
     public:
 
         GLBufferArrayWithVAO(long bindFlags);
+        ~GLBufferArrayWithVAO();
 
         void BuildVertexArray(std::uint32_t numBuffers, Buffer* const * bufferArray);
 
-        // Returns the ID of the vertex-array-object (VAO)
-        inline GLuint GetVaoID() const
-        {
-            return vao_.GetID();
-        }
+        // Returns the ID of the vertex-array-object (VAO); builds the VAO first if its creation was deferred from a loader thread.
+        GLuint GetVaoID();
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         // Returns the GL 2.x compatible vertex-array emulator.
@@ -47,14 +46,18 @@ class GLBufferArrayWithVAO final : public GLBufferArray
 
     private:
 
-        void BuildVertexArrayWithVAO(std::uint32_t numBuffers, Buffer* const * bufferArray);
+        void BuildVertexArrayWithVAO(const std::vector<GLVertexArrayBufferBinding>& bindings);
+        void ReleaseSharedVertexArray();
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         void BuildVertexArrayWithEmulator(std::uint32_t numBuffers, Buffer* const * bufferArray);
         #endif
 
     private:
 
-        GLVertexArrayObject vao_;
+        GLVertexArrayObject*                    vao_            = nullptr;
+        std::uint64_t                           vaoKey_         = 0;
+        std::vector<GLVertexArrayBufferBinding> deferredBindings_;
+        bool                                    buildDeferred_  = false;
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         GL2XVertexArray     vertexArrayGL2X_;
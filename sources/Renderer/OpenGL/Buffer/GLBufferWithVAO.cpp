@@ -6,6 +6,7 @@
  */
 
 #include "GLBufferWithVAO.h"
+#include "../Platform/GLContext.h"
 #include "../RenderState/GLStateManager.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
 
@@ -19,6 +20,11 @@ GLBufferWithVAO::GLBufferWithVAO(long bindFlags) :
 {
 }
 
+GLBufferWithVAO::~GLBufferWithVAO()
+{
+    ReleaseSharedVertexArray();
+}
+
 void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs)
 {
     /* Store vertex format (required if this buffer is used in a buffer array) */
@@ -36,9 +42,29 @@ void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const Verte
     else
     #endif // /LLGL_GL_ENABLE_OPENGL2X
     {
-        /* Build vertex array with native VAO */
+        auto context = GLContext::Active();
+        if (context != nullptr && context->IsWorkerContext())
+        {
+            /* VAOs are not shared between GL contexts, so defer the build until first use on the render thread */
+            buildDeferred_ = true;
+        }
+        else
+        {
+            /* Build vertex array with native VAO */
+            BuildVertexArrayWithVAO();
+        }
+    }
+}
+
+GLuint GLBufferWithVAO::GetVaoID()
+{
+    if (buildDeferred_)
+    {
+        /* Build VAO that was deferred from a loader thread */
+        buildDeferred_ = false;
         BuildVertexArrayWithVAO();
     }
+    return (vao_ != nullptr ? vao_->GetID() : 0);
 }
 
 
@@ -48,17 +74,39 @@ void GLBufferWithVAO::BuildVertexArray(std::size_t numVertexAttribs, const Verte
 
 void GLBufferWithVAO::BuildVertexArrayWithVAO()
 {
-    /* Bind VAO */
-    GLStateManager::Get().BindVertexArray(GetVaoID());
+    /* Acquire shared VAO for this buffer binding and attribute layout */
+    ReleaseSharedVertexArray();
+
+    const GLVertexArrayBufferBinding binding { GetID(), vertexAttribs_.data(), vertexAttribs_.size() };
+    vaoKey_ = GLVertexArrayCache::ComputeVertexArrayKey(&binding, 1);
+
+    bool isNewEntry = false;
+    vao_ = GLVertexArrayCache::Get().AcquireVertexArray(vaoKey_, &binding, 1, isNewEntry);
+
+    if (isNewEntry)
     {
-        /* Bind VBO */
-        GLStateManager::Get().BindBuffer(GLBufferTarget::ARRAY_BUFFER, GetID());
+        /* Bind VAO */
+        GLStateManager::Get().BindVertexArray(vao_->GetID());
+        {
+            /* Bind VBO */
+            GLStateManager::Get().BindBuffer(GLBufferTarget::ARRAY_BUFFER, GetID());
+
+            /* Build each vertex attribute */
+            for (const auto& attrib : vertexAttribs_)
+                vao_->BuildVertexAttribute(attrib);
+        }
+        GLStateManager::Get().BindVertexArray(0);
+    }
+}
 
-        /* Build each vertex attribute */
-        for (const auto& attrib : vertexAttribs_)
-            vao_.BuildVertexAttribute(attrib);
+void GLBufferWithVAO::ReleaseSharedVertexArray()
+{
+    if (vao_ != nullptr)
+    {
+        GLVertexArrayCache::Get().ReleaseVertexArray(vaoKey_, vao_);
+        vao_    = nullptr;
+        vaoKey_ = 0;
     }
-    GLStateManager::Get().BindVertexArray(0);
 }
 
 #ifdef LLGL_GL_ENABLE_OPENGL2X
@@ -10,7 +10,7 @@
 
 
 #include "GLBuffer.h"
-#include "GLVertexArrayObject.h"
+#include "GLVertexArrayCache.h"
 #include "GL2XVertexArray.h"
 
 
@@ -24,14 +24,12 @@ class GLBufferWithVAO final : public GLBuffer
     public:
 
         GLBufferWithVAO(long bindFlags);
+        ~GLBufferWithVAO();
 
         void BuildVertexArray(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
 
-        // Returns the ID of the vertex-array-object (VAO)
-        inline GLuint GetVaoID() const
-        {
-            return vao_.GetID();
-        }
+        // Returns the ID of the vertex-array-object (VAO); builds the VAO first if its creation was deferred from a loader thread.
+        GLuint GetVaoID();
 
         // Returns the list of vertex attributes.
         inline const std::vector<VertexAttribute>& GetVertexAttribs() const
@@ -50,14 +48,17 @@ class GLBufferWithVAO final : public GLBuffer
     private:
 
         void BuildVertexArrayWithVAO();
+        void ReleaseSharedVertexArray();
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         void BuildVertexArrayWithEmulator();
         #endif
 
     private:
 
-        GLVertexArrayObject             vao_;
+        GLVertexArrayObject*            vao_            = nullptr;
+        std::uint64_t                   vaoKey_         = 0;
         std::vector<VertexAttribute>    vertexAttribs_;
+        bool                            buildDeferred_  = false;
 
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         GL2XVertexArray                 vertexArrayGL2X_;
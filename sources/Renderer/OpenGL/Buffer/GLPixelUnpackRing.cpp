@@ -0,0 +1,126 @@
+/*
+ * GLPixelUnpackRing.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLPixelUnpackRing.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include <cstring>
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+GLPixelUnpackRing& GLPixelUnpackRing::Get()
+{
+    static GLPixelUnpackRing instance;
+    return instance;
+}
+
+void GLPixelUnpackRing::Clear()
+{
+    if (bufferID_ != 0)
+    {
+        /* Always call glDeleteSync, it will silently ignore a <sync> value of zero */
+        for (auto& sync : chunkFences_)
+        {
+            glDeleteSync(sync);
+            sync = 0;
+        }
+
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, bufferID_);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
+
+        glDeleteBuffers(1, &bufferID_);
+        GLStateManager::Get().NotifyBufferRelease(bufferID_, GLBufferTarget::PIXEL_UNPACK_BUFFER);
+
+        bufferID_       = 0;
+        mappedMemory_   = nullptr;
+        chunkIndex_     = 0;
+        chunkOffset_    = 0;
+    }
+    initialized_ = false;
+}
+
+bool GLPixelUnpackRing::StageData(const void* data, std::size_t dataSize, GLintptr& outOffset)
+{
+    /* Uploads larger than one chunk must fall back to client memory */
+    if (dataSize > g_chunkSize)
+        return false;
+
+    /* Create ring buffer on first use; staging requires persistent mapping and sync fences */
+    if (!initialized_)
+    {
+        initialized_ = true;
+        if (HasExtension(GLExt::ARB_buffer_storage) && HasExtension(GLExt::ARB_sync))
+            CreateRingBuffer();
+    }
+
+    if (mappedMemory_ == nullptr)
+        return false;
+
+    if (chunkOffset_ + dataSize > g_chunkSize)
+    {
+        /*
+        Retire current chunk with a fence covering all of its issued uploads,
+        then advance to the next chunk and wait until its previous uploads have completed
+        */
+        glDeleteSync(chunkFences_[chunkIndex_]);
+        chunkFences_[chunkIndex_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        chunkIndex_  = (chunkIndex_ + 1) % g_numChunks;
+        chunkOffset_ = 0;
+
+        WaitForChunk(chunkIndex_);
+    }
+
+    /* Copy data into ring; the mapping is coherent, so no explicit flush is required */
+    outOffset = static_cast<GLintptr>(chunkIndex_ * g_chunkSize + chunkOffset_);
+    ::memcpy(mappedMemory_ + outOffset, data, dataSize);
+    chunkOffset_ += dataSize;
+
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLPixelUnpackRing::CreateRingBuffer()
+{
+    /* Create persistently and coherently mapped buffer storage for all chunks */
+    glGenBuffers(1, &bufferID_);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, bufferID_);
+
+    const GLbitfield flagsGL = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+
+    glBufferStorage(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(g_chunkSize * g_numChunks), nullptr, flagsGL);
+    mappedMemory_ = reinterpret_cast<char*>(
+        glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(g_chunkSize * g_numChunks), flagsGL)
+    );
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
+
+    return (mappedMemory_ != nullptr);
+}
+
+void GLPixelUnpackRing::WaitForChunk(std::uint32_t chunkIndex)
+{
+    if (auto sync = chunkFences_[chunkIndex])
+        glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, std::numeric_limits<GLuint64>::max());
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,83 @@
+/*
+ * GLPixelUnpackRing.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_PIXEL_UNPACK_RING_H
+#define LLGL_GL_PIXEL_UNPACK_RING_H
+
+
+#include "../OpenGL.h"
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Ring of persistently mapped pixel-unpack buffer (PBO) chunks for texture uploads.
+Image data is copied into the ring and the upload is issued with the PBO bound,
+so the driver can transfer the data asynchronously (DMA) instead of copying out
+of client memory before returning. Chunks are guarded by sync fences before re-use.
+*/
+class GLPixelUnpackRing
+{
+
+    public:
+
+        GLPixelUnpackRing(const GLPixelUnpackRing&) = delete;
+        GLPixelUnpackRing& operator = (const GLPixelUnpackRing&) = delete;
+
+        // Returns the instance of this singleton class.
+        static GLPixelUnpackRing& Get();
+
+        // Releases the GL resources of this singleton class.
+        void Clear();
+
+        /*
+        Copies the specified data into the ring and returns the byte offset within the ring buffer.
+        Returns false if staging is not supported or the data is too large for a ring chunk,
+        in which case the caller must upload directly from client memory.
+        */
+        bool StageData(const void* data, std::size_t dataSize, GLintptr& outOffset);
+
+        // Returns the hardware buffer ID of the ring.
+        inline GLuint GetBufferID() const
+        {
+            return bufferID_;
+        }
+
+    private:
+
+        GLPixelUnpackRing() = default;
+
+        bool CreateRingBuffer();
+        void WaitForChunk(std::uint32_t chunkIndex);
+
+    private:
+
+        static const std::uint32_t  g_numChunks    = 3;
+        static const std::size_t    g_chunkSize    = (16u << 20);
+
+        GLuint                      bufferID_                   = 0;
+        char*                       mappedMemory_               = nullptr;
+        GLsync                      chunkFences_[g_numChunks]   = {};
+        std::uint32_t               chunkIndex_                 = 0;
+        std::size_t                 chunkOffset_                = 0;
+        bool                        initialized_                = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,122 @@
+/*
+ * GLVertexArrayCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLVertexArrayCache.h"
+#include <LLGL/VertexAttribute.h>
+#include <tuple>
+
+
+namespace LLGL
+{
+
+
+// 64-bit FNV-1a hash; used to key the cache entries by buffer bindings and attribute layouts
+static std::uint64_t HashUInt32FNV1a(std::uint32_t value, std::uint64_t hash)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        hash ^= ((value >> (i * 8)) & 0xFF);
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+GLVertexArrayCache& GLVertexArrayCache::Get()
+{
+    static GLVertexArrayCache instance;
+    return instance;
+}
+
+/*
+Flattens the fields of the specified bindings that contribute to VAO state into a word sequence;
+the attribute name is irrelevant here. This sequence is both the hash input and the key material
+stored per cache entry to verify the hash key against collisions.
+*/
+static std::vector<std::uint32_t> FlattenVertexArrayBindings(const GLVertexArrayBufferBinding* bindings, std::size_t numBindings)
+{
+    std::vector<std::uint32_t> words;
+
+    for (std::size_t i = 0; i < numBindings; ++i)
+    {
+        /* Include buffer ID, since 'glVertexAttrib*Pointer' bakes the bound buffer into the VAO state */
+        words.push_back(bindings[i].bufferID);
+        words.push_back(static_cast<std::uint32_t>(bindings[i].numVertexAttribs));
+
+        for (std::size_t j = 0; j < bindings[i].numVertexAttribs; ++j)
+        {
+            const auto& attrib = bindings[i].vertexAttribs[j];
+            words.push_back(static_cast<std::uint32_t>(attrib.format));
+            words.push_back(attrib.location);
+            words.push_back(attrib.offset);
+            words.push_back(attrib.stride);
+            words.push_back(attrib.instanceDivisor);
+        }
+    }
+
+    return words;
+}
+
+std::uint64_t GLVertexArrayCache::ComputeVertexArrayKey(const GLVertexArrayBufferBinding* bindings, std::size_t numBindings)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+
+    for (auto word : FlattenVertexArrayBindings(bindings, numBindings))
+        hash = HashUInt32FNV1a(word, hash);
+
+    return hash;
+}
+
+GLVertexArrayObject* GLVertexArrayCache::AcquireVertexArray(
+    std::uint64_t                       key,
+    const GLVertexArrayBufferBinding*   bindings,
+    std::size_t                         numBindings,
+    bool&                               isNewEntry)
+{
+    auto keyMaterial = FlattenVertexArrayBindings(bindings, numBindings);
+
+    /* Find an entry whose key material matches; entries that only share the hash key (collision) must not be re-used */
+    const auto range = entries_.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second.keyMaterial == keyMaterial)
+        {
+            isNewEntry = false;
+            it->second.refCount++;
+            return &(it->second.vao);
+        }
+    }
+
+    /* Create new entry with an empty VAO; the caller builds its vertex attributes */
+    auto it = entries_.emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple());
+    isNewEntry = true;
+
+    it->second.refCount     = 1;
+    it->second.keyMaterial  = std::move(keyMaterial);
+
+    return &(it->second.vao);
+}
+
+void GLVertexArrayCache::ReleaseVertexArray(std::uint64_t key, const GLVertexArrayObject* vao)
+{
+    const auto range = entries_.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (&(it->second.vao) == vao)
+        {
+            if (--(it->second.refCount) == 0)
+                entries_.erase(it);
+            break;
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,95 @@
+/*
+ * GLVertexArrayCache.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_VERTEX_ARRAY_CACHE_H
+#define LLGL_GL_VERTEX_ARRAY_CACHE_H
+
+
+#include "GLVertexArrayObject.h"
+#include <map>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+struct VertexAttribute;
+
+// Describes one vertex buffer together with the attribute layout it is bound with.
+struct GLVertexArrayBufferBinding
+{
+    GLuint                  bufferID;
+    const VertexAttribute*  vertexAttribs;
+    std::size_t             numVertexAttribs;
+};
+
+/*
+Cache of shared vertex-array-objects (VAOs).
+Entries are keyed by a hash over the buffer bindings and their attribute layouts,
+so that meshes sharing one vertex format re-use a single VAO instead of duplicating it per buffer.
+Entries are reference counted and deleted when the last buffer using them is released.
+*/
+class GLVertexArrayCache
+{
+
+    public:
+
+        GLVertexArrayCache(const GLVertexArrayCache&) = delete;
+        GLVertexArrayCache& operator = (const GLVertexArrayCache&) = delete;
+
+        // Returns the instance of this singleton class.
+        static GLVertexArrayCache& Get();
+
+        // Computes the cache key for the specified sequence of vertex buffer bindings.
+        static std::uint64_t ComputeVertexArrayKey(const GLVertexArrayBufferBinding* bindings, std::size_t numBindings);
+
+        /*
+        Returns the VAO for the specified key and bindings and increments its reference count.
+        The bindings are compared against the stored key material of the entry,
+        so a hash collision creates a separate entry instead of sharing a VAO with a different vertex layout.
+        If 'isNewEntry' is set to true, the caller must build the vertex attributes for the returned VAO.
+        */
+        GLVertexArrayObject* AcquireVertexArray(
+            std::uint64_t                       key,
+            const GLVertexArrayBufferBinding*   bindings,
+            std::size_t                         numBindings,
+            bool&                               isNewEntry
+        );
+
+        // Decrements the reference count of the specified entry and deletes its VAO when the count drops to zero.
+        void ReleaseVertexArray(std::uint64_t key, const GLVertexArrayObject* vao);
+
+    private:
+
+        GLVertexArrayCache() = default;
+
+    private:
+
+        struct Entry
+        {
+            GLVertexArrayObject         vao;
+            std::size_t                 refCount = 0;
+            std::vector<std::uint32_t>  keyMaterial;    // flattened bindings to verify the hash key against collisions
+        };
+
+        // Multimap, since hash collisions store multiple entries under the same key
+        std::multimap<std::uint64_t, Entry> entries_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -187,6 +187,13 @@ struct GLCmdBindResourceHeap
     GLResourceHeap* resourceHeap;
 };
 
+struct GLCmdBindResourceHeapDynamic
+{
+    GLResourceHeap* resourceHeap;
+    std::uint32_t   numDynamicOffsets;
+//  std::uint32_t   dynamicOffsets[numDynamicOffsets];
+};
+
 struct GLCmdBindRenderPass
 {
     RenderTarget*       renderTarget;
@@ -386,6 +393,11 @@ struct GLCmdUnbindResources
     };
 };
 
+struct GLCmdMemoryBarrier
+{
+    GLbitfield barriers;
+};
+
 struct GLCmdPushDebugGroup
 {
     GLenum      source;
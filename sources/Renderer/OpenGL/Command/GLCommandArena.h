@@ -0,0 +1,140 @@
+/*
+ * GLCommandArena.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_COMMAND_ARENA_H
+#define LLGL_GL_COMMAND_ARENA_H
+
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/*
+Chunked arena for the virtual GL command stream.
+The stream grows by fixed-size blocks instead of a single contiguous buffer,
+so encoding a pass that is larger than in the previous frame never triggers
+a reallocation-and-copy of the already encoded commands.
+Commands never span chunk boundaries and chunks are recycled on Reset,
+i.e. a steady-state frame encodes without any allocation at all.
+*/
+class GLCommandArena
+{
+
+    public:
+
+        // Minimal capacity (in bytes) of a single chunk.
+        static const std::size_t minChunkSize = 4096;
+
+        GLCommandArena() = default;
+
+        GLCommandArena(const GLCommandArena&) = delete;
+        GLCommandArena& operator = (const GLCommandArena&) = delete;
+
+        // Pre-allocates the first chunk with at least the specified capacity (in bytes).
+        void Reserve(std::size_t capacity)
+        {
+            if (capacity > 0 && chunks_.empty())
+                AllocChunk(capacity);
+        }
+
+        // Allocates a block of uninitialized memory for the next command; never copies previously encoded commands.
+        std::uint8_t* Alloc(std::size_t size)
+        {
+            if (chunks_.empty())
+                AllocChunk(size);
+            else if (chunks_[chunkIndex_].size + size > chunks_[chunkIndex_].capacity)
+            {
+                /* Seal current chunk and advance to the next one that can hold the command */
+                ++chunkIndex_;
+                if (chunkIndex_ == chunks_.size())
+                    AllocChunk(size);
+                else if (chunks_[chunkIndex_].capacity < size)
+                    ReplaceChunk(chunkIndex_, size);
+            }
+
+            auto& chunk = chunks_[chunkIndex_];
+            auto  data  = chunk.data.get() + chunk.size;
+            chunk.size += size;
+
+            return data;
+        }
+
+        // Resets the write position but keeps all chunks allocated for re-use in the next encoding.
+        void Reset()
+        {
+            for (auto& chunk : chunks_)
+                chunk.size = 0;
+            chunkIndex_ = 0;
+        }
+
+        // Returns true if no commands have been encoded.
+        bool Empty() const
+        {
+            return (chunks_.empty() || chunks_.front().size == 0);
+        }
+
+        // Invokes the specified callback for each non-empty chunk in encoding order: callback(const std::uint8_t* data, std::size_t size).
+        template <typename Callback>
+        void ForEachChunk(Callback callback) const
+        {
+            for (const auto& chunk : chunks_)
+            {
+                if (chunk.size > 0)
+                    callback(chunk.data.get(), chunk.size);
+            }
+        }
+
+    private:
+
+        struct Chunk
+        {
+            std::unique_ptr<std::uint8_t[]> data;
+            std::size_t                     size        = 0;
+            std::size_t                     capacity    = 0;
+        };
+
+        void AllocChunk(std::size_t minCapacity)
+        {
+            Chunk chunk;
+            {
+                chunk.capacity  = std::max(minChunkSize, minCapacity);
+                chunk.data      = std::unique_ptr<std::uint8_t[]>(new std::uint8_t[chunk.capacity]);
+            }
+            chunks_.emplace_back(std::move(chunk));
+        }
+
+        void ReplaceChunk(std::size_t chunkIndex, std::size_t minCapacity)
+        {
+            Chunk chunk;
+            {
+                chunk.capacity  = std::max(minChunkSize, minCapacity);
+                chunk.data      = std::unique_ptr<std::uint8_t[]>(new std::uint8_t[chunk.capacity]);
+            }
+            chunks_[chunkIndex] = std::move(chunk);
+        }
+
+        std::vector<Chunk>  chunks_;
+        std::size_t         chunkIndex_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -88,7 +88,7 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         case GLOpcodeExecute:
         {
             auto cmd = reinterpret_cast<const GLCmdExecute*>(pc);
-            compiler.Call(ExecuteGLDeferredCommandBuffer, cmd->commandBuffer, g_stateMngrArg);
+            compiler.Call(ExecuteGLDeferredCommandBufferIsolated, cmd->commandBuffer, g_stateMngrArg);
             return sizeof(*cmd);
         }
         case GLOpcodeSetAPIDepState:
@@ -231,6 +231,12 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
             compiler.CallMember(&GLResourceHeap::Bind, cmd->resourceHeap, g_stateMngrArg);
             return sizeof(*cmd);
         }
+        case GLOpcodeBindResourceHeapDynamic:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindResourceHeapDynamic*>(pc);
+            compiler.CallMember(&GLResourceHeap::BindWithDynamicOffsets, cmd->resourceHeap, g_stateMngrArg, cmd->numDynamicOffsets, reinterpret_cast<const std::uint32_t*>(cmd + 1));
+            return (sizeof(*cmd) + sizeof(std::uint32_t)*cmd->numDynamicOffsets);
+        }
         case GLOpcodeBindRenderPass:
         {
             auto cmd = reinterpret_cast<const GLCmdBindRenderPass*>(pc);
@@ -421,6 +427,14 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
                 compiler.CallMember(&GLStateManager::UnbindSamplers, g_stateMngrArg, cmd->first, cmd->count);
             return sizeof(*cmd);
         }
+        #ifndef __APPLE__
+        case GLOpcodeMemoryBarrier:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMemoryBarrier*>(pc);
+            compiler.Call(glMemoryBarrier, cmd->barriers);
+            return sizeof(*cmd);
+        }
+        #endif // /__APPLE__
         #ifdef GL_KHR_debug
         case GLOpcodePushDebugGroup:
         {
@@ -435,7 +449,14 @@ static std::size_t AssembleGLCommand(const GLOpcode opcode, const void* pc, JITC
         }
         #endif // /GL_KHR_debug
         default:
-            return 0;
+        {
+            /*
+            Fall back to the interpreter for this single command, so partially covered
+            streams remain JIT-compiled instead of disabling native execution entirely.
+            */
+            compiler.Call(ExecuteGLCommand, opcode, pc, g_stateMngrArg);
+            return GLCommandSize(opcode, pc);
+        }
     }
 }
 
@@ -456,14 +477,6 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
     /* Try to create a JIT-compiler for the active architecture (if supported) */
     if (auto compiler = JITCompiler::Create())
     {
-        /* Initialize program counter to execute virtual GL commands */
-        const auto& rawBuffer = cmdBuffer.GetRawBuffer();
-
-        auto pc     = rawBuffer.data();
-        auto pcEnd  = rawBuffer.data() + rawBuffer.size();
-
-        GLOpcode opcode;
-
         /* Declare variadic arguments for entry point of JIT program */
         compiler->EntryPointVarArgs({ JIT::ArgType::Ptr });
 
@@ -475,15 +488,26 @@ std::unique_ptr<JITProgram> AssembleGLDeferredCommandBuffer(const GLDeferredComm
         /* Assemble GL commands into JIT program */
         compiler->Begin();
 
-        while (pc < pcEnd)
-        {
-            /* Read opcode */
-            opcode = *reinterpret_cast<const GLOpcode*>(pc);
-            pc += sizeof(GLOpcode);
+        cmdBuffer.GetCommandArena().ForEachChunk(
+            [&compiler](const std::uint8_t* data, std::size_t size)
+            {
+                /* Initialize program counter to assemble virtual GL commands */
+                auto pc     = data;
+                auto pcEnd  = data + size;
 
-            /* Execute command and increment program counter */
-            pc += AssembleGLCommand(opcode, pc, *compiler);
-        }
+                GLOpcode opcode;
+
+                while (pc < pcEnd)
+                {
+                    /* Read opcode */
+                    opcode = *reinterpret_cast<const GLOpcode*>(pc);
+                    pc += sizeof(GLOpcode);
+
+                    /* Assemble command and increment program counter */
+                    pc += AssembleGLCommand(opcode, pc, *compiler);
+                }
+            }
+        );
 
         compiler->End();
 
@@ -42,6 +42,32 @@ void GLCommandBuffer::InitializeGLRenderState(GLRenderState& dst)
     dst.indexBufferOffset   = 0;
 }
 
+GLbitfield GLCommandBuffer::GetGLMemoryBarriers(long bindFlags)
+{
+    GLbitfield barriers = 0;
+
+    #ifndef __APPLE__
+    if ((bindFlags & BindFlags::VertexBuffer) != 0)
+        barriers |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
+    if ((bindFlags & BindFlags::IndexBuffer) != 0)
+        barriers |= GL_ELEMENT_ARRAY_BARRIER_BIT;
+    if ((bindFlags & BindFlags::ConstantBuffer) != 0)
+        barriers |= GL_UNIFORM_BARRIER_BIT;
+    if ((bindFlags & BindFlags::Sampled) != 0)
+        barriers |= GL_TEXTURE_FETCH_BARRIER_BIT;
+    if ((bindFlags & BindFlags::Storage) != 0)
+        barriers |= (GL_SHADER_STORAGE_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+    if ((bindFlags & BindFlags::IndirectBuffer) != 0)
+        barriers |= GL_COMMAND_BARRIER_BIT;
+    if ((bindFlags & BindFlags::StreamOutputBuffer) != 0)
+        barriers |= GL_TRANSFORM_FEEDBACK_BARRIER_BIT;
+    if ((bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0)
+        barriers |= GL_FRAMEBUFFER_BARRIER_BIT;
+    #endif // /__APPLE__
+
+    return barriers;
+}
+
 void GLCommandBuffer::InitializeGLClearValue(GLClearValue& dst)
 {
     dst.color[0]    = 0.0f;
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/CommandBuffer.h>
+#include "../OpenGL.h"
 
 
 namespace LLGL
@@ -32,6 +33,9 @@ class GLCommandBuffer : public CommandBuffer
         // Configures the attributes of 'renderState' for the type of index buffers.
         void SetIndexFormat(GLRenderState& renderState, bool index16Bits, std::uint64_t offset);
 
+        // Returns the bitfield for glMemoryBarrier for the specified binding flags (see BindFlags).
+        static GLbitfield GetGLMemoryBarriers(long bindFlags);
+
     protected:
 
         // Initializes POD structures which have no default initialization:
@@ -48,7 +48,7 @@ namespace LLGL
 {
 
 
-static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager& stateMngr)
+std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager& stateMngr)
 {
     switch (opcode)
     {
@@ -85,7 +85,7 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         case GLOpcodeExecute:
         {
             auto cmd = reinterpret_cast<const GLCmdExecute*>(pc);
-            ExecuteGLDeferredCommandBuffer(*(cmd->commandBuffer), stateMngr);
+            ExecuteGLDeferredCommandBufferIsolated(*(cmd->commandBuffer), stateMngr);
             return sizeof(*cmd);
         }
         case GLOpcodeSetAPIDepState:
@@ -237,6 +237,12 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             cmd->resourceHeap->Bind(stateMngr);
             return sizeof(*cmd);
         }
+        case GLOpcodeBindResourceHeapDynamic:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindResourceHeapDynamic*>(pc);
+            cmd->resourceHeap->BindWithDynamicOffsets(stateMngr, cmd->numDynamicOffsets, reinterpret_cast<const std::uint32_t*>(cmd + 1));
+            return (sizeof(*cmd) + sizeof(std::uint32_t)*cmd->numDynamicOffsets);
+        }
         case GLOpcodeBindRenderPass:
         {
             auto cmd = reinterpret_cast<const GLCmdBindRenderPass*>(pc);
@@ -423,6 +429,14 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
                 stateMngr.UnbindSamplers(cmd->first, cmd->count);
             return sizeof(*cmd);
         }
+        case GLOpcodeMemoryBarrier:
+        {
+            auto cmd = reinterpret_cast<const GLCmdMemoryBarrier*>(pc);
+            #ifndef __APPLE__
+            glMemoryBarrier(cmd->barriers);
+            #endif
+            return sizeof(*cmd);
+        }
         #ifdef GL_KHR_debug
         case GLOpcodePushDebugGroup:
         {
@@ -441,11 +455,274 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
     }
 }
 
-static void ExecuteGLCommandsEmulated(const std::vector<std::uint8_t>& rawBuffer, GLStateManager& stateMngr)
+std::size_t GLCommandSize(const GLOpcode opcode, const void* pc)
 {
+    /* Must be kept in sync with the payload sizes returned by ExecuteGLCommand */
+    switch (opcode)
+    {
+        case GLOpcodeBufferSubData:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBufferSubData*>(pc);
+            return (sizeof(*cmd) + cmd->size);
+        }
+        case GLOpcodeCopyBufferSubData:
+            return sizeof(GLCmdCopyBufferSubData);
+        case GLOpcodeCopyImageSubData:
+            return sizeof(GLCmdCopyImageSubData);
+        case GLOpcodeGenerateMipmap:
+            return sizeof(GLCmdGenerateMipmap);
+        case GLOpcodeGenerateMipmapSubresource:
+            return sizeof(GLCmdGenerateMipmapSubresource);
+        case GLOpcodeExecute:
+            return sizeof(GLCmdExecute);
+        case GLOpcodeSetAPIDepState:
+            return sizeof(GLCmdSetAPIDepState);
+        case GLOpcodeViewport:
+            return sizeof(GLCmdViewport);
+        case GLOpcodeViewportArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdViewportArray*>(pc);
+            return (sizeof(*cmd) + sizeof(GLViewport)*cmd->count + sizeof(GLDepthRange)*cmd->count);
+        }
+        case GLOpcodeScissor:
+            return sizeof(GLCmdScissor);
+        case GLOpcodeScissorArray:
+        {
+            auto cmd = reinterpret_cast<const GLCmdScissorArray*>(pc);
+            return (sizeof(*cmd) + sizeof(GLScissor)*cmd->count);
+        }
+        case GLOpcodeClearColor:
+            return sizeof(GLCmdClearColor);
+        case GLOpcodeClearDepth:
+            return sizeof(GLCmdClearDepth);
+        case GLOpcodeClearStencil:
+            return sizeof(GLCmdClearStencil);
+        case GLOpcodeClear:
+            return sizeof(GLCmdClear);
+        case GLOpcodeClearBuffers:
+            return sizeof(GLCmdClearBuffers);
+        case GLOpcodeBindVertexArray:
+            return sizeof(GLCmdBindVertexArray);
+        case GLOpcodeBindGL2XVertexArray:
+            return sizeof(GLCmdBindGL2XVertexArray);
+        case GLOpcodeBindElementArrayBufferToVAO:
+            return sizeof(GLCmdBindElementArrayBufferToVAO);
+        case GLOpcodeBindBufferBase:
+            return sizeof(GLCmdBindBufferBase);
+        case GLOpcodeBindBuffersBase:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindBuffersBase*>(pc);
+            return (sizeof(*cmd) + sizeof(GLuint)*cmd->count);
+        }
+        case GLOpcodeBeginTransformFeedback:
+            return sizeof(GLCmdBeginTransformFeedback);
+        case GLOpcodeBeginTransformFeedbackNV:
+            return sizeof(GLCmdBeginTransformFeedbackNV);
+        case GLOpcodeEndTransformFeedback:
+        case GLOpcodeEndTransformFeedbackNV:
+            return 0;
+        case GLOpcodeBindResourceHeap:
+            return sizeof(GLCmdBindResourceHeap);
+        case GLOpcodeBindResourceHeapDynamic:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindResourceHeapDynamic*>(pc);
+            return (sizeof(*cmd) + sizeof(std::uint32_t)*cmd->numDynamicOffsets);
+        }
+        case GLOpcodeBindRenderPass:
+        {
+            auto cmd = reinterpret_cast<const GLCmdBindRenderPass*>(pc);
+            return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
+        }
+        case GLOpcodeBindGraphicsPipeline:
+            return sizeof(GLCmdBindGraphicsPipeline);
+        case GLOpcodeBindComputePipeline:
+            return sizeof(GLCmdBindComputePipeline);
+        case GLOpcodeSetUniforms:
+        {
+            auto cmd = reinterpret_cast<const GLCmdSetUniforms*>(pc);
+            return (sizeof(*cmd) + cmd->size);
+        }
+        case GLOpcodeBeginQuery:
+            return sizeof(GLCmdBeginQuery);
+        case GLOpcodeEndQuery:
+            return sizeof(GLCmdEndQuery);
+        case GLOpcodeBeginConditionalRender:
+            return sizeof(GLCmdBeginConditionalRender);
+        case GLOpcodeEndConditionalRender:
+            return 0;
+        case GLOpcodeDrawArrays:
+            return sizeof(GLCmdDrawArrays);
+        case GLOpcodeDrawArraysInstanced:
+            return sizeof(GLCmdDrawArraysInstanced);
+        case GLOpcodeDrawArraysInstancedBaseInstance:
+            return sizeof(GLCmdDrawArraysInstancedBaseInstance);
+        case GLOpcodeDrawArraysIndirect:
+            return sizeof(GLCmdDrawArraysIndirect);
+        case GLOpcodeDrawElements:
+            return sizeof(GLCmdDrawElements);
+        case GLOpcodeDrawElementsBaseVertex:
+            return sizeof(GLCmdDrawElementsBaseVertex);
+        case GLOpcodeDrawElementsInstanced:
+            return sizeof(GLCmdDrawElementsInstanced);
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+            return sizeof(GLCmdDrawElementsInstancedBaseVertex);
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+            return sizeof(GLCmdDrawElementsInstancedBaseVertexBaseInstance);
+        case GLOpcodeDrawElementsIndirect:
+            return sizeof(GLCmdDrawElementsIndirect);
+        case GLOpcodeMultiDrawArraysIndirect:
+            return sizeof(GLCmdMultiDrawArraysIndirect);
+        case GLOpcodeMultiDrawElementsIndirect:
+            return sizeof(GLCmdMultiDrawElementsIndirect);
+        case GLOpcodeDispatchCompute:
+            return sizeof(GLCmdDispatchCompute);
+        case GLOpcodeDispatchComputeIndirect:
+            return sizeof(GLCmdDispatchComputeIndirect);
+        case GLOpcodeBindTexture:
+            return sizeof(GLCmdBindTexture);
+        case GLOpcodeBindSampler:
+            return sizeof(GLCmdBindSampler);
+        case GLOpcodeUnbindResources:
+            return sizeof(GLCmdUnbindResources);
+        case GLOpcodeMemoryBarrier:
+            return sizeof(GLCmdMemoryBarrier);
+        case GLOpcodePushDebugGroup:
+        {
+            auto cmd = reinterpret_cast<const GLCmdPushDebugGroup*>(pc);
+            return (sizeof(*cmd) + cmd->length + 1);
+        }
+        case GLOpcodePopDebugGroup:
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+#if defined LLGL_GL_ENABLE_OPCODE_THREADED_DISPATCH && (defined __GNUC__ || defined __clang__)
+
+/*
+X-macro over all virtual GL opcodes in declaration order of the GLOpcode enumeration (see GLCommandOpcode.h).
+This must be kept in sync with the enumeration, since the jump table below is indexed by opcode value.
+*/
+#define LLGL_GL_OPCODE_LIST(X)                              \
+    X( BufferSubData                                      ) \
+    X( CopyBufferSubData                                  ) \
+    X( CopyImageSubData                                   ) \
+    X( GenerateMipmap                                     ) \
+    X( GenerateMipmapSubresource                          ) \
+    X( SetAPIDepState                                     ) \
+    X( Execute                                            ) \
+    X( Viewport                                           ) \
+    X( ViewportArray                                      ) \
+    X( Scissor                                            ) \
+    X( ScissorArray                                       ) \
+    X( ClearColor                                         ) \
+    X( ClearDepth                                         ) \
+    X( ClearStencil                                       ) \
+    X( Clear                                              ) \
+    X( ClearBuffers                                       ) \
+    X( BindVertexArray                                    ) \
+    X( BindGL2XVertexArray                                ) \
+    X( BindElementArrayBufferToVAO                        ) \
+    X( BindBufferBase                                     ) \
+    X( BindBuffersBase                                    ) \
+    X( BeginTransformFeedback                             ) \
+    X( BeginTransformFeedbackNV                           ) \
+    X( EndTransformFeedback                               ) \
+    X( EndTransformFeedbackNV                             ) \
+    X( BindResourceHeap                                   ) \
+    X( BindResourceHeapDynamic                            ) \
+    X( BindRenderPass                                     ) \
+    X( BindGraphicsPipeline                               ) \
+    X( BindComputePipeline                                ) \
+    X( SetUniforms                                        ) \
+    X( BeginQuery                                         ) \
+    X( EndQuery                                           ) \
+    X( BeginConditionalRender                             ) \
+    X( EndConditionalRender                               ) \
+    X( DrawArrays                                         ) \
+    X( DrawArraysInstanced                                ) \
+    X( DrawArraysInstancedBaseInstance                    ) \
+    X( DrawArraysIndirect                                 ) \
+    X( DrawElements                                       ) \
+    X( DrawElementsBaseVertex                             ) \
+    X( DrawElementsInstanced                              ) \
+    X( DrawElementsInstancedBaseVertex                    ) \
+    X( DrawElementsInstancedBaseVertexBaseInstance        ) \
+    X( DrawElementsIndirect                               ) \
+    X( MultiDrawArraysIndirect                            ) \
+    X( MultiDrawElementsIndirect                          ) \
+    X( DispatchCompute                                    ) \
+    X( DispatchComputeIndirect                            ) \
+    X( BindTexture                                        ) \
+    X( BindSampler                                        ) \
+    X( UnbindResources                                    ) \
+    X( MemoryBarrier                                      ) \
+    X( PushDebugGroup                                     ) \
+    X( PopDebugGroup                                      )
+
+/*
+Threaded (computed-goto) interpreter: each command jumps directly to the handler of the next opcode
+instead of returning to a central dispatch loop, which removes one branch misprediction per command.
+Passing the opcode as a compile-time constant lets the compiler fold ExecuteGLCommand down to the
+respective case body, so the command logic itself is shared with the switch-based interpreter.
+*/
+static void ExecuteGLCommandChunkThreaded(const std::uint8_t* data, std::size_t size, GLStateManager& stateMngr)
+{
+    #define LLGL_GL_OPCODE_JUMP_ADDR(NAME) &&label_##NAME,
+    #define LLGL_GL_OPCODE_HANDLER(NAME)                                    \
+        label_##NAME:                                                       \
+        pc += ExecuteGLCommand(GLOpcode##NAME, pc, stateMngr);              \
+        LLGL_GL_OPCODE_DISPATCH_NEXT()
+    #define LLGL_GL_OPCODE_DISPATCH_NEXT()                                  \
+        {                                                                   \
+            if (pc >= pcEnd)                                                \
+                return;                                                     \
+            const auto opcode = *reinterpret_cast<const GLOpcode*>(pc);     \
+            pc += sizeof(GLOpcode);                                         \
+            goto *jumpTable[opcode];                                        \
+        }
+
+    /* Jump table indexed by opcode value; entry 0 is unused (opcodes start at 1) */
+    static const void* const jumpTable[] =
+    {
+        &&label_End,
+        LLGL_GL_OPCODE_LIST(LLGL_GL_OPCODE_JUMP_ADDR)
+    };
+
     /* Initialize program counter to execute virtual GL commands */
-    auto pc     = rawBuffer.data();
-    auto pcEnd  = rawBuffer.data() + rawBuffer.size();
+    auto pc     = data;
+    auto pcEnd  = data + size;
+
+    LLGL_GL_OPCODE_DISPATCH_NEXT();
+
+    LLGL_GL_OPCODE_LIST(LLGL_GL_OPCODE_HANDLER);
+
+    label_End:
+    return;
+
+    #undef LLGL_GL_OPCODE_JUMP_ADDR
+    #undef LLGL_GL_OPCODE_HANDLER
+    #undef LLGL_GL_OPCODE_DISPATCH_NEXT
+}
+
+static void ExecuteGLCommandsEmulated(const GLCommandArena& arena, GLStateManager& stateMngr)
+{
+    arena.ForEachChunk(
+        [&stateMngr](const std::uint8_t* data, std::size_t size)
+        {
+            ExecuteGLCommandChunkThreaded(data, size, stateMngr);
+        }
+    );
+}
+
+#else // !LLGL_GL_ENABLE_OPCODE_THREADED_DISPATCH
+
+static void ExecuteGLCommandChunk(const std::uint8_t* data, std::size_t size, GLStateManager& stateMngr)
+{
+    /* Initialize program counter to execute virtual GL commands */
+    auto pc     = data;
+    auto pcEnd  = data + size;
 
     GLOpcode opcode;
 
@@ -460,6 +737,18 @@ static void ExecuteGLCommandsEmulated(const std::vector<std::uint8_t>& rawBuffer
     }
 }
 
+static void ExecuteGLCommandsEmulated(const GLCommandArena& arena, GLStateManager& stateMngr)
+{
+    arena.ForEachChunk(
+        [&stateMngr](const std::uint8_t* data, std::size_t size)
+        {
+            ExecuteGLCommandChunk(data, size, stateMngr);
+        }
+    );
+}
+
+#endif // /LLGL_GL_ENABLE_OPCODE_THREADED_DISPATCH
+
 #ifdef LLGL_ENABLE_JIT_COMPILER
 
 static void ExecuteGLCommandsNatively(const JITProgram& exec, GLStateManager& stateMngr)
@@ -482,10 +771,21 @@ void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer, GL
     #endif // /LLGL_ENABLE_JIT_COMPILER
     {
         /* Emulate execution of GL commands */
-        ExecuteGLCommandsEmulated(cmdBuffer.GetRawBuffer(), stateMngr);
+        ExecuteGLCommandsEmulated(cmdBuffer.GetCommandArena(), stateMngr);
     }
 }
 
+void ExecuteGLDeferredCommandBufferIsolated(const GLDeferredCommandBuffer& cmdBuffer, GLStateManager& stateMngr)
+{
+    /* Capture binding caches, execute the command buffer, then re-bind only the bindings that diverged */
+    GLStateManager::GLBindingSnapshot snapshot;
+    stateMngr.CaptureBindingSnapshot(snapshot);
+
+    ExecuteGLDeferredCommandBuffer(cmdBuffer, stateMngr);
+
+    stateMngr.RestoreBindingSnapshot(snapshot);
+}
+
 void ExecuteGLCommandBuffer(const GLCommandBuffer& cmdBuffer, GLStateManager& stateMngr)
 {
     /* Is this a secondary command buffer? */
@@ -9,6 +9,10 @@
 #define LLGL_GL_COMMAND_EXECUTOR_H
 
 
+#include "GLCommandOpcode.h"
+#include <cstddef>
+
+
 namespace LLGL
 {
 
@@ -24,6 +28,22 @@ GL render states are tracked with the specified state manager.
 void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdbuffer, GLStateManager& stateMngr);
 void ExecuteGLCommandBuffer(const GLCommandBuffer& cmdbuffer, GLStateManager& stateMngr);
 
+/*
+Executes the specified deferred command buffer with binding isolation:
+the binding caches of the state manager are captured beforehand and diff-restored afterwards,
+so nested and repeated execution does not perturb the state the enclosing command buffer relies on.
+*/
+void ExecuteGLDeferredCommandBufferIsolated(const GLDeferredCommandBuffer& cmdbuffer, GLStateManager& stateMngr);
+
+/*
+Executes a single emulated GL command; 'pc' must point directly behind the opcode.
+Returns the size (in bytes) of the command payload to advance the program counter.
+*/
+std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager& stateMngr);
+
+// Returns the size (in bytes) of the payload of the specified GL command without executing it.
+std::size_t GLCommandSize(const GLOpcode opcode, const void* pc);
+
 
 } // /namespace LLGL
 
@@ -44,6 +44,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeEndTransformFeedback,
     GLOpcodeEndTransformFeedbackNV,
     GLOpcodeBindResourceHeap,
+    GLOpcodeBindResourceHeapDynamic,
     GLOpcodeBindRenderPass,
     GLOpcodeBindGraphicsPipeline,
     GLOpcodeBindComputePipeline,
@@ -69,6 +70,7 @@ enum GLOpcode : std::uint8_t
     GLOpcodeBindTexture,
     GLOpcodeBindSampler,
     GLOpcodeUnbindResources,
+    GLOpcodeMemoryBarrier,
     GLOpcodePushDebugGroup,
     GLOpcodePopDebugGroup,
 };
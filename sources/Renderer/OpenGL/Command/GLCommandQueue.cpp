@@ -178,6 +178,17 @@ bool GLCommandQueue::QueryResult(
     return false;
 }
 
+bool GLCommandQueue::QueryResultAvailable(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries)
+{
+    auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
+
+    /* Multiply query range by the query group size */
+    firstQuery *= queryHeapGL.GetGroupSize();
+    numQueries *= queryHeapGL.GetGroupSize();
+
+    return AreQueryResultsAvailable(queryHeapGL, firstQuery, numQueries);
+}
+
 /* ----- Fences ----- */
 
 void GLCommandQueue::Submit(Fence& fence)
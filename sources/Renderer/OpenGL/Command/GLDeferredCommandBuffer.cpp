@@ -50,7 +50,7 @@ namespace LLGL
 GLDeferredCommandBuffer::GLDeferredCommandBuffer(long flags, std::size_t reservedSize) :
     flags_ { flags }
 {
-    buffer_.reserve(reservedSize);
+    buffer_.Reserve(reservedSize);
     GLCommandBuffer::InitializeGLRenderState(renderState_);
     GLCommandBuffer::InitializeGLClearValue(clearValue_);
 }
@@ -60,7 +60,7 @@ GLDeferredCommandBuffer::GLDeferredCommandBuffer(long flags, std::size_t reserve
 void GLDeferredCommandBuffer::Begin()
 {
     /* Reset internal command buffer */
-    buffer_.clear();
+    buffer_.Reset();
     boundShaderProgram_ = 0;
 
     #ifdef LLGL_ENABLE_JIT_COMPILER
@@ -321,7 +321,7 @@ void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
-        auto& bufferWithVAO = LLGL_CAST(const GLBufferWithVAO&, buffer);
+        auto& bufferWithVAO = LLGL_CAST(GLBufferWithVAO&, buffer);
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         if (!HasExtension(GLExt::ARB_vertex_array_object))
         {
@@ -341,7 +341,7 @@ void GLDeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
     if ((bufferArray.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
-        auto& bufferArrayWithVAO = LLGL_CAST(const GLBufferArrayWithVAO&, bufferArray);
+        auto& bufferArrayWithVAO = LLGL_CAST(GLBufferArrayWithVAO&, bufferArray);
         #ifdef LLGL_GL_ENABLE_OPENGL2X
         if (!HasExtension(GLExt::ARB_vertex_array_object))
         {
@@ -444,6 +444,30 @@ void GLDeferredCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap,
     SetResourceHeap(resourceHeap);
 }
 
+void GLDeferredCommandBuffer::SetGraphicsResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           /*startSlot*/,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    auto cmd = AllocCommand<GLCmdBindResourceHeapDynamic>(GLOpcodeBindResourceHeapDynamic, sizeof(std::uint32_t)*numDynamicOffsets);
+    {
+        cmd->resourceHeap       = LLGL_CAST(GLResourceHeap*, &resourceHeap);
+        cmd->numDynamicOffsets  = numDynamicOffsets;
+        ::memcpy(cmd + 1, dynamicOffsets, sizeof(std::uint32_t)*numDynamicOffsets);
+    }
+}
+
+void GLDeferredCommandBuffer::SetComputeResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           startSlot,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    /* GL binds graphics and compute resources identically */
+    SetGraphicsResourceHeap(resourceHeap, startSlot, numDynamicOffsets, dynamicOffsets);
+}
+
 void GLDeferredCommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags)
 {
     switch (resource.GetResourceType())
@@ -539,6 +563,19 @@ void GLDeferredCommandBuffer::ResetResourceSlots(
     }
 }
 
+void GLDeferredCommandBuffer::EndResourceTransition(Resource& /*resource*/, long bindFlags)
+{
+    /* GL only supports global memory barriers, so the resource itself is ignored */
+    #ifndef __APPLE__
+    const GLbitfield barriers = GetGLMemoryBarriers(bindFlags);
+    if (barriers != 0)
+    {
+        auto cmd = AllocCommand<GLCmdMemoryBarrier>(GLOpcodeMemoryBarrier);
+        cmd->barriers = barriers;
+    }
+    #endif
+}
+
 /* ----- Render Passes ----- */
 
 void GLDeferredCommandBuffer::BeginRenderPass(
@@ -981,19 +1018,18 @@ void GLDeferredCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap)
 
 void GLDeferredCommandBuffer::AllocOpCode(const GLOpcode opcode)
 {
-    buffer_.push_back(opcode);
+    *buffer_.Alloc(sizeof(opcode)) = opcode;
 }
 
 template <typename T>
 T* GLDeferredCommandBuffer::AllocCommand(const GLOpcode opcode, std::size_t extraSize)
 {
-    /* Resize internal buffer for opcode, command structure, and extra size */
-    auto offset = buffer_.size();
+    /* Allocate opcode, command structure, and extra size as a single block */
+    auto data = buffer_.Alloc(sizeof(opcode) + sizeof(T) + extraSize);
     {
-        buffer_.resize(offset + sizeof(opcode) + sizeof(T) + extraSize);
-        buffer_[offset] = opcode;
+        data[0] = opcode;
     }
-    return reinterpret_cast<T*>(&(buffer_[offset + sizeof(opcode)]));
+    return reinterpret_cast<T*>(data + sizeof(opcode));
 }
 
 
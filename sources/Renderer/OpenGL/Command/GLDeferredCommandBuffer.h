@@ -11,6 +11,7 @@
 
 #include "GLCommandBuffer.h"
 #include "GLCommandOpcode.h"
+#include "GLCommandArena.h"
 #include "../RenderState/GLState.h"
 #include "../OpenGL.h"
 #include <memory>
@@ -114,6 +115,9 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot) override;
         void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot) override;
 
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets) override;
+
         void SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags = StageFlags::AllStages) override;
 
         void ResetResourceSlots(
@@ -124,6 +128,8 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
             long                stageFlags      = StageFlags::AllStages
         ) override;
 
+        void EndResourceTransition(Resource& resource, long bindFlags) override;
+
         /* ----- Render Passes ----- */
 
         void BeginRenderPass(
@@ -205,8 +211,8 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         // Returns true if this is a primary command buffer.
         bool IsPrimary() const;
 
-        // Returns the internal command buffer as raw byte buffer.
-        inline const std::vector<std::uint8_t>& GetRawBuffer() const
+        // Returns the chunked arena that stores the encoded command stream.
+        inline const GLCommandArena& GetCommandArena() const
         {
             return buffer_;
         }
@@ -261,7 +267,7 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         GLuint                      boundShaderProgram_ = 0;
 
         long                        flags_              = 0;
-        std::vector<std::uint8_t>   buffer_;
+        GLCommandArena              buffer_;
 
         #ifdef LLGL_ENABLE_JIT_COMPILER
         std::unique_ptr<JITProgram> executable_;
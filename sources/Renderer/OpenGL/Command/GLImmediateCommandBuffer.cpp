@@ -367,6 +367,26 @@ void GLImmediateCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap
     SetResourceHeap(resourceHeap);
 }
 
+void GLImmediateCommandBuffer::SetGraphicsResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           /*startSlot*/,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
+    resourceHeapGL.BindWithDynamicOffsets(*stateMngr_, numDynamicOffsets, dynamicOffsets);
+}
+
+void GLImmediateCommandBuffer::SetComputeResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           /*startSlot*/,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
+    resourceHeapGL.BindWithDynamicOffsets(*stateMngr_, numDynamicOffsets, dynamicOffsets);
+}
+
 void GLImmediateCommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long /*stageFlags*/)
 {
     switch (resource.GetResourceType())
@@ -461,6 +481,16 @@ void GLImmediateCommandBuffer::ResetResourceSlots(
     }
 }
 
+void GLImmediateCommandBuffer::EndResourceTransition(Resource& /*resource*/, long bindFlags)
+{
+    /* GL only supports global memory barriers, so the resource itself is ignored */
+    #ifndef __APPLE__
+    const GLbitfield barriers = GetGLMemoryBarriers(bindFlags);
+    if (barriers != 0)
+        glMemoryBarrier(barriers);
+    #endif
+}
+
 /* ----- Render Passes ----- */
 
 void GLImmediateCommandBuffer::BeginRenderPass(
@@ -749,6 +779,134 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     }
 }
 
+void GLImmediateCommandBuffer::DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands)
+{
+    /* Record all draw commands with a tight loop to amortize the per-call overhead */
+    for (std::uint32_t i = 0; i < numCommands; ++i)
+    {
+        const auto& args = commands[i];
+        if (args.numInstances == 1 && args.firstInstance == 0)
+        {
+            glDrawArrays(
+                renderState_.drawMode,
+                static_cast<GLint>(args.firstVertex),
+                static_cast<GLsizei>(args.numVertices)
+            );
+        }
+        else if (args.firstInstance == 0)
+        {
+            glDrawArraysInstanced(
+                renderState_.drawMode,
+                static_cast<GLint>(args.firstVertex),
+                static_cast<GLsizei>(args.numVertices),
+                static_cast<GLsizei>(args.numInstances)
+            );
+        }
+        else
+        {
+            #ifndef __APPLE__
+            glDrawArraysInstancedBaseInstance(
+                renderState_.drawMode,
+                static_cast<GLint>(args.firstVertex),
+                static_cast<GLsizei>(args.numVertices),
+                static_cast<GLsizei>(args.numInstances),
+                args.firstInstance
+            );
+            #else
+            ErrUnsupportedGLProc("glDrawArraysInstancedBaseInstance");
+            #endif
+        }
+    }
+}
+
+void GLImmediateCommandBuffer::DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands)
+{
+    /* Check if entire batch is non-instanced to map it onto a native multi draw command */
+    bool isNonInstancedBatch = true;
+
+    for (std::uint32_t i = 0; i < numCommands; ++i)
+    {
+        if (commands[i].numInstances != 1 || commands[i].firstInstance != 0)
+        {
+            isNonInstancedBatch = false;
+            break;
+        }
+    }
+
+    if (isNonInstancedBatch && HasExtension(GLExt::ARB_draw_elements_base_vertex))
+    {
+        /* Convert draw arguments into the array-of-arrays layout of the native multi draw command */
+        multiDrawCounts_.resize(numCommands);
+        multiDrawIndices_.resize(numCommands);
+        multiDrawBaseVertices_.resize(numCommands);
+
+        for (std::uint32_t i = 0; i < numCommands; ++i)
+        {
+            const auto& args    = commands[i];
+            const auto indices  = (renderState_.indexBufferOffset + args.firstIndex * renderState_.indexBufferStride);
+
+            multiDrawCounts_[i]         = static_cast<GLsizei>(args.numIndices);
+            multiDrawIndices_[i]        = reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(indices));
+            multiDrawBaseVertices_[i]   = args.vertexOffset;
+        }
+
+        glMultiDrawElementsBaseVertex(
+            renderState_.drawMode,
+            multiDrawCounts_.data(),
+            renderState_.indexBufferDataType,
+            multiDrawIndices_.data(),
+            static_cast<GLsizei>(numCommands),
+            multiDrawBaseVertices_.data()
+        );
+    }
+    else
+    {
+        /* Record all draw commands with a tight loop to amortize the per-call overhead */
+        for (std::uint32_t i = 0; i < numCommands; ++i)
+        {
+            const auto& args    = commands[i];
+            const auto indices  = (renderState_.indexBufferOffset + args.firstIndex * renderState_.indexBufferStride);
+            if (args.numInstances == 1 && args.firstInstance == 0)
+            {
+                glDrawElementsBaseVertex(
+                    renderState_.drawMode,
+                    static_cast<GLsizei>(args.numIndices),
+                    renderState_.indexBufferDataType,
+                    reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(indices)),
+                    args.vertexOffset
+                );
+            }
+            else if (args.firstInstance == 0)
+            {
+                glDrawElementsInstancedBaseVertex(
+                    renderState_.drawMode,
+                    static_cast<GLsizei>(args.numIndices),
+                    renderState_.indexBufferDataType,
+                    reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(indices)),
+                    static_cast<GLsizei>(args.numInstances),
+                    args.vertexOffset
+                );
+            }
+            else
+            {
+                #ifndef __APPLE__
+                glDrawElementsInstancedBaseVertexBaseInstance(
+                    renderState_.drawMode,
+                    static_cast<GLsizei>(args.numIndices),
+                    renderState_.indexBufferDataType,
+                    reinterpret_cast<const GLvoid*>(static_cast<GLintptr>(indices)),
+                    static_cast<GLsizei>(args.numInstances),
+                    args.vertexOffset,
+                    args.firstInstance
+                );
+                #else
+                ErrUnsupportedGLProc("glDrawElementsInstancedBaseVertexBaseInstance");
+                #endif
+            }
+        }
+    }
+}
+
 /* ----- Compute ----- */
 
 void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
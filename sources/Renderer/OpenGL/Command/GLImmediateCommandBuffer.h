@@ -13,6 +13,7 @@
 #include "../RenderState/GLState.h"
 #include "../OpenGL.h"
 #include <memory>
+#include <vector>
 
 
 namespace LLGL
@@ -106,6 +107,9 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
         void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot) override;
         void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot) override;
 
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t startSlot, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets) override;
+
         void SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags = StageFlags::AllStages) override;
 
         void ResetResourceSlots(
@@ -116,6 +120,8 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
             long                stageFlags      = StageFlags::AllStages
         ) override;
 
+        void EndResourceTransition(Resource& resource, long bindFlags) override;
+
         /* ----- Render Passes ----- */
 
         void BeginRenderPass(
@@ -173,6 +179,9 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
 
+        void DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands) override;
+        void DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands) override;
+
         /* ----- Compute ----- */
 
         void Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ) override;
@@ -207,6 +216,11 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
         GLRenderState                   renderState_;
         GLClearValue                    clearValue_;
 
+        /* Scratch arrays for multi draw commands (kept as members to avoid per-call allocations) */
+        std::vector<GLsizei>            multiDrawCounts_;
+        std::vector<const GLvoid*>      multiDrawIndices_;
+        std::vector<GLint>              multiDrawBaseVertices_;
+
 };
 
 
@@ -8,6 +8,7 @@
 #include "GLExtensionLoader.h"
 #include "GLExtensions.h"
 #include "GLExtensionsProxy.h"
+#include "../../GLCommon/GLCore.h"
 #include <LLGL/Log.h>
 #include <functional>
 
@@ -44,6 +45,23 @@ bool LoadGLProc(T& procAddr, const char* procName)
     return true;
 }
 
+#ifdef LLGL_GL_ENABLE_LAZY_EXT_LOADING
+
+void* GLLazyProcAddress(const char* procName)
+{
+    /* Resolve procedure address on first call; see self-patching thunks in GLExtensions.cpp */
+    #if defined(_WIN32)
+    if (auto procAddr = reinterpret_cast<void*>(wglGetProcAddress(procName)))
+        return procAddr;
+    #elif defined(__linux__)
+    if (auto procAddr = reinterpret_cast<void*>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName))))
+        return procAddr;
+    #endif
+    ErrUnsupportedGLProc(procName);
+}
+
+#endif // /LLGL_GL_ENABLE_LAZY_EXT_LOADING
+
 static void ExtractExtensionsFromString(GLExtensionList& extensions, const std::string& extString)
 {
     size_t first = 0, last = 0;
@@ -213,6 +231,7 @@ static bool Load_GL_ARB_draw_elements_base_vertex(bool usePlaceholder)
 {
     LOAD_GLPROC( glDrawElementsBaseVertex          );
     LOAD_GLPROC( glDrawElementsInstancedBaseVertex );
+    LOAD_GLPROC( glMultiDrawElementsBaseVertex     );
     return true;
 }
 
@@ -225,6 +244,7 @@ static bool Load_GL_ARB_shader_objects(bool usePlaceholder)
     LOAD_GLPROC( glCompileShader      );
     LOAD_GLPROC( glGetShaderiv        );
     LOAD_GLPROC( glGetShaderInfoLog   );
+    LOAD_GLPROC( glGetShaderSource    );
     LOAD_GLPROC( glDeleteShader       );
     LOAD_GLPROC( glCreateProgram      );
     LOAD_GLPROC( glDeleteProgram      );
@@ -404,6 +424,12 @@ static bool Load_GL_ARB_texture_view(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_texture_barrier(bool usePlaceholder)
+{
+    LOAD_GLPROC( glTextureBarrier );
+    return true;
+}
+
 static bool Load_GL_ARB_sampler_objects(bool usePlaceholder)
 {
     LOAD_GLPROC( glGenSamplers        );
@@ -626,6 +652,13 @@ static bool Load_GL_ARB_buffer_storage(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_map_buffer_range(bool usePlaceholder)
+{
+    LOAD_GLPROC( glMapBufferRange         );
+    LOAD_GLPROC( glFlushMappedBufferRange );
+    return true;
+}
+
 static bool Load_GL_ARB_copy_buffer(bool usePlaceholder)
 {
     LOAD_GLPROC( glCopyBufferSubData );
@@ -679,6 +712,16 @@ static bool Load_GL_ARB_multi_draw_indirect(bool usePlaceholder)
     return true;
 }
 
+static bool Load_GL_ARB_bindless_texture(bool usePlaceholder)
+{
+    LOAD_GLPROC( glGetTextureHandleARB            );
+    LOAD_GLPROC( glGetTextureSamplerHandleARB     );
+    LOAD_GLPROC( glMakeTextureHandleResidentARB   );
+    LOAD_GLPROC( glMakeTextureHandleNonResidentARB);
+    LOAD_GLPROC( glIsTextureHandleResidentARB     );
+    return true;
+}
+
 static bool Load_GL_ARB_direct_state_access(bool usePlaceholder)
 {
     LOAD_GLPROC( glCreateTransformFeedbacks                 );
@@ -917,6 +960,21 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
 
     #else
 
+    #ifdef LLGL_GL_ENABLE_LAZY_EXT_LOADING
+
+    auto LoadExtension = [&](const std::string& extName, const std::function<bool(bool)>& /*extLoadingProc*/, GLExt extensionID) -> void
+    {
+        /* Lazy loading: only register the extension; the procedures resolve themselves on first call */
+        auto it = extensions.find(extName);
+        if (it != extensions.end())
+        {
+            RegisterExtension(extensionID);
+            it->second = true;
+        }
+    };
+
+    #else
+
     auto LoadExtension = [&](const std::string& extName, const std::function<bool(bool)>& extLoadingProc, GLExt extensionID) -> void
     {
         /* Try to load OpenGL extension */
@@ -944,6 +1002,8 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
         #endif
     };
 
+    #endif // /LLGL_GL_ENABLE_LAZY_EXT_LOADING
+
     auto EnableExtension = [&](const std::string& extName, GLExt extensionID) -> void
     {
         /* Try to enable OpenGL extension */
@@ -1002,6 +1062,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_texture_compression          );
     LOAD_GLEXT( ARB_texture_multisample          );
     LOAD_GLEXT( ARB_texture_view                 );
+    LOAD_GLEXT( ARB_texture_barrier              );
     LOAD_GLEXT( ARB_sampler_objects              );
 
     /* Load blending extensions */
@@ -1032,6 +1093,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_texture_storage              );
     LOAD_GLEXT( ARB_texture_storage_multisample  );
     LOAD_GLEXT( ARB_buffer_storage               );
+    LOAD_GLEXT( ARB_map_buffer_range             );
     LOAD_GLEXT( ARB_copy_buffer                  );
     LOAD_GLEXT( ARB_copy_image                   );
     LOAD_GLEXT( ARB_polygon_offset_clamp         );
@@ -1040,6 +1102,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     LOAD_GLEXT( ARB_clear_buffer_object          );
     LOAD_GLEXT( ARB_draw_indirect                );
     LOAD_GLEXT( ARB_multi_draw_indirect          );
+    LOAD_GLEXT( ARB_bindless_texture             );
     #ifdef LLGL_GL_ENABLE_DSA_EXT
     LOAD_GLEXT( ARB_direct_state_access          );
     #endif
@@ -1052,6 +1115,7 @@ void LoadAllExtensions(GLExtensionList& extensions, bool coreProfile)
     ENABLE_GLEXT( NV_conservative_raster           );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
     ENABLE_GLEXT( ARB_pipeline_statistics_query    );
+    ENABLE_GLEXT( NVX_gpu_memory_info              );
 
     #undef LOAD_GLEXT
     #undef ENABLE_GLEXT
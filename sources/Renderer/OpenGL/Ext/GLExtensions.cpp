@@ -12,6 +12,27 @@ namespace LLGL
 {
 
 
+#ifdef LLGL_GL_ENABLE_LAZY_EXT_LOADING
+
+// Resolves the specified OpenGL procedure address, or throws an std::runtime_error exception on failure (see GLExtensionLoader.cpp).
+void* GLLazyProcAddress(const char* procName);
+
+// Self-patching thunk that resolves the procedure address on first call; see DECL_GLPROC in GLExtensionsDecl.inl.
+template <typename PFNTYPE, PFNTYPE* ProcAddr, typename ProcName>
+struct GLLazyProcThunk;
+
+template <typename RType, typename... Args, RType (APIENTRY **ProcAddr)(Args...), typename ProcName>
+struct GLLazyProcThunk<RType (APIENTRY *)(Args...), ProcAddr, ProcName>
+{
+    static RType APIENTRY Func(Args... args)
+    {
+        *ProcAddr = reinterpret_cast<RType (APIENTRY *)(Args...)>(GLLazyProcAddress(ProcName::Get()));
+        return (*ProcAddr)(args...);
+    }
+};
+
+#endif // /LLGL_GL_ENABLE_LAZY_EXT_LOADING
+
 #define LLGL_DEF_GL_EXT_PROCS
 
 // Include inline header for object definitions
@@ -34,9 +34,30 @@ Depending on the following macros being defined, the respective implementation i
 
 #elif defined LLGL_DEF_GL_EXT_PROCS
 
+#ifdef LLGL_GL_ENABLE_LAZY_EXT_LOADING
+
+/*
+Define the global function pointers with self-patching thunks:
+the first call resolves the actual procedure address and overwrites the global pointer,
+so all subsequent calls dispatch directly through the resolved address.
+*/
+#define DECL_GLPROC(PFNTYPE, NAME, RTYPE, ARGS)                         \
+    struct GLLazyProcName_##NAME                                        \
+    {                                                                   \
+        static const char* Get()                                        \
+        {                                                               \
+            return #NAME;                                               \
+        }                                                               \
+    };                                                                  \
+    PFNTYPE NAME = GLLazyProcThunk<PFNTYPE, &NAME, GLLazyProcName_##NAME>::Func
+
+#else
+
 #define DECL_GLPROC(PFNTYPE, NAME, RTYPE, ARGS) \
     PFNTYPE NAME = nullptr
 
+#endif // /LLGL_GL_ENABLE_LAZY_EXT_LOADING
+
 #else
 
 #define DECL_GLPROC(PFNTYPE, NAME, RTYPE, ARGS) \
@@ -144,6 +165,10 @@ DECL_GLPROC(PFNGLSAMPLEMASKIPROC,                                   glSampleMask
 
 DECL_GLPROC(PFNGLTEXTUREVIEWPROC,                                   glTextureView,                                  void,           (GLuint, GLenum, GLuint, GLenum, GLuint, GLuint, GLuint, GLuint));
 
+/* GL_ARB_texture_barrier */
+
+DECL_GLPROC(PFNGLTEXTUREBARRIERPROC,                                glTextureBarrier,                               void,           (void));
+
 /* GL_ARB_sampler_objects */
 
 DECL_GLPROC(PFNGLGENSAMPLERSPROC,                                   glGenSamplers,                                  void,           (GLsizei, GLuint*));
@@ -238,6 +263,7 @@ DECL_GLPROC(PFNGLDRAWELEMENTSINSTANCEDPROC,                         glDrawElemen
 
 DECL_GLPROC(PFNGLDRAWELEMENTSBASEVERTEXPROC,                        glDrawElementsBaseVertex,                       void,           (GLenum, GLsizei, GLenum, const void*, GLint));
 DECL_GLPROC(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC,               glDrawElementsInstancedBaseVertex,              void,           (GLenum, GLsizei, GLenum, const void*, GLsizei, GLint));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC,                   glMultiDrawElementsBaseVertex,                  void,           (GLenum, const GLsizei*, GLenum, const void* const*, GLsizei, const GLint*));
 
 /* GL_ARB_base_instance */
 
@@ -252,6 +278,7 @@ DECL_GLPROC(PFNGLSHADERSOURCEPROC,                                  glShaderSour
 DECL_GLPROC(PFNGLCOMPILESHADERPROC,                                 glCompileShader,                                void,           (GLuint));
 DECL_GLPROC(PFNGLGETSHADERIVPROC,                                   glGetShaderiv,                                  void,           (GLuint, GLenum, GLint*));
 DECL_GLPROC(PFNGLGETSHADERINFOLOGPROC,                              glGetShaderInfoLog,                             void,           (GLuint, GLsizei, GLsizei*, GLchar*));
+DECL_GLPROC(PFNGLGETSHADERSOURCEPROC,                               glGetShaderSource,                              void,           (GLuint, GLsizei, GLsizei*, GLchar*));
 DECL_GLPROC(PFNGLDELETESHADERPROC,                                  glDeleteShader,                                 void,           (GLuint));
 DECL_GLPROC(PFNGLCREATEPROGRAMPROC,                                 glCreateProgram,                                GLuint,         (void));
 DECL_GLPROC(PFNGLDELETEPROGRAMPROC,                                 glDeleteProgram,                                void,           (GLuint));
@@ -471,6 +498,11 @@ DECL_GLPROC(PFNGLTEXSTORAGE3DMULTISAMPLEPROC,                       glTexStorage
 
 DECL_GLPROC(PFNGLBUFFERSTORAGEPROC,                                 glBufferStorage,                                void,           (GLenum, GLsizeiptr, const void*, GLbitfield));
 
+/* GL_ARB_map_buffer_range */
+
+DECL_GLPROC(PFNGLMAPBUFFERRANGEPROC,                                glMapBufferRange,                               void*,          (GLenum, GLintptr, GLsizeiptr, GLbitfield));
+DECL_GLPROC(PFNGLFLUSHMAPPEDBUFFERRANGEPROC,                        glFlushMappedBufferRange,                       void,           (GLenum, GLintptr, GLsizeiptr));
+
 /* GL_ARB_copy_buffer */
 
 DECL_GLPROC(PFNGLCOPYBUFFERSUBDATAPROC,                             glCopyBufferSubData,                            void,           (GLenum, GLenum, GLintptr, GLintptr, GLsizeiptr));
@@ -608,6 +640,14 @@ DECL_GLPROC(PFNGLGETQUERYBUFFEROBJECTUIVPROC,                       glGetQueryBu
 DECL_GLPROC(PFNGLGETQUERYBUFFEROBJECTI64VPROC,                      glGetQueryBufferObjecti64v,                     void,           (GLuint, GLuint, GLenum, GLintptr));
 DECL_GLPROC(PFNGLGETQUERYBUFFEROBJECTUI64VPROC,                     glGetQueryBufferObjectui64v,                    void,           (GLuint, GLuint, GLenum, GLintptr));
 
+/* GL_ARB_bindless_texture */
+
+DECL_GLPROC(PFNGLGETTEXTUREHANDLEARBPROC,                           glGetTextureHandleARB,                          GLuint64,       (GLuint));
+DECL_GLPROC(PFNGLGETTEXTURESAMPLERHANDLEARBPROC,                    glGetTextureSamplerHandleARB,                   GLuint64,       (GLuint, GLuint));
+DECL_GLPROC(PFNGLMAKETEXTUREHANDLERESIDENTARBPROC,                  glMakeTextureHandleResidentARB,                 void,           (GLuint64));
+DECL_GLPROC(PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC,               glMakeTextureHandleNonResidentARB,              void,           (GLuint64));
+DECL_GLPROC(PFNGLISTEXTUREHANDLERESIDENTARBPROC,                    glIsTextureHandleResidentARB,                   GLboolean,      (GLuint64));
+
 #undef DECL_GLPROC
 
 #endif // /__APPLE__
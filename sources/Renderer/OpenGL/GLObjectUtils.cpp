@@ -9,7 +9,8 @@
 #include "Ext/GLExtensions.h"
 #include "RenderState/GLStateManager.h"
 #include "../GLCommon/GLExtensionRegistry.h"
-#include <string>
+#include "../../Core/SmallVector.h"
+#include <cstdio>
 #include <cstring> // std::strlen
 
 
@@ -47,14 +48,22 @@ void GLSetObjectLabelSubscript(GLenum identifier, GLuint name, const char* label
 {
     if (label != nullptr)
     {
-        /* Append subscript to label */
-        std::string labelWithSubscript = label;
-
-        labelWithSubscript += '[';
-        labelWithSubscript += subscript;
-        labelWithSubscript += ']';
-
-        GLSetObjectLabel(identifier, name, labelWithSubscript.c_str());
+        /* Append subscript to label; an inline buffer avoids heap allocations for typical label lengths */
+        const auto labelLen     = std::strlen(label);
+        const auto subscriptLen = std::strlen(subscript);
+
+        SmallVector<char, 128> labelWithSubscript(labelLen + subscriptLen + 3);
+
+        char* s = labelWithSubscript.data();
+        ::memcpy(s, label, labelLen);
+        s += labelLen;
+        *s++ = '[';
+        ::memcpy(s, subscript, subscriptLen);
+        s += subscriptLen;
+        *s++ = ']';
+        *s = '\0';
+
+        GLSetObjectLabel(identifier, name, labelWithSubscript.data());
     }
     else
         GLSetObjectLabel(identifier, name, nullptr);
@@ -65,8 +74,9 @@ void GLSetObjectLabelIndexed(GLenum identifier, GLuint name, const char* label,
     if (label != nullptr)
     {
         /* Append subscript to label */
-        std::string subscript = std::to_string(index);
-        GLSetObjectLabelSubscript(identifier, name, label, subscript.c_str());
+        char subscript[16];
+        ::snprintf(subscript, sizeof(subscript), "%u", index);
+        GLSetObjectLabelSubscript(identifier, name, label, subscript);
     }
     else
         GLSetObjectLabel(identifier, name, nullptr);
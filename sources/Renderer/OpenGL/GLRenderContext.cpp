@@ -6,6 +6,11 @@
  */
 
 #include "GLRenderContext.h"
+#include "GLRenderSystem.h"
+#include "Ext/GLExtensions.h"
+#include "../GLCommon/GLExtensionRegistry.h"
+#include "../CheckedCast.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -18,8 +23,9 @@ GLRenderContext::GLRenderContext(
     const std::shared_ptr<Surface>&     surface,
     GLRenderContext*                    sharedRenderContext)
 :
-    RenderContext  { desc.videoMode, desc.vsync                           },
-    contextHeight_ { static_cast<GLint>(desc.videoMode.resolution.height) }
+    RenderContext    { desc.videoMode, desc.vsync                           },
+    contextHeight_   { static_cast<GLint>(desc.videoMode.resolution.height) },
+    maxFrameLatency_ { std::min(desc.frameLatency, g_maxFrameLatency)       }
 {
     #ifdef __linux__
 
@@ -54,9 +60,40 @@ GLRenderContext::GLRenderContext(
         InitRenderStates();
 }
 
+GLRenderContext::~GLRenderContext()
+{
+    /* Always call glDeleteSync, it will silently ignore a <sync> value of zero */
+    for (auto sync : frameFences_)
+        glDeleteSync(sync);
+}
+
 void GLRenderContext::Present()
 {
     context_->SwapBuffers();
+
+    if (maxFrameLatency_ > 0 && HasExtension(GLExt::ARB_sync))
+    {
+        /* Insert fence for the frame just presented and advance the fence ring */
+        glDeleteSync(frameFences_[frameFenceIndex_]);
+        frameFences_[frameFenceIndex_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        frameFenceIndex_ = (frameFenceIndex_ + 1) % maxFrameLatency_;
+    }
+}
+
+void GLRenderContext::WaitForFrameLatency()
+{
+    /*
+    Block until the frame <maxFrameLatency_> frames ago has completed,
+    so the persistently mapped buffer regions written for that frame can be safely reused
+    */
+    if (auto sync = frameFences_[frameFenceIndex_])
+        glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, ~0ull);
+}
+
+TextureReadback* GLRenderContext::CaptureFrame(RenderSystem& renderSystem, const std::function<void(TextureReadback&)>& callback)
+{
+    auto& renderSystemGL = LLGL_CAST(GLRenderSystem&, renderSystem);
+    return renderSystemGL.CaptureFrame(*this, callback);
 }
 
 Format GLRenderContext::GetColorFormat() const
@@ -42,8 +42,14 @@ class GLRenderContext final : public RenderContext
             GLRenderContext*                    sharedRenderContext
         );
 
+        ~GLRenderContext();
+
         void Present() override;
 
+        void WaitForFrameLatency() override;
+
+        TextureReadback* CaptureFrame(RenderSystem& renderSystem, const std::function<void(TextureReadback&)>& callback = {}) override;
+
         Format GetColorFormat() const override;
         Format GetDepthStencilFormat() const override;
 
@@ -60,6 +66,12 @@ class GLRenderContext final : public RenderContext
             return stateMngr_;
         }
 
+        // Returns the GL context of this render context.
+        inline GLContext* GetGLContext() const
+        {
+            return context_.get();
+        }
+
     private:
 
         struct RenderState
@@ -86,12 +98,18 @@ class GLRenderContext final : public RenderContext
 
     private:
 
+        static const std::uint32_t g_maxFrameLatency = 3;
+
         std::unique_ptr<GLContext>      context_;
 
         std::shared_ptr<GLStateManager> stateMngr_;
         RenderState                     renderState_;
 
-        GLint                           contextHeight_  = 0;
+        GLint                           contextHeight_      = 0;
+
+        std::uint32_t                   maxFrameLatency_    = 0;
+        GLsync                          frameFences_[g_maxFrameLatency] = {};
+        std::uint32_t                   frameFenceIndex_    = 0;
 
 };
 
@@ -16,6 +16,7 @@
 #include "../GLCommon/Texture/GLTexSubImage.h"
 #include "Buffer/GLBufferWithVAO.h"
 #include "Buffer/GLBufferArrayWithVAO.h"
+#include "Buffer/GLPixelUnpackRing.h"
 #include "../CheckedCast.h"
 #include "../TextureUtils.h"
 #include "../../Core/Helper.h"
@@ -23,6 +24,7 @@
 #include "GLRenderingCaps.h"
 #include "Command/GLImmediateCommandBuffer.h"
 #include "Command/GLDeferredCommandBuffer.h"
+#include "Shader/GLProgramBinaryCache.h"
 
 
 namespace LLGL
@@ -36,25 +38,130 @@ GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
     /* Extract optional renderer configuartion */
     if (auto rendererConfigGL = GetRendererConfiguration<RendererConfigurationOpenGL>(renderSystemDesc))
         config_ = *rendererConfigGL;
+
+    /* In headless mode, create an off-screen GL context now; otherwise GL loading is deferred to the first render context */
+    if (renderSystemDesc.headless)
+        CreateHeadlessDevices();
 }
 
 GLRenderSystem::~GLRenderSystem()
 {
     /* Clear all render state containers first, the rest will be deleted automatically */
     GLMipGenerator::Get().Clear();
+    GLPixelUnpackRing::Get().Clear();
     GLStatePool::Get().Clear();
 }
 
+std::vector<VideoMemoryBudget> GLRenderSystem::QueryVideoMemoryBudgets() const
+{
+    std::vector<VideoMemoryBudget> budgets;
+
+    #ifdef GL_NVX_gpu_memory_info
+    if (HasExtension(GLExt::NVX_gpu_memory_info))
+    {
+        /* Query memory info (values are in kilobytes) */
+        GLint dedicatedVidmem = 0, totalAvailable = 0, currentAvailable = 0;
+        glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX, &dedicatedVidmem);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX, &totalAvailable);
+        glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &currentAvailable);
+
+        VideoMemoryBudget budget;
+        {
+            budget.usage        = static_cast<std::uint64_t>(std::max(totalAvailable - currentAvailable, 0)) * 1024;
+            budget.budget       = static_cast<std::uint64_t>(std::max(totalAvailable, 0)) * 1024;
+            budget.heapSize     = static_cast<std::uint64_t>(std::max(dedicatedVidmem, 0)) * 1024;
+            budget.deviceLocal  = true;
+        }
+        budgets.push_back(budget);
+    }
+    #endif // /GL_NVX_gpu_memory_info
+
+    return budgets;
+}
+
 /* ----- Render Context ----- */
 
 // private
 GLRenderContext* GLRenderSystem::GetSharedRenderContext() const
 {
-    return (!renderContexts_.empty() ? renderContexts_.begin()->get() : nullptr);
+    return (!renderContexts_.empty() ? *renderContexts_.begin() : nullptr);
+}
+
+// private
+GLContext* GLRenderSystem::GetPrimaryGLContext() const
+{
+    if (auto sharedContext = GetSharedRenderContext())
+        return sharedContext->GetGLContext();
+    return headlessContext_.get();
+}
+
+// private
+void GLRenderSystem::EnsureThreadContext()
+{
+    /* Nothing to do if the calling thread already has a current GL context (e.g. the render thread) */
+    if (GLContext::Active() != nullptr)
+        return;
+
+    if (auto primaryContext = GetPrimaryGLContext())
+    {
+        std::lock_guard<std::mutex> guard { workerContextMutex_ };
+
+        auto workerContext = MakeUnique<GLWorkerContext>();
+
+        if (headlessContext_)
+        {
+            /* Create share-group worker context without a surface */
+            workerContext->context = GLContext::CreateHeadless(config_, primaryContext);
+        }
+        else
+        {
+            /* Create hidden surface for the worker context */
+            WindowDescriptor windowDesc;
+            windowDesc.size = { 4, 4 };
+
+            workerContext->surface = Window::Create(windowDesc);
+            workerContext->context = GLContext::Create(workerContextDesc_, config_, *workerContext->surface, primaryContext);
+        }
+
+        /* Make worker context current on this loader thread with its own bind-state cache */
+        workerContext->context->MakeWorkerContext();
+        GLContext::MakeCurrent(workerContext->context.get());
+
+        workerContexts_.emplace_back(std::move(workerContext));
+    }
+}
+
+// private
+void GLRenderSystem::SyncThreadContext()
+{
+    auto context = GLContext::Active();
+    if (context != nullptr && context->IsWorkerContext())
+    {
+        /*
+        Block this loader thread (never the render thread) until the creation commands have completed,
+        so the shared objects are fully visible to all contexts of the share group once they are bound
+        */
+        #ifdef GL_ARB_sync
+        if (HasExtension(GLExt::ARB_sync))
+        {
+            auto sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, std::numeric_limits<GLuint64>::max());
+            glDeleteSync(sync);
+        }
+        else
+        #endif // /GL_ARB_sync
+        glFinish();
+    }
 }
 
 RenderContext* GLRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
 {
+    if (headlessContext_)
+        throw std::runtime_error("cannot create render context with headless OpenGL render system");
+
+    /* Keep descriptor of the first context to create compatible share-group worker contexts */
+    if (renderContexts_.empty())
+        workerContextDesc_ = desc;
     return AddRenderContext(MakeUnique<GLRenderContext>(desc, config_, surface, GetSharedRenderContext()));
 }
 
@@ -74,9 +181,10 @@ CommandQueue* GLRenderSystem::GetCommandQueue()
 
 CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
-    /* Get state manager from shared render context */
-    if (auto sharedContext = GetSharedRenderContext())
+    /* Get state manager from shared render context or the headless context */
+    if (auto primaryContext = GetPrimaryGLContext())
     {
+        std::lock_guard<std::mutex> guard { commandBufferMutex_ };
         if ((desc.flags & (CommandBufferFlags::DeferredSubmit | CommandBufferFlags::MultiSubmit)) != 0)
         {
             /* Create deferred command buffer */
@@ -90,7 +198,7 @@ CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor
             /* Create immediate command buffer */
             return TakeOwnership(
                 commandBuffers_,
-                MakeUnique<GLImmediateCommandBuffer>(sharedContext->GetStateManager())
+                MakeUnique<GLImmediateCommandBuffer>(primaryContext->GetStateManager())
             );
         }
     }
@@ -100,12 +208,13 @@ CommandBuffer* GLRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor
 
 void GLRenderSystem::Release(CommandBuffer& commandBuffer)
 {
+    std::lock_guard<std::mutex> guard { commandBufferMutex_ };
     RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
 }
 
 /* ----- Buffers ------ */
 
-static GLbitfield GetGLBufferStorageFlags(long cpuAccessFlags)
+static GLbitfield GetGLBufferStorageFlags(long cpuAccessFlags, long miscFlags)
 {
     #ifdef GL_ARB_buffer_storage
 
@@ -119,6 +228,10 @@ static GLbitfield GetGLBufferStorageFlags(long cpuAccessFlags)
     if ((cpuAccessFlags & CPUAccessFlags::Write) != 0)
         flagsGL |= GL_MAP_WRITE_BIT;
 
+    /* Persistently mapped buffers are always mapped for coherent write access */
+    if ((miscFlags & MiscFlags::PersistentMapped) != 0)
+        flagsGL |= (GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT | GL_MAP_WRITE_BIT);
+
     return flagsGL;
 
     #else
@@ -138,21 +251,36 @@ static void GLBufferStorage(GLBuffer& bufferGL, const BufferDescriptor& desc, co
     bufferGL.BufferStorage(
         static_cast<GLsizeiptr>(desc.size),
         initialData,
-        GetGLBufferStorageFlags(desc.cpuAccessFlags),
+        GetGLBufferStorageFlags(desc.cpuAccessFlags, desc.miscFlags),
         GetGLBufferUsage(desc.miscFlags)
     );
+
+    #ifdef GL_ARB_buffer_storage
+    if ((desc.miscFlags & MiscFlags::PersistentMapped) != 0)
+    {
+        /* Map entire buffer persistently and coherently, so writes become plain stores */
+        GLbitfield accessGL = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+        if ((desc.cpuAccessFlags & CPUAccessFlags::Read) != 0)
+            accessGL |= GL_MAP_READ_BIT;
+        bufferGL.MapBufferPersistent(static_cast<GLsizeiptr>(desc.size), accessGL);
+    }
+    #endif // /GL_ARB_buffer_storage
 }
 
 Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* initialData)
 {
     AssertCreateBuffer(desc, static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max()));
 
+    EnsureThreadContext();
+
     auto bufferGL = CreateGLBuffer(desc, initialData);
 
     /* Store meta data for certain types of buffers */
     if ((desc.bindFlags & BindFlags::IndexBuffer) != 0 && desc.indexFormat != Format::Undefined)
         bufferGL->SetIndexType(desc.indexFormat);
 
+    SyncThreadContext();
+
     return bufferGL;
 }
 
@@ -166,8 +294,10 @@ GLBuffer* GLRenderSystem::CreateGLBuffer(const BufferDescriptor& desc, const voi
         auto bufferGL = MakeUnique<GLBufferWithVAO>(desc.bindFlags);
         {
             GLBufferStorage(*bufferGL, desc, initialData);
-            bufferGL->BuildVertexArray(desc.vertexAttribs.size(), desc.vertexAttribs.data());
+            const auto& vertexAttribs = GetBufferVertexAttribs(desc);
+            bufferGL->BuildVertexArray(vertexAttribs.size(), vertexAttribs.data());
         }
+        std::lock_guard<std::mutex> guard { resourceMutex_ };
         return TakeOwnership(buffers_, std::move(bufferGL));
     }
     else
@@ -177,6 +307,7 @@ GLBuffer* GLRenderSystem::CreateGLBuffer(const BufferDescriptor& desc, const voi
         {
             GLBufferStorage(*bufferGL, desc, initialData);
         }
+        std::lock_guard<std::mutex> guard { resourceMutex_ };
         return TakeOwnership(buffers_, std::move(bufferGL));
     }
 }
@@ -199,18 +330,24 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     RemoveFromUniqueSet(buffers_, &buffer);
 }
 
 void GLRenderSystem::Release(BufferArray& bufferArray)
 {
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     RemoveFromUniqueSet(bufferArrays_, &bufferArray);
 }
 
 void GLRenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
 {
+    EnsureThreadContext();
+
     auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
     dstBufferGL.BufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(dataSize), data);
+
+    SyncThreadContext();
 }
 
 void* GLRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
@@ -225,6 +362,20 @@ void GLRenderSystem::UnmapBuffer(Buffer& buffer)
     bufferGL.UnmapBuffer();
 }
 
+void* GLRenderSystem::GetMappedBufferMemory(Buffer& buffer)
+{
+    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    return bufferGL.GetPersistentMappedMemory();
+}
+
+void GLRenderSystem::FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    /*
+    No explicit flush required, since persistent mappings use GL_MAP_COHERENT_BIT;
+    calling glFlushMappedBufferRange on such a mapping would even generate GL_INVALID_OPERATION
+    */
+}
+
 /* ----- Textures ----- */
 
 static GLint GetGlTextureMinFilter(const TextureDescriptor& textureDesc)
@@ -237,6 +388,8 @@ static GLint GetGlTextureMinFilter(const TextureDescriptor& textureDesc)
 
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
+    EnsureThreadContext();
+
     auto texture = MakeUnique<GLTexture>(textureDesc);
 
     /* Bind texture */
@@ -322,13 +475,16 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     if (imageDesc != nullptr && MustGenerateMipsOnCreate(textureDesc))
         GLMipGenerator::Get().GenerateMips(textureDesc.type);
 
+    SyncThreadContext();
+
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     return TakeOwnership(textures_, std::move(texture));
 }
 
-#if 0//TODO
 Texture* GLRenderSystem::CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc)
 {
     LLGL_ASSERT_FEATURE_SUPPORT(hasTextureViews);
+    EnsureThreadContext();
 
     auto& sharedTextureGL = LLGL_CAST(GLTexture&, sharedTexture);
     auto texture = MakeUnique<GLTexture>(textureViewDesc.type);
@@ -351,62 +507,216 @@ Texture* GLRenderSystem::CreateTextureView(Texture& sharedTexture, const Texture
         glTexParameteri(target, GL_TEXTURE_SWIZZLE_A, GLTypes::Map(textureViewDesc.swizzle.a));
     }
 
+    SyncThreadContext();
+
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     return TakeOwnership(textures_, std::move(texture));
 }
-#endif
 
 void GLRenderSystem::Release(Texture& texture)
 {
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     RemoveFromUniqueSet(textures_, &texture);
 }
 
 /* ----- "WriteTexture..." functions ----- */
 
+#if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+
+/*
+Updates the texture directly with DSA (GL 4.5+), so no texture binding is disturbed.
+Cube faces and array layers are both addressed through the Z dimension.
+*/
+static void GLTextureSubImageDSA(const GLTexture& textureGL, const TextureRegion& region, const SrcImageDescriptor& imageDesc)
+{
+    const auto texID        = textureGL.GetID();
+    const auto mipLevel     = static_cast<GLint>(region.subresource.baseMipLevel);
+    const auto formatGL     = GLTypes::Map(imageDesc.format);
+    const auto dataTypeGL   = GLTypes::Map(imageDesc.dataType);
+
+    switch (textureGL.GetType())
+    {
+        case TextureType::Texture1D:
+            glTextureSubImage1D(
+                texID,
+                mipLevel,
+                region.offset.x,
+                static_cast<GLsizei>(region.extent.width),
+                formatGL,
+                dataTypeGL,
+                imageDesc.data
+            );
+            break;
+
+        case TextureType::Texture1DArray:
+            glTextureSubImage2D(
+                texID,
+                mipLevel,
+                region.offset.x,
+                static_cast<GLint>(region.subresource.baseArrayLayer),
+                static_cast<GLsizei>(region.extent.width),
+                static_cast<GLsizei>(region.subresource.numArrayLayers),
+                formatGL,
+                dataTypeGL,
+                imageDesc.data
+            );
+            break;
+
+        case TextureType::Texture2D:
+            glTextureSubImage2D(
+                texID,
+                mipLevel,
+                region.offset.x,
+                region.offset.y,
+                static_cast<GLsizei>(region.extent.width),
+                static_cast<GLsizei>(region.extent.height),
+                formatGL,
+                dataTypeGL,
+                imageDesc.data
+            );
+            break;
+
+        case TextureType::Texture3D:
+            glTextureSubImage3D(
+                texID,
+                mipLevel,
+                region.offset.x,
+                region.offset.y,
+                region.offset.z,
+                static_cast<GLsizei>(region.extent.width),
+                static_cast<GLsizei>(region.extent.height),
+                static_cast<GLsizei>(region.extent.depth),
+                formatGL,
+                dataTypeGL,
+                imageDesc.data
+            );
+            break;
+
+        case TextureType::TextureCube:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCubeArray:
+            glTextureSubImage3D(
+                texID,
+                mipLevel,
+                region.offset.x,
+                region.offset.y,
+                static_cast<GLint>(region.subresource.baseArrayLayer),
+                static_cast<GLsizei>(region.extent.width),
+                static_cast<GLsizei>(region.extent.height),
+                static_cast<GLsizei>(region.subresource.numArrayLayers),
+                formatGL,
+                dataTypeGL,
+                imageDesc.data
+            );
+            break;
+
+        default:
+            break;
+    }
+}
+
+#endif // /GL_ARB_direct_state_access
+
 void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
 {
-    /* Bind texture and write texture sub data */
+    EnsureThreadContext();
+
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
+
+    /*
+    Stage image data in the pixel-unpack ring whenever possible, so the driver can
+    transfer it asynchronously; with the PBO bound, the <data> parameter is a byte offset.
+    The ring is reserved for the render thread; worker contexts upload directly from
+    client memory, since they already run in parallel to rendering.
+    */
+    auto        imageDescGL     = imageDesc;
+    GLintptr    stagingOffset   = 0;
+
+    auto activeContext = GLContext::Active();
+    const bool isWorkerThread = (activeContext != nullptr && activeContext->IsWorkerContext());
+
+    const bool useStaging =
+    (
+        !isWorkerThread &&
+        GLPixelUnpackRing::Get().StageData(imageDesc.data, imageDesc.dataSize, stagingOffset)
+    );
+    if (useStaging)
+    {
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, GLPixelUnpackRing::Get().GetBufferID());
+        imageDescGL.data = reinterpret_cast<const void*>(stagingOffset);
+    }
+
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access) && !IsCompressedFormat(imageDesc.format))
+    {
+        /* Update texture directly without disturbing the texture binding (GL 4.5+) */
+        GLTextureSubImageDSA(textureGL, textureRegion, imageDescGL);
+
+        if (useStaging)
+            GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
+
+        SyncThreadContext();
+        return;
+    }
+    #endif // /GL_ARB_direct_state_access
+
+    /* Bind texture and write data into specific texture type */
     GLStateManager::Get().BindGLTexture(textureGL);
 
-    /* Write data into specific texture type */
     switch (texture.GetType())
     {
         case TextureType::Texture1D:
-            GLTexSubImage1D(textureRegion, imageDesc);
+            GLTexSubImage1D(textureRegion, imageDescGL);
             break;
 
         case TextureType::Texture2D:
-            GLTexSubImage2D(textureRegion, imageDesc);
+            GLTexSubImage2D(textureRegion, imageDescGL);
             break;
 
         case TextureType::Texture3D:
             LLGL_ASSERT_FEATURE_SUPPORT(has3DTextures);
-            GLTexSubImage3D(textureRegion, imageDesc);
+            GLTexSubImage3D(textureRegion, imageDescGL);
             break;
 
         case TextureType::TextureCube:
             LLGL_ASSERT_FEATURE_SUPPORT(hasCubeTextures);
-            GLTexSubImageCube(textureRegion, imageDesc);
+            GLTexSubImageCube(textureRegion, imageDescGL);
             break;
 
         case TextureType::Texture1DArray:
             LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
-            GLTexSubImage1DArray(textureRegion, imageDesc);
+            GLTexSubImage1DArray(textureRegion, imageDescGL);
             break;
 
         case TextureType::Texture2DArray:
             LLGL_ASSERT_FEATURE_SUPPORT(hasArrayTextures);
-            GLTexSubImage2DArray(textureRegion, imageDesc);
+            GLTexSubImage2DArray(textureRegion, imageDescGL);
             break;
 
         case TextureType::TextureCubeArray:
             LLGL_ASSERT_FEATURE_SUPPORT(hasCubeArrayTextures);
-            GLTexSubImageCubeArray(textureRegion, imageDesc);
+            GLTexSubImageCubeArray(textureRegion, imageDescGL);
             break;
 
         default:
             break;
     }
+
+    if (useStaging)
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_UNPACK_BUFFER, 0);
+
+    SyncThreadContext();
+}
+
+void GLRenderSystem::SetTextureMinLod(Texture& texture, float minLod)
+{
+    EnsureThreadContext();
+
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+
+    /* Bind texture and update the MIP-map LOD clamp */
+    GLStateManager::Get().BindGLTexture(textureGL);
+    glTexParameterf(GLTypes::Map(textureGL.GetType()), GL_TEXTURE_MIN_LOD, minLod);
 }
 
 void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
@@ -443,18 +753,54 @@ void GLRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel,
     }
 }
 
+TextureReadback* GLRenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, const ImageFormat format, const DataType dataType)
+{
+    auto& textureGL = LLGL_CAST(const GLTexture&, texture);
+    return TakeOwnership(textureReadbacks_, MakeUnique<GLTextureReadback>(textureGL, mipLevel, format, dataType));
+}
+
+void GLRenderSystem::Release(TextureReadback& textureReadback)
+{
+    RemoveFromUniqueSet(textureReadbacks_, &textureReadback);
+}
+
+void GLRenderSystem::ProcessReadbacks()
+{
+    for (const auto& textureReadback : textureReadbacks_)
+        textureReadback->ProcessCompletedCallback();
+}
+
+TextureReadback* GLRenderSystem::CaptureFrame(GLRenderContext& renderContext, const std::function<void(TextureReadback&)>& callback)
+{
+    /* Make context current, so the copy operation reads from this context's back buffer */
+    GLRenderContext::GLMakeCurrent(&renderContext);
+
+    auto readback = MakeUnique<GLTextureReadback>(renderContext.GetVideoMode().resolution, ImageFormat::RGBA, DataType::UInt8);
+    readback->SetCompletedCallback(callback);
+
+    return TakeOwnership(textureReadbacks_, std::move(readback));
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 {
     LLGL_ASSERT_FEATURE_SUPPORT(hasSamplers);
+
+    EnsureThreadContext();
+
     auto sampler = MakeUnique<GLSampler>();
     sampler->SetDesc(desc);
+
+    SyncThreadContext();
+
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     return TakeOwnership(samplers_, std::move(sampler));
 }
 
 void GLRenderSystem::Release(Sampler& sampler)
 {
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     RemoveFromUniqueSet(samplers_, &sampler);
 }
 
@@ -470,6 +816,16 @@ void GLRenderSystem::Release(ResourceHeap& resourceHeap)
     RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
 }
 
+void GLRenderSystem::WriteResourceHeap(
+    ResourceHeap&                   resourceHeap,
+    std::uint32_t                   firstDescriptor,
+    std::uint32_t                   numResourceViews,
+    const ResourceViewDescriptor*   resourceViews)
+{
+    auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
+    resourceHeapGL.WriteResourceViews(firstDescriptor, numResourceViews, resourceViews);
+}
+
 /* ----- Render Passes ----- */
 
 RenderPass* GLRenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
@@ -516,27 +872,48 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& desc)
         case ShaderType::Compute:
             LLGL_ASSERT_FEATURE_SUPPORT(hasComputeShaders);
             break;
+        case ShaderType::Task:
+        case ShaderType::Mesh:
+            LLGL_ASSERT_FEATURE_SUPPORT(hasMeshShaders);
+            break;
         default:
             break;
     }
 
     /* Make and return shader object */
-    return TakeOwnership(shaders_, MakeUnique<GLShader>(desc));
+    EnsureThreadContext();
+
+    auto shader = MakeUnique<GLShader>(desc);
+
+    SyncThreadContext();
+
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
+    return TakeOwnership(shaders_, std::move(shader));
 }
 
 ShaderProgram* GLRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor& desc)
 {
     AssertCreateShaderProgram(desc);
-    return TakeOwnership(shaderPrograms_, MakeUnique<GLShaderProgram>(desc));
+
+    EnsureThreadContext();
+
+    auto shaderProgram = MakeUnique<GLShaderProgram>(desc);
+
+    SyncThreadContext();
+
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
+    return TakeOwnership(shaderPrograms_, std::move(shaderProgram));
 }
 
 void GLRenderSystem::Release(Shader& shader)
 {
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     RemoveFromUniqueSet(shaders_, &shader);
 }
 
 void GLRenderSystem::Release(ShaderProgram& shaderProgram)
 {
+    std::lock_guard<std::mutex> guard { resourceMutex_ };
     RemoveFromUniqueSet(shaderPrograms_, &shaderProgram);
 }
 
@@ -556,7 +933,7 @@ void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 GraphicsPipeline* GLRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
 {
-    return TakeOwnership(graphicsPipelines_, MakeUnique<GLGraphicsPipeline>(desc, GetRenderingCaps().limits));
+    return TakeOwnership(graphicsPipelines_, MakeUnique<GLGraphicsPipeline>(desc, GetRenderingLimits()));
 }
 
 ComputePipeline* GLRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
@@ -574,6 +951,18 @@ void GLRenderSystem::Release(ComputePipeline& computePipeline)
     RemoveFromUniqueSet(computePipelines_, &computePipeline);
 }
 
+std::vector<std::uint8_t> GLRenderSystem::GetPipelineCacheData() const
+{
+    return GLProgramBinaryCache::Get().Serialize();
+}
+
+bool GLRenderSystem::SetPipelineCacheData(const void* data, std::size_t dataSize)
+{
+    if (data == nullptr || dataSize == 0)
+        return false;
+    return GLProgramBinaryCache::Get().Deserialize(data, dataSize);
+}
+
 /* ----- Queries ----- */
 
 QueryHeap* GLRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& desc)
@@ -637,6 +1026,29 @@ void GLRenderSystem::CreateGLContextDependentDevices(GLRenderContext& renderCont
     commandQueue_ = MakeUnique<GLCommandQueue>(renderContext.GetStateManager());
 }
 
+void GLRenderSystem::CreateHeadlessDevices()
+{
+    /* Create off-screen GL context and make it current on the render thread */
+    headlessContext_ = GLContext::CreateHeadless(config_, nullptr);
+    GLContext::MakeCurrent(headlessContext_.get());
+
+    const bool hasGLCoreProfile = (config_.contextProfile == OpenGLContextProfile::CoreProfile);
+
+    /* Load all OpenGL extensions */
+    LoadGLExtensions(hasGLCoreProfile);
+
+    /* Enable debug callback function */
+    if (debugCallback_)
+        SetDebugCallback(debugCallback_);
+
+    /* Create command queue instance */
+    commandQueue_ = MakeUnique<GLCommandQueue>(headlessContext_->GetStateManager());
+
+    /* Use uniform clipping space */
+    GLStateManager::Get().DetermineExtensionsAndLimits();
+    GLStateManager::Get().SetClipControl(GL_UPPER_LEFT, GL_ZERO_TO_ONE);
+}
+
 void GLRenderSystem::LoadGLExtensions(bool hasGLCoreProfile)
 {
     /* Load OpenGL extensions if not already done */
@@ -711,9 +1123,11 @@ void GLRenderSystem::QueryRendererInfo()
 
 void GLRenderSystem::QueryRenderingCaps()
 {
-    RenderingCapabilities caps;
-    GLQueryRenderingCaps(caps);
-    SetRenderingCaps(caps);
+    /*
+    Defer the actual GL queries until the respective category is requested the first time;
+    notably the internal format queries can stall startup on some drivers
+    */
+    SetDeferredRenderingCaps(GLQueryRenderingFeatures, GLQueryTextureFormats, GLQueryRenderingLimits);
 }
 
 
@@ -24,6 +24,7 @@
 #include "Shader/GLShaderProgram.h"
 
 #include "Texture/GLTexture.h"
+#include "Texture/GLTextureReadback.h"
 #include "Texture/GLSampler.h"
 #include "Texture/GLRenderTarget.h"
 
@@ -39,6 +40,7 @@
 #include <memory>
 #include <vector>
 #include <set>
+#include <mutex>
 
 
 namespace LLGL
@@ -55,6 +57,8 @@ class GLRenderSystem final : public RenderSystem
         GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~GLRenderSystem();
 
+        std::vector<VideoMemoryBudget> QueryVideoMemoryBudgets() const override;
+
         /* ----- Render Context ----- */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -84,15 +88,28 @@ class GLRenderSystem final : public RenderSystem
         void* MapBuffer(Buffer& buffer, const CPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        void* GetMappedBufferMemory(Buffer& buffer) override;
+        void FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
+        Texture* CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc) override;
 
         void Release(Texture& texture) override;
 
         void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
+        void SetTextureMinLod(Texture& texture, float minLod) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
+        TextureReadback* ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, const ImageFormat format, const DataType dataType) override;
+        void Release(TextureReadback& textureReadback) override;
+
+        void ProcessReadbacks() override;
+
+        // Captures the back buffer of the specified render context asynchronously (see RenderContext::CaptureFrame).
+        TextureReadback* CaptureFrame(GLRenderContext& renderContext, const std::function<void(TextureReadback&)>& callback);
+
         /* ----- Sampler States ---- */
 
         Sampler* CreateSampler(const SamplerDescriptor& desc) override;
@@ -105,6 +122,8 @@ class GLRenderSystem final : public RenderSystem
 
         void Release(ResourceHeap& resourceHeap) override;
 
+        void WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews) override;
+
         /* ----- Render Passes ----- */
 
         RenderPass* CreateRenderPass(const RenderPassDescriptor& desc) override;
@@ -139,6 +158,9 @@ class GLRenderSystem final : public RenderSystem
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
+        std::vector<std::uint8_t> GetPipelineCacheData() const override;
+        bool SetPipelineCacheData(const void* data, std::size_t dataSize) override;
+
         /* ----- Queries ----- */
 
         QueryHeap* CreateQueryHeap(const QueryHeapDescriptor& desc) override;
@@ -158,6 +180,7 @@ class GLRenderSystem final : public RenderSystem
     private:
 
         void CreateGLContextDependentDevices(GLRenderContext& renderContext);
+        void CreateHeadlessDevices();
 
         void LoadGLExtensions(bool hasGLCoreProfile);
         void SetDebugCallback(const DebugCallback& debugCallback);
@@ -166,19 +189,29 @@ class GLRenderSystem final : public RenderSystem
         void QueryRenderingCaps();
 
         GLRenderContext* GetSharedRenderContext() const;
+        GLContext* GetPrimaryGLContext() const;
 
         GLBuffer* CreateGLBuffer(const BufferDescriptor& desc, const void* initialData);
 
+        void EnsureThreadContext();
+        void SyncThreadContext();
+
     private:
 
+        /* ----- Headless context (declared first, so it outlives all GL resources) ----- */
+
+        std::unique_ptr<GLContext>              headlessContext_;
+
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<GLRenderContext>      renderContexts_;
         HWObjectInstance<GLCommandQueue>        commandQueue_;
         HWObjectContainer<GLCommandBuffer>      commandBuffers_;
+        std::mutex                              commandBufferMutex_;
         HWObjectContainer<GLBuffer>             buffers_;
         HWObjectContainer<GLBufferArray>        bufferArrays_;
         HWObjectContainer<GLTexture>            textures_;
+        HWObjectContainer<GLTextureReadback>    textureReadbacks_;
         HWObjectContainer<GLSampler>            samplers_;
         HWObjectContainer<GLRenderPass>         renderPasses_;
         HWObjectContainer<GLRenderTarget>       renderTargets_;
@@ -194,6 +227,19 @@ class GLRenderSystem final : public RenderSystem
         RendererConfigurationOpenGL             config_;
         DebugCallback                           debugCallback_;
 
+        /* ----- Worker contexts for parallel resource creation on loader threads ----- */
+
+        struct GLWorkerContext
+        {
+            std::unique_ptr<Surface>    surface;
+            std::unique_ptr<GLContext>  context;
+        };
+
+        std::mutex                              resourceMutex_; // Guards resource containers that worker threads insert into
+        std::mutex                              workerContextMutex_;
+        std::vector<std::unique_ptr<GLWorkerContext>> workerContexts_;
+        RenderContextDescriptor                 workerContextDesc_;
+
 };
 
 
@@ -306,15 +306,30 @@ static void GLGetTextureLimits(const RenderingFeatures& features, RenderingLimit
     }
 }
 
-void GLQueryRenderingCaps(RenderingCapabilities& caps)
+void GLQueryRenderingFeatures(RenderingCapabilities& caps)
 {
     GLGetRenderingAttribs(caps);
-    GLGetSupportedTextureFormats(caps.textureFormats);
     GLGetSupportedFeatures(caps.features);
+}
+
+void GLQueryTextureFormats(RenderingCapabilities& caps)
+{
+    GLGetSupportedTextureFormats(caps.textureFormats);
+}
+
+void GLQueryRenderingLimits(RenderingCapabilities& caps)
+{
     GLGetFeatureLimits(caps.limits);
     GLGetTextureLimits(caps.features, caps.limits);
 }
 
+void GLQueryRenderingCaps(RenderingCapabilities& caps)
+{
+    GLQueryRenderingFeatures(caps);
+    GLQueryTextureFormats(caps);
+    GLQueryRenderingLimits(caps);
+}
+
 
 } // /namespace LLGL
 
@@ -16,6 +16,15 @@ namespace LLGL
 {
 
 
+// Queries the fixed OpenGL rendering attributes and supported features.
+void GLQueryRenderingFeatures(RenderingCapabilities& caps);
+
+// Queries the supported OpenGL hardware texture formats.
+void GLQueryTextureFormats(RenderingCapabilities& caps);
+
+// Queries the OpenGL feature limits; depends on the supported features (see GLQueryRenderingFeatures).
+void GLQueryRenderingLimits(RenderingCapabilities& caps);
+
 // Queries all OpenGL rendering capacilities.
 void GLQueryRenderingCaps(RenderingCapabilities& caps);
 
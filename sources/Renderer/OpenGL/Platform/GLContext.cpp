@@ -12,7 +12,8 @@ namespace LLGL
 {
 
 
-static GLContext* g_activeGLContext = nullptr;
+/* GL context currentness is a per-thread property, so each thread tracks its own active context */
+static thread_local GLContext* g_activeGLContext = nullptr;
 
 GLContext::GLContext(GLContext* sharedContext)
 {
@@ -58,6 +59,12 @@ GLContext* GLContext::Active()
     return g_activeGLContext;
 }
 
+void GLContext::MakeWorkerContext()
+{
+    stateMngr_          = std::make_shared<GLStateManager>();
+    isWorkerContext_    = true;
+}
+
 
 } // /namespace LLGL
 
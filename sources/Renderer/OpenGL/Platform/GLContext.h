@@ -35,12 +35,28 @@ class GLContext
             GLContext*                          sharedContext
         );
 
+        /*
+        Creates a platform specific GLContext instance without a surface (X11: GLX pixel buffer).
+        Throws std::runtime_error if headless contexts are not supported on this platform.
+        */
+        static std::unique_ptr<GLContext> CreateHeadless(
+            const RendererConfigurationOpenGL&  config,
+            GLContext*                          sharedContext
+        );
+
         // Makes the specified GLContext current. If null, the current context will be deactivated.
         static bool MakeCurrent(GLContext* context);
 
-        // Returns the active GLContext instance.
+        // Returns the active GLContext instance of the calling thread.
         static GLContext* Active();
 
+        /*
+        Turns this context into a worker context for a loader thread.
+        This gives the context its own state manager, since GL binding state is per context
+        and worker contexts must not share the bind-state cache with the render thread.
+        */
+        void MakeWorkerContext();
+
         // Sets the swap interval for vsync (Win32: wglSwapIntervalEXT, X11: glXSwapIntervalSGI).
         virtual bool SetSwapInterval(int interval) = 0;
 
@@ -56,6 +72,12 @@ class GLContext
             return stateMngr_;
         }
 
+        // Returns true if this is a worker context for parallel resource creation on a loader thread.
+        inline bool IsWorkerContext() const
+        {
+            return isWorkerContext_;
+        }
+
     protected:
 
         GLContext(GLContext* sharedContext);
@@ -66,6 +88,7 @@ class GLContext
     private:
 
         std::shared_ptr<GLStateManager> stateMngr_;
+        bool                            isWorkerContext_    = false;
 
 };
 
@@ -44,6 +44,14 @@ std::unique_ptr<GLContext> GLContext::Create(
     return MakeUnique<LinuxGLContext>(desc, config, surface, sharedContextGLX);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateHeadless(
+    const RendererConfigurationOpenGL&  config,
+    GLContext*                          sharedContext)
+{
+    LinuxGLContext* sharedContextGLX = (sharedContext != nullptr ? LLGL_CAST(LinuxGLContext*, sharedContext) : nullptr);
+    return MakeUnique<LinuxGLContext>(config, sharedContextGLX);
+}
+
 
 /*
  * LinuxGLContext class
@@ -62,6 +70,15 @@ LinuxGLContext::LinuxGLContext(
     CreateContext(desc, config, nativeHandle, sharedContext);
 }
 
+LinuxGLContext::LinuxGLContext(
+    const RendererConfigurationOpenGL&  config,
+    LinuxGLContext*                     sharedContext)
+:
+    GLContext { sharedContext }
+{
+    CreateHeadlessContext(config, sharedContext);
+}
+
 LinuxGLContext::~LinuxGLContext()
 {
     DeleteContext();
@@ -78,7 +95,9 @@ bool LinuxGLContext::SetSwapInterval(int interval)
 
 bool LinuxGLContext::SwapBuffers()
 {
-    glXSwapBuffers(display_, wnd_);
+    /* Headless contexts have no back buffer to present */
+    if (wnd_ != 0)
+        glXSwapBuffers(display_, wnd_);
     return true;
 }
 
@@ -95,7 +114,11 @@ void LinuxGLContext::Resize(const Extent2D& resolution)
 bool LinuxGLContext::Activate(bool activate)
 {
     if (activate)
-        return glXMakeCurrent(display_, wnd_, glc_);
+    {
+        /* Headless contexts are activated with their pixel buffer as drawable */
+        GLXDrawable drawable = (wnd_ != 0 ? static_cast<GLXDrawable>(wnd_) : static_cast<GLXDrawable>(pbuffer_));
+        return glXMakeCurrent(display_, drawable, glc_);
+    }
     else
         return glXMakeCurrent(nullptr, 0, 0);
 }
@@ -143,9 +166,94 @@ void LinuxGLContext::CreateContext(
     }
 }
 
+void LinuxGLContext::CreateHeadlessContext(
+    const RendererConfigurationOpenGL&  config,
+    LinuxGLContext*                     sharedContext)
+{
+    GLXContext glcShared = (sharedContext != nullptr ? sharedContext->glc_ : nullptr);
+
+    /* Share the X11 display connection with the shared context, or open an own connection */
+    if (sharedContext != nullptr)
+        display_ = sharedContext->display_;
+    else
+    {
+        display_        = XOpenDisplay(nullptr);
+        ownsDisplay_    = true;
+    }
+
+    if (!display_)
+        throw std::runtime_error("failed to open X11 display for headless OpenGL context");
+
+    /* Choose framebuffer configuration with pixel buffer support */
+    const int fbAttribs[] =
+    {
+        GLX_DRAWABLE_TYPE,  GLX_PBUFFER_BIT,
+        GLX_RENDER_TYPE,    GLX_RGBA_BIT,
+        GLX_RED_SIZE,       8,
+        GLX_GREEN_SIZE,     8,
+        GLX_BLUE_SIZE,      8,
+        GLX_ALPHA_SIZE,     8,
+        None
+    };
+
+    int screen = DefaultScreen(display_);
+
+    int fbCount = 0;
+    GLXFBConfig* fbcList = glXChooseFBConfig(display_, screen, fbAttribs, &fbCount);
+
+    if (fbcList == nullptr || fbCount == 0)
+        throw std::runtime_error("failed to choose GLX framebuffer configuration for headless OpenGL context");
+
+    GLXFBConfig fbConfig = fbcList[0];
+    XFree(fbcList);
+
+    /* Create small pixel buffer as drawable; all rendering goes into render targets */
+    const int pbufferAttribs[] =
+    {
+        GLX_PBUFFER_WIDTH,  4,
+        GLX_PBUFFER_HEIGHT, 4,
+        None
+    };
+    pbuffer_ = glXCreatePbuffer(display_, fbConfig, pbufferAttribs);
+
+    /* Create intermediate GL context to query the GL version for the core profile */
+    GLXContext intermediateGlc = glXCreateNewContext(display_, fbConfig, GLX_RGBA_TYPE, glcShared, True);
+
+    if (intermediateGlc == nullptr)
+        throw std::runtime_error("failed to create headless OpenGL context");
+
+    if (glXMakeCurrent(display_, pbuffer_, intermediateGlc) != True)
+        Log::PostReport(Log::ReportType::Error, "glXMakeCurrent failed on headless GLX context");
+
+    if (config.contextProfile == OpenGLContextProfile::CoreProfile)
+    {
+        /* Create core profile */
+        glc_ = CreateContextCoreProfileHeadless(fbConfig, glcShared, config.majorVersion, config.minorVersion);
+    }
+
+    if (glc_)
+    {
+        /* Make new OpenGL context current */
+        if (glXMakeCurrent(display_, pbuffer_, glc_) != True)
+            Log::PostReport(Log::ReportType::Error, "glXMakeCurrent failed on headless GLX core profile");
+
+        /* Valid core profile created, so we can delete the intermediate GLX context */
+        glXDestroyContext(display_, intermediateGlc);
+    }
+    else
+    {
+        /* No core profile created, so we use the intermediate GLX context */
+        glc_ = intermediateGlc;
+    }
+}
+
 void LinuxGLContext::DeleteContext()
 {
     glXDestroyContext(display_, glc_);
+    if (pbuffer_ != 0)
+        glXDestroyPbuffer(display_, pbuffer_);
+    if (ownsDisplay_)
+        XCloseDisplay(display_);
 }
 
 GLXContext LinuxGLContext::CreateContextCoreProfile(GLXContext glcShared, int major, int minor)
@@ -224,6 +332,51 @@ GLXContext LinuxGLContext::CreateContextCoreProfile(GLXContext glcShared, int ma
     return nullptr;
 }
 
+GLXContext LinuxGLContext::CreateContextCoreProfileHeadless(GLXFBConfig fbConfig, GLXContext glcShared, int major, int minor)
+{
+    /* Query supported GL versions */
+    if (major == 0 && minor == 0)
+    {
+        /* Query highest possible GL version from intermediate context */
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+    }
+
+    if (major < 3)
+    {
+        /* Don't try to create a core profile when GL version is below 3.0 */
+        Log::PostReport(
+            Log::ReportType::Error,
+            "cannot create OpenGL core profile with GL version " +
+            std::to_string(major) + '.' + std::to_string(minor)
+        );
+        return nullptr;
+    }
+
+    /* Load GL extension to create core profile */
+    GXLCREATECONTEXTATTRIBARBPROC glXCreateContextAttribsARB = nullptr;
+    glXCreateContextAttribsARB = (GXLCREATECONTEXTATTRIBARBPROC)glXGetProcAddressARB(reinterpret_cast<const GLubyte*>("glXCreateContextAttribsARB"));
+
+    if (glXCreateContextAttribsARB != nullptr)
+    {
+        /* Create core profile with the pixel-buffer framebuffer configuration */
+        int contextAttribs[] =
+        {
+            GLX_CONTEXT_MAJOR_VERSION_ARB, major,
+            GLX_CONTEXT_MINOR_VERSION_ARB, minor,
+            GLX_CONTEXT_PROFILE_MASK_ARB,  GLX_CONTEXT_CORE_PROFILE_BIT_ARB,
+            None
+        };
+
+        return glXCreateContextAttribsARB(display_, fbConfig, glcShared, True, contextAttribs);
+    }
+
+    /* Context creation failed */
+    Log::PostReport(Log::ReportType::Error, "failed to create headless OpenGL core profile");
+
+    return nullptr;
+}
+
 GLXContext LinuxGLContext::CreateContextCompatibilityProfile(GLXContext glcShared)
 {
     /* Create compatibility profile */
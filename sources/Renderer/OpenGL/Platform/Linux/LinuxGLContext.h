@@ -31,6 +31,13 @@ class LinuxGLContext : public GLContext
             Surface&                            surface,
             LinuxGLContext*                     sharedContext
         );
+
+        // Constructor for a headless context that renders into a GLX pixel buffer instead of a window.
+        LinuxGLContext(
+            const RendererConfigurationOpenGL&  config,
+            LinuxGLContext*                     sharedContext
+        );
+
         ~LinuxGLContext();
 
         bool SetSwapInterval(int interval) override;
@@ -47,17 +54,25 @@ class LinuxGLContext : public GLContext
             const NativeHandle&                 nativeHandle,
             LinuxGLContext*                     sharedContext
         );
+        void CreateHeadlessContext(
+            const RendererConfigurationOpenGL&  config,
+            LinuxGLContext*                     sharedContext
+        );
+
         void DeleteContext();
 
         GLXContext CreateContextCoreProfile(GLXContext glcShared, int major, int minor);
+        GLXContext CreateContextCoreProfileHeadless(GLXFBConfig fbConfig, GLXContext glcShared, int major, int minor);
         GLXContext CreateContextCompatibilityProfile(GLXContext glcShared);
 
     private:
 
-        ::Display*      display_    = nullptr;
-        ::Window        wnd_        = 0;
-        XVisualInfo*    visual_     = nullptr;
-        GLXContext      glc_        = nullptr;
+        ::Display*      display_        = nullptr;
+        ::Window        wnd_            = 0;
+        XVisualInfo*    visual_         = nullptr;
+        GLXContext      glc_            = nullptr;
+        GLXPbuffer      pbuffer_        = 0;
+        bool            ownsDisplay_    = false;
 
 };
 
@@ -27,6 +27,14 @@ std::unique_ptr<GLContext> GLContext::Create(
     return MakeUnique<MacOSGLContext>(desc, config, surface, sharedContextGLNS);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateHeadless(
+    const RendererConfigurationOpenGL&  config,
+    GLContext*                          sharedContext)
+{
+    /* NSOpenGLContext creation without a view is not implemented yet */
+    throw std::runtime_error("headless OpenGL context is not supported with NSOpenGL");
+}
+
 MacOSGLContext::MacOSGLContext(
     const RenderContextDescriptor&      desc,
     const RendererConfigurationOpenGL&  config,
@@ -33,6 +33,14 @@ std::unique_ptr<GLContext> GLContext::Create(
     return MakeUnique<Win32GLContext>(desc, config, surface, sharedContextWGL);
 }
 
+std::unique_ptr<GLContext> GLContext::CreateHeadless(
+    const RendererConfigurationOpenGL&  config,
+    GLContext*                          sharedContext)
+{
+    /* WGL always requires a device context of a window to create a GL context */
+    throw std::runtime_error("headless OpenGL context is not supported with WGL");
+}
+
 
 /*
  * Win32GLContext class
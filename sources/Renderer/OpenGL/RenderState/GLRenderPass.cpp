@@ -15,7 +15,8 @@ namespace LLGL
 
 
 GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc) :
-    numColorAttachments_ { static_cast<std::uint8_t>(desc.colorAttachments.size()) }
+    numColorAttachments_  { static_cast<std::uint8_t>(desc.colorAttachments.size()) },
+    readOnlyDepthStencil_ { desc.readOnlyDepthStencil                               }
 {
     /* Check which color attachment must be cleared */
     if (FillClearColorAttachmentIndices(clearColorAttachments_, desc) > 0)
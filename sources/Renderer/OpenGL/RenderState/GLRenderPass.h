@@ -45,11 +45,18 @@ class GLRenderPass final : public RenderPass
             return clearColorAttachments_;
         }
 
+        // Returns true if the depth-stencil attachment is bound as read-only within this render pass.
+        inline bool IsReadOnlyDepthStencil() const
+        {
+            return readOnlyDepthStencil_;
+        }
+
     private:
 
         std::uint8_t    numColorAttachments_                                    = 0;
         GLbitfield      clearMask_                                              = 0;
         std::uint8_t    clearColorAttachments_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]  = {};
+        bool            readOnlyDepthStencil_                                   = false;
 
 };
 
@@ -11,8 +11,12 @@
 #include "../Buffer/GLBuffer.h"
 #include "../Texture/GLSampler.h"
 #include "../Texture/GLTexture.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include "../../ResourceBindingIterator.h"
+#include "../../../Core/Exception.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -73,7 +77,8 @@ struct GLResourceBinding
  * GLResourceHeap class
  */
 
-GLResourceHeap::GLResourceHeap(const ResourceHeapDescriptor& desc)
+GLResourceHeap::GLResourceHeap(const ResourceHeapDescriptor& desc) :
+    desc_ { desc }
 {
     /* Get pipeline layout object */
     auto pipelineLayoutGL = LLGL_CAST(GLPipelineLayout*, desc.pipelineLayout);
@@ -85,13 +90,38 @@ GLResourceHeap::GLResourceHeap(const ResourceHeapDescriptor& desc)
     if (desc.resourceViews.size() != bindings.size())
         throw std::invalid_argument("failed to create resource heap due to mismatch between number of resources and bindings");
 
-    /* Build buffer segments */
-    ResourceBindingIterator resourceIterator { desc.resourceViews, bindings };
+    BuildAllResourceViews();
+}
 
-    BuildConstantBufferSegments(resourceIterator);
-    BuildStorageBufferSegments(resourceIterator);
-    BuildTextureSegments(resourceIterator);
-    BuildSamplerSegments(resourceIterator);
+GLResourceHeap::~GLResourceHeap()
+{
+    ReleaseBindlessHandles();
+}
+
+void GLResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews)
+{
+    /* Validate descriptor range */
+    if (firstDescriptor + numResourceViews > desc_.resourceViews.size())
+        throw std::invalid_argument("failed to update resource heap due to out-of-bounds descriptor range");
+
+    /* Patch the stored resource views */
+    for (std::uint32_t i = 0; i < numResourceViews; ++i)
+        desc_.resourceViews[firstDescriptor + i] = resourceViews[i];
+
+    /*
+    The internal buffer is a tightly packed emulation of a descriptor set (see illustration above),
+    so an in-place update is performed by rebuilding its segments from the patched resource views
+    */
+    ReleaseBindlessHandles();
+    bindlessBufferID_   = 0;
+    bindlessBufferSlot_ = 0;
+    bindlessHandles_.clear();
+
+    segmentationHeader_ = {};
+    buffer_.clear();
+    dynamicBindings_.clear();
+
+    BuildAllResourceViews();
 }
 
 static void BindBuffersBaseSegment(GLStateManager& stateMngr, std::int8_t*& byteAlignedBuffer, const GLBufferTarget bufferTarget)
@@ -136,6 +166,11 @@ static void BindSamplersSegment(GLStateManager& stateMngr, std::int8_t*& byteAli
 }
 
 void GLResourceHeap::Bind(GLStateManager& stateMngr)
+{
+    BindWithDynamicOffsets(stateMngr, 0, nullptr);
+}
+
+void GLResourceHeap::BindWithDynamicOffsets(GLStateManager& stateMngr, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets)
 {
     auto byteAlignedBuffer = buffer_.data();
 
@@ -154,6 +189,24 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr)
     /* Bind all samplers */
     for (std::uint8_t i = 0; i < segmentationHeader_.numSamplerSegments; ++i)
         BindSamplersSegment(stateMngr, byteAlignedBuffer);
+
+    /* Bind buffer of bindless texture handles */
+    if (bindlessBufferID_ != 0)
+        stateMngr.BindBufferBase(GLBufferTarget::SHADER_STORAGE_BUFFER, bindlessBufferSlot_, bindlessBufferID_);
+
+    /* Bind all buffers with dynamic offsets */
+    for (std::size_t i = 0; i < dynamicBindings_.size(); ++i)
+    {
+        const auto& binding = dynamicBindings_[i];
+        const auto  offset  = static_cast<GLintptr>(i < numDynamicOffsets ? dynamicOffsets[i] : 0);
+        stateMngr.BindBufferRange(
+            binding.target,
+            binding.slot,
+            binding.bufferID,
+            offset,
+            binding.bufferSize - offset
+        );
+    }
 }
 
 
@@ -161,6 +214,56 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr)
  * ======= Private: =======
  */
 
+void GLResourceHeap::BuildAllResourceViews()
+{
+    auto pipelineLayoutGL = LLGL_CAST(GLPipelineLayout*, desc_.pipelineLayout);
+    const auto& bindings = pipelineLayoutGL->GetBindings();
+
+    /* Build buffer segments */
+    ResourceBindingIterator resourceIterator { desc_.resourceViews, bindings };
+
+    /* Collect all buffer bindings with dynamic offsets; they are bound individually with glBindBufferRange */
+    CollectDynamicBindings(resourceIterator, BindFlags::ConstantBuffer, GLBufferTarget::UNIFORM_BUFFER);
+    CollectDynamicBindings(resourceIterator, (BindFlags::Sampled | BindFlags::Storage), GLBufferTarget::SHADER_STORAGE_BUFFER);
+
+    /* Sort dynamic bindings by slot to match the offset order of Vulkan descriptor sets */
+    std::sort(
+        dynamicBindings_.begin(), dynamicBindings_.end(),
+        [](const DynamicBinding& lhs, const DynamicBinding& rhs)
+        {
+            return (lhs.slot < rhs.slot);
+        }
+    );
+
+    BuildConstantBufferSegments(resourceIterator);
+    BuildStorageBufferSegments(resourceIterator);
+
+    if ((desc_.flags & ResourceHeapFlags::BindlessTextures) != 0)
+    {
+        /* Replace texture binding segments by a single buffer of resident bindless handles */
+        if (!HasExtension(GLExt::ARB_bindless_texture))
+            ThrowNotSupportedExcept(__FUNCTION__, "OpenGL extension 'GL_ARB_bindless_texture'");
+        BuildBindlessTextureHandles(resourceIterator);
+    }
+    else
+    {
+        BuildTextureSegments(resourceIterator);
+        BuildSamplerSegments(resourceIterator);
+    }
+}
+
+void GLResourceHeap::ReleaseBindlessHandles()
+{
+    if (bindlessBufferID_ != 0)
+    {
+        /* Make all texture handles non-resident and release handle buffer */
+        for (auto handle : bindlessHandles_)
+            glMakeTextureHandleNonResidentARB(handle);
+        glDeleteBuffers(1, &bindlessBufferID_);
+        GLStateManager::Get().NotifyBufferRelease(bindlessBufferID_, GLBufferTarget::SHADER_STORAGE_BUFFER);
+    }
+}
+
 using GLResourceBindingFunc = std::function<GLResourceBinding(Resource* resource, std::uint32_t slot)>;
 
 static std::vector<GLResourceBinding> CollectGLResourceBindings(
@@ -177,7 +280,11 @@ static std::vector<GLResourceBinding> CollectGLResourceBindings(
     resourceBindings.reserve(resourceIterator.GetCount());
 
     while (auto resource = resourceIterator.Next(bindingDesc))
-        resourceBindings.push_back(bindingFunc(resource, bindingDesc.slot));
+    {
+        /* Bindings with dynamic offsets are bound individually (see GLResourceHeap::CollectDynamicBindings) */
+        if (!bindingDesc.dynamicOffset)
+            resourceBindings.push_back(bindingFunc(resource, bindingDesc.slot));
+    }
 
     /* Sort resources by slot index */
     std::sort(
@@ -191,6 +298,28 @@ static std::vector<GLResourceBinding> CollectGLResourceBindings(
     return resourceBindings;
 }
 
+void GLResourceHeap::CollectDynamicBindings(ResourceBindingIterator& resourceIterator, long bindFlags, const GLBufferTarget bufferTarget)
+{
+    BindingDescriptor bindingDesc;
+    resourceIterator.Reset(ResourceType::Buffer, bindFlags);
+
+    while (auto resource = resourceIterator.Next(bindingDesc))
+    {
+        if (bindingDesc.dynamicOffset)
+        {
+            auto bufferGL = LLGL_CAST(GLBuffer*, resource);
+
+            /* Query buffer size once to clamp the bound range at bind time */
+            GLint bufferSize = 0;
+            bufferGL->GetBufferParams(&bufferSize, nullptr, nullptr);
+
+            dynamicBindings_.push_back(
+                { bufferTarget, bindingDesc.slot, bufferGL->GetID(), static_cast<GLsizeiptr>(bufferSize) }
+            );
+        }
+    }
+}
+
 void GLResourceHeap::BuildBufferSegments(ResourceBindingIterator& resourceIterator, long bindFlags, std::uint8_t& numSegments)
 {
     /* Collect all buffers */
@@ -275,6 +404,42 @@ void GLResourceHeap::BuildSamplerSegments(ResourceBindingIterator& resourceItera
     );
 }
 
+void GLResourceHeap::BuildBindlessTextureHandles(ResourceBindingIterator& resourceIterator)
+{
+    /* Collect all textures in binding order */
+    BindingDescriptor bindingDesc;
+    resourceIterator.Reset(ResourceType::Texture, 0);
+
+    bindlessBufferSlot_ = ~0u;
+
+    while (auto resource = resourceIterator.Next(bindingDesc))
+    {
+        auto textureGL = LLGL_CAST(GLTexture*, resource);
+
+        /* Query texture handle and make it resident; the texture's sampler state is baked into the handle */
+        auto handle = glGetTextureHandleARB(textureGL->GetID());
+        glMakeTextureHandleResidentARB(handle);
+        bindlessHandles_.push_back(handle);
+
+        /* Use the lowest texture binding slot for the handle buffer */
+        bindlessBufferSlot_ = std::min(bindlessBufferSlot_, static_cast<GLuint>(bindingDesc.slot));
+    }
+
+    if (!bindlessHandles_.empty())
+    {
+        /* Create shader storage buffer that holds all texture handles */
+        glGenBuffers(1, &bindlessBufferID_);
+        GLStateManager::Get().BindBuffer(GLBufferTarget::SHADER_STORAGE_BUFFER, bindlessBufferID_);
+        glBufferData(
+            GL_SHADER_STORAGE_BUFFER,
+            static_cast<GLsizeiptr>(bindlessHandles_.size() * sizeof(GLuint64)),
+            bindlessHandles_.data(),
+            GL_STATIC_DRAW
+        );
+        GLStateManager::Get().BindBuffer(GLBufferTarget::SHADER_STORAGE_BUFFER, 0);
+    }
+}
+
 void GLResourceHeap::BuildAllSegments(
     const std::vector<GLResourceBinding>&   resourceBindings,
     const BuildSegmentFunc&                 buildSegmentFunc,
@@ -10,7 +10,9 @@
 
 
 #include <LLGL/ResourceHeap.h>
+#include <LLGL/ResourceHeapFlags.h>
 #include <LLGL/ResourceFlags.h>
+#include "GLState.h"
 #include "../OpenGL.h"
 #include <vector>
 #include <functional>
@@ -34,20 +36,32 @@ class GLResourceHeap final : public ResourceHeap
     public:
 
         GLResourceHeap(const ResourceHeapDescriptor& desc);
+        ~GLResourceHeap();
+
+        // Updates the specified range of resource views in place by rebuilding the internal buffer segments.
+        void WriteResourceViews(std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews);
 
         // Binds this resource heap with the specified GL state manager.
         void Bind(GLStateManager& stateMngr);
 
+        // Binds this resource heap with the specified dynamic buffer offsets (see BindingDescriptor::dynamicOffset).
+        void BindWithDynamicOffsets(GLStateManager& stateMngr, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets);
+
     private:
 
         using GLResourceBindingIter = std::vector<GLResourceBinding>::const_iterator;
         using BuildSegmentFunc = std::function<void(GLResourceBindingIter begin, GLsizei count)>;
 
+        void BuildAllResourceViews();
+        void ReleaseBindlessHandles();
+
+        void CollectDynamicBindings(ResourceBindingIterator& resourceIterator, long bindFlags, const GLBufferTarget bufferTarget);
         void BuildBufferSegments(ResourceBindingIterator& resourceIterator, long bindFlags, std::uint8_t& numSegments);
         void BuildConstantBufferSegments(ResourceBindingIterator& resourceIterator);
         void BuildStorageBufferSegments(ResourceBindingIterator& resourceIterator);
         void BuildTextureSegments(ResourceBindingIterator& resourceIterator);
         void BuildSamplerSegments(ResourceBindingIterator& resourceIterator);
+        void BuildBindlessTextureHandles(ResourceBindingIterator& resourceIterator);
 
         void BuildAllSegments(
             const std::vector<GLResourceBinding>&   resourceBindings,
@@ -60,6 +74,15 @@ class GLResourceHeap final : public ResourceHeap
 
     private:
 
+        // Binding of a buffer sub-range whose offset is specified at bind time (see BindingDescriptor::dynamicOffset).
+        struct DynamicBinding
+        {
+            GLBufferTarget  target;
+            GLuint          slot;
+            GLuint          bufferID;
+            GLsizeiptr      bufferSize;
+        };
+
         // Header structure to describe all segments within the raw buffer.
         struct SegmentationHeader
         {
@@ -71,8 +94,15 @@ class GLResourceHeap final : public ResourceHeap
 
     private:
 
+        ResourceHeapDescriptor      desc_;                  // Copy of the descriptor; kept to rebuild segments for in-place updates
         SegmentationHeader          segmentationHeader_;
         std::vector<std::int8_t>    buffer_;
+        std::vector<DynamicBinding> dynamicBindings_;
+
+        /* Bindless texture mode (GL_ARB_bindless_texture) */
+        GLuint                      bindlessBufferID_   = 0;
+        GLuint                      bindlessBufferSlot_ = 0;
+        std::vector<GLuint64>       bindlessHandles_;
 
 };
 
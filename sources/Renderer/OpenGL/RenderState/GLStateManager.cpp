@@ -19,6 +19,7 @@
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/Helper.h"
 #include "../../../Core/Assertion.h"
+#include <LLGL/Instrumentation.h>
 #include <functional>
 
 
@@ -141,7 +142,7 @@ static void InvalidateBoundGLObject(GLuint& boundId, const GLuint releasedObject
 
 static std::vector<GLStateManager*> g_GLStateManagerList;
 
-GLStateManager*             GLStateManager::active_;
+thread_local GLStateManager* GLStateManager::active_;
 GLStateManager::GLLimits    GLStateManager::commonLimits_;
 
 GLStateManager::GLStateManager()
@@ -636,6 +637,7 @@ void GLStateManager::BindBuffer(GLBufferTarget target, GLuint buffer)
     auto targetIdx = static_cast<std::size_t>(target);
     if (bufferState_.boundBuffers[targetIdx] != buffer)
     {
+        LLGL_INSTRUMENT_EVENT(StateCacheMiss, "GLStateManager::BindBuffer", buffer);
         glBindBuffer(g_bufferTargetsEnum[targetIdx], buffer);
         bufferState_.boundBuffers[targetIdx] = buffer;
     }
@@ -649,6 +651,14 @@ void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint
     bufferState_.boundBuffers[targetIdx] = buffer;
 }
 
+void GLStateManager::BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    /* Always bind buffer with a base index and the specified sub-range */
+    auto targetIdx = static_cast<std::size_t>(target);
+    glBindBufferRange(g_bufferTargetsEnum[targetIdx], index, buffer, offset, size);
+    bufferState_.boundBuffers[targetIdx] = buffer;
+}
+
 void GLStateManager::BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers)
 {
     /* Always bind buffers with a base index */
@@ -922,6 +932,7 @@ void GLStateManager::BindTexture(GLTextureTarget target, GLuint texture)
     auto targetIdx = static_cast<std::size_t>(target);
     if (textureState_.activeLayerRef->boundTextures[targetIdx] != texture)
     {
+        LLGL_INSTRUMENT_EVENT(StateCacheMiss, "GLStateManager::BindTexture", texture);
         textureState_.activeLayerRef->boundTextures[targetIdx] = texture;
         glBindTexture(g_textureTargetsEnum[targetIdx], texture);
     }
@@ -932,19 +943,37 @@ void GLStateManager::BindTextures(GLuint first, GLsizei count, const GLTextureTa
     #ifdef GL_ARB_multi_bind
     if (HasExtension(GLExt::ARB_multi_bind))
     {
-        /* Store bound textures */
-        for (GLsizei i = 0; i < count; ++i)
+        /* Reduce range to the subrange of texture layers whose bindings differ from the cache */
+        GLsizei changedBegin = 0, changedEnd = count;
+
+        while (changedBegin < count &&
+            textureState_.layers[first + changedBegin].boundTextures[static_cast<std::size_t>(targets[changedBegin])] == textures[changedBegin])
         {
-            auto targetIdx = static_cast<std::size_t>(targets[i]);
-            textureState_.layers[i + first].boundTextures[targetIdx] = textures[i];
+            ++changedBegin;
         }
 
-        /*
-        Bind all textures at once, but don't reset the currently active texture layer.
-        The spec. of GL_ARB_multi_bind states that the active texture slot is not modified by this function.
-        see https://www.khronos.org/registry/OpenGL/extensions/ARB/ARB_multi_bind.txt
-        */
-        glBindTextures(first, count, textures);
+        while (changedEnd > changedBegin &&
+            textureState_.layers[first + changedEnd - 1].boundTextures[static_cast<std::size_t>(targets[changedEnd - 1])] == textures[changedEnd - 1])
+        {
+            --changedEnd;
+        }
+
+        if (changedBegin < changedEnd)
+        {
+            /* Store bound textures */
+            for (GLsizei i = changedBegin; i < changedEnd; ++i)
+            {
+                auto targetIdx = static_cast<std::size_t>(targets[i]);
+                textureState_.layers[i + first].boundTextures[targetIdx] = textures[i];
+            }
+
+            /*
+            Bind all changed textures at once, but don't reset the currently active texture layer.
+            The spec. of GL_ARB_multi_bind states that the active texture slot is not modified by this function.
+            see https://www.khronos.org/registry/OpenGL/extensions/ARB/ARB_multi_bind.txt
+            */
+            glBindTextures(first + changedBegin, changedEnd - changedBegin, textures + changedBegin);
+        }
     }
     else
     #endif
@@ -966,19 +995,40 @@ void GLStateManager::UnbindTextures(GLuint first, GLsizei count)
     #ifdef GL_ARB_multi_bind
     if (HasExtension(GLExt::ARB_multi_bind))
     {
-        /* Reset bound textures */
-        for (GLsizei i = 0; i < count; ++i)
+        /* Reduce range to the subrange of texture layers that still have any binding */
+        GLsizei changedBegin = 0, changedEnd = count;
+
+        auto IsLayerUnbound = [this, first](GLsizei i) -> bool
         {
-            auto& boundTextures = textureState_.layers[i].boundTextures;
-            std::fill(std::begin(boundTextures), std::end(boundTextures), 0);
-        }
+            const auto& boundTextures = textureState_.layers[first + i].boundTextures;
+            return std::all_of(
+                std::begin(boundTextures), std::end(boundTextures),
+                [](GLuint texture) { return (texture == 0); }
+            );
+        };
 
-        /*
-        Bind all textures at once, but don't reset the currently active texture layer.
-        The spec. of GL_ARB_multi_bind states that the active texture slot is not modified by this function.
-        see https://www.khronos.org/registry/OpenGL/extensions/ARB/ARB_multi_bind.txt
-        */
-        glBindTextures(first, count, nullptr);
+        while (changedBegin < count && IsLayerUnbound(changedBegin))
+            ++changedBegin;
+
+        while (changedEnd > changedBegin && IsLayerUnbound(changedEnd - 1))
+            --changedEnd;
+
+        if (changedBegin < changedEnd)
+        {
+            /* Reset bound textures */
+            for (GLsizei i = changedBegin; i < changedEnd; ++i)
+            {
+                auto& boundTextures = textureState_.layers[i + first].boundTextures;
+                std::fill(std::begin(boundTextures), std::end(boundTextures), 0);
+            }
+
+            /*
+            Bind all textures at once, but don't reset the currently active texture layer.
+            The spec. of GL_ARB_multi_bind states that the active texture slot is not modified by this function.
+            see https://www.khronos.org/registry/OpenGL/extensions/ARB/ARB_multi_bind.txt
+            */
+            glBindTextures(first + changedBegin, changedEnd - changedBegin, nullptr);
+        }
     }
     else
     #endif
@@ -1056,12 +1106,24 @@ void GLStateManager::BindSamplers(GLuint first, GLsizei count, const GLuint* sam
     #ifdef GL_ARB_multi_bind
     if (count >= 2 && HasExtension(GLExt::ARB_multi_bind))
     {
-        /* Store bound samplers */
-        for (GLsizei i = 0; i < count; ++i)
-            samplerState_.boundSamplers[i + first] = samplers[i];
+        /* Reduce range to the subrange of sampler slots whose bindings differ from the cache */
+        GLsizei changedBegin = 0, changedEnd = count;
 
-        /* Bind all samplers at once */
-        glBindSamplers(first, count, samplers);
+        while (changedBegin < count && samplerState_.boundSamplers[first + changedBegin] == samplers[changedBegin])
+            ++changedBegin;
+
+        while (changedEnd > changedBegin && samplerState_.boundSamplers[first + changedEnd - 1] == samplers[changedEnd - 1])
+            --changedEnd;
+
+        if (changedBegin < changedEnd)
+        {
+            /* Store bound samplers */
+            for (GLsizei i = changedBegin; i < changedEnd; ++i)
+                samplerState_.boundSamplers[i + first] = samplers[i];
+
+            /* Bind all changed samplers at once */
+            glBindSamplers(first + changedBegin, changedEnd - changedBegin, samplers + changedBegin);
+        }
     }
     else
     #endif
@@ -1104,6 +1166,65 @@ GLuint GLStateManager::GetBoundShaderProgram() const
     return shaderState_.boundProgram;
 }
 
+/* ----- State snapshot ----- */
+
+void GLStateManager::CaptureBindingSnapshot(GLBindingSnapshot& snapshot) const
+{
+    snapshot.boundProgram               = shaderState_.boundProgram;
+    snapshot.boundVertexArray           = vertexArrayState_.boundVertexArray;
+    snapshot.boundElementArrayBuffer    = vertexArrayState_.boundElementArrayBuffer;
+    snapshot.boundRenderbuffer          = renderbufferState_.boundRenderbuffer;
+    snapshot.activeTexture              = textureState_.activeTexture;
+    snapshot.boundBuffers               = bufferState_.boundBuffers;
+    snapshot.boundFramebuffers          = framebufferState_.boundFramebuffers;
+    snapshot.boundSamplers              = samplerState_.boundSamplers;
+    snapshot.textureLayers              = textureState_.layers;
+}
+
+void GLStateManager::RestoreBindingSnapshot(const GLBindingSnapshot& snapshot)
+{
+    /* Re-bind shader program and vertex array state; the cached binding functions skip matching states */
+    BindShaderProgram(snapshot.boundProgram);
+    BindVertexArray(snapshot.boundVertexArray);
+    BindElementArrayBufferToVAO(snapshot.boundElementArrayBuffer);
+    BindRenderbuffer(snapshot.boundRenderbuffer);
+
+    /* Re-bind only those buffers and framebuffers that diverged since the capture */
+    for (std::uint32_t i = 0; i < numBufferTargets; ++i)
+    {
+        if (bufferState_.boundBuffers[i] != snapshot.boundBuffers[i])
+            BindBuffer(static_cast<GLBufferTarget>(i), snapshot.boundBuffers[i]);
+    }
+
+    for (std::uint32_t i = 0; i < numFramebufferTargets; ++i)
+    {
+        if (framebufferState_.boundFramebuffers[i] != snapshot.boundFramebuffers[i])
+            BindFramebuffer(static_cast<GLFramebufferTarget>(i), snapshot.boundFramebuffers[i]);
+    }
+
+    /* Re-bind only those textures and samplers that diverged since the capture */
+    for (std::uint32_t layer = 0; layer < numTextureLayers; ++layer)
+    {
+        const auto& boundTextures       = textureState_.layers[layer].boundTextures;
+        const auto& snapshotTextures    = snapshot.textureLayers[layer].boundTextures;
+
+        for (std::uint32_t target = 0; target < numTextureTargets; ++target)
+        {
+            if (boundTextures[target] != snapshotTextures[target])
+            {
+                ActiveTexture(layer);
+                BindTexture(static_cast<GLTextureTarget>(target), snapshotTextures[target]);
+            }
+        }
+
+        if (samplerState_.boundSamplers[layer] != snapshot.boundSamplers[layer])
+            BindSampler(layer, snapshot.boundSamplers[layer]);
+    }
+
+    /* Restore active texture layer last, since re-binding textures may have changed it */
+    ActiveTexture(snapshot.activeTexture);
+}
+
 /* ----- Render pass ----- */
 
 void GLStateManager::BindRenderPass(
@@ -1123,6 +1244,19 @@ void GLStateManager::BindRenderPass(
     if (renderPass)
     {
         auto renderPassGL = LLGL_CAST(const GLRenderPass*, renderPass);
+
+        /*
+        For read-only depth-stencil, flush texture fetches of the attached depth buffer,
+        so it can be sampled as a texture while the depth test reads from it within this render pass
+        */
+        if (renderPassGL->IsReadOnlyDepthStencil())
+        {
+            #ifdef GL_ARB_texture_barrier
+            if (HasExtension(GLExt::ARB_texture_barrier))
+                glTextureBarrier();
+            #endif
+        }
+
         ClearAttachmentsWithRenderPass(*renderPassGL, numClearValues, clearValues, defaultClearValue);
     }
 }
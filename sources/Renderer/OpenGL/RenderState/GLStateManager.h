@@ -153,6 +153,7 @@ class GLStateManager
 
         void BindBuffer(GLBufferTarget target, GLuint buffer);
         void BindBufferBase(GLBufferTarget target, GLuint index, GLuint buffer);
+        void BindBufferRange(GLBufferTarget target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
         void BindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count, const GLuint* buffers);
         void UnbindBuffersBase(GLBufferTarget target, GLuint first, GLsizei count);
 
@@ -433,11 +434,39 @@ class GLStateManager
             std::array<GLuint, numTextureLayers> boundSamplers;
         };
 
+    public:
+
+        /* ----- State snapshot ----- */
+
+        // Compact snapshot of the binding caches; plain data block without dynamic allocations (see CaptureBindingSnapshot)
+        struct GLBindingSnapshot
+        {
+            GLuint                                          boundProgram;
+            GLuint                                          boundVertexArray;
+            GLuint                                          boundElementArrayBuffer;
+            GLuint                                          boundRenderbuffer;
+            std::uint32_t                                   activeTexture;
+            std::array<GLuint, numBufferTargets>            boundBuffers;
+            std::array<GLuint, numFramebufferTargets>       boundFramebuffers;
+            std::array<GLuint, numTextureLayers>            boundSamplers;
+            std::array<GLTextureLayer, numTextureLayers>    textureLayers;
+        };
+
+        // Captures the current binding caches into the specified snapshot.
+        void CaptureBindingSnapshot(GLBindingSnapshot& snapshot) const;
+
+        /*
+        Restores the bindings of the specified snapshot.
+        Only bindings that diverged since the capture are re-bound, i.e. this is a no-op if the snapshot still matches the caches.
+        */
+        void RestoreBindingSnapshot(const GLBindingSnapshot& snapshot);
+
     private:
 
         friend class GLContext;
 
-        static GLStateManager*          active_;
+        // Active state manager of the calling thread (GL context currentness is a per-thread property)
+        static thread_local GLStateManager* active_;
         static GLLimits                 commonLimits_;          // Common denominator of limitations for all GL contexts
 
         GLLimits                        limits_;                // Limitations of this GL context
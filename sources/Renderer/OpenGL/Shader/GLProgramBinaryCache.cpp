@@ -0,0 +1,310 @@
+/*
+ * GLProgramBinaryCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLProgramBinaryCache.h"
+#include "GLShader.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include "../../CheckedCast.h"
+#include <LLGL/ShaderProgramFlags.h>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal functions ----- */
+
+/*
+64-bit FNV-1a hash; used to key the cache entries by shader sources and driver version
+instead of storing the sources themselves.
+*/
+static std::uint64_t HashBytesFNV1a(const void* data, std::size_t size, std::uint64_t hash)
+{
+    auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+static std::uint64_t HashGLString(GLenum name, std::uint64_t hash)
+{
+    if (auto s = reinterpret_cast<const char*>(glGetString(name)))
+        hash = HashBytesFNV1a(s, std::strlen(s), hash);
+    return hash;
+}
+
+static std::uint64_t HashShaderSource(GLuint shader, std::uint64_t hash)
+{
+    /* Query shader source from GL, since the GLShader object does not retain it */
+    GLint sourceLength = 0;
+    glGetShaderiv(shader, GL_SHADER_SOURCE_LENGTH, &sourceLength);
+
+    if (sourceLength > 0)
+    {
+        std::vector<char> source(static_cast<std::size_t>(sourceLength), '\0');
+        GLsizei charsWritten = 0;
+        glGetShaderSource(shader, sourceLength, &charsWritten, source.data());
+        hash = HashBytesFNV1a(source.data(), static_cast<std::size_t>(charsWritten), hash);
+    }
+
+    return hash;
+}
+
+static std::uint64_t HashAttachedShader(Shader* shader, std::uint64_t hash)
+{
+    if (shader != nullptr)
+    {
+        auto shaderGL = LLGL_CAST(GLShader*, shader);
+
+        /* Hash shader type and source */
+        const auto type = shaderGL->GetType();
+        hash = HashBytesFNV1a(&type, sizeof(type), hash);
+        hash = HashShaderSource(shaderGL->GetID(), hash);
+    }
+    return hash;
+}
+
+static std::uint64_t HashShaderAttribs(std::size_t numAttribs, const GLShaderAttribute* attribs, std::uint64_t hash)
+{
+    for (std::size_t i = 0; i < numAttribs; ++i)
+    {
+        hash = HashBytesFNV1a(&(attribs[i].index), sizeof(attribs[i].index), hash);
+        hash = HashBytesFNV1a(attribs[i].name, std::strlen(attribs[i].name), hash);
+    }
+    return hash;
+}
+
+
+/* ----- GLProgramBinaryCache class ----- */
+
+GLProgramBinaryCache& GLProgramBinaryCache::Get()
+{
+    static GLProgramBinaryCache instance;
+    return instance;
+}
+
+bool GLProgramBinaryCache::IsSupported()
+{
+    #ifdef GL_ARB_get_program_binary
+    if (HasExtension(GLExt::ARB_get_program_binary))
+    {
+        /* Drivers may support the extension but expose no binary formats */
+        GLint numFormats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+        return (numFormats > 0);
+    }
+    #endif // /GL_ARB_get_program_binary
+    return false;
+}
+
+std::uint64_t GLProgramBinaryCache::ComputeProgramKey(const ShaderProgramDescriptor& desc)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+
+    /* Hash driver version strings, so that entries from a different driver never match */
+    hash = HashGLString(GL_VENDOR, hash);
+    hash = HashGLString(GL_RENDERER, hash);
+    hash = HashGLString(GL_VERSION, hash);
+
+    /* Hash type and source of all attached shaders */
+    hash = HashAttachedShader(desc.vertexShader, hash);
+    hash = HashAttachedShader(desc.tessControlShader, hash);
+    hash = HashAttachedShader(desc.tessEvaluationShader, hash);
+    hash = HashAttachedShader(desc.geometryShader, hash);
+    hash = HashAttachedShader(desc.fragmentShader, hash);
+    hash = HashAttachedShader(desc.computeShader, hash);
+
+    /* Hash attribute locations and varyings, since they are baked into the linked binary */
+    if (auto vs = desc.vertexShader)
+    {
+        auto vsGL = LLGL_CAST(GLShader*, vs);
+        hash = HashShaderAttribs(vsGL->GetNumVertexAttribs(), vsGL->GetVertexAttribs(), hash);
+        for (auto varying : vsGL->GetTransformFeedbackVaryings())
+            hash = HashBytesFNV1a(varying, std::strlen(varying), hash);
+    }
+
+    if (auto fs = desc.fragmentShader)
+    {
+        auto fsGL = LLGL_CAST(GLShader*, fs);
+        hash = HashShaderAttribs(fsGL->GetNumFragmentAttribs(), fsGL->GetFragmentAttribs(), hash);
+    }
+
+    if (auto gs = desc.geometryShader)
+    {
+        auto gsGL = LLGL_CAST(GLShader*, gs);
+        for (auto varying : gsGL->GetTransformFeedbackVaryings())
+            hash = HashBytesFNV1a(varying, std::strlen(varying), hash);
+    }
+
+    return hash;
+}
+
+bool GLProgramBinaryCache::LoadBinary(GLuint program, std::uint64_t key)
+{
+    #ifdef GL_ARB_get_program_binary
+
+    std::lock_guard<std::mutex> guard { entriesMutex_ };
+
+    auto it = entries_.find(key);
+    if (it == entries_.end())
+        return false;
+
+    const auto& entry = it->second;
+    glProgramBinary(program, entry.binaryFormat, entry.binaryData.data(), static_cast<GLsizei>(entry.binaryData.size()));
+
+    /* Check if the driver accepted the binary; on failure (e.g. after a driver update) fall back to linking from source */
+    GLint status = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+        entries_.erase(it);
+        return false;
+    }
+
+    return true;
+
+    #else
+
+    return false;
+
+    #endif // /GL_ARB_get_program_binary
+}
+
+void GLProgramBinaryCache::StoreBinary(GLuint program, std::uint64_t key)
+{
+    #ifdef GL_ARB_get_program_binary
+
+    /* Query length of program binary */
+    GLint binaryLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0)
+        return;
+
+    /* Query binary format and data, then store cache entry */
+    Entry entry;
+    entry.binaryData.resize(static_cast<std::size_t>(binaryLength));
+
+    GLsizei bytesWritten = 0;
+    glGetProgramBinary(program, binaryLength, &bytesWritten, &(entry.binaryFormat), entry.binaryData.data());
+
+    if (bytesWritten > 0)
+    {
+        entry.binaryData.resize(static_cast<std::size_t>(bytesWritten));
+        std::lock_guard<std::mutex> guard { entriesMutex_ };
+        entries_[key] = std::move(entry);
+    }
+
+    #endif // /GL_ARB_get_program_binary
+}
+
+/*
+Serialized cache blob format:
+  uint32          magic ('GLPB')
+  uint32          number of entries
+  for each entry:
+    uint64        key
+    uint32        binary format
+    uint32        binary length
+    uint8[...]    binary data
+*/
+static const std::uint32_t g_programBinaryCacheMagic = 0x474C5042; // 'GLPB'
+
+template <typename T>
+static void WritePOD(std::vector<std::uint8_t>& blob, const T& value)
+{
+    auto bytes = reinterpret_cast<const std::uint8_t*>(&value);
+    blob.insert(blob.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+static bool ReadPOD(const std::uint8_t*& data, std::size_t& remaining, T& value)
+{
+    if (remaining < sizeof(T))
+        return false;
+    std::memcpy(&value, data, sizeof(T));
+    data += sizeof(T);
+    remaining -= sizeof(T);
+    return true;
+}
+
+std::vector<std::uint8_t> GLProgramBinaryCache::Serialize() const
+{
+    std::vector<std::uint8_t> blob;
+
+    std::lock_guard<std::mutex> guard { entriesMutex_ };
+
+    if (entries_.empty())
+        return blob;
+
+    WritePOD(blob, g_programBinaryCacheMagic);
+    WritePOD(blob, static_cast<std::uint32_t>(entries_.size()));
+
+    for (const auto& it : entries_)
+    {
+        WritePOD(blob, it.first);
+        WritePOD(blob, static_cast<std::uint32_t>(it.second.binaryFormat));
+        WritePOD(blob, static_cast<std::uint32_t>(it.second.binaryData.size()));
+        blob.insert(blob.end(), it.second.binaryData.begin(), it.second.binaryData.end());
+    }
+
+    return blob;
+}
+
+bool GLProgramBinaryCache::Deserialize(const void* data, std::size_t dataSize)
+{
+    auto bytes      = reinterpret_cast<const std::uint8_t*>(data);
+    auto remaining  = dataSize;
+
+    /* Validate magic number */
+    std::uint32_t magic = 0;
+    if (!ReadPOD(bytes, remaining, magic) || magic != g_programBinaryCacheMagic)
+        return false;
+
+    std::uint32_t numEntries = 0;
+    if (!ReadPOD(bytes, remaining, numEntries))
+        return false;
+
+    /* Read all entries; reject the entire blob if it is truncated */
+    std::map<std::uint64_t, Entry> entries;
+
+    for (std::uint32_t i = 0; i < numEntries; ++i)
+    {
+        std::uint64_t   key             = 0;
+        std::uint32_t   binaryFormat    = 0;
+        std::uint32_t   binaryLength    = 0;
+
+        if (!ReadPOD(bytes, remaining, key) || !ReadPOD(bytes, remaining, binaryFormat) || !ReadPOD(bytes, remaining, binaryLength))
+            return false;
+        if (remaining < binaryLength)
+            return false;
+
+        Entry entry;
+        entry.binaryFormat = static_cast<GLenum>(binaryFormat);
+        entry.binaryData.assign(bytes, bytes + binaryLength);
+
+        bytes += binaryLength;
+        remaining -= binaryLength;
+
+        entries[key] = std::move(entry);
+    }
+
+    std::lock_guard<std::mutex> guard { entriesMutex_ };
+    entries_ = std::move(entries);
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,86 @@
+/*
+ * GLProgramBinaryCache.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_PROGRAM_BINARY_CACHE_H
+#define LLGL_GL_PROGRAM_BINARY_CACHE_H
+
+
+#include "../OpenGL.h"
+#include <map>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+struct ShaderProgramDescriptor;
+
+/*
+Cache of linked program binaries (GL_ARB_get_program_binary).
+Entries are keyed by a hash over the driver version strings, the attached shader sources,
+and the attribute/varying bindings, so that re-creating the same shader program
+can skip the costly 'glLinkProgram' step.
+*/
+class GLProgramBinaryCache
+{
+
+    public:
+
+        GLProgramBinaryCache(const GLProgramBinaryCache&) = delete;
+        GLProgramBinaryCache& operator = (const GLProgramBinaryCache&) = delete;
+
+        // Returns the instance of this singleton class.
+        static GLProgramBinaryCache& Get();
+
+        // Returns true if the required extension (GL_ARB_get_program_binary) is supported.
+        static bool IsSupported();
+
+        // Computes the cache key for the specified shader program descriptor (must be called with a current GL context).
+        static std::uint64_t ComputeProgramKey(const ShaderProgramDescriptor& desc);
+
+        // Restores the specified program from a cached binary and returns true if the program was linked successfully.
+        bool LoadBinary(GLuint program, std::uint64_t key);
+
+        // Queries the binary of the specified (successfully linked) program and stores it under the specified key.
+        void StoreBinary(GLuint program, std::uint64_t key);
+
+        // Serializes all cache entries into an opaque blob; see RenderSystem::GetPipelineCacheData.
+        std::vector<std::uint8_t> Serialize() const;
+
+        // Initializes the cache entries from a previously serialized blob and returns true on success.
+        bool Deserialize(const void* data, std::size_t dataSize);
+
+    private:
+
+        GLProgramBinaryCache() = default;
+
+    private:
+
+        struct Entry
+        {
+            GLenum                      binaryFormat;
+            std::vector<std::uint8_t>   binaryData;
+        };
+
+        std::map<std::uint64_t, Entry>  entries_;
+        mutable std::mutex              entriesMutex_;  // Programs may be linked on loader threads with worker contexts
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -201,11 +201,41 @@ void GLShader::BuildTransformFeedbackVaryings(std::size_t numVaryings, const Ver
     }
 }
 
+// Injects one "#define" directive per specialization constant right after the "#version" directive.
+static std::string InjectSpecializationDefines(const std::string& source, const ShaderSpecialization* specializations)
+{
+    /* Find end of "#version" directive (the GLSL preprocessor requires it to be the first directive) */
+    std::size_t insertPos = 0;
+
+    auto versionPos = source.find("#version");
+    if (versionPos != std::string::npos)
+    {
+        insertPos = source.find('\n', versionPos);
+        insertPos = (insertPos != std::string::npos ? insertPos + 1 : source.size());
+    }
+
+    /* Insert macro definitions after the "#version" directive */
+    std::string defines;
+    for (; specializations->name != nullptr; ++specializations)
+    {
+        defines += "#define ";
+        defines += specializations->name;
+        defines += ' ';
+        defines += std::to_string(specializations->value);
+        defines += '\n';
+    }
+
+    auto result = source;
+    result.insert(insertPos, defines);
+    return result;
+}
+
 void GLShader::CompileSource(const ShaderDescriptor& shaderDesc)
 {
     /* Get source code */
     std::string fileContent;
     const GLchar* strings[1];
+    GLint lengths[1] = { 0 };
 
     if (shaderDesc.sourceType == ShaderSourceType::CodeFile)
     {
@@ -215,10 +245,22 @@ void GLShader::CompileSource(const ShaderDescriptor& shaderDesc)
     else
     {
         strings[0] = shaderDesc.source;
+        lengths[0] = static_cast<GLint>(shaderDesc.sourceSize);
+    }
+
+    /* Inject specialization constants as macro definitions (GLSL has no native specialization mechanism) */
+    if (shaderDesc.specializations != nullptr)
+    {
+        fileContent = InjectSpecializationDefines(
+            (lengths[0] > 0 ? std::string { strings[0], static_cast<std::size_t>(lengths[0]) } : std::string { strings[0] }),
+            shaderDesc.specializations
+        );
+        strings[0] = fileContent.c_str();
+        lengths[0] = 0;
     }
 
-    /* Load shader source code, then compile shader */
-    glShaderSource(id_, 1, strings, nullptr);
+    /* Load shader source code, then compile shader; pass the explicit length for sources that are not null terminated (e.g. memory mapped files) */
+    glShaderSource(id_, 1, strings, (lengths[0] > 0 ? lengths : nullptr));
     glCompileShader(id_);
 }
 
@@ -249,9 +291,28 @@ void GLShader::LoadBinary(const ShaderDescriptor& shaderDesc)
         /* Load shader binary */
         glShaderBinary(1, &id_, GL_SHADER_BINARY_FORMAT_SPIR_V, binaryBuffer, binaryLength);
 
+        /* Gather specialization constants for the SPIR-V module */
+        std::vector<GLuint> specConstantIndices;
+        std::vector<GLuint> specConstantValues;
+
+        if (auto specializations = shaderDesc.specializations)
+        {
+            for (; specializations->name != nullptr; ++specializations)
+            {
+                specConstantIndices.push_back(static_cast<GLuint>(specializations->id));
+                specConstantValues.push_back(static_cast<GLuint>(specializations->value));
+            }
+        }
+
         /* Specialize for the default "main" function in a SPIR-V module  */
         const char* entryPoint = (shaderDesc.entryPoint == nullptr || *shaderDesc.entryPoint == '\0' ? "main" : shaderDesc.entryPoint);
-        glSpecializeShader(id_, entryPoint, 0, nullptr, nullptr);
+        glSpecializeShader(
+            id_,
+            entryPoint,
+            static_cast<GLuint>(specConstantIndices.size()),
+            specConstantIndices.data(),
+            specConstantValues.data()
+        );
     }
     else
     #endif
@@ -8,6 +8,8 @@
 #include "GLShaderProgram.h"
 #include "GLShader.h"
 #include "GLShaderBindingLayout.h"
+#include "GLShaderUniform.h"
+#include "GLProgramBinaryCache.h"
 #include "../GLObjectUtils.h"
 #include "../RenderState/GLStateManager.h"
 #include "../Ext/GLExtensions.h"
@@ -15,10 +17,12 @@
 #include "../../CheckedCast.h"
 #include "../../GLCommon/GLTypes.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/LinearStringContainer.h"
 #include <LLGL/VertexAttribute.h>
 #include <LLGL/Constants.h>
 #include <vector>
 #include <stdexcept>
+#include <cstring>
 
 
 namespace LLGL
@@ -65,6 +69,10 @@ GLShaderProgram::GLShaderProgram(const ShaderProgramDescriptor& desc) :
             shaderWithVaryings = vsGL;
     }
 
+    /* Compute cache key for the program binary cache (must be done before linking) */
+    if (GLProgramBinaryCache::IsSupported())
+        cacheKey_ = GLProgramBinaryCache::ComputeProgramKey(desc);
+
     if (shaderWithVaryings != nullptr)
     {
         const auto& varyings = shaderWithVaryings->GetTransformFeedbackVaryings();
@@ -78,6 +86,7 @@ GLShaderProgram::~GLShaderProgram()
 {
     glDeleteProgram(id_);
     GLStateManager::Get().NotifyShaderProgramRelease(id_);
+    GLClearUniformTypeCache(id_);
 }
 
 void GLShaderProgram::SetName(const char* name)
@@ -117,18 +126,30 @@ std::string GLShaderProgram::GetReport() const
 
 bool GLShaderProgram::Reflect(ShaderReflection& reflection) const
 {
-    ShaderProgram::ClearShaderReflection(reflection);
-    QueryReflection(reflection);
-    ShaderProgram::FinalizeShaderReflection(reflection);
+    CacheReflection();
+    reflection = cachedReflection_;
     return true;
 }
 
 UniformLocation GLShaderProgram::FindUniformLocation(const char* name) const
 {
     if (id_ != 0)
-        return static_cast<UniformLocation>(glGetUniformLocation(id_, name));
-    else
-        return -1;
+    {
+        CacheReflection();
+
+        auto it = cachedUniformLocations_.find(name);
+        if (it == cachedUniformLocations_.end())
+        {
+            /* Cache locations that are not part of the active uniform list (e.g. individual array elements) */
+            it = cachedUniformLocations_.emplace(
+                name,
+                static_cast<UniformLocation>(glGetUniformLocation(id_, name))
+            ).first;
+        }
+
+        return it->second;
+    }
+    return -1;
 }
 
 bool GLShaderProgram::SetWorkGroupSize(const Extent3D& workGroupSize)
@@ -210,6 +231,29 @@ void GLShaderProgram::BindFragDataLocations(std::size_t numFragmentAttribs, cons
 }
 
 void GLShaderProgram::LinkProgram(std::size_t numVaryings, const char* const* varyings)
+{
+    #ifdef GL_ARB_get_program_binary
+    if (cacheKey_ != 0)
+    {
+        /* Try to restore the program from a cached binary to skip the costly link step */
+        if (GLProgramBinaryCache::Get().LoadBinary(id_, cacheKey_))
+            return;
+
+        /* Allow the linked binary to be queried with 'glGetProgramBinary' afterwards */
+        glProgramParameteri(id_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    #endif // /GL_ARB_get_program_binary
+
+    LinkProgramFromSource(numVaryings, varyings);
+
+    #ifdef GL_ARB_get_program_binary
+    /* Store the freshly linked binary in the cache */
+    if (cacheKey_ != 0 && !HasErrors())
+        GLProgramBinaryCache::Get().StoreBinary(id_, cacheKey_);
+    #endif // /GL_ARB_get_program_binary
+}
+
+void GLShaderProgram::LinkProgramFromSource(std::size_t numVaryings, const char* const* varyings)
 {
     /* Check if transform-feedback varyings must be specified (before or after shader linking) */
     if (numVaryings > 0 && varyings != nullptr)
@@ -306,6 +350,22 @@ void GLShaderProgram::BuildTransformFeedbackVaryingsNV(std::size_t numVaryings,
 
 #endif
 
+void GLShaderProgram::CacheReflection() const
+{
+    if (!hasCachedReflection_)
+    {
+        /* Build reflection table once and serve all subsequent queries from the cache */
+        ShaderProgram::ClearShaderReflection(cachedReflection_);
+        QueryReflection(cachedReflection_);
+        ShaderProgram::FinalizeShaderReflection(cachedReflection_);
+
+        for (const auto& uniform : cachedReflection_.uniforms)
+            cachedUniformLocations_[uniform.name] = uniform.location;
+
+        hasCachedReflection_ = true;
+    }
+}
+
 void GLShaderProgram::QueryReflection(ShaderReflection& reflection) const
 {
     QueryVertexAttributes(reflection);
@@ -388,10 +448,10 @@ static SystemValue FindSystemValue(const std::string& name)
     return SystemValue::Undefined;
 }
 
-// Internal struct for QueryVertexAttributes function
+// Internal struct for QueryVertexAttributes function; name is interned in a LinearStringContainer
 struct GLReflectVertexAttribute
 {
-    std::string     name;
+    const char*     name;
     Format          format;
     std::uint32_t   semanticIndex;
     std::uint32_t   location;
@@ -408,6 +468,10 @@ void GLShaderProgram::QueryVertexAttributes(ShaderReflection& reflection) const
     std::vector<GLReflectVertexAttribute> attributes;
     attributes.reserve(static_cast<std::size_t>(numAttribs));
 
+    /* Intern all attribute names in a single linear allocation instead of one std::string per attribute */
+    LinearStringContainer attribNames;
+    attribNames.Reserve(static_cast<std::size_t>(numAttribs) * static_cast<std::size_t>(maxNameLength));
+
     /* Iterate over all vertex attributes */
     for (GLuint i = 0; i < static_cast<GLuint>(numAttribs); ++i)
     {
@@ -419,11 +483,11 @@ void GLShaderProgram::QueryVertexAttributes(ShaderReflection& reflection) const
         glGetActiveAttrib(id_, i, maxNameLength, &nameLength, &size, &type, attribName.data());
 
         /* Convert attribute information */
-        auto name = std::string(attribName.data());
+        auto name = attribNames.CopyString(attribName.data());
         auto attr = UnmapAttribType(type);
 
         /* Get attribute location */
-        auto location = static_cast<std::uint32_t>(glGetAttribLocation(id_, name.c_str()));
+        auto location = static_cast<std::uint32_t>(glGetAttribLocation(id_, name));
 
         /* Insert vertex attribute into list */
         for (std::uint32_t semanticIndex = 0; semanticIndex < attr.second; ++semanticIndex)
@@ -440,7 +504,7 @@ void GLShaderProgram::QueryVertexAttributes(ShaderReflection& reflection) const
                 return true;
             if (lhs.location > rhs.location)
                 return false;
-            return (lhs.name < rhs.name);
+            return (std::strcmp(lhs.name, rhs.name) < 0);
         }
     );
 
@@ -452,7 +516,7 @@ void GLShaderProgram::QueryVertexAttributes(ShaderReflection& reflection) const
         auto& src = attributes[i];
         auto& dst = reflection.vertex.inputAttribs[i];
 
-        dst.name    = std::move(src.name);
+        dst.name    = src.name;
         dst.format  = src.format;
 
         if (src.location == std::uint32_t(-1))
@@ -12,6 +12,9 @@
 #include <LLGL/ShaderProgram.h>
 #include "GLShaderUniform.h"
 #include "../OpenGL.h"
+#include <cstdint>
+#include <map>
+#include <string>
 
 
 namespace LLGL
@@ -60,6 +63,7 @@ class GLShaderProgram final : public ShaderProgram
         void BindAttribLocations(std::size_t numVertexAttribs, const GLShaderAttribute* vertexAttribs);
         void BindFragDataLocations(std::size_t numFragmentAttribs, const GLShaderAttribute* fragmentAttribs);
         void LinkProgram(std::size_t numVaryings, const char* const* varyings);
+        void LinkProgramFromSource(std::size_t numVaryings, const char* const* varyings);
 
         bool QueryActiveAttribs(
             GLenum              attribCountType,
@@ -74,6 +78,8 @@ class GLShaderProgram final : public ShaderProgram
         void BuildTransformFeedbackVaryingsNV(std::size_t numVaryings, const char* const* varyings);
         #endif
 
+        void CacheReflection() const;
+
         void QueryReflection(ShaderReflection& reflection) const;
         void QueryVertexAttributes(ShaderReflection& reflection) const;
         void QueryStreamOutputAttributes(ShaderReflection& reflection) const;
@@ -87,7 +93,10 @@ class GLShaderProgram final : public ShaderProgram
 
     private:
 
-        GLuint id_ = 0;
+        GLuint          id_         = 0;
+
+        // Key for the program binary cache; zero if the cache is not supported.
+        std::uint64_t   cacheKey_   = 0;
 
     private:
 
@@ -97,6 +106,14 @@ class GLShaderProgram final : public ShaderProgram
         */
         mutable const GLShaderBindingLayout* bindingLayout_ = nullptr;
 
+        /*
+        Cached reflection data is mutable since it's lazily built on the first query,
+        so the costly 'glGetActiveUniform' and 'glGetUniformLocation' loops run only once per program
+        */
+        mutable ShaderReflection                        cachedReflection_;
+        mutable std::map<std::string, UniformLocation>  cachedUniformLocations_;
+        mutable bool                                    hasCachedReflection_    = false;
+
 };
 
 
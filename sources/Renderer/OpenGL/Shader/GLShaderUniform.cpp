@@ -9,6 +9,8 @@
 #include "../../GLCommon/GLTypes.h"
 #include "../../GLCommon/GLExtensionRegistry.h"
 #include "../Ext/GLExtensions.h"
+#include <unordered_map>
+#include <vector>
 
 
 namespace LLGL
@@ -264,18 +266,50 @@ void GLSetUniformsByType(UniformType type, GLint location, GLsizei count, const
     }
 }
 
+/*
+Cache for the uniform types of each shader program.
+Querying the type with glGetActiveUniform is a driver round-trip,
+so it must not be repeated for every SetUniforms call on the per-draw hot path.
+*/
+static std::unordered_map<GLuint, std::vector<GLenum>> g_uniformTypeCaches;
+
+static GLenum GetCachedUniformType(GLuint program, GLint location)
+{
+    auto& cache = g_uniformTypeCaches[program];
+
+    if (static_cast<std::size_t>(location) >= cache.size())
+        cache.resize(static_cast<std::size_t>(location) + 1, 0);
+
+    if (cache[location] == 0)
+    {
+        /* Determine type of uniform once and keep it for subsequent calls */
+        GLenum type = 0;
+        GLint size = 0;
+        glGetActiveUniform(program, static_cast<GLuint>(location), 0, nullptr, &size, &type, nullptr);
+        cache[location] = type;
+    }
+
+    return cache[location];
+}
+
 void GLSetUniformsByLocation(GLuint program, GLint location, GLsizei count, const void* data)
 {
-    /* Determine type of uniform */
-    GLenum type = 0;
-    GLint size = 0;
-    glGetActiveUniform(program, static_cast<GLuint>(location), 0, nullptr, &size, &type, nullptr);
+    if (location < 0)
+        return;
+
+    /* Determine type of uniform from cache */
+    const GLenum type = GetCachedUniformType(program, location);
 
     /* Submit data to respective uniform type */
     UniformType uniformType = GLTypes::UnmapUniformType(type);
     GLSetUniformsByType(uniformType, location, count, data);
 }
 
+void GLClearUniformTypeCache(GLuint program)
+{
+    g_uniformTypeCaches.erase(program);
+}
+
 
 } // /namespace LLGL
 
@@ -23,6 +23,9 @@ void GLSetUniformsByType(UniformType type, GLint location, GLsizei count, const
 // Sets the data of the specified uniform in the active shader program, where the type is determined by the specified shader program.
 void GLSetUniformsByLocation(GLuint program, GLint location, GLsizei count, const void* data);
 
+// Removes all cached uniform types of the specified shader program; must be called when the program is deleted.
+void GLClearUniformTypeCache(GLuint program);
+
 
 } // /namespace LLGL
 
@@ -75,6 +75,18 @@ bool GLFramebuffer::FramebufferParameters(
     #ifdef GL_ARB_framebuffer_no_attachments
     if (HasExtension(GLExt::ARB_framebuffer_no_attachments))
     {
+        #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+        if (HasExtension(GLExt::ARB_direct_state_access))
+        {
+            /* Set parameters directly without disturbing the framebuffer binding (GL 4.5+) */
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_WIDTH, width);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_HEIGHT, height);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_LAYERS, layers);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_SAMPLES, samples);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_FIXED_SAMPLE_LOCATIONS, fixedSampleLocations);
+            return true;
+        }
+        #endif // /GL_ARB_direct_state_access
         GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::FRAMEBUFFER, GetID());
         glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_WIDTH, width);
         glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_HEIGHT, height);
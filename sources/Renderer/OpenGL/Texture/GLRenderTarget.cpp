@@ -135,18 +135,42 @@ void GLRenderTarget::BlitOntoFramebuffer()
 {
     if (framebufferMS_ && !colorAttachments_.empty())
     {
-        framebuffer_.Bind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
-        framebufferMS_.Bind(GLFramebufferTarget::READ_FRAMEBUFFER);
-
-        for (auto attachment : colorAttachments_)
+        #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+        if (HasExtension(GLExt::ARB_direct_state_access))
         {
-            glReadBuffer(attachment);
-            glDrawBuffer(attachment);
-            BlitFramebuffer();
+            /* Blit between the named framebuffers without disturbing the framebuffer binding (GL 4.5+) */
+            const auto width    = static_cast<GLint>(GetResolution().width);
+            const auto height   = static_cast<GLint>(GetResolution().height);
+
+            for (auto attachment : colorAttachments_)
+            {
+                glNamedFramebufferReadBuffer(framebufferMS_.GetID(), attachment);
+                glNamedFramebufferDrawBuffer(framebuffer_.GetID(), attachment);
+                glBlitNamedFramebuffer(
+                    framebufferMS_.GetID(),
+                    framebuffer_.GetID(),
+                    0, 0, width, height,
+                    0, 0, width, height,
+                    blitMask_, GL_NEAREST
+                );
+            }
         }
+        else
+        #endif // /GL_ARB_direct_state_access
+        {
+            framebuffer_.Bind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
+            framebufferMS_.Bind(GLFramebufferTarget::READ_FRAMEBUFFER);
 
-        framebufferMS_.Unbind(GLFramebufferTarget::READ_FRAMEBUFFER);
-        framebuffer_.Unbind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
+            for (auto attachment : colorAttachments_)
+            {
+                glReadBuffer(attachment);
+                glDrawBuffer(attachment);
+                BlitFramebuffer();
+            }
+
+            framebufferMS_.Unbind(GLFramebufferTarget::READ_FRAMEBUFFER);
+            framebuffer_.Unbind(GLFramebufferTarget::DRAW_FRAMEBUFFER);
+        }
     }
 }
 
@@ -158,14 +182,35 @@ void GLRenderTarget::BlitOntoScreen(std::size_t colorAttachmentIndex)
 {
     if (colorAttachmentIndex < colorAttachments_.size())
     {
-        GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DRAW_FRAMEBUFFER, 0);
-        GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::READ_FRAMEBUFFER, GetFramebuffer().GetID());
+        #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+        if (HasExtension(GLExt::ARB_direct_state_access))
         {
-            glReadBuffer(colorAttachments_[colorAttachmentIndex]);
-            glDrawBuffer(GL_BACK);
-            BlitFramebuffer();
+            /* Blit from the named framebuffer onto the back buffer without disturbing the framebuffer binding (GL 4.5+) */
+            const auto width    = static_cast<GLint>(GetResolution().width);
+            const auto height   = static_cast<GLint>(GetResolution().height);
+
+            glNamedFramebufferReadBuffer(GetFramebuffer().GetID(), colorAttachments_[colorAttachmentIndex]);
+            glNamedFramebufferDrawBuffer(0, GL_BACK);
+            glBlitNamedFramebuffer(
+                GetFramebuffer().GetID(),
+                0,
+                0, 0, width, height,
+                0, 0, width, height,
+                blitMask_, GL_NEAREST
+            );
+        }
+        else
+        #endif // /GL_ARB_direct_state_access
+        {
+            GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DRAW_FRAMEBUFFER, 0);
+            GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::READ_FRAMEBUFFER, GetFramebuffer().GetID());
+            {
+                glReadBuffer(colorAttachments_[colorAttachmentIndex]);
+                glDrawBuffer(GL_BACK);
+                BlitFramebuffer();
+            }
+            GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::READ_FRAMEBUFFER, 0);
         }
-        GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::READ_FRAMEBUFFER, 0);
     }
 }
 
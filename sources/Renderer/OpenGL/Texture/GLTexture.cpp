@@ -36,6 +36,13 @@ GLTexture::GLTexture(const TextureDescriptor& desc) :
     }
 }
 
+GLTexture::GLTexture(const TextureType type) :
+    Texture { type }
+{
+    /* Only generate the texture name; glTextureView requires a name that has not been bound or created yet */
+    glGenTextures(1, &id_);
+}
+
 GLTexture::~GLTexture()
 {
     glDeleteTextures(1, &id_);
@@ -292,6 +299,7 @@ void GLTexture::TextureView(GLTexture& sharedTexture, const TextureViewDescripto
             textureViewDesc.subresource.baseArrayLayer,
             textureViewDesc.subresource.numArrayLayers
         );
+        numMipLevels_ = static_cast<GLsizei>(textureViewDesc.subresource.numMipLevels);
     }
     #endif // /GL_ARB_texture_view
 }
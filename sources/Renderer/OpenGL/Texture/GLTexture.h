@@ -31,6 +31,10 @@ class GLTexture final : public Texture
     public:
 
         GLTexture(const TextureDescriptor& desc);
+
+        // Constructor for texture-views: only generates the GL texture name (see TextureView).
+        GLTexture(const TextureType type);
+
         ~GLTexture();
 
         // Copies the specified source texture into this texture.
@@ -0,0 +1,161 @@
+/*
+ * GLTextureReadback.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "GLTextureReadback.h"
+#include "GLTexture.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../GLCommon/GLTypes.h"
+#include "../../GLCommon/GLExtensionRegistry.h"
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+GLTextureReadback::GLTextureReadback(
+    const GLTexture&    textureGL,
+    std::uint32_t       mipLevel,
+    const ImageFormat   format,
+    const DataType      dataType)
+{
+    /* Determine data size from MIP-map extent */
+    const auto extent       = textureGL.GetMipExtent(mipLevel);
+    const auto numPixels    = extent.width * extent.height * extent.depth;
+
+    dataSize_ = static_cast<GLsizeiptr>(ImageDataSize(format, dataType, numPixels));
+
+    /* Create pixel-pack buffer as destination of the copy operation */
+    glGenBuffers(1, &bufferID_);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, bufferID_);
+    glBufferData(GL_PIXEL_PACK_BUFFER, dataSize_, nullptr, GL_STREAM_READ);
+
+    /* Read image data from texture; with a pixel-pack buffer bound, the <data> parameter is a byte offset into that buffer */
+    #if defined GL_ARB_direct_state_access && defined LLGL_GL_ENABLE_DSA_EXT
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        glGetTextureImage(
+            textureGL.GetID(),
+            static_cast<GLint>(mipLevel),
+            GLTypes::Map(format),
+            GLTypes::Map(dataType),
+            static_cast<GLsizei>(dataSize_),
+            nullptr
+        );
+    }
+    else
+    #endif
+    {
+        /* Bind texture and read image data from texture */
+        GLStateManager::Get().BindGLTexture(textureGL);
+        glGetTexImage(
+            GLTypes::Map(textureGL.GetType()),
+            static_cast<GLint>(mipLevel),
+            GLTypes::Map(format),
+            GLTypes::Map(dataType),
+            nullptr
+        );
+    }
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+    /* Insert fence to poll completion of the copy operation */
+    if (HasExtension(GLExt::ARB_sync))
+        sync_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+GLTextureReadback::GLTextureReadback(
+    const Extent2D&     resolution,
+    const ImageFormat   format,
+    const DataType      dataType)
+{
+    /* Determine data size from back buffer resolution */
+    const auto numPixels = resolution.width * resolution.height;
+
+    dataSize_ = static_cast<GLsizeiptr>(ImageDataSize(format, dataType, numPixels));
+
+    /* Create pixel-pack buffer as destination of the copy operation */
+    glGenBuffers(1, &bufferID_);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, bufferID_);
+    glBufferData(GL_PIXEL_PACK_BUFFER, dataSize_, nullptr, GL_STREAM_READ);
+
+    /* Read pixels from back buffer; with a pixel-pack buffer bound, the <data> parameter is a byte offset into that buffer */
+    GLStateManager::Get().PushBoundFramebuffer(GLFramebufferTarget::READ_FRAMEBUFFER);
+    {
+        GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::READ_FRAMEBUFFER, 0);
+        glReadBuffer(GL_BACK);
+        glReadPixels(
+            0,
+            0,
+            static_cast<GLsizei>(resolution.width),
+            static_cast<GLsizei>(resolution.height),
+            GLTypes::Map(format),
+            GLTypes::Map(dataType),
+            nullptr
+        );
+    }
+    GLStateManager::Get().PopBoundFramebuffer();
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+    /* Insert fence to poll completion of the copy operation */
+    if (HasExtension(GLExt::ARB_sync))
+        sync_ = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+GLTextureReadback::~GLTextureReadback()
+{
+    /* Always call glDeleteSync, it will silently ignore a <sync> value of zero */
+    glDeleteSync(sync_);
+    glDeleteBuffers(1, &bufferID_);
+    GLStateManager::Get().NotifyBufferRelease(bufferID_, GLBufferTarget::PIXEL_PACK_BUFFER);
+}
+
+bool GLTextureReadback::IsComplete()
+{
+    if (sync_)
+    {
+        /* Poll sync object with a zero timeout, so this never blocks */
+        GLenum result = glClientWaitSync(sync_, 0, 0);
+        return (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED);
+    }
+    return true;
+}
+
+const void* GLTextureReadback::Map()
+{
+    /* Block until the copy operation has completed; without GL_ARB_sync, mapping the buffer synchronizes implicitly */
+    if (sync_)
+        glClientWaitSync(sync_, GL_SYNC_FLUSH_COMMANDS_BIT, std::numeric_limits<GLuint64>::max());
+
+    /* Map pixel-pack buffer into CPU memory space; the mapping remains valid after the buffer is unbound */
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, bufferID_);
+    auto data = glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+
+    return data;
+}
+
+void GLTextureReadback::Unmap()
+{
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, bufferID_);
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PIXEL_PACK_BUFFER, 0);
+}
+
+std::uint64_t GLTextureReadback::GetDataSize() const
+{
+    return static_cast<std::uint64_t>(dataSize_);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,69 @@
+/*
+ * GLTextureReadback.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_GL_TEXTURE_READBACK_H
+#define LLGL_GL_TEXTURE_READBACK_H
+
+
+#include <LLGL/TextureReadback.h>
+#include <LLGL/ImageFlags.h>
+#include "../OpenGL.h"
+
+
+namespace LLGL
+{
+
+
+class GLTexture;
+
+class GLTextureReadback final : public TextureReadback
+{
+
+    public:
+
+        bool IsComplete() override;
+
+        const void* Map() override;
+        void Unmap() override;
+
+        std::uint64_t GetDataSize() const override;
+
+    public:
+
+        GLTextureReadback(
+            const GLTexture&    textureGL,
+            std::uint32_t       mipLevel,
+            const ImageFormat   format,
+            const DataType      dataType
+        );
+
+        // Constructor for back buffer captures: reads the pixels of the currently active back buffer (see RenderContext::CaptureFrame).
+        GLTextureReadback(
+            const Extent2D&     resolution,
+            const ImageFormat   format,
+            const DataType      dataType
+        );
+
+        ~GLTextureReadback();
+
+    private:
+
+        GLuint      bufferID_   = 0;
+        GLsync      sync_       = 0;
+        GLsizeiptr  dataSize_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,192 @@
+/*
+ * PipelineStateHash.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "PipelineStateHash.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal functions ----- */
+
+// Combines the specified byte range into the hash value (FNV-1a, 64 bit)
+static void HashBytes(std::uint64_t& hash, const void* data, std::size_t size)
+{
+    auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+}
+
+// Combines the binary representation of the specified value into the hash value.
+// Structures must be hashed field by field, since their padding bytes are indeterminate.
+template <typename T>
+static void HashValue(std::uint64_t& hash, const T& value)
+{
+    HashBytes(hash, &value, sizeof(value));
+}
+
+static void HashViewport(std::uint64_t& hash, const Viewport& viewport)
+{
+    HashValue(hash, viewport.x);
+    HashValue(hash, viewport.y);
+    HashValue(hash, viewport.width);
+    HashValue(hash, viewport.height);
+    HashValue(hash, viewport.minDepth);
+    HashValue(hash, viewport.maxDepth);
+}
+
+static void HashScissor(std::uint64_t& hash, const Scissor& scissor)
+{
+    HashValue(hash, scissor.x);
+    HashValue(hash, scissor.y);
+    HashValue(hash, scissor.width);
+    HashValue(hash, scissor.height);
+}
+
+static void HashDepthDesc(std::uint64_t& hash, const DepthDescriptor& desc)
+{
+    HashValue(hash, desc.testEnabled);
+    HashValue(hash, desc.writeEnabled);
+    HashValue(hash, desc.compareOp);
+}
+
+static void HashStencilFaceDesc(std::uint64_t& hash, const StencilFaceDescriptor& desc)
+{
+    HashValue(hash, desc.stencilFailOp);
+    HashValue(hash, desc.depthFailOp);
+    HashValue(hash, desc.depthPassOp);
+    HashValue(hash, desc.compareOp);
+    HashValue(hash, desc.readMask);
+    HashValue(hash, desc.writeMask);
+    HashValue(hash, desc.reference);
+}
+
+static void HashStencilDesc(std::uint64_t& hash, const StencilDescriptor& desc)
+{
+    HashValue(hash, desc.testEnabled);
+    HashStencilFaceDesc(hash, desc.front);
+    HashStencilFaceDesc(hash, desc.back);
+}
+
+static void HashRasterizerDesc(std::uint64_t& hash, const RasterizerDescriptor& desc)
+{
+    HashValue(hash, desc.polygonMode);
+    HashValue(hash, desc.cullMode);
+    HashValue(hash, desc.depthBias.constantFactor);
+    HashValue(hash, desc.depthBias.slopeFactor);
+    HashValue(hash, desc.depthBias.clamp);
+    HashValue(hash, desc.multiSampling.enabled);
+    HashValue(hash, desc.multiSampling.samples);
+    HashValue(hash, desc.multiSampling.sampleMask);
+    HashValue(hash, desc.frontCCW);
+    HashValue(hash, desc.discardEnabled);
+    HashValue(hash, desc.depthClampEnabled);
+    HashValue(hash, desc.scissorTestEnabled);
+    HashValue(hash, desc.antiAliasedLineEnabled);
+    HashValue(hash, desc.conservativeRasterization);
+    HashValue(hash, desc.lineWidth);
+}
+
+static void HashBlendTargetDesc(std::uint64_t& hash, const BlendTargetDescriptor& desc)
+{
+    HashValue(hash, desc.blendEnabled);
+    HashValue(hash, desc.srcColor);
+    HashValue(hash, desc.dstColor);
+    HashValue(hash, desc.colorArithmetic);
+    HashValue(hash, desc.srcAlpha);
+    HashValue(hash, desc.dstAlpha);
+    HashValue(hash, desc.alphaArithmetic);
+    HashValue(hash, desc.colorMask.r);
+    HashValue(hash, desc.colorMask.g);
+    HashValue(hash, desc.colorMask.b);
+    HashValue(hash, desc.colorMask.a);
+}
+
+static void HashBlendDesc(std::uint64_t& hash, const BlendDescriptor& desc)
+{
+    HashValue(hash, desc.alphaToCoverageEnabled);
+    HashValue(hash, desc.independentBlendEnabled);
+    HashValue(hash, desc.logicOp);
+    HashValue(hash, desc.blendFactor.r);
+    HashValue(hash, desc.blendFactor.g);
+    HashValue(hash, desc.blendFactor.b);
+    HashValue(hash, desc.blendFactor.a);
+    for (const auto& target : desc.targets)
+        HashBlendTargetDesc(hash, target);
+}
+
+static void HashAttachmentFormatDesc(std::uint64_t& hash, const AttachmentFormatDescriptor& desc)
+{
+    HashValue(hash, desc.format);
+    HashValue(hash, desc.loadOp);
+    HashValue(hash, desc.storeOp);
+}
+
+
+/* ----- Functions ----- */
+
+std::uint64_t HashGraphicsPipelineDesc(const GraphicsPipelineDescriptor& desc)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+
+    /* Referenced objects are hashed by their identity */
+    HashValue(hash, desc.shaderProgram);
+    HashValue(hash, desc.renderPass);
+    HashValue(hash, desc.pipelineLayout);
+    HashValue(hash, desc.primitiveTopology);
+
+    HashValue(hash, desc.viewports.size());
+    for (const auto& viewport : desc.viewports)
+        HashViewport(hash, viewport);
+
+    HashValue(hash, desc.scissors.size());
+    for (const auto& scissor : desc.scissors)
+        HashScissor(hash, scissor);
+
+    HashDepthDesc(hash, desc.depth);
+    HashStencilDesc(hash, desc.stencil);
+    HashRasterizerDesc(hash, desc.rasterizer);
+    HashBlendDesc(hash, desc.blend);
+
+    return hash;
+}
+
+std::uint64_t HashComputePipelineDesc(const ComputePipelineDescriptor& desc)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+
+    HashValue(hash, desc.shaderProgram);
+    HashValue(hash, desc.pipelineLayout);
+
+    return hash;
+}
+
+std::uint64_t HashRenderPassDesc(const RenderPassDescriptor& desc)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+
+    HashValue(hash, desc.colorAttachments.size());
+    for (const auto& attachment : desc.colorAttachments)
+        HashAttachmentFormatDesc(hash, attachment);
+
+    HashAttachmentFormatDesc(hash, desc.depthAttachment);
+    HashAttachmentFormatDesc(hash, desc.stencilAttachment);
+    HashValue(hash, desc.readOnlyDepthStencil);
+
+    return hash;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
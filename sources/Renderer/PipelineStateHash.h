@@ -0,0 +1,39 @@
+/*
+ * PipelineStateHash.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_PIPELINE_STATE_HASH_H
+#define LLGL_PIPELINE_STATE_HASH_H
+
+
+#include <LLGL/GraphicsPipelineFlags.h>
+#include <LLGL/ComputePipelineFlags.h>
+#include <LLGL/RenderPassFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Returns a hash value of the specified graphics pipeline descriptor (used for pipeline state deduplication).
+std::uint64_t HashGraphicsPipelineDesc(const GraphicsPipelineDescriptor& desc);
+
+// Returns a hash value of the specified compute pipeline descriptor (used for pipeline state deduplication).
+std::uint64_t HashComputePipelineDesc(const ComputePipelineDescriptor& desc);
+
+// Returns a hash value of the specified render pass descriptor (used for render pass deduplication).
+std::uint64_t HashRenderPassDesc(const RenderPassDescriptor& desc);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
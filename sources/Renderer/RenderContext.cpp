@@ -6,9 +6,11 @@
  */
 
 #include <LLGL/RenderContext.h>
+#include <LLGL/RenderSystem.h>
 #include <LLGL/Window.h>
 #include <LLGL/Canvas.h>
 #include <LLGL/Display.h>
+#include <algorithm>
 #include "CheckedCast.h"
 #include "../Core/Helper.h"
 
@@ -45,6 +47,58 @@ bool RenderContext::HasStencilAttachment() const
     return IsStencilFormat(GetDepthStencilFormat());
 }
 
+/* ----- Back Buffer ----- */
+
+void RenderContext::WaitForFrameLatency()
+{
+    // dummy: no frame-latency waitable object available
+}
+
+TextureReadback* RenderContext::CaptureFrame(RenderSystem& /*renderSystem*/, const std::function<void(TextureReadback&)>& /*callback*/)
+{
+    return nullptr; // dummy: asynchronous frame capturing not supported
+}
+
+/* ----- Frame Pipelining ----- */
+
+void RenderContext::InitFramePipeline(RenderSystem& renderSystem, std::uint32_t numFramesInFlight)
+{
+    numFramesInFlight = std::max(1u, numFramesInFlight);
+
+    /* Create one fence per frame in flight; the fences are owned by the render system */
+    frameCmdQueue_ = renderSystem.GetCommandQueue();
+    frameFences_.clear();
+    frameFences_.reserve(numFramesInFlight);
+
+    for (std::uint32_t i = 0; i < numFramesInFlight; ++i)
+        frameFences_.push_back(renderSystem.CreateFence());
+
+    frameCount_ = 0;
+    frameIndex_ = 0;
+}
+
+std::uint32_t RenderContext::BeginFrame()
+{
+    if (frameFences_.empty())
+        return 0;
+
+    /* Block until the frame that last used this ring slot has left the pipeline */
+    frameIndex_ = static_cast<std::uint32_t>(frameCount_ % frameFences_.size());
+    if (frameCount_ >= frameFences_.size())
+        frameCmdQueue_->WaitFence(*frameFences_[frameIndex_], ~0ull);
+
+    return frameIndex_;
+}
+
+void RenderContext::EndFrame()
+{
+    if (!frameFences_.empty())
+    {
+        frameCmdQueue_->Submit(*frameFences_[frameIndex_]);
+        ++frameCount_;
+    }
+}
+
 /* ----- Configuration ----- */
 
 static bool IsVideoModeValid(const VideoModeDescriptor& videoModeDesc)
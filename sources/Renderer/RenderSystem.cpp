@@ -7,14 +7,32 @@
 
 #include "../Platform/Module.h"
 #include "../Core/Helper.h"
+#include "../Core/Exception.h"
+#include "../Core/ThreadPool.h"
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Log.h>
 #include "BuildID.h"
 #include "StaticLimits.h"
 
+#include "CheckedCast.h"
+
 #include <LLGL/RenderSystem.h>
+#include <LLGL/ImageFlags.h>
+#include <algorithm>
 #include <array>
 #include <map>
+#include <fstream>
+#include <cctype>
+#include <cstdio>
+
+#ifdef LLGL_OS_WIN32
+#   include "../Platform/Win32/Win32LeanAndMean.h"
+#   include <Windows.h>
+#else
+#   include <sys/file.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
 
 #ifdef LLGL_ENABLE_DEBUG_LAYER
 #   include "DebugLayer/DbgRenderSystem.h"
@@ -29,7 +47,19 @@ namespace LLGL
 
 /* ----- Render system ----- */
 
-static std::map<RenderSystem*, std::unique_ptr<Module>> g_renderSystemModules;
+struct RenderSystemModule;
+
+static std::map<RenderSystem*, RenderSystemModule*> g_renderSystemModules;
+
+RenderSystem::RenderSystem()
+{
+    // defined here to complete the 'ThreadPool' type for the 'workerThreads_' member
+}
+
+RenderSystem::~RenderSystem()
+{
+    // see default constructor
+}
 
 #ifdef LLGL_BUILD_STATIC_LIB
 
@@ -75,56 +105,61 @@ std::vector<std::string> RenderSystem::FindModules()
     return modules;
 }
 
-static bool LoadRenderSystemBuildID(Module& module, const std::string& moduleFilename)
-{
-    /* Load "LLGL_RenderSystem_BuildID" procedure */
-    LLGL_PROC_INTERFACE(int, PFN_RENDERSYSTEM_BUILDID, (void));
+LLGL_PROC_INTERFACE(int,         PFN_RENDERSYSTEM_BUILDID,    (void));
+LLGL_PROC_INTERFACE(void*,       PFN_RENDERSYSTEM_ALLOC,      (const void*));
+LLGL_PROC_INTERFACE(const char*, PFN_RENDERSYSTEM_NAME,       (const void*));
+LLGL_PROC_INTERFACE(int,         PFN_RENDERSYSTEM_RENDERERID, (const void*));
 
-    auto RenderSystem_BuildID = reinterpret_cast<PFN_RENDERSYSTEM_BUILDID>(module.LoadProcedure("LLGL_RenderSystem_BuildID"));
-    if (!RenderSystem_BuildID)
-        throw std::runtime_error("failed to load <LLGL_RenderSystem_BuildID> procedure from module: \"" + moduleFilename + "\"");
+// Loaded render system module with its pre-resolved entry points (see LoadRenderSystemModule).
+struct RenderSystemModule
+{
+    std::unique_ptr<Module>     module;
+    PFN_RENDERSYSTEM_ALLOC      AllocFunc       = nullptr;
+    PFN_RENDERSYSTEM_NAME       NameFunc        = nullptr;
+    PFN_RENDERSYSTEM_RENDERERID RendererIDFunc  = nullptr;
+};
 
-    return (RenderSystem_BuildID() == LLGL_BUILD_ID);
-}
+/*
+Cache of known-good modules: a module stays resident once it has been loaded and verified,
+so re-loading a render system re-uses the pre-resolved entry points without any symbol resolution
+*/
+static std::map<std::string, RenderSystemModule> g_renderSystemModuleCache;
 
-static int LoadRenderSystemRendererID(Module& module, const RenderSystemDescriptor& renderSystemDesc)
+static RenderSystemModule* LoadRenderSystemModule(const std::string& moduleFilename)
 {
-    /* Load "LLGL_RenderSystem_RendererID" procedure */
-    LLGL_PROC_INTERFACE(int, PFN_RENDERSYSTEM_RENDERERID, (const void*));
+    /* Return module from cache, if it has already been loaded and verified */
+    auto it = g_renderSystemModuleCache.find(moduleFilename);
+    if (it != g_renderSystemModuleCache.end())
+        return &(it->second);
 
-    auto RenderSystem_RendererID = reinterpret_cast<PFN_RENDERSYSTEM_RENDERERID>(module.LoadProcedure("LLGL_RenderSystem_RendererID"));
-    if (RenderSystem_RendererID)
-        return RenderSystem_RendererID(&renderSystemDesc);
-
-    return RendererID::Undefined;
-}
+    /* Load render system module */
+    auto module = Module::Load(moduleFilename.c_str());
 
-static std::string LoadRenderSystemName(Module& module, const RenderSystemDescriptor& renderSystemDesc)
-{
-    /* Load "LLGL_RenderSystem_Name" procedure */
-    LLGL_PROC_INTERFACE(const char*, PFN_RENDERSYSTEM_NAME, (const void*));
+    /*
+    Verify build ID from render system module to detect a module,
+    that has compiled with a different compiler (type, version, debug/release mode etc.)
+    */
+    auto RenderSystem_BuildID = reinterpret_cast<PFN_RENDERSYSTEM_BUILDID>(module->LoadProcedure("LLGL_RenderSystem_BuildID"));
+    if (!RenderSystem_BuildID)
+        throw std::runtime_error("failed to load <LLGL_RenderSystem_BuildID> procedure from module: \"" + moduleFilename + "\"");
 
-    if (auto RenderSystem_Name = reinterpret_cast<PFN_RENDERSYSTEM_NAME>(module.LoadProcedure("LLGL_RenderSystem_Name")))
-        return RenderSystem_Name(&renderSystemDesc);
-    else
-        return "";
-}
+    if (RenderSystem_BuildID() != LLGL_BUILD_ID)
+        throw std::runtime_error("build ID mismatch in render system module");
 
-static RenderSystem* LoadRenderSystem(Module& module, const std::string& moduleFilename, const RenderSystemDescriptor& renderSystemDesc)
-{
-    /* Load "LLGL_RenderSystem_Alloc" procedure */
-    LLGL_PROC_INTERFACE(void*, PFN_RENDERSYSTEM_ALLOC, (const void*));
+    /* Resolve all entry points up front, so subsequent loads bypass symbol resolution entirely */
+    RenderSystemModule entry;
 
-    auto RenderSystem_Alloc = reinterpret_cast<PFN_RENDERSYSTEM_ALLOC>(module.LoadProcedure("LLGL_RenderSystem_Alloc"));
-    if (!RenderSystem_Alloc)
+    entry.AllocFunc = reinterpret_cast<PFN_RENDERSYSTEM_ALLOC>(module->LoadProcedure("LLGL_RenderSystem_Alloc"));
+    if (!entry.AllocFunc)
         throw std::runtime_error("failed to load <LLGL_RenderSystem_Alloc> procedure from module: " + moduleFilename);
 
-    /* Allocate render system */
-    auto renderSystem = reinterpret_cast<RenderSystem*>(RenderSystem_Alloc(&renderSystemDesc));
-    if (!renderSystem)
-        throw std::runtime_error("failed to allocate render system from module: " + moduleFilename);
+    entry.NameFunc          = reinterpret_cast<PFN_RENDERSYSTEM_NAME>(module->LoadProcedure("LLGL_RenderSystem_Name"));
+    entry.RendererIDFunc    = reinterpret_cast<PFN_RENDERSYSTEM_RENDERERID>(module->LoadProcedure("LLGL_RenderSystem_RendererID"));
+    entry.module            = std::move(module);
 
-    return renderSystem;
+    /* Store new module in cache and return reference to cache entry */
+    auto result = g_renderSystemModuleCache.emplace(moduleFilename, std::move(entry));
+    return &(result.first->second);
 }
 
 #endif // /LLGL_BUILD_STATIC_LIB
@@ -136,11 +171,14 @@ std::unique_ptr<RenderSystem> RenderSystem::Load(
 {
     #ifdef LLGL_BUILD_STATIC_LIB
 
-    /* Allocate render system */
+    /* Allocate render system from the static module registry */
     auto renderSystem = std::unique_ptr<RenderSystem>(
         reinterpret_cast<RenderSystem*>(StaticModule::AllocRenderSystem(renderSystemDesc))
     );
 
+    if (renderSystem == nullptr)
+        throw std::runtime_error("failed to allocate render system from statically compiled module: " + renderSystemDesc.moduleName);
+
     if (profiler != nullptr || debugger != nullptr)
     {
         #ifdef LLGL_ENABLE_DEBUG_LAYER
@@ -163,21 +201,19 @@ std::unique_ptr<RenderSystem> RenderSystem::Load(
 
     #else // LLGL_BUILD_STATIC_LIB
 
-    /* Load render system module */
+    /* Load render system module, or re-use cached module with pre-resolved entry points */
     auto moduleFilename = Module::GetModuleFilename(renderSystemDesc.moduleName.c_str());
-    auto module         = Module::Load(moduleFilename.c_str());
-
-    /*
-    Verify build ID from render system module to detect a module,
-    that has compiled with a different compiler (type, version, debug/release mode etc.)
-    */
-    if (!LoadRenderSystemBuildID(*module, moduleFilename))
-        throw std::runtime_error("build ID mismatch in render system module");
+    auto module         = LoadRenderSystemModule(moduleFilename);
 
     try
     {
         /* Allocate render system */
-        auto renderSystem = std::unique_ptr<RenderSystem>(LoadRenderSystem(*module, moduleFilename, renderSystemDesc));
+        auto renderSystem = std::unique_ptr<RenderSystem>(
+            reinterpret_cast<RenderSystem*>(module->AllocFunc(&renderSystemDesc))
+        );
+
+        if (renderSystem == nullptr)
+            throw std::runtime_error("failed to allocate render system from module: " + moduleFilename);
 
         if (profiler != nullptr || debugger != nullptr)
         {
@@ -193,11 +229,11 @@ std::unique_ptr<RenderSystem> RenderSystem::Load(
             #endif // /LLGL_ENABLE_DEBUG_LAYER
         }
 
-        renderSystem->name_         = LoadRenderSystemName(*module,renderSystemDesc);
-        renderSystem->rendererID_   = LoadRenderSystemRendererID(*module,renderSystemDesc);
+        renderSystem->name_         = (module->NameFunc != nullptr ? module->NameFunc(&renderSystemDesc) : "");
+        renderSystem->rendererID_   = (module->RendererIDFunc != nullptr ? module->RendererIDFunc(&renderSystemDesc) : RendererID::Undefined);
 
-        /* Store new module inside internal map */
-        g_renderSystemModules[renderSystem.get()] = std::move(module);
+        /* Store reference to cached module inside internal map */
+        g_renderSystemModules[renderSystem.get()] = module;
 
         /* Return new render system and unique pointer */
         return renderSystem;
@@ -216,21 +252,541 @@ void RenderSystem::Unload(std::unique_ptr<RenderSystem>&& renderSystem)
     auto it = g_renderSystemModules.find(renderSystem.get());
     if (it != g_renderSystemModules.end())
     {
+        /* The module itself stays resident in the cache, so a subsequent load re-uses its entry points */
         renderSystem.release();
         g_renderSystemModules.erase(it);
     }
 }
 
+const RenderingCapabilities& RenderSystem::GetRenderingCaps() const
+{
+    ResolveDeferredRenderingCaps(queryCapsFeaturesFunc_);
+    ResolveDeferredRenderingCaps(queryCapsFormatsFunc_);
+    ResolveDeferredRenderingCaps(queryCapsLimitsFunc_);
+    return caps_;
+}
+
+const RenderingFeatures& RenderSystem::GetRenderingFeatures() const
+{
+    ResolveDeferredRenderingCaps(queryCapsFeaturesFunc_);
+    return caps_.features;
+}
+
+const RenderingLimits& RenderSystem::GetRenderingLimits() const
+{
+    /* Resolve feature queries first, since the limit queries may depend on the supported features */
+    ResolveDeferredRenderingCaps(queryCapsFeaturesFunc_);
+    ResolveDeferredRenderingCaps(queryCapsLimitsFunc_);
+    return caps_.limits;
+}
+
+std::vector<VideoAdapterDescriptor> RenderSystem::QueryVideoAdapters() const
+{
+    return {}; // dummy
+}
+
+CommandQueue* RenderSystem::GetComputeCommandQueue()
+{
+    return nullptr; // dummy
+}
+
+std::uint32_t RenderSystem::GetNumCommandQueues(const CommandQueueType queueType)
+{
+    switch (queueType)
+    {
+        case CommandQueueType::Graphics:
+            return 1;
+        case CommandQueueType::Compute:
+            return (GetComputeCommandQueue() != nullptr ? 1 : 0);
+        default:
+            return 0;
+    }
+}
+
+CommandQueue* RenderSystem::GetCommandQueue(const CommandQueueType queueType, std::uint32_t index)
+{
+    if (index > 0)
+        return nullptr;
+    switch (queueType)
+    {
+        case CommandQueueType::Graphics:
+            return GetCommandQueue();
+        case CommandQueueType::Compute:
+            return GetComputeCommandQueue();
+        default:
+            return nullptr;
+    }
+}
+
+std::vector<VideoMemoryBudget> RenderSystem::QueryVideoMemoryBudgets() const
+{
+    return {}; // dummy
+}
+
+std::vector<DeviceMemoryStats> RenderSystem::QueryDeviceMemoryStats() const
+{
+    return {}; // dummy
+}
+
+void RenderSystem::SetVideoMemoryPressureCallback(const VideoMemoryPressureCallback& callback)
+{
+    videoMemoryPressureCallback_ = callback;
+}
+
 void RenderSystem::SetConfiguration(const RenderSystemConfiguration& config)
 {
     config_ = config;
 }
 
+/* ----- Buffers ----- */
+
+ErrorCode RenderSystem::TryWriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, const void* data, std::uint64_t dataSize)
+{
+    /* Validate arguments without throwing */
+    if (data == nullptr && dataSize > 0)
+        return ErrorCode::InvalidArgument;
+    if (dataSize == 0)
+        return ErrorCode::NoError;
+
+    #ifdef LLGL_DISABLE_EXCEPTIONS
+    WriteBuffer(dstBuffer, dstOffset, data, dataSize);
+    #else
+    try
+    {
+        WriteBuffer(dstBuffer, dstOffset, data, dataSize);
+    }
+    catch (...)
+    {
+        return ErrorCode::InternalError;
+    }
+    #endif // /LLGL_DISABLE_EXCEPTIONS
+
+    return ErrorCode::NoError;
+}
+
+ErrorCode RenderSystem::TryMapBuffer(Buffer& buffer, const CPUAccess access, void** mappedData)
+{
+    /* Validate arguments without throwing */
+    if (mappedData == nullptr)
+        return ErrorCode::InvalidArgument;
+
+    #ifdef LLGL_DISABLE_EXCEPTIONS
+    *mappedData = MapBuffer(buffer, access);
+    #else
+    try
+    {
+        *mappedData = MapBuffer(buffer, access);
+    }
+    catch (...)
+    {
+        *mappedData = nullptr;
+        return ErrorCode::InternalError;
+    }
+    #endif // /LLGL_DISABLE_EXCEPTIONS
+
+    return (*mappedData != nullptr ? ErrorCode::NoError : ErrorCode::InternalError);
+}
+
+void* RenderSystem::GetMappedBufferMemory(Buffer& buffer)
+{
+    return nullptr; // dummy
+}
+
+void RenderSystem::FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    // dummy
+}
+
+/* ----- Textures ----- */
+
+Texture* RenderSystem::CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc)
+{
+    return nullptr; // dummy
+}
+
+void RenderSystem::WriteTextureMulti(Texture& texture, const TextureWriteDescriptor* writeDescs, std::uint32_t numWriteDescs)
+{
+    /* Default implementation writes each region separately */
+    for (std::uint32_t i = 0; i < numWriteDescs; ++i)
+        WriteTexture(texture, writeDescs[i].textureRegion, writeDescs[i].imageDesc);
+}
+
+void RenderSystem::SetTextureMinLod(Texture& texture, float minLod)
+{
+    // dummy
+}
+
+bool RenderSystem::IsTextureUploadComplete(Texture& texture)
+{
+    return true; // dummy; synchronous uploads have always completed
+}
+
+void RenderSystem::WaitForTextureUpload(Texture& texture)
+{
+    // dummy
+}
+
+TextureReadback* RenderSystem::ReadTextureAsync(const Texture& texture, std::uint32_t mipLevel, const ImageFormat format, const DataType dataType)
+{
+    return nullptr; // dummy
+}
+
+void RenderSystem::Release(TextureReadback& textureReadback)
+{
+    // dummy
+}
+
+void RenderSystem::ProcessReadbacks()
+{
+    // dummy: no asynchronous readbacks supported
+}
+
+/* ----- Resources ----- */
+
+void RenderSystem::Release(std::uint32_t numResources, Resource* const* resources)
+{
+    if (numResources == 0 || resources == nullptr)
+        return;
+
+    /* Sort resources by type, so each internal object container is only touched once */
+    std::vector<Resource*> sortedResources { resources, resources + numResources };
+
+    std::stable_sort(
+        sortedResources.begin(),
+        sortedResources.end(),
+        [](const Resource* lhs, const Resource* rhs)
+        {
+            return (static_cast<int>(lhs->GetResourceType()) < static_cast<int>(rhs->GetResourceType()));
+        }
+    );
+
+    auto self = this;
+    auto releaseSortedResources = [self, sortedResources]()
+    {
+        for (auto resource : sortedResources)
+        {
+            switch (resource->GetResourceType())
+            {
+                case ResourceType::Buffer:
+                    self->Release(*LLGL_CAST(Buffer*, resource));
+                    break;
+                case ResourceType::Texture:
+                    self->Release(*LLGL_CAST(Texture*, resource));
+                    break;
+                case ResourceType::Sampler:
+                    self->Release(*LLGL_CAST(Sampler*, resource));
+                    break;
+                default:
+                    throw std::invalid_argument("invalid resource type passed to batch release");
+            }
+        }
+    };
+
+    if (GetRenderingFeatures().hasConcurrentResourceCreation)
+    {
+        /* Defer backend destruction to the worker thread pool, so large teardowns become a background operation */
+        ScheduleWorkerTask(releaseSortedResources);
+    }
+    else
+    {
+        /* Concurrent resource access not supported => release resources on the calling thread */
+        releaseSortedResources();
+    }
+}
+
+/* ----- Resource Heaps ----- */
+
+void RenderSystem::WriteResourceHeap(
+    ResourceHeap&                   /*resourceHeap*/,
+    std::uint32_t                   /*firstDescriptor*/,
+    std::uint32_t                   /*numResourceViews*/,
+    const ResourceViewDescriptor*   /*resourceViews*/)
+{
+    ThrowNotSupportedExcept(__FUNCTION__, "in-place resource heap updates");
+}
+
+/* ----- Shader ----- */
+
+std::vector<Shader*> RenderSystem::CreateShaders(std::size_t numShaders, const ShaderDescriptor* shaderDescs)
+{
+    std::vector<Shader*> shaders(numShaders, nullptr);
+
+    if (SupportsConcurrentShaderCompilation() && numShaders > 1)
+    {
+        /* Fan the compile jobs out across the worker thread pool */
+        std::vector<std::future<Shader*>> futures(numShaders);
+
+        for (std::size_t i = 0; i < numShaders; ++i)
+        {
+            const ShaderDescriptor desc = shaderDescs[i];
+            auto task = std::make_shared<std::packaged_task<Shader*()>>(
+                [this, desc]() -> Shader*
+                {
+                    return CreateShader(desc);
+                }
+            );
+            futures[i] = task->get_future();
+            ScheduleWorkerTask([task]{ (*task)(); });
+        }
+
+        /* Wait for all compile jobs and gather the shaders in input order */
+        for (std::size_t i = 0; i < numShaders; ++i)
+            shaders[i] = futures[i].get();
+    }
+    else
+    {
+        /* Concurrent shader compilation not supported => compile shaders on the calling thread */
+        for (std::size_t i = 0; i < numShaders; ++i)
+            shaders[i] = CreateShader(shaderDescs[i]);
+    }
+
+    return shaders;
+}
+
+/* ----- Pipeline States ----- */
+
+std::vector<std::uint8_t> RenderSystem::GetPipelineCacheData() const
+{
+    return {}; // dummy
+}
+
+bool RenderSystem::SetPipelineCacheData(const void* /*data*/, std::size_t /*dataSize*/)
+{
+    return false; // dummy
+}
+
+/*
+The shared pipeline cache directory is designed for concurrent use by multiple processes:
+writers are serialized with an advisory lock on a dedicated lock file,
+and the cache file itself is only ever replaced atomically (write to temporary file, then rename),
+so readers never observe a partially written cache file and do not need to take the lock at all.
+*/
+
+// Returns the pipeline cache filename inside the specified cache directory for the specified renderer
+static std::string GetPipelineCacheFilename(const char* directory, const std::string& rendererName)
+{
+    std::string filename = directory;
+
+    if (!filename.empty() && filename.back() != '/' && filename.back() != '\\')
+        filename += '/';
+
+    /* Strip all non-alphanumeric characters from the renderer name (e.g. "Direct3D 11" -> "Direct3D11") */
+    filename += "LLGL_PipelineCache_";
+    for (auto c : rendererName)
+    {
+        if (std::isalnum(static_cast<unsigned char>(c)))
+            filename += c;
+    }
+    filename += ".bin";
+
+    return filename;
+}
+
+#ifdef LLGL_OS_WIN32
+
+// Advisory inter-process writer lock for the pipeline cache directory (RAII)
+class PipelineCacheFileLock
+{
+
+    public:
+
+        PipelineCacheFileLock(const std::string& cacheFilename)
+        {
+            /* Lock a dedicated lock file, so the cache file itself can still be replaced while the lock is held */
+            auto lockFilename = cacheFilename + ".lock";
+            file_ = CreateFileA(
+                lockFilename.c_str(), (GENERIC_READ | GENERIC_WRITE), (FILE_SHARE_READ | FILE_SHARE_WRITE),
+                nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr
+            );
+            if (file_ != INVALID_HANDLE_VALUE)
+            {
+                OVERLAPPED overlapped = {};
+                locked_ = (LockFileEx(file_, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &overlapped) != FALSE);
+            }
+        }
+
+        ~PipelineCacheFileLock()
+        {
+            if (file_ != INVALID_HANDLE_VALUE)
+            {
+                if (locked_)
+                {
+                    OVERLAPPED overlapped = {};
+                    UnlockFileEx(file_, 0, 1, 0, &overlapped);
+                }
+                CloseHandle(file_);
+            }
+        }
+
+        inline bool IsLocked() const
+        {
+            return locked_;
+        }
+
+    private:
+
+        HANDLE  file_   = INVALID_HANDLE_VALUE;
+        bool    locked_ = false;
+
+};
+
+// Replaces the destination file by the source file in a single atomic step
+static bool RenamePipelineCacheFile(const std::string& srcFilename, const std::string& dstFilename)
+{
+    return (MoveFileExA(srcFilename.c_str(), dstFilename.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE);
+}
+
+#else // LLGL_OS_WIN32
+
+// Advisory inter-process writer lock for the pipeline cache directory (RAII)
+class PipelineCacheFileLock
+{
+
+    public:
+
+        PipelineCacheFileLock(const std::string& cacheFilename)
+        {
+            /* Lock a dedicated lock file, so the cache file itself can still be replaced while the lock is held */
+            auto lockFilename = cacheFilename + ".lock";
+            fd_ = open(lockFilename.c_str(), (O_CREAT | O_RDWR), 0666);
+            if (fd_ >= 0)
+                locked_ = (flock(fd_, LOCK_EX) == 0);
+        }
+
+        ~PipelineCacheFileLock()
+        {
+            if (fd_ >= 0)
+            {
+                if (locked_)
+                    flock(fd_, LOCK_UN);
+                close(fd_);
+            }
+        }
+
+        inline bool IsLocked() const
+        {
+            return locked_;
+        }
+
+    private:
+
+        int     fd_     = -1;
+        bool    locked_ = false;
+
+};
+
+// Replaces the destination file by the source file in a single atomic step
+static bool RenamePipelineCacheFile(const std::string& srcFilename, const std::string& dstFilename)
+{
+    return (std::rename(srcFilename.c_str(), dstFilename.c_str()) == 0);
+}
+
+#endif // /LLGL_OS_WIN32
+
+bool RenderSystem::LoadPipelineCacheFromDirectory(const char* directory)
+{
+    if (directory == nullptr)
+        throw std::invalid_argument("input parameter must not be null: directory");
+
+    /* Read cache file; no lock required, since writers only ever publish complete files */
+    auto filename = GetPipelineCacheFilename(directory, GetName());
+
+    std::ifstream file { filename, (std::ios_base::binary | std::ios_base::ate) };
+    if (!file.good())
+    {
+        /* A missing cache file is the regular cold start case and not an error */
+        return false;
+    }
+
+    std::vector<char> blob(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(blob.data(), static_cast<std::streamsize>(blob.size()));
+
+    if (!file.good() || blob.empty())
+        return false;
+
+    return SetPipelineCacheData(blob.data(), blob.size());
+}
+
+bool RenderSystem::SavePipelineCacheToDirectory(const char* directory) const
+{
+    if (directory == nullptr)
+        throw std::invalid_argument("input parameter must not be null: directory");
+
+    /* Serialize pipeline cache of this render system */
+    auto blob = GetPipelineCacheData();
+    if (blob.empty())
+        return false;
+
+    auto filename = GetPipelineCacheFilename(directory, GetName());
+
+    /* Serialize concurrent writers from other processes with an advisory lock */
+    PipelineCacheFileLock lock { filename };
+    if (!lock.IsLocked())
+        return false;
+
+    /* Write cache blob to temporary file; the fixed temporary name is safe while the lock is held */
+    auto tempFilename = filename + ".tmp";
+    {
+        std::ofstream file { tempFilename, (std::ios_base::out | std::ios_base::binary) };
+        if (!file.good())
+            return false;
+        file.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+        if (!file.good())
+            return false;
+    }
+
+    /* Publish cache file atomically, so concurrent readers never observe a partially written file */
+    if (!RenamePipelineCacheFile(tempFilename, filename))
+    {
+        std::remove(tempFilename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+std::future<GraphicsPipeline*> RenderSystem::CreateGraphicsPipelineAsync(const GraphicsPipelineDescriptor& desc)
+{
+    auto task = std::make_shared<std::packaged_task<GraphicsPipeline*()>>(
+        [this, desc]() -> GraphicsPipeline*
+        {
+            return CreateGraphicsPipeline(desc);
+        }
+    );
+    auto result = task->get_future();
+    SchedulePipelineTask([task]{ (*task)(); });
+    return result;
+}
+
+std::future<ComputePipeline*> RenderSystem::CreateComputePipelineAsync(const ComputePipelineDescriptor& desc)
+{
+    auto task = std::make_shared<std::packaged_task<ComputePipeline*()>>(
+        [this, desc]() -> ComputePipeline*
+        {
+            return CreateComputePipeline(desc);
+        }
+    );
+    auto result = task->get_future();
+    SchedulePipelineTask([task]{ (*task)(); });
+    return result;
+}
+
 
 /*
  * ======= Protected: =======
  */
 
+bool RenderSystem::SupportsConcurrentPipelineCreation() const
+{
+    return false; // dummy
+}
+
+bool RenderSystem::SupportsConcurrentShaderCompilation() const
+{
+    return false; // dummy
+}
+
 void RenderSystem::SetRendererInfo(const RendererInfo& info)
 {
     info_ = info;
@@ -239,6 +795,23 @@ void RenderSystem::SetRendererInfo(const RendererInfo& info)
 void RenderSystem::SetRenderingCaps(const RenderingCapabilities& caps)
 {
     caps_ = caps;
+
+    /* Drop any pending deferred queries, since the capabilities are now complete */
+    queryCapsFeaturesFunc_  = nullptr;
+    queryCapsFormatsFunc_   = nullptr;
+    queryCapsLimitsFunc_    = nullptr;
+
+    UpdateCachedCaps();
+}
+
+void RenderSystem::SetDeferredRenderingCaps(
+    QueryRenderingCapsFunc&& queryFeaturesFunc,
+    QueryRenderingCapsFunc&& queryFormatsFunc,
+    QueryRenderingCapsFunc&& queryLimitsFunc)
+{
+    queryCapsFeaturesFunc_  = std::move(queryFeaturesFunc);
+    queryCapsFormatsFunc_   = std::move(queryFormatsFunc);
+    queryCapsLimitsFunc_    = std::move(queryLimitsFunc);
 }
 
 void RenderSystem::AssertCreateBuffer(const BufferDescriptor& desc, std::uint64_t maxSize)
@@ -327,6 +900,8 @@ void RenderSystem::AssertCreateShaderProgram(const ShaderProgramDescriptor& desc
     AssertShaderType(desc.geometryShader,       "geometryShader",       ShaderType::Geometry,       "Geometry"      );
     AssertShaderType(desc.fragmentShader,       "fragmentShader",       ShaderType::Fragment,       "Fragment"      );
     AssertShaderType(desc.computeShader,        "computeShader",        ShaderType::Compute,        "Compute"       );
+    AssertShaderType(desc.taskShader,           "taskShader",           ShaderType::Task,           "Task"          );
+    AssertShaderType(desc.meshShader,           "meshShader",           ShaderType::Mesh,           "Mesh"          );
 
     if (desc.computeShader != nullptr)
     {
@@ -334,15 +909,32 @@ void RenderSystem::AssertCreateShaderProgram(const ShaderProgramDescriptor& desc
              desc.tessControlShader    != nullptr ||
              desc.tessEvaluationShader != nullptr ||
              desc.geometryShader       != nullptr ||
-             desc.fragmentShader       != nullptr )
+             desc.fragmentShader       != nullptr ||
+             desc.taskShader           != nullptr ||
+             desc.meshShader           != nullptr )
         {
             throw std::invalid_argument(
                 "cannot create shader program with 'computeShader' in conjunction with any other shader"
             );
         }
     }
+    else if (desc.meshShader != nullptr)
+    {
+        if ( desc.vertexShader         != nullptr ||
+             desc.tessControlShader    != nullptr ||
+             desc.tessEvaluationShader != nullptr ||
+             desc.geometryShader       != nullptr )
+        {
+            throw std::invalid_argument(
+                "cannot create shader program with 'meshShader' in conjunction with any vertex input stage shader"
+            );
+        }
+    }
     else
     {
+        if (desc.taskShader != nullptr)
+            throw std::invalid_argument("cannot create shader program with 'taskShader' without mesh shader");
+
         if (desc.vertexShader == nullptr)
             throw std::invalid_argument("cannot create shader program without vertex shader");
 
@@ -412,6 +1004,92 @@ void RenderSystem::AssertImageDataSize(std::size_t dataSize, std::size_t require
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+void RenderSystem::ScheduleWorkerTask(std::function<void()>&& task)
+{
+    /* Create worker thread pool on first use and enqueue task */
+    std::lock_guard<std::mutex> guard { workerThreadsMutex_ };
+    if (!workerThreads_)
+        workerThreads_ = MakeUnique<ThreadPool>();
+    workerThreads_->Enqueue(std::move(task));
+}
+
+void RenderSystem::ResolveDeferredRenderingCaps(QueryRenderingCapsFunc& queryFunc) const
+{
+    if (queryFunc)
+    {
+        /* Invoke pending query and memoize its results by resetting the callback */
+        queryFunc(caps_);
+        queryFunc = nullptr;
+        UpdateCachedCaps();
+    }
+}
+
+void RenderSystem::UpdateCachedCaps() const
+{
+    /* Pack the boolean feature members into the bitset; the order must match the <Feature> enumeration */
+    const auto& features = caps_.features;
+
+    const bool featureValues[] =
+    {
+        features.hasDirectResourceBinding,
+        features.hasRenderTargets,
+        features.has3DTextures,
+        features.hasCubeTextures,
+        features.hasArrayTextures,
+        features.hasCubeArrayTextures,
+        features.hasMultiSampleTextures,
+        features.hasTextureViews,
+        features.hasTextureViewSwizzle,
+        features.hasSparseTextures,
+        features.hasSamplers,
+        features.hasConstantBuffers,
+        features.hasStorageBuffers,
+        features.hasUniforms,
+        features.hasGeometryShaders,
+        features.hasTessellationShaders,
+        features.hasComputeShaders,
+        features.hasInstancing,
+        features.hasOffsetInstancing,
+        features.hasIndirectDrawing,
+        features.hasDrawIndirectCount,
+        features.hasViewportArrays,
+        features.hasConservativeRasterization,
+        features.hasStreamOutputs,
+        features.hasLogicOp,
+        features.hasPipelineStatistics,
+        features.hasRenderCondition,
+        features.hasConcurrentResourceCreation,
+    };
+
+    featureBits_ = 0;
+    for (std::size_t i = 0; i < sizeof(featureValues); ++i)
+    {
+        if (featureValues[i])
+            featureBits_ |= (1ull << i);
+    }
+
+    /* Build flat per-format lookup table from the list of supported texture formats */
+    InitMemory(formatSupport_);
+    for (auto format : caps_.textureFormats)
+        formatSupport_[static_cast<std::size_t>(format)] = true;
+}
+
+void RenderSystem::SchedulePipelineTask(std::function<void()>&& task)
+{
+    if (SupportsConcurrentPipelineCreation())
+        ScheduleWorkerTask(std::move(task));
+    else
+    {
+        /* Concurrent pipeline creation not supported => run task on calling thread */
+        task();
+    }
+}
+
+
 } // /namespace LLGL
 
 
@@ -28,6 +28,33 @@ void RenderingDebugger::SetDebugGroup(const char* name)
     groupName_ = (name != nullptr ? name : "");
 }
 
+void RenderingDebugger::SetSamplingInterval(std::uint32_t interval)
+{
+    samplingInterval_ = interval;
+}
+
+void RenderingDebugger::SetValidationCategories(long categories)
+{
+    validationCategories_ = categories;
+}
+
+void RenderingDebugger::NextFrame()
+{
+    ++frameCounter_;
+
+    /* Reset per frame report throttling */
+    for (auto& callSite : callSites_)
+    {
+        callSite.second.reportedInFrame     = 0;
+        callSite.second.throttleNotified    = false;
+    }
+}
+
+bool RenderingDebugger::IsFrameValidationEnabled() const
+{
+    return (samplingInterval_ > 0 && frameCounter_ % samplingInterval_ == 0);
+}
+
 void RenderingDebugger::PostError(const ErrorType type, const std::string& message)
 {
     auto it = errors_.find(message);
@@ -64,6 +91,35 @@ void RenderingDebugger::PostWarning(const WarningType type, const std::string& m
     }
 }
 
+void RenderingDebugger::SetReportLimit(std::size_t limit)
+{
+    reportLimit_ = limit;
+}
+
+bool RenderingDebugger::AcquireReport()
+{
+    auto& callSite = callSites_[reinterpret_cast<const void*>(source_)];
+    ++callSite.occurrences;
+
+    if (reportLimit_ == 0 || callSite.reportedInFrame < reportLimit_)
+    {
+        ++callSite.reportedInFrame;
+        return true;
+    }
+
+    if (!callSite.throttleNotified)
+    {
+        callSite.throttleNotified = true;
+        Log::PostReport(
+            Log::ReportType::Information,
+            "in '" + std::string(source_) + "': further reports are suppressed until the next frame (" +
+            std::to_string(callSite.occurrences) + " occurrences)"
+        );
+    }
+
+    return false;
+}
+
 
 /*
  * ====== Protected: =======
@@ -7,6 +7,7 @@
 
 #include <LLGL/RenderingProfiler.h>
 #include <algorithm>
+#include <cstdio>
 
 
 namespace LLGL
@@ -28,6 +29,152 @@ void RenderingProfiler::Accumulate(const FrameProfile& profile)
     frameProfile.Accumulate(profile);
 }
 
+const FrameProfileCounters* RenderingProfiler::NextProfileCounters()
+{
+    /* Copy current counters to the completed buffer; flat data block copy without allocation */
+    completedCounters_ = frameProfile;
+
+    /* Clear values */
+    frameProfile.Clear();
+
+    return &completedCounters_;
+}
+
+
+/* ----- Functions ----- */
+
+// Names of all frame profile counter values, in the order of the FrameProfile::values array
+static const char* g_frameProfileValueNames[] =
+{
+    "mipMapsGenerations",
+    "vertexBufferBindings",
+    "indexBufferBindings",
+    "streamOutputBufferBindings",
+    "constantBufferBindings",
+    "sampledBufferBindings",
+    "storageBufferBindings",
+    "sampledTextureBindings",
+    "storageTextureBindings",
+    "samplerBindings",
+    "graphicsResourceHeapBindings",
+    "computeResourceHeapBindings",
+    "graphicsPipelineBindings",
+    "computePipelineBindings",
+    "attachmentClears",
+    "bufferUpdates",
+    "bufferCopies",
+    "bufferWrites",
+    "bufferReads",
+    "bufferMappings",
+    "textureCopies",
+    "textureWrites",
+    "textureReads",
+    "textureMappings",
+    "renderPassSections",
+    "streamOutputSections",
+    "querySections",
+    "renderConditionSections",
+    "drawCommands",
+    "dispatchCommands",
+    "commandBufferSubmittions",
+    "commandBufferEncodings",
+    "fenceSubmissions",
+};
+
+static_assert(
+    sizeof(g_frameProfileValueNames) / sizeof(g_frameProfileValueNames[0]) == sizeof(FrameProfile().values) / sizeof(std::uint32_t),
+    "mismatch between frame profile value names and FrameProfile::values array"
+);
+
+// Writes the specified string as JSON string literal with escaped quotation- and control characters
+static void WriteTraceJSONString(std::ostream& stream, const char* s)
+{
+    stream << '"';
+    for (; *s != '\0'; ++s)
+    {
+        const char c = *s;
+        if (c == '"' || c == '\\')
+            stream << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char escaped[8];
+            ::snprintf(escaped, sizeof(escaped), "\\u%04X", static_cast<unsigned>(static_cast<unsigned char>(c)));
+            stream << escaped;
+        }
+        else
+            stream << c;
+    }
+    stream << '"';
+}
+
+// Writes the specified time value (in nanoseconds) in microseconds, i.e. the timestamp unit of the trace event format
+static void WriteTraceJSONTime(std::ostream& stream, std::uint64_t timeNS)
+{
+    char formatted[32];
+    ::snprintf(
+        formatted,
+        sizeof(formatted),
+        "%llu.%03u",
+        static_cast<unsigned long long>(timeNS / 1000),
+        static_cast<unsigned>(timeNS % 1000)
+    );
+    stream << formatted;
+}
+
+LLGL_EXPORT void WriteProfileTraceJSON(const FrameProfile* frameProfiles, std::size_t numFrameProfiles, std::ostream& stream)
+{
+    stream << "{\n\"traceEvents\": [";
+
+    const char* eventSeparator = "\n";
+
+    /* Write process metadata event */
+    stream << eventSeparator << "{ \"name\": \"process_name\", \"ph\": \"M\", \"pid\": 0, \"args\": { \"name\": \"LLGL\" } }";
+    eventSeparator = ",\n";
+
+    /* Lay frames out back-to-back on a synthetic timeline (in nanoseconds) */
+    std::uint64_t timeCursor = 0;
+
+    for (std::size_t frame = 0; frame < numFrameProfiles; ++frame)
+    {
+        const auto& profile     = frameProfiles[frame];
+        const auto  frameStart  = timeCursor;
+
+        /* Write all GPU time records as duration events with one timeline row per nesting level */
+        for (const auto& record : profile.timeRecords)
+        {
+            stream << eventSeparator << "{ \"name\": ";
+            WriteTraceJSONString(stream, record.annotation.c_str());
+            stream << ", \"ph\": \"X\", \"ts\": ";
+            WriteTraceJSONTime(stream, timeCursor);
+            stream << ", \"dur\": ";
+            WriteTraceJSONTime(stream, record.elapsedTime);
+            stream << ", \"pid\": 0, \"tid\": " << (record.level + 1) << " }";
+
+            timeCursor += record.elapsedTime;
+        }
+
+        /* Write frame marker event; frames without GPU time records get a nominal duration of 1 microsecond */
+        if (timeCursor == frameStart)
+            timeCursor += 1000;
+
+        stream << eventSeparator << "{ \"name\": \"Frame\", \"ph\": \"X\", \"ts\": ";
+        WriteTraceJSONTime(stream, frameStart);
+        stream << ", \"dur\": ";
+        WriteTraceJSONTime(stream, timeCursor - frameStart);
+        stream << ", \"pid\": 0, \"tid\": 0, \"args\": { \"frame\": " << frame << " } }";
+
+        /* Write all counter values as counter events at the start of the frame */
+        for (std::size_t i = 0; i < sizeof(profile.values) / sizeof(profile.values[0]); ++i)
+        {
+            stream << eventSeparator << "{ \"name\": \"" << g_frameProfileValueNames[i] << "\", \"ph\": \"C\", \"ts\": ";
+            WriteTraceJSONTime(stream, frameStart);
+            stream << ", \"pid\": 0, \"args\": { \"value\": " << profile.values[i] << " } }";
+        }
+    }
+
+    stream << "\n],\n\"displayTimeUnit\": \"ms\"\n}\n";
+}
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,80 @@
+/*
+ * SPIRVReflectCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "SPIRVReflectCache.h"
+
+
+namespace LLGL
+{
+
+
+// Fast 64-bit FNV-1a content hash over the module byte code.
+static std::uint64_t HashByteCode(const void* byteCode, std::size_t byteCodeSize)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+    auto bytes = reinterpret_cast<const std::uint8_t*>(byteCode);
+    for (std::size_t i = 0; i < byteCodeSize; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+SPIRVReflectCache& SPIRVReflectCache::Get()
+{
+    static SPIRVReflectCache instance;
+    return instance;
+}
+
+std::shared_ptr<const SPIRVReflect> SPIRVReflectCache::QueryReflection(const void* byteCode, std::size_t byteCodeSize)
+{
+    const auto hash = HashByteCode(byteCode, byteCodeSize);
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    auto it = reflections_.find(hash);
+    if (it == reflections_.end())
+    {
+        /* Copy module byte code first, then parse the copy so the name strings remain valid for the entry's lifetime */
+        auto entry = std::make_shared<ReflectionEntry>();
+        {
+            auto bytes = reinterpret_cast<const char*>(byteCode);
+            entry->moduleData.assign(bytes, bytes + byteCodeSize);
+            entry->reflection.Parse(entry->moduleData.data(), entry->moduleData.size());
+        }
+        it = reflections_.emplace(hash, std::move(entry)).first;
+    }
+
+    /* Return aliasing pointer that shares ownership with the entire cache entry */
+    return std::shared_ptr<const SPIRVReflect>{ it->second, &(it->second->reflection) };
+}
+
+std::shared_ptr<const SPIRVReflectExecutionMode> SPIRVReflectCache::QueryExecutionMode(const void* byteCode, std::size_t byteCodeSize)
+{
+    const auto hash = HashByteCode(byteCode, byteCodeSize);
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    auto it = executionModes_.find(hash);
+    if (it == executionModes_.end())
+    {
+        /* Execution mode reflection only stores plain values, so no copy of the module is required */
+        auto entry = std::make_shared<SPIRVReflectExecutionMode>();
+        entry->Parse(byteCode, byteCodeSize);
+        it = executionModes_.emplace(hash, std::move(entry)).first;
+    }
+
+    return it->second;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
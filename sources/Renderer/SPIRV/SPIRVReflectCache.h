@@ -0,0 +1,77 @@
+/*
+ * SPIRVReflectCache.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_SPIRV_REFLECT_CACHE_H
+#define LLGL_SPIRV_REFLECT_CACHE_H
+
+
+#include "SPIRVReflect.h"
+#include "SPIRVReflectExecutionMode.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Cache of SPIR-V reflection results, keyed by a content hash of the module byte code.
+Shader permutations frequently share the same modules, so repeated shader loads
+can return the previous reflection output instead of walking all instructions again.
+*/
+class SPIRVReflectCache
+{
+
+    public:
+
+        SPIRVReflectCache(const SPIRVReflectCache&) = delete;
+        SPIRVReflectCache& operator = (const SPIRVReflectCache&) = delete;
+
+        // Returns the instance of this singleton class.
+        static SPIRVReflectCache& Get();
+
+        // Returns the reflection of the specified SPIR-V module; the module is only parsed on the first query.
+        std::shared_ptr<const SPIRVReflect> QueryReflection(const void* byteCode, std::size_t byteCodeSize);
+
+        // Returns the execution mode reflection of the specified SPIR-V module; the module is only parsed on the first query.
+        std::shared_ptr<const SPIRVReflectExecutionMode> QueryExecutionMode(const void* byteCode, std::size_t byteCodeSize);
+
+    private:
+
+        SPIRVReflectCache() = default;
+
+    private:
+
+        /*
+        Cache entry that retains a copy of the module byte code,
+        since the reflection data refers to the name strings within the module.
+        */
+        struct ReflectionEntry
+        {
+            std::vector<char>   moduleData;
+            SPIRVReflect        reflection;
+        };
+
+        std::map<std::uint64_t, std::shared_ptr<ReflectionEntry>>               reflections_;
+        std::map<std::uint64_t, std::shared_ptr<SPIRVReflectExecutionMode>>     executionModes_;
+        std::mutex                                                              mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -29,6 +29,8 @@ bool ShaderProgram::ValidateShaderComposition(Shader* const * shaders, std::size
         BitGeom = (1 << static_cast<int>( ShaderType::Geometry       )),
         BitFrag = (1 << static_cast<int>( ShaderType::Fragment       )),
         BitComp = (1 << static_cast<int>( ShaderType::Compute        )),
+        BitTask = (1 << static_cast<int>( ShaderType::Task           )),
+        BitMesh = (1 << static_cast<int>( ShaderType::Mesh           )),
     };
 
     /* Determine which shader types are attached */
@@ -60,6 +62,10 @@ bool ShaderProgram::ValidateShaderComposition(Shader* const * shaders, std::size
         case (BitVert | BitTesc | BitTese |           BitFrag):
         case (BitVert | BitTesc | BitTese | BitGeom | BitFrag):
         case (BitComp):
+        case (BitMesh                    ):
+        case (BitMesh |           BitFrag):
+        case (BitMesh | BitTask          ):
+        case (BitMesh | BitTask | BitFrag):
             return true;
     }
 
@@ -95,134 +95,92 @@ namespace StaticModule
 {
 
 
-std::vector<std::string> GetStaticModules()
+// Descriptor structure for a statically compiled render system module.
+struct StaticModuleDescriptor
 {
-    return
+    int             rendererID;
+    const char*     moduleName;
+    const char*     rendererName;
+    RenderSystem*   (*allocRenderSystemFunc)(const RenderSystemDescriptor*);
+};
+
+// Returns the registry of all statically compiled modules; the registry is built once on first use.
+static const std::vector<StaticModuleDescriptor>& GetStaticModuleRegistry()
+{
+    #define LLGL_STATIC_MODULE_DESC(MODULE) \
+        { MODULE::GetRendererID(), MODULE::GetModuleName(), MODULE::GetRendererName(), MODULE::AllocRenderSystem }
+
+    static const std::vector<StaticModuleDescriptor> registry
     {
         #ifdef LLGL_BUILD_RENDERER_OPENGL
-        ModuleOpenGL::GetModuleName(),
+        LLGL_STATIC_MODULE_DESC(ModuleOpenGL),
         #endif
         #ifdef LLGL_BUILD_RENDERER_OPENGLES3
-        ModuleOpenGLES3::GetModuleName(),
+        LLGL_STATIC_MODULE_DESC(ModuleOpenGLES3),
         #endif
         #ifdef LLGL_BUILD_RENDERER_VULKAN
-        ModuleVulkan::GetModuleName(),
+        LLGL_STATIC_MODULE_DESC(ModuleVulkan),
         #endif
         #ifdef LLGL_BUILD_RENDERER_METAL
-        ModuleMetal::GetModuleName(),
+        LLGL_STATIC_MODULE_DESC(ModuleMetal),
         #endif
         #ifdef LLGL_BUILD_RENDERER_DIRECT3D11
-        ModuleDirect3D11::GetModuleName(),
+        LLGL_STATIC_MODULE_DESC(ModuleDirect3D11),
         #endif
         #ifdef LLGL_BUILD_RENDERER_DIRECT3D12
-        ModuleDirect3D12::GetModuleName(),
+        LLGL_STATIC_MODULE_DESC(ModuleDirect3D12),
         #endif
     };
-}
-
-const char* GetRendererName(const std::string& moduleName)
-{
-    #define LLGL_GET_RENDERER_NAME(MODULE)          \
-        if (moduleName == MODULE::GetModuleName())  \
-            return MODULE::GetRendererName()
-
-    #ifdef LLGL_BUILD_RENDERER_OPENGL
-    LLGL_GET_RENDERER_NAME(ModuleOpenGL);
-    #endif
 
-    #ifdef LLGL_BUILD_RENDERER_OPENGLES3
-    LLGL_GET_RENDERER_NAME(ModuleOpenGLES3);
-    #endif
+    #undef LLGL_STATIC_MODULE_DESC
 
-    #ifdef LLGL_BUILD_RENDERER_VULKAN
-    LLGL_GET_RENDERER_NAME(ModuleVulkan);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_METAL
-    LLGL_GET_RENDERER_NAME(ModuleMetal);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_DIRECT3D11
-    LLGL_GET_RENDERER_NAME(ModuleDirect3D11);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_DIRECT3D12
-    LLGL_GET_RENDERER_NAME(ModuleDirect3D12);
-    #endif
-
-    #undef LLGL_GET_RENDERER_NAME
+    return registry;
+}
 
+// Returns the descriptor of the statically compiled module with the specified name, or null if there is no such module.
+static const StaticModuleDescriptor* FindStaticModule(const std::string& moduleName)
+{
+    for (const auto& desc : GetStaticModuleRegistry())
+    {
+        if (moduleName == desc.moduleName)
+            return &desc;
+    }
     return nullptr;
 }
 
-int GetRendererID(const std::string& moduleName)
+std::vector<std::string> GetStaticModules()
 {
-    #define LLGL_GET_RENDERER_ID(MODULE)            \
-        if (moduleName == MODULE::GetModuleName())  \
-            return MODULE::GetRendererID()
+    std::vector<std::string> moduleNames;
+    moduleNames.reserve(GetStaticModuleRegistry().size());
 
-    #ifdef LLGL_BUILD_RENDERER_OPENGL
-    LLGL_GET_RENDERER_ID(ModuleOpenGL);
-    #endif
+    for (const auto& desc : GetStaticModuleRegistry())
+        moduleNames.push_back(desc.moduleName);
 
-    #ifdef LLGL_BUILD_RENDERER_OPENGLES3
-    LLGL_GET_RENDERER_ID(ModuleOpenGLES3);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_VULKAN
-    LLGL_GET_RENDERER_ID(ModuleVulkan);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_METAL
-    LLGL_GET_RENDERER_ID(ModuleMetal);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_DIRECT3D11
-    LLGL_GET_RENDERER_ID(ModuleDirect3D11);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_DIRECT3D12
-    LLGL_GET_RENDERER_ID(ModuleDirect3D12);
-    #endif
+    return moduleNames;
+}
 
-    #undef LLGL_GET_RENDERER_ID
+const char* GetRendererName(const std::string& moduleName)
+{
+    if (auto desc = FindStaticModule(moduleName))
+        return desc->rendererName;
+    else
+        return nullptr;
+}
 
-    return RendererID::Undefined;
+int GetRendererID(const std::string& moduleName)
+{
+    if (auto desc = FindStaticModule(moduleName))
+        return desc->rendererID;
+    else
+        return RendererID::Undefined;
 }
 
 RenderSystem* AllocRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
 {
-    #define LLGL_ALLOC_RENDER_SYSTEM(MODULE)                        \
-        if (renderSystemDesc.moduleName == MODULE::GetModuleName()) \
-            return MODULE::AllocRenderSystem(&renderSystemDesc)
-
-    #ifdef LLGL_BUILD_RENDERER_OPENGL
-    LLGL_ALLOC_RENDER_SYSTEM(ModuleOpenGL);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_OPENGLES3
-    LLGL_ALLOC_RENDER_SYSTEM(ModuleOpenGLES3);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_VULKAN
-    LLGL_ALLOC_RENDER_SYSTEM(ModuleVulkan);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_METAL
-    LLGL_ALLOC_RENDER_SYSTEM(ModuleMetal);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_DIRECT3D11
-    LLGL_ALLOC_RENDER_SYSTEM(ModuleDirect3D11);
-    #endif
-
-    #ifdef LLGL_BUILD_RENDERER_DIRECT3D12
-    LLGL_ALLOC_RENDER_SYSTEM(ModuleDirect3D12);
-    #endif
-
-    #undef LLGL_ALLOC_RENDER_SYSTEM
-
-    return nullptr;
+    if (auto desc = FindStaticModule(renderSystemDesc.moduleName))
+        return desc->allocRenderSystemFunc(&renderSystemDesc);
+    else
+        return nullptr;
 }
 
 
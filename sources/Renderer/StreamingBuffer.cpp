@@ -0,0 +1,134 @@
+/*
+ * StreamingBuffer.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/StreamingBuffer.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/BufferFlags.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+StreamingBuffer::StreamingBuffer(
+    RenderSystem&       renderSystem,
+    const VertexFormat& vertexFormat,
+    std::uint32_t       numInstancesPerSegment,
+    std::uint32_t       numSegments)
+:
+    renderSystem_           { renderSystem            },
+    stride_                 { vertexFormat.GetStride() },
+    numInstancesPerSegment_ { numInstancesPerSegment  },
+    numSegments_            { numSegments             }
+{
+    if (stride_ == 0)
+        throw std::invalid_argument("cannot create streaming buffer with zero vertex stride");
+    if (numInstancesPerSegment == 0)
+        throw std::invalid_argument("cannot create streaming buffer with zero instances per segment");
+    if (numSegments == 0)
+        throw std::invalid_argument("cannot create streaming buffer with zero segments");
+
+    /* Create ring buffer with persistent mapping (if supported) */
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size             = static_cast<std::uint64_t>(stride_) * numInstancesPerSegment * numSegments;
+        bufferDesc.bindFlags        = BindFlags::VertexBuffer;
+        bufferDesc.cpuAccessFlags   = CPUAccessFlags::Write;
+        bufferDesc.miscFlags        = (MiscFlags::DynamicUsage | MiscFlags::PersistentMapped | MiscFlags::NoInitialData);
+        bufferDesc.vertexAttribs    = vertexFormat.attributes;
+    }
+    buffer_         = renderSystem_.CreateBuffer(bufferDesc);
+    mappedMemory_   = reinterpret_cast<char*>(renderSystem_.GetMappedBufferMemory(*buffer_));
+
+    /* Fall back to an intermediate CPU buffer if persistent mapping is not supported */
+    if (mappedMemory_ == nullptr)
+        intermediateData_.resize(static_cast<std::size_t>(stride_) * numInstancesPerSegment);
+
+    /* Create one fence per segment to guard against overwriting in-flight data */
+    fences_.resize(numSegments);
+    fencesSubmitted_.resize(numSegments, false);
+    for (auto& fence : fences_)
+        fence = renderSystem_.CreateFence();
+}
+
+StreamingBuffer::~StreamingBuffer()
+{
+    for (auto fence : fences_)
+        renderSystem_.Release(*fence);
+    renderSystem_.Release(*buffer_);
+}
+
+void* StreamingBuffer::Allocate(std::uint32_t numInstances, std::uint32_t& firstInstance)
+{
+    if (numInstances > numInstancesPerSegment_)
+        throw std::invalid_argument("allocation exceeds segment capacity of streaming buffer");
+    if (numInstancesUsed_ + numInstances > numInstancesPerSegment_)
+        throw std::runtime_error("streaming buffer segment is exhausted; 'NextSegment' must be called before further allocations");
+
+    /* Return instance offset within the entire ring buffer */
+    firstInstance = segmentIndex_ * numInstancesPerSegment_ + numInstancesUsed_;
+
+    const auto localOffset = static_cast<std::size_t>(stride_) * numInstancesUsed_;
+    numInstancesUsed_ += numInstances;
+
+    if (mappedMemory_ != nullptr)
+    {
+        const auto segmentOffset = static_cast<std::size_t>(stride_) * numInstancesPerSegment_ * segmentIndex_;
+        return (mappedMemory_ + segmentOffset + localOffset);
+    }
+    return (intermediateData_.data() + localOffset);
+}
+
+void StreamingBuffer::Flush()
+{
+    if (numInstancesFlushed_ < numInstancesUsed_)
+    {
+        const auto segmentOffset    = static_cast<std::uint64_t>(stride_) * numInstancesPerSegment_ * segmentIndex_;
+        const auto localOffset      = static_cast<std::uint64_t>(stride_) * numInstancesFlushed_;
+        const auto size             = static_cast<std::uint64_t>(stride_) * (numInstancesUsed_ - numInstancesFlushed_);
+
+        if (mappedMemory_ != nullptr)
+        {
+            /* Make pending range of persistently mapped memory visible to the GPU */
+            renderSystem_.FlushMappedBufferRange(*buffer_, segmentOffset + localOffset, size);
+        }
+        else
+        {
+            /* Upload pending range from the intermediate buffer */
+            renderSystem_.WriteBuffer(*buffer_, segmentOffset + localOffset, intermediateData_.data() + localOffset, size);
+        }
+
+        numInstancesFlushed_ = numInstancesUsed_;
+    }
+}
+
+void StreamingBuffer::NextSegment(CommandQueue& commandQueue)
+{
+    /* Upload outstanding allocations before the segment is handed to the GPU */
+    Flush();
+
+    /* Signal fence of current segment to track when the GPU has finished reading from it */
+    commandQueue.Submit(*fences_[segmentIndex_]);
+    fencesSubmitted_[segmentIndex_] = true;
+
+    /* Advance to next segment and wait until its previous use has completed */
+    segmentIndex_           = (segmentIndex_ + 1) % numSegments_;
+    numInstancesUsed_       = 0;
+    numInstancesFlushed_    = 0;
+
+    if (fencesSubmitted_[segmentIndex_])
+        commandQueue.WaitFence(*fences_[segmentIndex_], ~0ull);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
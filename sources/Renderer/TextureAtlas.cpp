@@ -0,0 +1,183 @@
+/*
+ * TextureAtlas.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/TextureAtlas.h>
+#include <LLGL/RenderSystem.h>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+TextureAtlas::TextureAtlas(
+    RenderSystem&                       renderSystem,
+    const TextureAtlasEntryDescriptor*  entries,
+    std::size_t                         numEntries,
+    const Format                        format,
+    const Extent2D&                     maxLayerExtent)
+:
+    renderSystem_ { renderSystem }
+{
+    /* Validate input parameters */
+    if (entries == nullptr || numEntries == 0)
+        throw std::invalid_argument("cannot create texture atlas without entries");
+    if (IsCompressedFormat(format))
+        throw std::invalid_argument("cannot create texture atlas with compressed format");
+
+    bool uniformExtent = true;
+
+    for (std::size_t i = 0; i < numEntries; ++i)
+    {
+        const auto& extent = entries[i].extent;
+        if (extent.width == 0 || extent.height == 0)
+            throw std::invalid_argument("cannot create texture atlas with entry of zero extent");
+        if (extent.width > maxLayerExtent.width || extent.height > maxLayerExtent.height)
+            throw std::invalid_argument("cannot create texture atlas with entry larger than maximum layer extent");
+        if (extent != entries[0].extent)
+            uniformExtent = false;
+    }
+
+    /* Pack entries into array layers; equally sized entries occupy one layer each */
+    entries_.resize(numEntries);
+
+    if (uniformExtent)
+        PackEntriesIntoLayers(entries, numEntries);
+    else
+        PackEntriesShelfWise(entries, numEntries, maxLayerExtent);
+
+    /* Derive normalized texture coordinates from the packed texel regions */
+    const auto invWidth     = 1.0f / static_cast<float>(layerExtent_.width);
+    const auto invHeight    = 1.0f / static_cast<float>(layerExtent_.height);
+
+    for (auto& entry : entries_)
+    {
+        entry.u0 = static_cast<float>(entry.offset.x) * invWidth;
+        entry.v0 = static_cast<float>(entry.offset.y) * invHeight;
+        entry.u1 = static_cast<float>(entry.offset.x + static_cast<std::int32_t>(entry.extent.width )) * invWidth;
+        entry.v1 = static_cast<float>(entry.offset.y + static_cast<std::int32_t>(entry.extent.height)) * invHeight;
+    }
+
+    /* Create array texture without MIP-maps; the image data is uploaded separately */
+    TextureDescriptor textureDesc;
+    {
+        textureDesc.type        = TextureType::Texture2DArray;
+        textureDesc.bindFlags   = BindFlags::Sampled;
+        textureDesc.miscFlags   = MiscFlags::NoInitialData;
+        textureDesc.format      = format;
+        textureDesc.extent      = Extent3D { layerExtent_.width, layerExtent_.height, 1 };
+        textureDesc.arrayLayers = numArrayLayers_;
+        textureDesc.mipLevels   = 1;
+    }
+    texture_ = renderSystem_.CreateTexture(textureDesc);
+
+    /* Upload all sub-images in one batched staging pass */
+    std::vector<TextureWriteDescriptor> writeDescs(numEntries);
+
+    for (std::size_t i = 0; i < numEntries; ++i)
+    {
+        const auto& entry = entries_[i];
+        writeDescs[i].textureRegion = TextureRegion
+        {
+            TextureSubresource { entry.arrayLayer, 0 },
+            Offset3D { entry.offset.x, entry.offset.y, 0 },
+            Extent3D { entry.extent.width, entry.extent.height, 1 }
+        };
+        writeDescs[i].imageDesc = entries[i].imageDesc;
+    }
+
+    renderSystem_.WriteTextureMulti(*texture_, writeDescs.data(), static_cast<std::uint32_t>(numEntries));
+}
+
+TextureAtlas::~TextureAtlas()
+{
+    renderSystem_.Release(*texture_);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void TextureAtlas::PackEntriesIntoLayers(const TextureAtlasEntryDescriptor* entries, std::size_t numEntries)
+{
+    /* All entries share the same extent, so each entry occupies its own array layer */
+    for (std::size_t i = 0; i < numEntries; ++i)
+    {
+        entries_[i].arrayLayer  = static_cast<std::uint32_t>(i);
+        entries_[i].offset      = Offset2D { 0, 0 };
+        entries_[i].extent      = entries[i].extent;
+    }
+
+    layerExtent_    = entries[0].extent;
+    numArrayLayers_ = static_cast<std::uint32_t>(numEntries);
+}
+
+void TextureAtlas::PackEntriesShelfWise(const TextureAtlasEntryDescriptor* entries, std::size_t numEntries, const Extent2D& maxLayerExtent)
+{
+    /* Sort entry indices by descending height to keep the shelves tightly filled */
+    std::vector<std::size_t> order(numEntries);
+    std::iota(order.begin(), order.end(), std::size_t(0));
+
+    std::stable_sort(
+        order.begin(), order.end(),
+        [entries](std::size_t lhs, std::size_t rhs)
+        {
+            return (entries[lhs].extent.height > entries[rhs].extent.height);
+        }
+    );
+
+    /* Place entries left-to-right into shelves; open a new shelf or layer when the current one is full */
+    std::uint32_t x           = 0, y = 0;
+    std::uint32_t shelfHeight = 0;
+    std::uint32_t layer       = 0;
+    std::uint32_t usedWidth   = 0, usedHeight = 0;
+
+    for (auto i : order)
+    {
+        const auto& extent = entries[i].extent;
+
+        if (x + extent.width > maxLayerExtent.width)
+        {
+            /* Open a new shelf below the current one */
+            x = 0;
+            y += shelfHeight;
+            shelfHeight = 0;
+        }
+
+        if (y + extent.height > maxLayerExtent.height)
+        {
+            /* Open a new array layer */
+            x = 0;
+            y = 0;
+            shelfHeight = 0;
+            ++layer;
+        }
+
+        entries_[i].arrayLayer  = layer;
+        entries_[i].offset      = Offset2D { static_cast<std::int32_t>(x), static_cast<std::int32_t>(y) };
+        entries_[i].extent      = extent;
+
+        x           += extent.width;
+        shelfHeight  = std::max(shelfHeight, extent.height);
+        usedWidth    = std::max(usedWidth, x);
+        usedHeight   = std::max(usedHeight, y + extent.height);
+    }
+
+    /* Shrink the layer extent to the bounding rectangle of the packed sub-images */
+    layerExtent_    = Extent2D { usedWidth, usedHeight };
+    numArrayLayers_ = layer + 1;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
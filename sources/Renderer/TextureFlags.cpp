@@ -45,10 +45,13 @@ std::uint32_t TextureBufferSize(const Format format, std::uint32_t numTexels)
 {
     const auto& formatDesc = GetFormatAttribs(format);
     const auto blockSize = formatDesc.blockWidth * formatDesc.blockHeight;
-    if (blockSize > 0 && numTexels % blockSize == 0)
-        return ((numTexels / blockSize * formatDesc.bitSize) / 8);
-    else
-        return 0;
+    if (blockSize > 0)
+    {
+        /* Round partial blocks up; callers that need per-row block padding must use CalcSubresourceLayout */
+        const auto numBlocks = (numTexels + blockSize - 1) / blockSize;
+        return ((numBlocks * formatDesc.bitSize) / 8);
+    }
+    return 0;
 }
 
 LLGL_EXPORT std::uint32_t TextureSize(const TextureDescriptor& textureDesc)
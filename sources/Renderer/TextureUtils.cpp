@@ -6,12 +6,28 @@
  */
 
 #include "TextureUtils.h"
+#include <string.h>
+
+#if defined _MSC_VER && (defined _M_IX86 || defined _M_X64)
+#   include <xmmintrin.h>
+#endif
 
 
 namespace LLGL
 {
 
 
+// Prefetches the cache line at the specified address for a streaming read (no-op if unsupported).
+static inline void PrefetchReadOnce(const char* addr)
+{
+    #if defined __GNUC__ || defined __clang__
+    __builtin_prefetch(addr, 0, 0);
+    #elif defined _MSC_VER && (defined _M_IX86 || defined _M_X64)
+    _mm_prefetch(addr, _MM_HINT_NTA);
+    #endif
+}
+
+
 LLGL_EXPORT Offset3D CalcTextureOffset(const TextureType type, const Offset3D& offset, std::uint32_t arrayLayer)
 {
     switch (type)
@@ -39,14 +55,81 @@ LLGL_EXPORT SubresourceLayout CalcSubresourceLayout(const Format format, const E
 {
     const auto& formatDesc = GetFormatAttribs(format);
     SubresourceLayout layout;
+    if (formatDesc.blockWidth > 0 && formatDesc.blockHeight > 0)
     {
-        layout.rowStride    = (extent.width * formatDesc.bitSize) / formatDesc.blockWidth / 8;
-        layout.layerStride  = (extent.height * layout.rowStride) / formatDesc.blockHeight;
+        /* Round extent up to a multiple of the compression block size (1x1 for uncompressed formats) */
+        const auto numBlocksX = (extent.width  + formatDesc.blockWidth  - 1) / formatDesc.blockWidth;
+        const auto numBlocksY = (extent.height + formatDesc.blockHeight - 1) / formatDesc.blockHeight;
+
+        layout.rowStride    = (numBlocksX * formatDesc.bitSize) / 8;
+        layout.layerStride  = numBlocksY * layout.rowStride;
         layout.dataSize     = extent.depth * layout.layerStride;
     }
     return layout;
 }
 
+LLGL_EXPORT void BitBlit(
+    const Extent3D& copyExtent,
+    std::uint32_t   bpp,
+    char*           dst,
+    std::uint32_t   dstRowStride,
+    std::uint32_t   dstDepthStride,
+    const char*     src,
+    std::uint32_t   srcRowStride,
+    std::uint32_t   srcDepthStride)
+{
+    const auto copyRowStride    = bpp * copyExtent.width;
+    const auto copyDepthStride  = copyRowStride * copyExtent.height;
+
+    if (srcRowStride == dstRowStride && copyRowStride == dstRowStride)
+    {
+        if (srcDepthStride == dstDepthStride && copyDepthStride == dstDepthStride)
+        {
+            /* Fully contiguous region: copy with a single wide memcpy */
+            ::memcpy(dst, src, static_cast<std::size_t>(copyDepthStride) * copyExtent.depth);
+        }
+        else
+        {
+            /* Rows are contiguous within each slice: copy slice by slice */
+            for (std::uint32_t z = 0; z < copyExtent.depth; ++z)
+            {
+                /* Copy current slice */
+                ::memcpy(dst, src, copyDepthStride);
+
+                /* Move pointers to next slice */
+                dst += dstDepthStride;
+                src += srcDepthStride;
+            }
+        }
+    }
+    else
+    {
+        /* Adjust depth strides to the offset remaining after the row loop */
+        srcDepthStride -= srcRowStride * copyExtent.height;
+        dstDepthStride -= dstRowStride * copyExtent.height;
+
+        /* Copy region row by row */
+        for (std::uint32_t z = 0; z < copyExtent.depth; ++z)
+        {
+            /* Copy current slice */
+            for (std::uint32_t y = 0; y < copyExtent.height; ++y)
+            {
+                /* Copy current row; prefetch the next one, since strided rows defeat the hardware prefetcher */
+                PrefetchReadOnce(src + srcRowStride);
+                ::memcpy(dst, src, copyRowStride);
+
+                /* Move pointers to next row */
+                dst += dstRowStride;
+                src += srcRowStride;
+            }
+
+            /* Move pointers to next slice */
+            dst += dstDepthStride;
+            src += srcDepthStride;
+        }
+    }
+}
+
 LLGL_EXPORT bool MustGenerateMipsOnCreate(const TextureDescriptor& textureDesc)
 {
     return
@@ -38,6 +38,21 @@ LLGL_EXPORT SubresourceLayout CalcSubresourceLayout(const Format format, const E
 // Returns true if the specified flags for texture creation require MIP-map generation at creation time.
 LLGL_EXPORT bool MustGenerateMipsOnCreate(const TextureDescriptor& textureDesc);
 
+/*
+Copies a strided 3D image region between two buffers.
+Contiguous rows and slices are collapsed into wide memcpy calls, so fully packed regions copy at memory bandwidth.
+*/
+LLGL_EXPORT void BitBlit(
+    const Extent3D& copyExtent,
+    std::uint32_t   bpp,
+    char*           dst,
+    std::uint32_t   dstRowStride,
+    std::uint32_t   dstDepthStride,
+    const char*     src,
+    std::uint32_t   srcRowStride,
+    std::uint32_t   srcDepthStride
+);
+
 
 } // /namespace LLGL
 
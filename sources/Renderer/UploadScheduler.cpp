@@ -0,0 +1,251 @@
+/*
+ * UploadScheduler.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/UploadScheduler.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandQueue.h>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+UploadScheduler::UploadScheduler(RenderSystem& renderSystem, std::uint64_t budgetPerFrame) :
+    renderSystem_   { renderSystem   },
+    budgetPerFrame_ { budgetPerFrame }
+{
+    if (budgetPerFrame == 0)
+        throw std::invalid_argument("cannot create upload scheduler with zero byte budget");
+}
+
+UploadScheduler::~UploadScheduler()
+{
+    for (const auto& batch : batchesInFlight_)
+        renderSystem_.Release(*batch.fence);
+    for (auto fence : freeFences_)
+        renderSystem_.Release(*fence);
+}
+
+std::uint64_t UploadScheduler::EnqueueBufferUpload(
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    const void*     data,
+    std::uint64_t   dataSize,
+    std::uint32_t   priority)
+{
+    if (data == nullptr)
+        throw std::invalid_argument("cannot enqueue buffer upload with <data> being a null pointer");
+    if (dataSize == 0)
+        throw std::invalid_argument("cannot enqueue buffer upload with <dataSize> being zero");
+
+    /* Enqueue job with a shadow copy of the source data */
+    UploadJob job;
+    {
+        job.id          = nextJobID_++;
+        job.priority    = priority;
+        job.dstBuffer   = &dstBuffer;
+        job.dstOffset   = dstOffset;
+        job.data.resize(static_cast<std::size_t>(dataSize));
+        std::memcpy(job.data.data(), data, static_cast<std::size_t>(dataSize));
+    }
+    pendingBytes_ += dataSize;
+    pendingJobs_.push_back(std::move(job));
+
+    return pendingJobs_.back().id;
+}
+
+std::uint64_t UploadScheduler::EnqueueTextureUpload(
+    Texture&                    dstTexture,
+    const TextureRegion&        textureRegion,
+    const SrcImageDescriptor&   imageDesc,
+    std::uint32_t               priority)
+{
+    if (imageDesc.data == nullptr)
+        throw std::invalid_argument("cannot enqueue texture upload with image data being a null pointer");
+    if (imageDesc.dataSize == 0)
+        throw std::invalid_argument("cannot enqueue texture upload with image data size being zero");
+
+    /* Enqueue job with a shadow copy of the source image data */
+    UploadJob job;
+    {
+        job.id              = nextJobID_++;
+        job.priority        = priority;
+        job.dstTexture      = &dstTexture;
+        job.textureRegion   = textureRegion;
+        job.imageDesc       = imageDesc;
+        job.data.resize(imageDesc.dataSize);
+        std::memcpy(job.data.data(), imageDesc.data, imageDesc.dataSize);
+    }
+    pendingBytes_ += imageDesc.dataSize;
+    pendingJobs_.push_back(std::move(job));
+
+    return pendingJobs_.back().id;
+}
+
+void UploadScheduler::ProcessFrame(CommandQueue& commandQueue)
+{
+    /* Retire upload batches whose fences have been signaled */
+    RetireSignaledBatches(commandQueue);
+
+    if (pendingJobs_.empty())
+        return;
+
+    /* Sort jobs by descending priority; jobs of equal priority keep their enqueue order */
+    std::stable_sort(
+        pendingJobs_.begin(),
+        pendingJobs_.end(),
+        [](const UploadJob& lhs, const UploadJob& rhs)
+        {
+            return (lhs.priority > rhs.priority);
+        }
+    );
+
+    /* Upload jobs until the byte budget is exhausted; the first job is always taken to guarantee progress */
+    std::vector<std::uint64_t> batchJobIDs;
+    std::uint64_t usedBytes = 0;
+
+    auto it = pendingJobs_.begin();
+    while (it != pendingJobs_.end() && usedBytes < budgetPerFrame_)
+    {
+        const auto jobSize = static_cast<std::uint64_t>(it->data.size());
+        if (usedBytes > 0 && usedBytes + jobSize > budgetPerFrame_)
+        {
+            /* Keep the job for a later frame, but try to fill the remaining budget with smaller jobs */
+            ++it;
+            continue;
+        }
+
+        UploadJobData(*it);
+        batchJobIDs.push_back(it->id);
+
+        usedBytes       += jobSize;
+        pendingBytes_   -= jobSize;
+
+        it = pendingJobs_.erase(it);
+    }
+
+    /* Fence the uploads of this frame */
+    SubmitBatch(commandQueue, std::move(batchJobIDs));
+}
+
+void UploadScheduler::Finish(CommandQueue& commandQueue)
+{
+    /* Upload all pending jobs regardless of the byte budget */
+    if (!pendingJobs_.empty())
+    {
+        std::vector<std::uint64_t> batchJobIDs;
+        batchJobIDs.reserve(pendingJobs_.size());
+
+        for (const auto& job : pendingJobs_)
+        {
+            UploadJobData(job);
+            batchJobIDs.push_back(job.id);
+        }
+
+        pendingJobs_.clear();
+        pendingBytes_ = 0;
+
+        SubmitBatch(commandQueue, std::move(batchJobIDs));
+    }
+
+    /* Block until all upload batches have completed */
+    for (auto& batch : batchesInFlight_)
+    {
+        commandQueue.WaitFence(*batch.fence, ~0ull);
+        freeFences_.push_back(batch.fence);
+    }
+    batchesInFlight_.clear();
+}
+
+bool UploadScheduler::IsCompleted(std::uint64_t jobID) const
+{
+    /* Identifiers that have never been returned by an enqueue function are not completed */
+    if (jobID == 0 || jobID >= nextJobID_)
+        return false;
+
+    /* A job is completed if it is neither pending nor part of an upload batch in flight */
+    for (const auto& job : pendingJobs_)
+    {
+        if (job.id == jobID)
+            return false;
+    }
+
+    for (const auto& batch : batchesInFlight_)
+    {
+        if (std::find(batch.jobIDs.begin(), batch.jobIDs.end(), jobID) != batch.jobIDs.end())
+            return false;
+    }
+
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void UploadScheduler::UploadJobData(const UploadJob& job)
+{
+    if (job.dstBuffer != nullptr)
+        renderSystem_.WriteBuffer(*job.dstBuffer, job.dstOffset, job.data.data(), job.data.size());
+    else
+    {
+        /* Re-point the image descriptor to the shadow copy of the job */
+        auto imageDesc = job.imageDesc;
+        imageDesc.data = job.data.data();
+        renderSystem_.WriteTexture(*job.dstTexture, job.textureRegion, imageDesc);
+    }
+}
+
+void UploadScheduler::SubmitBatch(CommandQueue& commandQueue, std::vector<std::uint64_t>&& jobIDs)
+{
+    if (jobIDs.empty())
+        return;
+
+    /* Acquire a fence from the free list or create a new one */
+    Fence* fence = nullptr;
+    if (!freeFences_.empty())
+    {
+        fence = freeFences_.back();
+        freeFences_.pop_back();
+    }
+    else
+        fence = renderSystem_.CreateFence();
+
+    commandQueue.Submit(*fence);
+
+    UploadBatch batch;
+    {
+        batch.fence     = fence;
+        batch.jobIDs    = std::move(jobIDs);
+    }
+    batchesInFlight_.push_back(std::move(batch));
+}
+
+void UploadScheduler::RetireSignaledBatches(CommandQueue& commandQueue)
+{
+    for (auto it = batchesInFlight_.begin(); it != batchesInFlight_.end();)
+    {
+        if (commandQueue.IsSignaled(*it->fence))
+        {
+            freeFences_.push_back(it->fence);
+            it = batchesInFlight_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,38 @@
+/*
+ * VertexFormatHandle.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/VertexFormatHandle.h>
+#include <LLGL/Format.h>
+#include <stdexcept>
+
+
+namespace LLGL
+{
+
+
+VertexFormatHandle::VertexFormatHandle(const VertexFormat& vertexFormat) :
+    attributes_ { vertexFormat.attributes },
+    stride_     { vertexFormat.GetStride() }
+{
+    if (attributes_.empty())
+        throw std::invalid_argument("cannot create vertex format handle with empty attribute list");
+
+    for (const auto& attrib : attributes_)
+    {
+        if (attrib.stride != stride_)
+            throw std::invalid_argument("cannot create vertex format handle with inconsistent attribute strides");
+        if (attrib.offset + GetFormatAttribs(attrib.format).bitSize / 8 > stride_)
+            throw std::invalid_argument("cannot create vertex format handle with attribute '" + attrib.name + "' exceeding the vertex stride");
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
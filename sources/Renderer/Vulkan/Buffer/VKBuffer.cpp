@@ -66,6 +66,18 @@ VKBuffer::VKBuffer(const VKPtr<VkDevice>& device, const BufferDescriptor& desc)
     bufferObj_.CreateVkBuffer(device, createInfo);
 }
 
+VKBuffer::VKBuffer(const VKPtr<VkDevice>& device, const BufferDescriptor& desc, VkBuffer sharedBuffer, VkDeviceSize sharedOffset) :
+    Buffer            { desc.bindFlags                           },
+    bufferObj_        { device                                   },
+    bufferObjStaging_ { device                                   },
+    size_             { desc.size                                },
+    indexType_        { VKTypes::ToVkIndexType(desc.indexFormat) },
+    sharedVkBuffer_   { sharedBuffer                             },
+    sharedOffset_     { sharedOffset                             }
+{
+    /* Suballocated buffers are merely a range of the shared hardware buffer, so no VkBuffer object is created here */
+}
+
 BufferDescriptor VKBuffer::GetDesc() const
 {
     BufferDescriptor bufferDesc;
@@ -29,6 +29,9 @@ class VKBuffer : public Buffer
 
         VKBuffer(const VKPtr<VkDevice>& device, const BufferDescriptor& desc);
 
+        // Constructor for a buffer that is suballocated as a range of a shared hardware buffer (see MiscFlags::Suballocated).
+        VKBuffer(const VKPtr<VkDevice>& device, const BufferDescriptor& desc, VkBuffer sharedBuffer, VkDeviceSize sharedOffset);
+
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
         void TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer);
 
@@ -47,10 +50,22 @@ class VKBuffer : public Buffer
             return bufferObjStaging_;
         }
 
-        // Returns the hardware buffer object.
+        // Returns the hardware buffer object (for suballocated buffers, this is the shared hardware buffer).
         inline VkBuffer GetVkBuffer() const
         {
-            return bufferObj_.GetVkBuffer();
+            return (sharedVkBuffer_ != VK_NULL_HANDLE ? sharedVkBuffer_ : bufferObj_.GetVkBuffer());
+        }
+
+        // Returns the offset of this buffer within the hardware buffer object (non-zero only for suballocated buffers).
+        inline VkDeviceSize GetOffset() const
+        {
+            return sharedOffset_;
+        }
+
+        // Returns true if this buffer is a suballocated range of a shared hardware buffer.
+        inline bool IsSuballocation() const
+        {
+            return (sharedVkBuffer_ != VK_NULL_HANDLE);
         }
 
         // Returns the hardware staging buffer object.
@@ -77,15 +92,32 @@ class VKBuffer : public Buffer
             return indexType_;
         }
 
+        // Sets the stable pointer of the persistently mapped buffer memory.
+        inline void SetPersistentMappedMemory(void* memory)
+        {
+            persistentMappedMemory_ = memory;
+        }
+
+        // Returns the stable pointer of a persistently mapped buffer, or null if the buffer is not persistently mapped.
+        inline void* GetPersistentMappedMemory() const
+        {
+            return persistentMappedMemory_;
+        }
+
     private:
 
         VKDeviceBuffer  bufferObj_;
         VKDeviceBuffer  bufferObjStaging_;
 
-        VkDeviceSize    size_               = 0;
-        CPUAccess       mappedCPUAccess_    = CPUAccess::ReadOnly;
+        VkDeviceSize    size_                   = 0;
+        CPUAccess       mappedCPUAccess_        = CPUAccess::ReadOnly;
+
+        VkIndexType     indexType_              = VK_INDEX_TYPE_UINT32;
+
+        void*           persistentMappedMemory_ = nullptr;
 
-        VkIndexType     indexType_          = VK_INDEX_TYPE_UINT32;
+        VkBuffer        sharedVkBuffer_         = VK_NULL_HANDLE;
+        VkDeviceSize    sharedOffset_           = 0;
 
 };
 
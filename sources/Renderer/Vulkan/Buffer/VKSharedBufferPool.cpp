@@ -0,0 +1,133 @@
+/*
+ * VKSharedBufferPool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKSharedBufferPool.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../../../Core/Helper.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Offset alignment (in bytes) for suballocations within a shared buffer
+static const VkDeviceSize g_suballocationAlignment = 256;
+
+
+VKSharedBufferPool::VKSharedBufferPool(
+    const VKPtr<VkDevice>&  device,
+    VKDeviceMemoryManager&  deviceMemoryMngr,
+    VkBufferUsageFlags      usageFlags,
+    VkDeviceSize            chunkSize,
+    VkDeviceSize            maxSuballocationSize)
+:
+    device_               { device               },
+    deviceMemoryMngr_     { deviceMemoryMngr     },
+    usageFlags_           { usageFlags           },
+    chunkSize_            { chunkSize            },
+    maxSuballocationSize_ { maxSuballocationSize }
+{
+}
+
+VKSharedBufferPool::~VKSharedBufferPool()
+{
+    /* Release device memory regions of all remaining shared buffer chunks */
+    for (auto& sharedBuffer : sharedBuffers_)
+        sharedBuffer.buffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+}
+
+bool VKSharedBufferPool::Allocate(VkDeviceSize size, VkBuffer& outBuffer, VkDeviceSize& outOffset)
+{
+    if (size == 0 || size > maxSuballocationSize_)
+        return false;
+
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    /* Search for a shared buffer chunk with enough remaining space */
+    SharedBuffer* sharedBuffer = nullptr;
+
+    for (auto& entry : sharedBuffers_)
+    {
+        if (GetAlignedSize(entry.offset, g_suballocationAlignment) + size <= entry.size)
+        {
+            sharedBuffer = &entry;
+            break;
+        }
+    }
+
+    if (sharedBuffer == nullptr)
+        sharedBuffer = AllocChunk(size);
+
+    /* Bump-allocate the range from the shared buffer chunk */
+    outBuffer   = sharedBuffer->buffer.GetVkBuffer();
+    outOffset   = GetAlignedSize(sharedBuffer->offset, g_suballocationAlignment);
+
+    sharedBuffer->offset = outOffset + size;
+    sharedBuffer->numSuballocations++;
+
+    return true;
+}
+
+void VKSharedBufferPool::Release(VkBuffer buffer)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    for (auto it = sharedBuffers_.begin(); it != sharedBuffers_.end(); ++it)
+    {
+        if (it->buffer.GetVkBuffer() == buffer)
+        {
+            /* Release shared buffer chunk once all of its suballocations have been released */
+            if (it->numSuballocations > 0 && --(it->numSuballocations) == 0)
+            {
+                it->buffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+                sharedBuffers_.erase(it);
+            }
+            break;
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKSharedBufferPool::SharedBuffer* VKSharedBufferPool::AllocChunk(VkDeviceSize size)
+{
+    const auto allocationSize = std::max(chunkSize_, size);
+
+    /* Create shared buffer and allocate its device memory */
+    VkBufferCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.size                     = allocationSize;
+        createInfo.usage                    = usageFlags_;
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount    = 0;
+        createInfo.pQueueFamilyIndices      = nullptr;
+    }
+
+    sharedBuffers_.push_back(
+        SharedBuffer
+        {
+            VKDeviceBuffer { device_, createInfo, deviceMemoryMngr_, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT },
+            allocationSize
+        }
+    );
+
+    return &(sharedBuffers_.back());
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,102 @@
+/*
+ * VKSharedBufferPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_SHARED_BUFFER_POOL_H
+#define LLGL_VK_SHARED_BUFFER_POOL_H
+
+
+#include <vulkan/vulkan.h>
+#include "VKDeviceBuffer.h"
+#include "../VKPtr.h"
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryManager;
+
+/*
+Pool of shared device buffers that small logical buffers are suballocated from (see MiscFlags::Suballocated).
+Suballocations are bump-allocated from the current shared buffer chunk;
+a chunk is released back to the device memory manager once all of its suballocations have been released.
+Allocate and Release are synchronized by an internal mutex (see RenderingFeatures::hasConcurrentResourceCreation).
+*/
+class VKSharedBufferPool
+{
+
+    public:
+
+        VKSharedBufferPool(
+            const VKPtr<VkDevice>&  device,
+            VKDeviceMemoryManager&  deviceMemoryMngr,
+            VkBufferUsageFlags      usageFlags,
+            VkDeviceSize            chunkSize               = 4*1024*1024,
+            VkDeviceSize            maxSuballocationSize    = 64*1024
+        );
+
+        VKSharedBufferPool(const VKSharedBufferPool&) = delete;
+        VKSharedBufferPool& operator = (const VKSharedBufferPool&) = delete;
+
+        ~VKSharedBufferPool();
+
+        /*
+        Suballocates a range of the specified size from a shared buffer and returns its buffer handle and offset.
+        Returns false if the size exceeds the maximal suballocation size, in which case the buffer must have its own VkBuffer object.
+        */
+        bool Allocate(VkDeviceSize size, VkBuffer& outBuffer, VkDeviceSize& outOffset);
+
+        // Releases the suballocation of the specified shared buffer; the chunk is released once all its suballocations are gone.
+        void Release(VkBuffer buffer);
+
+    private:
+
+        // Shared buffer chunk that suballocations are bump-allocated from.
+        struct SharedBuffer
+        {
+            inline SharedBuffer(VKDeviceBuffer&& buffer, VkDeviceSize size) :
+                buffer { std::move(buffer) },
+                size   { size              }
+            {
+            }
+
+            VKDeviceBuffer  buffer;
+            VkDeviceSize    size                = 0;
+            VkDeviceSize    offset              = 0;
+            std::uint32_t   numSuballocations   = 0;
+        };
+
+        // Allocates a new shared buffer chunk of at least the specified size.
+        SharedBuffer* AllocChunk(VkDeviceSize size);
+
+    private:
+
+        const VKPtr<VkDevice>&      device_;
+        VKDeviceMemoryManager&      deviceMemoryMngr_;
+
+        VkBufferUsageFlags          usageFlags_             = 0;
+        VkDeviceSize                chunkSize_              = 0;
+        VkDeviceSize                maxSuballocationSize_   = 0;
+
+        std::mutex                  mutex_;
+        std::vector<SharedBuffer>   sharedBuffers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
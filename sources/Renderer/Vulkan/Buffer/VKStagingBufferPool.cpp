@@ -0,0 +1,452 @@
+/*
+ * VKStagingBufferPool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKStagingBufferPool.h"
+#include "../VKCore.h"
+#include "../../../Core/Helper.h"
+#include <limits>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Alignment of the ring write position; must cover the texel alignment that is required for buffer-to-image copies.
+static const VkDeviceSize g_stagingBufferAlignment = 256;
+
+
+VKStagingBufferPool::VKStagingBufferPool(
+    const VKPtr<VkDevice>&                  device,
+    const VkPhysicalDeviceMemoryProperties& memoryProperties,
+    VkCommandPool                           commandPool,
+    VkCommandPool                           acquireCommandPool,
+    std::uint32_t                           transferQueueFamilyIndex,
+    std::uint32_t                           graphicsQueueFamilyIndex,
+    VkDeviceSize                            size) :
+        device_             { device                                         },
+        commandPool_        { commandPool                                    },
+        acquireCommandPool_ { acquireCommandPool                             },
+        transferFamily_     { transferQueueFamilyIndex                       },
+        graphicsFamily_     { graphicsQueueFamilyIndex                       },
+        dedicatedTransfer_  { (acquireCommandPool != VK_NULL_HANDLE &&
+                               transferQueueFamilyIndex != graphicsQueueFamilyIndex) },
+        buffer_             { device, vkDestroyBuffer                        },
+        deviceMemory_       { device, vkFreeMemory                           },
+        size_               { GetAlignedSize(size, g_stagingBufferAlignment) }
+{
+    CreateStagingBufferAndMemory(memoryProperties);
+}
+
+VKStagingBufferPool::~VKStagingBufferPool()
+{
+    /* Wait until all pending batches have completed before their fences are destroyed */
+    while (ReclaimBatch(true))
+    {
+    }
+
+    if (batchRecording_)
+        freeBatches_.push_back(currentBatch_);
+
+    for (const auto& batch : freeBatches_)
+    {
+        vkDestroyFence(device_, batch.fence, nullptr);
+        vkFreeCommandBuffers(device_, commandPool_, 1, &batch.commandBuffer);
+        if (batch.semaphore != VK_NULL_HANDLE)
+            vkDestroySemaphore(device_, batch.semaphore, nullptr);
+        if (batch.acquireCommandBuffer != VK_NULL_HANDLE)
+            vkFreeCommandBuffers(device_, acquireCommandPool_, 1, &batch.acquireCommandBuffer);
+    }
+
+    if (mappedMemory_ != nullptr)
+        vkUnmapMemory(device_, deviceMemory_);
+}
+
+VkCommandBuffer VKStagingBufferPool::Begin(const void* data, VkDeviceSize size, VkBuffer& srcBuffer, VkDeviceSize& srcOffset)
+{
+    if (size > size_)
+        return VK_NULL_HANDLE;
+
+    /* Reclaim the ring space of all batches that have already completed */
+    while (ReclaimBatch(false))
+    {
+    }
+
+    /* Copy data into the ring at the reserved offset */
+    const auto offset = ReserveRange(size);
+    ::memcpy(mappedMemory_ + offset, data, static_cast<std::size_t>(size));
+
+    /* Begin recording the transfer command buffer of the current batch */
+    if (!batchRecording_)
+    {
+        currentBatch_ = NextBatch();
+
+        VkCommandBufferBeginInfo beginInfo;
+        {
+            beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.pNext             = nullptr;
+            beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            beginInfo.pInheritanceInfo  = nullptr;
+        }
+        auto result = vkBeginCommandBuffer(currentBatch_.commandBuffer, &beginInfo);
+        VKThrowIfFailed(result, "failed to begin recording Vulkan staging command buffer");
+
+        batchRecording_ = true;
+    }
+
+    srcBuffer = buffer_.Get();
+    srcOffset = offset;
+
+    return currentBatch_.commandBuffer;
+}
+
+void VKStagingBufferPool::RegisterBufferBarrier(const VkBufferMemoryBarrier& barrier)
+{
+    if (dedicatedTransfer_)
+    {
+        /* Defer barrier until submission; its queue ownership is transferred from the transfer to the graphics family */
+        auto entry = barrier;
+        {
+            entry.srcQueueFamilyIndex = transferFamily_;
+            entry.dstQueueFamilyIndex = graphicsFamily_;
+        }
+        bufferBarriers_.push_back(entry);
+    }
+    /* else: covered by the queue-wide memory barrier that is recorded in 'End' */
+}
+
+void VKStagingBufferPool::RegisterImageBarrier(const VkImageMemoryBarrier& barrier)
+{
+    if (dedicatedTransfer_)
+    {
+        /* Defer barrier until submission; its queue ownership is transferred from the transfer to the graphics family */
+        auto entry = barrier;
+        {
+            entry.srcQueueFamilyIndex = transferFamily_;
+            entry.dstQueueFamilyIndex = graphicsFamily_;
+        }
+        imageBarriers_.push_back(entry);
+    }
+    else if (batchRecording_)
+    {
+        /* Record the layout transition directly into the batch command buffer */
+        vkCmdPipelineBarrier(
+            currentBatch_.commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+            0, nullptr,
+            0, nullptr,
+            1, &barrier
+        );
+    }
+}
+
+void VKStagingBufferPool::End(VkQueue transferQueue, VkQueue graphicsQueue)
+{
+    if (!batchRecording_)
+        return;
+
+    if (dedicatedTransfer_)
+    {
+        /* Release queue ownership of the destination resources on the transfer queue */
+        vkCmdPipelineBarrier(
+            currentBatch_.commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+            0, nullptr,
+            static_cast<std::uint32_t>(bufferBarriers_.size()), bufferBarriers_.data(),
+            static_cast<std::uint32_t>(imageBarriers_.size()), imageBarriers_.data()
+        );
+    }
+    else
+    {
+        /* Make the transfer writes visible to all subsequent commands on the queue */
+        VkMemoryBarrier barrier;
+        {
+            barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.pNext           = nullptr;
+            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask   = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+        }
+        vkCmdPipelineBarrier(
+            currentBatch_.commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+            1, &barrier,
+            0, nullptr,
+            0, nullptr
+        );
+    }
+
+    /* End command buffer recording */
+    auto result = vkEndCommandBuffer(currentBatch_.commandBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan staging command buffer");
+
+    if (dedicatedTransfer_)
+    {
+        /* Submit batch to transfer queue; the batch semaphore links it to the matching acquire submission */
+        VkSubmitInfo submitInfo = {};
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.commandBufferCount   = 1;
+            submitInfo.pCommandBuffers      = (&currentBatch_.commandBuffer);
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores    = (&currentBatch_.semaphore);
+        }
+        {
+            std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(transferQueue) };
+            result = vkQueueSubmit(transferQueue, 1, &submitInfo, VK_NULL_HANDLE);
+        }
+        VKThrowIfFailed(result, "failed to submit Vulkan staging command buffer to transfer queue");
+
+        /* Record the matching acquire barriers for the graphics queue */
+        VkCommandBufferBeginInfo beginInfo;
+        {
+            beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.pNext             = nullptr;
+            beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            beginInfo.pInheritanceInfo  = nullptr;
+        }
+        result = vkBeginCommandBuffer(currentBatch_.acquireCommandBuffer, &beginInfo);
+        VKThrowIfFailed(result, "failed to begin recording Vulkan staging acquire command buffer");
+
+        vkCmdPipelineBarrier(
+            currentBatch_.acquireCommandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, 0,
+            0, nullptr,
+            static_cast<std::uint32_t>(bufferBarriers_.size()), bufferBarriers_.data(),
+            static_cast<std::uint32_t>(imageBarriers_.size()), imageBarriers_.data()
+        );
+
+        result = vkEndCommandBuffer(currentBatch_.acquireCommandBuffer);
+        VKThrowIfFailed(result, "failed to end recording Vulkan staging acquire command buffer");
+
+        /* Submit acquire to graphics queue; the batch fence is signaled after both submissions have completed */
+        const VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+        VkSubmitInfo acquireSubmitInfo = {};
+        {
+            acquireSubmitInfo.sType                 = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            acquireSubmitInfo.waitSemaphoreCount    = 1;
+            acquireSubmitInfo.pWaitSemaphores       = (&currentBatch_.semaphore);
+            acquireSubmitInfo.pWaitDstStageMask     = (&waitDstStageMask);
+            acquireSubmitInfo.commandBufferCount    = 1;
+            acquireSubmitInfo.pCommandBuffers       = (&currentBatch_.acquireCommandBuffer);
+        }
+        {
+            std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(graphicsQueue) };
+            result = vkQueueSubmit(graphicsQueue, 1, &acquireSubmitInfo, currentBatch_.fence);
+        }
+        VKThrowIfFailed(result, "failed to submit Vulkan staging acquire command buffer to graphics queue");
+
+        bufferBarriers_.clear();
+        imageBarriers_.clear();
+    }
+    else
+    {
+        /* Submit batch to queue; completion is tracked by the batch fence instead of a blocking wait */
+        VkSubmitInfo submitInfo = {};
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.commandBufferCount   = 1;
+            submitInfo.pCommandBuffers      = (&currentBatch_.commandBuffer);
+        }
+        {
+            std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(transferQueue) };
+            result = vkQueueSubmit(transferQueue, 1, &submitInfo, currentBatch_.fence);
+        }
+        VKThrowIfFailed(result, "failed to submit Vulkan staging command buffer to queue");
+    }
+
+    /* Track the ring space occupied by this batch until its fence is signaled */
+    currentBatch_.writeEnd  = writePos_;
+    currentBatch_.token     = ++submittedToken_;
+    pendingBatches_.push(currentBatch_);
+
+    batchRecording_ = false;
+}
+
+bool VKStagingBufferPool::IsBatchComplete(std::uint64_t token)
+{
+    while (completedToken_ < token)
+    {
+        if (!ReclaimBatch(false))
+            break;
+    }
+    return (completedToken_ >= token);
+}
+
+void VKStagingBufferPool::WaitForBatch(std::uint64_t token)
+{
+    /* Batches complete in submission order, so waiting for the oldest pending batches suffices */
+    while (completedToken_ < token)
+    {
+        if (!ReclaimBatch(true))
+            break;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKStagingBufferPool::CreateStagingBufferAndMemory(const VkPhysicalDeviceMemoryProperties& memoryProperties)
+{
+    /* Create staging buffer object */
+    VkBufferCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.size                     = size_;
+        createInfo.usage                    = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
+        createInfo.queueFamilyIndexCount    = 0;
+        createInfo.pQueueFamilyIndices      = nullptr;
+    }
+    auto result = vkCreateBuffer(device_, &createInfo, nullptr, buffer_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan staging buffer");
+
+    /* Allocate host-visible device memory; kept outside the device memory manager, since this allocation is persistent */
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device_, buffer_, &requirements);
+
+    VkMemoryAllocateInfo allocInfo;
+    {
+        allocInfo.sType             = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.pNext             = nullptr;
+        allocInfo.allocationSize    = requirements.size;
+        allocInfo.memoryTypeIndex   = VKFindMemoryType(
+            memoryProperties,
+            requirements.memoryTypeBits,
+            (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+        );
+    }
+    result = vkAllocateMemory(device_, &allocInfo, nullptr, deviceMemory_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to allocate device memory for Vulkan staging buffer");
+
+    vkBindBufferMemory(device_, buffer_, deviceMemory_, 0);
+
+    /* Map staging buffer memory persistently */
+    void* memory = nullptr;
+    result = vkMapMemory(device_, deviceMemory_, 0, size_, 0, &memory);
+    VKThrowIfFailed(result, "failed to map device memory for Vulkan staging buffer");
+
+    mappedMemory_ = reinterpret_cast<char*>(memory);
+}
+
+VKStagingBufferPool::Batch VKStagingBufferPool::NextBatch()
+{
+    /* Reuse a batch from the free list */
+    if (!freeBatches_.empty())
+    {
+        auto batch = freeBatches_.back();
+        freeBatches_.pop_back();
+        return batch;
+    }
+
+    /* Allocate a new command buffer and fence pair */
+    Batch batch;
+
+    VkCommandBufferAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.commandPool           = commandPool_;
+        allocInfo.level                 = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount    = 1;
+    }
+    auto result = vkAllocateCommandBuffers(device_, &allocInfo, &batch.commandBuffer);
+    VKThrowIfFailed(result, "failed to allocate Vulkan staging command buffer");
+
+    if (dedicatedTransfer_)
+    {
+        /* Allocate the acquire command buffer from the graphics command pool, and create the semaphore linking the two submissions */
+        allocInfo.commandPool = acquireCommandPool_;
+        result = vkAllocateCommandBuffers(device_, &allocInfo, &batch.acquireCommandBuffer);
+        VKThrowIfFailed(result, "failed to allocate Vulkan staging acquire command buffer");
+
+        VkSemaphoreCreateInfo semaphoreCreateInfo;
+        {
+            semaphoreCreateInfo.sType   = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            semaphoreCreateInfo.pNext   = nullptr;
+            semaphoreCreateInfo.flags   = 0;
+        }
+        result = vkCreateSemaphore(device_, &semaphoreCreateInfo, nullptr, &batch.semaphore);
+        VKThrowIfFailed(result, "failed to create Vulkan semaphore for staging batch");
+    }
+
+    VkFenceCreateInfo fenceCreateInfo;
+    {
+        fenceCreateInfo.sType   = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceCreateInfo.pNext   = nullptr;
+        fenceCreateInfo.flags   = 0;
+    }
+    result = vkCreateFence(device_, &fenceCreateInfo, nullptr, &batch.fence);
+    VKThrowIfFailed(result, "failed to create Vulkan fence for staging batch");
+
+    return batch;
+}
+
+bool VKStagingBufferPool::ReclaimBatch(bool wait)
+{
+    if (pendingBatches_.empty())
+        return false;
+
+    auto& batch = pendingBatches_.front();
+
+    /* Check (or wait for) the batch fence */
+    if (wait)
+    {
+        auto result = vkWaitForFences(device_, 1, &batch.fence, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+        VKThrowIfFailed(result, "failed to wait for Vulkan fence of staging batch");
+    }
+    else if (vkGetFenceStatus(device_, batch.fence) != VK_SUCCESS)
+        return false;
+
+    /* Reclaim ring space and recycle the command buffer and fence pair */
+    reclaimedPos_   = batch.writeEnd;
+    completedToken_ = batch.token;
+
+    vkResetFences(device_, 1, &batch.fence);
+    vkResetCommandBuffer(batch.commandBuffer, 0);
+
+    if (batch.acquireCommandBuffer != VK_NULL_HANDLE)
+        vkResetCommandBuffer(batch.acquireCommandBuffer, 0);
+
+    freeBatches_.push_back(batch);
+    pendingBatches_.pop();
+
+    return true;
+}
+
+VkDeviceSize VKStagingBufferPool::ReserveRange(VkDeviceSize size)
+{
+    /* Align write position, and skip the padding at the end of the ring if the range would wrap around */
+    writePos_ = GetAlignedSize(writePos_, static_cast<std::uint64_t>(g_stagingBufferAlignment));
+
+    const auto wrapOffset = static_cast<VkDeviceSize>(writePos_ % size_);
+    if (wrapOffset + size > size_)
+        writePos_ += (size_ - wrapOffset);
+
+    /* Wait for the oldest pending batches until the ring has enough free space; only happens when the ring is over-committed */
+    while (writePos_ + size > reclaimedPos_ + size_)
+    {
+        if (!ReclaimBatch(true))
+            break;
+    }
+
+    const auto offset = static_cast<VkDeviceSize>(writePos_ % size_);
+    writePos_ += size;
+
+    return offset;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,162 @@
+/*
+ * VKStagingBufferPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_STAGING_BUFFER_POOL_H
+#define LLGL_VK_STAGING_BUFFER_POOL_H
+
+
+#include <vulkan/vulkan.h>
+#include "../VKPtr.h"
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Persistent, persistently-mapped staging buffer ring for data uploads.
+Upload data is copied into the ring at a monotonically increasing write position,
+and the recorded transfer commands are submitted in batches whose completion is tracked by a fence instead of a blocking wait.
+The ring space of a batch is reclaimed once its fence has been signaled,
+so an upload only ever has to wait when the ring is over-committed, i.e. when the GPU falls more than one ring size behind.
+If a dedicated transfer queue family is available, batches are submitted to the transfer queue
+and the queue ownership of the destination resources is transferred to the graphics queue with a matching pair
+of release and acquire barriers, where the acquire commands wait on a per-batch semaphore.
+*/
+class VKStagingBufferPool
+{
+
+    public:
+
+        VKStagingBufferPool(
+            const VKPtr<VkDevice>&                  device,
+            const VkPhysicalDeviceMemoryProperties& memoryProperties,
+            VkCommandPool                           commandPool,
+            VkCommandPool                           acquireCommandPool,
+            std::uint32_t                           transferQueueFamilyIndex,
+            std::uint32_t                           graphicsQueueFamilyIndex,
+            VkDeviceSize                            size
+        );
+
+        ~VKStagingBufferPool();
+
+        VKStagingBufferPool(const VKStagingBufferPool&) = delete;
+        VKStagingBufferPool& operator = (const VKStagingBufferPool&) = delete;
+
+        /*
+        Copies the specified data into the ring and begins recording the transfer command buffer of the current batch.
+        Returns the command buffer to record the transfer commands into,
+        or VK_NULL_HANDLE if the data does not fit into the ring (i.e. 'size' is larger than the ring itself).
+        */
+        VkCommandBuffer Begin(const void* data, VkDeviceSize size, VkBuffer& srcBuffer, VkDeviceSize& srcOffset);
+
+        /*
+        Registers the destination buffer range of the current upload.
+        On a dedicated transfer queue, its ownership is transferred to the graphics queue when the batch is submitted.
+        */
+        void RegisterBufferBarrier(const VkBufferMemoryBarrier& barrier);
+
+        /*
+        Registers the destination image of the current upload, whose layout transition is recorded as specified by the barrier.
+        On a dedicated transfer queue, the transition is combined with the ownership transfer to the graphics queue.
+        */
+        void RegisterImageBarrier(const VkImageMemoryBarrier& barrier);
+
+        /*
+        Ends the current batch and submits its command buffer to the transfer queue without waiting for its completion.
+        On a dedicated transfer queue, the registered release/acquire barriers are submitted to
+        the transfer and graphics queues respectively, linked by the batch semaphore.
+        */
+        void End(VkQueue transferQueue, VkQueue graphicsQueue);
+
+        /*
+        Returns true if the batch with the specified token has completed; reclaims all completed batches on the way.
+        A token of zero denotes "no batch" and is always considered complete.
+        */
+        bool IsBatchComplete(std::uint64_t token);
+
+        // Blocks until the batch with the specified token has completed.
+        void WaitForBatch(std::uint64_t token);
+
+        // Returns the token of the most recently submitted batch; used to poll or wait for its completion.
+        inline std::uint64_t GetLastSubmittedToken() const
+        {
+            return submittedToken_;
+        }
+
+        // Returns the size (in bytes) of the ring, which is also the upper bound for a single upload.
+        inline VkDeviceSize GetSize() const
+        {
+            return size_;
+        }
+
+    private:
+
+        struct Batch
+        {
+            VkCommandBuffer commandBuffer           = VK_NULL_HANDLE;
+            VkCommandBuffer acquireCommandBuffer    = VK_NULL_HANDLE;    // Only used with a dedicated transfer queue
+            VkSemaphore     semaphore               = VK_NULL_HANDLE;    // Only used with a dedicated transfer queue
+            VkFence         fence                   = VK_NULL_HANDLE;
+            std::uint64_t   writeEnd                = 0; // Virtual write position that is reclaimed when the fence is signaled
+            std::uint64_t   token                   = 0; // Monotonically increasing submission token (see GetLastSubmittedToken)
+        };
+
+        // Creates the staging buffer, allocates its host-visible device memory, and maps it persistently.
+        void CreateStagingBufferAndMemory(const VkPhysicalDeviceMemoryProperties& memoryProperties);
+
+        // Takes a batch from the free list or creates a new command buffer and fence pair.
+        Batch NextBatch();
+
+        // Reclaims the ring space of the oldest pending batch; returns false if there is none, or its fence has not been signaled yet (and 'wait' is disabled).
+        bool ReclaimBatch(bool wait);
+
+        // Reserves the specified number of bytes in the ring and returns their buffer offset.
+        VkDeviceSize ReserveRange(VkDeviceSize size);
+
+        const VKPtr<VkDevice>&              device_;
+        VkCommandPool                       commandPool_            = VK_NULL_HANDLE;
+        VkCommandPool                       acquireCommandPool_     = VK_NULL_HANDLE;
+
+        std::uint32_t                       transferFamily_         = 0;
+        std::uint32_t                       graphicsFamily_         = 0;
+        bool                                dedicatedTransfer_      = false;
+
+        VKPtr<VkBuffer>                     buffer_;
+        VKPtr<VkDeviceMemory>               deviceMemory_;
+        VkDeviceSize                        size_                   = 0;
+        char*                               mappedMemory_           = nullptr;
+
+        std::uint64_t                       writePos_               = 0; // Virtual write position (monotonically increasing)
+        std::uint64_t                       reclaimedPos_           = 0; // Virtual write position up to which all batches have completed
+
+        std::uint64_t                       submittedToken_         = 0; // Token of the most recently submitted batch
+        std::uint64_t                       completedToken_         = 0; // Token up to which all batches have completed
+
+        Batch                               currentBatch_;
+        bool                                batchRecording_         = false;
+
+        std::queue<Batch>                   pendingBatches_;
+        std::vector<Batch>                  freeBatches_;
+
+        std::vector<VkBufferMemoryBarrier>  bufferBarriers_;
+        std::vector<VkImageMemoryBarrier>   imageBarriers_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
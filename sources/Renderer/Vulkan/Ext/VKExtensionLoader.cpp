@@ -69,6 +69,20 @@ static bool Load_VK_KHR_win32_surface(VkInstance handle)
 
 #ifdef LLGL_VK_ENABLE_EXT
 
+static bool Load_VK_KHR_get_memory_requirements2(VkDevice handle)
+{
+    LOAD_VKPROC( vkGetBufferMemoryRequirements2KHR );
+    LOAD_VKPROC( vkGetImageMemoryRequirements2KHR  );
+    return true;
+}
+
+static bool Load_VK_KHR_draw_indirect_count(VkDevice handle)
+{
+    LOAD_VKPROC( vkCmdDrawIndirectCountKHR        );
+    LOAD_VKPROC( vkCmdDrawIndexedIndirectCountKHR );
+    return true;
+}
+
 static bool Load_VK_EXT_debug_marker(VkDevice handle)
 {
     LOAD_VKPROC( vkDebugMarkerSetObjectTagEXT  );
@@ -86,6 +100,16 @@ static bool Load_VK_EXT_conditional_rendering(VkDevice handle)
     return true;
 }
 
+#ifdef VK_NV_mesh_shader
+
+static bool Load_VK_NV_mesh_shader(VkDevice handle)
+{
+    LOAD_VKPROC( vkCmdDrawMeshTasksNV );
+    return true;
+}
+
+#endif // /VK_NV_mesh_shader
+
 #endif // /LLGL_VK_ENABLE_EXT
 
 #undef LOAD_VKPROC
@@ -148,10 +172,23 @@ bool VKLoadDeviceExtensions(VkDevice device, const std::vector<const char*>& sup
     #define LOAD_VKEXT(NAME) \
         LoadExtension(VKExt::##NAME, "VK_" #NAME, Load_VK_##NAME)
 
+    /* Khronos extensions */
+    LOAD_VKEXT( KHR_get_memory_requirements2 );
+    LOAD_VKEXT( KHR_draw_indirect_count      );
+
     /* Multi-vendor extensions */
     LOAD_VKEXT( EXT_debug_marker          );
     LOAD_VKEXT( EXT_conditional_rendering );
 
+    /* Vendor specific extensions */
+    #ifdef VK_NV_mesh_shader
+    LOAD_VKEXT( NV_mesh_shader );
+    #endif
+
+    /* Extensions without additional entry points */
+    if (IsSupported(VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME))
+        RegisterExtension(VKExt::KHR_dedicated_allocation);
+
     #undef LOAD_VKEXT
 
     #endif // /LLGL_VK_ENABLE_EXT
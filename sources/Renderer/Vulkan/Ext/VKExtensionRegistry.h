@@ -21,11 +21,17 @@ enum class VKExt
 {
     /* Khronos extensions */
     KHR_maintenance1,
+    KHR_get_memory_requirements2,
+    KHR_dedicated_allocation,
+    KHR_draw_indirect_count,
 
     /* Multivendor extensions */
     EXT_debug_marker,
     EXT_conditional_rendering,
 
+    /* Vendor specific extensions */
+    NV_mesh_shader,
+
     /* Enumeration entry counter */
     Count,
 };
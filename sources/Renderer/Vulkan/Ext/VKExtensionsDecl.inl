@@ -41,6 +41,16 @@ DECL_VKPROC( vkCreateWin32SurfaceKHR );
 
 #ifdef LLGL_VK_ENABLE_EXT
 
+/* VK_KHR_get_memory_requirements2 */
+
+DECL_VKPROC( vkGetBufferMemoryRequirements2KHR );
+DECL_VKPROC( vkGetImageMemoryRequirements2KHR  );
+
+/* VK_KHR_draw_indirect_count */
+
+DECL_VKPROC( vkCmdDrawIndirectCountKHR        );
+DECL_VKPROC( vkCmdDrawIndexedIndirectCountKHR );
+
 /* VK_EXT_debug_marker */
 
 DECL_VKPROC( vkDebugMarkerSetObjectTagEXT  );
@@ -54,6 +64,14 @@ DECL_VKPROC( vkCmdDebugMarkerInsertEXT     );
 DECL_VKPROC( vkCmdBeginConditionalRenderingEXT );
 DECL_VKPROC( vkCmdEndConditionalRenderingEXT   );
 
+/* VK_NV_mesh_shader */
+
+#ifdef VK_NV_mesh_shader
+
+DECL_VKPROC( vkCmdDrawMeshTasksNV );
+
+#endif // /VK_NV_mesh_shader
+
 #endif // /LLGL_VK_ENABLE_EXT
 
 #undef DECL_VKPROC
@@ -14,11 +14,12 @@ namespace LLGL
 {
 
 
-VKDeviceMemory::VKDeviceMemory(const VKPtr<VkDevice>& device, VkDeviceSize size, std::uint32_t memoryTypeIndex) :
-    deviceMemory_    { device, vkFreeMemory },
-    size_            { size                 },
-    memoryTypeIndex_ { memoryTypeIndex      },
-    maxNewBlockSize_ { size                 }
+VKDeviceMemory::VKDeviceMemory(const VKPtr<VkDevice>& device, VkDeviceSize size, std::uint32_t memoryTypeIndex, VkImage dedicatedImage) :
+    deviceMemory_    { device, vkFreeMemory                 },
+    size_            { size                                 },
+    memoryTypeIndex_ { memoryTypeIndex                      },
+    dedicated_       { dedicatedImage != VK_NULL_HANDLE     },
+    maxNewBlockSize_ { size                                 }
 {
     /* Allocate device memory */
     VkMemoryAllocateInfo allocInfo;
@@ -28,6 +29,20 @@ VKDeviceMemory::VKDeviceMemory(const VKPtr<VkDevice>& device, VkDeviceSize size,
         allocInfo.allocationSize    = size;
         allocInfo.memoryTypeIndex   = memoryTypeIndex;
     }
+
+    #ifdef LLGL_VK_ENABLE_EXT
+    /* Dedicate this allocation to the specified image (requires VK_KHR_dedicated_allocation) */
+    VkMemoryDedicatedAllocateInfoKHR dedicatedAllocInfo;
+    if (dedicatedImage != VK_NULL_HANDLE)
+    {
+        dedicatedAllocInfo.sType    = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO_KHR;
+        dedicatedAllocInfo.pNext    = nullptr;
+        dedicatedAllocInfo.image    = dedicatedImage;
+        dedicatedAllocInfo.buffer   = VK_NULL_HANDLE;
+        allocInfo.pNext             = (&dedicatedAllocInfo);
+    }
+    #endif // /LLGL_VK_ENABLE_EXT
+
     auto result = vkAllocateMemory(device, &allocInfo, nullptr, deviceMemory_.ReleaseAndGetAddressOf());
 
     if (result != VK_SUCCESS)
@@ -112,6 +127,25 @@ bool VKDeviceMemory::IsEmpty() const
     return blocks_.empty();
 }
 
+void VKDeviceMemory::Compact()
+{
+    /*
+    Fold all trailing fragmented blocks back into the appendable tail of the chunk:
+    Before: blocks:    [++]....[++++]
+            fragments: ....[++]......[++++++]
+    After:  blocks:    [++]....[++++]
+            fragments: ....[++]
+    */
+    const auto nextOffset = GetNextOffset();
+
+    while (!fragmentedBlocks_.empty() && fragmentedBlocks_.back()->GetOffset() >= nextOffset)
+        fragmentedBlocks_.pop_back();
+
+    /* Restore maximal size for new blocks, since 'Release' only grows the fragmented blocks */
+    maxNewBlockSize_ = GetSize() - nextOffset;
+    UpdateMaxFragmentedBlockSize();
+}
+
 VkDeviceSize VKDeviceMemory::GetMaxAllocationSize() const
 {
     return std::max(maxNewBlockSize_, maxFragmentedBlockSize_);
@@ -126,6 +160,14 @@ void VKDeviceMemory::AccumDetails(VKDeviceMemoryDetails& details) const
     details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFragmentedBlockSize_);
 }
 
+void VKDeviceMemory::AccumBlockSizes(VkDeviceSize& inUseSize, VkDeviceSize& fragmentedSize) const
+{
+    for (const auto& block : blocks_)
+        inUseSize += block->GetSize();
+    for (const auto& block : fragmentedBlocks_)
+        fragmentedSize += block->GetSize();
+}
+
 #ifdef LLGL_DEBUG
 
 /*
@@ -41,7 +41,7 @@ class VKDeviceMemory
 
     public:
 
-        VKDeviceMemory(const VKPtr<VkDevice>& device, VkDeviceSize size, std::uint32_t memoryTypeIndex);
+        VKDeviceMemory(const VKPtr<VkDevice>& device, VkDeviceSize size, std::uint32_t memoryTypeIndex, VkImage dedicatedImage = VK_NULL_HANDLE);
 
         VKDeviceMemory(const VKDeviceMemory&) = delete;
         VKDeviceMemory& operator = (const VKDeviceMemory&) = delete;
@@ -61,12 +61,18 @@ class VKDeviceMemory
         // Returns true if this device memory has no more blocks.
         bool IsEmpty() const;
 
+        // Reclaims the trailing free space of this device memory chunk for new block allocations.
+        void Compact();
+
         // Returns the maximal size that can be allocated for a device memory region within this device memory chunk.
         VkDeviceSize GetMaxAllocationSize() const;
 
         // Accumulates the memory details of this device memory into the output structure.
         void AccumDetails(VKDeviceMemoryDetails& details) const;
 
+        // Accumulates the sizes of all live and fragmented blocks of this device memory chunk into the output parameters.
+        void AccumBlockSizes(VkDeviceSize& inUseSize, VkDeviceSize& fragmentedSize) const;
+
         #ifdef LLGL_DEBUG
 
         void PrintBlocks(std::ostream& s) const;
@@ -92,6 +98,12 @@ class VKDeviceMemory
             return memoryTypeIndex_;
         }
 
+        // Returns true if this device memory chunk was allocated dedicated for a single resource.
+        inline bool IsDedicated() const
+        {
+            return dedicated_;
+        }
+
     private:
 
         // Returns the next offset after the last block.
@@ -130,6 +142,7 @@ class VKDeviceMemory
         VKPtr<VkDeviceMemory>                               deviceMemory_;
         VkDeviceSize                                        size_                   = 0;
         std::uint32_t                                       memoryTypeIndex_        = 0;
+        bool                                                dedicated_              = false;
 
         VkDeviceSize                                        maxNewBlockSize_        = 0;
         std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  blocks_;
@@ -8,6 +8,7 @@
 #include "VKDeviceMemoryManager.h"
 #include "../VKCore.h"
 #include "../../../Core/Helper.h"
+#include <LLGL/Instrumentation.h>
 
 
 namespace LLGL
@@ -29,6 +30,8 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     std::uint32_t           memoryTypeBits,
     VkMemoryPropertyFlags   properties)
 {
+    std::lock_guard<std::mutex> guard { mutex_ };
+
     const auto alignedSize      = GetAlignedSize(size, alignment);
     const auto memoryTypeIndex  = FindMemoryType(memoryTypeBits, properties);
     const auto allocationSize   = std::max(minAllocationSize_, alignedSize);
@@ -51,10 +54,77 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     );
 }
 
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateDedicated(
+    const VkMemoryRequirements& requirements,
+    VkMemoryPropertyFlags       properties,
+    VkImage                     dedicatedImage)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    const auto memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+
+    /* Allocate a chunk that is exclusively owned by the specified image */
+    auto chunk = TakeOwnership(
+        chunks_,
+        MakeUnique<VKDeviceMemory>(device_, requirements.size, memoryTypeIndex, dedicatedImage)
+    );
+
+    /* Notify about the increased device memory usage */
+    if (allocChunkCallback_)
+        allocChunkCallback_(requirements.size, memoryTypeIndex);
+
+    return chunk->Allocate(requirements.size, requirements.alignment);
+}
+
+VKDeviceMemoryRegion* VKDeviceMemoryManager::AllocateTransient(
+    const VkMemoryRequirements& requirements,
+    VkMemoryPropertyFlags       properties)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    const auto memoryTypeIndex = FindMemoryType(requirements.memoryTypeBits, properties);
+
+    /* Search for a transient chunk of the same memory type that is large enough */
+    for (auto& transientMemory : transientMemories_)
+    {
+        auto chunk = transientMemory.chunk.get();
+        if (chunk->GetMemoryTypeIndex() == memoryTypeIndex && chunk->GetSize() >= requirements.size)
+        {
+            /* Place new aliasing region at the beginning of the shared chunk */
+            transientMemory.regions.push_back(
+                MakeUnique<VKDeviceMemoryRegion>(chunk, requirements.size, 0, memoryTypeIndex)
+            );
+            return transientMemory.regions.back().get();
+        }
+    }
+
+    /* Allocate new transient chunk */
+    TransientMemory transientMemory;
+    {
+        transientMemory.chunk = MakeUnique<VKDeviceMemory>(device_, requirements.size, memoryTypeIndex);
+        transientMemory.regions.push_back(
+            MakeUnique<VKDeviceMemoryRegion>(transientMemory.chunk.get(), requirements.size, 0, memoryTypeIndex)
+        );
+    }
+    transientMemories_.push_back(std::move(transientMemory));
+
+    /* Notify about the increased device memory usage */
+    if (allocChunkCallback_)
+        allocChunkCallback_(requirements.size, memoryTypeIndex);
+
+    return transientMemories_.back().regions.back().get();
+}
+
 void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
 {
+    std::lock_guard<std::mutex> guard { mutex_ };
+
     if (region)
     {
+        /* Transient regions bypass the chunk sub-allocation and must be released separately */
+        if (ReleaseTransient(region))
+            return;
+
         if (auto chunk = region->GetParentChunk())
         {
             /* Release block in chunk */
@@ -75,8 +145,40 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
     }
 }
 
+void VKDeviceMemoryManager::SetAllocChunkCallback(const AllocChunkCallback& callback)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+    allocChunkCallback_ = callback;
+}
+
+void VKDeviceMemoryManager::DefragmentMemory(std::size_t maxNumChunks)
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    for (std::size_t i = 0, n = std::min(maxNumChunks, chunks_.size()); i < n; ++i)
+    {
+        /* Continue round-robin where the previous pass stopped */
+        if (defragChunkIndex_ >= chunks_.size())
+            defragChunkIndex_ = 0;
+
+        if (chunks_[defragChunkIndex_]->IsEmpty())
+        {
+            /* Release empty chunk back to the driver */
+            chunks_.erase(chunks_.begin() + defragChunkIndex_);
+        }
+        else
+        {
+            /* Reclaim trailing free space of the chunk */
+            chunks_[defragChunkIndex_]->Compact();
+            ++defragChunkIndex_;
+        }
+    }
+}
+
 VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
 {
+    std::lock_guard<std::mutex> guard { mutex_ };
+
     VKDeviceMemoryDetails details;
     {
         for (const auto& chunk : chunks_)
@@ -85,6 +187,56 @@ VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
     return details;
 }
 
+// Accumulates the statistics of a single chunk into the entry of its memory type.
+static void AccumChunkStats(std::vector<DeviceMemoryStats>& stats, const VKDeviceMemory& chunk)
+{
+    /* Find entry for the memory type of the chunk, or append a new one */
+    DeviceMemoryStats* entry = nullptr;
+
+    for (auto& s : stats)
+    {
+        if (s.memoryType == chunk.GetMemoryTypeIndex())
+        {
+            entry = &s;
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        DeviceMemoryStats s;
+        s.memoryType = chunk.GetMemoryTypeIndex();
+        stats.push_back(s);
+        entry = &(stats.back());
+    }
+
+    /* Accumulate chunk statistics */
+    VkDeviceSize inUseSize = 0, fragmentedSize = 0;
+    chunk.AccumBlockSizes(inUseSize, fragmentedSize);
+
+    entry->numChunks        += 1;
+    entry->allocatedSize    += chunk.GetSize();
+    entry->inUseSize        += inUseSize;
+    entry->fragmentedSize   += fragmentedSize;
+}
+
+std::vector<DeviceMemoryStats> VKDeviceMemoryManager::QueryStats() const
+{
+    std::lock_guard<std::mutex> guard { mutex_ };
+
+    std::vector<DeviceMemoryStats> stats;
+    {
+        for (const auto& chunk : chunks_)
+            AccumChunkStats(stats, *chunk);
+        for (const auto& transientMemory : transientMemories_)
+        {
+            if (transientMemory.chunk)
+                AccumChunkStats(stats, *transientMemory.chunk);
+        }
+    }
+    return stats;
+}
+
 #ifdef LLGL_DEBUG
 
 void VKDeviceMemoryManager::PrintBlocks(std::ostream& s, const std::string& title) const
@@ -123,18 +275,67 @@ std::uint32_t VKDeviceMemoryManager::FindMemoryType(std::uint32_t memoryTypeBits
     return VKFindMemoryType(memoryProperties_, memoryTypeBits, properties);
 }
 
+bool VKDeviceMemoryManager::ReleaseTransient(VKDeviceMemoryRegion* region)
+{
+    for (auto it = transientMemories_.begin(); it != transientMemories_.end(); ++it)
+    {
+        for (auto itRegion = it->regions.begin(); itRegion != it->regions.end(); ++itRegion)
+        {
+            if (itRegion->get() == region)
+            {
+                it->regions.erase(itRegion);
+
+                /* Release transient chunk if it has no more aliasing regions */
+                if (it->regions.empty())
+                    transientMemories_.erase(it);
+
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 VKDeviceMemory* VKDeviceMemoryManager::AllocChunk(VkDeviceSize size, std::uint32_t memoryTypeIndex)
 {
-    return TakeOwnership(chunks_, MakeUnique<VKDeviceMemory>(device_, size, memoryTypeIndex));
+    auto chunk = TakeOwnership(chunks_, MakeUnique<VKDeviceMemory>(device_, size, memoryTypeIndex));
+
+    LLGL_INSTRUMENT_EVENT(MemoryChunkAllocation, "VKDeviceMemoryManager", size);
+
+    /* Notify about the increased device memory usage */
+    if (allocChunkCallback_)
+        allocChunkCallback_(size, memoryTypeIndex);
+
+    return chunk;
 }
 
 VKDeviceMemory* VKDeviceMemoryManager::FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize)
 {
-    /* Search for a suitable chunk */
-    for (const auto& chunk : chunks_)
+    if (reduceFragmentation_)
     {
-        if (chunk->GetMaxAllocationSize() >= minFreeBlockSize && chunk->GetMemoryTypeIndex() == memoryTypeIndex)
-            return chunk.get();
+        /* Search for the densest suitable chunk (best-fit), so that sparse chunks drain empty and can be released by "DefragmentMemory" */
+        VKDeviceMemory* bestChunk = nullptr;
+
+        for (const auto& chunk : chunks_)
+        {
+            if (!chunk->IsDedicated() && chunk->GetMaxAllocationSize() >= minFreeBlockSize && chunk->GetMemoryTypeIndex() == memoryTypeIndex)
+            {
+                if (bestChunk == nullptr || chunk->GetMaxAllocationSize() < bestChunk->GetMaxAllocationSize())
+                    bestChunk = chunk.get();
+            }
+        }
+
+        if (bestChunk != nullptr)
+            return bestChunk;
+    }
+    else
+    {
+        /* Search for first suitable chunk */
+        for (const auto& chunk : chunks_)
+        {
+            if (!chunk->IsDedicated() && chunk->GetMaxAllocationSize() >= minFreeBlockSize && chunk->GetMemoryTypeIndex() == memoryTypeIndex)
+                return chunk.get();
+        }
     }
 
     /* Allocate new chunk */
@@ -10,12 +10,15 @@
 
 
 //#include "../Vulkan.h"
+#include <LLGL/VideoAdapter.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include "VKDeviceMemory.h"
 #include "VKDeviceMemoryRegion.h"
 #include <vector>
 #include <memory>
+#include <functional>
+#include <mutex>
 
 
 namespace LLGL
@@ -27,12 +30,17 @@ Vulkan device memory manager. Memory allocations are stored in a small hierarchy
  - Chunk: denotes a single Vulkan memory allocation of type VkDeviceMemory
  - Block: denotes one of multiple regions inside a chunk of type VkBuffer
  - Region: denotes a sub-range inside a block and holds a reference to the VkBuffer and its offset and size (both of type VkDeviceSize).
+All public functions are synchronized by an internal mutex, so regions can be allocated
+and released from multiple threads (see RenderingFeatures::hasConcurrentResourceCreation).
 */
 class VKDeviceMemoryManager
 {
 
     public:
 
+        // Callback type that is invoked whenever a new VkDeviceMemory chunk has been allocated.
+        using AllocChunkCallback = std::function<void(VkDeviceSize chunkSize, std::uint32_t memoryTypeIndex)>;
+
         VKDeviceMemoryManager(
             const VKPtr<VkDevice>& device,
             const VkPhysicalDeviceMemoryProperties& memoryProperties,
@@ -57,12 +65,48 @@ class VKDeviceMemoryManager
             VkMemoryPropertyFlags       properties
         );
 
+        /*
+        Allocates a device memory chunk that is dedicated to the specified image,
+        bypassing the chunk sub-allocation (requires the VK_KHR_dedicated_allocation extension).
+        If 'dedicatedImage' is null, the chunk is merely allocated exclusively for the returned region, e.g. for persistently mapped buffers.
+        */
+        VKDeviceMemoryRegion* AllocateDedicated(
+            const VkMemoryRequirements& requirements,
+            VkMemoryPropertyFlags       properties,
+            VkImage                     dedicatedImage
+        );
+
+        /*
+        Allocates a new device memory region of transient memory.
+        All transient regions of the same memory type are placed at the beginning of a shared chunk,
+        i.e. their memory aliases, so the contents of one transient resource are discarded when another one is written.
+        */
+        VKDeviceMemoryRegion* AllocateTransient(
+            const VkMemoryRequirements& requirements,
+            VkMemoryPropertyFlags       properties
+        );
+
         // Releases the specified device memory block.
         void Release(VKDeviceMemoryRegion* region);
 
+        /*
+        Runs an incremental defragmentation pass over the device memory chunks:
+        reclaims the trailing free space of each chunk and releases empty chunks back to the driver.
+        At most 'maxNumChunks' chunks are processed per call, continuing round-robin where the previous pass stopped.
+        Note: regions that are still bound to a VkBuffer or VkImage cannot be migrated,
+        since Vulkan does not allow resources to be re-bound to new memory.
+        */
+        void DefragmentMemory(std::size_t maxNumChunks = ~static_cast<std::size_t>(0));
+
+        // Sets the callback that is invoked whenever a new VkDeviceMemory chunk has been allocated (e.g. to check the current memory budget).
+        void SetAllocChunkCallback(const AllocChunkCallback& callback);
+
         // Queries the memory details of all chunks.
         VKDeviceMemoryDetails QueryDetails() const;
 
+        // Queries the allocation statistics of all chunks, grouped by memory type.
+        std::vector<DeviceMemoryStats> QueryStats() const;
+
         #ifdef LLGL_DEBUG
 
         void PrintBlocks(std::ostream& s, const std::string& title = "") const;
@@ -77,9 +121,19 @@ class VKDeviceMemoryManager
 
     private:
 
+        // Shared chunk of transient device memory whose regions all alias at offset zero.
+        struct TransientMemory
+        {
+            std::unique_ptr<VKDeviceMemory>                     chunk;
+            std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  regions;
+        };
+
         // Finds a memory type index for the specified attributes.
         std::uint32_t FindMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
 
+        // Releases the specified region if it belongs to a transient memory chunk, and returns true on success.
+        bool ReleaseTransient(VKDeviceMemoryRegion* region);
+
         // Allocates a new VkDeviceMemory chunk of the specified size and memory type.
         VKDeviceMemory* AllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex);
 
@@ -89,10 +143,17 @@ class VKDeviceMemoryManager
         const VKPtr<VkDevice>&                          device_;
         VkPhysicalDeviceMemoryProperties                memoryProperties_;
 
+        mutable std::mutex                              mutex_;
+
         VkDeviceSize                                    minAllocationSize_      = 1024*1024;
         bool                                            reduceFragmentation_    = false;
 
         std::vector<std::unique_ptr<VKDeviceMemory>>    chunks_;
+        std::size_t                                     defragChunkIndex_       = 0;
+
+        std::vector<TransientMemory>                    transientMemories_;
+
+        AllocChunkCallback                              allocChunkCallback_;
 
 };
 
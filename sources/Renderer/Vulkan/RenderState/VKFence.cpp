@@ -14,7 +14,8 @@ namespace LLGL
 
 
 VKFence::VKFence(const VKPtr<VkDevice>& device) :
-    fence_ { device, vkDestroyFence }
+    fence_     { device, vkDestroyFence     },
+    semaphore_ { device, vkDestroySemaphore }
 {
     VkFenceCreateInfo createInfo;
     {
@@ -24,6 +25,16 @@ VKFence::VKFence(const VKPtr<VkDevice>& device) :
     }
     auto result = vkCreateFence(device, &createInfo, nullptr, fence_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan fence");
+
+    /* Create companion semaphore for cross-queue waits */
+    VkSemaphoreCreateInfo semaphoreCreateInfo;
+    {
+        semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreCreateInfo.pNext = nullptr;
+        semaphoreCreateInfo.flags = 0;
+    }
+    result = vkCreateSemaphore(device, &semaphoreCreateInfo, nullptr, semaphore_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan semaphore for fence");
 }
 
 void VKFence::Reset(VkDevice device)
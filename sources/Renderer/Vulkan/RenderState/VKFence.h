@@ -34,9 +34,29 @@ class VKFence final : public Fence
             return fence_;
         }
 
+        // Returns the native VkSemaphore handle that accompanies the fence for cross-queue waits.
+        inline VkSemaphore GetVkSemaphore() const
+        {
+            return semaphore_;
+        }
+
+        // Returns true if the fence semaphore has been signaled but not yet consumed by a queue wait.
+        inline bool IsSemaphoreSignalPending() const
+        {
+            return semaphoreSignalPending_;
+        }
+
+        // Marks the fence semaphore as signaled (on fence submission) or consumed (on a queue wait).
+        inline void SetSemaphoreSignalPending(bool pending)
+        {
+            semaphoreSignalPending_ = pending;
+        }
+
     private:
 
-        VKPtr<VkFence> fence_;
+        VKPtr<VkFence>      fence_;
+        VKPtr<VkSemaphore>  semaphore_;
+        bool                semaphoreSignalPending_ = false;
 
 };
 
@@ -0,0 +1,190 @@
+/*
+ * VKFramebufferCache.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKFramebufferCache.h"
+#include "../VKCore.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Combines the specified byte range into the hash value (FNV-1a, 64 bit)
+static void HashBytes(std::uint64_t& hash, const void* data, std::size_t size)
+{
+    auto bytes = reinterpret_cast<const std::uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+}
+
+static std::uint64_t HashFramebufferConfig(
+    VkRenderPass        renderPass,
+    const VkImageView*  attachments,
+    std::uint32_t       numAttachments,
+    const VkExtent2D&   extent)
+{
+    std::uint64_t hash = 0xCBF29CE484222325ull;
+
+    HashBytes(hash, &renderPass, sizeof(renderPass));
+    HashBytes(hash, attachments, numAttachments * sizeof(VkImageView));
+    HashBytes(hash, &extent.width, sizeof(extent.width));
+    HashBytes(hash, &extent.height, sizeof(extent.height));
+
+    return hash;
+}
+
+VKFramebufferCache::VKFramebufferCache(const VKPtr<VkDevice>& device) :
+    device_ { device }
+{
+}
+
+VkFramebuffer VKFramebufferCache::GetOrCreateVkFramebuffer(
+    VkRenderPass        renderPass,
+    const VkImageView*  attachments,
+    std::uint32_t       numAttachments,
+    const VkExtent2D&   extent)
+{
+    auto hash = HashFramebufferConfig(renderPass, attachments, numAttachments, extent);
+
+    /* Search cache for an entry with an identical configuration first */
+    for (auto& entry : entries_)
+    {
+        if ( entry.hash       == hash           &&
+             entry.renderPass == renderPass     &&
+             entry.attachments.size() == numAttachments &&
+             std::equal(entry.attachments.begin(), entry.attachments.end(), attachments) &&
+             entry.extent.width  == extent.width &&
+             entry.extent.height == extent.height )
+        {
+            if (entry.refCount == 0)
+                --numUnreferencedEntries_;
+            entry.refCount++;
+            entry.lastUsage = ++usageCounter_;
+            return entry.framebuffer.Get();
+        }
+    }
+
+    /* Create new framebuffer object */
+    VKPtr<VkFramebuffer> framebuffer { device_, vkDestroyFramebuffer };
+
+    VkFramebufferCreateInfo createInfo;
+    {
+        createInfo.sType            = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+        createInfo.pNext            = nullptr;
+        createInfo.flags            = 0;
+        createInfo.renderPass       = renderPass;
+        createInfo.attachmentCount  = numAttachments;
+        createInfo.pAttachments     = attachments;
+        createInfo.width            = extent.width;
+        createInfo.height           = extent.height;
+        createInfo.layers           = 1;
+    }
+    auto result = vkCreateFramebuffer(device_, &createInfo, nullptr, framebuffer.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan framebuffer");
+
+    /* Add new cache entry with an initial reference count of 1 */
+    VKFramebufferCacheEntry entry;
+    {
+        entry.hash          = hash;
+        entry.renderPass    = renderPass;
+        entry.attachments   = std::vector<VkImageView>(attachments, attachments + numAttachments);
+        entry.extent        = extent;
+        entry.framebuffer   = std::move(framebuffer);
+        entry.refCount      = 1;
+        entry.lastUsage     = ++usageCounter_;
+    }
+    entries_.emplace_back(std::move(entry));
+
+    return entries_.back().framebuffer.Get();
+}
+
+void VKFramebufferCache::ReleaseVkFramebuffer(VkFramebuffer framebuffer)
+{
+    for (auto it = entries_.begin(); it != entries_.end(); ++it)
+    {
+        if (it->framebuffer.Get() == framebuffer)
+        {
+            if (--(it->refCount) == 0)
+            {
+                if (it->attachments.empty())
+                {
+                    /* Detached entries can never be shared again; destroy immediately */
+                    entries_.erase(it);
+                }
+                else
+                {
+                    ++numUnreferencedEntries_;
+                    EvictLeastRecentlyUsedEntries();
+                }
+            }
+            break;
+        }
+    }
+}
+
+void VKFramebufferCache::NotifyReleasedImageView(VkImageView imageView)
+{
+    for (auto it = entries_.begin(); it != entries_.end();)
+    {
+        if (std::find(it->attachments.begin(), it->attachments.end(), imageView) != it->attachments.end())
+        {
+            if (it->refCount == 0)
+            {
+                /* Destroy unreferenced entry immediately */
+                --numUnreferencedEntries_;
+                it = entries_.erase(it);
+                continue;
+            }
+            else
+            {
+                /* Detach referenced entry: keep framebuffer alive for its remaining owners, but never share it again */
+                it->attachments.clear();
+            }
+        }
+        ++it;
+    }
+}
+
+void VKFramebufferCache::Clear()
+{
+    entries_.clear();
+    numUnreferencedEntries_ = 0;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VKFramebufferCache::EvictLeastRecentlyUsedEntries()
+{
+    while (numUnreferencedEntries_ > maxUnreferencedEntries)
+    {
+        /* Find unreferenced entry with the oldest usage counter */
+        auto itOldest = entries_.end();
+        for (auto it = entries_.begin(); it != entries_.end(); ++it)
+        {
+            if (it->refCount == 0 && (itOldest == entries_.end() || it->lastUsage < itOldest->lastUsage))
+                itOldest = it;
+        }
+        if (itOldest == entries_.end())
+            break;
+        entries_.erase(itOldest);
+        --numUnreferencedEntries_;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,98 @@
+/*
+ * VKFramebufferCache.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_FRAMEBUFFER_CACHE_H
+#define LLGL_VK_FRAMEBUFFER_CACHE_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Cache of VkFramebuffer objects keyed by render pass, attachment image views, and dimensions.
+Entries are reference counted; unreferenced entries remain cached until they are evicted (least-recently-used),
+so render targets that are recreated with a recurring attachment configuration can reuse their previous framebuffer.
+*/
+class VKFramebufferCache
+{
+
+    public:
+
+        VKFramebufferCache(const VKPtr<VkDevice>& device);
+
+        /*
+        Returns a framebuffer for the specified configuration, either shared from the cache or newly created,
+        and increments its reference count.
+        */
+        VkFramebuffer GetOrCreateVkFramebuffer(
+            VkRenderPass        renderPass,
+            const VkImageView*  attachments,
+            std::uint32_t       numAttachments,
+            const VkExtent2D&   extent
+        );
+
+        /*
+        Decrements the reference count of the specified framebuffer.
+        Unreferenced entries remain cached until they are evicted.
+        */
+        void ReleaseVkFramebuffer(VkFramebuffer framebuffer);
+
+        /*
+        Detaches all entries that reference the specified image view; must be called before the image view is destroyed.
+        Unreferenced entries are destroyed immediately, referenced entries can no longer be shared.
+        */
+        void NotifyReleasedImageView(VkImageView imageView);
+
+        // Releases all cached framebuffers.
+        void Clear();
+
+    private:
+
+        struct VKFramebufferCacheEntry
+        {
+            std::uint64_t               hash;
+            VkRenderPass                renderPass;
+            std::vector<VkImageView>    attachments;    // Empty for detached entries; see NotifyReleasedImageView
+            VkExtent2D                  extent;
+            VKPtr<VkFramebuffer>        framebuffer;
+            long                        refCount;
+            std::uint64_t               lastUsage;
+        };
+
+    private:
+
+        // Destroys the least-recently-used unreferenced entries until the eviction limit is met.
+        void EvictLeastRecentlyUsedEntries();
+
+    private:
+
+        // Maximum number of unreferenced entries that are kept alive for later reuse
+        static const std::size_t                maxUnreferencedEntries = 16;
+
+        const VKPtr<VkDevice>&                  device_;
+        std::vector<VKFramebufferCacheEntry>    entries_;
+        std::size_t                             numUnreferencedEntries_ = 0;
+        std::uint64_t                           usageCounter_           = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -13,6 +13,7 @@
 #include "../VKCore.h"
 #include "../../CheckedCast.h"
 #include "../../StaticLimits.h"
+#include "../../../Core/SmallVector.h"
 #include <cstddef>
 #include <LLGL/GraphicsPipelineFlags.h>
 
@@ -24,6 +25,7 @@ namespace LLGL
 VKGraphicsPipeline::VKGraphicsPipeline(
     const VKPtr<VkDevice>&              device,
     VkPipelineLayout                    defaultPipelineLayout,
+    VkPipelineCache                     pipelineCache,
     const RenderPass*                   defaultRenderPass,
     const GraphicsPipelineDescriptor&   desc,
     const VKGraphicsPipelineLimits&     limits) :
@@ -50,7 +52,7 @@ VKGraphicsPipeline::VKGraphicsPipeline(
     {
         /* Create Vulkan graphics pipeline object */
         auto renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
-        CreateVkGraphicsPipeline(desc, limits, *renderPassVK, nativePipelineLayout);
+        CreateVkGraphicsPipeline(desc, limits, *renderPassVK, nativePipelineLayout, pipelineCache);
     }
     else
         throw std::invalid_argument("cannot create Vulkan graphics pipeline without render pass");
@@ -85,8 +87,8 @@ static void CreateTessellationState(
 static void CreateViewportState(
     const GraphicsPipelineDescriptor&   desc,
     VkPipelineViewportStateCreateInfo&  createInfo,
-    std::vector<VkViewport>&            viewportsVK,
-    std::vector<VkRect2D>&              scissorsVK)
+    SmallVector<VkViewport>&            viewportsVK,
+    SmallVector<VkRect2D>&              scissorsVK)
 {
     const auto numViewports = desc.viewports.size();
     const auto numScissors = desc.scissors.size();
@@ -259,7 +261,7 @@ static void CreateColorBlendAttachmentState(
 static void CreateColorBlendState(
     const BlendDescriptor&                              desc,
     VkPipelineColorBlendStateCreateInfo&                createInfo,
-    std::vector<VkPipelineColorBlendAttachmentState>&   attachmentStatesVK,
+    SmallVector<VkPipelineColorBlendAttachmentState>&   attachmentStatesVK,
     std::uint32_t                                       numColorAttachments)
 {
     numColorAttachments = std::min(numColorAttachments, LLGL_MAX_NUM_COLOR_ATTACHMENTS);
@@ -300,7 +302,7 @@ static void CreateColorBlendState(
 static void CreateDynamicState(
     const GraphicsPipelineDescriptor&   desc,
     VkPipelineDynamicStateCreateInfo&   createInfo,
-    std::vector<VkDynamicState>&        dynamicStatesVK)
+    SmallVector<VkDynamicState>&        dynamicStatesVK)
 {
     if (desc.viewports.empty())
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_VIEWPORT);
@@ -318,7 +320,8 @@ void VKGraphicsPipeline::CreateVkGraphicsPipeline(
     const GraphicsPipelineDescriptor&   desc,
     const VKGraphicsPipelineLimits&     limits,
     const VKRenderPass&                 renderPass,
-    VkPipelineLayout                    pipelineLayout)
+    VkPipelineLayout                    pipelineLayout,
+    VkPipelineCache                     pipelineCache)
 {
     /* Get shader program object */
     auto shaderProgramVK = LLGL_CAST(const VKShaderProgram*, desc.shaderProgram);
@@ -330,9 +333,13 @@ void VKGraphicsPipeline::CreateVkGraphicsPipeline(
     VkPipelineShaderStageCreateInfo shaderStageCreateInfos[5];
     shaderProgramVK->FillShaderStageCreateInfos(shaderStageCreateInfos, shaderStateCount);
 
+    /* Check if the vertex input stages are replaced by a mesh shader */
+    const bool hasMeshShader = shaderProgramVK->HasShaderType(ShaderType::Mesh);
+
     /* Initialize vertex input descriptor */
     VkPipelineVertexInputStateCreateInfo vertexInputCreateInfo;
-    shaderProgramVK->FillVertexInputStateCreateInfo(vertexInputCreateInfo);
+    if (!hasMeshShader)
+        shaderProgramVK->FillVertexInputStateCreateInfo(vertexInputCreateInfo);
 
     /* Initialize input assembly state */
     VkPipelineInputAssemblyStateCreateInfo inputAssembly;
@@ -343,8 +350,8 @@ void VKGraphicsPipeline::CreateVkGraphicsPipeline(
     CreateTessellationState(desc, tessellationState);
 
     /* Initialize viewport state */
-    std::vector<VkViewport> viewportsVK;
-    std::vector<VkRect2D> scissorsVK;
+    SmallVector<VkViewport> viewportsVK;
+    SmallVector<VkRect2D> scissorsVK;
     VkPipelineViewportStateCreateInfo viewportState;
     CreateViewportState(desc, viewportState, viewportsVK, scissorsVK);
 
@@ -361,12 +368,12 @@ void VKGraphicsPipeline::CreateVkGraphicsPipeline(
     CreateDepthStencilState(desc, depthStencilState);
 
     /* Initialize color-blend state */
-    std::vector<VkPipelineColorBlendAttachmentState> attachmentStatesVK;
+    SmallVector<VkPipelineColorBlendAttachmentState> attachmentStatesVK;
     VkPipelineColorBlendStateCreateInfo colorBlendState;
     CreateColorBlendState(desc.blend, colorBlendState, attachmentStatesVK, renderPass.GetNumColorAttachments());
 
     /* Initialize dynamic state */
-    std::vector<VkDynamicState> dynamicStatesVK;
+    SmallVector<VkDynamicState> dynamicStatesVK;
     VkPipelineDynamicStateCreateInfo dynamicState;
     CreateDynamicState(desc, dynamicState, dynamicStatesVK);
 
@@ -378,8 +385,8 @@ void VKGraphicsPipeline::CreateVkGraphicsPipeline(
         createInfo.flags                        = 0;
         createInfo.stageCount                   = shaderStateCount;
         createInfo.pStages                      = shaderStageCreateInfos;
-        createInfo.pVertexInputState            = (&vertexInputCreateInfo);
-        createInfo.pInputAssemblyState          = (&inputAssembly);
+        createInfo.pVertexInputState            = (hasMeshShader ? nullptr : &vertexInputCreateInfo);
+        createInfo.pInputAssemblyState          = (hasMeshShader ? nullptr : &inputAssembly);
         createInfo.pTessellationState           = (inputAssembly.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST ? &tessellationState : nullptr);
         createInfo.pViewportState               = (&viewportState);
         createInfo.pRasterizationState          = (&rasterizerState);
@@ -393,7 +400,7 @@ void VKGraphicsPipeline::CreateVkGraphicsPipeline(
         createInfo.basePipelineHandle           = VK_NULL_HANDLE;
         createInfo.basePipelineIndex            = 0;
     }
-    auto result = vkCreateGraphicsPipelines(device_, VK_NULL_HANDLE, 1, &createInfo, nullptr, pipeline_.ReleaseAndGetAddressOf());
+    auto result = vkCreateGraphicsPipelines(device_, pipelineCache, 1, &createInfo, nullptr, pipeline_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
 }
 
@@ -38,6 +38,7 @@ class VKGraphicsPipeline final : public GraphicsPipeline
         VKGraphicsPipeline(
             const VKPtr<VkDevice>&              device,
             VkPipelineLayout                    defaultPipelineLayout,
+            VkPipelineCache                     pipelineCache,
             const RenderPass*                   defaultRenderPass,
             const GraphicsPipelineDescriptor&   desc,
             const VKGraphicsPipelineLimits&     limits
@@ -67,7 +68,8 @@ class VKGraphicsPipeline final : public GraphicsPipeline
             const GraphicsPipelineDescriptor&   desc,
             const VKGraphicsPipelineLimits&     limits,
             const VKRenderPass&                 renderPass,
-            VkPipelineLayout                    pipelineLayout
+            VkPipelineLayout                    pipelineLayout,
+            VkPipelineCache                     pipelineCache
         );
 
         VkDevice            device_             = VK_NULL_HANDLE;
@@ -8,6 +8,7 @@
 #include "VKPipelineLayout.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -46,9 +47,9 @@ static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
             return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
         case ResourceType::Buffer:
             if ((desc.bindFlags & BindFlags::ConstantBuffer) != 0)
-                return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+                return (desc.dynamicOffset ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
             if ((desc.bindFlags & (BindFlags::Sampled | BindFlags::Storage)) != 0)
-                return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+                return (desc.dynamicOffset ? VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
             break;
         default:
             break;
@@ -123,6 +124,23 @@ VKPipelineLayout::VKPipelineLayout(const VKPtr<VkDevice>& device, const Pipeline
     bindings_.reserve(numBindings);
     for (std::size_t i = 0; i < numBindings; ++i)
         bindings_.push_back({ desc.bindings[i].slot, layoutBindings[i].descriptorType });
+
+    /* Accumulate number of descriptors per type as pool-size heuristic for descriptor pools */
+    for (const auto& layoutBinding : layoutBindings)
+    {
+        auto it = std::find_if(
+            descriptorPoolSizes_.begin(),
+            descriptorPoolSizes_.end(),
+            [&layoutBinding](const VkDescriptorPoolSize& poolSize)
+            {
+                return (poolSize.type == layoutBinding.descriptorType);
+            }
+        );
+        if (it != descriptorPoolSizes_.end())
+            it->descriptorCount += layoutBinding.descriptorCount;
+        else
+            descriptorPoolSizes_.push_back({ layoutBinding.descriptorType, layoutBinding.descriptorCount });
+    }
 }
 
 
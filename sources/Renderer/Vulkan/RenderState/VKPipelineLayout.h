@@ -49,13 +49,20 @@ class VKPipelineLayout final : public PipelineLayout
             return bindings_;
         }
 
+        // Returns the accumulated number of descriptors per type; used as pool-size heuristic for descriptor pools.
+        inline const std::vector<VkDescriptorPoolSize>& GetDescriptorPoolSizes() const
+        {
+            return descriptorPoolSizes_;
+        }
+
     private:
 
-        VkDevice                        device_                 = VK_NULL_HANDLE;
-        VKPtr<VkPipelineLayout>         pipelineLayout_;
-        VKPtr<VkDescriptorSetLayout>    descriptorSetLayout_;
+        VkDevice                            device_                 = VK_NULL_HANDLE;
+        VKPtr<VkPipelineLayout>             pipelineLayout_;
+        VKPtr<VkDescriptorSetLayout>        descriptorSetLayout_;
 
-        std::vector<VKLayoutBinding>    bindings_;
+        std::vector<VKLayoutBinding>        bindings_;
+        std::vector<VkDescriptorPoolSize>   descriptorPoolSizes_;   // Accumulated number of descriptors per type
 
 };
 
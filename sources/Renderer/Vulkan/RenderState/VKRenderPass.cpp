@@ -65,7 +65,7 @@ static VkFormat GetDepthStencilFormat(const Format depthFormat, const Format& st
     return VK_FORMAT_UNDEFINED;
 }
 
-static void Convert(VkAttachmentDescription& dst, const AttachmentFormatDescriptor& srcDepth, const AttachmentFormatDescriptor& srcStencil)
+static void Convert(VkAttachmentDescription& dst, const AttachmentFormatDescriptor& srcDepth, const AttachmentFormatDescriptor& srcStencil, bool readOnly)
 {
     dst.flags           = 0;
     dst.format          = GetDepthStencilFormat(srcDepth.format, srcStencil.format);
@@ -74,8 +74,18 @@ static void Convert(VkAttachmentDescription& dst, const AttachmentFormatDescript
     dst.storeOp         = VKTypes::Map(srcDepth.storeOp);
     dst.stencilLoadOp   = VKTypes::Map(srcStencil.loadOp);
     dst.stencilStoreOp  = VKTypes::Map(srcStencil.storeOp);
-    dst.initialLayout   = VK_IMAGE_LAYOUT_UNDEFINED;
-    dst.finalLayout     = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+
+    if (readOnly)
+    {
+        /* Keep the attachment in the read-only layout, so it can be sampled simultaneously; its content must be preserved */
+        dst.initialLayout   = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+        dst.finalLayout     = VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
+    }
+    else
+    {
+        dst.initialLayout   = VK_IMAGE_LAYOUT_UNDEFINED;
+        dst.finalLayout     = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    }
 }
 
 void VKRenderPass::CreateVkRenderPass(VkDevice device, const RenderPassDescriptor& desc)
@@ -103,17 +113,18 @@ void VKRenderPass::CreateVkRenderPass(VkDevice device, const RenderPassDescripto
         Convert(attachmentDescs[i], desc.colorAttachments[i]);
 
     if (hasDepthStencil)
-        Convert(attachmentDescs[numColorAttachments], desc.depthAttachment, desc.stencilAttachment);
+        Convert(attachmentDescs[numColorAttachments], desc.depthAttachment, desc.stencilAttachment, desc.readOnlyDepthStencil);
 
     /* Create render pass with native attachment descriptors */
-    CreateVkRenderPassWithDescriptors(device, numAttachments, numColorAttachments, attachmentDescs.data());
+    CreateVkRenderPassWithDescriptors(device, numAttachments, numColorAttachments, attachmentDescs.data(), desc.readOnlyDepthStencil);
 }
 
 void VKRenderPass::CreateVkRenderPassWithDescriptors(
     VkDevice                        device,
     std::uint32_t                   numAttachments,
     std::uint32_t                   numColorAttachments,
-    const VkAttachmentDescription*  attachmentDescs)
+    const VkAttachmentDescription*  attachmentDescs,
+    bool                            readOnlyDepthStencil)
 {
     std::vector<VkAttachmentReference> attachmentsRefs(numAttachments);
 
@@ -153,7 +164,12 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         auto& attachmentRef = attachmentsRefs.back();
         {
             attachmentRef.attachment    = depthStencilIndex_;
-            attachmentRef.layout        = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+            attachmentRef.layout        =
+            (
+                readOnlyDepthStencil
+                    ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL
+                    : VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+            );
         }
     }
 
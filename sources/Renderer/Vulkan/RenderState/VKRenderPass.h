@@ -39,7 +39,8 @@ class VKRenderPass final : public RenderPass
             VkDevice                        device,
             std::uint32_t                   numAttachments,
             std::uint32_t                   numColorAttachments,
-            const VkAttachmentDescription*  attachmentDescs
+            const VkAttachmentDescription*  attachmentDescs,
+            bool                            readOnlyDepthStencil = false
         );
 
         // Returns the Vulkan render pass object.
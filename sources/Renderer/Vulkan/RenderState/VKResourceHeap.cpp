@@ -15,6 +15,7 @@
 #include "../VKContainers.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Helper.h"
+#include "../../../Core/SmallVector.h"
 #include <map>
 
 
@@ -33,11 +34,13 @@ VKResourceHeap::VKResourceHeap(const VKPtr<VkDevice>& device, const ResourceHeap
 
     pipelineLayout_ = pipelineLayoutVK->GetVkPipelineLayout();
 
-    /* Validate binding descriptors */
+    /* Validate binding descriptors; keep a copy of the bindings for in-place descriptor updates */
     const auto& bindings = pipelineLayoutVK->GetBindings();
     if (desc.resourceViews.size() != bindings.size())
         throw std::invalid_argument("failed to create resource vied heap due to mismatch between number of resources and bindings");
 
+    bindings_ = bindings;
+
     /* Create resource descriptor pool */
     CreateDescriptorPool(desc, bindings);
 
@@ -58,6 +61,29 @@ VKResourceHeap::~VKResourceHeap()
     #endif
 }
 
+void VKResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews)
+{
+    /* Validate descriptor range */
+    if (firstDescriptor + numResourceViews > bindings_.size())
+        throw std::invalid_argument("failed to update resource heap due to out-of-bounds descriptor range");
+
+    /* Fill write descriptors for the specified range and update the descriptor set in place */
+    VKWriteDescriptorContainer container{ numResourceViews };
+
+    FillWriteDescriptors(firstDescriptor, numResourceViews, resourceViews, container);
+
+    if (container.numWriteDescriptors > 0)
+    {
+        vkUpdateDescriptorSets(
+            device_,
+            container.numWriteDescriptors,
+            container.writeDescriptors.data(),
+            0,
+            nullptr
+        );
+    }
+}
+
 
 /*
  * ======= Private: =======
@@ -65,8 +91,8 @@ VKResourceHeap::~VKResourceHeap()
 
 static std::uint32_t AccumDescriptorPoolSizes(
     VkDescriptorType type,
-    std::vector<VkDescriptorPoolSize>::iterator it,
-    std::vector<VkDescriptorPoolSize>::iterator itEnd)
+    SmallVector<VkDescriptorPoolSize>::iterator it,
+    SmallVector<VkDescriptorPoolSize>::iterator itEnd)
 {
     std::uint32_t descriptorCount = it->descriptorCount;
 
@@ -82,7 +108,7 @@ static std::uint32_t AccumDescriptorPoolSizes(
     return descriptorCount;
 }
 
-static void CompressDescriptorPoolSizes(std::vector<VkDescriptorPoolSize>& poolSizes)
+static void CompressDescriptorPoolSizes(SmallVector<VkDescriptorPoolSize>& poolSizes)
 {
     /* Accumulate all descriptors of the same type */
     for (auto it = poolSizes.begin(); it != poolSizes.end(); ++it)
@@ -101,7 +127,7 @@ static void CompressDescriptorPoolSizes(std::vector<VkDescriptorPoolSize>& poolS
 void VKResourceHeap::CreateDescriptorPool(const ResourceHeapDescriptor& desc, const std::vector<VKLayoutBinding>& bindings)
 {
     /* Initialize descriptor pool sizes */
-    std::vector<VkDescriptorPoolSize> poolSizes(desc.resourceViews.size());
+    SmallVector<VkDescriptorPoolSize> poolSizes(desc.resourceViews.size());
     for (std::size_t i = 0; i < desc.resourceViews.size(); ++i)
     {
         poolSizes[i].type               = bindings[i].descriptorType;
@@ -149,46 +175,57 @@ void VKResourceHeap::UpdateDescriptorSets(const ResourceHeapDescriptor& desc, co
 
     VKWriteDescriptorContainer container{ numResourceViewsMax };
 
-    for (std::size_t i = 0; i < numResourceViewsMax; ++i)
+    FillWriteDescriptors(0, static_cast<std::uint32_t>(numResourceViewsMax), desc.resourceViews.data(), container);
+
+    if (container.numWriteDescriptors > 0)
+    {
+        vkUpdateDescriptorSets(
+            device_,
+            container.numWriteDescriptors,
+            container.writeDescriptors.data(),
+            0,
+            nullptr
+        );
+    }
+}
+
+void VKResourceHeap::FillWriteDescriptors(
+    std::uint32_t                   firstDescriptor,
+    std::uint32_t                   numResourceViews,
+    const ResourceViewDescriptor*   resourceViews,
+    VKWriteDescriptorContainer&     container)
+{
+    for (std::uint32_t i = 0; i < numResourceViews; ++i)
     {
         /* Get resource view information */
-        const auto& rvDesc = desc.resourceViews[i];
-        auto descriptorType = bindings[i].descriptorType;
+        const auto& rvDesc = resourceViews[i];
+        const auto& binding = bindings_[firstDescriptor + i];
 
-        switch (descriptorType)
+        switch (binding.descriptorType)
         {
             case VK_DESCRIPTOR_TYPE_SAMPLER:
-                FillWriteDescriptorForSampler(rvDesc, bindings[i], container);
+                FillWriteDescriptorForSampler(rvDesc, binding, container);
                 break;
 
             case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
-                FillWriteDescriptorForTexture(rvDesc, bindings[i], container);
+                FillWriteDescriptorForTexture(rvDesc, binding, container);
                 break;
 
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-                FillWriteDescriptorForBuffer(rvDesc, bindings[i], container);
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                FillWriteDescriptorForBuffer(rvDesc, binding, container);
                 break;
 
             default:
                 throw std::invalid_argument(
                     "invalid descriptor type to create ResourceHeap object: 0x" +
-                    ToHex(static_cast<std::uint32_t>(descriptorType))
+                    ToHex(static_cast<std::uint32_t>(binding.descriptorType))
                 );
                 break;
         }
     }
-
-    if (container.numWriteDescriptors > 0)
-    {
-        vkUpdateDescriptorSets(
-            device_,
-            container.numWriteDescriptors,
-            container.writeDescriptors.data(),
-            0,
-            nullptr
-        );
-    }
 }
 
 void VKResourceHeap::FillWriteDescriptorForSampler(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container)
@@ -31,6 +31,9 @@ class VKResourceHeap final : public ResourceHeap
         VKResourceHeap(const VKPtr<VkDevice>& device, const ResourceHeapDescriptor& desc);
         ~VKResourceHeap();
 
+        // Updates the specified range of resource views in place via vkUpdateDescriptorSets.
+        void WriteResourceViews(std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews);
+
         inline VkPipelineLayout GetVkPipelineLayout() const
         {
             return pipelineLayout_;
@@ -52,6 +55,8 @@ class VKResourceHeap final : public ResourceHeap
         void CreateDescriptorSets(std::uint32_t numSetLayouts, const VkDescriptorSetLayout* setLayouts);
         void UpdateDescriptorSets(const ResourceHeapDescriptor& desc, const std::vector<VKLayoutBinding>& bindings);
 
+        void FillWriteDescriptors(std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews, VKWriteDescriptorContainer& container);
+
         void FillWriteDescriptorForSampler(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container);
         void FillWriteDescriptorForTexture(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container);
         void FillWriteDescriptorForBuffer(const ResourceViewDescriptor& resourceViewDesc, const VKLayoutBinding& binding, VKWriteDescriptorContainer& container);
@@ -62,6 +67,7 @@ class VKResourceHeap final : public ResourceHeap
         VkPipelineLayout                pipelineLayout_ = VK_NULL_HANDLE;
         VKPtr<VkDescriptorPool>         descriptorPool_;
         std::vector<VkDescriptorSet>    descriptorSets_;
+        std::vector<VKLayoutBinding>    bindings_;          // Copy of the layout bindings; kept for in-place descriptor updates
 
 };
 
@@ -0,0 +1,144 @@
+/*
+ * VKTransientDescriptorPool.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKTransientDescriptorPool.h"
+#include "../VKCore.h"
+#include "../../../Core/SmallVector.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKTransientDescriptorPool::VKTransientDescriptorPool(const VKPtr<VkDevice>& device) :
+    device_ { device }
+{
+}
+
+void VKTransientDescriptorPool::RegisterLayoutDemand(const std::vector<VkDescriptorPoolSize>& poolSizes)
+{
+    /* Track the maximal per-set demand of each descriptor type; only affects pools created afterwards */
+    for (const auto& poolSize : poolSizes)
+    {
+        auto typeIdx = static_cast<std::uint32_t>(poolSize.type);
+        if (typeIdx < numDescriptorTypes)
+            demands_[typeIdx] = std::max(demands_[typeIdx], poolSize.descriptorCount);
+    }
+}
+
+VkDescriptorSet VKTransientDescriptorPool::AllocateDescriptorSet(VkDescriptorSetLayout setLayout)
+{
+    for (;;)
+    {
+        /* Append a new pool to the chain if all previous pools are exhausted */
+        if (activePool_ == pools_.size())
+            AppendPool();
+
+        /* Allocate descriptor set from the active pool */
+        VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+
+        VkDescriptorSetAllocateInfo allocInfo;
+        {
+            allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+            allocInfo.pNext                 = nullptr;
+            allocInfo.descriptorPool        = pools_[activePool_].Get();
+            allocInfo.descriptorSetCount    = 1;
+            allocInfo.pSetLayouts           = &setLayout;
+        }
+        auto result = vkAllocateDescriptorSets(device_.Get(), &allocInfo, &descriptorSet);
+
+        if (result == VK_SUCCESS)
+            return descriptorSet;
+
+        /* Advance to the next pool in the chain if the active pool is exhausted */
+        if (result == VK_ERROR_FRAGMENTED_POOL || result == VK_ERROR_OUT_OF_POOL_MEMORY)
+            ++activePool_;
+        else
+            VKThrowIfFailed(result, "failed to allocate transient Vulkan descriptor set");
+    }
+}
+
+void VKTransientDescriptorPool::Reset()
+{
+    /* Bulk-reset all pools of the chain; the pools themselves are retained for reuse */
+    for (const auto& pool : pools_)
+        vkResetDescriptorPool(device_.Get(), pool.Get(), 0);
+    activePool_ = 0;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VkDescriptorPool VKTransientDescriptorPool::AppendPool()
+{
+    /* Derive pool sizes from the registered layout demand, scaled to the number of sets per pool */
+    SmallVector<VkDescriptorPoolSize> poolSizes;
+
+    for (std::uint32_t typeIdx = 0; typeIdx < numDescriptorTypes; ++typeIdx)
+    {
+        if (demands_[typeIdx] > 0)
+        {
+            VkDescriptorPoolSize poolSize;
+            {
+                poolSize.type               = static_cast<VkDescriptorType>(typeIdx);
+                poolSize.descriptorCount    = demands_[typeIdx] * numSetsPerPool;
+            }
+            poolSizes.push_back(poolSize);
+        }
+    }
+
+    /* Fall back to a uniform demand over the common descriptor types before any layout demand is known */
+    if (poolSizes.empty())
+    {
+        static const VkDescriptorType defaultTypes[] =
+        {
+            VK_DESCRIPTOR_TYPE_SAMPLER,
+            VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+            VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+            VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+        };
+
+        for (auto type : defaultTypes)
+        {
+            VkDescriptorPoolSize poolSize;
+            {
+                poolSize.type               = type;
+                poolSize.descriptorCount    = numSetsPerPool;
+            }
+            poolSizes.push_back(poolSize);
+        }
+    }
+
+    /* Create next descriptor pool of the chain */
+    VKPtr<VkDescriptorPool> pool { device_, vkDestroyDescriptorPool };
+
+    VkDescriptorPoolCreateInfo poolCreateInfo;
+    {
+        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolCreateInfo.pNext            = nullptr;
+        poolCreateInfo.flags            = 0;
+        poolCreateInfo.maxSets          = numSetsPerPool;
+        poolCreateInfo.poolSizeCount    = static_cast<std::uint32_t>(poolSizes.size());
+        poolCreateInfo.pPoolSizes       = poolSizes.data();
+    }
+    auto result = vkCreateDescriptorPool(device_.Get(), &poolCreateInfo, nullptr, pool.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create transient Vulkan descriptor pool");
+
+    pools_.emplace_back(std::move(pool));
+
+    return pools_.back().Get();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,74 @@
+/*
+ * VKTransientDescriptorPool.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_TRANSIENT_DESCRIPTOR_POOL_H
+#define LLGL_VK_TRANSIENT_DESCRIPTOR_POOL_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Chain of descriptor pools for transient descriptor sets.
+Sets are allocated linearly and the entire chain is bulk-reset via vkResetDescriptorPool
+once the GPU has retired the associated submissions, so long sessions do not accumulate pool fragmentation.
+*/
+class VKTransientDescriptorPool
+{
+
+    public:
+
+        VKTransientDescriptorPool(const VKPtr<VkDevice>& device);
+
+        /*
+        Registers the descriptor demand of a pipeline layout to size subsequently created pools.
+        The demand of each descriptor type is tracked as the maximum over all registered layouts.
+        */
+        void RegisterLayoutDemand(const std::vector<VkDescriptorPoolSize>& poolSizes);
+
+        // Allocates a transient descriptor set that remains valid until the next call to "Reset".
+        VkDescriptorSet AllocateDescriptorSet(VkDescriptorSetLayout setLayout);
+
+        // Bulk-resets all pools of this chain; must not be called until the GPU has retired all associated submissions.
+        void Reset();
+
+    private:
+
+        // Number of descriptor types the demand heuristic distinguishes (core Vulkan 1.0 descriptor types)
+        static const std::uint32_t numDescriptorTypes   = (static_cast<std::uint32_t>(VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT) + 1);
+
+        // Number of descriptor sets each pool of the chain provides
+        static const std::uint32_t numSetsPerPool       = 64;
+
+        // Appends a new pool to the chain, sized by the registered layout demand.
+        VkDescriptorPool AppendPool();
+
+    private:
+
+        const VKPtr<VkDevice>&                  device_;
+        std::vector<VKPtr<VkDescriptorPool>>    pools_;
+        std::size_t                             activePool_                     = 0;
+        std::uint32_t                           demands_[numDescriptorTypes]    = {};   // Per-set demand of each descriptor type
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,25 @@
+#!/bin/sh
+# Compiles all builtin shaders with glslangValidator and embeds them as
+# comma-separated word lists (*.spv.inc) that are #include'd by VKMipGenerator.cpp.
+
+spv_to_inc()
+{
+    od -A n -t x4 -v "$1" | tr -s ' ' '\n' | sed '/^$/d' | \
+        awk '{ printf "0x%s,", toupper($1); if (NR % 8 == 0) printf "\n" } END { printf "\n" }' > "$2"
+    rm -f "$1"
+}
+
+compile_variant()
+{
+    glslangValidator -V --target-env vulkan1.0 -DNPOT_TEXTURE_CLASS=$2 -o tmp.spv GenerateMips2D.comp
+    spv_to_inc tmp.spv "GenerateMips2DCS$1.spv.inc"
+}
+
+compile_variant ""       0
+compile_variant ".OddX"  1
+compile_variant ".OddY"  2
+compile_variant ".OddXY" 3
+
+
+
+# ================================================================================
@@ -15,6 +15,7 @@
 #ifdef LLGL_ENABLE_SPIRV_REFLECT
 #   include "../../SPIRV/SPIRVReflect.h"
 #   include "../../SPIRV/SPIRVReflectExecutionMode.h"
+#   include "../../SPIRV/SPIRVReflectCache.h"
 #endif
 
 
@@ -29,6 +30,7 @@ VKShader::VKShader(const VKPtr<VkDevice>& device, const ShaderDescriptor& desc)
 {
     BuildShader(desc);
     BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
+    BuildSpecializationInfo(desc);
 }
 
 bool VKShader::HasErrors() const
@@ -68,7 +70,7 @@ void VKShader::FillShaderStageCreateInfo(VkPipelineShaderStageCreateInfo& create
     createInfo.stage                = VKTypes::Map(GetType());
     createInfo.module               = shaderModule_;
     createInfo.pName                = entryPoint_.c_str();
-    createInfo.pSpecializationInfo  = nullptr;
+    createInfo.pSpecializationInfo  = (specializationEntries_.empty() ? nullptr : &specializationInfo_);
 }
 
 void VKShader::FillVertexInputStateCreateInfo(VkPipelineVertexInputStateCreateInfo& createInfo) const
@@ -115,6 +117,8 @@ static long ShaderTypeToStageFlags(const ShaderType type)
         case ShaderType::Geometry:          return StageFlags::GeometryStage;
         case ShaderType::Fragment:          return StageFlags::FragmentStage;
         case ShaderType::Compute:           return StageFlags::ComputeStage;
+        case ShaderType::Task:              return StageFlags::TaskStage;
+        case ShaderType::Mesh:              return StageFlags::MeshStage;
         default:                            return 0;
     }
 }
@@ -324,12 +328,11 @@ static ShaderResource* FindOrAppendShaderResource(ShaderReflection& reflection,
 
 bool VKShader::Reflect(ShaderReflection& reflection) const
 {
-    /* Parse shader module */
-    SPIRVReflect spvReflect;
-    spvReflect.Parse(shaderModuleData_.data(), shaderModuleData_.size());
+    /* Query shader module reflection from cache (only parsed on first load) */
+    const auto spvReflect = SPIRVReflectCache::Get().QueryReflection(shaderModuleData_.data(), shaderModuleData_.size());
 
     /* Gather input/output attributes */
-    for (const auto& it : spvReflect.GetVaryings())
+    for (const auto& it : spvReflect->GetVaryings())
     {
         const auto& var = it.second;
         if (GetType() == ShaderType::Vertex)
@@ -370,7 +373,7 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
     }
 
     /* Gather resources */
-    for (const auto& it : spvReflect.GetUniforms())
+    for (const auto& it : spvReflect->GetUniforms())
     {
         const auto& var = it.second;
         if (auto resource = FindOrAppendShaderResource(reflection, var))
@@ -384,12 +387,11 @@ bool VKShader::ReflectLocalSize(Extent3D& localSize) const
 {
     if (GetType() == ShaderType::Compute)
     {
-        /* Parse shader module */
-        SPIRVReflectExecutionMode spvReflect;
-        spvReflect.Parse(shaderModuleData_.data(), shaderModuleData_.size());
+        /* Query execution mode reflection from cache (only parsed on first load) */
+        const auto spvReflect = SPIRVReflectCache::Get().QueryExecutionMode(shaderModuleData_.data(), shaderModuleData_.size());
 
         /* Return local work group size */
-        const auto& mode = spvReflect.GetMode();
+        const auto& mode = spvReflect->GetMode();
         localSize.width     = mode.localSizeX;
         localSize.height    = mode.localSizeY;
         localSize.depth     = mode.localSizeZ;
@@ -539,6 +541,30 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
     return true;
 }
 
+void VKShader::BuildSpecializationInfo(const ShaderDescriptor& shaderDesc)
+{
+    /* Convert null-terminated array of specialization constants into Vulkan specialization map */
+    if (auto specializations = shaderDesc.specializations)
+    {
+        for (; specializations->name != nullptr; ++specializations)
+        {
+            VkSpecializationMapEntry entry;
+            {
+                entry.constantID    = specializations->id;
+                entry.offset        = static_cast<std::uint32_t>(specializationData_.size() * sizeof(std::uint32_t));
+                entry.size          = sizeof(std::uint32_t);
+            }
+            specializationEntries_.push_back(entry);
+            specializationData_.push_back(specializations->value);
+        }
+    }
+
+    specializationInfo_.mapEntryCount   = static_cast<std::uint32_t>(specializationEntries_.size());
+    specializationInfo_.pMapEntries     = specializationEntries_.data();
+    specializationInfo_.dataSize        = specializationData_.size() * sizeof(std::uint32_t);
+    specializationInfo_.pData           = specializationData_.data();
+}
+
 
 } // /namespace LLGL
 
@@ -66,6 +66,8 @@ class VKShader final : public Shader
         bool CompileSource(const ShaderDescriptor& shaderDesc);
         bool LoadBinary(const ShaderDescriptor& shaderDesc);
 
+        void BuildSpecializationInfo(const ShaderDescriptor& shaderDesc);
+
     private:
 
         struct VertexInputLayout
@@ -85,6 +87,10 @@ class VKShader final : public Shader
         std::string             entryPoint_;
         std::string             errorLog_;
 
+        std::vector<VkSpecializationMapEntry>   specializationEntries_;
+        std::vector<std::uint32_t>              specializationData_;
+        VkSpecializationInfo                    specializationInfo_;
+
 };
 
 
@@ -27,6 +27,8 @@ VKShaderProgram::VKShaderProgram(const ShaderProgramDescriptor& desc)
     Attach(desc.geometryShader);
     Attach(desc.fragmentShader);
     Attach(desc.computeShader);
+    Attach(desc.taskShader);
+    Attach(desc.meshShader);
     LinkProgram();
 }
 
@@ -105,6 +107,16 @@ bool VKShaderProgram::FillVertexInputStateCreateInfo(VkPipelineVertexInputStateC
     return false;
 }
 
+bool VKShaderProgram::HasShaderType(const ShaderType type) const
+{
+    for (auto shader : shaders_)
+    {
+        if (shader->GetType() == type)
+            return true;
+    }
+    return false;
+}
+
 
 /*
  * ======= Private: =======
@@ -45,6 +45,9 @@ class VKShaderProgram final : public ShaderProgram
         // Fills the specified create-info structure with the vertex input layout.
         bool FillVertexInputStateCreateInfo(VkPipelineVertexInputStateCreateInfo& createInfo) const;
 
+        // Returns true if a shader of the specified type is attached to this shader program.
+        bool HasShaderType(const ShaderType type) const;
+
     private:
 
         void Attach(Shader* shader);
@@ -19,6 +19,23 @@ VKDepthStencilBuffer::VKDepthStencilBuffer(const VKPtr<VkDevice>& device) :
 {
 }
 
+VKDepthStencilBuffer::VKDepthStencilBuffer(VKDepthStencilBuffer&& rhs) :
+    VKDeviceImage { std::move(rhs)            },
+    imageView_    { std::move(rhs.imageView_) },
+    format_       { rhs.format_               }
+{
+    rhs.format_ = VK_FORMAT_UNDEFINED;
+}
+
+VKDepthStencilBuffer& VKDepthStencilBuffer::operator = (VKDepthStencilBuffer&& rhs)
+{
+    VKDeviceImage::operator = (std::move(rhs));
+    imageView_  = std::move(rhs.imageView_);
+    format_     = rhs.format_;
+    rhs.format_ = VK_FORMAT_UNDEFINED;
+    return *this;
+}
+
 // see https://www.khronos.org/registry/vulkan/specs/1.1-extensions/man/html/VkFormat.html
 static VkImageAspectFlags GetVkImageAspectByFormat(VkFormat format)
 {
@@ -23,6 +23,10 @@ class VKDepthStencilBuffer final : private VKDeviceImage
 
         VKDepthStencilBuffer(const VKPtr<VkDevice>& device);
 
+        // Moves the depth-stencil buffer into this one; the destination must not hold a buffer of its own.
+        VKDepthStencilBuffer(VKDepthStencilBuffer&& rhs);
+        VKDepthStencilBuffer& operator = (VKDepthStencilBuffer&& rhs);
+
         void CreateDepthStencil(VKDeviceMemoryManager& deviceMemoryMngr, const Extent2D& extent, VkFormat format, VkSampleCountFlagBits samplesFlags);
         void ReleaseDepthStencil(VKDeviceMemoryManager& deviceMemoryMngr);
 
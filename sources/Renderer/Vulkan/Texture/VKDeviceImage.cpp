@@ -8,6 +8,8 @@
 #include "VKDeviceImage.h"
 #include "../Memory/VKDeviceMemory.h"
 #include "../Memory/VKDeviceMemoryManager.h"
+#include "../Ext/VKExtensions.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../VKCore.h"
 
 
@@ -15,6 +17,10 @@ namespace LLGL
 {
 
 
+// Size threshold (in bytes) at which images are allocated dedicated even if the driver does not explicitly prefer it
+static const VkDeviceSize g_dedicatedAllocationSizeThreshold = 16 * 1024 * 1024;
+
+
 VKDeviceImage::VKDeviceImage(const VKPtr<VkDevice>& device) :
     image_ { device, vkDestroyImage }
 {
@@ -24,21 +30,94 @@ VKDeviceImage::~VKDeviceImage()
 {
 }
 
-void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr)
+VKDeviceImage::VKDeviceImage(VKDeviceImage&& rhs) :
+    image_        { std::move(rhs.image_) },
+    memoryRegion_ { rhs.memoryRegion_     }
+{
+    rhs.memoryRegion_ = nullptr;
+}
+
+VKDeviceImage& VKDeviceImage::operator = (VKDeviceImage&& rhs)
+{
+    image_              = std::move(rhs.image_);
+    memoryRegion_       = rhs.memoryRegion_;
+    rhs.memoryRegion_   = nullptr;
+    return *this;
+}
+
+void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, bool transient)
 {
     auto device = deviceMemoryMngr.GetVkDevice();
 
     /* Get memory requirements for the image */
     VkMemoryRequirements requirements;
-    vkGetImageMemoryRequirements(device, image_, &requirements);
-
-    /* Allocate device memory */
-    memoryRegion_ = deviceMemoryMngr.Allocate(
-        requirements.size,
-        requirements.alignment,
-        requirements.memoryTypeBits,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-    );
+    bool useDedicatedAllocation = false;
+
+    #ifdef LLGL_VK_ENABLE_EXT
+    if (!transient && HasExtension(VKExt::KHR_get_memory_requirements2) && HasExtension(VKExt::KHR_dedicated_allocation))
+    {
+        /* Query memory requirements together with the driver's dedicated allocation preference */
+        VkImageMemoryRequirementsInfo2KHR requirementsInfo;
+        {
+            requirementsInfo.sType          = VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2_KHR;
+            requirementsInfo.pNext          = nullptr;
+            requirementsInfo.image          = image_;
+        }
+        VkMemoryDedicatedRequirementsKHR dedicatedRequirements;
+        {
+            dedicatedRequirements.sType     = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS_KHR;
+            dedicatedRequirements.pNext     = nullptr;
+        }
+        VkMemoryRequirements2KHR requirements2;
+        {
+            requirements2.sType             = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2_KHR;
+            requirements2.pNext             = (&dedicatedRequirements);
+        }
+        vkGetImageMemoryRequirements2KHR(device, &requirementsInfo, &requirements2);
+
+        requirements = requirements2.memoryRequirements;
+
+        /* Use a dedicated allocation if the driver prefers (or requires) it, or the image exceeds the size threshold */
+        useDedicatedAllocation =
+        (
+            dedicatedRequirements.prefersDedicatedAllocation  != VK_FALSE ||
+            dedicatedRequirements.requiresDedicatedAllocation != VK_FALSE ||
+            requirements.size >= g_dedicatedAllocationSizeThreshold
+        );
+    }
+    else
+    #endif // /LLGL_VK_ENABLE_EXT
+    {
+        vkGetImageMemoryRequirements(device, image_, &requirements);
+    }
+
+    if (transient)
+    {
+        /* Allocate transient device memory that may alias with other transient resources */
+        memoryRegion_ = deviceMemoryMngr.AllocateTransient(
+            requirements,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        );
+    }
+    else if (useDedicatedAllocation)
+    {
+        /* Allocate device memory that is dedicated to this image, bypassing the chunk sub-allocation */
+        memoryRegion_ = deviceMemoryMngr.AllocateDedicated(
+            requirements,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            image_
+        );
+    }
+    else
+    {
+        /* Allocate device memory */
+        memoryRegion_ = deviceMemoryMngr.Allocate(
+            requirements.size,
+            requirements.alignment,
+            requirements.memoryTypeBits,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        );
+    }
 
     /* Bind image to device memory region */
     if (memoryRegion_)
@@ -31,7 +31,14 @@ class VKDeviceImage
         VKDeviceImage(const VKPtr<VkDevice>& device);
         virtual ~VKDeviceImage();
 
-        void AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
+        /*
+        Moves the image and memory region of the specified device image into this one;
+        the destination must not hold an image or memory region of its own.
+        */
+        VKDeviceImage(VKDeviceImage&& rhs);
+        VKDeviceImage& operator = (VKDeviceImage&& rhs);
+
+        void AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, bool transient = false);
         void ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
 
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
@@ -0,0 +1,449 @@
+/*
+ * VKMipGenerator.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VKMipGenerator.h"
+#include "VKTexture.h"
+#include "../VKDevice.h"
+#include "../VKPhysicalDevice.h"
+#include "../VKTypes.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/*
+Pre-compiled SPIR-V modules of the compute downsampler (see GenerateMips2D.comp and GenerateMips.Compile.sh);
+one variant for each non-power-of-two (NPOT) texture classification
+*/
+static const std::uint32_t g_generateMips2DCSEven[] =
+{
+    #include "../Shader/Builtin/GenerateMips2DCS.spv.inc"
+};
+
+static const std::uint32_t g_generateMips2DCSOddX[] =
+{
+    #include "../Shader/Builtin/GenerateMips2DCS.OddX.spv.inc"
+};
+
+static const std::uint32_t g_generateMips2DCSOddY[] =
+{
+    #include "../Shader/Builtin/GenerateMips2DCS.OddY.spv.inc"
+};
+
+static const std::uint32_t g_generateMips2DCSOddXY[] =
+{
+    #include "../Shader/Builtin/GenerateMips2DCS.OddXY.spv.inc"
+};
+
+// Push constants of the compute downsampler; must match the "TextureDescriptor" block in GenerateMips2D.comp
+struct VKGenerateMipsConstants
+{
+    float           texelSize[2];   // 1.0 / dstExtent
+    std::uint32_t   baseMipLevel;
+    std::uint32_t   numMipLevels;
+    std::uint32_t   baseArrayLayer;
+    std::uint32_t   pad0;           // std140/std430 alignment for "dstExtent"
+    std::uint32_t   dstExtent[2];
+};
+
+
+VKMipGenerator& VKMipGenerator::Get()
+{
+    static VKMipGenerator instance;
+    return instance;
+}
+
+void VKMipGenerator::InitializeDevice(VkDevice device, const VKPhysicalDevice& physicalDevice)
+{
+    /* The storage images of the downsampler are declared without a format, which requires this device feature */
+    if (physicalDevice.GetFeatures().shaderStorageImageWriteWithoutFormat == VK_FALSE)
+        return;
+
+    device_         = device;
+    physicalDevice_ = physicalDevice.GetVkPhysicalDevice();
+
+    /* Create device objects; treat any failure as absence of compute downsampling and keep the blit fallback */
+    const bool result =
+    (
+        CreateLinearSampler(device)                                                                                     &&
+        CreateDescriptorSetLayout(device)                                                                               &&
+        CreatePipelineLayout(device)                                                                                    &&
+        CreateComputePipeline(device, 0, g_generateMips2DCSEven,  sizeof(g_generateMips2DCSEven ))                      &&
+        CreateComputePipeline(device, 1, g_generateMips2DCSOddX,  sizeof(g_generateMips2DCSOddX ))                      &&
+        CreateComputePipeline(device, 2, g_generateMips2DCSOddY,  sizeof(g_generateMips2DCSOddY ))                      &&
+        CreateComputePipeline(device, 3, g_generateMips2DCSOddXY, sizeof(g_generateMips2DCSOddXY))
+    );
+
+    if (!result)
+        Clear();
+}
+
+void VKMipGenerator::Clear()
+{
+    if (device_ != VK_NULL_HANDLE)
+    {
+        for (auto& pipeline : pipelines2D_)
+        {
+            if (pipeline != VK_NULL_HANDLE)
+            {
+                vkDestroyPipeline(device_, pipeline, nullptr);
+                pipeline = VK_NULL_HANDLE;
+            }
+        }
+
+        if (pipelineLayout_ != VK_NULL_HANDLE)
+        {
+            vkDestroyPipelineLayout(device_, pipelineLayout_, nullptr);
+            pipelineLayout_ = VK_NULL_HANDLE;
+        }
+
+        if (setLayout_ != VK_NULL_HANDLE)
+        {
+            vkDestroyDescriptorSetLayout(device_, setLayout_, nullptr);
+            setLayout_ = VK_NULL_HANDLE;
+        }
+
+        if (linearSampler_ != VK_NULL_HANDLE)
+        {
+            vkDestroySampler(device_, linearSampler_, nullptr);
+            linearSampler_ = VK_NULL_HANDLE;
+        }
+
+        device_         = VK_NULL_HANDLE;
+        physicalDevice_ = VK_NULL_HANDLE;
+    }
+}
+
+bool VKMipGenerator::SupportsTexture(const TextureDescriptor& textureDesc) const
+{
+    /* Compute downsampler is not available on this device */
+    if (device_ == VK_NULL_HANDLE)
+        return false;
+
+    /* Only downsample textures that can have MIP-maps generated at all (see D3D12Texture::SupportsGenerateMips) */
+    if ((textureDesc.bindFlags & BindFlags::ColorAttachment) == 0 || NumMipLevels(textureDesc) <= 1)
+        return false;
+
+    /* Sparse textures bind their MIP-map levels on demand, so they keep the blit fallback */
+    if ((textureDesc.miscFlags & MiscFlags::SparseResidency) != 0)
+        return false;
+
+    /* Only texture types that are compatible with 2D-array image views */
+    switch (textureDesc.type)
+    {
+        case TextureType::Texture2D:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            break;
+        default:
+            return false;
+    }
+
+    /* Format must support storage image writes as well as sampling with a linear filter */
+    const VkFormatFeatureFlags requiredFeatures =
+    (
+        VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT             |
+        VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT             |
+        VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT
+    );
+
+    VkFormatProperties formatProperties;
+    vkGetPhysicalDeviceFormatProperties(physicalDevice_, VKTypes::Map(textureDesc.format), &formatProperties);
+
+    return ((formatProperties.optimalTilingFeatures & requiredFeatures) == requiredFeatures);
+}
+
+void VKMipGenerator::GenerateMips(
+    VKDevice&                   device,
+    VkCommandBuffer             commandBuffer,
+    VKTexture&                  textureVK,
+    const TextureSubresource&   subresource)
+{
+    if (textureVK.GetMipDescriptorSet(subresource.baseMipLevel) != VK_NULL_HANDLE)
+    {
+        /* Downsample with the compute shader; writes 4 MIP-map levels per dispatch */
+        GenerateMips2D(commandBuffer, textureVK, subresource);
+    }
+    else
+    {
+        /* Fall back to the serial blit chain for textures without MIP-map chain descriptor sets */
+        device.GenerateMips(
+            commandBuffer,
+            textureVK.GetVkImage(),
+            textureVK.GetVkExtent(),
+            subresource
+        );
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool VKMipGenerator::CreateLinearSampler(VkDevice device)
+{
+    VkSamplerCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.magFilter                = VK_FILTER_LINEAR;
+        createInfo.minFilter                = VK_FILTER_LINEAR;
+        createInfo.mipmapMode               = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        createInfo.addressModeU             = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        createInfo.addressModeV             = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        createInfo.addressModeW             = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        createInfo.mipLodBias               = 0.0f;
+        createInfo.anisotropyEnable         = VK_FALSE;
+        createInfo.maxAnisotropy            = 1.0f;
+        createInfo.compareEnable            = VK_FALSE;
+        createInfo.compareOp                = VK_COMPARE_OP_ALWAYS;
+        createInfo.minLod                   = 0.0f;
+        createInfo.maxLod                   = VK_LOD_CLAMP_NONE;
+        createInfo.borderColor              = VK_BORDER_COLOR_FLOAT_OPAQUE_BLACK;
+        createInfo.unnormalizedCoordinates  = VK_FALSE;
+    }
+    return (vkCreateSampler(device, &createInfo, nullptr, &linearSampler_) == VK_SUCCESS);
+}
+
+bool VKMipGenerator::CreateDescriptorSetLayout(VkDevice device)
+{
+    /* Binding 0 is the source MIP-map chain with an immutable linear-clamp sampler, bindings 1..4 are the destination MIP-maps */
+    VkDescriptorSetLayoutBinding bindings[5];
+
+    bindings[0].binding             = 0;
+    bindings[0].descriptorType      = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    bindings[0].descriptorCount     = 1;
+    bindings[0].stageFlags          = VK_SHADER_STAGE_COMPUTE_BIT;
+    bindings[0].pImmutableSamplers  = &linearSampler_;
+
+    for (std::uint32_t i = 1; i <= 4; ++i)
+    {
+        bindings[i].binding             = i;
+        bindings[i].descriptorType      = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        bindings[i].descriptorCount     = 1;
+        bindings[i].stageFlags          = VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings[i].pImmutableSamplers  = nullptr;
+    }
+
+    VkDescriptorSetLayoutCreateInfo createInfo;
+    {
+        createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        createInfo.pNext        = nullptr;
+        createInfo.flags        = 0;
+        createInfo.bindingCount = 5;
+        createInfo.pBindings    = bindings;
+    }
+    return (vkCreateDescriptorSetLayout(device, &createInfo, nullptr, &setLayout_) == VK_SUCCESS);
+}
+
+bool VKMipGenerator::CreatePipelineLayout(VkDevice device)
+{
+    VkPushConstantRange pushConstantRange;
+    {
+        pushConstantRange.stageFlags    = VK_SHADER_STAGE_COMPUTE_BIT;
+        pushConstantRange.offset        = 0;
+        pushConstantRange.size          = sizeof(VKGenerateMipsConstants);
+    }
+    VkPipelineLayoutCreateInfo createInfo;
+    {
+        createInfo.sType                    = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+        createInfo.pNext                    = nullptr;
+        createInfo.flags                    = 0;
+        createInfo.setLayoutCount           = 1;
+        createInfo.pSetLayouts              = &setLayout_;
+        createInfo.pushConstantRangeCount   = 1;
+        createInfo.pPushConstantRanges      = &pushConstantRange;
+    }
+    return (vkCreatePipelineLayout(device, &createInfo, nullptr, &pipelineLayout_) == VK_SUCCESS);
+}
+
+bool VKMipGenerator::CreateComputePipeline(
+    VkDevice                device,
+    std::uint32_t           resourceID,
+    const std::uint32_t*    shaderCode,
+    std::size_t             shaderCodeSize)
+{
+    /* Create temporary shader module */
+    VkShaderModuleCreateInfo moduleCreateInfo;
+    {
+        moduleCreateInfo.sType      = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        moduleCreateInfo.pNext      = nullptr;
+        moduleCreateInfo.flags      = 0;
+        moduleCreateInfo.codeSize   = shaderCodeSize;
+        moduleCreateInfo.pCode      = shaderCode;
+    }
+    VkShaderModule shaderModule = VK_NULL_HANDLE;
+    if (vkCreateShaderModule(device, &moduleCreateInfo, nullptr, &shaderModule) != VK_SUCCESS)
+        return false;
+
+    /* Create compute pipeline state; the shader module is no longer needed afterwards */
+    VkComputePipelineCreateInfo createInfo;
+    {
+        createInfo.sType                        = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+        createInfo.pNext                        = nullptr;
+        createInfo.flags                        = 0;
+        createInfo.stage.sType                  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        createInfo.stage.pNext                  = nullptr;
+        createInfo.stage.flags                  = 0;
+        createInfo.stage.stage                  = VK_SHADER_STAGE_COMPUTE_BIT;
+        createInfo.stage.module                 = shaderModule;
+        createInfo.stage.pName                  = "main";
+        createInfo.stage.pSpecializationInfo    = nullptr;
+        createInfo.layout                       = pipelineLayout_;
+        createInfo.basePipelineHandle           = VK_NULL_HANDLE;
+        createInfo.basePipelineIndex            = -1;
+    }
+    auto result = vkCreateComputePipelines(device, VK_NULL_HANDLE, 1, &createInfo, nullptr, &(pipelines2D_[resourceID]));
+
+    vkDestroyShaderModule(device, shaderModule, nullptr);
+
+    return (result == VK_SUCCESS);
+}
+
+static void CmdImageMemoryBarrier(
+    VkCommandBuffer                 commandBuffer,
+    VkImage                         image,
+    VkImageLayout                   oldLayout,
+    VkImageLayout                   newLayout,
+    VkAccessFlags                   srcAccessMask,
+    VkAccessFlags                   dstAccessMask,
+    VkPipelineStageFlags            srcStageMask,
+    VkPipelineStageFlags            dstStageMask,
+    const VkImageSubresourceRange&  subresourceRange)
+{
+    VkImageMemoryBarrier barrier;
+    {
+        barrier.sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext               = nullptr;
+        barrier.srcAccessMask       = srcAccessMask;
+        barrier.dstAccessMask       = dstAccessMask;
+        barrier.oldLayout           = oldLayout;
+        barrier.newLayout           = newLayout;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image               = image;
+        barrier.subresourceRange    = subresourceRange;
+    }
+    vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+}
+
+void VKMipGenerator::GenerateMips2D(
+    VkCommandBuffer             commandBuffer,
+    VKTexture&                  textureVK,
+    const TextureSubresource&   subresource)
+{
+    const auto& extent      = textureVK.GetVkExtent();
+    const auto  mipLevelEnd = subresource.baseMipLevel + subresource.numMipLevels;
+
+    VkImageSubresourceRange subresourceRange;
+    {
+        subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        subresourceRange.baseMipLevel   = subresource.baseMipLevel;
+        subresourceRange.levelCount     = subresource.numMipLevels;
+        subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
+        subresourceRange.layerCount     = subresource.numArrayLayers;
+    }
+
+    /* Transition entire subresource range into general layout for simultaneous sampled and storage image access */
+    CmdImageMemoryBarrier(
+        commandBuffer,
+        textureVK.GetVkImage(),
+        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        VK_IMAGE_LAYOUT_GENERAL,
+        VK_ACCESS_SHADER_READ_BIT,
+        (VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT),
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        subresourceRange
+    );
+
+    for (std::uint32_t mipLevel = subresource.baseMipLevel; mipLevel + 1 < mipLevelEnd;)
+    {
+        /* Determine source and destination extents */
+        std::uint32_t srcWidth  = std::max(1u, extent.width  >> mipLevel);
+        std::uint32_t srcHeight = std::max(1u, extent.height >> mipLevel);
+
+        std::uint32_t dstWidth  = std::max(1u, srcWidth  >> 1);
+        std::uint32_t dstHeight = std::max(1u, srcHeight >> 1);
+
+        /* Make writes of the previous dispatch visible to the next one */
+        if (mipLevel > subresource.baseMipLevel)
+        {
+            VkMemoryBarrier barrier;
+            {
+                barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                barrier.pNext           = nullptr;
+                barrier.srcAccessMask   = VK_ACCESS_SHADER_WRITE_BIT;
+                barrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT;
+            }
+            vkCmdPipelineBarrier(
+                commandBuffer,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                0, 1, &barrier, 0, nullptr, 0, nullptr
+            );
+        }
+
+        /* Bind pipeline state depending on power-of-two class */
+        std::uint32_t nonPowerOfTwo = ((srcWidth & 1) | ((srcHeight & 1) << 1));
+        vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelines2D_[nonPowerOfTwo]);
+
+        /* Determine how many MIP-maps can be downsampled at once; must be in [1, 4] */
+        std::uint32_t numMips = std::min(4u, mipLevelEnd - mipLevel - 1);
+
+        /* Bind MIP-map chain descriptor set of the current source MIP-map level */
+        VkDescriptorSet descriptorSet = textureVK.GetMipDescriptorSet(mipLevel);
+        vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout_, 0, 1, &descriptorSet, 0, nullptr);
+
+        /* Run compute shader to generate next four MIP-maps */
+        VKGenerateMipsConstants constants;
+        {
+            constants.texelSize[0]      = 1.0f / static_cast<float>(dstWidth);
+            constants.texelSize[1]      = 1.0f / static_cast<float>(dstHeight);
+            constants.baseMipLevel      = mipLevel;
+            constants.numMipLevels      = numMips;
+            constants.baseArrayLayer    = subresource.baseArrayLayer;
+            constants.pad0              = 0;
+            constants.dstExtent[0]      = dstWidth;
+            constants.dstExtent[1]      = dstHeight;
+        }
+        vkCmdPushConstants(commandBuffer, pipelineLayout_, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(constants), &constants);
+
+        vkCmdDispatch(
+            (dstWidth  + 7) / 8,
+            (dstHeight + 7) / 8,
+            subresource.numArrayLayers
+        );
+
+        mipLevel += numMips;
+    }
+
+    /* Transition subresource range back into the shader-read layout, like the blit fallback does */
+    CmdImageMemoryBarrier(
+        commandBuffer,
+        textureVK.GetVkImage(),
+        VK_IMAGE_LAYOUT_GENERAL,
+        VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+        VK_ACCESS_SHADER_WRITE_BIT,
+        VK_ACCESS_SHADER_READ_BIT,
+        VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+        VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+        subresourceRange
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
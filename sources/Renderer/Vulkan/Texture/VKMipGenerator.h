@@ -0,0 +1,110 @@
+/*
+ * VKMipGenerator.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_VK_MIP_GENERATOR_H
+#define LLGL_VK_MIP_GENERATOR_H
+
+
+#include <LLGL/Texture.h>
+#include <vulkan/vulkan.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+class VKTexture;
+class VKPhysicalDevice;
+
+/*
+Vulkan MIP-map generator singleton.
+Uses a compute downsampler (see GenerateMips2D.comp) that writes up to 4 MIP-map levels per dispatch,
+and falls back to the blit-based downsampler of VKDevice where storage images are unsupported.
+*/
+class VKMipGenerator
+{
+
+    public:
+
+        // Returns the singleton instance.
+        static VKMipGenerator& Get();
+
+    public:
+
+        VKMipGenerator(const VKMipGenerator&) = delete;
+        VKMipGenerator& operator = (const VKMipGenerator&) = delete;
+
+        VKMipGenerator(VKMipGenerator&&) = delete;
+        VKMipGenerator& operator = (VKMipGenerator&&) = delete;
+
+        /*
+        Creates the device objects of the compute downsampler.
+        Any failure silently leaves this generator uninitialized, in which case all textures keep the blit fallback.
+        */
+        void InitializeDevice(VkDevice device, const VKPhysicalDevice& physicalDevice);
+        void Clear();
+
+        // Returns true if MIP-maps for the specified texture descriptor can be generated with the compute downsampler.
+        bool SupportsTexture(const TextureDescriptor& textureDesc) const;
+
+        void GenerateMips(
+            VKDevice&                   device,
+            VkCommandBuffer             commandBuffer,
+            VKTexture&                  textureVK,
+            const TextureSubresource&   subresource
+        );
+
+        // Returns the descriptor set layout the MIP-map chain descriptor sets of VKTexture must be allocated with.
+        inline VkDescriptorSetLayout GetDescriptorSetLayout() const
+        {
+            return setLayout_;
+        }
+
+    private:
+
+        VKMipGenerator() = default;
+
+        bool CreateLinearSampler(VkDevice device);
+        bool CreateDescriptorSetLayout(VkDevice device);
+        bool CreatePipelineLayout(VkDevice device);
+
+        bool CreateComputePipeline(
+            VkDevice                device,
+            std::uint32_t           resourceID,
+            const std::uint32_t*    shaderCode,
+            std::size_t             shaderCodeSize
+        );
+
+        void GenerateMips2D(
+            VkCommandBuffer             commandBuffer,
+            VKTexture&                  textureVK,
+            const TextureSubresource&   subresource
+        );
+
+    private:
+
+        VkDevice                device_             = VK_NULL_HANDLE;
+        VkPhysicalDevice        physicalDevice_     = VK_NULL_HANDLE;
+
+        VkSampler               linearSampler_      = VK_NULL_HANDLE;
+        VkDescriptorSetLayout   setLayout_          = VK_NULL_HANDLE;
+        VkPipelineLayout        pipelineLayout_     = VK_NULL_HANDLE;
+        VkPipeline              pipelines2D_[4]     = {};
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,6 +7,7 @@
 
 #include "VKRenderTarget.h"
 #include "VKTexture.h"
+#include "../RenderState/VKFramebufferCache.h"
 #include "../Memory/VKDeviceMemoryManager.h"
 #include "../../CheckedCast.h"
 #include "../VKCore.h"
@@ -19,12 +20,17 @@ namespace LLGL
 {
 
 
-VKRenderTarget::VKRenderTarget(const VKPtr<VkDevice>& device, VKDeviceMemoryManager& deviceMemoryMngr, const RenderTargetDescriptor& desc) :
-    resolution_          { desc.resolution              },
-    framebuffer_         { device, vkDestroyFramebuffer },
-    defaultRenderPass_   { device                       },
-    secondaryRenderPass_ { device                       },
-    depthStencilBuffer_  { device                       }
+VKRenderTarget::VKRenderTarget(
+    const VKPtr<VkDevice>&          device,
+    VKDeviceMemoryManager&          deviceMemoryMngr,
+    VKFramebufferCache&             framebufferCache,
+    const RenderTargetDescriptor&   desc)
+:
+    resolution_          { desc.resolution  },
+    framebufferCache_    { framebufferCache },
+    defaultRenderPass_   { device           },
+    secondaryRenderPass_ { device           },
+    depthStencilBuffer_  { device           }
 {
     if (desc.renderPass)
     {
@@ -41,6 +47,14 @@ VKRenderTarget::VKRenderTarget(const VKPtr<VkDevice>& device, VKDeviceMemoryMana
     CreateFramebuffer(device, deviceMemoryMngr, desc);
 }
 
+VKRenderTarget::~VKRenderTarget()
+{
+    /* Return framebuffer to the cache and detach entries that reference the internal depth-stencil view */
+    framebufferCache_.ReleaseVkFramebuffer(framebuffer_);
+    if (depthStencilBuffer_.GetVkImageView() != VK_NULL_HANDLE)
+        framebufferCache_.NotifyReleasedImageView(depthStencilBuffer_.GetVkImageView());
+}
+
 Extent2D VKRenderTarget::GetResolution() const
 {
     return resolution_;
@@ -202,7 +216,6 @@ void VKRenderTarget::CreateFramebuffer(const VKPtr<VkDevice>& device, VKDeviceMe
     if (numAttachments == 0)
         throw std::runtime_error("cannot create render target without attachments");
 
-    imageViews_.reserve(numAttachments);
     std::vector<VkImageView> imageViewRefs(numAttachments);
 
     for (const auto& attachment : desc.attachments)
@@ -211,18 +224,9 @@ void VKRenderTarget::CreateFramebuffer(const VKPtr<VkDevice>& device, VKDeviceMe
         {
             auto textureVK = LLGL_CAST(VKTexture*, texture);
 
-            /* Create new image view for MIP-level and array layer specified in attachment descriptor */
-            VKPtr<VkImageView> imageView { device, vkDestroyImageView };
+            /* Get image view for MIP-level and array layer specified in attachment descriptor; cached inside the texture */
+            auto imageView = textureVK->GetOrCreateAttachmentView(device, attachment.mipLevel, attachment.arrayLayer);
             {
-                textureVK->CreateImageView(
-                    device,
-                    attachment.mipLevel,
-                    1,
-                    attachment.arrayLayer,
-                    1,
-                    imageView.ReleaseAndGetAddressOf()
-                );
-
                 /* Add image view to attachments */
                 if (attachment.type == AttachmentType::Color)
                 {
@@ -236,7 +240,6 @@ void VKRenderTarget::CreateFramebuffer(const VKPtr<VkDevice>& device, VKDeviceMe
                     depthStencilFormat_ = textureVK->GetVkFormat();
                 }
             }
-            imageViews_.emplace_back(std::move(imageView));
 
             /* Validate texture resolution to render target (to validate correlation between attachments) */
             ValidateMipResolution(*textureVK, attachment.mipLevel);
@@ -254,21 +257,13 @@ void VKRenderTarget::CreateFramebuffer(const VKPtr<VkDevice>& device, VKDeviceMe
         }
     }
 
-    /* Create framebuffer object */
-    VkFramebufferCreateInfo createInfo;
-    {
-        createInfo.sType            = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-        createInfo.pNext            = nullptr;
-        createInfo.flags            = 0;
-        createInfo.renderPass       = renderPass_->GetVkRenderPass();
-        createInfo.attachmentCount  = numAttachments;
-        createInfo.pAttachments     = imageViewRefs.data();
-        createInfo.width            = GetResolution().width;
-        createInfo.height           = GetResolution().height;
-        createInfo.layers           = 1;
-    }
-    VkResult result = vkCreateFramebuffer(device, &createInfo, nullptr, framebuffer_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan framebuffer");
+    /* Get framebuffer object, either shared from the cache or newly created */
+    framebuffer_ = framebufferCache_.GetOrCreateVkFramebuffer(
+        renderPass_->GetVkRenderPass(),
+        imageViewRefs.data(),
+        numAttachments,
+        GetVkExtent()
+    );
 }
 
 //TODO: support multi-sampling
@@ -20,12 +20,20 @@ namespace LLGL
 {
 
 
+class VKFramebufferCache;
+
 class VKRenderTarget final : public RenderTarget
 {
 
     public:
 
-        VKRenderTarget(const VKPtr<VkDevice>& device, VKDeviceMemoryManager& deviceMemoryMngr, const RenderTargetDescriptor& desc);
+        VKRenderTarget(
+            const VKPtr<VkDevice>&          device,
+            VKDeviceMemoryManager&          deviceMemoryMngr,
+            VKFramebufferCache&             framebufferCache,
+            const RenderTargetDescriptor&   desc
+        );
+        ~VKRenderTarget();
 
         Extent2D GetResolution() const override;
         std::uint32_t GetNumColorAttachments() const override;
@@ -76,13 +84,12 @@ class VKRenderTarget final : public RenderTarget
 
         Extent2D                        resolution_;
 
-        VKPtr<VkFramebuffer>            framebuffer_;
+        VKFramebufferCache&             framebufferCache_;
+        VkFramebuffer                   framebuffer_            = VK_NULL_HANDLE;   // Shared with framebuffer cache
         const VKRenderPass*             renderPass_             = nullptr;
         VKRenderPass                    defaultRenderPass_;
         VKRenderPass                    secondaryRenderPass_;
 
-        std::vector<VKPtr<VkImageView>> imageViews_;
-
         VKDepthStencilBuffer            depthStencilBuffer_;
         VkFormat                        depthStencilFormat_     = VK_FORMAT_UNDEFINED;  // Format either from internal depth-stencil buffer or attachmed texture.
 
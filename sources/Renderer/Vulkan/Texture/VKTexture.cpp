@@ -6,9 +6,12 @@
  */
 
 #include "VKTexture.h"
+#include "VKMipGenerator.h"
 #include "../Memory/VKDeviceMemory.h"
+#include "../Memory/VKDeviceMemoryManager.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
+#include "../../../Core/SmallVector.h"
 #include <algorithm>
 
 
@@ -21,14 +24,82 @@ VKTexture::VKTexture(
     VKDeviceMemoryManager&      deviceMemoryMngr,
     const TextureDescriptor&    desc)
 :
-    Texture       { desc.type                  },
-    imageWrapper_ { device                     },
-    imageView_    { device, vkDestroyImageView },
-    format_       { VKTypes::Map(desc.format)  }
+    Texture          { desc.type                       },
+    imageWrapper_    { device                          },
+    imageView_       { device, vkDestroyImageView      },
+    format_          { VKTypes::Map(desc.format)       },
+    mipChainSrcView_ { device, vkDestroyImageView      },
+    mipDescPool_     { device, vkDestroyDescriptorPool }
 {
     /* Create Vulkan image and allocate memory region */
     CreateImage(device, desc);
-    imageWrapper_.AllocateMemoryRegion(deviceMemoryMngr);
+
+    /* Initialize layout tracking for all subresources */
+    subresourceLayouts_.assign(static_cast<std::size_t>(numMipLevels_) * numArrayLayers_, VK_IMAGE_LAYOUT_UNDEFINED);
+
+    if ((desc.miscFlags & MiscFlags::SparseResidency) != 0)
+    {
+        /* Sparse textures have no memory bound at creation; residency is updated on demand via sparse binding */
+        sparseResidency_ = true;
+        sparseMipRegions_.resize(numMipLevels_);
+    }
+    else
+        imageWrapper_.AllocateMemoryRegion(deviceMemoryMngr, ((desc.miscFlags & MiscFlags::Transient) != 0));
+
+    /* Create descriptor sets for the compute downsampler if it supports this texture */
+    if (VKMipGenerator::Get().SupportsTexture(desc))
+        CreateMipChainDescriptorSets(device);
+}
+
+VKTexture::VKTexture(
+    const VKPtr<VkDevice>&          device,
+    VKTexture&                      sharedTexture,
+    const TextureViewDescriptor&    textureViewDesc)
+:
+    Texture          { textureViewDesc.type                 },
+    imageWrapper_    { device                               },
+    sharedVkImage_   { sharedTexture.GetVkImage()           },
+    imageView_       { device, vkDestroyImageView           },
+    format_          { VKTypes::Map(textureViewDesc.format) },
+    mipChainSrcView_ { device, vkDestroyImageView           },
+    mipDescPool_     { device, vkDestroyDescriptorPool      }
+{
+    const auto& subresource = textureViewDesc.subresource;
+
+    /* Derive extent of the view's base MIP-map level from the shared texture */
+    const auto& sharedExtent = sharedTexture.GetVkExtent();
+
+    extent_.width   = std::max(1u, sharedExtent.width  >> subresource.baseMipLevel);
+    extent_.height  = std::max(1u, sharedExtent.height >> subresource.baseMipLevel);
+    extent_.depth   = std::max(1u, sharedExtent.depth  >> subresource.baseMipLevel);
+
+    numMipLevels_   = subresource.numMipLevels;
+    numArrayLayers_ = subresource.numArrayLayers;
+
+    /* Initialize layout tracking for all subresources of this view */
+    subresourceLayouts_.assign(static_cast<std::size_t>(numMipLevels_) * numArrayLayers_, VK_IMAGE_LAYOUT_UNDEFINED);
+
+    /* Create image view with the view's own type, format, swizzle, and subresource range */
+    VkImageViewCreateInfo createInfo;
+    {
+        createInfo.sType                            = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        createInfo.pNext                            = nullptr;
+        createInfo.flags                            = 0;
+        createInfo.image                            = sharedVkImage_;
+        createInfo.viewType                         = VKTypes::Map(textureViewDesc.type);
+        createInfo.format                           = format_;
+        createInfo.components.r                     = VKTypes::Map(textureViewDesc.swizzle.r);
+        createInfo.components.g                     = VKTypes::Map(textureViewDesc.swizzle.g);
+        createInfo.components.b                     = VKTypes::Map(textureViewDesc.swizzle.b);
+        createInfo.components.a                     = VKTypes::Map(textureViewDesc.swizzle.a);
+        createInfo.subresourceRange.aspectMask      = GetAspectFlags();
+        createInfo.subresourceRange.baseMipLevel    = subresource.baseMipLevel;
+        createInfo.subresourceRange.levelCount      = subresource.numMipLevels;
+        createInfo.subresourceRange.baseArrayLayer  = subresource.baseArrayLayer;
+        createInfo.subresourceRange.layerCount      = subresource.numArrayLayers;
+    }
+    auto result = vkCreateImageView(device, &createInfo, nullptr, imageView_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan image view for texture-view");
 }
 
 Extent3D VKTexture::GetMipExtent(std::uint32_t mipLevel) const
@@ -144,6 +215,433 @@ void VKTexture::CreateInternalImageView(VkDevice device)
     CreateImageView(device, 0, GetNumMipLevels(), 0, GetNumArrayLayers(), imageView_.ReleaseAndGetAddressOf());
 }
 
+VkImageView VKTexture::GetOrCreateAttachmentView(const VKPtr<VkDevice>& device, std::uint32_t mipLevel, std::uint32_t arrayLayer)
+{
+    /* Search cached attachment views first */
+    for (const auto& attachmentView : attachmentViews_)
+    {
+        if (attachmentView.mipLevel == mipLevel && attachmentView.arrayLayer == arrayLayer)
+            return attachmentView.imageView.Get();
+    }
+
+    /* Create new image view for the specified MIP-map level and array layer */
+    VKPtr<VkImageView> imageView { device, vkDestroyImageView };
+    CreateImageView(device, mipLevel, 1, arrayLayer, 1, imageView.ReleaseAndGetAddressOf());
+
+    attachmentViews_.push_back({ mipLevel, arrayLayer, std::move(imageView) });
+    return attachmentViews_.back().imageView.Get();
+}
+
+/* ----- Image layout tracking ----- */
+
+// Returns the access and pipeline-stage flags that correspond to the specified image layout
+static void GetLayoutAccessAndStageFlags(VkImageLayout layout, VkAccessFlags& accessFlags, VkPipelineStageFlags& stageFlags)
+{
+    switch (layout)
+    {
+        case VK_IMAGE_LAYOUT_UNDEFINED:
+        case VK_IMAGE_LAYOUT_PREINITIALIZED:
+            accessFlags = 0;
+            stageFlags  = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+            accessFlags = VK_ACCESS_TRANSFER_READ_BIT;
+            stageFlags  = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+            accessFlags = VK_ACCESS_TRANSFER_WRITE_BIT;
+            stageFlags  = VK_PIPELINE_STAGE_TRANSFER_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+            accessFlags = VK_ACCESS_SHADER_READ_BIT;
+            stageFlags  = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+            accessFlags = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+            stageFlags  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+            break;
+        case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+            accessFlags = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+            stageFlags  = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+            break;
+        default:
+            accessFlags = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+            stageFlags  = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+            break;
+    }
+}
+
+// Initializes the image memory barrier for the specified subresource range transition
+static void InitImageMemoryBarrier(
+    VkImageMemoryBarrier&   barrier,
+    VkImage                 image,
+    VkImageAspectFlags      aspectFlags,
+    VkImageLayout           oldLayout,
+    VkImageLayout           newLayout,
+    std::uint32_t           baseMipLevel,
+    std::uint32_t           numMipLevels,
+    std::uint32_t           baseArrayLayer,
+    std::uint32_t           numArrayLayers)
+{
+    VkPipelineStageFlags stageFlags = 0;
+
+    barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    barrier.pNext                           = nullptr;
+    GetLayoutAccessAndStageFlags(oldLayout, barrier.srcAccessMask, stageFlags);
+    GetLayoutAccessAndStageFlags(newLayout, barrier.dstAccessMask, stageFlags);
+    barrier.oldLayout                       = oldLayout;
+    barrier.newLayout                       = newLayout;
+    barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image                           = image;
+    barrier.subresourceRange.aspectMask     = aspectFlags;
+    barrier.subresourceRange.baseMipLevel   = baseMipLevel;
+    barrier.subresourceRange.levelCount     = numMipLevels;
+    barrier.subresourceRange.baseArrayLayer = baseArrayLayer;
+    barrier.subresourceRange.layerCount     = numArrayLayers;
+}
+
+void VKTexture::TransitionSubresourceLayouts(
+    VkCommandBuffer             commandBuffer,
+    VkImageLayout               newLayout,
+    const TextureSubresource*   subresources,
+    std::uint32_t               numSubresources)
+{
+    SmallVector<VkImageMemoryBarrier, 8> barriers;
+
+    VkPipelineStageFlags    srcStageMask    = 0;
+    VkPipelineStageFlags    dstStageMask    = 0;
+    VkPipelineStageFlags    oldStageFlags   = 0;
+    VkAccessFlags           oldAccessFlags  = 0;
+
+    GetLayoutAccessAndStageFlags(newLayout, oldAccessFlags, dstStageMask);
+
+    const auto aspectFlags = GetAspectFlags();
+
+    for (std::uint32_t i = 0; i < numSubresources; ++i)
+    {
+        const auto& subresource = subresources[i];
+
+        for (std::uint32_t mipLevel = subresource.baseMipLevel; mipLevel < subresource.baseMipLevel + subresource.numMipLevels; ++mipLevel)
+        {
+            /* Check whether all layers of this MIP-map level share the same tracked layout */
+            auto oldLayout      = GetSubresourceLayout(mipLevel, subresource.baseArrayLayer);
+            bool uniformLayers  = true;
+
+            for (std::uint32_t arrayLayer = subresource.baseArrayLayer + 1; arrayLayer < subresource.baseArrayLayer + subresource.numArrayLayers; ++arrayLayer)
+            {
+                if (GetSubresourceLayout(mipLevel, arrayLayer) != oldLayout)
+                {
+                    uniformLayers = false;
+                    break;
+                }
+            }
+
+            if (uniformLayers)
+            {
+                /* Elide no-op transition for this MIP-map level */
+                if (oldLayout == newLayout)
+                    continue;
+
+                /* Extend the previous barrier if this MIP-map level continues its range with the same layout */
+                if (!barriers.empty())
+                {
+                    auto& prevRange = barriers.back().subresourceRange;
+                    if ( barriers.back().oldLayout          == oldLayout                    &&
+                         prevRange.baseMipLevel + prevRange.levelCount == mipLevel          &&
+                         prevRange.baseArrayLayer           == subresource.baseArrayLayer   &&
+                         prevRange.layerCount               == subresource.numArrayLayers )
+                    {
+                        ++prevRange.levelCount;
+                        continue;
+                    }
+                }
+
+                barriers.push_back(VkImageMemoryBarrier{});
+                InitImageMemoryBarrier(
+                    barriers.back(), GetVkImage(), aspectFlags, oldLayout, newLayout,
+                    mipLevel, 1, subresource.baseArrayLayer, subresource.numArrayLayers
+                );
+                GetLayoutAccessAndStageFlags(oldLayout, oldAccessFlags, oldStageFlags);
+                srcStageMask |= oldStageFlags;
+            }
+            else
+            {
+                /* Mixed layouts across layers: transition each diverging layer individually */
+                for (std::uint32_t arrayLayer = subresource.baseArrayLayer; arrayLayer < subresource.baseArrayLayer + subresource.numArrayLayers; ++arrayLayer)
+                {
+                    oldLayout = GetSubresourceLayout(mipLevel, arrayLayer);
+                    if (oldLayout == newLayout)
+                        continue;
+
+                    barriers.push_back(VkImageMemoryBarrier{});
+                    InitImageMemoryBarrier(
+                        barriers.back(), GetVkImage(), aspectFlags, oldLayout, newLayout,
+                        mipLevel, 1, arrayLayer, 1
+                    );
+                    GetLayoutAccessAndStageFlags(oldLayout, oldAccessFlags, oldStageFlags);
+                    srcStageMask |= oldStageFlags;
+                }
+            }
+        }
+
+        /* Update tracked layouts for the entire range */
+        SetSubresourceLayouts(subresource, newLayout);
+    }
+
+    /* Record all transitions as a single batched barrier command */
+    if (!barriers.empty())
+    {
+        vkCmdPipelineBarrier(
+            commandBuffer,
+            srcStageMask,
+            dstStageMask,
+            0,
+            0, nullptr,
+            0, nullptr,
+            static_cast<std::uint32_t>(barriers.size()), barriers.data()
+        );
+    }
+}
+
+void VKTexture::TransitionSubresourceLayouts(
+    VkCommandBuffer             commandBuffer,
+    VkImageLayout               newLayout,
+    const TextureSubresource&   subresource)
+{
+    TransitionSubresourceLayouts(commandBuffer, newLayout, &subresource, 1);
+}
+
+void VKTexture::SetSubresourceLayouts(const TextureSubresource& subresource, VkImageLayout layout)
+{
+    for (std::uint32_t mipLevel = subresource.baseMipLevel; mipLevel < subresource.baseMipLevel + subresource.numMipLevels; ++mipLevel)
+    {
+        for (std::uint32_t arrayLayer = subresource.baseArrayLayer; arrayLayer < subresource.baseArrayLayer + subresource.numArrayLayers; ++arrayLayer)
+        {
+            const auto subresourceIndex = static_cast<std::size_t>(mipLevel) * numArrayLayers_ + arrayLayer;
+            if (subresourceIndex < subresourceLayouts_.size())
+                subresourceLayouts_[subresourceIndex] = layout;
+        }
+    }
+}
+
+VkImageLayout VKTexture::GetSubresourceLayout(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
+{
+    const auto subresourceIndex = static_cast<std::size_t>(mipLevel) * numArrayLayers_ + arrayLayer;
+    return (subresourceIndex < subresourceLayouts_.size() ? subresourceLayouts_[subresourceIndex] : VK_IMAGE_LAYOUT_UNDEFINED);
+}
+
+VkDescriptorSet VKTexture::GetMipDescriptorSet(std::uint32_t baseMipLevel) const
+{
+    if (baseMipLevel < mipDescSets_.size())
+        return mipDescSets_[baseMipLevel];
+    else
+        return VK_NULL_HANDLE;
+}
+
+bool VKTexture::BindSparseMipRange(
+    VkQueue                 queue,
+    VKDeviceMemoryManager&  deviceMemoryMngr,
+    std::uint32_t           baseMipLevel,
+    std::uint32_t           numMipLevels,
+    bool                    resident)
+{
+    if (!sparseResidency_ || baseMipLevel >= numMipLevels_ || numMipLevels == 0)
+        return false;
+
+    auto device = deviceMemoryMngr.GetVkDevice();
+
+    /* Clamp MIP-map level range to the levels of this texture */
+    numMipLevels = std::min(numMipLevels, numMipLevels_ - baseMipLevel);
+
+    /* Query sparse memory requirements for the aspect of this texture's format */
+    std::uint32_t numSparseRequirements = 0;
+    vkGetImageSparseMemoryRequirements(device, GetVkImage(), &numSparseRequirements, nullptr);
+    if (numSparseRequirements == 0)
+        return false;
+
+    std::vector<VkSparseImageMemoryRequirements> sparseRequirements(numSparseRequirements);
+    vkGetImageSparseMemoryRequirements(device, GetVkImage(), &numSparseRequirements, sparseRequirements.data());
+
+    const VkSparseImageMemoryRequirements* sparseRequirement = nullptr;
+
+    for (const auto& requirement : sparseRequirements)
+    {
+        if ((requirement.formatProperties.aspectMask & GetAspectFlags()) != 0)
+        {
+            sparseRequirement = &requirement;
+            break;
+        }
+    }
+
+    if (sparseRequirement == nullptr)
+        return false;
+
+    /* Query common memory requirements; for sparse images, the alignment denotes the sparse block size (in bytes) */
+    VkMemoryRequirements requirements;
+    vkGetImageMemoryRequirements(device, GetVkImage(), &requirements);
+
+    const auto sparseBlockSize  = requirements.alignment;
+    const auto& granularity     = sparseRequirement->formatProperties.imageGranularity;
+
+    std::vector<VkSparseImageMemoryBind>    imageBinds;
+    std::vector<VkSparseMemoryBind>         opaqueBinds;
+
+    for (auto mipLevel = baseMipLevel; mipLevel < baseMipLevel + numMipLevels; ++mipLevel)
+    {
+        /* MIP-map levels within the MIP tail are bound as a whole (see below) */
+        if (mipLevel >= sparseRequirement->imageMipTailFirstLod)
+            continue;
+
+        /* Ignore MIP-map levels whose residency is already up to date */
+        if (resident == (sparseMipRegions_[mipLevel] != nullptr))
+            continue;
+
+        /* Determine number of sparse blocks this MIP-map level occupies per array layer */
+        const VkExtent3D mipExtent
+        {
+            std::max(1u, extent_.width  >> mipLevel),
+            std::max(1u, extent_.height >> mipLevel),
+            std::max(1u, extent_.depth  >> mipLevel)
+        };
+
+        const VkDeviceSize numBlocks =
+        (
+            static_cast<VkDeviceSize>((mipExtent.width  + granularity.width  - 1) / granularity.width ) *
+            static_cast<VkDeviceSize>((mipExtent.height + granularity.height - 1) / granularity.height) *
+            static_cast<VkDeviceSize>((mipExtent.depth  + granularity.depth  - 1) / granularity.depth )
+        );
+        const auto layerSize = numBlocks * sparseBlockSize;
+
+        /* Allocate one device memory region that covers this MIP-map level across all array layers */
+        VKDeviceMemoryRegion* region = nullptr;
+
+        if (resident)
+        {
+            region = deviceMemoryMngr.Allocate(
+                layerSize * numArrayLayers_,
+                sparseBlockSize,
+                requirements.memoryTypeBits,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+            );
+            if (region == nullptr)
+                return false;
+        }
+
+        for (std::uint32_t arrayLayer = 0; arrayLayer < numArrayLayers_; ++arrayLayer)
+        {
+            VkSparseImageMemoryBind bind;
+            {
+                bind.subresource.aspectMask = sparseRequirement->formatProperties.aspectMask;
+                bind.subresource.mipLevel   = mipLevel;
+                bind.subresource.arrayLayer = arrayLayer;
+                bind.offset                 = { 0, 0, 0 };
+                bind.extent                 = mipExtent;
+                bind.memory                 = (resident ? region->GetParentChunk()->GetVkDeviceMemory() : VK_NULL_HANDLE);
+                bind.memoryOffset           = (resident ? region->GetOffset() + layerSize * arrayLayer : 0);
+                bind.flags                  = 0;
+            }
+            imageBinds.push_back(bind);
+        }
+
+        if (!resident)
+            deviceMemoryMngr.Release(sparseMipRegions_[mipLevel]);
+        sparseMipRegions_[mipLevel] = region;
+    }
+
+    /* Bind or evict the MIP tail if the range overlaps it */
+    if ( baseMipLevel + numMipLevels > sparseRequirement->imageMipTailFirstLod &&
+         sparseRequirement->imageMipTailSize > 0                              &&
+         resident != (sparseMipTailRegion_ != nullptr) )
+    {
+        const bool singleMipTail    = ((sparseRequirement->formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0);
+        const auto numTailLayers    = (singleMipTail ? 1u : numArrayLayers_);
+
+        VKDeviceMemoryRegion* region = nullptr;
+
+        if (resident)
+        {
+            region = deviceMemoryMngr.Allocate(
+                sparseRequirement->imageMipTailSize * numTailLayers,
+                sparseBlockSize,
+                requirements.memoryTypeBits,
+                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+            );
+            if (region == nullptr)
+                return false;
+        }
+
+        for (std::uint32_t arrayLayer = 0; arrayLayer < numTailLayers; ++arrayLayer)
+        {
+            VkSparseMemoryBind bind;
+            {
+                bind.resourceOffset = sparseRequirement->imageMipTailOffset + sparseRequirement->imageMipTailStride * arrayLayer;
+                bind.size           = sparseRequirement->imageMipTailSize;
+                bind.memory         = (resident ? region->GetParentChunk()->GetVkDeviceMemory() : VK_NULL_HANDLE);
+                bind.memoryOffset   = (resident ? region->GetOffset() + sparseRequirement->imageMipTailSize * arrayLayer : 0);
+                bind.flags          = 0;
+            }
+            opaqueBinds.push_back(bind);
+        }
+
+        if (!resident)
+            deviceMemoryMngr.Release(sparseMipTailRegion_);
+        sparseMipTailRegion_ = region;
+    }
+
+    /* Residency of the entire range was already up to date */
+    if (imageBinds.empty() && opaqueBinds.empty())
+        return true;
+
+    /* Submit sparse binding operation and wait until it has completed on the queue */
+    VkSparseImageMemoryBindInfo imageBindInfo;
+    {
+        imageBindInfo.image     = GetVkImage();
+        imageBindInfo.bindCount = static_cast<std::uint32_t>(imageBinds.size());
+        imageBindInfo.pBinds    = imageBinds.data();
+    }
+    VkSparseImageOpaqueMemoryBindInfo opaqueBindInfo;
+    {
+        opaqueBindInfo.image        = GetVkImage();
+        opaqueBindInfo.bindCount    = static_cast<std::uint32_t>(opaqueBinds.size());
+        opaqueBindInfo.pBinds       = opaqueBinds.data();
+    }
+    VkBindSparseInfo bindSparseInfo;
+    {
+        bindSparseInfo.sType                = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+        bindSparseInfo.pNext                = nullptr;
+        bindSparseInfo.waitSemaphoreCount   = 0;
+        bindSparseInfo.pWaitSemaphores      = nullptr;
+        bindSparseInfo.bufferBindCount      = 0;
+        bindSparseInfo.pBufferBinds         = nullptr;
+        bindSparseInfo.imageOpaqueBindCount = (opaqueBinds.empty() ? 0 : 1);
+        bindSparseInfo.pImageOpaqueBinds    = (opaqueBinds.empty() ? nullptr : &opaqueBindInfo);
+        bindSparseInfo.imageBindCount       = (imageBinds.empty() ? 0 : 1);
+        bindSparseInfo.pImageBinds          = (imageBinds.empty() ? nullptr : &imageBindInfo);
+        bindSparseInfo.signalSemaphoreCount = 0;
+        bindSparseInfo.pSignalSemaphores    = nullptr;
+    }
+    std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(queue) };
+
+    auto result = vkQueueBindSparse(queue, 1, &bindSparseInfo, VK_NULL_HANDLE);
+    VKThrowIfFailed(result, "failed to bind sparse memory to Vulkan image");
+
+    vkQueueWaitIdle(queue);
+
+    return true;
+}
+
+void VKTexture::ReleaseSparseMemoryRegions(VKDeviceMemoryManager& deviceMemoryMngr)
+{
+    for (auto& region : sparseMipRegions_)
+    {
+        deviceMemoryMngr.Release(region);
+        region = nullptr;
+    }
+    deviceMemoryMngr.Release(sparseMipTailRegion_);
+    sparseMipTailRegion_ = nullptr;
+}
+
 
 /*
  * ======= Private: =======
@@ -168,6 +666,10 @@ static VkImageCreateFlags GetVkImageCreateFlags(const TextureDescriptor& desc)
             break;
     }
 
+    /* Sparse textures are created without bound memory and have their MIP-map levels bound on demand */
+    if ((desc.miscFlags & MiscFlags::SparseResidency) != 0)
+        createFlags |= (VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT);
+
     return createFlags;
 }
 
@@ -274,6 +776,10 @@ static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
     if ((desc.bindFlags & BindFlags::Storage) != 0)
         usageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
 
+    /* Enable sampled and storage image usage when MIP-maps are generated with the compute downsampler */
+    if (VKMipGenerator::Get().SupportsTexture(desc))
+        usageFlags |= (VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT);
+
     #if 0//???
     /* Enable input attachment bit when used for reading AND as attachment */
     if ( (desc.bindFlags & (BindFlags::Sampled         | BindFlags::Storage               )) != 0 &&
@@ -309,6 +815,119 @@ void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
     );
 }
 
+void VKTexture::CreateMipChainDescriptorSets(const VKPtr<VkDevice>& device)
+{
+    auto& mipGenerator = VKMipGenerator::Get();
+
+    const auto numDescSets = numMipLevels_ - 1;
+
+    /* Create source image view covering the entire MIP-map chain; cube images are compatible with 2D-array views */
+    imageWrapper_.CreateVkImageView(
+        device,
+        VK_IMAGE_VIEW_TYPE_2D_ARRAY,
+        format_,
+        GetAspectFlags(),
+        0,
+        numMipLevels_,
+        0,
+        numArrayLayers_,
+        mipChainSrcView_.ReleaseAndGetAddressOf()
+    );
+
+    /* Create destination image views for all MIP-map levels after the first one */
+    mipChainDstViews_.reserve(numDescSets);
+
+    for (std::uint32_t mipLevel = 1; mipLevel < numMipLevels_; ++mipLevel)
+    {
+        mipChainDstViews_.emplace_back(device, vkDestroyImageView);
+        imageWrapper_.CreateVkImageView(
+            device,
+            VK_IMAGE_VIEW_TYPE_2D_ARRAY,
+            format_,
+            GetAspectFlags(),
+            mipLevel,
+            1,
+            0,
+            numArrayLayers_,
+            mipChainDstViews_.back().ReleaseAndGetAddressOf()
+        );
+    }
+
+    /* Create descriptor pool with one set for each source MIP-map level */
+    VkDescriptorPoolSize poolSizes[2];
+
+    poolSizes[0].type               = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    poolSizes[0].descriptorCount    = numDescSets;
+
+    poolSizes[1].type               = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    poolSizes[1].descriptorCount    = numDescSets * 4;
+
+    VkDescriptorPoolCreateInfo poolCreateInfo;
+    {
+        poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        poolCreateInfo.pNext            = nullptr;
+        poolCreateInfo.flags            = 0;
+        poolCreateInfo.maxSets          = numDescSets;
+        poolCreateInfo.poolSizeCount    = 2;
+        poolCreateInfo.pPoolSizes       = poolSizes;
+    }
+    auto result = vkCreateDescriptorPool(device, &poolCreateInfo, nullptr, mipDescPool_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan descriptor pool for MIP-map generation");
+
+    /* Allocate one descriptor set for each source MIP-map level */
+    std::vector<VkDescriptorSetLayout> setLayouts(numDescSets, mipGenerator.GetDescriptorSetLayout());
+
+    VkDescriptorSetAllocateInfo allocInfo;
+    {
+        allocInfo.sType                 = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.pNext                 = nullptr;
+        allocInfo.descriptorPool        = mipDescPool_;
+        allocInfo.descriptorSetCount    = numDescSets;
+        allocInfo.pSetLayouts           = setLayouts.data();
+    }
+    mipDescSets_.resize(numDescSets);
+    result = vkAllocateDescriptorSets(device, &allocInfo, mipDescSets_.data());
+    VKThrowIfFailed(result, "failed to allocate Vulkan descriptor sets for MIP-map generation");
+
+    /* Write source MIP-map chain and the next 4 destination MIP-map levels into each descriptor set */
+    for (std::uint32_t mipLevel = 0; mipLevel < numDescSets; ++mipLevel)
+    {
+        VkDescriptorImageInfo imageInfos[5];
+
+        imageInfos[0].sampler       = VK_NULL_HANDLE; // immutable sampler in the set layout
+        imageInfos[0].imageView     = mipChainSrcView_;
+        imageInfos[0].imageLayout   = VK_IMAGE_LAYOUT_GENERAL;
+
+        for (std::uint32_t i = 1; i <= 4; ++i)
+        {
+            /* Clamp to the last MIP-map level; the shader never writes beyond its 'numMipLevels' push constant */
+            const auto dstMipLevel = std::min(mipLevel + i, numMipLevels_ - 1);
+
+            imageInfos[i].sampler       = VK_NULL_HANDLE;
+            imageInfos[i].imageView     = mipChainDstViews_[dstMipLevel - 1];
+            imageInfos[i].imageLayout   = VK_IMAGE_LAYOUT_GENERAL;
+        }
+
+        VkWriteDescriptorSet writes[5];
+
+        for (std::uint32_t i = 0; i < 5; ++i)
+        {
+            writes[i].sType             = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writes[i].pNext             = nullptr;
+            writes[i].dstSet            = mipDescSets_[mipLevel];
+            writes[i].dstBinding        = i;
+            writes[i].dstArrayElement   = 0;
+            writes[i].descriptorCount   = 1;
+            writes[i].descriptorType    = (i == 0 ? VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER : VK_DESCRIPTOR_TYPE_STORAGE_IMAGE);
+            writes[i].pImageInfo        = &(imageInfos[i]);
+            writes[i].pBufferInfo       = nullptr;
+            writes[i].pTexelBufferView  = nullptr;
+        }
+
+        vkUpdateDescriptorSets(device, 5, writes, 0, nullptr);
+    }
+}
+
 static VkImageAspectFlags GetAspectFlagsByFormat(VkFormat format)
 {
     switch (format)
@@ -14,6 +14,7 @@
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include <cstdint>
+#include <vector>
 
 
 namespace LLGL
@@ -23,6 +24,14 @@ namespace LLGL
 class VKDeviceMemoryRegion;
 class VKDeviceMemoryManager;
 
+// Image view for a single MIP-map level and array layer; cached for render-target attachments (see VKFramebufferCache).
+struct VKAttachmentView
+{
+    std::uint32_t       mipLevel;
+    std::uint32_t       arrayLayer;
+    VKPtr<VkImageView>  imageView;
+};
+
 class VKTexture final : public Texture
 {
 
@@ -34,6 +43,13 @@ class VKTexture final : public Texture
             const TextureDescriptor&    desc
         );
 
+        // Constructor for texture-views: shares the VkImage of the specified texture (which must outlive this view).
+        VKTexture(
+            const VKPtr<VkDevice>&          device,
+            VKTexture&                      sharedTexture,
+            const TextureViewDescriptor&    textureViewDesc
+        );
+
         Extent3D GetMipExtent(std::uint32_t mipLevel) const override;
         TextureDescriptor GetDesc() const override;
 
@@ -50,10 +66,93 @@ class VKTexture final : public Texture
 
         void CreateInternalImageView(VkDevice device);
 
+        /*
+        Returns an image view for the specified MIP-map level and array layer,
+        created on first use and cached for the lifetime of this texture.
+        */
+        VkImageView GetOrCreateAttachmentView(const VKPtr<VkDevice>& device, std::uint32_t mipLevel, std::uint32_t arrayLayer);
+
+        // Returns the list of cached attachment image views (see GetOrCreateAttachmentView).
+        inline const std::vector<VKAttachmentView>& GetAttachmentViews() const
+        {
+            return attachmentViews_;
+        }
+
+        /* ----- Image layout tracking ----- */
+
+        /*
+        Records the layout transitions that bring the specified subresource ranges into the new layout, as a single batched barrier.
+        Subresources that already are in the new layout are elided; the tracked layouts are updated accordingly.
+        */
+        void TransitionSubresourceLayouts(
+            VkCommandBuffer             commandBuffer,
+            VkImageLayout               newLayout,
+            const TextureSubresource*   subresources,
+            std::uint32_t               numSubresources
+        );
+
+        // Records the layout transitions for a single subresource range (see above).
+        void TransitionSubresourceLayouts(
+            VkCommandBuffer             commandBuffer,
+            VkImageLayout               newLayout,
+            const TextureSubresource&   subresource
+        );
+
+        // Overrides the tracked layout of the specified subresources; used when a transition is recorded externally (e.g. staging ring or MIP generator).
+        void SetSubresourceLayouts(const TextureSubresource& subresource, VkImageLayout layout);
+
+        // Returns the tracked layout of the specified subresource.
+        VkImageLayout GetSubresourceLayout(std::uint32_t mipLevel, std::uint32_t arrayLayer) const;
+
+        /*
+        Binds or evicts device memory for the specified range of MIP-map levels of a sparse texture.
+        This is a blocking operation, i.e. it waits until the sparse binding has completed on the specified queue.
+        */
+        bool BindSparseMipRange(
+            VkQueue                 queue,
+            VKDeviceMemoryManager&  deviceMemoryMngr,
+            std::uint32_t           baseMipLevel,
+            std::uint32_t           numMipLevels,
+            bool                    resident
+        );
+
+        // Releases all device memory regions that have been bound to this sparse texture.
+        void ReleaseSparseMemoryRegions(VKDeviceMemoryManager& deviceMemoryMngr);
+
+        /*
+        Returns the descriptor set to downsample the 4 MIP-map levels after the specified source MIP-map level,
+        or VK_NULL_HANDLE if this texture is not supported by the compute downsampler (see VKMipGenerator).
+        */
+        VkDescriptorSet GetMipDescriptorSet(std::uint32_t baseMipLevel) const;
+
+        // Returns true if this texture was created with sparse residency (see MiscFlags::SparseResidency).
+        inline bool IsSparseTexture() const
+        {
+            return sparseResidency_;
+        }
+
+        // Sets the staging upload token of the deferred initial upload (see MiscFlags::DeferredUpload).
+        inline void SetUploadBatchToken(std::uint64_t token)
+        {
+            uploadBatchToken_ = token;
+        }
+
+        // Returns the staging upload token of the deferred initial upload, or 0 if no ring upload is pending.
+        inline std::uint64_t GetUploadBatchToken() const
+        {
+            return uploadBatchToken_;
+        }
+
+        // Returns true if this texture was created as a texture-view of another texture.
+        inline bool IsTextureView() const
+        {
+            return (sharedVkImage_ != VK_NULL_HANDLE);
+        }
+
         // Returns the Vulkan image object.
         inline VkImage GetVkImage() const
         {
-            return imageWrapper_.GetVkImage();
+            return (sharedVkImage_ != VK_NULL_HANDLE ? sharedVkImage_ : imageWrapper_.GetVkImage());
         }
 
         // Returns the internal Vulkan image view object (created with 'CreateInternalImageView').
@@ -96,17 +195,35 @@ class VKTexture final : public Texture
 
         void CreateImage(VkDevice device, const TextureDescriptor& desc);
 
+        void CreateMipChainDescriptorSets(const VKPtr<VkDevice>& device);
+
         VkImageAspectFlags GetAspectFlags() const;
 
     private:
 
-        VKDeviceImage       imageWrapper_;
-        VKPtr<VkImageView>  imageView_;
+        VKDeviceImage                       imageWrapper_;
+        VkImage                             sharedVkImage_          = VK_NULL_HANDLE; // Non-owning image handle for texture-views
+        VKPtr<VkImageView>                  imageView_;
+
+        VkFormat                            format_                 = VK_FORMAT_UNDEFINED;
+        VkExtent3D                          extent_;
+        std::uint32_t                       numMipLevels_           = 0;
+        std::uint32_t                       numArrayLayers_         = 0;
+
+        bool                                sparseResidency_        = false;
+        std::vector<VKDeviceMemoryRegion*>  sparseMipRegions_;
+        VKDeviceMemoryRegion*               sparseMipTailRegion_    = nullptr;
+
+        std::uint64_t                       uploadBatchToken_       = 0;
+
+        std::vector<VKAttachmentView>       attachmentViews_;
+        std::vector<VkImageLayout>          subresourceLayouts_;    // Tracked layout per subresource; indexed by (mipLevel * numArrayLayers + arrayLayer)
 
-        VkFormat            format_         = VK_FORMAT_UNDEFINED;
-        VkExtent3D          extent_;
-        std::uint32_t       numMipLevels_   = 0;
-        std::uint32_t       numArrayLayers_ = 0;
+        /* Image views and descriptor sets for the compute downsampler (see VKMipGenerator) */
+        VKPtr<VkImageView>                  mipChainSrcView_;
+        std::vector<VKPtr<VkImageView>>     mipChainDstViews_;
+        VKPtr<VkDescriptorPool>             mipDescPool_;
+        std::vector<VkDescriptorSet>        mipDescSets_;
 
 };
 
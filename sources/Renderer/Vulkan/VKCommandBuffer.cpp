@@ -18,12 +18,14 @@
 #include "RenderState/VKQueryHeap.h"
 #include "Texture/VKSampler.h"
 #include "Texture/VKTexture.h"
+#include "Texture/VKMipGenerator.h"
 #include "Texture/VKRenderTarget.h"
 #include "Buffer/VKBuffer.h"
 #include "Buffer/VKBufferArray.h"
 #include "../CheckedCast.h"
 #include "../StaticLimits.h"
 #include "../../Core/Exception.h"
+#include <algorithm>
 #include <cstddef>
 
 
@@ -61,12 +63,28 @@ VKCommandBuffer::VKCommandBuffer(
         usageFlags_     = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
         bufferLevel_    = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
     }
+    else if ((desc.flags & CommandBufferFlags::MultiSubmit) != 0)
+    {
+        /* Allow the native command buffer to be re-submitted while it is still pending execution */
+        usageFlags_     = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+
+        /* Record-once/submit-many command buffers don't benefit from multiple native buffers */
+        bufferCount     = 1;
+    }
 
-    /* Create native command buffer objects */
-    CreateCommandPool(queueFamilyIndices.graphicsFamily);
+    /* Create native command buffer objects; compute-only command buffers allocate from the compute queue family */
+    if ((desc.flags & CommandBufferFlags::ComputeOnly) != 0)
+        CreateCommandPool(queueFamilyIndices.computeFamily);
+    else
+        CreateCommandPool(queueFamilyIndices.graphicsFamily);
     CreateCommandBuffers(bufferCount);
     CreateRecordingFences(graphicsQueue, bufferCount);
 
+    /* Create one transient descriptor pool chain per native command buffer */
+    transientDescriptorPools_.reserve(bufferCount);
+    for (std::size_t i = 0; i < bufferCount; ++i)
+        transientDescriptorPools_.emplace_back(device_.GetVkDevice());
+
     /* Acquire first native command buffer */
     AcquireNextBuffer();
 }
@@ -89,24 +107,51 @@ void VKCommandBuffer::Begin()
     AcquireNextBuffer();
 
     /* Wait for fence before recording */
-    vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
-    vkResetFences(device_, 1, &recordingFence_);
+    if (batchFenceList_[commandBufferIndex_] != VK_NULL_HANDLE)
+    {
+        /* The last submission was batched: wait on the shared batch fence; the recording fence was left unsignaled */
+        vkWaitForFences(device_, 1, &batchFenceList_[commandBufferIndex_], VK_TRUE, UINT64_MAX);
+        batchFenceList_[commandBufferIndex_] = VK_NULL_HANDLE;
+    }
+    else
+    {
+        vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
+        vkResetFences(device_, 1, &recordingFence_);
+    }
 
-    /* Begin recording of current command buffer */
-    VkCommandBufferBeginInfo beginInfo;
+    /* Fence retirement guarantees the GPU no longer reads transient descriptor sets of this native command buffer */
+    transientDescriptorPools_[commandBufferIndex_].Reset();
+
+    if (IsSecondaryCmdBuffer())
     {
-        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-        beginInfo.pNext             = nullptr;
-        beginInfo.flags             = usageFlags_;
-        beginInfo.pInheritanceInfo  = nullptr;
+        /*
+        Defer the native begin until the render pass section is known (see "BeginRenderPass"),
+        since secondary command buffers must declare the inherited render pass in their begin-info.
+        */
+        pendingNativeBegin_ = true;
     }
-    auto result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
-    VKThrowIfFailed(result, "failed to begin Vulkan command buffer");
+    else
+    {
+        /* Begin recording of current command buffer */
+        BeginNativeCommandBuffer(VK_NULL_HANDLE, VK_NULL_HANDLE);
 
-    #if 1//TODO: optimize
-    /* Reset all query pools that were in flight during last encoding */
-    ResetQueryPoolsInFlight();
-    #endif
+        #if 1//TODO: optimize
+        /* Reset all query pools that were in flight during last encoding */
+        ResetQueryPoolsInFlight();
+        #endif
+    }
+
+    /* Reset split resource transitions and deferred render pass end from the last encoding */
+    pendingSplitBarriers_.clear();
+    numSplitBarrierEventsInUse_ = 0;
+    deferredRenderPassEnd_      = false;
+    deferredFramebuffer_        = VK_NULL_HANDLE;
+
+    /* Reset copy batch from the last encoding */
+    insideCopyBatch_            = false;
+    copyBatchSrcBuffer_         = VK_NULL_HANDLE;
+    copyBatchDstBuffer_         = VK_NULL_HANDLE;
+    copyBatchRegions_.clear();
 
     /* Store new record state */
     recordState_ = RecordState::OutsideRenderPass;
@@ -114,6 +159,16 @@ void VKCommandBuffer::Begin()
 
 void VKCommandBuffer::End()
 {
+    /* Begin native command buffer now if no render pass section was recorded (e.g. for an empty secondary command buffer) */
+    if (pendingNativeBegin_)
+        BeginNativeCommandBuffer(VK_NULL_HANDLE, VK_NULL_HANDLE);
+
+    /* End copy batch if it was not ended explicitly */
+    EndCopyBatch();
+
+    /* End last render pass instance if its end was deferred */
+    FlushDeferredRenderPassEnd();
+
     /* End encoding of current command buffer */
     auto result = vkEndCommandBuffer(commandBuffer_);
     VKThrowIfFailed(result, "failed to end Vulkan command buffer");
@@ -126,7 +181,24 @@ void VKCommandBuffer::Execute(CommandBuffer& deferredCommandBuffer)
 {
     auto& cmdBufferVK = LLGL_CAST(VKCommandBuffer&, deferredCommandBuffer);
     VkCommandBuffer cmdBuffers[] = { cmdBufferVK.GetVkCommandBuffer() };
-    vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+
+    if (IsInsideRenderPass())
+    {
+        /*
+        A subpass must be recorded either entirely inline or entirely with secondary command buffers,
+        so restart the current render pass instance with secondary contents around the execution.
+        */
+        PauseRenderPass();
+        ResumeRenderPass(VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+        vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+        PauseRenderPass();
+        ResumeRenderPass(VK_SUBPASS_CONTENTS_INLINE);
+    }
+    else
+    {
+        FlushDeferredRenderPassEnd();
+        vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+    }
 }
 
 /* ----- Blitting ----- */
@@ -142,6 +214,9 @@ void VKCommandBuffer::UpdateBuffer(
     auto size   = static_cast<VkDeviceSize>(dataSize);
     auto offset = static_cast<VkDeviceSize>(dstOffset);
 
+    /* Keep batched copies in order with respect to this inline update */
+    FlushCopyBatch();
+
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
@@ -149,7 +224,10 @@ void VKCommandBuffer::UpdateBuffer(
         ResumeRenderPass();
     }
     else
+    {
+        FlushDeferredRenderPassEnd();
         vkCmdUpdateBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, data);
+    }
 }
 
 void VKCommandBuffer::CopyBuffer(
@@ -169,14 +247,28 @@ void VKCommandBuffer::CopyBuffer(
         region.size         = static_cast<VkDeviceSize>(size);
     }
 
-    if (IsInsideRenderPass())
+    if (insideCopyBatch_ && !IsInsideRenderPass())
+    {
+        /* Merge region into pending copy group; a group covers consecutive copies with the same source and destination */
+        if (copyBatchSrcBuffer_ != srcBufferVK.GetVkBuffer() || copyBatchDstBuffer_ != dstBufferVK.GetVkBuffer())
+        {
+            FlushCopyBatch();
+            copyBatchSrcBuffer_ = srcBufferVK.GetVkBuffer();
+            copyBatchDstBuffer_ = dstBufferVK.GetVkBuffer();
+        }
+        copyBatchRegions_.push_back(region);
+    }
+    else if (IsInsideRenderPass())
     {
         PauseRenderPass();
         vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
         ResumeRenderPass();
     }
     else
+    {
+        FlushDeferredRenderPassEnd();
         vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
+    }
 }
 
 void VKCommandBuffer::CopyTexture(
@@ -189,19 +281,57 @@ void VKCommandBuffer::CopyTexture(
     //TODO
 }
 
+void VKCommandBuffer::BeginCopyBatch()
+{
+    FlushDeferredRenderPassEnd();
+    insideCopyBatch_ = true;
+}
+
+void VKCommandBuffer::EndCopyBatch()
+{
+    if (insideCopyBatch_)
+    {
+        FlushCopyBatch();
+
+        /* Make the transfer writes of the entire batch visible with a single barrier */
+        VkMemoryBarrier barrier;
+        {
+            barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            barrier.pNext           = nullptr;
+            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask   = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+        }
+        vkCmdPipelineBarrier(
+            commandBuffer_,
+            VK_PIPELINE_STAGE_TRANSFER_BIT,
+            VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+            0,
+            1, &barrier,
+            0, nullptr,
+            0, nullptr
+        );
+
+        insideCopyBatch_ = false;
+    }
+}
+
 void VKCommandBuffer::GenerateMips(Texture& texture)
 {
+    FlushDeferredRenderPassEnd();
+
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
-    device_.GenerateMips(
+    VKMipGenerator::Get().GenerateMips(
+        device_,
         commandBuffer_,
-        textureVK.GetVkImage(),
-        textureVK.GetVkExtent(),
+        textureVK,
         TextureSubresource{ 0, textureVK.GetNumArrayLayers(), 0, textureVK.GetNumMipLevels() }
     );
 }
 
 void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
+    FlushDeferredRenderPassEnd();
+
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
 
     const auto maxNumMipLevels      = textureVK.GetNumMipLevels();
@@ -210,12 +340,7 @@ void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& s
     if (subresource.baseMipLevel   < maxNumMipLevels   && subresource.numMipLevels   > 0 &&
         subresource.baseArrayLayer < maxNumArrayLayers && subresource.numArrayLayers > 0)
     {
-        device_.GenerateMips(
-            commandBuffer_,
-            textureVK.GetVkImage(),
-            textureVK.GetVkExtent(),
-            subresource
-        );
+        VKMipGenerator::Get().GenerateMips(device_, commandBuffer_, textureVK, subresource);
     }
 }
 
@@ -435,7 +560,7 @@ void VKCommandBuffer::SetVertexBuffer(Buffer& buffer)
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
     VkBuffer buffers[] = { bufferVK.GetVkBuffer() };
-    VkDeviceSize offsets[] = { 0 };
+    VkDeviceSize offsets[] = { bufferVK.GetOffset() };
 
     vkCmdBindVertexBuffers(commandBuffer_, 0, 1, buffers, offsets);
 }
@@ -455,13 +580,13 @@ void VKCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 void VKCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
-    vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), 0, bufferVK.GetIndexType());
+    vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), bufferVK.GetOffset(), bufferVK.GetIndexType());
 }
 
 void VKCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
-    vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), offset, VKTypes::ToVkIndexType(format));
+    vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), bufferVK.GetOffset() + offset, VKTypes::ToVkIndexType(format));
 }
 
 /* ----- Stream Output Buffers ------ */
@@ -489,7 +614,12 @@ void VKCommandBuffer::EndStreamOutput()
 /* ----- Resources ----- */
 
 //private
-void VKCommandBuffer::BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelineBindPoint bindingPoint, std::uint32_t firstSet)
+void VKCommandBuffer::BindResourceHeap(
+    VKResourceHeap&         resourceHeapVK,
+    VkPipelineBindPoint     bindingPoint,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
 {
     vkCmdBindDescriptorSets(
         commandBuffer_,
@@ -498,21 +628,41 @@ void VKCommandBuffer::BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelin
         firstSet,
         static_cast<std::uint32_t>(resourceHeapVK.GetVkDescriptorSets().size()),
         resourceHeapVK.GetVkDescriptorSets().data(),
-        0,
-        nullptr
+        numDynamicOffsets,
+        dynamicOffsets
     );
 }
 
 void VKCommandBuffer::SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
 {
     auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
-    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_GRAPHICS, firstSet);
+    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_GRAPHICS, firstSet, 0, nullptr);
 }
 
 void VKCommandBuffer::SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet)
 {
     auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
-    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_COMPUTE, firstSet);
+    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_COMPUTE, firstSet, 0, nullptr);
+}
+
+void VKCommandBuffer::SetGraphicsResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
+    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_GRAPHICS, firstSet, numDynamicOffsets, dynamicOffsets);
+}
+
+void VKCommandBuffer::SetComputeResourceHeap(
+    ResourceHeap&           resourceHeap,
+    std::uint32_t           firstSet,
+    std::uint32_t           numDynamicOffsets,
+    const std::uint32_t*    dynamicOffsets)
+{
+    auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
+    BindResourceHeap(resourceHeapVK, VK_PIPELINE_BIND_POINT_COMPUTE, firstSet, numDynamicOffsets, dynamicOffsets);
 }
 
 void VKCommandBuffer::SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags)
@@ -530,6 +680,70 @@ void VKCommandBuffer::ResetResourceSlots(
     // dummy
 }
 
+void VKCommandBuffer::BeginResourceTransition(Resource& resource, long /*bindFlags*/)
+{
+    FlushDeferredRenderPassEnd();
+
+    /* Acquire next event from the pool, or create a new one */
+    VkEvent event = VK_NULL_HANDLE;
+    if (numSplitBarrierEventsInUse_ < splitBarrierEvents_.size())
+        event = splitBarrierEvents_[numSplitBarrierEventsInUse_].Get();
+    else
+    {
+        VkEventCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        VKPtr<VkEvent> eventVK { device_, vkDestroyEvent };
+        auto result = vkCreateEvent(device_, &createInfo, nullptr, eventVK.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan event for split resource transition");
+
+        event = eventVK.Get();
+        splitBarrierEvents_.emplace_back(std::move(eventVK));
+    }
+    ++numSplitBarrierEventsInUse_;
+
+    /* Signal the event once all previously recorded work has completed */
+    vkCmdSetEvent(commandBuffer_, event, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    pendingSplitBarriers_[&resource] = event;
+}
+
+void VKCommandBuffer::EndResourceTransition(Resource& resource, long /*bindFlags*/)
+{
+    /* Find the matching split transition; ignore unbalanced calls */
+    auto it = pendingSplitBarriers_.find(&resource);
+    if (it == pendingSplitBarriers_.end())
+        return;
+
+    auto event = it->second;
+    pendingSplitBarriers_.erase(it);
+
+    FlushDeferredRenderPassEnd();
+
+    /* Wait for the event and make all prior writes visible; image layouts are handled by the render passes */
+    VkMemoryBarrier barrier;
+    {
+        barrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        barrier.pNext           = nullptr;
+        barrier.srcAccessMask   = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    }
+    vkCmdWaitEvents(
+        commandBuffer_,
+        1, &event,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        1, &barrier,
+        0, nullptr,
+        0, nullptr
+    );
+
+    /* Reset the event so it can be reused by the next encoding */
+    vkCmdResetEvent(commandBuffer_, event, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+}
+
 /* ----- Render Passes ----- */
 
 void VKCommandBuffer::BeginRenderPass(
@@ -567,9 +781,23 @@ void VKCommandBuffer::BeginRenderPass(
 
     scissorRectInvalidated_ = true;
 
+    if (IsSecondaryCmdBuffer())
+    {
+        /*
+        Begin native command buffer with render pass inheritance;
+        the render pass instance itself (including clear operations) is managed by the primary command buffer.
+        */
+        BeginNativeCommandBuffer(secondaryRenderPass_, framebuffer_);
+
+        /* Store new record state */
+        recordState_ = RecordState::InsideRenderPass;
+        return;
+    }
+
     /* Declare array or clear values */
     VkClearValue clearValuesVK[LLGL_MAX_NUM_ATTACHMENTS];
     std::uint32_t numClearValuesVK = 0;
+    std::uint64_t clearValuesMask = 0;
 
     /* Get native render pass object either from RenderTarget or RenderPass interface */
     if (renderPass != nullptr)
@@ -580,7 +808,7 @@ void VKCommandBuffer::BeginRenderPass(
 
         /* Fill array of clear values */
         numClearValuesVK        = renderPassVK->GetNumClearValues();
-        auto clearValuesMask    = renderPassVK->GetClearValuesMask();
+        clearValuesMask         = renderPassVK->GetClearValuesMask();
         auto depthStencilIndex  = renderPassVK->GetDepthStencilIndex();
 
         for (std::uint32_t i = 0; i < numClearValuesVK; ++i)
@@ -617,6 +845,24 @@ void VKCommandBuffer::BeginRenderPass(
         }
     }
 
+    /* Merge consecutive render passes on the same framebuffer into a single instance (keeps attachments on-chip on tiled GPUs) */
+    if (deferredRenderPassEnd_)
+    {
+        if (framebuffer_ == deferredFramebuffer_ && clearValuesMask == 0)
+        {
+            /*
+            Continue recording in the still open render pass instance;
+            any render pass used with the same framebuffer is compatible with it by definition,
+            and without clear operations the load operations (load or don't-care) are satisfied by the on-chip content.
+            */
+            deferredRenderPassEnd_  = false;
+            deferredFramebuffer_    = VK_NULL_HANDLE;
+            recordState_            = RecordState::InsideRenderPass;
+            return;
+        }
+        FlushDeferredRenderPassEnd();
+    }
+
     /* Record begin of render pass */
     VkRenderPassBeginInfo beginInfo;
     {
@@ -637,8 +883,16 @@ void VKCommandBuffer::BeginRenderPass(
 
 void VKCommandBuffer::EndRenderPass()
 {
-    /* Record and of render pass */
-    vkCmdEndRenderPass(commandBuffer_);
+    /*
+    Defer the native end of the render pass instance: if the next render pass targets the same framebuffer
+    without clear operations, both merge into a single instance and the attachment store/load round trip
+    is elided (beneficial on tiled GPUs). Secondary command buffers do not own the render pass instance.
+    */
+    if (!IsSecondaryCmdBuffer())
+    {
+        deferredRenderPassEnd_  = true;
+        deferredFramebuffer_    = framebuffer_;
+    }
 
     /* Reset render pass and framebuffer attributes */
     renderPass_     = VK_NULL_HANDLE;
@@ -702,6 +956,10 @@ void VKCommandBuffer::SetUniforms(
 
 void VKCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
+    /* Queries must begin and end within the same render pass instance, so do not merge across them */
+    if (!IsInsideRenderPass())
+        FlushDeferredRenderPassEnd();
+
     auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
 
     /* Begin query and determine control flags (for either 'SamplesPassed' or 'AnySamplesPassed') */
@@ -715,6 +973,9 @@ void VKCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 
 void VKCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
+    if (!IsInsideRenderPass())
+        FlushDeferredRenderPassEnd();
+
     auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
     vkCmdEndQuery(commandBuffer_, queryHeapVK.GetVkQueryPool(), query);
     AppendQueryPoolInFlight(queryHeapVK.GetVkQueryPool());
@@ -806,16 +1067,27 @@ void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::ui
     {
         while (numCommands > 0)
         {
-            std::uint32_t drawCount = (numCommands % maxDrawIndirectCount_);
+            std::uint32_t drawCount = std::min(numCommands, maxDrawIndirectCount_);
             vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, drawCount, stride);
             numCommands -= drawCount;
-            offset += stride;
+            offset += stride * drawCount;
         }
     }
     else
         vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
 }
 
+void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #ifdef LLGL_VK_ENABLE_EXT
+    LLGL_ASSERT_VK_EXTENSION(VKExt::KHR_draw_indirect_count, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+
+    auto& bufferVK      = LLGL_CAST(VKBuffer&, buffer);
+    auto& countBufferVK = LLGL_CAST(VKBuffer&, countBuffer);
+    vkCmdDrawIndirectCountKHR(commandBuffer_, bufferVK.GetVkBuffer(), offset, countBufferVK.GetVkBuffer(), countOffset, maxNumCommands, stride);
+    #endif
+}
+
 void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
@@ -829,26 +1101,68 @@ void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
     {
         while (numCommands > 0)
         {
-            std::uint32_t drawCount = (numCommands % maxDrawIndirectCount_);
-            vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, drawCount, 0);
+            std::uint32_t drawCount = std::min(numCommands, maxDrawIndirectCount_);
+            vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, drawCount, stride);
             numCommands -= drawCount;
-            offset += stride;
+            offset += stride * drawCount;
         }
     }
     else
         vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
 }
 
+void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #ifdef LLGL_VK_ENABLE_EXT
+    LLGL_ASSERT_VK_EXTENSION(VKExt::KHR_draw_indirect_count, VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+
+    auto& bufferVK      = LLGL_CAST(VKBuffer&, buffer);
+    auto& countBufferVK = LLGL_CAST(VKBuffer&, countBuffer);
+    vkCmdDrawIndexedIndirectCountKHR(commandBuffer_, bufferVK.GetVkBuffer(), offset, countBufferVK.GetVkBuffer(), countOffset, maxNumCommands, stride);
+    #endif
+}
+
+void VKCommandBuffer::DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands)
+{
+    /* Record all draw commands with a tight loop to amortize the per-call overhead */
+    for (std::uint32_t i = 0; i < numCommands; ++i)
+    {
+        const auto& args = commands[i];
+        vkCmdDraw(commandBuffer_, args.numVertices, args.numInstances, args.firstVertex, args.firstInstance);
+    }
+}
+
+void VKCommandBuffer::DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands)
+{
+    for (std::uint32_t i = 0; i < numCommands; ++i)
+    {
+        const auto& args = commands[i];
+        vkCmdDrawIndexed(commandBuffer_, args.numIndices, args.numInstances, args.firstIndex, args.vertexOffset, args.firstInstance);
+    }
+}
+
+void VKCommandBuffer::DrawMeshTasks(std::uint32_t numWorkGroups, std::uint32_t firstWorkGroup)
+{
+    #if defined LLGL_VK_ENABLE_EXT && defined VK_NV_mesh_shader
+    LLGL_ASSERT_VK_EXTENSION(VKExt::NV_mesh_shader, VK_NV_MESH_SHADER_EXTENSION_NAME);
+    vkCmdDrawMeshTasksNV(commandBuffer_, numWorkGroups, firstWorkGroup);
+    #else
+    CommandBuffer::DrawMeshTasks(numWorkGroups, firstWorkGroup);
+    #endif
+}
+
 /* ----- Compute ----- */
 
 void VKCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
+    FlushDeferredRenderPassEnd();
     vkCmdDispatch(commandBuffer_, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
 }
 
 void VKCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    FlushDeferredRenderPassEnd();
     vkCmdDispatchIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset);
 }
 
@@ -898,6 +1212,17 @@ void VKCommandBuffer::AcquireNextBuffer()
     recordingFence_     = recordingFenceList_[commandBufferIndex_].Get();
 }
 
+void VKCommandBuffer::RegisterTransientLayoutDemand(const std::vector<VkDescriptorPoolSize>& poolSizes)
+{
+    for (auto& pool : transientDescriptorPools_)
+        pool.RegisterLayoutDemand(poolSizes);
+}
+
+VkDescriptorSet VKCommandBuffer::AllocateTransientDescriptorSet(VkDescriptorSetLayout setLayout)
+{
+    return transientDescriptorPools_[commandBufferIndex_].AllocateDescriptorSet(setLayout);
+}
+
 
 /*
  * ======= Private: =======
@@ -937,6 +1262,7 @@ void VKCommandBuffer::CreateCommandBuffers(std::size_t bufferCount)
 void VKCommandBuffer::CreateRecordingFences(VkQueue graphicsQueue, std::size_t numFences)
 {
     recordingFenceList_.reserve(numFences);
+    batchFenceList_.resize(numFences, VK_NULL_HANDLE);
 
     VkFenceCreateInfo createInfo;
     {
@@ -954,6 +1280,7 @@ void VKCommandBuffer::CreateRecordingFences(VkQueue graphicsQueue, std::size_t n
             VKThrowIfFailed(result, "failed to create Vulkan fence");
 
             /* Initial fence signal */
+            std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(graphicsQueue) };
             vkQueueSubmit(graphicsQueue, 0, nullptr, fence);
         }
         recordingFenceList_.emplace_back(std::move(fence));
@@ -977,12 +1304,46 @@ void VKCommandBuffer::ClearFramebufferAttachments(std::uint32_t numAttachments,
     }
 }
 
+void VKCommandBuffer::BeginNativeCommandBuffer(VkRenderPass renderPass, VkFramebuffer framebuffer)
+{
+    /* Declare inheritance info (only evaluated for secondary command buffers) */
+    VkCommandBufferInheritanceInfo inheritanceInfo;
+    {
+        inheritanceInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.pNext                   = nullptr;
+        inheritanceInfo.renderPass              = renderPass;
+        inheritanceInfo.subpass                 = 0;
+        inheritanceInfo.framebuffer             = framebuffer;
+        inheritanceInfo.occlusionQueryEnable    = VK_FALSE;
+        inheritanceInfo.queryFlags              = 0;
+        inheritanceInfo.pipelineStatistics      = 0;
+    }
+
+    /* A secondary command buffer with an inherited render pass is executed entirely inside a render pass instance */
+    auto usageFlags = usageFlags_;
+    if (renderPass != VK_NULL_HANDLE)
+        usageFlags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+
+    /* Begin recording of current command buffer */
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = usageFlags;
+        beginInfo.pInheritanceInfo  = (IsSecondaryCmdBuffer() ? &inheritanceInfo : nullptr);
+    }
+    auto result = vkBeginCommandBuffer(commandBuffer_, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin Vulkan command buffer");
+
+    pendingNativeBegin_ = false;
+}
+
 void VKCommandBuffer::PauseRenderPass()
 {
     vkCmdEndRenderPass(commandBuffer_);
 }
 
-void VKCommandBuffer::ResumeRenderPass()
+void VKCommandBuffer::ResumeRenderPass(VkSubpassContents contents)
 {
     /* Record begin of render pass */
     VkRenderPassBeginInfo beginInfo;
@@ -996,7 +1357,7 @@ void VKCommandBuffer::ResumeRenderPass()
         beginInfo.clearValueCount   = 0;
         beginInfo.pClearValues      = nullptr;
     }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, contents);
 }
 
 bool VKCommandBuffer::IsInsideRenderPass() const
@@ -1004,6 +1365,33 @@ bool VKCommandBuffer::IsInsideRenderPass() const
     return (recordState_ == RecordState::InsideRenderPass);
 }
 
+void VKCommandBuffer::FlushDeferredRenderPassEnd()
+{
+    if (deferredRenderPassEnd_)
+    {
+        vkCmdEndRenderPass(commandBuffer_);
+        deferredRenderPassEnd_  = false;
+        deferredFramebuffer_    = VK_NULL_HANDLE;
+    }
+}
+
+void VKCommandBuffer::FlushCopyBatch()
+{
+    if (!copyBatchRegions_.empty())
+    {
+        vkCmdCopyBuffer(
+            commandBuffer_,
+            copyBatchSrcBuffer_,
+            copyBatchDstBuffer_,
+            static_cast<std::uint32_t>(copyBatchRegions_.size()),
+            copyBatchRegions_.data()
+        );
+        copyBatchRegions_.clear();
+    }
+    copyBatchSrcBuffer_ = VK_NULL_HANDLE;
+    copyBatchDstBuffer_ = VK_NULL_HANDLE;
+}
+
 //TODO: current unused; previously used for 'Clear' function
 #if 0
 
@@ -13,8 +13,10 @@
 #include "Vulkan.h"
 #include "VKPtr.h"
 #include "VKCore.h"
+#include "RenderState/VKTransientDescriptorPool.h"
 
 #include <vector>
+#include <map>
 
 
 namespace LLGL
@@ -73,6 +75,9 @@ class VKCommandBuffer final : public CommandBuffer
             const Extent3D&         extent
         ) override;
 
+        void BeginCopyBatch() override;
+        void EndCopyBatch() override;
+
         void GenerateMips(Texture& texture) override;
         void GenerateMips(Texture& texture, const TextureSubresource& subresource) override;
 
@@ -114,6 +119,9 @@ class VKCommandBuffer final : public CommandBuffer
         void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
         void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet = 0) override;
 
+        void SetGraphicsResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets) override;
+        void SetComputeResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstSet, std::uint32_t numDynamicOffsets, const std::uint32_t* dynamicOffsets) override;
+
         void SetResource(Resource& resource, std::uint32_t slot, long bindFlags, long stageFlags = StageFlags::AllStages) override;
 
         void ResetResourceSlots(
@@ -124,6 +132,9 @@ class VKCommandBuffer final : public CommandBuffer
             long                stageFlags      = StageFlags::AllStages
         ) override;
 
+        void BeginResourceTransition(Resource& resource, long bindFlags) override;
+        void EndResourceTransition(Resource& resource, long bindFlags) override;
+
         /* ----- Render Passes ----- */
 
         void BeginRenderPass(
@@ -177,9 +188,16 @@ class VKCommandBuffer final : public CommandBuffer
 
         void DrawIndirect(Buffer& buffer, std::uint64_t offset) override;
         void DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
 
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset) override;
         void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) override;
+        void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride) override;
+
+        void DrawMulti(std::uint32_t numCommands, const DrawIndirectArguments* commands) override;
+        void DrawIndexedMulti(std::uint32_t numCommands, const DrawIndexedIndirectArguments* commands) override;
+
+        void DrawMeshTasks(std::uint32_t numWorkGroups, std::uint32_t firstWorkGroup = 0) override;
 
         /* ----- Compute ----- */
 
@@ -214,6 +232,27 @@ class VKCommandBuffer final : public CommandBuffer
             return recordingFence_;
         }
 
+        // Marks the current native command buffer as submitted in a batch that signals the specified fence instead of the recording fence.
+        inline void SetBatchSubmitFence(VkFence fence)
+        {
+            batchFenceList_[commandBufferIndex_] = fence;
+        }
+
+        // Returns true if this is a secondary command buffer (i.e. it can only be submitted via the 'Execute' function).
+        inline bool IsSecondaryCmdBuffer() const
+        {
+            return (bufferLevel_ == VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+        }
+
+        // Registers the descriptor demand of a pipeline layout to size the transient descriptor pools.
+        void RegisterTransientLayoutDemand(const std::vector<VkDescriptorPoolSize>& poolSizes);
+
+        /*
+        Allocates a transient descriptor set from the pool of the current native command buffer.
+        The set remains valid until the native command buffer is recycled, i.e. its recording fence has retired.
+        */
+        VkDescriptorSet AllocateTransientDescriptorSet(VkDescriptorSetLayout setLayout);
+
     private:
 
         enum class RecordState
@@ -230,11 +269,19 @@ class VKCommandBuffer final : public CommandBuffer
 
         void ClearFramebufferAttachments(std::uint32_t numAttachments, const VkClearAttachment* attachments);
 
+        void BeginNativeCommandBuffer(VkRenderPass renderPass, VkFramebuffer framebuffer);
+
         void PauseRenderPass();
-        void ResumeRenderPass();
+        void ResumeRenderPass(VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
 
         bool IsInsideRenderPass() const;
 
+        // Records the deferred end of the previous render pass instance, if one is pending (see EndRenderPass).
+        void FlushDeferredRenderPassEnd();
+
+        // Records the pending buffer-copy regions of the current copy batch as a single native copy command.
+        void FlushCopyBatch();
+
         //TODO: current unused; previously used for 'Clear' function
         #if 0
         void BeginClearImage(
@@ -247,7 +294,13 @@ class VKCommandBuffer final : public CommandBuffer
         void EndClearImage(VkImageMemoryBarrier& clearToPresentBarrier);
         #endif
 
-        void BindResourceHeap(VKResourceHeap& resourceHeapVK, VkPipelineBindPoint bindingPoint, std::uint32_t firstSet);
+        void BindResourceHeap(
+            VKResourceHeap&         resourceHeapVK,
+            VkPipelineBindPoint     bindingPoint,
+            std::uint32_t           firstSet,
+            std::uint32_t           numDynamicOffsets,
+            const std::uint32_t*    dynamicOffsets
+        );
 
         #if 1//TODO: optimize
         void ResetQueryPoolsInFlight();
@@ -265,6 +318,9 @@ class VKCommandBuffer final : public CommandBuffer
 
         std::vector<VKPtr<VkFence>>     recordingFenceList_;
         VkFence                         recordingFence_;
+        std::vector<VkFence>            batchFenceList_;            // batch fence per native command buffer, or null (see SetBatchSubmitFence)
+
+        std::vector<VKTransientDescriptorPool> transientDescriptorPools_; // one pool chain per native command buffer; reset on fence retirement
 
         RecordState                     recordState_                = RecordState::Undefined;
 
@@ -286,6 +342,13 @@ class VKCommandBuffer final : public CommandBuffer
         bool                            scissorEnabled_             = false;
         bool                            scissorRectInvalidated_     = true;
 
+        bool                            pendingNativeBegin_         = false; // secondary command buffer waits for its inherited render pass
+
+        bool                            deferredRenderPassEnd_      = false;          // end of render pass deferred to merge consecutive passes
+        VkFramebuffer                   deferredFramebuffer_        = VK_NULL_HANDLE; // framebuffer of the deferred render pass end
+
+
+
         std::uint32_t                   maxDrawIndirectCount_       = 0;
 
         #if 1//TODO: optimize usage of query pools
@@ -293,6 +356,15 @@ class VKCommandBuffer final : public CommandBuffer
         std::size_t                     numQueryPoolsInFlight_      = 0;
         #endif
 
+        std::vector<VKPtr<VkEvent>>     splitBarrierEvents_;                  // event pool for split resource transitions
+        std::size_t                     numSplitBarrierEventsInUse_ = 0;
+        std::map<const Resource*, VkEvent> pendingSplitBarriers_;             // begun but not yet completed split transitions
+
+        bool                            insideCopyBatch_            = false;
+        VkBuffer                        copyBatchSrcBuffer_         = VK_NULL_HANDLE; // source of the pending buffer-copy group
+        VkBuffer                        copyBatchDstBuffer_         = VK_NULL_HANDLE; // destination of the pending buffer-copy group
+        std::vector<VkBufferCopy>       copyBatchRegions_;                            // pending regions of the current buffer-copy group
+
 };
 
 
@@ -7,19 +7,22 @@
 
 #include "VKCommandQueue.h"
 #include "VKCommandBuffer.h"
+#include "Texture/VKTexture.h"
+#include "Memory/VKDeviceMemoryManager.h"
 #include "RenderState/VKFence.h"
 #include "RenderState/VKQueryHeap.h"
 #include "../CheckedCast.h"
 #include "VKCore.h"
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-VKCommandQueue::VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue) :
-    device_        { device        },
-    graphicsQueue_ { graphicsQueue }
+VKCommandQueue::VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue queue) :
+    device_ { device },
+    queue_  { queue  }
 {
 }
 
@@ -29,23 +32,104 @@ void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
     auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
 
+    /* Secondary command buffers cannot be submitted to a queue; they are replayed via the 'Execute' function of a primary command buffer */
+    if (commandBufferVK.IsSecondaryCmdBuffer())
+        return;
+
     VkCommandBuffer commandBuffers[] = { commandBufferVK.GetVkCommandBuffer() };
 
-    /* Submit command buffer to graphics queue */
+    /* Consume fence semaphore waits deferred by previous 'Wait' calls */
+    std::vector<VkPipelineStageFlags> waitStageMasks(pendingWaitSemaphores_.size(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+    /* Submit command buffer to queue */
     VkSubmitInfo submitInfo;
     {
         submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
         submitInfo.pNext                = nullptr;
-        submitInfo.waitSemaphoreCount   = 0;
-        submitInfo.pWaitSemaphores      = nullptr;
-        submitInfo.pWaitDstStageMask    = 0;
+        submitInfo.waitSemaphoreCount   = static_cast<std::uint32_t>(pendingWaitSemaphores_.size());
+        submitInfo.pWaitSemaphores      = pendingWaitSemaphores_.data();
+        submitInfo.pWaitDstStageMask    = waitStageMasks.data();
         submitInfo.commandBufferCount   = 1;
         submitInfo.pCommandBuffers      = commandBuffers;
         submitInfo.signalSemaphoreCount = 0;
         submitInfo.pSignalSemaphores    = nullptr;
     }
-    auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, commandBufferVK.GetQueueSubmitFence());
-    VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+    VkResult result;
+    {
+        std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(queue_) };
+        result = vkQueueSubmit(queue_, 1, &submitInfo, commandBufferVK.GetQueueSubmitFence());
+    }
+    VKThrowIfFailed(result, "failed to submit command buffer to Vulkan queue");
+
+    pendingWaitSemaphores_.clear();
+}
+
+void VKCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Gather native command buffers; secondary command buffers cannot be submitted to a queue */
+    std::vector<VkCommandBuffer> nativeCommandBuffers;
+    nativeCommandBuffers.reserve(numCommandBuffers);
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferVK = LLGL_CAST(VKCommandBuffer*, commandBuffers[i]);
+        if (!commandBufferVK->IsSecondaryCmdBuffer())
+            nativeCommandBuffers.push_back(commandBufferVK->GetVkCommandBuffer());
+    }
+
+    if (nativeCommandBuffers.empty())
+        return;
+
+    /* Acquire a single fence for the entire batch and share it with all command buffers for their next recording */
+    auto batchFence = AcquireBatchFence();
+
+    for (std::uint32_t i = 0; i < numCommandBuffers; ++i)
+    {
+        auto commandBufferVK = LLGL_CAST(VKCommandBuffer*, commandBuffers[i]);
+        if (!commandBufferVK->IsSecondaryCmdBuffer())
+            commandBufferVK->SetBatchSubmitFence(batchFence);
+    }
+
+    /* Consume fence semaphore waits deferred by previous 'Wait' calls */
+    std::vector<VkPipelineStageFlags> waitStageMasks(pendingWaitSemaphores_.size(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+    /* Submit all command buffers to the queue in a single call */
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = static_cast<std::uint32_t>(pendingWaitSemaphores_.size());
+        submitInfo.pWaitSemaphores      = pendingWaitSemaphores_.data();
+        submitInfo.pWaitDstStageMask    = waitStageMasks.data();
+        submitInfo.commandBufferCount   = static_cast<std::uint32_t>(nativeCommandBuffers.size());
+        submitInfo.pCommandBuffers      = nativeCommandBuffers.data();
+        submitInfo.signalSemaphoreCount = 0;
+        submitInfo.pSignalSemaphores    = nullptr;
+    }
+    VkResult result;
+    {
+        std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(queue_) };
+        result = vkQueueSubmit(queue_, 1, &submitInfo, batchFence);
+    }
+    VKThrowIfFailed(result, "failed to submit command buffer batch to Vulkan queue");
+
+    pendingWaitSemaphores_.clear();
+}
+
+/* ----- Sparse Resources ----- */
+
+bool VKCommandQueue::BindSparseTexture(
+    Texture&        texture,
+    std::uint32_t   baseMipLevel,
+    std::uint32_t   numMipLevels,
+    bool            resident)
+{
+    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+
+    if (deviceMemoryMngr_ != nullptr && textureVK.IsSparseTexture())
+        return textureVK.BindSparseMipRange(queue_, *deviceMemoryMngr_, baseMipLevel, numMipLevels, resident);
+    else
+        return false;
 }
 
 /* ----- Queries ----- */
@@ -90,6 +174,43 @@ bool VKCommandQueue::QueryResult(
     return true;
 }
 
+bool VKCommandQueue::QueryResultAvailable(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries)
+{
+    auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
+
+    /*
+    Probe availability by fetching into a scratch buffer without the WAIT flag;
+    the stride is large enough for all query types (incl. pipeline statistics)
+    */
+    std::uint64_t scratch[8][16];
+
+    while (numQueries > 0)
+    {
+        const auto numQueriesInChunk = std::min(numQueries, 8u);
+
+        auto stateResult = vkGetQueryPoolResults(
+            device_,
+            queryHeapVK.GetVkQueryPool(),
+            firstQuery,
+            numQueriesInChunk,
+            sizeof(scratch),
+            scratch,
+            sizeof(scratch[0]),
+            VK_QUERY_RESULT_64_BIT
+        );
+
+        if (stateResult == VK_NOT_READY)
+            return false;
+
+        VKThrowIfFailed(stateResult, "failed to probe result availability of Vulkan query pool");
+
+        firstQuery += numQueriesInChunk;
+        numQueries -= numQueriesInChunk;
+    }
+
+    return true;
+}
+
 #if 0
 bool VKCommandBuffer::QueryPipelineStatisticsResult(QueryHeap& queryHeap, QueryPipelineStatistics& result)
 {
@@ -117,7 +238,52 @@ void VKCommandQueue::Submit(Fence& fence)
 {
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
     fenceVK.Reset(device_);
-    vkQueueSubmit(graphicsQueue_, 0, nullptr, fenceVK.GetVkFence());
+
+    /* Signal the companion semaphore alongside the fence, unless a previous signal has not been consumed by a queue wait yet */
+    VkSemaphore signalSemaphores[] = { fenceVK.GetVkSemaphore() };
+
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = 0;
+        submitInfo.pWaitSemaphores      = nullptr;
+        submitInfo.pWaitDstStageMask    = nullptr;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        if (fenceVK.IsSemaphoreSignalPending())
+        {
+            submitInfo.signalSemaphoreCount = 0;
+            submitInfo.pSignalSemaphores    = nullptr;
+        }
+        else
+        {
+            submitInfo.signalSemaphoreCount = 1;
+            submitInfo.pSignalSemaphores    = signalSemaphores;
+            fenceVK.SetSemaphoreSignalPending(true);
+        }
+    }
+    std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(queue_) };
+    vkQueueSubmit(queue_, 1, &submitInfo, fenceVK.GetVkFence());
+}
+
+void VKCommandQueue::Wait(Fence& fence)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    if (fenceVK.IsSemaphoreSignalPending())
+    {
+        /* Defer the semaphore wait until the next command buffer submission on this queue */
+        pendingWaitSemaphores_.push_back(fenceVK.GetVkSemaphore());
+        fenceVK.SetSemaphoreSignalPending(false);
+    }
+    else
+    {
+        /*
+        The fence semaphore has either been consumed by a previous wait or the fence has not been submitted yet;
+        fall back to blocking the CPU, which still enforces the dependency for all subsequent submissions
+        */
+        fenceVK.Wait(device_, ~0ull);
+    }
 }
 
 bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
@@ -126,9 +292,72 @@ bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
     return fenceVK.Wait(device_, timeout);
 }
 
+bool VKCommandQueue::WaitFences(std::uint32_t numFences, Fence* const * fences, bool waitAll, std::uint64_t timeout)
+{
+    if (numFences == 0 || fences == nullptr)
+        return false;
+
+    /* Gather native fence handles */
+    std::vector<VkFence> nativeFences;
+    nativeFences.reserve(numFences);
+
+    for (std::uint32_t i = 0; i < numFences; ++i)
+    {
+        auto fenceVK = LLGL_CAST(VKFence*, fences[i]);
+        nativeFences.push_back(fenceVK->GetVkFence());
+    }
+
+    return (vkWaitForFences(device_, numFences, nativeFences.data(), (waitAll ? VK_TRUE : VK_FALSE), timeout) == VK_SUCCESS);
+}
+
+bool VKCommandQueue::IsSignaled(Fence& fence)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    return (vkGetFenceStatus(device_, fenceVK.GetVkFence()) == VK_SUCCESS);
+}
+
 void VKCommandQueue::WaitIdle()
 {
-    vkQueueWaitIdle(graphicsQueue_);
+    std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(queue_) };
+    vkQueueWaitIdle(queue_);
+}
+
+void VKCommandQueue::SetDeviceMemoryManager(VKDeviceMemoryManager* deviceMemoryMngr)
+{
+    deviceMemoryMngr_ = deviceMemoryMngr;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VkFence VKCommandQueue::AcquireBatchFence()
+{
+    /* Reuse a fence whose batch has already completed on the GPU; late waiters then merely wait for the new batch */
+    for (const auto& fence : batchFences_)
+    {
+        if (vkGetFenceStatus(device_, fence.Get()) == VK_SUCCESS)
+        {
+            vkResetFences(device_, 1, &fence);
+            return fence.Get();
+        }
+    }
+
+    /* All fences are still in flight, so create a new one */
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+    }
+    VKPtr<VkFence> fence { device_, vkDestroyFence };
+    auto result = vkCreateFence(device_, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence for batched queue submission");
+
+    auto nativeFence = fence.Get();
+    batchFences_.emplace_back(std::move(fence));
+    return nativeFence;
 }
 
 
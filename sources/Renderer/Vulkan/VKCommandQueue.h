@@ -14,12 +14,15 @@
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "RenderState/VKFence.h"
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+class VKDeviceMemoryManager;
+
 class VKCommandQueue final : public CommandQueue
 {
 
@@ -27,27 +30,59 @@ class VKCommandQueue final : public CommandQueue
 
         /* ----- Common ----- */
 
-        VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue graphicsQueue);
+        VKCommandQueue(const VKPtr<VkDevice>& device, VkQueue queue);
 
         /* ----- Command Buffers ----- */
 
         void Submit(CommandBuffer& commandBuffer) override;
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        /* ----- Sparse Resources ----- */
+
+        bool BindSparseTexture(
+            Texture&        texture,
+            std::uint32_t   baseMipLevel,
+            std::uint32_t   numMipLevels,
+            bool            resident
+        ) override;
 
         /* ----- Queries ----- */
 
         bool QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize) override;
+        bool QueryResultAvailable(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries) override;
 
         /* ----- Fences ----- */
 
         void Submit(Fence& fence) override;
+        void Wait(Fence& fence) override;
 
         bool WaitFence(Fence& fence, std::uint64_t timeout) override;
+        bool WaitFences(std::uint32_t numFences, Fence* const * fences, bool waitAll, std::uint64_t timeout) override;
+        bool IsSignaled(Fence& fence) override;
         void WaitIdle() override;
 
+    public:
+
+        // Sets the device memory manager that is used for sparse binding operations (must be set before any sparse texture is bound).
+        void SetDeviceMemoryManager(VKDeviceMemoryManager* deviceMemoryMngr);
+
     private:
 
-        VkDevice    device_;
-        VkQueue     graphicsQueue_  = VK_NULL_HANDLE;
+        // Returns a fence for a batched submission; recycled once its batch has completed on the GPU.
+        VkFence AcquireBatchFence();
+
+    private:
+
+        VkDevice                    device_;
+        VkQueue                     queue_              = VK_NULL_HANDLE;
+
+        VKDeviceMemoryManager*      deviceMemoryMngr_   = nullptr;
+
+        // Fence semaphores to wait for on the next command buffer submission (see Wait)
+        std::vector<VkSemaphore>    pendingWaitSemaphores_;
+
+        // Fences for batched submissions (see Submit(std::uint32_t, CommandBuffer* const *))
+        std::vector<VKPtr<VkFence>> batchFences_;
 
 };
 
@@ -8,6 +8,7 @@
 #include "VKCore.h"
 #include "../../Core/Helper.h"
 #include "../../Core/HelperMacros.h"
+#include <map>
 
 
 namespace LLGL
@@ -98,6 +99,16 @@ VkBool32 VKBoolean(bool value)
     return (value ? VK_TRUE : VK_FALSE);
 }
 
+std::mutex& VKGetQueueMutex(VkQueue queue)
+{
+    static std::mutex registryMutex;
+    static std::map<VkQueue, std::mutex> queueMutices;
+
+    /* Map nodes are stable, so the returned reference outlives the registry lock */
+    std::lock_guard<std::mutex> guard { registryMutex };
+    return queueMutices[queue];
+}
+
 
 /* ----- Query Functions ----- */
 
@@ -210,7 +221,7 @@ QueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFla
     for (const auto& family : queueFamilies)
     {
         /* Get graphics family index */
-        if (family.queueCount > 0 && (family.queueFlags & flags) != 0)
+        if (indices.graphicsFamily == QueueFamilyIndices::invalidIndex && family.queueCount > 0 && (family.queueFlags & flags) != 0)
             indices.graphicsFamily = i;
 
         if (surface != nullptr)
@@ -219,22 +230,34 @@ QueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFla
             VkBool32 presentSupport = VK_FALSE;
             vkGetPhysicalDeviceSurfaceSupportKHR(device, i, *surface, &presentSupport);
 
-            if (family.queueCount > 0 && presentSupport)
+            if (indices.presentFamily == QueueFamilyIndices::invalidIndex && family.queueCount > 0 && presentSupport)
                 indices.presentFamily = i;
         }
         else
         {
-            if (family.queueCount > 0)
+            if (indices.presentFamily == QueueFamilyIndices::invalidIndex && family.queueCount > 0)
                 indices.presentFamily = i;
         }
 
-        /* Check if queue family is complete */
-        if (indices.Complete())
-            break;
+        /* Get transfer family index; prefer a transfer-only family to keep resource uploads off the graphics queue */
+        if (family.queueCount > 0 && (family.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0 && (family.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0)
+            indices.transferFamily = i;
+
+        /* Get compute family index; prefer a compute family without graphics support so async compute overlaps rendering */
+        if (family.queueCount > 0 && (family.queueFlags & VK_QUEUE_COMPUTE_BIT) != 0 && (family.queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0)
+            indices.computeFamily = i;
 
         ++i;
     }
 
+    /* Fall back to the graphics family if there is no dedicated transfer queue family */
+    if (indices.transferFamily == QueueFamilyIndices::invalidIndex)
+        indices.transferFamily = indices.graphicsFamily;
+
+    /* Fall back to the graphics family if there is no dedicated compute queue family */
+    if (indices.computeFamily == QueueFamilyIndices::invalidIndex)
+        indices.computeFamily = indices.graphicsFamily;
+
     return indices;
 }
 
@@ -12,6 +12,7 @@
 #include "Vulkan.h"
 #include <string>
 #include <vector>
+#include <mutex>
 #include <cstdint>
 #include <initializer_list>
 
@@ -28,18 +29,21 @@ struct QueueFamilyIndices
 
     QueueFamilyIndices() :
         graphicsFamily { invalidIndex },
-        presentFamily  { invalidIndex }
+        presentFamily  { invalidIndex },
+        transferFamily { invalidIndex },
+        computeFamily  { invalidIndex }
     {
     }
 
     union
     {
-        std::uint32_t indices[2];
+        std::uint32_t indices[4];
         struct
         {
             std::uint32_t graphicsFamily;
             std::uint32_t presentFamily;
-            //std::uint32_t transferFamily;
+            std::uint32_t transferFamily;
+            std::uint32_t computeFamily;
         };
     };
 
@@ -68,6 +72,16 @@ std::string VKApiVersionToString(std::uint32_t version);
 // Converts the boolean value into a VkBool322 value.
 VkBool32 VKBoolean(bool value);
 
+/*
+Returns the mutex that serializes host access to the specified queue.
+VkQueue objects require external host synchronization, so every 'vkQueueSubmit', 'vkQueueBindSparse',
+'vkQueuePresentKHR', and 'vkQueueWaitIdle' call must hold this mutex, since loader threads may submit
+uploads while the render thread submits command buffers (see RenderingFeatures::hasConcurrentResourceCreation).
+The mutices are keyed by the queue handle, so aliased queues (e.g. the transfer queue falling back
+to the graphics queue if there is no dedicated transfer queue family) share a single mutex.
+*/
+std::mutex& VKGetQueueMutex(VkQueue queue);
+
 
 
 /* ----- Query Functions ----- */
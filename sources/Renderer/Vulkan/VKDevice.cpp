@@ -9,6 +9,7 @@
 #include "RenderState/VKFence.h"
 #include "Memory/VKDeviceMemoryRegion.h"
 #include "Memory/VKDeviceMemory.h"
+#include "../../Core/Helper.h"
 #include <set>
 #include <algorithm>
 #include <string.h>
@@ -26,24 +27,43 @@ VKDevice::VKDevice() :
 }
 
 VKDevice::VKDevice(VKDevice&& device) :
-    device_             { std::move(device.device_)      },
-    queueFamilyIndices_ { device.queueFamilyIndices_     },
-    graphicsQueue_      { device.graphicsQueue_          },
-    commandPool_        { std::move(device.commandPool_) }
+    device_              { std::move(device.device_)              },
+    queueFamilyIndices_  { device.queueFamilyIndices_             },
+    graphicsQueue_       { device.graphicsQueue_                  },
+    transferQueue_       { device.transferQueue_                  },
+    computeQueue_        { device.computeQueue_                   },
+    commandPool_         { std::move(device.commandPool_)         },
+    transferCommandPool_ { std::move(device.transferCommandPool_) },
+    stagingBufferPool_   { std::move(device.stagingBufferPool_)   }
 {
 }
 
 VKDevice& VKDevice::operator = (VKDevice&& device)
 {
-    device_             = std::move(device.device_);
-    queueFamilyIndices_ = device.queueFamilyIndices_;
-    graphicsQueue_      = device.graphicsQueue_;
-    commandPool_        = std::move(device.commandPool_);
+    device_              = std::move(device.device_);
+    queueFamilyIndices_  = device.queueFamilyIndices_;
+    graphicsQueue_       = device.graphicsQueue_;
+    transferQueue_       = device.transferQueue_;
+    computeQueue_        = device.computeQueue_;
+    commandPool_         = std::move(device.commandPool_);
+    transferCommandPool_ = std::move(device.transferCommandPool_);
+    stagingBufferPool_   = std::move(device.stagingBufferPool_);
     return *this;
 }
 
 void VKDevice::WaitIdle()
 {
+    /* 'vkDeviceWaitIdle' requires the same external synchronization as waiting on every queue of the device */
+    std::lock_guard<std::mutex> graphicsGuard { VKGetQueueMutex(graphicsQueue_) };
+    std::unique_lock<std::mutex> transferGuard { VKGetQueueMutex(transferQueue_), std::defer_lock };
+    std::unique_lock<std::mutex> computeGuard { VKGetQueueMutex(computeQueue_), std::defer_lock };
+
+    /* Only lock distinct queue handles; aliased queues share the graphics queue mutex */
+    if (transferQueue_ != graphicsQueue_)
+        transferGuard.lock();
+    if (computeQueue_ != graphicsQueue_ && computeQueue_ != transferQueue_)
+        computeGuard.lock();
+
     vkDeviceWaitIdle(device_);
 }
 
@@ -53,13 +73,14 @@ void VKDevice::CreateLogicalDevice(
     VkPhysicalDevice                physicalDevice,
     const VkPhysicalDeviceFeatures* features,
     const char* const*              extensions,
-    std::uint32_t                   numExtensions)
+    std::uint32_t                   numExtensions,
+    const void*                     featureChain)
 {
     /* Initialize queue create description */
     queueFamilyIndices_ = VKFindQueueFamilies(physicalDevice, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
 
     std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
-    std::set<std::uint32_t> uniqueQueueFamilies = { queueFamilyIndices_.graphicsFamily, queueFamilyIndices_.presentFamily };
+    std::set<std::uint32_t> uniqueQueueFamilies = { queueFamilyIndices_.graphicsFamily, queueFamilyIndices_.presentFamily, queueFamilyIndices_.transferFamily, queueFamilyIndices_.computeFamily };
 
     float queuePriority = 1.0f;
     for (auto family : uniqueQueueFamilies)
@@ -80,7 +101,7 @@ void VKDevice::CreateLogicalDevice(
     VkDeviceCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
-        createInfo.pNext                    = nullptr;
+        createInfo.pNext                    = featureChain;
         createInfo.flags                    = 0;
         createInfo.queueCreateInfoCount     = static_cast<std::uint32_t>(queueCreateInfos.size());
         createInfo.pQueueCreateInfos        = queueCreateInfos.data();
@@ -96,11 +117,21 @@ void VKDevice::CreateLogicalDevice(
     /* Query device graphics queue */
     vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
 
+    /* Query device transfer queue; identical to the graphics queue if there is no dedicated transfer queue family */
+    vkGetDeviceQueue(device_, queueFamilyIndices_.transferFamily, 0, &transferQueue_);
+
+    /* Query device compute queue; identical to the graphics queue if there is no dedicated compute queue family */
+    vkGetDeviceQueue(device_, queueFamilyIndices_.computeFamily, 0, &computeQueue_);
+
     /* Create default command pool */
-    commandPool_ = CreateCommandPool();
+    commandPool_ = CreateCommandPool(queueFamilyIndices_.graphicsFamily);
+
+    /* Create transfer command pool; command buffers can only be submitted to queues of their pool's queue family */
+    if (HasDedicatedTransferQueue())
+        transferCommandPool_ = CreateCommandPool(queueFamilyIndices_.transferFamily);
 }
 
-VKPtr<VkCommandPool> VKDevice::CreateCommandPool()
+VKPtr<VkCommandPool> VKDevice::CreateCommandPool(std::uint32_t queueFamilyIndex)
 {
     VKPtr<VkCommandPool> commandPool;
 
@@ -110,7 +141,7 @@ VKPtr<VkCommandPool> VKDevice::CreateCommandPool()
         createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
         createInfo.pNext            = nullptr;
         createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        createInfo.queueFamilyIndex = queueFamilyIndices_.graphicsFamily;
+        createInfo.queueFamilyIndex = queueFamilyIndex;
     }
     auto result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan command pool");
@@ -168,7 +199,10 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
             submitInfo.commandBufferCount   = 1;
             submitInfo.pCommandBuffers      = (&cmdBuffer);
         }
-        vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence.GetVkFence());
+        {
+            std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(graphicsQueue_) };
+            vkQueueSubmit(graphicsQueue_, 1, &submitInfo, fence.GetVkFence());
+        }
 
         /* Wait for fence to be signaled */
         fence.Wait(device_, std::numeric_limits<std::uint64_t>::max());
@@ -179,6 +213,11 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
         vkFreeCommandBuffers(device_, commandPool_, 1, &cmdBuffer);
 }
 
+void VKDevice::FreeCommandBuffer(VkCommandBuffer cmdBuffer)
+{
+    vkFreeCommandBuffers(device_, commandPool_, 1, &cmdBuffer);
+}
+
 void VKDevice::TransitionImageLayout(
     VkCommandBuffer             commandBuffer,
     VkImage                     image,
@@ -268,11 +307,12 @@ void VKDevice::CopyBufferToImage(
     const VkExtent3D&   extent,
     std::uint32_t       baseArrayLayer,
     std::uint32_t       numArrayLayers,
-    std::uint32_t       mipLevel)
+    std::uint32_t       mipLevel,
+    VkDeviceSize        srcOffset)
 {
     VkBufferImageCopy region;
     {
-        region.bufferOffset                     = 0;
+        region.bufferOffset                     = srcOffset;
         region.bufferRowLength                  = 0;
         region.bufferImageHeight                = 0;
         region.imageSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
@@ -316,90 +356,68 @@ void VKDevice::GenerateMips(
     barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel;
     barrier.subresourceRange.levelCount     = 1;
     barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
-    barrier.subresourceRange.layerCount     = 1;
+    barrier.subresourceRange.layerCount     = subresource.numArrayLayers;
 
-    /* Blit each MIP-map from previous (lower) MIP level */
-    for (std::uint32_t arrayLayer = 0; arrayLayer < subresource.numArrayLayers; ++arrayLayer)
-    {
-        auto currExtent = imageExtent;
+    /* Blit each MIP-map from previous (lower) MIP level; all array layers are batched into a single barrier and blit */
+    auto currExtent = imageExtent;
 
-        for (std::uint32_t mipLevel = 1; mipLevel < subresource.numMipLevels; ++mipLevel)
-        {
-            /* Determine extent of next MIP level */
-            auto nextExtent = currExtent;
+    for (std::uint32_t mipLevel = 1; mipLevel < subresource.numMipLevels; ++mipLevel)
+    {
+        /* Determine extent of next MIP level */
+        auto nextExtent = currExtent;
 
-            nextExtent.width    = std::max(1u, currExtent.width  / 2);
-            nextExtent.height   = std::max(1u, currExtent.height / 2);
-            nextExtent.depth    = std::max(1u, currExtent.depth  / 2);
+        nextExtent.width    = std::max(1u, currExtent.width  / 2);
+        nextExtent.height   = std::max(1u, currExtent.height / 2);
+        nextExtent.depth    = std::max(1u, currExtent.depth  / 2);
 
-            /* Transition previous MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL */
-            barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel + mipLevel - 1;
-            barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer + arrayLayer;
-
-            vkCmdPipelineBarrier(
-                commandBuffer,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
-
-            /* Blit previous MIP level into next higher MIP level (with smaller extent) */
-            VkImageBlit blit;
-
-            blit.srcSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
-            blit.srcSubresource.mipLevel        = subresource.baseMipLevel + mipLevel - 1;
-            blit.srcSubresource.baseArrayLayer  = subresource.baseArrayLayer + arrayLayer;
-            blit.srcSubresource.layerCount      = 1;
-            blit.srcOffsets[0]                  = { 0, 0, 0 };
-            blit.srcOffsets[1].x                = static_cast<std::int32_t>(currExtent.width);
-            blit.srcOffsets[1].y                = static_cast<std::int32_t>(currExtent.height);
-            blit.srcOffsets[1].z                = static_cast<std::int32_t>(currExtent.depth);
-            blit.dstSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
-            blit.dstSubresource.mipLevel        = subresource.baseMipLevel + mipLevel;
-            blit.dstSubresource.baseArrayLayer  = subresource.baseArrayLayer + arrayLayer;
-            blit.dstSubresource.layerCount      = 1;
-            blit.dstOffsets[0]                  = { 0, 0, 0 };
-            blit.dstOffsets[1].x                = static_cast<std::int32_t>(nextExtent.width);
-            blit.dstOffsets[1].y                = static_cast<std::int32_t>(nextExtent.height);
-            blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
-
-            vkCmdBlitImage(
-                commandBuffer,
-                image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-                1, &blit,
-                VK_FILTER_LINEAR
-            );
-
-            /* Transition previous MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
-            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT;
-            barrier.oldLayout       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.newLayout       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-
-            vkCmdPipelineBarrier(
-                commandBuffer,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
-
-            /* Reduce image extent to next MIP level */
-            currExtent = nextExtent;
-        }
-
-        /* Transition last MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
+        /* Transition previous MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL */
         barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
+        barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
         barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        barrier.subresourceRange.baseMipLevel   = subresource.numMipLevels - 1;
+        barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel + mipLevel - 1;
+
+        vkCmdPipelineBarrier(
+            commandBuffer,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+            0, nullptr,
+            0, nullptr,
+            1, &barrier
+        );
+
+        /* Blit previous MIP level into next higher MIP level (with smaller extent) */
+        VkImageBlit blit;
+
+        blit.srcSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
+        blit.srcSubresource.mipLevel        = subresource.baseMipLevel + mipLevel - 1;
+        blit.srcSubresource.baseArrayLayer  = subresource.baseArrayLayer;
+        blit.srcSubresource.layerCount      = subresource.numArrayLayers;
+        blit.srcOffsets[0]                  = { 0, 0, 0 };
+        blit.srcOffsets[1].x                = static_cast<std::int32_t>(currExtent.width);
+        blit.srcOffsets[1].y                = static_cast<std::int32_t>(currExtent.height);
+        blit.srcOffsets[1].z                = static_cast<std::int32_t>(currExtent.depth);
+        blit.dstSubresource.aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT;
+        blit.dstSubresource.mipLevel        = subresource.baseMipLevel + mipLevel;
+        blit.dstSubresource.baseArrayLayer  = subresource.baseArrayLayer;
+        blit.dstSubresource.layerCount      = subresource.numArrayLayers;
+        blit.dstOffsets[0]                  = { 0, 0, 0 };
+        blit.dstOffsets[1].x                = static_cast<std::int32_t>(nextExtent.width);
+        blit.dstOffsets[1].y                = static_cast<std::int32_t>(nextExtent.height);
+        blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
+
+        vkCmdBlitImage(
+            commandBuffer,
+            image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            1, &blit,
+            VK_FILTER_LINEAR
+        );
+
+        /* Transition previous MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
+        barrier.srcAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
+        barrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT;
+        barrier.oldLayout       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        barrier.newLayout       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
         vkCmdPipelineBarrier(
             commandBuffer,
@@ -408,7 +426,25 @@ void VKDevice::GenerateMips(
             0, nullptr,
             1, &barrier
         );
+
+        /* Reduce image extent to next MIP level */
+        currExtent = nextExtent;
     }
+
+    /* Transition last MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
+    barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
+    barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel + subresource.numMipLevels - 1;
+
+    vkCmdPipelineBarrier(
+        commandBuffer,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
+        0, nullptr,
+        0, nullptr,
+        1, &barrier
+    );
 }
 
 void VKDevice::WriteBuffer(VKDeviceBuffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset)
@@ -444,6 +480,111 @@ void VKDevice::FlushMappedBuffer(VKDeviceBuffer& buffer, VkDeviceSize size, VkDe
     }
 }
 
+/* ----- Staging buffer pool ----- */
+
+void VKDevice::CreateStagingPool(const VkPhysicalDeviceMemoryProperties& memoryProperties, VkDeviceSize poolSize)
+{
+    if (HasDedicatedTransferQueue())
+    {
+        stagingBufferPool_ = MakeUnique<VKStagingBufferPool>(
+            device_,
+            memoryProperties,
+            transferCommandPool_,
+            commandPool_,
+            queueFamilyIndices_.transferFamily,
+            queueFamilyIndices_.graphicsFamily,
+            poolSize
+        );
+    }
+    else
+    {
+        stagingBufferPool_ = MakeUnique<VKStagingBufferPool>(
+            device_,
+            memoryProperties,
+            commandPool_,
+            VK_NULL_HANDLE,
+            queueFamilyIndices_.graphicsFamily,
+            queueFamilyIndices_.graphicsFamily,
+            poolSize
+        );
+    }
+}
+
+VkCommandBuffer VKDevice::BeginStagingUpload(const void* data, VkDeviceSize size, VkBuffer& srcBuffer, VkDeviceSize& srcOffset)
+{
+    if (stagingBufferPool_)
+        return stagingBufferPool_->Begin(data, size, srcBuffer, srcOffset);
+    else
+        return VK_NULL_HANDLE;
+}
+
+void VKDevice::RegisterStagingUploadBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size)
+{
+    if (stagingBufferPool_)
+    {
+        VkBufferMemoryBarrier barrier;
+        {
+            barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+            barrier.pNext               = nullptr;
+            barrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask       = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.buffer              = buffer;
+            barrier.offset              = offset;
+            barrier.size                = size;
+        }
+        stagingBufferPool_->RegisterBufferBarrier(barrier);
+    }
+}
+
+void VKDevice::RegisterStagingUploadImage(VkImage image, const TextureSubresource& subresource)
+{
+    if (stagingBufferPool_)
+    {
+        VkImageMemoryBarrier barrier;
+        {
+            barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.pNext                           = nullptr;
+            barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
+            barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image                           = image;
+            barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+            barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel;
+            barrier.subresourceRange.levelCount     = subresource.numMipLevels;
+            barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
+            barrier.subresourceRange.layerCount     = subresource.numArrayLayers;
+        }
+        stagingBufferPool_->RegisterImageBarrier(barrier);
+    }
+}
+
+void VKDevice::EndStagingUpload()
+{
+    if (stagingBufferPool_)
+        stagingBufferPool_->End(transferQueue_, graphicsQueue_);
+}
+
+std::uint64_t VKDevice::GetLastStagingUploadToken() const
+{
+    return (stagingBufferPool_ ? stagingBufferPool_->GetLastSubmittedToken() : 0);
+}
+
+bool VKDevice::IsStagingUploadComplete(std::uint64_t token)
+{
+    return (stagingBufferPool_ ? stagingBufferPool_->IsBatchComplete(token) : true);
+}
+
+void VKDevice::WaitForStagingUpload(std::uint64_t token)
+{
+    if (stagingBufferPool_)
+        stagingBufferPool_->WaitForBatch(token);
+}
+
 
 } // /namespace LLGL
 
@@ -14,6 +14,9 @@
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "Buffer/VKDeviceBuffer.h"
+#include "Buffer/VKStagingBufferPool.h"
+#include <memory>
+#include <mutex>
 
 
 namespace LLGL
@@ -36,7 +39,8 @@ class VKDevice
             VkPhysicalDevice                physicalDevice,
             const VkPhysicalDeviceFeatures* features,
             const char* const*              extensions,
-            std::uint32_t                   numExtensions
+            std::uint32_t                   numExtensions,
+            const void*                     featureChain    = nullptr
         );
 
         // Blocks until the VkDevice becomes idle.
@@ -44,12 +48,13 @@ class VKDevice
 
         /* ----- Allocation ----- */
 
-        VKPtr<VkCommandPool> CreateCommandPool();
+        VKPtr<VkCommandPool> CreateCommandPool(std::uint32_t queueFamilyIndex);
 
         /* ----- Queue ----- */
 
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release = true);
+        void FreeCommandBuffer(VkCommandBuffer cmdBuffer);
 
         /* ----- Buffer/Image operatons ----- */
 
@@ -87,7 +92,8 @@ class VKDevice
             const VkExtent3D&   extent,
             std::uint32_t       baseArrayLayer  = 0,
             std::uint32_t       numArrayLayers  = 1,
-            std::uint32_t       mipLevel        = 0
+            std::uint32_t       mipLevel        = 0,
+            VkDeviceSize        srcOffset       = 0
         );
 
         void GenerateMips(
@@ -100,6 +106,48 @@ class VKDevice
         void WriteBuffer(VKDeviceBuffer& buffer, const void* data, VkDeviceSize size, VkDeviceSize offset = 0);
         void FlushMappedBuffer(VKDeviceBuffer& buffer, VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
 
+        /* ----- Staging buffer pool ----- */
+
+        /*
+        Creates the persistent staging buffer pool for data uploads.
+        Must be called after this VKDevice object has reached its final location, since the pool refers to the VkDevice handle.
+        */
+        void CreateStagingPool(
+            const VkPhysicalDeviceMemoryProperties& memoryProperties,
+            VkDeviceSize                            poolSize        = 8*1024*1024
+        );
+
+        /*
+        Copies the specified data into the persistent staging ring and begins recording a transfer command buffer.
+        Returns VK_NULL_HANDLE if the data does not fit into the staging ring;
+        the caller must then fall back to a temporary staging buffer.
+        */
+        VkCommandBuffer BeginStagingUpload(const void* data, VkDeviceSize size, VkBuffer& srcBuffer, VkDeviceSize& srcOffset);
+
+        /*
+        Registers the destination buffer range of the current staging upload.
+        On a dedicated transfer queue, its queue ownership is transferred back to the graphics queue on submission.
+        */
+        void RegisterStagingUploadBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size);
+
+        /*
+        Registers the destination image of the current staging upload and its transition to the shader-read layout.
+        On a dedicated transfer queue, the transition is combined with the queue ownership transfer to the graphics queue.
+        */
+        void RegisterStagingUploadImage(VkImage image, const TextureSubresource& subresource);
+
+        // Submits the recorded staging upload to the transfer queue without waiting for its completion.
+        void EndStagingUpload();
+
+        // Returns the token of the most recently submitted staging upload, or 0 if there is no staging pool.
+        std::uint64_t GetLastStagingUploadToken() const;
+
+        // Returns true if the staging upload with the specified token has completed; a token of 0 is always complete.
+        bool IsStagingUploadComplete(std::uint64_t token);
+
+        // Blocks until the staging upload with the specified token has completed.
+        void WaitForStagingUpload(std::uint64_t token);
+
         /* ----- Handles ----- */
 
         // Returns the native VkDevice handle.
@@ -132,18 +180,57 @@ class VKDevice
             return graphicsQueue_;
         }
 
+        // Returns the native VkQueue handle of the transfer queue; identical to the graphics queue if there is no dedicated transfer queue family.
+        inline VkQueue GetVkTransferQueue() const
+        {
+            return transferQueue_;
+        }
+
+        // Returns true if resource uploads are submitted to a dedicated transfer queue.
+        inline bool HasDedicatedTransferQueue() const
+        {
+            return (queueFamilyIndices_.transferFamily != queueFamilyIndices_.graphicsFamily);
+        }
+
+        // Returns the native VkQueue handle of the compute queue; identical to the graphics queue if there is no dedicated compute queue family.
+        inline VkQueue GetVkComputeQueue() const
+        {
+            return computeQueue_;
+        }
+
+        // Returns true if async compute work can be submitted to a dedicated compute queue.
+        inline bool HasDedicatedComputeQueue() const
+        {
+            return (queueFamilyIndices_.computeFamily != queueFamilyIndices_.graphicsFamily);
+        }
+
         // Returns the native VkCommandPool handle.
         inline const VKPtr<VkCommandPool>& GetVkCommandPool() const
         {
             return commandPool_;
         }
 
+        /*
+        Returns the mutex that serializes all uploads through the shared command pool and staging ring.
+        Callers must hold this mutex over an entire allocate/record/submit span,
+        so resources can be created from multiple threads (see RenderingFeatures::hasConcurrentResourceCreation).
+        */
+        inline std::mutex& GetStagingMutex()
+        {
+            return stagingMutex_;
+        }
+
     private:
 
-        VKPtr<VkDevice>         device_;
-        QueueFamilyIndices      queueFamilyIndices_;
-        VkQueue                 graphicsQueue_      = VK_NULL_HANDLE;
-        VKPtr<VkCommandPool>    commandPool_;
+        VKPtr<VkDevice>                         device_;
+        QueueFamilyIndices                      queueFamilyIndices_;
+        VkQueue                                 graphicsQueue_      = VK_NULL_HANDLE;
+        VkQueue                                 transferQueue_      = VK_NULL_HANDLE;
+        VkQueue                                 computeQueue_       = VK_NULL_HANDLE;
+        VKPtr<VkCommandPool>                    commandPool_;
+        VKPtr<VkCommandPool>                    transferCommandPool_;
+        std::unique_ptr<VKStagingBufferPool>    stagingBufferPool_;
+        std::mutex                              stagingMutex_;
 
 };
 
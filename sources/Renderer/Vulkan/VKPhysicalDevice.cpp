@@ -11,6 +11,7 @@
 #include "../../Core/Vendor.h"
 #include <string>
 #include <cstring>
+#include <iterator>
 #include <set>
 
 
@@ -20,10 +21,48 @@ namespace LLGL
 
 static const char* g_requiredVulkanExtensions[] =
 {
-    VK_KHR_SWAPCHAIN_EXTENSION_NAME,
     VK_KHR_MAINTENANCE1_EXTENSION_NAME,
 };
 
+// Device extensions that are additionally required for presentation, i.e. not for headless render systems
+static const char* g_presentVulkanExtensions[] =
+{
+    VK_KHR_SWAPCHAIN_EXTENSION_NAME,
+};
+
+// Optional device extensions that are enabled whenever the physical device supports them
+static const char* g_optionalVulkanExtensions[] =
+{
+    VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME,
+    VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME,
+    VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME,
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+    #ifdef VK_NV_mesh_shader
+    VK_NV_MESH_SHADER_EXTENSION_NAME,
+    #endif
+};
+
+// Returns the list of all device extensions that are required with the specified presentation mode.
+static std::vector<const char*> GetRequiredDeviceExtensions(bool headless)
+{
+    std::vector<const char*> extensionNames
+    {
+        std::begin(g_requiredVulkanExtensions),
+        std::end(g_requiredVulkanExtensions)
+    };
+
+    if (!headless)
+    {
+        extensionNames.insert(
+            extensionNames.end(),
+            std::begin(g_presentVulkanExtensions),
+            std::end(g_presentVulkanExtensions)
+        );
+    }
+
+    return extensionNames;
+}
+
 static bool CheckDeviceExtensionSupport(
     VkPhysicalDevice                    physicalDevice,
     const char* const*                  requiredExtensions,
@@ -48,14 +87,17 @@ static bool CheckDeviceExtensionSupport(
 
 static bool IsPhysicalDeviceSuitable(
     VkPhysicalDevice                    physicalDevice,
+    bool                                headless,
     std::vector<VkExtensionProperties>& supportedExtensions)
 {
     /* Check if physical devices supports at least these extensions */
+    const auto requiredExtensions = GetRequiredDeviceExtensions(headless);
+
     std::vector<VkExtensionProperties> extensions;
     bool suitable = CheckDeviceExtensionSupport(
         physicalDevice,
-        g_requiredVulkanExtensions,
-        sizeof(g_requiredVulkanExtensions) / sizeof(g_requiredVulkanExtensions[0]),
+        requiredExtensions.data(),
+        requiredExtensions.size(),
         extensions
     );
 
@@ -69,29 +111,152 @@ static bool IsPhysicalDeviceSuitable(
     return false;
 }
 
-bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance)
+// Maps the Vulkan physical device type to the respective video adapter type.
+static VideoAdapterType GetVideoAdapterType(VkPhysicalDeviceType type)
+{
+    switch (type)
+    {
+        case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU:    return VideoAdapterType::IntegratedGPU;
+        case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:      return VideoAdapterType::DiscreteGPU;
+        case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:       return VideoAdapterType::VirtualGPU;
+        case VK_PHYSICAL_DEVICE_TYPE_CPU:               return VideoAdapterType::CPU;
+        default:                                        return VideoAdapterType::Undefined;
+    }
+}
+
+// Returns the accumulated size of all device local memory heaps of the specified physical device.
+static std::uint64_t GetDeviceLocalMemorySize(VkPhysicalDevice physicalDevice)
+{
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+
+    std::uint64_t memorySize = 0;
+
+    for (std::uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i)
+    {
+        if ((memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0)
+            memorySize += memoryProperties.memoryHeaps[i].size;
+    }
+
+    return memorySize;
+}
+
+static VideoAdapterDescriptor QueryVideoAdapterDesc(VkPhysicalDevice physicalDevice)
+{
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+    VideoAdapterDescriptor videoAdapterDesc;
+
+    const std::string deviceName = properties.deviceName;
+    videoAdapterDesc.name               = std::wstring(deviceName.begin(), deviceName.end());
+    videoAdapterDesc.vendor             = GetVendorByID(properties.vendorID);
+    videoAdapterDesc.videoMemory        = GetDeviceLocalMemorySize(physicalDevice);
+    videoAdapterDesc.vendorID           = properties.vendorID;
+    videoAdapterDesc.deviceID           = properties.deviceID;
+    videoAdapterDesc.type               = GetVideoAdapterType(properties.deviceType);
+
+    vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &(videoAdapterDesc.numQueueFamilies), nullptr);
+
+    return videoAdapterDesc;
+}
+
+/*
+Ranks the specified physical device for automatic adapter selection:
+an explicitly preferred adapter type always dominates, the default ranking prefers
+discrete over integrated GPUs, and the device local memory size breaks ties
+*/
+static std::uint64_t ScorePhysicalDevice(
+    VkPhysicalDevice                    physicalDevice,
+    const VkPhysicalDeviceProperties&   properties,
+    const VideoAdapterType              preferredType)
+{
+    std::uint64_t typeRank = 0;
+
+    const auto type = GetVideoAdapterType(properties.deviceType);
+
+    if (preferredType != VideoAdapterType::Undefined && type == preferredType)
+        typeRank = 5;
+    else
+    {
+        switch (type)
+        {
+            case VideoAdapterType::DiscreteGPU:     typeRank = 4; break;
+            case VideoAdapterType::IntegratedGPU:   typeRank = 3; break;
+            case VideoAdapterType::VirtualGPU:      typeRank = 2; break;
+            case VideoAdapterType::CPU:             typeRank = 1; break;
+            default:                                typeRank = 0; break;
+        }
+    }
+
+    return (typeRank << 48) | (GetDeviceLocalMemorySize(physicalDevice) >> 20);
+}
+
+std::vector<VideoAdapterDescriptor> VKPhysicalDevice::QueryVideoAdapters(VkInstance instance)
 {
-    /* Query all physical devices and pick suitable */
     auto physicalDevices = VKQueryPhysicalDevices(instance);
 
+    std::vector<VideoAdapterDescriptor> videoAdapterDescs;
+    videoAdapterDescs.reserve(physicalDevices.size());
+
+    for (const auto& device : physicalDevices)
+        videoAdapterDescs.push_back(QueryVideoAdapterDesc(device));
+
+    return videoAdapterDescs;
+}
+
+bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance, const RenderSystemDescriptor& renderSystemDesc)
+{
+    headless_ = renderSystemDesc.headless;
+
+    /* Query all physical devices and pick the most suitable one */
+    auto physicalDevices = VKQueryPhysicalDevices(instance);
+
+    VkPhysicalDevice                    bestDevice      = VK_NULL_HANDLE;
+    std::uint64_t                       bestScore       = 0;
+    std::vector<VkExtensionProperties>  bestExtensions;
+
     for (const auto& device : physicalDevices)
     {
-        if (IsPhysicalDeviceSuitable(device, supportedExtensions_))
-        {
-            /* Store reference to all extension names */
-            supportedExtensionNames_.reserve(supportedExtensions_.size());
-            for (const auto& extension : supportedExtensions_)
-                supportedExtensionNames_.push_back(extension.extensionName);
+        std::vector<VkExtensionProperties> extensions;
+        if (!IsPhysicalDeviceSuitable(device, headless_, extensions))
+            continue;
 
-            /* Store device and store properties */
-            physicalDevice_ = device;
-            QueryDeviceProperties();
+        VkPhysicalDeviceProperties properties;
+        vkGetPhysicalDeviceProperties(device, &properties);
 
-            return true;
+        /* Skip adapters that don't match an explicit vendor/device ID pin */
+        if (renderSystemDesc.preferredAdapterVendorID != 0 && properties.vendorID != renderSystemDesc.preferredAdapterVendorID)
+            continue;
+        if (renderSystemDesc.preferredAdapterDeviceID != 0 && properties.deviceID != renderSystemDesc.preferredAdapterDeviceID)
+            continue;
+
+        /* Keep the highest ranked adapter */
+        const auto score = ScorePhysicalDevice(device, properties, renderSystemDesc.preferredAdapterType);
+
+        if (bestDevice == VK_NULL_HANDLE || score > bestScore)
+        {
+            bestDevice      = device;
+            bestScore       = score;
+            bestExtensions  = std::move(extensions);
         }
     }
 
-    return false;
+    if (bestDevice == VK_NULL_HANDLE)
+        return false;
+
+    /* Store reference to all extension names */
+    supportedExtensions_ = std::move(bestExtensions);
+    supportedExtensionNames_.reserve(supportedExtensions_.size());
+    for (const auto& extension : supportedExtensions_)
+        supportedExtensionNames_.push_back(extension.extensionName);
+
+    /* Store device and store properties */
+    instance_       = instance;
+    physicalDevice_ = bestDevice;
+    QueryDeviceProperties();
+
+    return true;
 }
 
 static std::vector<Format> GetDefaultSupportedVKTextureFormats()
@@ -130,6 +295,7 @@ static std::initializer_list<Format> GetCompressedVKTextureFormatsS3TC()
         Format::BC3UNorm, Format::BC3UNorm_sRGB,
         Format::BC4UNorm, Format::BC4SNorm,
         Format::BC5UNorm, Format::BC5SNorm,
+        Format::BC7UNorm, Format::BC7UNorm_sRGB,
     };
 }
 
@@ -165,6 +331,7 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.features.hasMultiSampleTextures            = true;
     caps.features.hasTextureViews                   = true;
     caps.features.hasTextureViewSwizzle             = true;
+    caps.features.hasSparseTextures                 = (features_.sparseBinding != VK_FALSE && features_.sparseResidencyImage2D != VK_FALSE);
     caps.features.hasSamplers                       = true;
     caps.features.hasConstantBuffers                = true;
     caps.features.hasStorageBuffers                 = true;
@@ -172,15 +339,20 @@ void VKPhysicalDevice::QueryDeviceProperties(
     caps.features.hasGeometryShaders                = (features_.geometryShader != VK_FALSE);
     caps.features.hasTessellationShaders            = (features_.tessellationShader != VK_FALSE);
     caps.features.hasComputeShaders                 = true;
+    #ifdef VK_NV_mesh_shader
+    caps.features.hasMeshShaders                    = SupportsExtension(VK_NV_MESH_SHADER_EXTENSION_NAME);
+    #endif
     caps.features.hasInstancing                     = true;
     caps.features.hasOffsetInstancing               = true;
     caps.features.hasIndirectDrawing                = (features_.drawIndirectFirstInstance != VK_FALSE);
+    caps.features.hasDrawIndirectCount              = SupportsExtension(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
     caps.features.hasViewportArrays                 = (features_.multiViewport != VK_FALSE);
     caps.features.hasConservativeRasterization      = SupportsExtension(VK_EXT_CONSERVATIVE_RASTERIZATION_EXTENSION_NAME);
     caps.features.hasStreamOutputs                  = SupportsExtension(VK_EXT_TRANSFORM_FEEDBACK_EXTENSION_NAME);
     caps.features.hasLogicOp                        = (features_.logicOp != VK_FALSE);
     caps.features.hasPipelineStatistics             = (features_.pipelineStatisticsQuery != VK_FALSE);
     caps.features.hasRenderCondition                = SupportsExtension(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
+    caps.features.hasConcurrentResourceCreation     = true;
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = limits.lineWidthRange[0];
@@ -213,17 +385,37 @@ void VKPhysicalDevice::QueryDeviceProperties(
 
 VKDevice VKPhysicalDevice::CreateLogicalDevice()
 {
+    /* Enable all required extensions plus the supported optional extensions */
+    auto enabledExtensionNames = GetRequiredDeviceExtensions(headless_);
+
+    for (auto extension : g_optionalVulkanExtensions)
+    {
+        if (SupportsExtension(extension))
+            enabledExtensionNames.push_back(extension);
+    }
+
+    /* Enable mesh shading stages if the respective extension is supported */
+    const void* featureChain = nullptr;
+
+    #ifdef VK_NV_mesh_shader
+    VkPhysicalDeviceMeshShaderFeaturesNV meshShaderFeatures;
+    if (SupportsExtension(VK_NV_MESH_SHADER_EXTENSION_NAME))
+    {
+        meshShaderFeatures.sType        = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV;
+        meshShaderFeatures.pNext        = nullptr;
+        meshShaderFeatures.taskShader   = VK_TRUE;
+        meshShaderFeatures.meshShader   = VK_TRUE;
+        featureChain = &meshShaderFeatures;
+    }
+    #endif // /VK_NV_mesh_shader
+
     VKDevice device;
     device.CreateLogicalDevice(
         physicalDevice_,
         &features_,
-        #if 0
-        supportedExtensionNames_.data(),
-        static_cast<std::uint32_t>(supportedExtensionNames_.size())
-        #else
-        g_requiredVulkanExtensions,
-        sizeof(g_requiredVulkanExtensions) / sizeof(g_requiredVulkanExtensions[0])
-        #endif
+        enabledExtensionNames.data(),
+        static_cast<std::uint32_t>(enabledExtensionNames.size()),
+        featureChain
     );
     return device;
 }
@@ -233,6 +425,46 @@ std::uint32_t VKPhysicalDevice::FindMemoryType(std::uint32_t memoryTypeBits, VkM
     return VKFindMemoryType(memoryProperties_, memoryTypeBits, properties);
 }
 
+std::vector<VideoMemoryBudget> VKPhysicalDevice::QueryMemoryBudgets() const
+{
+    if (physicalDevice_ == VK_NULL_HANDLE || !SupportsExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME))
+        return {};
+
+    /* Load query function from instance (provided by VK_KHR_get_physical_device_properties2) */
+    auto vkGetPhysicalDeviceMemoryProperties2KHRFunc = reinterpret_cast<PFN_vkGetPhysicalDeviceMemoryProperties2KHR>(
+        vkGetInstanceProcAddr(instance_, "vkGetPhysicalDeviceMemoryProperties2KHR")
+    );
+    if (vkGetPhysicalDeviceMemoryProperties2KHRFunc == nullptr)
+        return {};
+
+    /* Query memory budget properties of all heaps */
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties;
+    {
+        budgetProperties.sType  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+        budgetProperties.pNext  = nullptr;
+    }
+    VkPhysicalDeviceMemoryProperties2KHR memoryProperties2;
+    {
+        memoryProperties2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR;
+        memoryProperties2.pNext = (&budgetProperties);
+    }
+    vkGetPhysicalDeviceMemoryProperties2KHRFunc(physicalDevice_, &memoryProperties2);
+
+    const auto& memoryProperties = memoryProperties2.memoryProperties;
+
+    std::vector<VideoMemoryBudget> budgets(memoryProperties.memoryHeapCount);
+
+    for (std::uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i)
+    {
+        budgets[i].usage        = budgetProperties.heapUsage[i];
+        budgets[i].budget       = budgetProperties.heapBudget[i];
+        budgets[i].heapSize     = memoryProperties.memoryHeaps[i].size;
+        budgets[i].deviceLocal  = ((memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0);
+    }
+
+    return budgets;
+}
+
 bool VKPhysicalDevice::SupportsExtension(const char* extension) const
 {
     auto it = std::find_if(
@@ -12,6 +12,7 @@
 #include "Vulkan.h"
 #include "VKDevice.h"
 #include <LLGL/RenderSystemFlags.h>
+#include <LLGL/VideoAdapter.h>
 #include <vector>
 
 
@@ -28,7 +29,10 @@ class VKPhysicalDevice
 
         /* ----- Common ----- */
 
-        bool PickPhysicalDevice(VkInstance instance);
+        // Returns the descriptors of all video adapters with Vulkan support.
+        static std::vector<VideoAdapterDescriptor> QueryVideoAdapters(VkInstance instance);
+
+        bool PickPhysicalDevice(VkInstance instance, const RenderSystemDescriptor& renderSystemDesc);
 
         void QueryDeviceProperties(
             RendererInfo&               info,
@@ -40,6 +44,12 @@ class VKPhysicalDevice
 
         std::uint32_t FindMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
 
+        /*
+        Queries the current memory usage and budget of all device memory heaps.
+        Returns an empty list if the VK_EXT_memory_budget extension is not supported.
+        */
+        std::vector<VideoMemoryBudget> QueryMemoryBudgets() const;
+
         // Returns true if the specified Vulkan extension is supported bny this physical device.
         bool SupportsExtension(const char* extension) const;
 
@@ -87,7 +97,9 @@ class VKPhysicalDevice
 
     private:
 
+        VkInstance                          instance_                   = VK_NULL_HANDLE;
         VkPhysicalDevice                    physicalDevice_             = VK_NULL_HANDLE;
+        bool                                headless_                   = false;
         std::vector<VkExtensionProperties>  supportedExtensions_;
         std::vector<const char*>            supportedExtensionNames_;
 
@@ -11,6 +11,7 @@
 #include "Memory/VKDeviceMemoryManager.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include "../../Core/Helper.h"
+#include <algorithm>
 #include <set>
 
 
@@ -47,6 +48,8 @@ VKRenderContext::VKRenderContext(
     SetOrCreateSurface(surface, desc.videoMode, nullptr);
     desc.videoMode = GetVideoMode();
 
+    presentMode_ = desc.presentMode;
+
     CreatePresentSemaphores();
     CreateGpuSurface();
 
@@ -61,6 +64,8 @@ VKRenderContext::VKRenderContext(
 
 VKRenderContext::~VKRenderContext()
 {
+    /* Wait for the retired swap-chain resources of previous resizes to drain */
+    PollRetiredSwapChains(true);
     ReleaseDepthStencilBuffer();
 }
 
@@ -84,7 +89,11 @@ void VKRenderContext::Present()
         submitInfo.signalSemaphoreCount = 1;
         submitInfo.pSignalSemaphores    = signalSemaphores;
     }
-    auto result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
+    VkResult result;
+    {
+        std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(graphicsQueue_) };
+        result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, VK_NULL_HANDLE);
+    }
     VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
 
     /* Present result on screen */
@@ -101,11 +110,20 @@ void VKRenderContext::Present()
         presentInfo.pImageIndices       = &presentImageIndex_;
         presentInfo.pResults            = nullptr;
     }
-    result = vkQueuePresentKHR(presentQueue_, &presentInfo);
+    {
+        std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(presentQueue_) };
+        result = vkQueuePresentKHR(presentQueue_, &presentInfo);
+    }
     VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
 
     /* Get image index for next presentation */
     AcquireNextPresentImage();
+
+    /* Destroy retired swap-chain resources of previous resizes once their frames have drained */
+    PollRetiredSwapChains(false);
+
+    /* Incrementally defragment device memory between frames (one chunk per frame) */
+    deviceMemoryMngr_.DefragmentMemory(1);
 }
 
 Format VKRenderContext::GetColorFormat() const
@@ -137,17 +155,19 @@ bool VKRenderContext::HasDepthStencilBuffer() const
 
 bool VKRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
 {
-    const auto& prevVideoMode = GetVideoMode();
-
-    /* Wait until graphics queue is idle before resources are destroyed and recreated */
-    vkQueueWaitIdle(graphicsQueue_);
+    /*
+    Retire the current swap-chain resources instead of waiting for the queue to drain;
+    the new swap-chain takes over via 'oldSwapchain' while in-flight frames complete naturally
+    */
+    RetireSwapChain(true);
 
-    /* Recreate presenting semaphores and Vulkan surface */
+    /* Recreate presenting semaphores */
     CreatePresentSemaphores();
-    CreateGpuSurface();
 
-    /* Recreate (or just release) depth-stencil buffer */
-    ReleaseDepthStencilBuffer();
+    /* Re-query surface capabilities for the new resolution; the surface itself is independent of the video mode */
+    surfaceSupportDetails_ = VKQuerySurfaceSupport(physicalDevice_, surface_);
+
+    /* Recreate depth-stencil buffer (the previous one was moved into the retirement bucket) */
     if (videoModeDesc.depthBits > 0 || videoModeDesc.stencilBits > 0)
         CreateDepthStencilBuffer(videoModeDesc);
 
@@ -163,7 +183,9 @@ bool VKRenderContext::OnSetVideoMode(const VideoModeDescriptor& videoModeDesc)
 
 bool VKRenderContext::OnSetVsync(const VsyncDescriptor& vsyncDesc)
 {
-    /* Recreate swap-chain with new vsnyc settings */
+    /* Recreate swap-chain with new vsnyc settings; keep the depth-stencil buffer, since the resolution is unchanged */
+    RetireSwapChain(false);
+    CreatePresentSemaphores();
     CreateSwapChain(GetVideoMode(), vsyncDesc);
     return true;
 }
@@ -321,7 +343,9 @@ void VKRenderContext::CreateSwapChain(const VideoModeDescriptor& videoModeDesc,
         createInfo.compositeAlpha               = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
         createInfo.presentMode                  = presentMode;
         createInfo.clipped                      = VK_TRUE;
-        createInfo.oldSwapchain                 = VK_NULL_HANDLE;
+
+        /* Hand the retired swap-chain over to the driver, so it can recycle its presentable images */
+        createInfo.oldSwapchain                 = (retiredSwapChains_.empty() ? VK_NULL_HANDLE : retiredSwapChains_.back().swapChain.Get());
     }
     auto result = vkCreateSwapchainKHR(device_, &createInfo, nullptr, swapChain_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan swap-chain");
@@ -439,6 +463,65 @@ void VKRenderContext::ReleaseDepthStencilBuffer()
     depthStencilBuffer_.ReleaseDepthStencil(deviceMemoryMngr_);
 }
 
+void VKRenderContext::RetireSwapChain(bool retireDepthStencilBuffer)
+{
+    if (swapChain_.Get() == VK_NULL_HANDLE)
+        return;
+
+    /* Destroy retired swap-chains of previous resizes whose frames have already drained */
+    PollRetiredSwapChains(false);
+
+    /* Move all swap-chain dependent resources into a retirement bucket */
+    retiredSwapChains_.emplace_back(device_);
+    auto& retired = retiredSwapChains_.back();
+
+    retired.swapChain               = std::move(swapChain_);
+    retired.imageViews              = std::move(swapChainImageViews_);
+    retired.framebuffers            = std::move(swapChainFramebuffers_);
+    retired.imageAvailableSemaphore = std::move(imageAvailableSemaphore_);
+    retired.renderFinishedSemaphore = std::move(renderFinishedSemaphore_);
+
+    if (retireDepthStencilBuffer)
+        retired.depthStencilBuffer = std::move(depthStencilBuffer_);
+
+    /* Submit fence to the graphics queue; it signals once all in-flight frames have drained */
+    VkFenceCreateInfo fenceInfo;
+    {
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceInfo.pNext = nullptr;
+        fenceInfo.flags = 0;
+    }
+    auto result = vkCreateFence(device_, &fenceInfo, nullptr, retired.fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence for retired swap-chain");
+
+    {
+        std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(graphicsQueue_) };
+        result = vkQueueSubmit(graphicsQueue_, 0, nullptr, retired.fence);
+    }
+    VKThrowIfFailed(result, "failed to submit Vulkan fence for retired swap-chain");
+}
+
+void VKRenderContext::PollRetiredSwapChains(bool wait)
+{
+    for (auto it = retiredSwapChains_.begin(); it != retiredSwapChains_.end();)
+    {
+        if (wait)
+        {
+            VkFence fence = it->fence.Get();
+            vkWaitForFences(device_, 1, &fence, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+        }
+
+        if (vkGetFenceStatus(device_, it->fence) == VK_SUCCESS)
+        {
+            /* All frames that referenced these resources have drained */
+            it->depthStencilBuffer.ReleaseDepthStencil(deviceMemoryMngr_);
+            it = retiredSwapChains_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
 VkSurfaceFormatKHR VKRenderContext::PickSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& surfaceFormats) const
 {
     if (surfaceFormats.empty())
@@ -456,8 +539,30 @@ VkSurfaceFormatKHR VKRenderContext::PickSwapSurfaceFormat(const std::vector<VkSu
     return surfaceFormats.front();
 }
 
+static bool IsPresentModeSupported(const std::vector<VkPresentModeKHR>& presentModes, VkPresentModeKHR mode)
+{
+    return (std::find(presentModes.begin(), presentModes.end(), mode) != presentModes.end());
+}
+
 VkPresentModeKHR VKRenderContext::PickSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, const VsyncDescriptor& vsyncDesc) const
 {
+    /* Map explicitly requested presentation mode to native mode; fall back to the v-sync derived mode if unsupported */
+    switch (presentMode_)
+    {
+        case PresentMode::Fifo:
+            return VK_PRESENT_MODE_FIFO_KHR;
+        case PresentMode::Mailbox:
+            if (IsPresentModeSupported(presentModes, VK_PRESENT_MODE_MAILBOX_KHR))
+                return VK_PRESENT_MODE_MAILBOX_KHR;
+            break;
+        case PresentMode::Immediate:
+            if (IsPresentModeSupported(presentModes, VK_PRESENT_MODE_IMMEDIATE_KHR))
+                return VK_PRESENT_MODE_IMMEDIATE_KHR;
+            break;
+        default:
+            break;
+    }
+
     if (!vsyncDesc.enabled)
     {
         /* Check if MAILBOX or IMMEDIATE presentation mode is available, to avoid vertical synchronization */
@@ -80,6 +80,32 @@ class VKRenderContext final : public RenderContext
         // Returns true if this render context has a depth-stencil buffer.
         bool HasDepthStencilBuffer() const;
 
+    private:
+
+        /*
+        Swap-chain resources that were replaced by an in-place resize; they are kept alive
+        until the in-flight frames that still reference them have drained (see RetireSwapChain).
+        */
+        struct VKRetiredSwapChain
+        {
+            VKPtr<VkSwapchainKHR>               swapChain;
+            std::vector<VKPtr<VkImageView>>     imageViews;
+            std::vector<VKPtr<VkFramebuffer>>   framebuffers;
+            VKPtr<VkSemaphore>                  imageAvailableSemaphore;
+            VKPtr<VkSemaphore>                  renderFinishedSemaphore;
+            VKDepthStencilBuffer                depthStencilBuffer;
+            VKPtr<VkFence>                      fence;
+
+            VKRetiredSwapChain(const VKPtr<VkDevice>& device) :
+                swapChain               { device, vkDestroySwapchainKHR },
+                imageAvailableSemaphore { device, vkDestroySemaphore    },
+                renderFinishedSemaphore { device, vkDestroySemaphore    },
+                depthStencilBuffer      { device                        },
+                fence                   { device, vkDestroyFence        }
+            {
+            }
+        };
+
     private:
 
         bool OnSetVideoMode(const VideoModeDescriptor& videoModeDesc) override;
@@ -100,6 +126,9 @@ class VKRenderContext final : public RenderContext
         void CreateDepthStencilBuffer(const VideoModeDescriptor& videoModeDesc);
         void ReleaseDepthStencilBuffer();
 
+        void RetireSwapChain(bool retireDepthStencilBuffer);
+        void PollRetiredSwapChains(bool wait);
+
         VkSurfaceFormatKHR PickSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& surfaceFormats) const;
         VkPresentModeKHR PickSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, const VsyncDescriptor& vsyncDesc) const;
         VkExtent2D PickSwapExtent(const VkSurfaceCapabilitiesKHR& surfaceCaps, std::uint32_t width, std::uint32_t height) const;
@@ -127,6 +156,9 @@ class VKRenderContext final : public RenderContext
         std::vector<VKPtr<VkImageView>>     swapChainImageViews_;
         std::vector<VKPtr<VkFramebuffer>>   swapChainFramebuffers_;
         std::uint32_t                       presentImageIndex_          = 0;
+        PresentMode                         presentMode_                = PresentMode::Default;
+
+        std::vector<VKRetiredSwapChain>     retiredSwapChains_;
 
         VKRenderPass                        secondaryRenderPass_;
         VKDepthStencilBuffer                depthStencilBuffer_;
@@ -10,16 +10,21 @@
 #include "Ext/VKExtensionLoader.h"
 #include "Ext/VKExtensions.h"
 #include "Memory/VKDeviceMemory.h"
+#include "Texture/VKMipGenerator.h"
 #include "../RenderSystemUtils.h"
 #include "../TextureUtils.h"
+#include "../PipelineStateHash.h"
 #include "../CheckedCast.h"
 #include "../../Core/Helper.h"
+#include "../../Core/SmallVector.h"
 #include "../../Core/Vendor.h"
 #include "VKCore.h"
 #include "VKTypes.h"
 #include "VKInitializers.h"
 #include <LLGL/Log.h>
 #include <LLGL/ImageFlags.h>
+#include <algorithm>
+#include <string.h>
 
 
 namespace LLGL
@@ -52,27 +57,43 @@ static VkBufferUsageFlags GetStagingVkBufferUsageFlags(long cpuAccessFlags)
         return VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 }
 
+// Returns true if the specified buffer can be suballocated from a shared buffer, i.e. only vertex/index buffers without CPU access
+static bool IsSuballocatableBuffer(const BufferDescriptor& desc)
+{
+    return
+    (
+        (desc.miscFlags & MiscFlags::Suballocated) != 0                                 &&
+        (desc.miscFlags & (MiscFlags::DynamicUsage | MiscFlags::PersistentMapped)) == 0 &&
+        (desc.bindFlags & ~(BindFlags::VertexBuffer | BindFlags::IndexBuffer)) == 0     &&
+        desc.cpuAccessFlags == 0
+    );
+}
+
 
 /* ----- Common ----- */
 
 VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     instance_            { vkDestroyInstance                        },
-    debugReportCallback_ { instance_, DestroyDebugReportCallbackEXT }
+    debugReportCallback_ { instance_, DestroyDebugReportCallbackEXT },
+    pipelineCache_       { device_, vkDestroyPipelineCache          }
 {
     /* Extract optional renderer configuartion */
     auto rendererConfigVK = GetRendererConfiguration<RendererConfigurationVulkan>(renderSystemDesc);
 
+    headless_ = renderSystemDesc.headless;
+
     #ifdef LLGL_DEBUG
     debugLayerEnabled_ = true;
     #endif
 
     /* Create Vulkan instance and device objects */
     CreateInstance(rendererConfigVK);
-    PickPhysicalDevice();
+    PickPhysicalDevice(renderSystemDesc);
     CreateLogicalDevice();
 
     /* Create default resources */
     CreateDefaultPipelineLayout();
+    CreatePipelineCache();
 
     /* Create device memory manager */
     deviceMemoryMngr_ = MakeUnique<VKDeviceMemoryManager>(
@@ -81,17 +102,61 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         (rendererConfigVK != nullptr ? rendererConfigVK->minDeviceMemoryAllocationSize : 1024*1024),
         (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
     );
+
+    /* Enable sparse binding operations on the command queue */
+    commandQueue_->SetDeviceMemoryManager(deviceMemoryMngr_.get());
+
+    /* Create framebuffer cache for render targets */
+    framebufferCache_ = MakeUnique<VKFramebufferCache>(device_.GetVkDevice());
+
+    /* Create shared buffer pool for suballocated vertex and index buffers */
+    sharedBufferPool_ = MakeUnique<VKSharedBufferPool>(
+        device_,
+        *deviceMemoryMngr_,
+        (VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT)
+    );
+
+    /* Check memory budgets whenever a new device memory chunk has been allocated */
+    deviceMemoryMngr_->SetAllocChunkCallback(
+        [this](VkDeviceSize /*chunkSize*/, std::uint32_t /*memoryTypeIndex*/)
+        {
+            NotifyVideoMemoryPressure();
+        }
+    );
 }
 
 VKRenderSystem::~VKRenderSystem()
 {
     device_.WaitIdle();
+    PollDeferredUploads(nullptr, false);
+    PollDeferredDestructions(true);
+    VKMipGenerator::Get().Clear();
+}
+
+std::vector<VideoAdapterDescriptor> VKRenderSystem::QueryVideoAdapters() const
+{
+    return VKPhysicalDevice::QueryVideoAdapters(instance_);
+}
+
+std::vector<VideoMemoryBudget> VKRenderSystem::QueryVideoMemoryBudgets() const
+{
+    return physicalDevice_.QueryMemoryBudgets();
+}
+
+std::vector<DeviceMemoryStats> VKRenderSystem::QueryDeviceMemoryStats() const
+{
+    if (deviceMemoryMngr_)
+        return deviceMemoryMngr_->QueryStats();
+    else
+        return {};
 }
 
 /* ----- Render Context ----- */
 
 RenderContext* VKRenderSystem::CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface)
 {
+    if (headless_)
+        throw std::runtime_error("cannot create render context with headless Vulkan render system");
     return TakeOwnership(
         renderContexts_,
         MakeUnique<VKRenderContext>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, desc, surface)
@@ -110,18 +175,63 @@ CommandQueue* VKRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* VKRenderSystem::GetComputeCommandQueue()
+{
+    return computeCommandQueue_.get();
+}
+
+std::uint32_t VKRenderSystem::GetNumCommandQueues(const CommandQueueType queueType)
+{
+    switch (queueType)
+    {
+        case CommandQueueType::Graphics:
+            return 1;
+        case CommandQueueType::Compute:
+            return (computeCommandQueue_ ? 1 : 0);
+        default:
+            return 0;
+    }
+}
+
+CommandQueue* VKRenderSystem::GetCommandQueue(const CommandQueueType queueType, std::uint32_t index)
+{
+    if (index > 0)
+        return nullptr;
+    switch (queueType)
+    {
+        case CommandQueueType::Graphics:
+            return commandQueue_.get();
+        case CommandQueueType::Compute:
+            return computeCommandQueue_.get();
+        default:
+            return nullptr;
+    }
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* VKRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& desc)
 {
-    return TakeOwnership(
+    /* Compute-only command buffers are allocated for (and submitted to) the compute queue */
+    const bool isComputeOnly = ((desc.flags & CommandBufferFlags::ComputeOnly) != 0);
+    auto queue = (isComputeOnly ? device_.GetVkComputeQueue() : device_.GetVkQueue());
+
+    std::lock_guard<std::mutex> guard { commandBufferMutex_ };
+    auto commandBufferVK = TakeOwnership(
         commandBuffers_,
-        MakeUnique<VKCommandBuffer>(physicalDevice_, device_, device_.GetVkQueue(), device_.GetQueueFamilyIndices(), desc)
+        MakeUnique<VKCommandBuffer>(physicalDevice_, device_, queue, device_.GetQueueFamilyIndices(), desc)
     );
+
+    /* Seed transient descriptor pool demand from all previously created pipeline layouts */
+    for (auto pipelineLayout : pipelineLayouts_)
+        commandBufferVK->RegisterTransientLayoutDemand(pipelineLayout->GetDescriptorPoolSizes());
+
+    return commandBufferVK;
 }
 
 void VKRenderSystem::Release(CommandBuffer& commandBuffer)
 {
+    std::lock_guard<std::mutex> guard { commandBufferMutex_ };
     RemoveFromUniqueSet(commandBuffers_, &commandBuffer);
 }
 
@@ -131,6 +241,69 @@ Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& desc, const void* i
 {
     AssertCreateBuffer(desc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
 
+    /* Submit the fence for pending destructions and reclaim retired objects, so their device memory can be reused */
+    FlushDeferredDestructions();
+    PollDeferredDestructions(false);
+
+    if ((desc.miscFlags & MiscFlags::PersistentMapped) != 0)
+    {
+        /* Create buffer object with host-visible memory in its own exclusive chunk */
+        auto buffer = TakeOwnership(buffers_, MakeUnique<VKBuffer>(device_, desc));
+
+        auto memoryRegion = deviceMemoryMngr_->AllocateDedicated(
+            buffer->GetDeviceBuffer().GetRequirements(),
+            (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT),
+            VK_NULL_HANDLE
+        );
+        buffer->BindMemoryRegion(device_, memoryRegion);
+
+        /* Map buffer memory persistently, so writes become plain stores */
+        auto mappedMemory = memoryRegion->GetParentChunk()->Map(device_, memoryRegion->GetOffset(), desc.size);
+        buffer->SetPersistentMappedMemory(mappedMemory);
+
+        if (initialData != nullptr)
+            ::memcpy(mappedMemory, initialData, static_cast<std::size_t>(desc.size));
+
+        return buffer;
+    }
+
+    if (IsSuballocatableBuffer(desc))
+    {
+        /* Suballocate buffer as a range of a shared hardware buffer */
+        VkBuffer        sharedBuffer = VK_NULL_HANDLE;
+        VkDeviceSize    sharedOffset = 0;
+
+        if (sharedBufferPool_->Allocate(desc.size, sharedBuffer, sharedOffset))
+        {
+            auto buffer = TakeOwnership(buffers_, MakeUnique<VKBuffer>(device_, desc, sharedBuffer, sharedOffset));
+
+            if (initialData != nullptr)
+                WriteBuffer(*buffer, 0, initialData, desc.size);
+
+            return buffer;
+        }
+    }
+
+    if ( initialData == nullptr &&
+         (desc.miscFlags & MiscFlags::NoInitialData) != 0 &&
+         (desc.miscFlags & MiscFlags::DynamicUsage ) == 0 &&
+         (desc.cpuAccessFlags & CPUAccessFlags::Write) == 0 )
+    {
+        /* No initialization and no CPU write access: allocate the buffer and its device memory without any staging buffer */
+        auto buffer = TakeOwnership(buffers_, MakeUnique<VKBuffer>(device_, desc));
+
+        auto memoryRegion = deviceMemoryMngr_->Allocate(
+            buffer->GetDeviceBuffer().GetRequirements(),
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        );
+        buffer->BindMemoryRegion(device_, memoryRegion);
+
+        return buffer;
+    }
+
+    /* Serialize the upload span below, since the shared command pool is used for the buffer copy */
+    std::lock_guard<std::mutex> stagingGuard { device_.GetStagingMutex() };
+
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
     BuildVkBufferCreateInfo(
@@ -177,11 +350,14 @@ BufferArray* VKRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void VKRenderSystem::Release(Buffer& buffer)
 {
-    /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
-    bufferVK.GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
-    bufferVK.GetStagingDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
-    RemoveFromUniqueSet(buffers_, &buffer);
+
+    /* Reclaim objects of previously retired destruction buckets */
+    PollDeferredDestructions(false);
+
+    /* Detach buffer from container and defer its destruction until the GPU can no longer use it */
+    std::lock_guard<std::mutex> destructionGuard { deferredDestructionMutex_ };
+    OpenDeferredDestruction().buffers.push_back(buffers_.extract(&bufferVK));
 }
 
 void VKRenderSystem::Release(BufferArray& bufferArray)
@@ -193,6 +369,12 @@ void VKRenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, con
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
 
+    /* Apply range offset for buffers that are suballocated from a shared hardware buffer */
+    dstOffset += bufferVK.GetOffset();
+
+    /* Serialize the upload, since the staging ring and the shared command pool are used */
+    std::lock_guard<std::mutex> stagingGuard { device_.GetStagingMutex() };
+
     if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy data to staging buffer memory */
@@ -203,21 +385,34 @@ void VKRenderSystem::WriteBuffer(Buffer& dstBuffer, std::uint64_t dstOffset, con
     }
     else
     {
-        /* Create staging buffer */
-        VkBufferCreateInfo stagingCreateInfo;
-        BuildVkBufferCreateInfo(
-            stagingCreateInfo,
-            dataSize,
-            (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT)
-        );
+        /* Copy data into persistent staging ring and record the buffer copy without a blocking wait */
+        VkBuffer        srcBuffer = VK_NULL_HANDLE;
+        VkDeviceSize    srcOffset = 0;
+
+        if (auto cmdBuffer = device_.BeginStagingUpload(data, dataSize, srcBuffer, srcOffset))
+        {
+            device_.CopyBuffer(cmdBuffer, srcBuffer, bufferVK.GetVkBuffer(), dataSize, srcOffset, dstOffset);
+            device_.RegisterStagingUploadBuffer(bufferVK.GetVkBuffer(), dstOffset, dataSize);
+            device_.EndStagingUpload();
+        }
+        else
+        {
+            /* Create temporary staging buffer for uploads that do not fit into the staging ring */
+            VkBufferCreateInfo stagingCreateInfo;
+            BuildVkBufferCreateInfo(
+                stagingCreateInfo,
+                dataSize,
+                (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT)
+            );
 
-        auto stagingBuffer = CreateStagingBuffer(stagingCreateInfo, data, dataSize);
+            auto stagingBuffer = CreateStagingBuffer(stagingCreateInfo, data, dataSize);
 
-        /* Copy staging buffer into hardware buffer */
-        device_.CopyBuffer(stagingBuffer.GetVkBuffer(), bufferVK.GetVkBuffer(), dataSize, 0, dstOffset);
+            /* Copy staging buffer into hardware buffer */
+            device_.CopyBuffer(stagingBuffer.GetVkBuffer(), bufferVK.GetVkBuffer(), dataSize, 0, dstOffset);
 
-        /* Release device memory region of staging buffer */
-        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+            /* Release device memory region of staging buffer */
+            stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+        }
     }
 }
 
@@ -229,7 +424,10 @@ void* VKRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
     {
         /* Copy GPU local buffer into staging buffer for read accces */
         if (access != CPUAccess::WriteOnly && access != CPUAccess::WriteDiscard)
+        {
+            std::lock_guard<std::mutex> stagingGuard { device_.GetStagingMutex() };
             device_.CopyBuffer(bufferVK.GetVkBuffer(), stagingBuffer, bufferVK.GetSize());
+        }
 
         /* Map staging buffer */
         return bufferVK.Map(device_, access);
@@ -249,10 +447,24 @@ void VKRenderSystem::UnmapBuffer(Buffer& buffer)
 
         /* Copy staging buffer into GPU local buffer for write access */
         if (bufferVK.GetMappedCPUAccess() != CPUAccess::ReadOnly)
+        {
+            std::lock_guard<std::mutex> stagingGuard { device_.GetStagingMutex() };
             device_.CopyBuffer(stagingBuffer, bufferVK.GetVkBuffer(), bufferVK.GetSize());
+        }
     }
 }
 
+void* VKRenderSystem::GetMappedBufferMemory(Buffer& buffer)
+{
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    return bufferVK.GetPersistentMappedMemory();
+}
+
+void VKRenderSystem::FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    /* No explicit flush required, since persistently mapped buffers are allocated in host-coherent memory */
+}
+
 /* ----- Textures ----- */
 
 // Returns the extent for the specified texture dimensionality (used for the dimension of 'VK_IMAGE_TYPE_1D/ 2D/ 3D')
@@ -283,11 +495,50 @@ static std::uint32_t GetTextureLayertCount(const TextureDescriptor& desc)
 
 Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc)
 {
+    /* Submit the fence for pending destructions and reclaim retired objects, so their device memory can be reused */
+    FlushDeferredDestructions();
+    PollDeferredDestructions(false);
+
+    if ((textureDesc.miscFlags & MiscFlags::SparseResidency) != 0)
+    {
+        /* Check if sparse residency for 2D images is supported by the device */
+        const auto& features = physicalDevice_.GetFeatures();
+        if (features.sparseBinding == VK_FALSE || features.sparseResidencyImage2D == VK_FALSE)
+            throw std::runtime_error("cannot create sparse texture: sparse residency is not supported by device");
+
+        /*
+        Create sparse texture without initial data;
+        it has no device memory bound until its residency is updated via sparse binding
+        */
+        auto textureVK = MakeUnique<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
+        textureVK->CreateInternalImageView(device_);
+
+        /* Make the smallest MIP-map levels resident before first use */
+        if (textureDesc.sparseResidentMipLevels > 0)
+        {
+            const auto mipLevels        = textureVK->GetNumMipLevels();
+            const auto numResidentMips  = std::min(textureDesc.sparseResidentMipLevels, mipLevels);
+            commandQueue_->BindSparseTexture(*textureVK, mipLevels - numResidentMips, numResidentMips, true);
+        }
+
+        return TakeOwnership(textures_, std::move(textureVK));
+    }
+
     const auto& cfg = GetConfiguration();
 
     /* Determine size of image for staging buffer */
-    const auto imageSize        = TextureSize(textureDesc);
-    const auto initialDataSize  = static_cast<VkDeviceSize>(TextureBufferSize(textureDesc.format, imageSize));
+    const auto imageSize = TextureSize(textureDesc);
+
+    VkDeviceSize initialDataSize = 0;
+    if (IsCompressedFormat(textureDesc.format))
+    {
+        /* Use block-rounded subresource layout, since NPOT extents still occupy whole compression blocks */
+        const auto numLayers    = (IsArrayTexture(textureDesc.type) || IsCubeTexture(textureDesc.type) ? textureDesc.arrayLayers : 1u);
+        const auto layout       = CalcSubresourceLayout(textureDesc.format, textureDesc.extent);
+        initialDataSize = static_cast<VkDeviceSize>(layout.dataSize) * numLayers;
+    }
+    else
+        initialDataSize = static_cast<VkDeviceSize>(TextureBufferSize(textureDesc.format, imageSize));
 
     /* Set up initial image data */
     const void* initialData = nullptr;
@@ -302,6 +553,13 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             /* Convert image format (will be null if no conversion is necessary) */
             intermediateData = ConvertImageBuffer(*imageDesc, formatAttribs.format, formatAttribs.dataType, cfg.threadCount);
         }
+        else if ((formatAttribs.flags & FormatFlags::IsCompressed) != 0 && imageDesc->format != formatAttribs.format)
+        {
+            /* Transcode image data into the compressed texture format; array layers count as additional depth slices in the block layout */
+            const auto numLayers = (IsArrayTexture(textureDesc.type) || IsCubeTexture(textureDesc.type) ? textureDesc.arrayLayers : 1u);
+            const Extent3D blockExtent { textureDesc.extent.width, textureDesc.extent.height, textureDesc.extent.depth * numLayers };
+            intermediateData = ConvertImageBuffer(*imageDesc, blockExtent, formatAttribs.format, formatAttribs.dataType, cfg.threadCount);
+        }
 
         if (intermediateData)
         {
@@ -338,6 +596,73 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         initialData = intermediateData.get();
     }
 
+    /* Serialize the upload spans below, since the staging ring and the shared command pool are used */
+    std::lock_guard<std::mutex> stagingGuard { device_.GetStagingMutex() };
+
+    if (initialData == nullptr)
+    {
+        /* No initialization: allocate the image and transition it into its sampling-ready state without any staging copy */
+        auto textureVK = MakeUnique<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
+
+        const TextureSubresource subresource{ 0, textureVK->GetNumArrayLayers(), 0, textureVK->GetNumMipLevels() };
+
+        auto cmdBuffer = device_.AllocCommandBuffer();
+        {
+            textureVK->TransitionSubresourceLayouts(cmdBuffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresource);
+        }
+        device_.FlushCommandBuffer(cmdBuffer);
+
+        /* Create image view for texture */
+        textureVK->CreateInternalImageView(device_);
+
+        return TakeOwnership(textures_, std::move(textureVK));
+    }
+
+    /* For deferred uploads without MIP-map generation, ride the transfer queue via the staging ring */
+    const bool deferredUpload = ((textureDesc.miscFlags & MiscFlags::DeferredUpload) != 0 && initialData != nullptr);
+
+    if (deferredUpload && !(imageDesc != nullptr && MustGenerateMipsOnCreate(textureDesc)))
+    {
+        VkBuffer        ringBuffer = VK_NULL_HANDLE;
+        VkDeviceSize    ringOffset = 0;
+
+        if (auto ringCmdBuffer = device_.BeginStagingUpload(initialData, initialDataSize, ringBuffer, ringOffset))
+        {
+            /* Create device texture and record the transfer commands into the staging batch */
+            auto textureVK = MakeUnique<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
+
+            const TextureSubresource subresource{ 0, textureVK->GetNumArrayLayers(), 0, textureVK->GetNumMipLevels() };
+
+            textureVK->TransitionSubresourceLayouts(ringCmdBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource);
+
+            device_.CopyBufferToImage(
+                ringCmdBuffer,
+                ringBuffer,
+                textureVK->GetVkImage(),
+                VkOffset3D{ 0, 0, 0 },
+                GetTextureVkExtent(textureDesc),
+                0,
+                GetTextureLayertCount(textureDesc),
+                0,
+                ringOffset
+            );
+
+            device_.RegisterStagingUploadImage(textureVK->GetVkImage(), subresource);
+
+            /* The staging ring records the sampling-ready transition on submit, so track its target layout here */
+            textureVK->SetSubresourceLayouts(subresource, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+            /* Submit batch without waiting and keep its token as readiness ticket */
+            device_.EndStagingUpload();
+            textureVK->SetUploadBatchToken(device_.GetLastStagingUploadToken());
+
+            /* Create image view for texture */
+            textureVK->CreateInternalImageView(device_);
+
+            return TakeOwnership(textures_, std::move(textureVK));
+        }
+    }
+
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
     BuildVkBufferCreateInfo(
@@ -356,20 +681,11 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     auto arrayLayers    = textureVK->GetNumArrayLayers();
 
     /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-    auto formatVK = VKTypes::Map(textureDesc.format);
-
     auto cmdBuffer = device_.AllocCommandBuffer();
     {
         const TextureSubresource subresource{ 0, arrayLayers, 0, mipLevels };
 
-        device_.TransitionImageLayout(
-            cmdBuffer,
-            image,
-            formatVK,
-            VK_IMAGE_LAYOUT_UNDEFINED,
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            subresource
-        );
+        textureVK->TransitionSubresourceLayouts(cmdBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource);
 
         device_.CopyBufferToImage(
             cmdBuffer,
@@ -381,30 +697,24 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
             GetTextureLayertCount(textureDesc)
         );
 
-        device_.TransitionImageLayout(
-            cmdBuffer,
-            image,
-            formatVK,
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-            subresource
-        );
+        textureVK->TransitionSubresourceLayouts(cmdBuffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresource);
 
         /* Generate MIP-maps if enabled */
         if (imageDesc != nullptr && MustGenerateMipsOnCreate(textureDesc))
-        {
-            device_.GenerateMips(
-                cmdBuffer,
-                textureVK->GetVkImage(),
-                textureVK->GetVkExtent(),
-                subresource
-            );
-        }
+            VKMipGenerator::Get().GenerateMips(device_, cmdBuffer, *textureVK, subresource);
+    }
+    if (deferredUpload)
+    {
+        /* Submit upload with a fence and keep the staging buffer alive until it is signaled */
+        SubmitDeferredUpload(textureVK.get(), cmdBuffer, std::move(stagingBuffer));
     }
-    device_.FlushCommandBuffer(cmdBuffer);
+    else
+    {
+        device_.FlushCommandBuffer(cmdBuffer);
 
-    /* Release staging buffer */
-    stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+        /* Release staging buffer */
+        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    }
 
     /* Create image view for texture */
     textureVK->CreateInternalImageView(device_);
@@ -412,12 +722,27 @@ Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     return TakeOwnership(textures_, std::move(textureVK));
 }
 
+Texture* VKRenderSystem::CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc)
+{
+    auto& sharedTextureVK = LLGL_CAST(VKTexture&, sharedTexture);
+    return TakeOwnership(textures_, MakeUnique<VKTexture>(device_, sharedTextureVK, textureViewDesc));
+}
+
 void VKRenderSystem::Release(Texture& texture)
 {
-    /* Release device memory region, then release texture object */
+    /* Wait for any pending deferred upload before the texture destruction is enqueued */
+    PollDeferredUploads(&texture, true);
+    PollDeferredDestructions(false);
+
+    /* Detach texture from container and defer its destruction until the GPU can no longer use it */
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
-    deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
-    RemoveFromUniqueSet(textures_, &texture);
+
+    /* Evict cached framebuffers that reference attachment views of this texture */
+    for (const auto& attachmentView : textureVK.GetAttachmentViews())
+        framebufferCache_->NotifyReleasedImageView(attachmentView.imageView.Get());
+
+    std::lock_guard<std::mutex> destructionGuard { deferredDestructionMutex_ };
+    OpenDeferredDestruction().textures.push_back(textures_.extract(&textureVK));
 }
 
 void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc)
@@ -435,7 +760,14 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
     auto        image           = textureVK.GetVkImage();
     const auto  imageSize       = extent.width * extent.height * extent.depth;
     const void* imageData       = nullptr;
-    const auto  imageDataSize   = static_cast<VkDeviceSize>(TextureBufferSize(format, imageSize));
+
+    /* Compressed formats must be sized per block-rounded row, uncompressed formats per texel */
+    const auto imageDataSize =
+    (
+        IsCompressedFormat(format)
+            ? static_cast<VkDeviceSize>(CalcSubresourceLayout(format, extent).dataSize)
+            : static_cast<VkDeviceSize>(TextureBufferSize(format, imageSize))
+    );
 
     /* Check if image data must be converted */
     ByteBuffer intermediateData;
@@ -467,52 +799,256 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
         imageData = imageDesc.data;
     }
 
-    /* Create staging buffer */
-    VkBufferCreateInfo stagingCreateInfo;
-    BuildVkBufferCreateInfo(
-        stagingCreateInfo,
-        imageDataSize,
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT  // <-- TODO: support read/write mapping //GetStagingVkBufferUsageFlags(desc.cpuAccessFlags)
-    );
+    /* Copy image data into persistent staging ring, or fall back to a temporary staging buffer for large uploads */
+    VkBuffer        srcBuffer = VK_NULL_HANDLE;
+    VkDeviceSize    srcOffset = 0;
 
-    auto stagingBuffer = CreateStagingBuffer(stagingCreateInfo, imageData, imageDataSize);
+    VKDeviceBuffer stagingBuffer { device_.GetVkDevice() };
 
-    /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-    auto cmdBuffer = device_.AllocCommandBuffer();
+    std::lock_guard<std::mutex> stagingGuard { device_.GetStagingMutex() };
+
+    auto cmdBuffer = device_.BeginStagingUpload(imageData, imageDataSize, srcBuffer, srcOffset);
+    const bool useStagingPool = (cmdBuffer != VK_NULL_HANDLE);
+
+    if (!useStagingPool)
     {
-        device_.TransitionImageLayout(
-            cmdBuffer,
-            image,
-            textureVK.GetVkFormat(),
-            VK_IMAGE_LAYOUT_UNDEFINED,
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            subresource
+        /* Create temporary staging buffer */
+        VkBufferCreateInfo stagingCreateInfo;
+        BuildVkBufferCreateInfo(
+            stagingCreateInfo,
+            imageDataSize,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT  // <-- TODO: support read/write mapping //GetStagingVkBufferUsageFlags(desc.cpuAccessFlags)
         );
 
+        stagingBuffer   = CreateStagingBuffer(stagingCreateInfo, imageData, imageDataSize);
+        srcBuffer       = stagingBuffer.GetVkBuffer();
+
+        cmdBuffer = device_.AllocCommandBuffer();
+    }
+
+    /* Copy staging buffer into hardware texture */
+    {
+        textureVK.TransitionSubresourceLayouts(cmdBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource);
+
         device_.CopyBufferToImage(
             cmdBuffer,
-            stagingBuffer.GetVkBuffer(),
+            srcBuffer,
             image,
             VkOffset3D{ offset.x, offset.y, offset.z },
             VkExtent3D{ extent.width, extent.height, extent.depth },
             subresource.baseArrayLayer,
             subresource.numArrayLayers,
-            subresource.baseMipLevel
+            subresource.baseMipLevel,
+            srcOffset
         );
+    }
+
+    if (useStagingPool)
+    {
+        /*
+        Register the destination image for the sampling-ready transition,
+        then submit the upload without blocking; the staging ring reclaims its space via fence
+        */
+        device_.RegisterStagingUploadImage(image, subresource);
+        textureVK.SetSubresourceLayouts(subresource, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        device_.EndStagingUpload();
+    }
+    else
+    {
+        /* Transfer image into sampling-ready state */
+        textureVK.TransitionSubresourceLayouts(cmdBuffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, subresource);
+
+        device_.FlushCommandBuffer(cmdBuffer);
+
+        /* Release staging buffer */
+        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    }
+}
 
-        device_.TransitionImageLayout(
+void VKRenderSystem::WriteTextureMulti(Texture& texture, const TextureWriteDescriptor* writeDescs, std::uint32_t numWriteDescs)
+{
+    if (numWriteDescs == 0)
+        return;
+
+    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+
+    const auto& cfg             = GetConfiguration();
+    const auto  format          = VKTypes::Unmap(textureVK.GetVkFormat());
+    const auto& formatAttribs   = GetFormatAttribs(format);
+
+    auto image = textureVK.GetVkImage();
+
+    /* Buffer-to-image copy offsets must be aligned to the texel block size and to 4 bytes */
+    const auto blockSize = std::max<VkDeviceSize>(1u, formatAttribs.bitSize / 8);
+    const auto alignment = (blockSize % 4 == 0 ? blockSize : blockSize * 4);
+
+    /* First pass: determine each region's size and offset within the shared staging allocation */
+    struct RegionRange
+    {
+        VkDeviceSize offset;
+        VkDeviceSize size;
+    };
+    std::vector<RegionRange> regionRanges;
+    regionRanges.reserve(numWriteDescs);
+
+    VkDeviceSize wholeSize = 0;
+
+    for (std::uint32_t i = 0; i < numWriteDescs; ++i)
+    {
+        const auto& extent      = writeDescs[i].textureRegion.extent;
+        const auto  imageSize   = extent.width * extent.height * extent.depth;
+
+        /* Compressed formats must be sized per block-rounded row, uncompressed formats per texel */
+        const auto imageDataSize =
+        (
+            IsCompressedFormat(format)
+                ? static_cast<VkDeviceSize>(CalcSubresourceLayout(format, extent).dataSize)
+                : static_cast<VkDeviceSize>(TextureBufferSize(format, imageSize))
+        );
+
+        /* Round up manually; GetAlignedSize only supports power-of-two alignments */
+        wholeSize = ((wholeSize + alignment - 1) / alignment) * alignment;
+        regionRanges.push_back({ wholeSize, imageDataSize });
+        wholeSize += imageDataSize;
+    }
+
+    /* Second pass: assemble all regions into one buffer, converting the image format where necessary */
+    auto assembledData = MakeUniqueArray<char>(static_cast<std::size_t>(wholeSize));
+
+    for (std::uint32_t i = 0; i < numWriteDescs; ++i)
+    {
+        const auto& imageDesc   = writeDescs[i].imageDesc;
+        const auto& extent      = writeDescs[i].textureRegion.extent;
+        const auto  imageSize   = extent.width * extent.height * extent.depth;
+
+        ByteBuffer  intermediateData;
+        const void* imageData = nullptr;
+
+        if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
+        {
+            /* Convert image format (will be null if no conversion is necessary) */
+            intermediateData = ConvertImageBuffer(imageDesc, formatAttribs.format, formatAttribs.dataType, cfg.threadCount);
+        }
+
+        if (intermediateData)
+        {
+            const auto srcImageDataSize = imageSize * ImageFormatSize(imageDesc.format) * DataTypeSize(imageDesc.dataType);
+            AssertImageDataSize(imageDesc.dataSize, static_cast<std::size_t>(srcImageDataSize));
+            imageData = intermediateData.get();
+        }
+        else
+        {
+            AssertImageDataSize(imageDesc.dataSize, static_cast<std::size_t>(regionRanges[i].size));
+            imageData = imageDesc.data;
+        }
+
+        ::memcpy(assembledData.get() + regionRanges[i].offset, imageData, static_cast<std::size_t>(regionRanges[i].size));
+    }
+
+    /* Copy assembled regions into persistent staging ring, or fall back to a temporary staging buffer for large uploads */
+    VkBuffer        srcBuffer = VK_NULL_HANDLE;
+    VkDeviceSize    srcOffset = 0;
+
+    VKDeviceBuffer stagingBuffer { device_.GetVkDevice() };
+
+    std::lock_guard<std::mutex> stagingGuard { device_.GetStagingMutex() };
+
+    auto cmdBuffer = device_.BeginStagingUpload(assembledData.get(), wholeSize, srcBuffer, srcOffset);
+    const bool useStagingPool = (cmdBuffer != VK_NULL_HANDLE);
+
+    if (!useStagingPool)
+    {
+        /* Create temporary staging buffer */
+        VkBufferCreateInfo stagingCreateInfo;
+        BuildVkBufferCreateInfo(stagingCreateInfo, wholeSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+        stagingBuffer   = CreateStagingBuffer(stagingCreateInfo, assembledData.get(), wholeSize);
+        srcBuffer       = stagingBuffer.GetVkBuffer();
+
+        cmdBuffer = device_.AllocCommandBuffer();
+    }
+
+    /* Gather all destination subresources for batched layout transitions */
+    SmallVector<TextureSubresource, 16> dstSubresources;
+    for (std::uint32_t i = 0; i < numWriteDescs; ++i)
+        dstSubresources.push_back(writeDescs[i].textureRegion.subresource);
+
+    /* Record a single copy-command sequence for all regions; all transitions batch into one barrier */
+    textureVK.TransitionSubresourceLayouts(cmdBuffer, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, dstSubresources.data(), numWriteDescs);
+
+    for (std::uint32_t i = 0; i < numWriteDescs; ++i)
+    {
+        const auto& offset      = writeDescs[i].textureRegion.offset;
+        const auto& extent      = writeDescs[i].textureRegion.extent;
+        const auto& subresource = writeDescs[i].textureRegion.subresource;
+
+        device_.CopyBufferToImage(
             cmdBuffer,
+            srcBuffer,
             image,
-            textureVK.GetVkFormat(),
-            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
-            subresource
+            VkOffset3D{ offset.x, offset.y, offset.z },
+            VkExtent3D{ extent.width, extent.height, extent.depth },
+            subresource.baseArrayLayer,
+            subresource.numArrayLayers,
+            subresource.baseMipLevel,
+            srcOffset + regionRanges[i].offset
         );
     }
-    device_.FlushCommandBuffer(cmdBuffer);
 
-    /* Release staging buffer */
-    stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    if (useStagingPool)
+    {
+        /*
+        Register all destination subresources for the sampling-ready transition,
+        then submit the upload without blocking; the staging ring reclaims its space via fence
+        */
+        for (std::uint32_t i = 0; i < numWriteDescs; ++i)
+        {
+            device_.RegisterStagingUploadImage(image, writeDescs[i].textureRegion.subresource);
+            textureVK.SetSubresourceLayouts(writeDescs[i].textureRegion.subresource, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        }
+        device_.EndStagingUpload();
+    }
+    else
+    {
+        /* Transfer all subresources into sampling-ready state with a single batched barrier */
+        textureVK.TransitionSubresourceLayouts(cmdBuffer, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, dstSubresources.data(), numWriteDescs);
+
+        device_.FlushCommandBuffer(cmdBuffer);
+
+        /* Release staging buffer */
+        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    }
+}
+
+bool VKRenderSystem::IsTextureUploadComplete(Texture& texture)
+{
+    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+
+    /* Check the staging ring batch of the deferred upload (if any) */
+    if (auto token = textureVK.GetUploadBatchToken())
+    {
+        if (!device_.IsStagingUploadComplete(token))
+            return false;
+        textureVK.SetUploadBatchToken(0);
+    }
+
+    /* Check the deferred uploads that were submitted with their own staging buffer */
+    return PollDeferredUploads(&texture, false);
+}
+
+void VKRenderSystem::WaitForTextureUpload(Texture& texture)
+{
+    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+
+    /* Wait for the staging ring batch of the deferred upload (if any) */
+    if (auto token = textureVK.GetUploadBatchToken())
+    {
+        device_.WaitForStagingUpload(token);
+        textureVK.SetUploadBatchToken(0);
+    }
+
+    /* Wait for the deferred uploads that were submitted with their own staging buffer */
+    PollDeferredUploads(&texture, true);
 }
 
 void VKRenderSystem::ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc)
@@ -529,7 +1065,10 @@ Sampler* VKRenderSystem::CreateSampler(const SamplerDescriptor& desc)
 
 void VKRenderSystem::Release(Sampler& sampler)
 {
-    RemoveFromUniqueSet(samplers_, &sampler);
+    /* Detach sampler from container and defer its destruction until the GPU can no longer use it */
+    auto& samplerVK = LLGL_CAST(VKSampler&, sampler);
+    std::lock_guard<std::mutex> destructionGuard { deferredDestructionMutex_ };
+    OpenDeferredDestruction().samplers.push_back(samplers_.extract(&samplerVK));
 }
 
 /* ----- Resource Heaps ----- */
@@ -544,17 +1083,46 @@ void VKRenderSystem::Release(ResourceHeap& resourceHeap)
     RemoveFromUniqueSet(resourceHeaps_, &resourceHeap);
 }
 
+void VKRenderSystem::WriteResourceHeap(
+    ResourceHeap&                   resourceHeap,
+    std::uint32_t                   firstDescriptor,
+    std::uint32_t                   numResourceViews,
+    const ResourceViewDescriptor*   resourceViews)
+{
+    auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
+    resourceHeapVK.WriteResourceViews(firstDescriptor, numResourceViews, resourceViews);
+}
+
 /* ----- Render Passes ----- */
 
 RenderPass* VKRenderSystem::CreateRenderPass(const RenderPassDescriptor& desc)
 {
     AssertCreateRenderPass(desc);
-    return TakeOwnership(renderPasses_, MakeUnique<VKRenderPass>(device_, desc));
+
+    std::lock_guard<std::mutex> guard { renderPassMutex_ };
+
+    /* Check deduplication cache for a compatible render pass first (attachment formats and load/store operations) */
+    std::uint64_t descHash = 0;
+    if (GetConfiguration().pipelineDeduplication)
+    {
+        descHash = HashRenderPassDesc(desc);
+        if (auto sharedRenderPass = renderPassDedupCache_.Find(descHash))
+            return sharedRenderPass;
+    }
+
+    auto renderPass = TakeOwnership(renderPasses_, MakeUnique<VKRenderPass>(device_, desc));
+
+    if (descHash != 0)
+        renderPassDedupCache_.Register(descHash, renderPass);
+
+    return renderPass;
 }
 
 void VKRenderSystem::Release(RenderPass& renderPass)
 {
-    RemoveFromUniqueSet(renderPasses_, &renderPass);
+    std::lock_guard<std::mutex> guard { renderPassMutex_ };
+    if (renderPassDedupCache_.Release(&renderPass))
+        RemoveFromUniqueSet(renderPasses_, &renderPass);
 }
 
 /* ----- Render Targets ----- */
@@ -562,7 +1130,7 @@ void VKRenderSystem::Release(RenderPass& renderPass)
 RenderTarget* VKRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& desc)
 {
     AssertCreateRenderTarget(desc);
-    return TakeOwnership(renderTargets_, MakeUnique<VKRenderTarget>(device_, *deviceMemoryMngr_, desc));
+    return TakeOwnership(renderTargets_, MakeUnique<VKRenderTarget>(device_, *deviceMemoryMngr_, *framebufferCache_, desc));
 }
 
 void VKRenderSystem::Release(RenderTarget& renderTarget)
@@ -578,6 +1146,7 @@ void VKRenderSystem::Release(RenderTarget& renderTarget)
 Shader* VKRenderSystem::CreateShader(const ShaderDescriptor& desc)
 {
     AssertCreateShader(desc);
+    std::lock_guard<std::mutex> guard { shaderMutex_ };
     return TakeOwnership(shaders_, MakeUnique<VKShader>(device_, desc));
 }
 
@@ -589,6 +1158,7 @@ ShaderProgram* VKRenderSystem::CreateShaderProgram(const ShaderProgramDescriptor
 
 void VKRenderSystem::Release(Shader& shader)
 {
+    std::lock_guard<std::mutex> guard { shaderMutex_ };
     RemoveFromUniqueSet(shaders_, &shader);
 }
 
@@ -601,7 +1171,14 @@ void VKRenderSystem::Release(ShaderProgram& shaderProgram)
 
 PipelineLayout* VKRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& desc)
 {
-    return TakeOwnership(pipelineLayouts_, MakeUnique<VKPipelineLayout>(device_, desc));
+    auto pipelineLayoutVK = TakeOwnership(pipelineLayouts_, MakeUnique<VKPipelineLayout>(device_, desc));
+
+    /* Register descriptor demand with all command buffers to size their transient descriptor pools */
+    std::lock_guard<std::mutex> guard { commandBufferMutex_ };
+    for (auto commandBuffer : commandBuffers_)
+        commandBuffer->RegisterTransientLayoutDemand(pipelineLayoutVK->GetDescriptorPoolSizes());
+
+    return pipelineLayoutVK;
 }
 
 void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -613,31 +1190,104 @@ void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 GraphicsPipeline* VKRenderSystem::CreateGraphicsPipeline(const GraphicsPipelineDescriptor& desc)
 {
-    return TakeOwnership(
+    std::lock_guard<std::mutex> guard { pipelineMutex_ };
+
+    /* Check deduplication cache for a pipeline with an identical descriptor first */
+    std::uint64_t descHash = 0;
+    if (GetConfiguration().pipelineDeduplication)
+    {
+        descHash = HashGraphicsPipelineDesc(desc);
+        if (auto sharedPipeline = graphicsPipelineDedupCache_.Find(descHash))
+            return sharedPipeline;
+    }
+
+    auto pipeline = TakeOwnership(
         graphicsPipelines_,
         MakeUnique<VKGraphicsPipeline>(
             device_,
             defaultPipelineLayout_,
+            pipelineCache_,
             (!renderContexts_.empty() ? (*renderContexts_.begin())->GetRenderPass() : nullptr),
             desc,
             gfxPipelineLimits_
         )
     );
+
+    if (descHash != 0)
+        graphicsPipelineDedupCache_.Register(descHash, pipeline);
+
+    return pipeline;
 }
 
 ComputePipeline* VKRenderSystem::CreateComputePipeline(const ComputePipelineDescriptor& desc)
 {
-    return TakeOwnership(computePipelines_, MakeUnique<VKComputePipeline>(device_, desc, defaultPipelineLayout_));
+    std::lock_guard<std::mutex> guard { pipelineMutex_ };
+
+    std::uint64_t descHash = 0;
+    if (GetConfiguration().pipelineDeduplication)
+    {
+        descHash = HashComputePipelineDesc(desc);
+        if (auto sharedPipeline = computePipelineDedupCache_.Find(descHash))
+            return sharedPipeline;
+    }
+
+    auto pipeline = TakeOwnership(computePipelines_, MakeUnique<VKComputePipeline>(device_, desc, defaultPipelineLayout_, pipelineCache_));
+
+    if (descHash != 0)
+        computePipelineDedupCache_.Register(descHash, pipeline);
+
+    return pipeline;
 }
 
 void VKRenderSystem::Release(GraphicsPipeline& graphicsPipeline)
 {
-    RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
+    std::lock_guard<std::mutex> guard { pipelineMutex_ };
+    if (graphicsPipelineDedupCache_.Release(&graphicsPipeline))
+        RemoveFromUniqueSet(graphicsPipelines_, &graphicsPipeline);
 }
 
 void VKRenderSystem::Release(ComputePipeline& computePipeline)
 {
-    RemoveFromUniqueSet(computePipelines_, &computePipeline);
+    std::lock_guard<std::mutex> guard { pipelineMutex_ };
+    if (computePipelineDedupCache_.Release(&computePipeline))
+        RemoveFromUniqueSet(computePipelines_, &computePipeline);
+}
+
+std::vector<std::uint8_t> VKRenderSystem::GetPipelineCacheData() const
+{
+    /* Query size of cache data, then fill output container */
+    std::size_t dataSize = 0;
+    auto result = vkGetPipelineCacheData(device_, pipelineCache_, &dataSize, nullptr);
+    VKThrowIfFailed(result, "failed to query size of Vulkan pipeline cache data");
+
+    std::vector<std::uint8_t> data(dataSize);
+    if (dataSize > 0)
+    {
+        result = vkGetPipelineCacheData(device_, pipelineCache_, &dataSize, data.data());
+        VKThrowIfFailed(result, "failed to retrieve Vulkan pipeline cache data");
+    }
+
+    return data;
+}
+
+bool VKRenderSystem::SetPipelineCacheData(const void* data, std::size_t dataSize)
+{
+    if (data == nullptr || dataSize == 0)
+        return false;
+
+    /* Re-create pipeline cache with initial data; the driver validates the blob header and ignores incompatible data */
+    CreatePipelineCache(data, dataSize);
+    return true;
+}
+
+bool VKRenderSystem::SupportsConcurrentPipelineCreation() const
+{
+    return true;
+}
+
+bool VKRenderSystem::SupportsConcurrentShaderCompilation() const
+{
+    return true;
 }
 
 /* ----- Queries ----- */
@@ -806,11 +1456,16 @@ void VKRenderSystem::CreateDebugReportCallback()
     VKThrowIfFailed(result, "failed to create Vulkan debug report callback");
 }
 
-void VKRenderSystem::PickPhysicalDevice()
+void VKRenderSystem::PickPhysicalDevice(const RenderSystemDescriptor& renderSystemDesc)
 {
     /* Pick physical device with Vulkan support */
-    if (!physicalDevice_.PickPhysicalDevice(instance_))
-        throw std::runtime_error("failed to find physical device with Vulkan support");
+    if (!physicalDevice_.PickPhysicalDevice(instance_, renderSystemDesc))
+    {
+        if (renderSystemDesc.preferredAdapterVendorID != 0 || renderSystemDesc.preferredAdapterDeviceID != 0)
+            throw std::runtime_error("failed to find physical device with Vulkan support that matches the preferred adapter IDs");
+        else
+            throw std::runtime_error("failed to find physical device with Vulkan support");
+    }
 
     /* Query and store rendering capabilities */
     RendererInfo info;
@@ -830,8 +1485,18 @@ void VKRenderSystem::CreateLogicalDevice()
     /* Create command queue interface */
     commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue());
 
+    /* Create async compute queue interface if the device has a dedicated compute queue family */
+    if (device_.HasDedicatedComputeQueue())
+        computeCommandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkComputeQueue());
+
     /* Load Vulkan device extensions */
     VKLoadDeviceExtensions(device_, physicalDevice_.GetSupportedExtensionNames());
+
+    /* Create persistent staging buffer pool for data uploads */
+    device_.CreateStagingPool(physicalDevice_.GetMemoryProperties());
+
+    /* Initialize compute MIP-map generator; if unsupported, textures keep the blit-based downsampler */
+    VKMipGenerator::Get().InitializeDevice(device_.GetVkDevice(), physicalDevice_);
 }
 
 void VKRenderSystem::CreateDefaultPipelineLayout()
@@ -844,6 +1509,18 @@ void VKRenderSystem::CreateDefaultPipelineLayout()
     VKThrowIfFailed(result, "failed to create Vulkan default pipeline layout");
 }
 
+void VKRenderSystem::CreatePipelineCache(const void* initialData, std::size_t initialDataSize)
+{
+    VkPipelineCacheCreateInfo cacheCreateInfo = {};
+    {
+        cacheCreateInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        cacheCreateInfo.initialDataSize = initialDataSize;
+        cacheCreateInfo.pInitialData    = initialData;
+    }
+    auto result = vkCreatePipelineCache(device_, &cacheCreateInfo, nullptr, pipelineCache_.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan pipeline cache");
+}
+
 bool VKRenderSystem::IsLayerRequired(const char* name, const RendererConfigurationVulkan* config) const
 {
     if (config != nullptr)
@@ -866,19 +1543,58 @@ bool VKRenderSystem::IsLayerRequired(const char* name, const RendererConfigurati
 
 bool VKRenderSystem::IsExtensionRequired(const std::string& name) const
 {
-    return
-    (
-        name == VK_KHR_SURFACE_EXTENSION_NAME
+    /* Surface extensions are only required when the render system can present, i.e. not in headless mode */
+    if (!headless_)
+    {
+        if (name == VK_KHR_SURFACE_EXTENSION_NAME)
+            return true;
         #ifdef LLGL_OS_WIN32
-        || name == VK_KHR_WIN32_SURFACE_EXTENSION_NAME
+        if (name == VK_KHR_WIN32_SURFACE_EXTENSION_NAME)
+            return true;
         #endif
         #ifdef LLGL_OS_LINUX
-        || name == VK_KHR_XLIB_SURFACE_EXTENSION_NAME
+        if (name == VK_KHR_XLIB_SURFACE_EXTENSION_NAME)
+            return true;
         #endif
+    }
+
+    return
+    (
+        name == VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME
         || (debugLayerEnabled_ && name == VK_EXT_DEBUG_REPORT_EXTENSION_NAME)
     );
 }
 
+// Percentage of the heap budget at which the video memory pressure callback is invoked
+static const std::uint64_t g_memoryPressureThresholdPercent = 90;
+
+void VKRenderSystem::NotifyVideoMemoryPressure()
+{
+    const auto& callback = GetVideoMemoryPressureCallback();
+    if (!callback)
+        return;
+
+    auto budgets = physicalDevice_.QueryMemoryBudgets();
+    memoryPressureSignaled_.resize(budgets.size(), false);
+
+    for (std::size_t i = 0; i < budgets.size(); ++i)
+    {
+        const auto& budget = budgets[i];
+
+        if (budget.budget > 0 && budget.usage * 100 >= budget.budget * g_memoryPressureThresholdPercent)
+        {
+            /* Only signal this heap again after its usage has dropped below the threshold in the meantime */
+            if (!memoryPressureSignaled_[i])
+            {
+                memoryPressureSignaled_[i] = true;
+                callback(static_cast<std::uint32_t>(i), budget);
+            }
+        }
+        else
+            memoryPressureSignaled_[i] = false;
+    }
+}
+
 VKDeviceBuffer VKRenderSystem::CreateStagingBuffer(const VkBufferCreateInfo& createInfo)
 {
     return VKDeviceBuffer
@@ -905,6 +1621,196 @@ VKDeviceBuffer VKRenderSystem::CreateStagingBuffer(
     return stagingBuffer;
 }
 
+void VKRenderSystem::SubmitDeferredUpload(const Texture* texture, VkCommandBuffer cmdBuffer, VKDeviceBuffer&& stagingBuffer)
+{
+    /* End command buffer record */
+    auto result = vkEndCommandBuffer(cmdBuffer);
+    VKThrowIfFailed(result, "failed to end recording Vulkan command buffer");
+
+    /* Track upload with a fence and keep the staging buffer alive until it is signaled */
+    std::lock_guard<std::mutex> uploadGuard { deferredUploadMutex_ };
+    deferredUploads_.emplace_back(device_.GetVkDevice(), std::move(stagingBuffer));
+
+    auto& upload = deferredUploads_.back();
+    {
+        upload.texture       = texture;
+        upload.commandBuffer = cmdBuffer;
+    }
+
+    VkFenceCreateInfo fenceCreateInfo;
+    {
+        fenceCreateInfo.sType   = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fenceCreateInfo.pNext   = nullptr;
+        fenceCreateInfo.flags   = 0;
+    }
+    result = vkCreateFence(device_.GetVkDevice(), &fenceCreateInfo, nullptr, upload.fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence for deferred texture upload");
+
+    /* Submit command buffer to graphics queue without waiting for its completion */
+    VkSubmitInfo submitInfo = {};
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount   = 1;
+        submitInfo.pCommandBuffers      = (&cmdBuffer);
+    }
+    {
+        std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(device_.GetVkQueue()) };
+        result = vkQueueSubmit(device_.GetVkQueue(), 1, &submitInfo, upload.fence);
+    }
+    VKThrowIfFailed(result, "failed to submit deferred texture upload to graphics queue");
+}
+
+bool VKRenderSystem::PollDeferredUploads(const Texture* texture, bool wait)
+{
+    bool complete = true;
+
+    /* Lock order staging -> upload list must match SubmitDeferredUpload, where the caller already holds the staging mutex */
+    std::lock_guard<std::mutex> stagingGuard { device_.GetStagingMutex() };
+    std::lock_guard<std::mutex> uploadGuard { deferredUploadMutex_ };
+
+    for (auto it = deferredUploads_.begin(); it != deferredUploads_.end();)
+    {
+        bool signaled = (vkGetFenceStatus(device_.GetVkDevice(), it->fence) == VK_SUCCESS);
+
+        if (!signaled && wait && it->texture == texture)
+        {
+            /* Block until the upload of the specified texture has completed */
+            VkFence fence = it->fence;
+            auto result = vkWaitForFences(device_.GetVkDevice(), 1, &fence, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+            VKThrowIfFailed(result, "failed to wait for Vulkan fence of deferred texture upload");
+            signaled = true;
+        }
+
+        if (signaled)
+        {
+            /* Reclaim staging buffer and command buffer of the completed upload */
+            it->stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+            device_.FreeCommandBuffer(it->commandBuffer);
+            it = deferredUploads_.erase(it);
+        }
+        else
+        {
+            if (it->texture == texture)
+                complete = false;
+            ++it;
+        }
+    }
+
+    return complete;
+}
+
+void VKRenderSystem::FlushDeferredDestructions()
+{
+    std::lock_guard<std::mutex> destructionGuard { deferredDestructionMutex_ };
+
+    if (!deferredDestructions_.empty())
+    {
+        auto& destruction = deferredDestructions_.back();
+        if (!destruction.fenceSubmitted)
+        {
+            /* Create fence for the open bucket */
+            VkFenceCreateInfo fenceCreateInfo;
+            {
+                fenceCreateInfo.sType   = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+                fenceCreateInfo.pNext   = nullptr;
+                fenceCreateInfo.flags   = 0;
+            }
+            auto result = vkCreateFence(device_.GetVkDevice(), &fenceCreateInfo, nullptr, destruction.fence.ReleaseAndGetAddressOf());
+            VKThrowIfFailed(result, "failed to create Vulkan fence for deferred destruction");
+
+            /*
+            Submit the fence without any workload to the graphics queue;
+            it retires once all previously submitted work has completed,
+            which includes the last possible GPU use of the bucket's objects
+            */
+            {
+                std::lock_guard<std::mutex> queueGuard { VKGetQueueMutex(device_.GetVkQueue()) };
+                result = vkQueueSubmit(device_.GetVkQueue(), 0, nullptr, destruction.fence);
+            }
+            VKThrowIfFailed(result, "failed to submit deferred destruction fence to graphics queue");
+
+            destruction.fenceSubmitted = true;
+        }
+    }
+}
+
+void VKRenderSystem::PollDeferredDestructions(bool wait)
+{
+    std::lock_guard<std::mutex> destructionGuard { deferredDestructionMutex_ };
+
+    for (auto it = deferredDestructions_.begin(); it != deferredDestructions_.end();)
+    {
+        if (it->fenceSubmitted)
+        {
+            bool signaled = (vkGetFenceStatus(device_.GetVkDevice(), it->fence) == VK_SUCCESS);
+
+            if (!signaled && wait)
+            {
+                /* Block until all GPU work that could still use the bucket's objects has completed */
+                VkFence fence = it->fence;
+                auto result = vkWaitForFences(device_.GetVkDevice(), 1, &fence, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+                VKThrowIfFailed(result, "failed to wait for Vulkan fence of deferred destruction");
+                signaled = true;
+            }
+
+            if (signaled)
+            {
+                DestroyDeferredObjects(*it);
+                it = deferredDestructions_.erase(it);
+                continue;
+            }
+        }
+        else if (wait)
+        {
+            /* Waiting is only requested after the device became idle, so unsubmitted buckets can be destroyed as well */
+            DestroyDeferredObjects(*it);
+            it = deferredDestructions_.erase(it);
+            continue;
+        }
+        ++it;
+    }
+}
+
+VKRenderSystem::VKDeferredDestruction& VKRenderSystem::OpenDeferredDestruction()
+{
+    if (deferredDestructions_.empty() || deferredDestructions_.back().fenceSubmitted)
+        deferredDestructions_.emplace_back(device_.GetVkDevice());
+    return deferredDestructions_.back();
+}
+
+void VKRenderSystem::DestroyDeferredObjects(VKDeferredDestruction& destruction)
+{
+    /* Release device memory regions for primary buffers and internal staging buffers */
+    for (auto& bufferVK : destruction.buffers)
+    {
+        /* Unmap persistently mapped memory */
+        if (bufferVK->GetPersistentMappedMemory() != nullptr)
+        {
+            if (auto region = bufferVK->GetDeviceBuffer().GetMemoryRegion())
+                region->GetParentChunk()->Unmap(device_);
+        }
+
+        /* Release suballocated range back to the shared buffer pool */
+        if (bufferVK->IsSuballocation())
+            sharedBufferPool_->Release(bufferVK->GetVkBuffer());
+
+        bufferVK->GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
+        bufferVK->GetStagingDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
+    }
+
+    /* Release device memory regions for textures */
+    for (auto& textureVK : destruction.textures)
+    {
+        deviceMemoryMngr_->Release(textureVK->GetMemoryRegion());
+        textureVK->ReleaseSparseMemoryRegions(*deviceMemoryMngr_);
+    }
+
+    /* Destroy the detached objects themselves */
+    destruction.buffers.clear();
+    destruction.textures.clear();
+    destruction.samplers.clear();
+}
+
 
 } // /namespace LLGL
 
@@ -21,6 +21,7 @@
 
 #include "Buffer/VKBuffer.h"
 #include "Buffer/VKBufferArray.h"
+#include "Buffer/VKSharedBufferPool.h"
 
 #include "Shader/VKShader.h"
 #include "Shader/VKShaderProgram.h"
@@ -36,12 +37,15 @@
 #include "RenderState/VKGraphicsPipeline.h"
 #include "RenderState/VKComputePipeline.h"
 #include "RenderState/VKResourceHeap.h"
+#include "RenderState/VKFramebufferCache.h"
 
 #include <string>
 #include <memory>
 #include <vector>
+#include <list>
 #include <set>
 #include <tuple>
+#include <mutex>
 
 
 namespace LLGL
@@ -58,6 +62,10 @@ class VKRenderSystem final : public RenderSystem
         VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~VKRenderSystem();
 
+        std::vector<VideoAdapterDescriptor> QueryVideoAdapters() const override;
+        std::vector<VideoMemoryBudget> QueryVideoMemoryBudgets() const override;
+        std::vector<DeviceMemoryStats> QueryDeviceMemoryStats() const override;
+
         /* ----- Render Context ----- */
 
         RenderContext* CreateRenderContext(const RenderContextDescriptor& desc, const std::shared_ptr<Surface>& surface = nullptr) override;
@@ -67,6 +75,10 @@ class VKRenderSystem final : public RenderSystem
         /* ----- Command queues ----- */
 
         CommandQueue* GetCommandQueue() override;
+        CommandQueue* GetComputeCommandQueue() override;
+
+        std::uint32_t GetNumCommandQueues(const CommandQueueType queueType) override;
+        CommandQueue* GetCommandQueue(const CommandQueueType queueType, std::uint32_t index = 0) override;
 
         /* ----- Command buffers ----- */
 
@@ -87,13 +99,20 @@ class VKRenderSystem final : public RenderSystem
         void* MapBuffer(Buffer& buffer, const CPUAccess access) override;
         void UnmapBuffer(Buffer& buffer) override;
 
+        void* GetMappedBufferMemory(Buffer& buffer) override;
+        void FlushMappedBufferRange(Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
         /* ----- Textures ----- */
 
         Texture* CreateTexture(const TextureDescriptor& textureDesc, const SrcImageDescriptor* imageDesc = nullptr) override;
+        Texture* CreateTextureView(Texture& sharedTexture, const TextureViewDescriptor& textureViewDesc) override;
 
         void Release(Texture& texture) override;
 
         void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const SrcImageDescriptor& imageDesc) override;
+        void WriteTextureMulti(Texture& texture, const TextureWriteDescriptor* writeDescs, std::uint32_t numWriteDescs) override;
+        bool IsTextureUploadComplete(Texture& texture) override;
+        void WaitForTextureUpload(Texture& texture) override;
         void ReadTexture(const Texture& texture, std::uint32_t mipLevel, const DstImageDescriptor& imageDesc) override;
 
         /* ----- Sampler States ---- */
@@ -108,6 +127,8 @@ class VKRenderSystem final : public RenderSystem
 
         void Release(ResourceHeap& resourceHeap) override;
 
+        void WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, std::uint32_t numResourceViews, const ResourceViewDescriptor* resourceViews) override;
+
         /* ----- Render Passes ----- */
 
         RenderPass* CreateRenderPass(const RenderPassDescriptor& desc) override;
@@ -142,6 +163,9 @@ class VKRenderSystem final : public RenderSystem
         void Release(GraphicsPipeline& graphicsPipeline) override;
         void Release(ComputePipeline& computePipeline) override;
 
+        std::vector<std::uint8_t> GetPipelineCacheData() const override;
+        bool SetPipelineCacheData(const void* data, std::size_t dataSize) override;
+
         /* ----- Queries ----- */
 
         QueryHeap* CreateQueryHeap(const QueryHeapDescriptor& desc) override;
@@ -154,17 +178,31 @@ class VKRenderSystem final : public RenderSystem
 
         void Release(Fence& fence) override;
 
+    protected:
+
+        //! Vulkan pipelines can be created concurrently; see 'pipelineMutex_'.
+        bool SupportsConcurrentPipelineCreation() const override;
+
+        //! Vulkan shader modules can be created concurrently; see 'shaderMutex_'.
+        bool SupportsConcurrentShaderCompilation() const override;
+
     private:
 
+        struct VKDeferredDestruction;
+
         void CreateInstance(const RendererConfigurationVulkan* config);
         void CreateDebugReportCallback();
-        void PickPhysicalDevice();
+        void PickPhysicalDevice(const RenderSystemDescriptor& renderSystemDesc);
         void CreateLogicalDevice();
         void CreateDefaultPipelineLayout();
+        void CreatePipelineCache(const void* initialData = nullptr, std::size_t initialDataSize = 0);
 
         bool IsLayerRequired(const char* name, const RendererConfigurationVulkan* config) const;
         bool IsExtensionRequired(const std::string& name) const;
 
+        //! Invokes the video memory pressure callback for all heaps whose usage approaches the budget.
+        void NotifyVideoMemoryPressure();
+
         VKDeviceBuffer CreateStagingBuffer(const VkBufferCreateInfo& createInfo);
 
         VKDeviceBuffer CreateStagingBuffer(
@@ -173,8 +211,73 @@ class VKRenderSystem final : public RenderSystem
             VkDeviceSize                dataSize
         );
 
+        /*
+        Submits the recorded command buffer of a deferred texture upload with a fence,
+        and keeps its staging buffer alive until the fence is signaled (see MiscFlags::DeferredUpload).
+        */
+        void SubmitDeferredUpload(const Texture* texture, VkCommandBuffer cmdBuffer, VKDeviceBuffer&& stagingBuffer);
+
+        /*
+        Reclaims the resources of all completed deferred uploads; if 'wait' is enabled, blocks on the uploads of the specified texture.
+        Returns true if no deferred upload for the specified texture remains pending.
+        */
+        bool PollDeferredUploads(const Texture* texture, bool wait);
+
+        /*
+        Submits the fence of the open deferred-destruction bucket to the graphics queue,
+        so its objects are destroyed once all previously submitted work has completed (see VKDeferredDestruction).
+        */
+        void FlushDeferredDestructions();
+
+        /*
+        Destroys the objects of all deferred-destruction buckets whose fence is signaled;
+        if 'wait' is enabled, blocks on the pending fences and also destroys unsubmitted buckets,
+        which is only allowed after the device became idle (see ~VKRenderSystem).
+        */
+        void PollDeferredDestructions(bool wait);
+
+        //! Returns the open deferred-destruction bucket, or appends a new one; 'deferredDestructionMutex_' must be held by the caller.
+        VKDeferredDestruction& OpenDeferredDestruction();
+
+        //! Releases the device memory of all objects in the specified bucket and destroys them.
+        void DestroyDeferredObjects(VKDeferredDestruction& destruction);
+
     private:
 
+        // Deferred texture upload whose staging buffer is released when its fence is signaled.
+        struct VKDeferredUpload
+        {
+            const Texture*  texture         = nullptr;
+            VkCommandBuffer commandBuffer   = VK_NULL_HANDLE;
+            VKPtr<VkFence>  fence;
+            VKDeviceBuffer  stagingBuffer;
+
+            VKDeferredUpload(const VKPtr<VkDevice>& device, VKDeviceBuffer&& stagingBuffer) :
+                fence         { device, vkDestroyFence     },
+                stagingBuffer { std::move(stagingBuffer)   }
+            {
+            }
+        };
+
+        /*
+        Bucket of released objects whose destruction is deferred until its fence is signaled.
+        Objects are appended while the bucket is open; once the fence is submitted to the graphics queue,
+        its retirement proves that all GPU work that could still use the objects has completed.
+        */
+        struct VKDeferredDestruction
+        {
+            VKPtr<VkFence>                          fence;
+            bool                                    fenceSubmitted  = false;
+            std::vector<std::unique_ptr<VKBuffer>>  buffers;
+            std::vector<std::unique_ptr<VKTexture>> textures;
+            std::vector<std::unique_ptr<VKSampler>> samplers;
+
+            VKDeferredDestruction(const VKPtr<VkDevice>& device) :
+                fence { device, vkDestroyFence }
+            {
+            }
+        };
+
         /* ----- Common objects ----- */
 
         VKPtr<VkInstance>                       instance_;
@@ -184,32 +287,51 @@ class VKRenderSystem final : public RenderSystem
 
         VKPtr<VkDebugReportCallbackEXT>         debugReportCallback_;
         VKPtr<VkPipelineLayout>                 defaultPipelineLayout_;
+        VKPtr<VkPipelineCache>                  pipelineCache_;
 
         bool                                    debugLayerEnabled_      = false;
+        bool                                    headless_               = false;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
+        std::unique_ptr<VKSharedBufferPool>     sharedBufferPool_;
+        std::unique_ptr<VKFramebufferCache>     framebufferCache_;
+        std::vector<bool>                       memoryPressureSignaled_;
+
+        std::list<VKDeferredUpload>             deferredUploads_;
+        std::mutex                              deferredUploadMutex_;
+
+        std::list<VKDeferredDestruction>        deferredDestructions_;
+        std::mutex                              deferredDestructionMutex_;
 
         VKGraphicsPipelineLimits                gfxPipelineLimits_;
 
         /* ----- Hardware object containers ----- */
 
-        HWObjectContainer<VKRenderContext>      renderContexts_;
-        HWObjectInstance<VKCommandQueue>        commandQueue_;
-        HWObjectContainer<VKCommandBuffer>      commandBuffers_;
-        HWObjectContainer<VKBuffer>             buffers_;
-        HWObjectContainer<VKBufferArray>        bufferArrays_;
-        HWObjectContainer<VKTexture>            textures_;
-        HWObjectContainer<VKSampler>            samplers_;
-        HWObjectContainer<VKRenderPass>         renderPasses_;
-        HWObjectContainer<VKRenderTarget>       renderTargets_;
-        HWObjectContainer<VKShader>             shaders_;
-        HWObjectContainer<VKShaderProgram>      shaderPrograms_;
-        HWObjectContainer<VKPipelineLayout>     pipelineLayouts_;
-        HWObjectContainer<VKGraphicsPipeline>   graphicsPipelines_;
-        HWObjectContainer<VKComputePipeline>    computePipelines_;
-        HWObjectContainer<VKResourceHeap>       resourceHeaps_;
-        HWObjectContainer<VKQueryHeap>          queryHeaps_;
-        HWObjectContainer<VKFence>              fences_;
+        HWObjectContainer<VKRenderContext>          renderContexts_;
+        HWObjectInstance<VKCommandQueue>            commandQueue_;
+        HWObjectInstance<VKCommandQueue>            computeCommandQueue_;
+        HWObjectContainer<VKCommandBuffer>          commandBuffers_;
+        std::mutex                                  commandBufferMutex_;
+        HWObjectContainerConcurrent<VKBuffer>       buffers_;
+        HWObjectContainerConcurrent<VKBufferArray>  bufferArrays_;
+        HWObjectContainerConcurrent<VKTexture>      textures_;
+        HWObjectContainerConcurrent<VKSampler>      samplers_;
+        HWObjectContainer<VKRenderPass>             renderPasses_;
+        HWObjectDedupCache<RenderPass>              renderPassDedupCache_;
+        std::mutex                                  renderPassMutex_;
+        HWObjectContainer<VKRenderTarget>           renderTargets_;
+        HWObjectContainer<VKShader>                 shaders_;
+        std::mutex                                  shaderMutex_;
+        HWObjectContainer<VKShaderProgram>          shaderPrograms_;
+        HWObjectContainer<VKPipelineLayout>         pipelineLayouts_;
+        HWObjectContainer<VKGraphicsPipeline>       graphicsPipelines_;
+        HWObjectContainer<VKComputePipeline>        computePipelines_;
+        HWObjectDedupCache<GraphicsPipeline>        graphicsPipelineDedupCache_;
+        HWObjectDedupCache<ComputePipeline>         computePipelineDedupCache_;
+        std::mutex                                  pipelineMutex_;
+        HWObjectContainer<VKResourceHeap>           resourceHeaps_;
+        HWObjectContainer<VKQueryHeap>              queryHeaps_;
+        HWObjectContainer<VKFence>                  fences_;
 
 };
 
@@ -35,6 +35,10 @@ VkShaderStageFlagBits Map(const ShaderType shaderType)
         case ShaderType::Geometry:          return VK_SHADER_STAGE_GEOMETRY_BIT;
         case ShaderType::Fragment:          return VK_SHADER_STAGE_FRAGMENT_BIT;
         case ShaderType::Compute:           return VK_SHADER_STAGE_COMPUTE_BIT;
+        #ifdef VK_NV_mesh_shader
+        case ShaderType::Task:              return VK_SHADER_STAGE_TASK_BIT_NV;
+        case ShaderType::Mesh:              return VK_SHADER_STAGE_MESH_BIT_NV;
+        #endif
     }
     MapFailed("ShaderType", "VkShaderStageFlagBits");
 }
@@ -152,6 +156,8 @@ VkFormat Map(const Format format)
         case Format::BC4SNorm:          return VK_FORMAT_BC4_SNORM_BLOCK;
         case Format::BC5UNorm:          return VK_FORMAT_BC5_UNORM_BLOCK;
         case Format::BC5SNorm:          return VK_FORMAT_BC5_SNORM_BLOCK;
+        case Format::BC7UNorm:          return VK_FORMAT_BC7_UNORM_BLOCK;
+        case Format::BC7UNorm_sRGB:     return VK_FORMAT_BC7_SRGB_BLOCK;
     }
     MapFailed("Format", "VkFormat");
 }
@@ -362,6 +368,20 @@ VkAttachmentStoreOp Map(const AttachmentStoreOp storeOp)
     MapFailed("AttachmentStoreOp", "VkAttachmentStoreOp");
 }
 
+VkComponentSwizzle Map(const TextureSwizzle textureSwizzle)
+{
+    switch (textureSwizzle)
+    {
+        case TextureSwizzle::Zero:  return VK_COMPONENT_SWIZZLE_ZERO;
+        case TextureSwizzle::One:   return VK_COMPONENT_SWIZZLE_ONE;
+        case TextureSwizzle::Red:   return VK_COMPONENT_SWIZZLE_R;
+        case TextureSwizzle::Green: return VK_COMPONENT_SWIZZLE_G;
+        case TextureSwizzle::Blue:  return VK_COMPONENT_SWIZZLE_B;
+        case TextureSwizzle::Alpha: return VK_COMPONENT_SWIZZLE_A;
+    }
+    MapFailed("TextureSwizzle", "VkComponentSwizzle");
+}
+
 VkIndexType ToVkIndexType(const Format format)
 {
     switch (format)
@@ -482,6 +502,8 @@ Format Unmap(const VkFormat format)
         case VK_FORMAT_BC4_SNORM_BLOCK:             return Format::BC4SNorm;
         case VK_FORMAT_BC5_UNORM_BLOCK:             return Format::BC5UNorm;
         case VK_FORMAT_BC5_SNORM_BLOCK:             return Format::BC5SNorm;
+        case VK_FORMAT_BC7_UNORM_BLOCK:             return Format::BC7UNorm;
+        case VK_FORMAT_BC7_SRGB_BLOCK:              return Format::BC7UNorm_sRGB;
 
         default:                                    return Format::Undefined;
     }
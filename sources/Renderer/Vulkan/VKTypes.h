@@ -47,6 +47,7 @@ VkSamplerAddressMode    Map( const SamplerAddressMode   addressMode       );
 VkQueryType             Map( const QueryType            queryType         );
 VkAttachmentLoadOp      Map( const AttachmentLoadOp     loadOp            );
 VkAttachmentStoreOp     Map( const AttachmentStoreOp    storeOp           );
+VkComponentSwizzle      Map( const TextureSwizzle       textureSwizzle    );
 
 VkIndexType             ToVkIndexType(const Format format);
 
@@ -0,0 +1,538 @@
+/*
+ * Test_Allocations.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+
+/* ----- Global allocation hooks ----- */
+
+static std::atomic<std::uint64_t>   g_allocCount    { 0 };
+static std::atomic<bool>            g_allocCounting { false };
+
+void* operator new(std::size_t size)
+{
+    if (g_allocCounting.load(std::memory_order_relaxed))
+        g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    if (auto ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc {};
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+
+/* ----- Test harness ----- */
+
+struct TestConfig
+{
+    std::string     rendererModule  = "OpenGL";
+    std::uint32_t   numCalls        = 1000;     // number of API calls per scenario
+    bool            enforce         = true;     // return failure exit code on regression
+};
+
+// Result of a single audit scenario: heap allocations per API call against the regression threshold.
+struct AuditResult
+{
+    std::string     name;
+    std::uint32_t   calls               = 0;
+    std::uint64_t   allocations         = 0;
+    double          maxAllocsPerCall    = 0.0;
+
+    inline double AllocsPerCall() const
+    {
+        return (calls > 0 ? static_cast<double>(allocations) / static_cast<double>(calls) : 0.0);
+    }
+
+    inline bool Failed() const
+    {
+        return (AllocsPerCall() > maxAllocsPerCall);
+    }
+};
+
+class AllocationTest
+{
+
+    private:
+
+        std::unique_ptr<LLGL::RenderSystem> renderer;
+        LLGL::RenderContext*                context             = nullptr;
+        LLGL::CommandQueue*                 commandQueue        = nullptr;
+        LLGL::CommandBuffer*                commands            = nullptr;
+
+        LLGL::ShaderProgram*                shaderProgram       = nullptr;
+        LLGL::PipelineLayout*               pipelineLayout      = nullptr;
+        LLGL::GraphicsPipeline*             pipeline            = nullptr;
+        LLGL::Buffer*                       vertexBuffer        = nullptr;
+        LLGL::Buffer*                       constantBuffer      = nullptr;
+        LLGL::Buffer*                       updateBuffer        = nullptr;
+        LLGL::ResourceHeap*                 resourceHeaps[2]    = {};
+
+        LLGL::VertexFormat                  vertexFormat;
+
+        TestConfig                          config;
+        std::vector<AuditResult>            results;
+
+    private:
+
+        static const std::uint16_t          updateChunkSize = 256;  // bytes per buffer update call
+
+        /* ----- Measurement ----- */
+
+        /*
+        Counts the heap allocations of the second invocation of the specified command encoding.
+        The first invocation is a warm-up pass, so one-time costs (e.g. lazily created
+        internal containers) are excluded and only the steady-state cost is measured.
+        */
+        void RunScenario(
+            const std::string&              name,
+            double                          maxAllocsPerCall,
+            const std::function<void()>&    encodeCommands)
+        {
+            std::cout << "run scenario: " << name << " ..." << std::endl;
+
+            auto MeasurePass = [this, &encodeCommands](bool count)
+            {
+                commands->Begin();
+                commands->BeginRenderPass(*context);
+                {
+                    commands->SetViewport(LLGL::Viewport { { 0, 0 }, context->GetResolution() });
+                    if (pipeline != nullptr)
+                        commands->SetGraphicsPipeline(*pipeline);
+
+                    g_allocCount.store(0);
+                    g_allocCounting.store(count);
+                    {
+                        encodeCommands();
+                    }
+                    g_allocCounting.store(false);
+                }
+                commands->EndRenderPass();
+                commands->End();
+                commandQueue->Submit(*commands);
+                commandQueue->WaitIdle();
+            };
+
+            // Warm-up pass, then measured pass
+            MeasurePass(false);
+            MeasurePass(true);
+
+            AuditResult result;
+            {
+                result.name             = name;
+                result.calls            = config.numCalls;
+                result.allocations      = g_allocCount.load();
+                result.maxAllocsPerCall = maxAllocsPerCall;
+            }
+            results.push_back(std::move(result));
+        }
+
+        /* ----- Resources ----- */
+
+        void CreateShadersAndPipelines()
+        {
+            // Create vertex buffer with a single triangle
+            vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+            const float vertices[] =
+            {
+                 0.0f,  0.5f,
+                 0.5f, -0.5f,
+                -0.5f, -0.5f,
+            };
+
+            LLGL::BufferDescriptor vertexBufferDesc;
+            {
+                vertexBufferDesc.size           = sizeof(vertices);
+                vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+                vertexBufferDesc.vertexAttribs  = vertexFormat.attributes;
+            }
+            vertexBuffer = renderer->CreateBuffer(vertexBufferDesc, vertices);
+
+            // Create minimal vertex and fragment shaders
+            auto vertShaderSource =
+            (
+                "#version 140\n"
+                "in vec2 position;\n"
+                "void main() {\n"
+                "    gl_Position = vec4(position, 0.0, 1.0);\n"
+                "}\n"
+            );
+
+            LLGL::ShaderDescriptor vertShaderDesc;
+            {
+                vertShaderDesc.type                 = LLGL::ShaderType::Vertex;
+                vertShaderDesc.source               = vertShaderSource;
+                vertShaderDesc.sourceType           = LLGL::ShaderSourceType::CodeString;
+                vertShaderDesc.vertex.inputAttribs  = vertexFormat.attributes;
+            }
+            auto vertShader = renderer->CreateShader(vertShaderDesc);
+
+            if (vertShader->HasErrors())
+                std::cerr << vertShader->GetReport() << std::endl;
+
+            auto fragShaderSource =
+            (
+                "#version 140\n"
+                "layout(std140) uniform Settings {\n"
+                "    vec4 color;\n"
+                "};\n"
+                "out vec4 fragColor;\n"
+                "void main() {\n"
+                "    fragColor = color;\n"
+                "}\n"
+            );
+
+            LLGL::ShaderDescriptor fragShaderDesc;
+            {
+                fragShaderDesc.type         = LLGL::ShaderType::Fragment;
+                fragShaderDesc.source       = fragShaderSource;
+                fragShaderDesc.sourceType   = LLGL::ShaderSourceType::CodeString;
+            }
+            auto fragShader = renderer->CreateShader(fragShaderDesc);
+
+            if (fragShader->HasErrors())
+                std::cerr << fragShader->GetReport() << std::endl;
+
+            // Create shader program
+            LLGL::ShaderProgramDescriptor shaderProgramDesc;
+            {
+                shaderProgramDesc.vertexShader      = vertShader;
+                shaderProgramDesc.fragmentShader    = fragShader;
+            }
+            shaderProgram = renderer->CreateShaderProgram(shaderProgramDesc);
+
+            if (shaderProgram->HasErrors())
+            {
+                std::cerr << shaderProgram->GetReport() << std::endl;
+                shaderProgram = nullptr;
+                return;
+            }
+
+            // Create pipeline layout with a single constant buffer binding
+            LLGL::PipelineLayoutDescriptor layoutDesc;
+            {
+                layoutDesc.bindings =
+                {
+                    LLGL::BindingDescriptor
+                    {
+                        "Settings",
+                        LLGL::ResourceType::Buffer,
+                        LLGL::BindFlags::ConstantBuffer,
+                        LLGL::StageFlags::FragmentStage,
+                        0
+                    }
+                };
+            }
+            pipelineLayout = renderer->CreatePipelineLayout(layoutDesc);
+
+            // Create graphics pipeline
+            LLGL::GraphicsPipelineDescriptor pipelineDesc;
+            {
+                pipelineDesc.shaderProgram  = shaderProgram;
+                pipelineDesc.pipelineLayout = pipelineLayout;
+            }
+            pipeline = renderer->CreateGraphicsPipeline(pipelineDesc);
+
+            // Create two resource heaps with the same constant buffer, to switch between
+            const float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+            LLGL::BufferDescriptor constantBufferDesc;
+            {
+                constantBufferDesc.size         = sizeof(color);
+                constantBufferDesc.bindFlags    = LLGL::BindFlags::ConstantBuffer;
+            }
+            constantBuffer = renderer->CreateBuffer(constantBufferDesc, color);
+
+            for (int i = 0; i < 2; ++i)
+            {
+                LLGL::ResourceHeapDescriptor heapDesc;
+                {
+                    heapDesc.pipelineLayout = pipelineLayout;
+                    heapDesc.resourceViews  = { constantBuffer };
+                }
+                resourceHeaps[i] = renderer->CreateResourceHeap(heapDesc);
+            }
+        }
+
+        /* ----- Scenarios ----- */
+
+        void TestStateSetters()
+        {
+            const LLGL::Viewport viewport { { 0, 0 }, context->GetResolution() };
+
+            RunScenario(
+                "set_viewport", 0.0,
+                [this, &viewport]()
+                {
+                    for (std::uint32_t i = 0; i < config.numCalls; ++i)
+                        commands->SetViewport(viewport);
+                }
+            );
+
+            const LLGL::Viewport viewports[4] = { viewport, viewport, viewport, viewport };
+
+            RunScenario(
+                "set_viewports_array", 0.0,
+                [this, &viewports]()
+                {
+                    for (std::uint32_t i = 0; i < config.numCalls; ++i)
+                        commands->SetViewports(4, viewports);
+                }
+            );
+
+            const LLGL::Scissor scissor { 0, 0, 64, 64 };
+
+            RunScenario(
+                "set_scissor", 0.0,
+                [this, &scissor]()
+                {
+                    for (std::uint32_t i = 0; i < config.numCalls; ++i)
+                        commands->SetScissor(scissor);
+                }
+            );
+
+            RunScenario(
+                "set_vertex_buffer", 0.0,
+                [this]()
+                {
+                    for (std::uint32_t i = 0; i < config.numCalls; ++i)
+                        commands->SetVertexBuffer(*vertexBuffer);
+                }
+            );
+
+            RunScenario(
+                "clear_color", 0.0,
+                [this]()
+                {
+                    for (std::uint32_t i = 0; i < config.numCalls; ++i)
+                        commands->Clear(LLGL::ClearFlags::Color);
+                }
+            );
+        }
+
+        void TestPipelineAndHeapSwitching()
+        {
+            RunScenario(
+                "set_graphics_pipeline", 0.0,
+                [this]()
+                {
+                    for (std::uint32_t i = 0; i < config.numCalls; ++i)
+                        commands->SetGraphicsPipeline(*pipeline);
+                }
+            );
+
+            RunScenario(
+                "set_resource_heap", 0.0,
+                [this]()
+                {
+                    for (std::uint32_t i = 0; i < config.numCalls; ++i)
+                        commands->SetGraphicsResourceHeap(*resourceHeaps[i % 2], 0);
+                }
+            );
+        }
+
+        void TestDrawCalls()
+        {
+            RunScenario(
+                "draw", 0.0,
+                [this]()
+                {
+                    commands->SetVertexBuffer(*vertexBuffer);
+                    commands->SetGraphicsResourceHeap(*resourceHeaps[0], 0);
+                    for (std::uint32_t i = 0; i < config.numCalls; ++i)
+                        commands->Draw(3, 0);
+                }
+            );
+        }
+
+        void TestBufferUpdates()
+        {
+            char chunk[updateChunkSize] = {};
+
+            RunScenario(
+                "update_buffer", 0.0,
+                [this, &chunk]()
+                {
+                    for (std::uint32_t i = 0; i < config.numCalls; ++i)
+                        commands->UpdateBuffer(*updateBuffer, 0, chunk, updateChunkSize);
+                }
+            );
+
+            RunScenario(
+                "write_buffer", 0.0,
+                [this, &chunk]()
+                {
+                    for (std::uint32_t i = 0; i < config.numCalls; ++i)
+                        renderer->WriteBuffer(*updateBuffer, 0, chunk, updateChunkSize);
+                }
+            );
+        }
+
+    public:
+
+        void Load(const TestConfig& testConfig)
+        {
+            // Store test configuration
+            config = testConfig;
+
+            // Load renderer
+            renderer = LLGL::RenderSystem::Load(config.rendererModule);
+
+            // Create render context
+            LLGL::RenderContextDescriptor contextDesc;
+            {
+                contextDesc.videoMode.resolution = { 640, 480 };
+            }
+            context = renderer->CreateRenderContext(contextDesc);
+
+            // Create command buffer
+            commands = renderer->CreateCommandBuffer();
+            commandQueue = renderer->GetCommandQueue();
+
+            // Create resources
+            CreateShadersAndPipelines();
+
+            LLGL::BufferDescriptor updateBufferDesc;
+            {
+                updateBufferDesc.size       = updateChunkSize;
+                updateBufferDesc.bindFlags  = LLGL::BindFlags::VertexBuffer;
+                updateBufferDesc.miscFlags  = LLGL::MiscFlags::DynamicUsage;
+            }
+            updateBuffer = renderer->CreateBuffer(updateBufferDesc);
+        }
+
+        void Run()
+        {
+            std::cout << "audit heap allocations with " << config.numCalls << " calls per scenario ..." << std::endl;
+
+            TestStateSetters();
+            TestBufferUpdates();
+
+            if (shaderProgram != nullptr)
+            {
+                TestPipelineAndHeapSwitching();
+                TestDrawCalls();
+            }
+            else
+                std::cerr << "shader compilation failed; skip pipeline, resource heap, and draw scenarios" << std::endl;
+        }
+
+        // Prints the audit report and returns false if any scenario exceeded its regression threshold.
+        bool WriteReport()
+        {
+            bool passed = true;
+
+            std::cout << std::endl;
+            std::cout
+                << std::left  << std::setw(24) << "scenario"
+                << std::right << std::setw(8)  << "calls"
+                << std::setw(8)  << "allocs"
+                << std::setw(12) << "per-call"
+                << std::setw(12) << "threshold"
+                << std::setw(8)  << "result" << std::endl;
+
+            for (const auto& result : results)
+            {
+                std::cout
+                    << std::left  << std::setw(24) << result.name
+                    << std::right << std::setw(8)  << result.calls
+                    << std::setw(8)  << result.allocations
+                    << std::setw(12) << std::fixed << std::setprecision(3) << result.AllocsPerCall()
+                    << std::setw(12) << result.maxAllocsPerCall
+                    << std::setw(8)  << (result.Failed() ? "FAIL" : "OK") << std::endl;
+
+                if (result.Failed())
+                    passed = false;
+            }
+
+            if (!passed)
+                std::cerr << std::endl << "allocation regression detected" << std::endl;
+
+            return passed;
+        }
+
+};
+
+static void PrintUsage()
+{
+    std::cout << "usage: Test_Allocations [RENDERER] [--calls N] [--no-fail]" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    TestConfig testConfig;
+
+    // Parse command line arguments
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            PrintUsage();
+            return 0;
+        }
+        else if (arg == "--calls" && i + 1 < argc)
+            testConfig.numCalls = static_cast<std::uint32_t>(std::atoi(argv[++i]));
+        else if (arg == "--no-fail")
+            testConfig.enforce = false;
+        else if (!arg.empty() && arg[0] != '-')
+            testConfig.rendererModule = arg;
+        else
+        {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    try
+    {
+        AllocationTest test;
+        test.Load(testConfig);
+        test.Run();
+        if (!test.WriteReport() && testConfig.enforce)
+            return 1;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,549 @@
+/*
+ * Test_BackendBench.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Image.h>
+#include <LLGL/Timer.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+/*
+Runs one identical scene workload (instanced geometry, dynamic uniforms,
+texture streaming, readbacks) on every render system module that can be
+loaded on this host, and prints a comparison report where the timings of
+each phase are normalized to the fastest backend (factor 1.00).
+*/
+
+struct BenchConfig
+{
+    std::vector<std::string>    modules;                    // explicit module list; empty: all modules found on the host
+    std::size_t                 numFrames           = 16;   // timed frames per phase
+    std::size_t                 numWarmupFrames     = 4;    // untimed frames per phase to exclude one-time costs
+    std::uint32_t               numInstances        = 10000;
+    std::uint32_t               numUniformUpdates   = 64;   // uniform updates (each followed by a draw) per frame
+    std::uint32_t               textureSize         = 512;
+};
+
+// Median frame time (in nanoseconds) of one workload phase on one backend.
+struct PhaseResult
+{
+    std::string name;
+    double      medianTime  = 0.0;
+};
+
+// All phase results of one backend.
+struct BackendResult
+{
+    std::string                 module;
+    std::string                 rendererName;
+    std::vector<PhaseResult>    phases;
+};
+
+static double ToMilliseconds(double nanoseconds)
+{
+    return (nanoseconds / 1000000.0);
+}
+
+static double SampleMedian(std::vector<std::uint64_t> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    const auto n = samples.size();
+    if (n % 2 == 0)
+        return (static_cast<double>(samples[n/2 - 1]) + static_cast<double>(samples[n/2])) / 2.0;
+    else
+        return static_cast<double>(samples[n/2]);
+}
+
+class BackendBench
+{
+
+    private:
+
+        std::unique_ptr<LLGL::RenderSystem> renderer;
+        LLGL::RenderContext*                context         = nullptr;
+        LLGL::CommandQueue*                 commandQueue    = nullptr;
+        LLGL::CommandBuffer*                commands        = nullptr;
+        std::unique_ptr<LLGL::Timer>        timer;
+
+        LLGL::ShaderProgram*                shaderProgram   = nullptr;
+        LLGL::PipelineLayout*               pipelineLayout  = nullptr;
+        LLGL::GraphicsPipeline*             pipeline        = nullptr;
+        LLGL::Buffer*                       vertexBuffer    = nullptr;
+        LLGL::Buffer*                       constantBuffer  = nullptr;
+        LLGL::ResourceHeap*                 resourceHeap    = nullptr;
+        LLGL::Texture*                      streamTexture   = nullptr;
+
+        LLGL::VertexFormat                  vertexFormat;
+        LLGL::Image                         streamImage;    // source image for the streaming phase
+        std::vector<char>                   readbackData;   // destination buffer for the readback phase
+
+        BenchConfig                         config;
+        BackendResult                       result;
+
+    private:
+
+        /* ----- Measurement ----- */
+
+        // Measures the CPU time (in nanoseconds) the specified callback takes to execute.
+        std::uint64_t MeasureTime(const std::function<void()>& callback)
+        {
+            timer->Start();
+            {
+                callback();
+            }
+            const auto ticks = timer->Stop();
+            return static_cast<std::uint64_t>(
+                static_cast<double>(ticks) * (1000000000.0 / static_cast<double>(timer->GetFrequency()))
+            );
+        }
+
+        // Runs one workload phase: warm-up frames followed by timed frames, recording the median frame time.
+        void RunPhase(const std::string& name, const std::function<void()>& frame)
+        {
+            std::cout << "  run phase: " << name << " ..." << std::endl;
+
+            for (std::size_t i = 0; i < config.numWarmupFrames; ++i)
+                frame();
+
+            std::vector<std::uint64_t> samples;
+            samples.reserve(config.numFrames);
+
+            for (std::size_t i = 0; i < config.numFrames; ++i)
+                samples.push_back(MeasureTime(frame));
+
+            PhaseResult phase;
+            {
+                phase.name          = name;
+                phase.medianTime    = SampleMedian(samples);
+            }
+            result.phases.push_back(std::move(phase));
+        }
+
+        /* ----- Resources ----- */
+
+        void CreateResources()
+        {
+            // Create vertex buffer with a single triangle; instances are offset in the vertex shader
+            vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+            const float vertices[] =
+            {
+                 0.0f,  0.01f,
+                 0.01f, -0.01f,
+                -0.01f, -0.01f,
+            };
+
+            LLGL::BufferDescriptor vertexBufferDesc;
+            {
+                vertexBufferDesc.size           = sizeof(vertices);
+                vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+                vertexBufferDesc.vertexAttribs  = vertexFormat.attributes;
+            }
+            vertexBuffer = renderer->CreateBuffer(vertexBufferDesc, vertices);
+
+            // Create vertex shader that spreads the instances over the viewport
+            auto vertShaderSource =
+            (
+                "#version 140\n"
+                "in vec2 position;\n"
+                "void main() {\n"
+                "    float id = float(gl_InstanceID);\n"
+                "    vec2 offset = vec2(mod(id, 100.0), floor(id / 100.0)) * 0.02 - 1.0;\n"
+                "    gl_Position = vec4(position + offset, 0.0, 1.0);\n"
+                "}\n"
+            );
+
+            LLGL::ShaderDescriptor vertShaderDesc;
+            {
+                vertShaderDesc.type                 = LLGL::ShaderType::Vertex;
+                vertShaderDesc.source               = vertShaderSource;
+                vertShaderDesc.sourceType           = LLGL::ShaderSourceType::CodeString;
+                vertShaderDesc.vertex.inputAttribs  = vertexFormat.attributes;
+            }
+            auto vertShader = renderer->CreateShader(vertShaderDesc);
+
+            if (vertShader->HasErrors())
+                std::cerr << vertShader->GetReport() << std::endl;
+
+            auto fragShaderSource =
+            (
+                "#version 140\n"
+                "layout(std140) uniform Settings {\n"
+                "    vec4 color;\n"
+                "};\n"
+                "out vec4 fragColor;\n"
+                "void main() {\n"
+                "    fragColor = color;\n"
+                "}\n"
+            );
+
+            LLGL::ShaderDescriptor fragShaderDesc;
+            {
+                fragShaderDesc.type         = LLGL::ShaderType::Fragment;
+                fragShaderDesc.source       = fragShaderSource;
+                fragShaderDesc.sourceType   = LLGL::ShaderSourceType::CodeString;
+            }
+            auto fragShader = renderer->CreateShader(fragShaderDesc);
+
+            if (fragShader->HasErrors())
+                std::cerr << fragShader->GetReport() << std::endl;
+
+            // Create shader program
+            LLGL::ShaderProgramDescriptor shaderProgramDesc;
+            {
+                shaderProgramDesc.vertexShader      = vertShader;
+                shaderProgramDesc.fragmentShader    = fragShader;
+            }
+            shaderProgram = renderer->CreateShaderProgram(shaderProgramDesc);
+
+            if (shaderProgram->HasErrors())
+                throw std::runtime_error("shader compilation failed:\n" + shaderProgram->GetReport());
+
+            // Create pipeline layout and resource heap with the settings constant buffer
+            LLGL::PipelineLayoutDescriptor layoutDesc;
+            {
+                layoutDesc.bindings =
+                {
+                    LLGL::BindingDescriptor
+                    {
+                        "Settings",
+                        LLGL::ResourceType::Buffer,
+                        LLGL::BindFlags::ConstantBuffer,
+                        LLGL::StageFlags::FragmentStage,
+                        0
+                    }
+                };
+            }
+            pipelineLayout = renderer->CreatePipelineLayout(layoutDesc);
+
+            const float color[4] = { 0.5f, 0.5f, 0.5f, 1.0f };
+
+            LLGL::BufferDescriptor constantBufferDesc;
+            {
+                constantBufferDesc.size         = sizeof(color);
+                constantBufferDesc.bindFlags    = LLGL::BindFlags::ConstantBuffer;
+            }
+            constantBuffer = renderer->CreateBuffer(constantBufferDesc, color);
+
+            LLGL::ResourceHeapDescriptor heapDesc;
+            {
+                heapDesc.pipelineLayout = pipelineLayout;
+                heapDesc.resourceViews  = { constantBuffer };
+            }
+            resourceHeap = renderer->CreateResourceHeap(heapDesc);
+
+            // Create graphics pipeline
+            LLGL::GraphicsPipelineDescriptor pipelineDesc;
+            {
+                pipelineDesc.shaderProgram  = shaderProgram;
+                pipelineDesc.pipelineLayout = pipelineLayout;
+            }
+            pipeline = renderer->CreateGraphicsPipeline(pipelineDesc);
+
+            // Create source image and destination texture for the streaming and readback phases
+            streamImage = LLGL::Image
+            {
+                { config.textureSize, config.textureSize, 1 },
+                LLGL::ImageFormat::RGBA,
+                LLGL::DataType::UInt8
+            };
+
+            auto imageData = streamImage.GetData();
+            for (std::size_t i = 0, n = streamImage.GetDataSize(); i < n; ++i)
+                reinterpret_cast<std::uint8_t*>(imageData)[i] = static_cast<std::uint8_t>(i * 7);
+
+            LLGL::TextureDescriptor textureDesc;
+            {
+                textureDesc.type            = LLGL::TextureType::Texture2D;
+                textureDesc.format          = LLGL::Format::RGBA8UNorm;
+                textureDesc.extent.width    = config.textureSize;
+                textureDesc.extent.height   = config.textureSize;
+                textureDesc.mipLevels       = 1;
+            }
+            const auto initialImageDesc = streamImage.GetSrcDesc();
+            streamTexture = renderer->CreateTexture(textureDesc, &initialImageDesc);
+
+            readbackData.resize(streamImage.GetDataSize());
+        }
+
+        /* ----- Workload phases ----- */
+
+        void RunInstancedGeometry()
+        {
+            RunPhase(
+                "instanced_geometry",
+                [this]()
+                {
+                    commands->Begin();
+                    {
+                        commands->BeginRenderPass(*context);
+                        {
+                            commands->SetViewport(LLGL::Viewport{ { 0, 0 }, context->GetResolution() });
+                            commands->SetGraphicsPipeline(*pipeline);
+                            commands->SetGraphicsResourceHeap(*resourceHeap);
+                            commands->SetVertexBuffer(*vertexBuffer);
+                            commands->DrawInstanced(3, 0, config.numInstances);
+                        }
+                        commands->EndRenderPass();
+                    }
+                    commands->End();
+                    commandQueue->Submit(*commands);
+                    commandQueue->WaitIdle();
+                }
+            );
+        }
+
+        void RunDynamicUniforms()
+        {
+            RunPhase(
+                "dynamic_uniforms",
+                [this]()
+                {
+                    commands->Begin();
+                    {
+                        for (std::uint32_t i = 0; i < config.numUniformUpdates; ++i)
+                        {
+                            const float color[4] =
+                            {
+                                static_cast<float>(i % 256) / 255.0f,
+                                0.5f,
+                                0.5f,
+                                1.0f
+                            };
+                            commands->UpdateBuffer(*constantBuffer, 0, color, sizeof(color));
+
+                            commands->BeginRenderPass(*context);
+                            {
+                                commands->SetViewport(LLGL::Viewport{ { 0, 0 }, context->GetResolution() });
+                                commands->SetGraphicsPipeline(*pipeline);
+                                commands->SetGraphicsResourceHeap(*resourceHeap);
+                                commands->SetVertexBuffer(*vertexBuffer);
+                                commands->Draw(3, 0);
+                            }
+                            commands->EndRenderPass();
+                        }
+                    }
+                    commands->End();
+                    commandQueue->Submit(*commands);
+                    commandQueue->WaitIdle();
+                }
+            );
+        }
+
+        void RunTextureStreaming()
+        {
+            const LLGL::TextureRegion region
+            {
+                LLGL::Offset3D{ 0, 0, 0 },
+                LLGL::Extent3D{ config.textureSize, config.textureSize, 1 }
+            };
+            const auto imageDesc = streamImage.GetSrcDesc();
+
+            RunPhase(
+                "texture_streaming",
+                [this, region, imageDesc]()
+                {
+                    renderer->WriteTexture(*streamTexture, region, imageDesc);
+                }
+            );
+        }
+
+        void RunReadbacks()
+        {
+            LLGL::DstImageDescriptor imageDesc;
+            {
+                imageDesc.format    = LLGL::ImageFormat::RGBA;
+                imageDesc.dataType  = LLGL::DataType::UInt8;
+                imageDesc.data      = readbackData.data();
+                imageDesc.dataSize  = readbackData.size();
+            }
+
+            RunPhase(
+                "readback",
+                [this, imageDesc]()
+                {
+                    renderer->ReadTexture(*streamTexture, 0, imageDesc);
+                }
+            );
+        }
+
+    public:
+
+        // Runs the entire workload on the specified render system module and returns its phase results.
+        BackendResult Run(const std::string& module, const BenchConfig& benchConfig)
+        {
+            config          = benchConfig;
+            result          = {};
+            result.module   = module;
+
+            std::cout << "benchmark \"" << module << "\":" << std::endl;
+
+            // Load renderer and create render context
+            renderer = LLGL::RenderSystem::Load(module);
+            result.rendererName = renderer->GetRendererInfo().rendererName;
+
+            LLGL::RenderContextDescriptor contextDesc;
+            {
+                contextDesc.videoMode.resolution = { 640, 480 };
+            }
+            context = renderer->CreateRenderContext(contextDesc);
+
+            commands = renderer->CreateCommandBuffer();
+            commandQueue = renderer->GetCommandQueue();
+            timer = LLGL::Timer::Create();
+
+            CreateResources();
+
+            // Run the identical workload phases
+            RunInstancedGeometry();
+            RunDynamicUniforms();
+            RunTextureStreaming();
+            RunReadbacks();
+
+            // Unload renderer before the next backend takes over
+            LLGL::RenderSystem::Unload(std::move(renderer));
+
+            return std::move(result);
+        }
+
+};
+
+/* ----- Report ----- */
+
+static void WriteComparisonReport(const std::vector<BackendResult>& results, std::ostream& stream)
+{
+    if (results.empty())
+        return;
+
+    const auto& phases = results.front().phases;
+
+    // Column width: longest module name
+    std::size_t moduleWidth = 8;
+    for (const auto& result : results)
+        moduleWidth = std::max(moduleWidth, result.module.size());
+
+    stream << std::fixed << std::setprecision(2);
+
+    for (std::size_t p = 0; p < phases.size(); ++p)
+    {
+        // Normalize against the fastest backend of this phase
+        double fastest = phases[p].medianTime;
+        for (const auto& result : results)
+            fastest = std::min(fastest, result.phases[p].medianTime);
+
+        stream << phases[p].name << ":\n";
+        for (const auto& result : results)
+        {
+            stream
+                << "  " << std::left << std::setw(static_cast<int>(moduleWidth)) << result.module << std::right
+                << std::setw(10) << ToMilliseconds(result.phases[p].medianTime) << " ms"
+                << "   x" << (result.phases[p].medianTime / fastest) << '\n';
+        }
+    }
+
+    // Overall score: geometric mean of the normalized factors over all phases (1.00 = fastest in every phase)
+    stream << "overall (geometric mean of normalized factors):\n";
+    for (const auto& result : results)
+    {
+        double logSum = 0.0;
+        for (std::size_t p = 0; p < phases.size(); ++p)
+        {
+            double fastest = phases[p].medianTime;
+            for (const auto& other : results)
+                fastest = std::min(fastest, other.phases[p].medianTime);
+            logSum += std::log(result.phases[p].medianTime / fastest);
+        }
+        const auto score = std::exp(logSum / static_cast<double>(phases.size()));
+
+        stream
+            << "  " << std::left << std::setw(static_cast<int>(moduleWidth)) << result.module << std::right
+            << "   x" << score << "   (" << result.rendererName << ")\n";
+    }
+}
+
+static void PrintUsage()
+{
+    std::cout << "usage: Test_BackendBench [RENDERER...] [--frames N] [--instances N] [--texture-size N]" << std::endl;
+    std::cout << "  without RENDERER arguments, all modules found on the host are benchmarked" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    BenchConfig benchConfig;
+
+    // Parse command line arguments
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            PrintUsage();
+            return 0;
+        }
+        else if (arg == "--frames" && i + 1 < argc)
+            benchConfig.numFrames = static_cast<std::size_t>(std::atoi(argv[++i]));
+        else if (arg == "--instances" && i + 1 < argc)
+            benchConfig.numInstances = static_cast<std::uint32_t>(std::atoi(argv[++i]));
+        else if (arg == "--texture-size" && i + 1 < argc)
+            benchConfig.textureSize = static_cast<std::uint32_t>(std::atoi(argv[++i]));
+        else if (!arg.empty() && arg[0] != '-')
+            benchConfig.modules.push_back(arg);
+        else
+        {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    // Without explicit modules, benchmark every module buildable on this host
+    if (benchConfig.modules.empty())
+        benchConfig.modules = LLGL::RenderSystem::FindModules();
+
+    if (benchConfig.modules.empty())
+    {
+        std::cerr << "no render system modules found" << std::endl;
+        return 1;
+    }
+
+    // Run the identical workload on each backend; a backend that fails to load or run is reported and skipped
+    std::vector<BackendResult> results;
+
+    for (const auto& module : benchConfig.modules)
+    {
+        try
+        {
+            BackendBench bench;
+            results.push_back(bench.Run(module, benchConfig));
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "skip \"" << module << "\": " << e.what() << std::endl;
+        }
+    }
+
+    if (results.empty())
+    {
+        std::cerr << "no backend completed the benchmark" << std::endl;
+        return 1;
+    }
+
+    std::cout << std::endl;
+    WriteComparisonReport(results, std::cout);
+
+    #ifdef _WIN32
+    system("pause");
+    #endif
+
+    return 0;
+}
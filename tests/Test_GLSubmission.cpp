@@ -0,0 +1,256 @@
+/*
+ * Test_GLSubmission.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Timer.h>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+/*
+Microbenchmark for the OpenGL draw submission paths:
+ - immediate:    GLImmediateCommandBuffer, commands are executed while they are recorded
+ - deferred:     GLDeferredCommandBuffer, commands are recorded once and interpreted on each submission
+ - multi-submit: GLDeferredCommandBuffer with the MultiSubmit flag; if LLGL was built with
+                 LLGL_ENABLE_JIT_COMPILER, the command stream is assembled into native code on End()
+Each path records an identical stream of draw calls and the record and replay costs are reported
+separately, so it is visible when the JIT pays off and when either path regresses.
+*/
+
+struct BenchConfig
+{
+    std::uint32_t numDrawCalls  = 10000;
+    std::uint32_t numReplays    = 100;
+};
+
+class SubmissionBenchmark
+{
+
+    private:
+
+        std::unique_ptr<LLGL::RenderSystem> renderer;
+        LLGL::RenderContext*                context         = nullptr;
+        LLGL::CommandQueue*                 commandQueue    = nullptr;
+
+        std::unique_ptr<LLGL::Timer>        timer;
+
+        LLGL::GraphicsPipeline*             pipeline        = nullptr;
+        LLGL::Buffer*                       vertexBuffers[2]    = {};
+
+        BenchConfig                         config;
+
+    private:
+
+        // Returns the elapsed time of the specified callback (in milliseconds).
+        double MeasureTime(const std::function<void()>& callback)
+        {
+            timer->Start();
+            {
+                callback();
+            }
+            const auto ticks = timer->Stop();
+            return (static_cast<double>(ticks) * (1000.0 / static_cast<double>(timer->GetFrequency())));
+        }
+
+        // Records the identical draw stream into the specified command buffer.
+        void RecordDrawStream(LLGL::CommandBuffer& commands)
+        {
+            commands.Begin();
+            {
+                commands.BeginRenderPass(*context);
+                {
+                    commands.SetViewport(LLGL::Viewport{ { 0, 0 }, context->GetResolution() });
+                    commands.SetGraphicsPipeline(*pipeline);
+
+                    for (std::uint32_t i = 0; i < config.numDrawCalls; ++i)
+                    {
+                        /* Alternate vertex buffers every 64 draw calls to also exercise buffer binds */
+                        if (i % 64 == 0)
+                            commands.SetVertexBuffer(*vertexBuffers[(i / 64) % 2]);
+                        commands.Draw(3, 0);
+                    }
+                }
+                commands.EndRenderPass();
+            }
+            commands.End();
+        }
+
+        void BenchPath(const std::string& name, long cmdBufferFlags)
+        {
+            LLGL::CommandBufferDescriptor cmdBufferDesc;
+            {
+                cmdBufferDesc.flags = cmdBufferFlags;
+            }
+            auto commands = renderer->CreateCommandBuffer(cmdBufferDesc);
+
+            /* Measure record cost; for the immediate path this includes execution */
+            const auto recordTime = MeasureTime(
+                [&]()
+                {
+                    RecordDrawStream(*commands);
+                }
+            );
+
+            /* Measure replay cost: submit the recorded stream repeatedly and wait for completion */
+            const auto replayTime = MeasureTime(
+                [&]()
+                {
+                    for (std::uint32_t i = 0; i < config.numReplays; ++i)
+                        commandQueue->Submit(*commands);
+                    commandQueue->WaitIdle();
+                }
+            );
+
+            std::cout
+                << name << ','
+                << recordTime << ','
+                << (replayTime / static_cast<double>(config.numReplays)) << '\n';
+
+            renderer->Release(*commands);
+        }
+
+        void CreatePipeline()
+        {
+            /* Create two identical vertex buffers with a single triangle */
+            LLGL::VertexFormat vertexFormat;
+            vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+            const float vertices[] =
+            {
+                 0.0f,  0.5f,
+                 0.5f, -0.5f,
+                -0.5f, -0.5f,
+            };
+
+            LLGL::BufferDescriptor vertexBufferDesc;
+            {
+                vertexBufferDesc.size           = sizeof(vertices);
+                vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+                vertexBufferDesc.vertexAttribs  = vertexFormat.attributes;
+            }
+            vertexBuffers[0] = renderer->CreateBuffer(vertexBufferDesc, vertices);
+            vertexBuffers[1] = renderer->CreateBuffer(vertexBufferDesc, vertices);
+
+            /* Create minimal shaders */
+            auto vertShaderSource =
+            (
+                "#version 130\n"
+                "in vec2 position;\n"
+                "void main() {\n"
+                "    gl_Position = vec4(position, 0.0, 1.0);\n"
+                "}\n"
+            );
+
+            LLGL::ShaderDescriptor vertShaderDesc;
+            {
+                vertShaderDesc.type                 = LLGL::ShaderType::Vertex;
+                vertShaderDesc.source               = vertShaderSource;
+                vertShaderDesc.sourceType           = LLGL::ShaderSourceType::CodeString;
+                vertShaderDesc.vertex.inputAttribs  = vertexFormat.attributes;
+            }
+            auto vertShader = renderer->CreateShader(vertShaderDesc);
+
+            auto fragShaderSource =
+            (
+                "#version 130\n"
+                "out vec4 fragColor;\n"
+                "void main() {\n"
+                "    fragColor = vec4(1.0);\n"
+                "}\n"
+            );
+
+            LLGL::ShaderDescriptor fragShaderDesc;
+            {
+                fragShaderDesc.type         = LLGL::ShaderType::Fragment;
+                fragShaderDesc.source       = fragShaderSource;
+                fragShaderDesc.sourceType   = LLGL::ShaderSourceType::CodeString;
+            }
+            auto fragShader = renderer->CreateShader(fragShaderDesc);
+
+            LLGL::ShaderProgramDescriptor shaderProgramDesc;
+            {
+                shaderProgramDesc.vertexShader      = vertShader;
+                shaderProgramDesc.fragmentShader    = fragShader;
+            }
+            auto shaderProgram = renderer->CreateShaderProgram(shaderProgramDesc);
+
+            if (shaderProgram->HasErrors())
+                throw std::runtime_error(shaderProgram->GetReport());
+
+            LLGL::GraphicsPipelineDescriptor pipelineDesc;
+            {
+                pipelineDesc.shaderProgram = shaderProgram;
+            }
+            pipeline = renderer->CreateGraphicsPipeline(pipelineDesc);
+        }
+
+    public:
+
+        void Load(const BenchConfig& benchConfig)
+        {
+            config = benchConfig;
+
+            /* Load OpenGL renderer; the submission paths under test are specific to this backend */
+            renderer = LLGL::RenderSystem::Load("OpenGL");
+
+            LLGL::RenderContextDescriptor contextDesc;
+            {
+                contextDesc.videoMode.resolution = { 640, 480 };
+            }
+            context = renderer->CreateRenderContext(contextDesc);
+
+            commandQueue = renderer->GetCommandQueue();
+            timer = LLGL::Timer::Create();
+
+            CreatePipeline();
+        }
+
+        void Run()
+        {
+            std::cout << "draw calls per stream: " << config.numDrawCalls << std::endl;
+            std::cout << "replays per path:      " << config.numReplays << std::endl;
+            #ifdef LLGL_ENABLE_JIT_COMPILER
+            std::cout << "JIT compiler:          enabled (multi-submit path executes native code)" << std::endl;
+            #else
+            std::cout << "JIT compiler:          disabled (multi-submit path is interpreted)" << std::endl;
+            #endif
+            std::cout << std::endl;
+
+            std::cout << "path,record_ms,replay_ms\n";
+
+            BenchPath("immediate",    0);
+            BenchPath("deferred",     LLGL::CommandBufferFlags::DeferredSubmit);
+            BenchPath("multi_submit", LLGL::CommandBufferFlags::MultiSubmit);
+        }
+
+};
+
+int main(int argc, char* argv[])
+{
+    BenchConfig config;
+
+    if (argc > 1)
+        config.numDrawCalls = static_cast<std::uint32_t>(std::atoi(argv[1]));
+    if (argc > 2)
+        config.numReplays = static_cast<std::uint32_t>(std::atoi(argv[2]));
+
+    try
+    {
+        SubmissionBenchmark bench;
+        bench.Load(config);
+        bench.Run();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
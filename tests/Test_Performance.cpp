@@ -7,9 +7,14 @@
 
 #include <LLGL/LLGL.h>
 #include <LLGL/Image.h>
-#include <vector>
+#include <LLGL/Timer.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <functional>
 #include <iostream>
+#include <string>
+#include <vector>
 
 
 static unsigned int g_seed;
@@ -48,12 +53,119 @@ LLGL::ColorRGBAub RandColorRGBA()
 
 struct TestConfig
 {
-    std::size_t     numTextures = 10;
-    std::uint32_t   textureSize = 512;
-    std::uint32_t   arrayLayers = 32;
-    std::uint32_t   numMipMaps  = 5;
+    std::string     rendererModule  = "OpenGL";
+    std::string     outputFormat    = "csv";    // "csv" or "json"
+    std::string     outputFilename;             // empty: print to standard output
+    std::size_t     numRepeats      = 8;        // number of statistical repeats per scenario
+    std::uint32_t   numDrawCalls    = 1000;
+    std::uint32_t   numPipelines    = 32;
+    std::uint32_t   numHeapSwitches = 1000;
+    std::size_t     numTextures     = 2;
+    std::uint32_t   textureSize     = 512;
+    std::uint32_t   arrayLayers     = 32;
+    std::uint32_t   numMipMaps      = 3;
 };
 
+// Result of a single benchmark scenario: elapsed time of each repeat (in nanoseconds).
+struct BenchmarkResult
+{
+    std::string                 name;
+    std::uint32_t               iterations  = 0;    // number of work items per repeat (e.g. draw calls)
+    std::vector<std::uint64_t>  samples;            // elapsed time per repeat (in nanoseconds)
+};
+
+/* ----- Statistics ----- */
+
+static double ToMilliseconds(double nanoseconds)
+{
+    return (nanoseconds / 1000000.0);
+}
+
+static double SampleMin(const std::vector<std::uint64_t>& samples)
+{
+    return static_cast<double>(*std::min_element(samples.begin(), samples.end()));
+}
+
+static double SampleMax(const std::vector<std::uint64_t>& samples)
+{
+    return static_cast<double>(*std::max_element(samples.begin(), samples.end()));
+}
+
+static double SampleMean(const std::vector<std::uint64_t>& samples)
+{
+    double sum = 0.0;
+    for (auto s : samples)
+        sum += static_cast<double>(s);
+    return (sum / static_cast<double>(samples.size()));
+}
+
+static double SampleMedian(std::vector<std::uint64_t> samples)
+{
+    std::sort(samples.begin(), samples.end());
+    const auto n = samples.size();
+    if (n % 2 == 0)
+        return (static_cast<double>(samples[n/2 - 1]) + static_cast<double>(samples[n/2])) / 2.0;
+    else
+        return static_cast<double>(samples[n/2]);
+}
+
+static double SampleStdDeviation(const std::vector<std::uint64_t>& samples)
+{
+    if (samples.size() < 2)
+        return 0.0;
+    const auto mean = SampleMean(samples);
+    double sum = 0.0;
+    for (auto s : samples)
+    {
+        const auto d = static_cast<double>(s) - mean;
+        sum += d*d;
+    }
+    return std::sqrt(sum / static_cast<double>(samples.size() - 1));
+}
+
+/* ----- Report writers ----- */
+
+static void WriteResultsCSV(const std::vector<BenchmarkResult>& results, std::ostream& stream)
+{
+    stream << "scenario,repeats,iterations,min_ms,median_ms,mean_ms,max_ms,stddev_ms\n";
+    for (const auto& result : results)
+    {
+        stream
+            << result.name << ','
+            << result.samples.size() << ','
+            << result.iterations << ','
+            << ToMilliseconds(SampleMin(result.samples)) << ','
+            << ToMilliseconds(SampleMedian(result.samples)) << ','
+            << ToMilliseconds(SampleMean(result.samples)) << ','
+            << ToMilliseconds(SampleMax(result.samples)) << ','
+            << ToMilliseconds(SampleStdDeviation(result.samples)) << '\n';
+    }
+}
+
+static void WriteResultsJSON(const std::vector<BenchmarkResult>& results, std::ostream& stream)
+{
+    stream << "[\n";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& result = results[i];
+        stream << "  {\n";
+        stream << "    \"scenario\": \"" << result.name << "\",\n";
+        stream << "    \"repeats\": " << result.samples.size() << ",\n";
+        stream << "    \"iterations\": " << result.iterations << ",\n";
+        stream << "    \"min_ms\": " << ToMilliseconds(SampleMin(result.samples)) << ",\n";
+        stream << "    \"median_ms\": " << ToMilliseconds(SampleMedian(result.samples)) << ",\n";
+        stream << "    \"mean_ms\": " << ToMilliseconds(SampleMean(result.samples)) << ",\n";
+        stream << "    \"max_ms\": " << ToMilliseconds(SampleMax(result.samples)) << ",\n";
+        stream << "    \"stddev_ms\": " << ToMilliseconds(SampleStdDeviation(result.samples)) << ",\n";
+        stream << "    \"samples_ns\": [";
+        for (std::size_t j = 0; j < result.samples.size(); ++j)
+            stream << (j > 0 ? ", " : "") << result.samples[j];
+        stream << "]\n";
+        stream << "  }" << (i + 1 < results.size() ? "," : "") << '\n';
+    }
+    stream << "]\n";
+}
+
 class PerformanceTest
 {
 
@@ -65,100 +177,447 @@ class PerformanceTest
         LLGL::CommandBuffer*                commands        = nullptr;
 
         LLGL::QueryHeap*                    timerQuery      = nullptr;
+        std::unique_ptr<LLGL::Timer>        timer;
+
+        LLGL::ShaderProgram*                shaderProgram   = nullptr;
+        LLGL::PipelineLayout*               pipelineLayout  = nullptr;
+        LLGL::GraphicsPipeline*             pipeline        = nullptr;
+        LLGL::Buffer*                       vertexBuffer    = nullptr;
+        LLGL::Buffer*                       updateBuffer    = nullptr;
+        LLGL::Buffer*                       writeBuffer     = nullptr;
+        LLGL::Buffer*                       constantBuffers[2]  = {};
+        LLGL::ResourceHeap*                 resourceHeaps[2]    = {};
+        LLGL::Texture*                      uploadTexture   = nullptr;
         std::vector<LLGL::Texture*>         textures;
 
+        LLGL::VertexFormat                  vertexFormat;
+
+        std::vector<char>                   updateData;     // source data for the buffer update scenarios
+        LLGL::Image                         uploadImage;    // source image for the texture upload scenario
+
         TestConfig                          config;
+        std::vector<BenchmarkResult>        results;
 
     private:
 
-        void CreateTextures(std::size_t numTextures)
+        static const std::uint16_t          updateChunkSize = 32768;        // bytes per CommandBuffer::UpdateBuffer call
+        static const std::uint32_t          numUpdateChunks = 64;
+        static const std::uint64_t          writeBufferSize = 16*1024*1024; // bytes per RenderSystem::WriteBuffer call
+
+        /* ----- Measurement ----- */
+
+        // Measures the GPU time (in nanoseconds) the specified command encoding takes to execute.
+        std::uint64_t MeasureGPUTime(const std::function<void()>& encodeCommands)
         {
-            // Create source image for textures
-            std::cout << "generate random image ..." << std::endl;
+            commands->Begin();
+            commands->BeginQuery(*timerQuery, 0);
+            {
+                encodeCommands();
+            }
+            commands->EndQuery(*timerQuery, 0);
+            commands->End();
+            commandQueue->Submit(*commands);
+            commandQueue->WaitIdle();
 
-            LLGL::Image image
+            std::uint64_t result = 0;
+            while (!commandQueue->QueryResult(*timerQuery, 0, 1, &result, sizeof(result)))
             {
-                { config.textureSize, config.textureSize, config.arrayLayers },
+                // spin until the query result is available
+            }
+            return result;
+        }
+
+        // Measures the CPU time (in nanoseconds) the specified callback takes to execute.
+        std::uint64_t MeasureCPUTime(const std::function<void()>& callback)
+        {
+            timer->Start();
+            {
+                callback();
+            }
+            const auto ticks = timer->Stop();
+            return static_cast<std::uint64_t>(
+                static_cast<double>(ticks) * (1000000000.0 / static_cast<double>(timer->GetFrequency()))
+            );
+        }
+
+        void RunGPUScenario(const std::string& name, std::uint32_t iterations, const std::function<void()>& encodeCommands)
+        {
+            std::cout << "run scenario: " << name << " ..." << std::endl;
+
+            BenchmarkResult result;
+            result.name         = name;
+            result.iterations   = iterations;
+
+            // Warm-up run to exclude one-time costs (e.g. internal staging allocations)
+            MeasureGPUTime(encodeCommands);
+
+            for (std::size_t i = 0; i < config.numRepeats; ++i)
+                result.samples.push_back(MeasureGPUTime(encodeCommands));
+
+            results.push_back(std::move(result));
+        }
+
+        void RunCPUScenario(const std::string& name, std::uint32_t iterations, const std::function<void()>& callback)
+        {
+            std::cout << "run scenario: " << name << " ..." << std::endl;
+
+            BenchmarkResult result;
+            result.name         = name;
+            result.iterations   = iterations;
+
+            // Warm-up run to exclude one-time costs
+            MeasureCPUTime(callback);
+
+            for (std::size_t i = 0; i < config.numRepeats; ++i)
+                result.samples.push_back(MeasureCPUTime(callback));
+
+            results.push_back(std::move(result));
+        }
+
+        /* ----- Resources ----- */
+
+        void CreateShadersAndPipelines()
+        {
+            // Create vertex buffer with a single triangle
+            vertexFormat.AppendAttribute({ "position", LLGL::Format::RG32Float });
+
+            const float vertices[] =
+            {
+                 0.0f,  0.5f,
+                 0.5f, -0.5f,
+                -0.5f, -0.5f,
+            };
+
+            LLGL::BufferDescriptor vertexBufferDesc;
+            {
+                vertexBufferDesc.size           = sizeof(vertices);
+                vertexBufferDesc.bindFlags      = LLGL::BindFlags::VertexBuffer;
+                vertexBufferDesc.vertexAttribs  = vertexFormat.attributes;
+            }
+            vertexBuffer = renderer->CreateBuffer(vertexBufferDesc, vertices);
+
+            // Create minimal vertex and fragment shaders
+            auto vertShaderSource =
+            (
+                "#version 140\n"
+                "in vec2 position;\n"
+                "void main() {\n"
+                "    gl_Position = vec4(position, 0.0, 1.0);\n"
+                "}\n"
+            );
+
+            LLGL::ShaderDescriptor vertShaderDesc;
+            {
+                vertShaderDesc.type                 = LLGL::ShaderType::Vertex;
+                vertShaderDesc.source               = vertShaderSource;
+                vertShaderDesc.sourceType           = LLGL::ShaderSourceType::CodeString;
+                vertShaderDesc.vertex.inputAttribs  = vertexFormat.attributes;
+            }
+            auto vertShader = renderer->CreateShader(vertShaderDesc);
+
+            if (vertShader->HasErrors())
+                std::cerr << vertShader->GetReport() << std::endl;
+
+            auto fragShaderSource =
+            (
+                "#version 140\n"
+                "layout(std140) uniform Settings {\n"
+                "    vec4 color;\n"
+                "};\n"
+                "out vec4 fragColor;\n"
+                "void main() {\n"
+                "    fragColor = color;\n"
+                "}\n"
+            );
+
+            LLGL::ShaderDescriptor fragShaderDesc;
+            {
+                fragShaderDesc.type         = LLGL::ShaderType::Fragment;
+                fragShaderDesc.source       = fragShaderSource;
+                fragShaderDesc.sourceType   = LLGL::ShaderSourceType::CodeString;
+            }
+            auto fragShader = renderer->CreateShader(fragShaderDesc);
+
+            if (fragShader->HasErrors())
+                std::cerr << fragShader->GetReport() << std::endl;
+
+            // Create shader program
+            LLGL::ShaderProgramDescriptor shaderProgramDesc;
+            {
+                shaderProgramDesc.vertexShader      = vertShader;
+                shaderProgramDesc.fragmentShader    = fragShader;
+            }
+            shaderProgram = renderer->CreateShaderProgram(shaderProgramDesc);
+
+            if (shaderProgram->HasErrors())
+            {
+                std::cerr << shaderProgram->GetReport() << std::endl;
+                shaderProgram = nullptr;
+                return;
+            }
+
+            // Create pipeline layout with a single constant buffer binding
+            LLGL::PipelineLayoutDescriptor layoutDesc;
+            {
+                layoutDesc.bindings =
+                {
+                    LLGL::BindingDescriptor
+                    {
+                        "Settings",
+                        LLGL::ResourceType::Buffer,
+                        LLGL::BindFlags::ConstantBuffer,
+                        LLGL::StageFlags::FragmentStage,
+                        0
+                    }
+                };
+            }
+            pipelineLayout = renderer->CreatePipelineLayout(layoutDesc);
+
+            // Create graphics pipeline
+            LLGL::GraphicsPipelineDescriptor pipelineDesc;
+            {
+                pipelineDesc.shaderProgram  = shaderProgram;
+                pipelineDesc.pipelineLayout = pipelineLayout;
+            }
+            pipeline = renderer->CreateGraphicsPipeline(pipelineDesc);
+
+            // Create two resource heaps with one constant buffer each, to switch between
+            for (int i = 0; i < 2; ++i)
+            {
+                const float color[4] = { RandFloat(), RandFloat(), RandFloat(), 1.0f };
+
+                LLGL::BufferDescriptor constantBufferDesc;
+                {
+                    constantBufferDesc.size         = sizeof(color);
+                    constantBufferDesc.bindFlags    = LLGL::BindFlags::ConstantBuffer;
+                }
+                constantBuffers[i] = renderer->CreateBuffer(constantBufferDesc, color);
+
+                LLGL::ResourceHeapDescriptor heapDesc;
+                {
+                    heapDesc.pipelineLayout = pipelineLayout;
+                    heapDesc.resourceViews  = { constantBuffers[i] };
+                }
+                resourceHeaps[i] = renderer->CreateResourceHeap(heapDesc);
+            }
+        }
+
+        void CreateBuffersAndTextures()
+        {
+            // Create destination buffers for the update scenarios
+            LLGL::BufferDescriptor updateBufferDesc;
+            {
+                updateBufferDesc.size       = updateChunkSize;
+                updateBufferDesc.bindFlags  = LLGL::BindFlags::VertexBuffer;
+            }
+            updateBuffer = renderer->CreateBuffer(updateBufferDesc);
+
+            LLGL::BufferDescriptor writeBufferDesc;
+            {
+                writeBufferDesc.size        = writeBufferSize;
+                writeBufferDesc.bindFlags   = LLGL::BindFlags::VertexBuffer;
+            }
+            writeBuffer = renderer->CreateBuffer(writeBufferDesc);
+
+            updateData.resize(static_cast<std::size_t>(writeBufferSize));
+            for (std::size_t i = 0; i < updateData.size(); ++i)
+                updateData[i] = static_cast<char>(FastRand());
+
+            // Create source image and destination texture for the upload scenario
+            uploadImage = LLGL::Image
+            {
+                { config.textureSize, config.textureSize, 1 },
                 LLGL::ImageFormat::RGBA,
                 LLGL::DataType::UInt8
             };
 
-            auto imageData = reinterpret_cast<LLGL::ColorRGBAub*>(image.GetData());
-            for (std::size_t i = 0, n = image.GetNumPixels(); i < n; ++i)
+            auto imageData = reinterpret_cast<LLGL::ColorRGBAub*>(uploadImage.GetData());
+            for (std::size_t i = 0, n = uploadImage.GetNumPixels(); i < n; ++i)
                 imageData[i] = RandColorRGBA();
 
-            auto imageDesc = image.GetSrcDesc();
-
-            // Create textures
-            textures.reserve(numTextures);
+            LLGL::TextureDescriptor uploadTextureDesc;
+            {
+                uploadTextureDesc.type          = LLGL::TextureType::Texture2D;
+                uploadTextureDesc.format        = LLGL::Format::RGBA8UNorm;
+                uploadTextureDesc.extent.width  = config.textureSize;
+                uploadTextureDesc.extent.height = config.textureSize;
+            }
+            uploadTexture = renderer->CreateTexture(uploadTextureDesc);
 
+            // Create array textures for the MIP-map generation scenario
             LLGL::TextureDescriptor textureDesc;
             {
                 textureDesc.type            = LLGL::TextureType::Texture2DArray;
                 textureDesc.format          = LLGL::Format::RGBA8UNorm;
-                textureDesc.extent.width    = image.GetExtent().width;
-                textureDesc.extent.height   = image.GetExtent().height;
-                textureDesc.arrayLayers     = image.GetExtent().depth;
+                textureDesc.extent.width    = config.textureSize;
+                textureDesc.extent.height   = config.textureSize;
+                textureDesc.arrayLayers     = config.arrayLayers;
             }
-            for (std::size_t i = 0; i < numTextures; ++i)
+
+            // Fill the first array layer with image data, the rest is left uninitialized
+            const auto imageDesc = uploadImage.GetSrcDesc();
+
+            const LLGL::TextureRegion firstLayerRegion
+            {
+                LLGL::Offset3D{ 0, 0, 0 },
+                LLGL::Extent3D{ config.textureSize, config.textureSize, 1 }
+            };
+
+            textures.reserve(config.numTextures);
+            for (std::size_t i = 0; i < config.numTextures; ++i)
             {
-                std::cout << "create texture " << (i + 1) << '/' << numTextures << '\r';
-                textures.push_back(renderer->CreateTexture(textureDesc, &imageDesc));
+                textures.push_back(renderer->CreateTexture(textureDesc));
+                renderer->WriteTexture(*textures.back(), firstLayerRegion, imageDesc);
             }
+        }
+
+        /* ----- Scenarios ----- */
 
-            std::cout << std::endl;
+        void TestDrawCallThroughput()
+        {
+            RunGPUScenario(
+                "draw_call_throughput", config.numDrawCalls,
+                [this]()
+                {
+                    commands->BeginRenderPass(*context);
+                    {
+                        commands->SetViewport(LLGL::Viewport{ { 0, 0 }, context->GetResolution() });
+                        commands->SetGraphicsPipeline(*pipeline);
+                        commands->SetGraphicsResourceHeap(*resourceHeaps[0]);
+                        commands->SetVertexBuffer(*vertexBuffer);
+
+                        for (std::uint32_t i = 0; i < config.numDrawCalls; ++i)
+                            commands->Draw(3, 0);
+                    }
+                    commands->EndRenderPass();
+                }
+            );
         }
 
-        void MeasureTime(const std::string& title, const std::function<void()>& callback)
+        void TestResourceHeapSwitching()
         {
-            // Measure time with query
-            commands->Begin();
-            commands->BeginQuery(*timerQuery, 0);
-            {
-                callback();
-            }
-            commands->EndQuery(*timerQuery, 0);
-            commands->End();
-            commandQueue->Submit(*commands);
+            RunGPUScenario(
+                "resource_heap_switching", config.numHeapSwitches,
+                [this]()
+                {
+                    commands->BeginRenderPass(*context);
+                    {
+                        commands->SetViewport(LLGL::Viewport{ { 0, 0 }, context->GetResolution() });
+                        commands->SetGraphicsPipeline(*pipeline);
+                        commands->SetVertexBuffer(*vertexBuffer);
+
+                        for (std::uint32_t i = 0; i < config.numHeapSwitches; ++i)
+                        {
+                            commands->SetGraphicsResourceHeap(*resourceHeaps[i % 2]);
+                            commands->Draw(3, 0);
+                        }
+                    }
+                    commands->EndRenderPass();
+                }
+            );
+        }
 
-            // Print result
-            std::uint64_t result = 0;
-            while (true)
-            {
-                if (commandQueue->QueryResult(*timerQuery, 0, 1, &result, sizeof(result)))
+        void TestBufferUpdateBandwidth()
+        {
+            RunGPUScenario(
+                "buffer_update_bandwidth", numUpdateChunks,
+                [this]()
                 {
-                    std::cout << title << std::endl;
-                    std::cout << "\tduration: " << result << "ns (" << (static_cast<double>(result) / 1000000.0) << "ms)" << "\n\n";
-                    break;
+                    for (std::uint32_t i = 0; i < numUpdateChunks; ++i)
+                        commands->UpdateBuffer(*updateBuffer, 0, updateData.data(), updateChunkSize);
                 }
-            }
+            );
         }
 
-        void TestMIPMapGeneration()
+        void TestBufferWriteBandwidth()
         {
-            for (std::size_t i = 0; i < config.numTextures; ++i)
+            RunCPUScenario(
+                "buffer_write_bandwidth", 1,
+                [this]()
+                {
+                    renderer->WriteBuffer(*writeBuffer, 0, updateData.data(), writeBufferSize);
+                }
+            );
+        }
+
+        void TestTextureUpload()
+        {
+            const LLGL::TextureRegion region
             {
-                commands->GenerateMips(*textures[i]);
-            }
+                LLGL::Offset3D{ 0, 0, 0 },
+                LLGL::Extent3D{ config.textureSize, config.textureSize, 1 }
+            };
+            const auto imageDesc = uploadImage.GetSrcDesc();
+
+            RunCPUScenario(
+                "texture_upload", 1,
+                [this, region, imageDesc]()
+                {
+                    renderer->WriteTexture(*uploadTexture, region, imageDesc);
+                }
+            );
         }
 
-        void TestSubMIPMapGeneration()
+        void TestPipelineCreation()
         {
-            for (std::size_t i = 0; i < config.numTextures; ++i)
+            // Vary the depth state between the pipelines to bypass state caches in the backend
+            static const LLGL::CompareOp compareOps[] =
             {
-                commands->GenerateMips(*textures[config.numTextures + i], LLGL::TextureSubresource{ 0, config.numMipMaps });
-            }
+                LLGL::CompareOp::Less,
+                LLGL::CompareOp::LessEqual,
+                LLGL::CompareOp::Greater,
+                LLGL::CompareOp::GreaterEqual,
+            };
+
+            std::vector<LLGL::GraphicsPipeline*> pipelines;
+            pipelines.reserve(config.numPipelines);
+
+            RunCPUScenario(
+                "pipeline_creation", config.numPipelines,
+                [this, &pipelines]()
+                {
+                    for (std::uint32_t i = 0; i < config.numPipelines; ++i)
+                    {
+                        LLGL::GraphicsPipelineDescriptor pipelineDesc;
+                        {
+                            pipelineDesc.shaderProgram      = shaderProgram;
+                            pipelineDesc.pipelineLayout     = pipelineLayout;
+                            pipelineDesc.depth.testEnabled  = true;
+                            pipelineDesc.depth.compareOp    = compareOps[i % 4];
+                        }
+                        pipelines.push_back(renderer->CreateGraphicsPipeline(pipelineDesc));
+                    }
+
+                    // Release the pipelines again; kept inside the measurement, since creation and release always come in pairs
+                    for (auto p : pipelines)
+                        renderer->Release(*p);
+                    pipelines.clear();
+                }
+            );
+        }
+
+        void TestMIPMapGeneration()
+        {
+            RunGPUScenario(
+                "mip_map_generation", static_cast<std::uint32_t>(config.numTextures),
+                [this]()
+                {
+                    for (std::size_t i = 0; i < config.numTextures; ++i)
+                        commands->GenerateMips(*textures[i]);
+                }
+            );
         }
 
     public:
 
-        void Load(const std::string& rendererModule, const TestConfig& testConfig)
+        void Load(const TestConfig& testConfig)
         {
             // Store test configuration
             config = testConfig;
+            FastSRand(0);
 
             // Load renderer
-            renderer = LLGL::RenderSystem::Load(rendererModule);
+            renderer = LLGL::RenderSystem::Load(config.rendererModule);
 
             // Create render context
             LLGL::RenderContextDescriptor contextDesc;
@@ -171,53 +630,117 @@ class PerformanceTest
             commands = renderer->CreateCommandBuffer();
             commandQueue = renderer->GetCommandQueue();
 
-            // Create timer query
+            // Create timer query and CPU timer
             LLGL::QueryHeapDescriptor queryDesc;
             {
                 queryDesc.type = LLGL::QueryType::TimeElapsed;
             }
             timerQuery = renderer->CreateQueryHeap(queryDesc);
+            timer = LLGL::Timer::Create();
 
             // Create resources
-            CreateTextures(config.numTextures * 2);
+            CreateShadersAndPipelines();
+            CreateBuffersAndTextures();
         }
 
         void Run()
         {
-            std::cout << std::endl << "run performance tests ..." << std::endl;
+            std::cout << "run benchmarks with " << config.numRepeats << " repeats per scenario ..." << std::endl;
 
-            commands->Begin();
+            if (shaderProgram != nullptr)
             {
-                MeasureTime(
-                    ( "MIP-map generation of " + std::to_string(config.numTextures) + " textures with size " +
-                      std::to_string(config.textureSize) + " and " + std::to_string(config.arrayLayers) + " array layers" ),
-                    std::bind(&PerformanceTest::TestMIPMapGeneration, this)
-                );
-                MeasureTime(
-                    ( "MIP-map generation of " + std::to_string(config.numTextures) + " textures with size " +
-                      std::to_string(config.textureSize) + " and only first " + std::to_string(config.numMipMaps) + " MIP-maps of first array layer" ),
-                    std::bind(&PerformanceTest::TestSubMIPMapGeneration, this)
-                );
+                TestDrawCallThroughput();
+                TestResourceHeapSwitching();
+                TestPipelineCreation();
+            }
+            else
+                std::cerr << "shader compilation failed; skip draw call, resource heap, and pipeline scenarios" << std::endl;
+
+            TestBufferUpdateBandwidth();
+            TestBufferWriteBandwidth();
+            TestTextureUpload();
+            TestMIPMapGeneration();
+        }
+
+        void WriteReport()
+        {
+            if (config.outputFilename.empty())
+            {
+                if (config.outputFormat == "json")
+                    WriteResultsJSON(results, std::cout);
+                else
+                    WriteResultsCSV(results, std::cout);
+            }
+            else
+            {
+                std::ofstream file { config.outputFilename };
+                if (!file.good())
+                    throw std::runtime_error("failed to open file for writing: \"" + config.outputFilename + "\"");
+
+                if (config.outputFormat == "json")
+                    WriteResultsJSON(results, file);
+                else
+                    WriteResultsCSV(results, file);
+
+                std::cout << "wrote report to \"" << config.outputFilename << "\"" << std::endl;
             }
-            commands->End();
-            commandQueue->Submit(*commands);
         }
 
 };
 
-int main(int argc, char* argv[])
+static void PrintUsage()
 {
-    std::string rendererModule = "OpenGL";
+    std::cout << "usage: Test_Performance [RENDERER] [--repeats N] [--format csv|json] [--output FILE]" << std::endl;
+}
 
+int main(int argc, char* argv[])
+{
     TestConfig testConfig;
-    testConfig.numTextures  = 2;
-    testConfig.textureSize  = 512;
-    testConfig.arrayLayers  = 32;//512 or 32
-    testConfig.numMipMaps   = 3;
-
-    PerformanceTest test;
-    test.Load(rendererModule, testConfig);
-    test.Run();
+
+    // Parse command line arguments
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            PrintUsage();
+            return 0;
+        }
+        else if (arg == "--repeats" && i + 1 < argc)
+            testConfig.numRepeats = static_cast<std::size_t>(std::atoi(argv[++i]));
+        else if (arg == "--format" && i + 1 < argc)
+            testConfig.outputFormat = argv[++i];
+        else if (arg == "--output" && i + 1 < argc)
+            testConfig.outputFilename = argv[++i];
+        else if (!arg.empty() && arg[0] != '-')
+            testConfig.rendererModule = arg;
+        else
+        {
+            std::cerr << "unknown argument: " << arg << std::endl;
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    if (testConfig.outputFormat != "csv" && testConfig.outputFormat != "json")
+    {
+        std::cerr << "invalid output format: " << testConfig.outputFormat << std::endl;
+        PrintUsage();
+        return 1;
+    }
+
+    try
+    {
+        PerformanceTest test;
+        test.Load(testConfig);
+        test.Run();
+        test.WriteReport();
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
 
     #ifdef _WIN32
     system("pause");
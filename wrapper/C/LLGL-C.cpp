@@ -0,0 +1,1047 @@
+/*
+ * LLGL-C.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#define LLGL_C_EXPORT_BUILD
+#include "LLGL-C.h"
+
+#include <LLGL/LLGL.h>
+#include <string>
+#include <cstring>
+#include <memory>
+
+
+/*
+Every entry point catches all exceptions at the boundary and reports failures
+through return values, so no exception ever unwinds into foreign code.
+The message of the last failure is stored per thread for llglGetLastError().
+*/
+
+static thread_local std::string g_lastError;
+
+static void StoreLastError(const std::exception& e)
+{
+    g_lastError = e.what();
+}
+
+static void StoreLastError(const char* message)
+{
+    g_lastError = message;
+}
+
+/* ----- Handle conversion ----- */
+
+#define LLGL_C_HANDLE_CAST(TYPE, HANDLE) \
+    (reinterpret_cast<LLGL::TYPE*>(HANDLE))
+
+static LLGL::RenderSystem* GetNative(llglRenderSystem h)
+{
+    return LLGL_C_HANDLE_CAST(RenderSystem, h);
+}
+
+static LLGL::CommandBuffer* GetNative(llglCommandBuffer h)
+{
+    return LLGL_C_HANDLE_CAST(CommandBuffer, h);
+}
+
+/* ----- Descriptor conversion ----- */
+
+static LLGL::BufferDescriptor Convert(const LLGLBufferDescriptor& src)
+{
+    LLGL::BufferDescriptor dst;
+    {
+        dst.size            = src.size;
+        dst.bindFlags       = src.bindFlags;
+        dst.cpuAccessFlags  = src.cpuAccessFlags;
+        dst.miscFlags       = src.miscFlags;
+        dst.indexFormat     = static_cast<LLGL::Format>(src.indexFormat);
+
+        dst.vertexAttribs.reserve(src.numVertexAttribs);
+        for (size_t i = 0; i < src.numVertexAttribs; ++i)
+        {
+            const LLGLVertexAttribute& attrib = src.vertexAttribs[i];
+            LLGL::VertexAttribute nativeAttrib;
+            {
+                nativeAttrib.name               = (attrib.name != nullptr ? attrib.name : "");
+                nativeAttrib.format             = static_cast<LLGL::Format>(attrib.format);
+                nativeAttrib.location           = attrib.location;
+                nativeAttrib.semanticIndex      = attrib.semanticIndex;
+                nativeAttrib.slot               = attrib.slot;
+                nativeAttrib.offset             = attrib.offset;
+                nativeAttrib.stride             = attrib.stride;
+                nativeAttrib.instanceDivisor    = attrib.instanceDivisor;
+            }
+            dst.vertexAttribs.push_back(nativeAttrib);
+        }
+    }
+    return dst;
+}
+
+static LLGL::TextureDescriptor Convert(const LLGLTextureDescriptor& src)
+{
+    LLGL::TextureDescriptor dst;
+    {
+        dst.type            = static_cast<LLGL::TextureType>(src.type);
+        dst.bindFlags       = src.bindFlags;
+        dst.cpuAccessFlags  = src.cpuAccessFlags;
+        dst.miscFlags       = src.miscFlags;
+        dst.format          = static_cast<LLGL::Format>(src.format);
+        dst.extent          = { src.width, src.height, src.depth };
+        dst.arrayLayers     = src.arrayLayers;
+        dst.mipLevels       = src.mipLevels;
+        dst.samples         = src.samples;
+    }
+    return dst;
+}
+
+static LLGL::TextureRegion Convert(const LLGLTextureRegion& src)
+{
+    LLGL::TextureRegion dst;
+    {
+        dst.subresource.baseArrayLayer  = src.baseArrayLayer;
+        dst.subresource.numArrayLayers  = src.numArrayLayers;
+        dst.subresource.baseMipLevel    = src.baseMipLevel;
+        dst.subresource.numMipLevels    = src.numMipLevels;
+        dst.offset                      = { src.offsetX, src.offsetY, src.offsetZ };
+        dst.extent                      = { src.width, src.height, src.depth };
+    }
+    return dst;
+}
+
+static LLGL::SrcImageDescriptor Convert(const LLGLSrcImageDescriptor& src)
+{
+    LLGL::SrcImageDescriptor dst;
+    {
+        dst.format      = static_cast<LLGL::ImageFormat>(src.format);
+        dst.dataType    = static_cast<LLGL::DataType>(src.dataType);
+        dst.data        = src.data;
+        dst.dataSize    = src.dataSize;
+    }
+    return dst;
+}
+
+static LLGL::SamplerDescriptor Convert(const LLGLSamplerDescriptor& src)
+{
+    LLGL::SamplerDescriptor dst;
+    {
+        dst.addressModeU    = static_cast<LLGL::SamplerAddressMode>(src.addressModeU);
+        dst.addressModeV    = static_cast<LLGL::SamplerAddressMode>(src.addressModeV);
+        dst.addressModeW    = static_cast<LLGL::SamplerAddressMode>(src.addressModeW);
+        dst.minFilter       = static_cast<LLGL::SamplerFilter>(src.minFilter);
+        dst.magFilter       = static_cast<LLGL::SamplerFilter>(src.magFilter);
+        dst.mipMapFilter    = static_cast<LLGL::SamplerFilter>(src.mipMapFilter);
+        dst.mipMapping      = src.mipMapping;
+        dst.mipMapLODBias   = src.mipMapLODBias;
+        dst.minLOD          = src.minLOD;
+        dst.maxLOD          = src.maxLOD;
+        dst.maxAnisotropy   = src.maxAnisotropy;
+        dst.compareEnabled  = src.compareEnabled;
+        dst.compareOp       = static_cast<LLGL::CompareOp>(src.compareOp);
+        dst.borderColor     = { src.borderColor[0], src.borderColor[1], src.borderColor[2], src.borderColor[3] };
+    }
+    return dst;
+}
+
+static LLGL::ShaderDescriptor Convert(const LLGLShaderDescriptor& src)
+{
+    LLGL::ShaderDescriptor dst;
+    {
+        dst.type        = static_cast<LLGL::ShaderType>(src.type);
+        dst.source      = src.source;
+        dst.sourceSize  = src.sourceSize;
+        dst.sourceType  = static_cast<LLGL::ShaderSourceType>(src.sourceType);
+        dst.entryPoint  = src.entryPoint;
+        dst.profile     = src.profile;
+        dst.flags       = src.flags;
+    }
+    return dst;
+}
+
+static LLGL::ShaderProgramDescriptor Convert(const LLGLShaderProgramDescriptor& src)
+{
+    LLGL::ShaderProgramDescriptor dst;
+    {
+        dst.vertexShader            = LLGL_C_HANDLE_CAST(Shader, src.vertexShader);
+        dst.tessControlShader       = LLGL_C_HANDLE_CAST(Shader, src.tessControlShader);
+        dst.tessEvaluationShader    = LLGL_C_HANDLE_CAST(Shader, src.tessEvaluationShader);
+        dst.geometryShader          = LLGL_C_HANDLE_CAST(Shader, src.geometryShader);
+        dst.fragmentShader          = LLGL_C_HANDLE_CAST(Shader, src.fragmentShader);
+        dst.computeShader           = LLGL_C_HANDLE_CAST(Shader, src.computeShader);
+    }
+    return dst;
+}
+
+static LLGL::GraphicsPipelineDescriptor Convert(const LLGLGraphicsPipelineDescriptor& src)
+{
+    LLGL::GraphicsPipelineDescriptor dst;
+    {
+        dst.shaderProgram                   = LLGL_C_HANDLE_CAST(ShaderProgram, src.shaderProgram);
+        dst.pipelineLayout                  = LLGL_C_HANDLE_CAST(PipelineLayout, src.pipelineLayout);
+        dst.primitiveTopology               = static_cast<LLGL::PrimitiveTopology>(src.primitiveTopology);
+
+        dst.depth.testEnabled               = src.depthTestEnabled;
+        dst.depth.writeEnabled              = src.depthWriteEnabled;
+        if (src.depthTestEnabled)
+            dst.depth.compareOp             = static_cast<LLGL::CompareOp>(src.depthCompareOp);
+
+        dst.rasterizer.cullMode             = static_cast<LLGL::CullMode>(src.cullMode);
+        dst.rasterizer.polygonMode          = static_cast<LLGL::PolygonMode>(src.polygonMode);
+        dst.rasterizer.frontCCW             = src.frontCCW;
+        dst.rasterizer.scissorTestEnabled   = src.scissorTestEnabled;
+        if (src.multiSamples > 1)
+            dst.rasterizer.multiSampling    = LLGL::MultiSamplingDescriptor{ src.multiSamples };
+
+        if (src.blendEnabled)
+        {
+            dst.blend.targets[0].blendEnabled   = true;
+            dst.blend.targets[0].srcColor       = static_cast<LLGL::BlendOp>(src.blendSrcColor);
+            dst.blend.targets[0].dstColor       = static_cast<LLGL::BlendOp>(src.blendDstColor);
+            dst.blend.targets[0].srcAlpha       = static_cast<LLGL::BlendOp>(src.blendSrcAlpha);
+            dst.blend.targets[0].dstAlpha       = static_cast<LLGL::BlendOp>(src.blendDstAlpha);
+        }
+    }
+    return dst;
+}
+
+static LLGL::RenderContextDescriptor Convert(const LLGLRenderContextDescriptor& src)
+{
+    LLGL::RenderContextDescriptor dst;
+    {
+        dst.videoMode.resolution    = { src.width, src.height };
+        dst.videoMode.colorBits     = static_cast<int>(src.colorBits);
+        dst.videoMode.depthBits     = static_cast<int>(src.depthBits);
+        dst.videoMode.stencilBits   = static_cast<int>(src.stencilBits);
+        dst.videoMode.fullscreen    = src.fullscreen;
+        if (src.swapChainSize > 0)
+            dst.videoMode.swapChainSize = src.swapChainSize;
+        dst.vsync.enabled           = src.vsyncEnabled;
+        if (src.vsyncInterval > 0)
+            dst.vsync.interval      = src.vsyncInterval;
+        if (src.multiSamples > 1)
+            dst.multiSampling       = LLGL::MultiSamplingDescriptor{ src.multiSamples };
+    }
+    return dst;
+}
+
+/* ----- Error handling ----- */
+
+LLGL_C_API const char* llglGetLastError(void)
+{
+    return g_lastError.c_str();
+}
+
+/* ----- Render system ----- */
+
+LLGL_C_API llglRenderSystem llglLoadRenderSystem(const char* moduleName)
+{
+    try
+    {
+        if (moduleName == nullptr)
+        {
+            StoreLastError("llglLoadRenderSystem: module name must not be null");
+            return nullptr;
+        }
+        auto renderSystem = LLGL::RenderSystem::Load(moduleName);
+        return reinterpret_cast<llglRenderSystem>(renderSystem.release());
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglUnloadRenderSystem(llglRenderSystem renderSystem)
+{
+    if (renderSystem != nullptr)
+        LLGL::RenderSystem::Unload(std::unique_ptr<LLGL::RenderSystem>(GetNative(renderSystem)));
+}
+
+LLGL_C_API int llglGetRendererID(llglRenderSystem renderSystem)
+{
+    return GetNative(renderSystem)->GetRendererID();
+}
+
+LLGL_C_API const char* llglGetRendererName(llglRenderSystem renderSystem)
+{
+    return GetNative(renderSystem)->GetName().c_str();
+}
+
+/* ----- Render context ----- */
+
+LLGL_C_API llglRenderContext llglCreateRenderContext(llglRenderSystem renderSystem, const LLGLRenderContextDescriptor* desc)
+{
+    try
+    {
+        if (desc == nullptr)
+        {
+            StoreLastError("llglCreateRenderContext: descriptor must not be null");
+            return nullptr;
+        }
+        auto* renderContext = GetNative(renderSystem)->CreateRenderContext(Convert(*desc));
+        return reinterpret_cast<llglRenderContext>(renderContext);
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleaseRenderContext(llglRenderSystem renderSystem, llglRenderContext renderContext)
+{
+    GetNative(renderSystem)->Release(*LLGL_C_HANDLE_CAST(RenderContext, renderContext));
+}
+
+LLGL_C_API LLGLResult llglPresent(llglRenderContext renderContext)
+{
+    try
+    {
+        LLGL_C_HANDLE_CAST(RenderContext, renderContext)->Present();
+        return LLGL_RESULT_SUCCESS;
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return LLGL_RESULT_RUNTIME_ERROR;
+    }
+}
+
+/* ----- Command queue and command buffers ----- */
+
+LLGL_C_API llglCommandQueue llglGetCommandQueue(llglRenderSystem renderSystem)
+{
+    return reinterpret_cast<llglCommandQueue>(GetNative(renderSystem)->GetCommandQueue());
+}
+
+LLGL_C_API LLGLResult llglSubmitCommandBuffer(llglCommandQueue commandQueue, llglCommandBuffer commandBuffer)
+{
+    try
+    {
+        LLGL_C_HANDLE_CAST(CommandQueue, commandQueue)->Submit(*GetNative(commandBuffer));
+        return LLGL_RESULT_SUCCESS;
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return LLGL_RESULT_RUNTIME_ERROR;
+    }
+}
+
+LLGL_C_API LLGLResult llglWaitIdle(llglCommandQueue commandQueue)
+{
+    try
+    {
+        LLGL_C_HANDLE_CAST(CommandQueue, commandQueue)->WaitIdle();
+        return LLGL_RESULT_SUCCESS;
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return LLGL_RESULT_RUNTIME_ERROR;
+    }
+}
+
+LLGL_C_API llglCommandBuffer llglCreateCommandBuffer(llglRenderSystem renderSystem)
+{
+    try
+    {
+        return reinterpret_cast<llglCommandBuffer>(GetNative(renderSystem)->CreateCommandBuffer());
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleaseCommandBuffer(llglRenderSystem renderSystem, llglCommandBuffer commandBuffer)
+{
+    GetNative(renderSystem)->Release(*GetNative(commandBuffer));
+}
+
+/* ----- Buffers ----- */
+
+LLGL_C_API llglBuffer llglCreateBuffer(llglRenderSystem renderSystem, const LLGLBufferDescriptor* desc, const void* initialData)
+{
+    try
+    {
+        if (desc == nullptr)
+        {
+            StoreLastError("llglCreateBuffer: descriptor must not be null");
+            return nullptr;
+        }
+        auto* buffer = GetNative(renderSystem)->CreateBuffer(Convert(*desc), initialData);
+        return reinterpret_cast<llglBuffer>(buffer);
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleaseBuffer(llglRenderSystem renderSystem, llglBuffer buffer)
+{
+    GetNative(renderSystem)->Release(*LLGL_C_HANDLE_CAST(Buffer, buffer));
+}
+
+LLGL_C_API LLGLResult llglWriteBuffer(llglRenderSystem renderSystem, llglBuffer dstBuffer, uint64_t dstOffset, const void* data, uint64_t dataSize)
+{
+    try
+    {
+        GetNative(renderSystem)->WriteBuffer(*LLGL_C_HANDLE_CAST(Buffer, dstBuffer), dstOffset, data, dataSize);
+        return LLGL_RESULT_SUCCESS;
+    }
+    catch (const std::invalid_argument& e)
+    {
+        StoreLastError(e);
+        return LLGL_RESULT_INVALID_ARGUMENT;
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return LLGL_RESULT_RUNTIME_ERROR;
+    }
+}
+
+LLGL_C_API LLGLResult llglMapBuffer(llglRenderSystem renderSystem, llglBuffer buffer, LLGLCPUAccess access, void** outData)
+{
+    try
+    {
+        if (outData == nullptr)
+        {
+            StoreLastError("llglMapBuffer: output pointer must not be null");
+            return LLGL_RESULT_INVALID_ARGUMENT;
+        }
+        *outData = GetNative(renderSystem)->MapBuffer(*LLGL_C_HANDLE_CAST(Buffer, buffer), static_cast<LLGL::CPUAccess>(access));
+        return LLGL_RESULT_SUCCESS;
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return LLGL_RESULT_RUNTIME_ERROR;
+    }
+}
+
+LLGL_C_API void llglUnmapBuffer(llglRenderSystem renderSystem, llglBuffer buffer)
+{
+    GetNative(renderSystem)->UnmapBuffer(*LLGL_C_HANDLE_CAST(Buffer, buffer));
+}
+
+/* ----- Textures ----- */
+
+LLGL_C_API llglTexture llglCreateTexture(llglRenderSystem renderSystem, const LLGLTextureDescriptor* desc, const LLGLSrcImageDescriptor* imageDesc)
+{
+    try
+    {
+        if (desc == nullptr)
+        {
+            StoreLastError("llglCreateTexture: descriptor must not be null");
+            return nullptr;
+        }
+        LLGL::Texture* texture = nullptr;
+        if (imageDesc != nullptr)
+        {
+            const auto nativeImageDesc = Convert(*imageDesc);
+            texture = GetNative(renderSystem)->CreateTexture(Convert(*desc), &nativeImageDesc);
+        }
+        else
+            texture = GetNative(renderSystem)->CreateTexture(Convert(*desc));
+        return reinterpret_cast<llglTexture>(texture);
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleaseTexture(llglRenderSystem renderSystem, llglTexture texture)
+{
+    GetNative(renderSystem)->Release(*LLGL_C_HANDLE_CAST(Texture, texture));
+}
+
+LLGL_C_API LLGLResult llglWriteTexture(llglRenderSystem renderSystem, llglTexture texture, const LLGLTextureRegion* region, const LLGLSrcImageDescriptor* imageDesc)
+{
+    try
+    {
+        if (region == nullptr || imageDesc == nullptr)
+        {
+            StoreLastError("llglWriteTexture: region and image descriptor must not be null");
+            return LLGL_RESULT_INVALID_ARGUMENT;
+        }
+        GetNative(renderSystem)->WriteTexture(*LLGL_C_HANDLE_CAST(Texture, texture), Convert(*region), Convert(*imageDesc));
+        return LLGL_RESULT_SUCCESS;
+    }
+    catch (const std::invalid_argument& e)
+    {
+        StoreLastError(e);
+        return LLGL_RESULT_INVALID_ARGUMENT;
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return LLGL_RESULT_RUNTIME_ERROR;
+    }
+}
+
+/* ----- Samplers ----- */
+
+LLGL_C_API llglSampler llglCreateSampler(llglRenderSystem renderSystem, const LLGLSamplerDescriptor* desc)
+{
+    try
+    {
+        if (desc == nullptr)
+        {
+            StoreLastError("llglCreateSampler: descriptor must not be null");
+            return nullptr;
+        }
+        return reinterpret_cast<llglSampler>(GetNative(renderSystem)->CreateSampler(Convert(*desc)));
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleaseSampler(llglRenderSystem renderSystem, llglSampler sampler)
+{
+    GetNative(renderSystem)->Release(*LLGL_C_HANDLE_CAST(Sampler, sampler));
+}
+
+/* ----- Resource handles ----- */
+
+LLGL_C_API llglResource llglGetBufferResource(llglBuffer buffer)
+{
+    return reinterpret_cast<llglResource>(static_cast<LLGL::Resource*>(LLGL_C_HANDLE_CAST(Buffer, buffer)));
+}
+
+LLGL_C_API llglResource llglGetTextureResource(llglTexture texture)
+{
+    return reinterpret_cast<llglResource>(static_cast<LLGL::Resource*>(LLGL_C_HANDLE_CAST(Texture, texture)));
+}
+
+LLGL_C_API llglResource llglGetSamplerResource(llglSampler sampler)
+{
+    return reinterpret_cast<llglResource>(static_cast<LLGL::Resource*>(LLGL_C_HANDLE_CAST(Sampler, sampler)));
+}
+
+/* ----- Pipeline layouts and resource heaps ----- */
+
+LLGL_C_API llglPipelineLayout llglCreatePipelineLayout(llglRenderSystem renderSystem, const LLGLBindingDescriptor* bindings, size_t numBindings)
+{
+    try
+    {
+        LLGL::PipelineLayoutDescriptor nativeDesc;
+        nativeDesc.bindings.reserve(numBindings);
+        for (size_t i = 0; i < numBindings; ++i)
+        {
+            const LLGLBindingDescriptor& binding = bindings[i];
+            nativeDesc.bindings.push_back(
+                LLGL::BindingDescriptor
+                {
+                    static_cast<LLGL::ResourceType>(binding.type),
+                    binding.bindFlags,
+                    binding.stageFlags,
+                    binding.slot,
+                    binding.arraySize
+                }
+            );
+        }
+        return reinterpret_cast<llglPipelineLayout>(GetNative(renderSystem)->CreatePipelineLayout(nativeDesc));
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleasePipelineLayout(llglRenderSystem renderSystem, llglPipelineLayout pipelineLayout)
+{
+    GetNative(renderSystem)->Release(*LLGL_C_HANDLE_CAST(PipelineLayout, pipelineLayout));
+}
+
+LLGL_C_API llglResourceHeap llglCreateResourceHeap(llglRenderSystem renderSystem, llglPipelineLayout pipelineLayout, const llglResource* resources, size_t numResources)
+{
+    try
+    {
+        LLGL::ResourceHeapDescriptor nativeDesc;
+        nativeDesc.pipelineLayout = LLGL_C_HANDLE_CAST(PipelineLayout, pipelineLayout);
+        nativeDesc.resourceViews.reserve(numResources);
+        for (size_t i = 0; i < numResources; ++i)
+            nativeDesc.resourceViews.push_back(LLGL::ResourceViewDescriptor{ LLGL_C_HANDLE_CAST(Resource, resources[i]) });
+        return reinterpret_cast<llglResourceHeap>(GetNative(renderSystem)->CreateResourceHeap(nativeDesc));
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleaseResourceHeap(llglRenderSystem renderSystem, llglResourceHeap resourceHeap)
+{
+    GetNative(renderSystem)->Release(*LLGL_C_HANDLE_CAST(ResourceHeap, resourceHeap));
+}
+
+/* ----- Shaders and shader programs ----- */
+
+LLGL_C_API llglShader llglCreateShader(llglRenderSystem renderSystem, const LLGLShaderDescriptor* desc)
+{
+    try
+    {
+        if (desc == nullptr)
+        {
+            StoreLastError("llglCreateShader: descriptor must not be null");
+            return nullptr;
+        }
+        return reinterpret_cast<llglShader>(GetNative(renderSystem)->CreateShader(Convert(*desc)));
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleaseShader(llglRenderSystem renderSystem, llglShader shader)
+{
+    GetNative(renderSystem)->Release(*LLGL_C_HANDLE_CAST(Shader, shader));
+}
+
+LLGL_C_API bool llglHasShaderErrors(llglShader shader)
+{
+    return LLGL_C_HANDLE_CAST(Shader, shader)->HasErrors();
+}
+
+// Copies the report string into the output buffer with truncation; returns the full report length
+static size_t CopyReport(const std::string& report, char* output, size_t outputSize)
+{
+    if (output != nullptr && outputSize > 0)
+    {
+        const size_t copySize = (report.size() < outputSize - 1 ? report.size() : outputSize - 1);
+        std::memcpy(output, report.c_str(), copySize);
+        output[copySize] = '\0';
+    }
+    return report.size();
+}
+
+LLGL_C_API size_t llglGetShaderReport(llglShader shader, char* output, size_t outputSize)
+{
+    return CopyReport(LLGL_C_HANDLE_CAST(Shader, shader)->GetReport(), output, outputSize);
+}
+
+LLGL_C_API llglShaderProgram llglCreateShaderProgram(llglRenderSystem renderSystem, const LLGLShaderProgramDescriptor* desc)
+{
+    try
+    {
+        if (desc == nullptr)
+        {
+            StoreLastError("llglCreateShaderProgram: descriptor must not be null");
+            return nullptr;
+        }
+        return reinterpret_cast<llglShaderProgram>(GetNative(renderSystem)->CreateShaderProgram(Convert(*desc)));
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleaseShaderProgram(llglRenderSystem renderSystem, llglShaderProgram shaderProgram)
+{
+    GetNative(renderSystem)->Release(*LLGL_C_HANDLE_CAST(ShaderProgram, shaderProgram));
+}
+
+LLGL_C_API bool llglHasShaderProgramErrors(llglShaderProgram shaderProgram)
+{
+    return LLGL_C_HANDLE_CAST(ShaderProgram, shaderProgram)->HasErrors();
+}
+
+LLGL_C_API size_t llglGetShaderProgramReport(llglShaderProgram shaderProgram, char* output, size_t outputSize)
+{
+    return CopyReport(LLGL_C_HANDLE_CAST(ShaderProgram, shaderProgram)->GetReport(), output, outputSize);
+}
+
+/* ----- Pipeline states ----- */
+
+LLGL_C_API llglGraphicsPipeline llglCreateGraphicsPipeline(llglRenderSystem renderSystem, const LLGLGraphicsPipelineDescriptor* desc)
+{
+    try
+    {
+        if (desc == nullptr)
+        {
+            StoreLastError("llglCreateGraphicsPipeline: descriptor must not be null");
+            return nullptr;
+        }
+        return reinterpret_cast<llglGraphicsPipeline>(GetNative(renderSystem)->CreateGraphicsPipeline(Convert(*desc)));
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleaseGraphicsPipeline(llglRenderSystem renderSystem, llglGraphicsPipeline graphicsPipeline)
+{
+    GetNative(renderSystem)->Release(*LLGL_C_HANDLE_CAST(GraphicsPipeline, graphicsPipeline));
+}
+
+LLGL_C_API llglComputePipeline llglCreateComputePipeline(llglRenderSystem renderSystem, const LLGLComputePipelineDescriptor* desc)
+{
+    try
+    {
+        if (desc == nullptr)
+        {
+            StoreLastError("llglCreateComputePipeline: descriptor must not be null");
+            return nullptr;
+        }
+        LLGL::ComputePipelineDescriptor nativeDesc;
+        nativeDesc.shaderProgram    = LLGL_C_HANDLE_CAST(ShaderProgram, desc->shaderProgram);
+        nativeDesc.pipelineLayout   = LLGL_C_HANDLE_CAST(PipelineLayout, desc->pipelineLayout);
+        return reinterpret_cast<llglComputePipeline>(GetNative(renderSystem)->CreateComputePipeline(nativeDesc));
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return nullptr;
+    }
+}
+
+LLGL_C_API void llglReleaseComputePipeline(llglRenderSystem renderSystem, llglComputePipeline computePipeline)
+{
+    GetNative(renderSystem)->Release(*LLGL_C_HANDLE_CAST(ComputePipeline, computePipeline));
+}
+
+/* ----- Command buffer encoding ----- */
+
+LLGL_C_API LLGLResult llglBegin(llglCommandBuffer commandBuffer)
+{
+    try
+    {
+        GetNative(commandBuffer)->Begin();
+        return LLGL_RESULT_SUCCESS;
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return LLGL_RESULT_RUNTIME_ERROR;
+    }
+}
+
+LLGL_C_API LLGLResult llglEnd(llglCommandBuffer commandBuffer)
+{
+    try
+    {
+        GetNative(commandBuffer)->End();
+        return LLGL_RESULT_SUCCESS;
+    }
+    catch (const std::exception& e)
+    {
+        StoreLastError(e);
+        return LLGL_RESULT_RUNTIME_ERROR;
+    }
+}
+
+LLGL_C_API void llglBeginRenderPass(llglCommandBuffer commandBuffer, llglRenderContext renderContext)
+{
+    GetNative(commandBuffer)->BeginRenderPass(*LLGL_C_HANDLE_CAST(RenderContext, renderContext));
+}
+
+LLGL_C_API void llglEndRenderPass(llglCommandBuffer commandBuffer)
+{
+    GetNative(commandBuffer)->EndRenderPass();
+}
+
+LLGL_C_API void llglSetViewport(llglCommandBuffer commandBuffer, const LLGLViewport* viewport)
+{
+    GetNative(commandBuffer)->SetViewport(
+        LLGL::Viewport{ viewport->x, viewport->y, viewport->width, viewport->height, viewport->minDepth, viewport->maxDepth }
+    );
+}
+
+LLGL_C_API void llglSetScissor(llglCommandBuffer commandBuffer, const LLGLScissor* scissor)
+{
+    GetNative(commandBuffer)->SetScissor(
+        LLGL::Scissor{ scissor->x, scissor->y, scissor->width, scissor->height }
+    );
+}
+
+LLGL_C_API void llglSetClearColor(llglCommandBuffer commandBuffer, float r, float g, float b, float a)
+{
+    GetNative(commandBuffer)->SetClearColor({ r, g, b, a });
+}
+
+LLGL_C_API void llglSetClearDepth(llglCommandBuffer commandBuffer, float depth)
+{
+    GetNative(commandBuffer)->SetClearDepth(depth);
+}
+
+LLGL_C_API void llglSetClearStencil(llglCommandBuffer commandBuffer, uint32_t stencil)
+{
+    GetNative(commandBuffer)->SetClearStencil(stencil);
+}
+
+LLGL_C_API void llglClear(llglCommandBuffer commandBuffer, long flags)
+{
+    GetNative(commandBuffer)->Clear(flags);
+}
+
+LLGL_C_API void llglSetVertexBuffer(llglCommandBuffer commandBuffer, llglBuffer buffer)
+{
+    GetNative(commandBuffer)->SetVertexBuffer(*LLGL_C_HANDLE_CAST(Buffer, buffer));
+}
+
+LLGL_C_API void llglSetIndexBuffer(llglCommandBuffer commandBuffer, llglBuffer buffer)
+{
+    GetNative(commandBuffer)->SetIndexBuffer(*LLGL_C_HANDLE_CAST(Buffer, buffer));
+}
+
+LLGL_C_API void llglSetGraphicsPipeline(llglCommandBuffer commandBuffer, llglGraphicsPipeline graphicsPipeline)
+{
+    GetNative(commandBuffer)->SetGraphicsPipeline(*LLGL_C_HANDLE_CAST(GraphicsPipeline, graphicsPipeline));
+}
+
+LLGL_C_API void llglSetComputePipeline(llglCommandBuffer commandBuffer, llglComputePipeline computePipeline)
+{
+    GetNative(commandBuffer)->SetComputePipeline(*LLGL_C_HANDLE_CAST(ComputePipeline, computePipeline));
+}
+
+LLGL_C_API void llglSetGraphicsResourceHeap(llglCommandBuffer commandBuffer, llglResourceHeap resourceHeap, uint32_t firstSet)
+{
+    GetNative(commandBuffer)->SetGraphicsResourceHeap(*LLGL_C_HANDLE_CAST(ResourceHeap, resourceHeap), firstSet);
+}
+
+LLGL_C_API void llglSetComputeResourceHeap(llglCommandBuffer commandBuffer, llglResourceHeap resourceHeap, uint32_t firstSet)
+{
+    GetNative(commandBuffer)->SetComputeResourceHeap(*LLGL_C_HANDLE_CAST(ResourceHeap, resourceHeap), firstSet);
+}
+
+LLGL_C_API void llglDraw(llglCommandBuffer commandBuffer, uint32_t numVertices, uint32_t firstVertex)
+{
+    GetNative(commandBuffer)->Draw(numVertices, firstVertex);
+}
+
+LLGL_C_API void llglDrawIndexed(llglCommandBuffer commandBuffer, uint32_t numIndices, uint32_t firstIndex, int32_t vertexOffset)
+{
+    GetNative(commandBuffer)->DrawIndexed(numIndices, firstIndex, vertexOffset);
+}
+
+LLGL_C_API void llglDrawInstanced(llglCommandBuffer commandBuffer, uint32_t numVertices, uint32_t firstVertex, uint32_t numInstances, uint32_t firstInstance)
+{
+    GetNative(commandBuffer)->DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+}
+
+LLGL_C_API void llglDrawIndexedInstanced(llglCommandBuffer commandBuffer, uint32_t numIndices, uint32_t numInstances, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance)
+{
+    GetNative(commandBuffer)->DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+}
+
+LLGL_C_API void llglDispatch(llglCommandBuffer commandBuffer, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ)
+{
+    GetNative(commandBuffer)->Dispatch(groupSizeX, groupSizeY, groupSizeZ);
+}
+
+/* ----- Batched command encoding ----- */
+
+LLGL_C_API size_t llglExecuteCommandBatch(llglCommandBuffer commandBuffer, const uint32_t* tokens, size_t numTokens)
+{
+    auto& cmdBuffer = *GetNative(commandBuffer);
+
+    const uint32_t* it  = tokens;
+    const uint32_t* end = tokens + numTokens;
+
+    size_t numCommands = 0;
+
+    // Reads the next token as unsigned integer
+    auto NextUInt = [&it]() -> uint32_t
+    {
+        return *it++;
+    };
+
+    // Reads the next token as IEEE-754 bit pattern
+    auto NextFloat = [&it]() -> float
+    {
+        union
+        {
+            uint32_t    u32;
+            float       f32;
+        }
+        value;
+        value.u32 = *it++;
+        return value.f32;
+    };
+
+    // Reads the next two tokens as pointer (low word first)
+    auto NextPointer = [&it]() -> void*
+    {
+        const uint32_t lo = *it++;
+        const uint32_t hi = *it++;
+        return reinterpret_cast<void*>(static_cast<uintptr_t>((static_cast<uint64_t>(hi) << 32) | lo));
+    };
+
+    while (it != end)
+    {
+        const auto opcode = static_cast<LLGLCmdOpcode>(NextUInt());
+        switch (opcode)
+        {
+            case LLGL_CMD_SET_VIEWPORT:
+            {
+                const float x           = NextFloat();
+                const float y           = NextFloat();
+                const float width       = NextFloat();
+                const float height      = NextFloat();
+                const float minDepth    = NextFloat();
+                const float maxDepth    = NextFloat();
+                cmdBuffer.SetViewport(LLGL::Viewport{ x, y, width, height, minDepth, maxDepth });
+            }
+            break;
+
+            case LLGL_CMD_SET_SCISSOR:
+            {
+                const auto x        = static_cast<int32_t>(NextUInt());
+                const auto y        = static_cast<int32_t>(NextUInt());
+                const auto width    = static_cast<int32_t>(NextUInt());
+                const auto height   = static_cast<int32_t>(NextUInt());
+                cmdBuffer.SetScissor(LLGL::Scissor{ x, y, width, height });
+            }
+            break;
+
+            case LLGL_CMD_SET_CLEAR_COLOR:
+            {
+                const float r = NextFloat();
+                const float g = NextFloat();
+                const float b = NextFloat();
+                const float a = NextFloat();
+                cmdBuffer.SetClearColor({ r, g, b, a });
+            }
+            break;
+
+            case LLGL_CMD_SET_CLEAR_DEPTH:
+            {
+                cmdBuffer.SetClearDepth(NextFloat());
+            }
+            break;
+
+            case LLGL_CMD_SET_CLEAR_STENCIL:
+            {
+                cmdBuffer.SetClearStencil(NextUInt());
+            }
+            break;
+
+            case LLGL_CMD_CLEAR:
+            {
+                cmdBuffer.Clear(static_cast<long>(NextUInt()));
+            }
+            break;
+
+            case LLGL_CMD_SET_VERTEX_BUFFER:
+            {
+                cmdBuffer.SetVertexBuffer(*reinterpret_cast<LLGL::Buffer*>(NextPointer()));
+            }
+            break;
+
+            case LLGL_CMD_SET_INDEX_BUFFER:
+            {
+                cmdBuffer.SetIndexBuffer(*reinterpret_cast<LLGL::Buffer*>(NextPointer()));
+            }
+            break;
+
+            case LLGL_CMD_SET_GRAPHICS_RESOURCE_HEAP:
+            {
+                auto* resourceHeap = reinterpret_cast<LLGL::ResourceHeap*>(NextPointer());
+                cmdBuffer.SetGraphicsResourceHeap(*resourceHeap, NextUInt());
+            }
+            break;
+
+            case LLGL_CMD_SET_COMPUTE_RESOURCE_HEAP:
+            {
+                auto* resourceHeap = reinterpret_cast<LLGL::ResourceHeap*>(NextPointer());
+                cmdBuffer.SetComputeResourceHeap(*resourceHeap, NextUInt());
+            }
+            break;
+
+            case LLGL_CMD_SET_GRAPHICS_PIPELINE:
+            {
+                cmdBuffer.SetGraphicsPipeline(*reinterpret_cast<LLGL::GraphicsPipeline*>(NextPointer()));
+            }
+            break;
+
+            case LLGL_CMD_SET_COMPUTE_PIPELINE:
+            {
+                cmdBuffer.SetComputePipeline(*reinterpret_cast<LLGL::ComputePipeline*>(NextPointer()));
+            }
+            break;
+
+            case LLGL_CMD_END_RENDER_PASS:
+            {
+                cmdBuffer.EndRenderPass();
+            }
+            break;
+
+            case LLGL_CMD_DRAW:
+            {
+                const auto numVertices = NextUInt();
+                cmdBuffer.Draw(numVertices, NextUInt());
+            }
+            break;
+
+            case LLGL_CMD_DRAW_INDEXED:
+            {
+                const auto numIndices   = NextUInt();
+                const auto firstIndex   = NextUInt();
+                cmdBuffer.DrawIndexed(numIndices, firstIndex, static_cast<int32_t>(NextUInt()));
+            }
+            break;
+
+            case LLGL_CMD_DRAW_INSTANCED:
+            {
+                const auto numVertices  = NextUInt();
+                const auto firstVertex  = NextUInt();
+                const auto numInstances = NextUInt();
+                cmdBuffer.DrawInstanced(numVertices, firstVertex, numInstances, NextUInt());
+            }
+            break;
+
+            case LLGL_CMD_DRAW_INDEXED_INSTANCED:
+            {
+                const auto numIndices   = NextUInt();
+                const auto numInstances = NextUInt();
+                const auto firstIndex   = NextUInt();
+                const auto vertexOffset = static_cast<int32_t>(NextUInt());
+                cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, NextUInt());
+            }
+            break;
+
+            case LLGL_CMD_DISPATCH:
+            {
+                const auto groupSizeX = NextUInt();
+                const auto groupSizeY = NextUInt();
+                cmdBuffer.Dispatch(groupSizeX, groupSizeY, NextUInt());
+            }
+            break;
+
+            default:
+            {
+                // Unknown opcode: stop decoding to avoid misinterpreting the remaining tokens
+                StoreLastError("llglExecuteCommandBatch: unknown command opcode");
+                return numCommands;
+            }
+        }
+        ++numCommands;
+    }
+
+    return numCommands;
+}
+
+
+
+// ================================================================================
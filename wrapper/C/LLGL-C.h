@@ -0,0 +1,488 @@
+/*
+ * LLGL-C.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef LLGL_C_H
+#define LLGL_C_H
+
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#if defined _WIN32
+#   ifdef LLGL_C_EXPORT_BUILD
+#       define LLGL_C_API __declspec(dllexport)
+#   else
+#       define LLGL_C_API __declspec(dllimport)
+#   endif
+#else
+#   define LLGL_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+Flat C99 API layer over the LLGL render system, designed for cheap FFI:
+all entry points are plain functions over opaque handles, all descriptors are POD,
+and no exception ever crosses the boundary - failures return LLGL_RESULT codes or null handles,
+with the message of the last failure available via llglGetLastError().
+This layer covers the resource and command hot path; rarely called C++ interfaces
+(render target attachments, queries, stream outputs) are intentionally not exposed here.
+*/
+
+/* ----- Handles ----- */
+
+typedef struct llglRenderSystemObject*      llglRenderSystem;
+typedef struct llglRenderContextObject*     llglRenderContext;
+typedef struct llglCommandQueueObject*      llglCommandQueue;
+typedef struct llglCommandBufferObject*     llglCommandBuffer;
+typedef struct llglBufferObject*            llglBuffer;
+typedef struct llglTextureObject*           llglTexture;
+typedef struct llglSamplerObject*           llglSampler;
+typedef struct llglShaderObject*            llglShader;
+typedef struct llglShaderProgramObject*     llglShaderProgram;
+typedef struct llglPipelineLayoutObject*    llglPipelineLayout;
+typedef struct llglResourceHeapObject*      llglResourceHeap;
+typedef struct llglGraphicsPipelineObject*  llglGraphicsPipeline;
+typedef struct llglComputePipelineObject*   llglComputePipeline;
+typedef struct llglResourceObject*          llglResource;
+
+/* ----- Enumerations and flags ----- */
+
+/* Result codes returned by all fallible entry points */
+typedef enum LLGLResult
+{
+    LLGL_RESULT_SUCCESS = 0,
+    LLGL_RESULT_INVALID_ARGUMENT,
+    LLGL_RESULT_RUNTIME_ERROR,
+}
+LLGLResult;
+
+/* Mirrors LLGL::ShaderType */
+typedef enum LLGLShaderType
+{
+    LLGL_SHADER_TYPE_UNDEFINED = 0,
+    LLGL_SHADER_TYPE_VERTEX,
+    LLGL_SHADER_TYPE_TESS_CONTROL,
+    LLGL_SHADER_TYPE_TESS_EVALUATION,
+    LLGL_SHADER_TYPE_GEOMETRY,
+    LLGL_SHADER_TYPE_FRAGMENT,
+    LLGL_SHADER_TYPE_COMPUTE,
+}
+LLGLShaderType;
+
+/* Mirrors LLGL::ShaderSourceType */
+typedef enum LLGLShaderSourceType
+{
+    LLGL_SHADER_SOURCE_TYPE_CODE_STRING = 0,
+    LLGL_SHADER_SOURCE_TYPE_CODE_FILE,
+    LLGL_SHADER_SOURCE_TYPE_BINARY_BUFFER,
+    LLGL_SHADER_SOURCE_TYPE_BINARY_FILE,
+}
+LLGLShaderSourceType;
+
+/* Mirrors LLGL::CPUAccess */
+typedef enum LLGLCPUAccess
+{
+    LLGL_CPU_ACCESS_READ_ONLY = 0,
+    LLGL_CPU_ACCESS_WRITE_ONLY,
+    LLGL_CPU_ACCESS_WRITE_DISCARD,
+    LLGL_CPU_ACCESS_READ_WRITE,
+}
+LLGLCPUAccess;
+
+/* Mirrors LLGL::BindFlags */
+enum
+{
+    LLGL_BIND_VERTEX_BUFFER             = (1 << 0),
+    LLGL_BIND_INDEX_BUFFER              = (1 << 1),
+    LLGL_BIND_CONSTANT_BUFFER           = (1 << 2),
+    LLGL_BIND_STREAM_OUTPUT_BUFFER      = (1 << 3),
+    LLGL_BIND_INDIRECT_BUFFER           = (1 << 4),
+    LLGL_BIND_SAMPLED                   = (1 << 5),
+    LLGL_BIND_STORAGE                   = (1 << 6),
+    LLGL_BIND_COLOR_ATTACHMENT          = (1 << 7),
+    LLGL_BIND_DEPTH_STENCIL_ATTACHMENT  = (1 << 8),
+    LLGL_BIND_COMBINED_TEXTURE_SAMPLER  = (1 << 9),
+};
+
+/* Mirrors LLGL::CPUAccessFlags */
+enum
+{
+    LLGL_CPU_ACCESS_FLAG_READ   = (1 << 0),
+    LLGL_CPU_ACCESS_FLAG_WRITE  = (1 << 1),
+};
+
+/* Mirrors LLGL::ClearFlags */
+enum
+{
+    LLGL_CLEAR_COLOR    = (1 << 0),
+    LLGL_CLEAR_DEPTH    = (1 << 1),
+    LLGL_CLEAR_STENCIL  = (1 << 2),
+    LLGL_CLEAR_ALL      = (LLGL_CLEAR_COLOR | LLGL_CLEAR_DEPTH | LLGL_CLEAR_STENCIL),
+};
+
+/* ----- Structures ----- */
+
+/* POD mirror of LLGL::VertexAttribute; 'format' takes an LLGL::Format value */
+typedef struct LLGLVertexAttribute
+{
+    const char* name;
+    uint32_t    format;
+    uint32_t    location;
+    uint32_t    semanticIndex;
+    uint32_t    slot;
+    uint32_t    offset;
+    uint32_t    stride;
+    uint32_t    instanceDivisor;
+}
+LLGLVertexAttribute;
+
+/* POD mirror of LLGL::BufferDescriptor; 'indexFormat' takes an LLGL::Format value */
+typedef struct LLGLBufferDescriptor
+{
+    uint64_t                    size;
+    long                        bindFlags;
+    long                        cpuAccessFlags;
+    long                        miscFlags;
+    const LLGLVertexAttribute*  vertexAttribs;
+    size_t                      numVertexAttribs;
+    uint32_t                    indexFormat;
+}
+LLGLBufferDescriptor;
+
+/* POD mirror of LLGL::TextureDescriptor; 'type' takes an LLGL::TextureType value and 'format' an LLGL::Format value */
+typedef struct LLGLTextureDescriptor
+{
+    uint32_t    type;
+    long        bindFlags;
+    long        cpuAccessFlags;
+    long        miscFlags;
+    uint32_t    format;
+    uint32_t    width;
+    uint32_t    height;
+    uint32_t    depth;
+    uint32_t    arrayLayers;
+    uint32_t    mipLevels;
+    uint32_t    samples;
+}
+LLGLTextureDescriptor;
+
+/* POD mirror of LLGL::TextureRegion */
+typedef struct LLGLTextureRegion
+{
+    uint32_t    baseArrayLayer;
+    uint32_t    numArrayLayers;
+    uint32_t    baseMipLevel;
+    uint32_t    numMipLevels;
+    int32_t     offsetX, offsetY, offsetZ;
+    uint32_t    width, height, depth;
+}
+LLGLTextureRegion;
+
+/* POD mirror of LLGL::SrcImageDescriptor; 'format' takes an LLGL::ImageFormat value and 'dataType' an LLGL::DataType value */
+typedef struct LLGLSrcImageDescriptor
+{
+    uint32_t    format;
+    uint32_t    dataType;
+    const void* data;
+    size_t      dataSize;
+}
+LLGLSrcImageDescriptor;
+
+/* POD mirror of LLGL::SamplerDescriptor; enumeration fields take the respective LLGL enum values */
+typedef struct LLGLSamplerDescriptor
+{
+    uint32_t    addressModeU;
+    uint32_t    addressModeV;
+    uint32_t    addressModeW;
+    uint32_t    minFilter;
+    uint32_t    magFilter;
+    uint32_t    mipMapFilter;
+    bool        mipMapping;
+    float       mipMapLODBias;
+    float       minLOD;
+    float       maxLOD;
+    uint32_t    maxAnisotropy;
+    bool        compareEnabled;
+    uint32_t    compareOp;
+    float       borderColor[4];
+}
+LLGLSamplerDescriptor;
+
+/* POD mirror of LLGL::ShaderDescriptor */
+typedef struct LLGLShaderDescriptor
+{
+    LLGLShaderType          type;
+    const char*             source;
+    size_t                  sourceSize;
+    LLGLShaderSourceType    sourceType;
+    const char*             entryPoint;
+    const char*             profile;
+    long                    flags;
+}
+LLGLShaderDescriptor;
+
+/* POD mirror of LLGL::ShaderProgramDescriptor; unused shader stages must be null */
+typedef struct LLGLShaderProgramDescriptor
+{
+    llglShader  vertexShader;
+    llglShader  tessControlShader;
+    llglShader  tessEvaluationShader;
+    llglShader  geometryShader;
+    llglShader  fragmentShader;
+    llglShader  computeShader;
+}
+LLGLShaderProgramDescriptor;
+
+/* POD mirror of LLGL::BindingDescriptor; 'type' takes an LLGL::ResourceType value */
+typedef struct LLGLBindingDescriptor
+{
+    uint32_t    type;
+    long        bindFlags;
+    long        stageFlags;
+    uint32_t    slot;
+    uint32_t    arraySize;
+}
+LLGLBindingDescriptor;
+
+/*
+Reduced POD mirror of LLGL::GraphicsPipelineDescriptor covering the commonly used subset;
+enumeration fields take the respective LLGL enum values, omitted states keep their native defaults.
+*/
+typedef struct LLGLGraphicsPipelineDescriptor
+{
+    llglShaderProgram   shaderProgram;
+    llglPipelineLayout  pipelineLayout;
+    uint32_t            primitiveTopology;
+    bool                depthTestEnabled;
+    bool                depthWriteEnabled;
+    uint32_t            depthCompareOp;
+    uint32_t            cullMode;
+    uint32_t            polygonMode;
+    bool                frontCCW;
+    bool                scissorTestEnabled;
+    uint32_t            multiSamples;
+    bool                blendEnabled;
+    uint32_t            blendSrcColor;
+    uint32_t            blendDstColor;
+    uint32_t            blendSrcAlpha;
+    uint32_t            blendDstAlpha;
+}
+LLGLGraphicsPipelineDescriptor;
+
+/* POD mirror of LLGL::ComputePipelineDescriptor */
+typedef struct LLGLComputePipelineDescriptor
+{
+    llglShaderProgram   shaderProgram;
+    llglPipelineLayout  pipelineLayout;
+}
+LLGLComputePipelineDescriptor;
+
+/* POD mirror of LLGL::RenderContextDescriptor covering the video mode and vsync */
+typedef struct LLGLRenderContextDescriptor
+{
+    uint32_t    width;
+    uint32_t    height;
+    uint32_t    colorBits;
+    uint32_t    depthBits;
+    uint32_t    stencilBits;
+    bool        fullscreen;
+    uint32_t    swapChainSize;
+    bool        vsyncEnabled;
+    uint32_t    vsyncInterval;
+    uint32_t    multiSamples;
+}
+LLGLRenderContextDescriptor;
+
+/* POD mirror of LLGL::Viewport */
+typedef struct LLGLViewport
+{
+    float   x, y;
+    float   width, height;
+    float   minDepth, maxDepth;
+}
+LLGLViewport;
+
+/* POD mirror of LLGL::Scissor */
+typedef struct LLGLScissor
+{
+    int32_t x, y;
+    int32_t width, height;
+}
+LLGLScissor;
+
+/* ----- Error handling ----- */
+
+/* Returns the message of the last failure on the calling thread, or an empty string */
+LLGL_C_API const char* llglGetLastError(void);
+
+/* ----- Render system ----- */
+
+/* Loads the render system module (e.g. "OpenGL", "Vulkan", "Direct3D11"); returns null on failure */
+LLGL_C_API llglRenderSystem llglLoadRenderSystem(const char* moduleName);
+LLGL_C_API void llglUnloadRenderSystem(llglRenderSystem renderSystem);
+
+LLGL_C_API int llglGetRendererID(llglRenderSystem renderSystem);
+LLGL_C_API const char* llglGetRendererName(llglRenderSystem renderSystem);
+
+/* ----- Render context ----- */
+
+LLGL_C_API llglRenderContext llglCreateRenderContext(llglRenderSystem renderSystem, const LLGLRenderContextDescriptor* desc);
+LLGL_C_API void llglReleaseRenderContext(llglRenderSystem renderSystem, llglRenderContext renderContext);
+
+LLGL_C_API LLGLResult llglPresent(llglRenderContext renderContext);
+
+/* ----- Command queue and command buffers ----- */
+
+LLGL_C_API llglCommandQueue llglGetCommandQueue(llglRenderSystem renderSystem);
+LLGL_C_API LLGLResult llglSubmitCommandBuffer(llglCommandQueue commandQueue, llglCommandBuffer commandBuffer);
+LLGL_C_API LLGLResult llglWaitIdle(llglCommandQueue commandQueue);
+
+LLGL_C_API llglCommandBuffer llglCreateCommandBuffer(llglRenderSystem renderSystem);
+LLGL_C_API void llglReleaseCommandBuffer(llglRenderSystem renderSystem, llglCommandBuffer commandBuffer);
+
+/* ----- Buffers ----- */
+
+LLGL_C_API llglBuffer llglCreateBuffer(llglRenderSystem renderSystem, const LLGLBufferDescriptor* desc, const void* initialData);
+LLGL_C_API void llglReleaseBuffer(llglRenderSystem renderSystem, llglBuffer buffer);
+
+LLGL_C_API LLGLResult llglWriteBuffer(llglRenderSystem renderSystem, llglBuffer dstBuffer, uint64_t dstOffset, const void* data, uint64_t dataSize);
+LLGL_C_API LLGLResult llglMapBuffer(llglRenderSystem renderSystem, llglBuffer buffer, LLGLCPUAccess access, void** outData);
+LLGL_C_API void llglUnmapBuffer(llglRenderSystem renderSystem, llglBuffer buffer);
+
+/* ----- Textures ----- */
+
+LLGL_C_API llglTexture llglCreateTexture(llglRenderSystem renderSystem, const LLGLTextureDescriptor* desc, const LLGLSrcImageDescriptor* imageDesc);
+LLGL_C_API void llglReleaseTexture(llglRenderSystem renderSystem, llglTexture texture);
+
+LLGL_C_API LLGLResult llglWriteTexture(llglRenderSystem renderSystem, llglTexture texture, const LLGLTextureRegion* region, const LLGLSrcImageDescriptor* imageDesc);
+
+/* ----- Samplers ----- */
+
+LLGL_C_API llglSampler llglCreateSampler(llglRenderSystem renderSystem, const LLGLSamplerDescriptor* desc);
+LLGL_C_API void llglReleaseSampler(llglRenderSystem renderSystem, llglSampler sampler);
+
+/* ----- Resource handles ----- */
+
+/* Upcasts for the resource heap creation; the returned handles do not own the object */
+LLGL_C_API llglResource llglGetBufferResource(llglBuffer buffer);
+LLGL_C_API llglResource llglGetTextureResource(llglTexture texture);
+LLGL_C_API llglResource llglGetSamplerResource(llglSampler sampler);
+
+/* ----- Pipeline layouts and resource heaps ----- */
+
+LLGL_C_API llglPipelineLayout llglCreatePipelineLayout(llglRenderSystem renderSystem, const LLGLBindingDescriptor* bindings, size_t numBindings);
+LLGL_C_API void llglReleasePipelineLayout(llglRenderSystem renderSystem, llglPipelineLayout pipelineLayout);
+
+LLGL_C_API llglResourceHeap llglCreateResourceHeap(llglRenderSystem renderSystem, llglPipelineLayout pipelineLayout, const llglResource* resources, size_t numResources);
+LLGL_C_API void llglReleaseResourceHeap(llglRenderSystem renderSystem, llglResourceHeap resourceHeap);
+
+/* ----- Shaders and shader programs ----- */
+
+LLGL_C_API llglShader llglCreateShader(llglRenderSystem renderSystem, const LLGLShaderDescriptor* desc);
+LLGL_C_API void llglReleaseShader(llglRenderSystem renderSystem, llglShader shader);
+
+LLGL_C_API bool llglHasShaderErrors(llglShader shader);
+/* Copies the shader compilation report into the output buffer (always null-terminated) and returns the full report length */
+LLGL_C_API size_t llglGetShaderReport(llglShader shader, char* output, size_t outputSize);
+
+LLGL_C_API llglShaderProgram llglCreateShaderProgram(llglRenderSystem renderSystem, const LLGLShaderProgramDescriptor* desc);
+LLGL_C_API void llglReleaseShaderProgram(llglRenderSystem renderSystem, llglShaderProgram shaderProgram);
+
+LLGL_C_API bool llglHasShaderProgramErrors(llglShaderProgram shaderProgram);
+LLGL_C_API size_t llglGetShaderProgramReport(llglShaderProgram shaderProgram, char* output, size_t outputSize);
+
+/* ----- Pipeline states ----- */
+
+LLGL_C_API llglGraphicsPipeline llglCreateGraphicsPipeline(llglRenderSystem renderSystem, const LLGLGraphicsPipelineDescriptor* desc);
+LLGL_C_API void llglReleaseGraphicsPipeline(llglRenderSystem renderSystem, llglGraphicsPipeline graphicsPipeline);
+
+LLGL_C_API llglComputePipeline llglCreateComputePipeline(llglRenderSystem renderSystem, const LLGLComputePipelineDescriptor* desc);
+LLGL_C_API void llglReleaseComputePipeline(llglRenderSystem renderSystem, llglComputePipeline computePipeline);
+
+/* ----- Command buffer encoding ----- */
+
+LLGL_C_API LLGLResult llglBegin(llglCommandBuffer commandBuffer);
+LLGL_C_API LLGLResult llglEnd(llglCommandBuffer commandBuffer);
+
+LLGL_C_API void llglBeginRenderPass(llglCommandBuffer commandBuffer, llglRenderContext renderContext);
+LLGL_C_API void llglEndRenderPass(llglCommandBuffer commandBuffer);
+
+LLGL_C_API void llglSetViewport(llglCommandBuffer commandBuffer, const LLGLViewport* viewport);
+LLGL_C_API void llglSetScissor(llglCommandBuffer commandBuffer, const LLGLScissor* scissor);
+
+LLGL_C_API void llglSetClearColor(llglCommandBuffer commandBuffer, float r, float g, float b, float a);
+LLGL_C_API void llglSetClearDepth(llglCommandBuffer commandBuffer, float depth);
+LLGL_C_API void llglSetClearStencil(llglCommandBuffer commandBuffer, uint32_t stencil);
+LLGL_C_API void llglClear(llglCommandBuffer commandBuffer, long flags);
+
+LLGL_C_API void llglSetVertexBuffer(llglCommandBuffer commandBuffer, llglBuffer buffer);
+LLGL_C_API void llglSetIndexBuffer(llglCommandBuffer commandBuffer, llglBuffer buffer);
+
+LLGL_C_API void llglSetGraphicsPipeline(llglCommandBuffer commandBuffer, llglGraphicsPipeline graphicsPipeline);
+LLGL_C_API void llglSetComputePipeline(llglCommandBuffer commandBuffer, llglComputePipeline computePipeline);
+
+LLGL_C_API void llglSetGraphicsResourceHeap(llglCommandBuffer commandBuffer, llglResourceHeap resourceHeap, uint32_t firstSet);
+LLGL_C_API void llglSetComputeResourceHeap(llglCommandBuffer commandBuffer, llglResourceHeap resourceHeap, uint32_t firstSet);
+
+LLGL_C_API void llglDraw(llglCommandBuffer commandBuffer, uint32_t numVertices, uint32_t firstVertex);
+LLGL_C_API void llglDrawIndexed(llglCommandBuffer commandBuffer, uint32_t numIndices, uint32_t firstIndex, int32_t vertexOffset);
+LLGL_C_API void llglDrawInstanced(llglCommandBuffer commandBuffer, uint32_t numVertices, uint32_t firstVertex, uint32_t numInstances, uint32_t firstInstance);
+LLGL_C_API void llglDrawIndexedInstanced(llglCommandBuffer commandBuffer, uint32_t numIndices, uint32_t numInstances, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance);
+
+LLGL_C_API void llglDispatch(llglCommandBuffer commandBuffer, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ);
+
+/* ----- Batched command encoding ----- */
+
+/*
+Token opcodes for llglExecuteCommandBatch. A batch is a stream of 32-bit tokens:
+each command is one opcode token followed by its argument tokens (see the comments below);
+float arguments are stored as their IEEE-754 bit patterns, handles as two tokens (low word first).
+Filling a token buffer on the FFI side and decoding it with a single call amortizes
+the per-call FFI overhead over whole passes.
+*/
+typedef enum LLGLCmdOpcode
+{
+    LLGL_CMD_SET_VIEWPORT = 1,          /* 6 tokens: x, y, width, height, minDepth, maxDepth (float bits) */
+    LLGL_CMD_SET_SCISSOR,               /* 4 tokens: x, y, width, height */
+    LLGL_CMD_SET_CLEAR_COLOR,           /* 4 tokens: r, g, b, a (float bits) */
+    LLGL_CMD_SET_CLEAR_DEPTH,           /* 1 token: depth (float bits) */
+    LLGL_CMD_SET_CLEAR_STENCIL,         /* 1 token: stencil */
+    LLGL_CMD_CLEAR,                     /* 1 token: flags */
+    LLGL_CMD_SET_VERTEX_BUFFER,         /* 2 tokens: llglBuffer handle */
+    LLGL_CMD_SET_INDEX_BUFFER,          /* 2 tokens: llglBuffer handle */
+    LLGL_CMD_SET_GRAPHICS_RESOURCE_HEAP,/* 3 tokens: llglResourceHeap handle, firstSet */
+    LLGL_CMD_SET_COMPUTE_RESOURCE_HEAP, /* 3 tokens: llglResourceHeap handle, firstSet */
+    LLGL_CMD_SET_GRAPHICS_PIPELINE,     /* 2 tokens: llglGraphicsPipeline handle */
+    LLGL_CMD_SET_COMPUTE_PIPELINE,      /* 2 tokens: llglComputePipeline handle */
+    LLGL_CMD_END_RENDER_PASS,           /* 0 tokens */
+    LLGL_CMD_DRAW,                      /* 2 tokens: numVertices, firstVertex */
+    LLGL_CMD_DRAW_INDEXED,              /* 3 tokens: numIndices, firstIndex, vertexOffset */
+    LLGL_CMD_DRAW_INSTANCED,            /* 4 tokens: numVertices, firstVertex, numInstances, firstInstance */
+    LLGL_CMD_DRAW_INDEXED_INSTANCED,    /* 5 tokens: numIndices, numInstances, firstIndex, vertexOffset, firstInstance */
+    LLGL_CMD_DISPATCH,                  /* 3 tokens: groupSizeX, groupSizeY, groupSizeZ */
+}
+LLGLCmdOpcode;
+
+/* Decodes the token stream into command buffer calls; stops at the first unknown opcode and returns the number of decoded commands */
+LLGL_C_API size_t llglExecuteCommandBatch(llglCommandBuffer commandBuffer, const uint32_t* tokens, size_t numTokens);
+
+
+#ifdef __cplusplus
+} /* /extern "C" */
+#endif
+
+
+#endif
+
+
+
+/* ================================================================================ */
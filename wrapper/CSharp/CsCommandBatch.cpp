@@ -0,0 +1,301 @@
+/*
+ * CsCommandBatch.cpp
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CsCommandBatch.h"
+#include <cstring>
+#include <cstdint>
+
+
+namespace SharpLLGL
+{
+
+
+static const int g_initialBatchCapacity = 1024;
+
+CommandBatch::CommandBatch() :
+    CommandBatch { g_initialBatchCapacity }
+{
+}
+
+CommandBatch::CommandBatch(int initialCapacity)
+{
+    tokens_ = gcnew array<unsigned int>(initialCapacity > 0 ? initialCapacity : g_initialBatchCapacity);
+}
+
+int CommandBatch::Count::get()
+{
+    return count_;
+}
+
+void CommandBatch::Reset()
+{
+    size_   = 0;
+    count_  = 0;
+}
+
+/* ----- Viewport and Scissor ----- */
+
+void CommandBatch::SetViewport(Viewport^ viewport)
+{
+    Emit(CommandBatchOpcode::SetViewport, 6);
+    PutFloat(viewport->X);
+    PutFloat(viewport->Y);
+    PutFloat(viewport->Width);
+    PutFloat(viewport->Height);
+    PutFloat(viewport->MinDepth);
+    PutFloat(viewport->MaxDepth);
+}
+
+void CommandBatch::SetScissor(Scissor^ scissor)
+{
+    Emit(CommandBatchOpcode::SetScissor, 4);
+    Put(static_cast<unsigned int>(scissor->X));
+    Put(static_cast<unsigned int>(scissor->Y));
+    Put(static_cast<unsigned int>(scissor->Width));
+    Put(static_cast<unsigned int>(scissor->Height));
+}
+
+/* ----- Clear ----- */
+
+void CommandBatch::SetClearColor(float r, float g, float b, float a)
+{
+    Emit(CommandBatchOpcode::SetClearColor, 4);
+    PutFloat(r);
+    PutFloat(g);
+    PutFloat(b);
+    PutFloat(a);
+}
+
+void CommandBatch::SetClearDepth(float depth)
+{
+    Emit(CommandBatchOpcode::SetClearDepth, 1);
+    PutFloat(depth);
+}
+
+void CommandBatch::SetClearStencil(unsigned int stencil)
+{
+    Emit(CommandBatchOpcode::SetClearStencil, 1);
+    Put(stencil);
+}
+
+void CommandBatch::Clear(ClearFlags flags)
+{
+    Emit(CommandBatchOpcode::Clear, 1);
+    Put(static_cast<unsigned int>(flags));
+}
+
+/* ----- Input Assembly ------ */
+
+void CommandBatch::SetVertexBuffer(Buffer^ buffer)
+{
+    Emit(CommandBatchOpcode::SetVertexBuffer, 2);
+    PutPointer(buffer->NativeSub);
+}
+
+void CommandBatch::SetVertexBufferArray(BufferArray^ bufferArray)
+{
+    Emit(CommandBatchOpcode::SetVertexBufferArray, 2);
+    PutPointer(bufferArray->Native);
+}
+
+void CommandBatch::SetIndexBuffer(Buffer^ buffer)
+{
+    Emit(CommandBatchOpcode::SetIndexBuffer, 2);
+    PutPointer(buffer->NativeSub);
+}
+
+/* ----- Resource Heaps ----- */
+
+void CommandBatch::SetGraphicsResourceHeap(ResourceHeap^ resourceHeap)
+{
+    SetGraphicsResourceHeap(resourceHeap, 0);
+}
+
+void CommandBatch::SetGraphicsResourceHeap(ResourceHeap^ resourceHeap, unsigned int firstSet)
+{
+    Emit(CommandBatchOpcode::SetGraphicsResourceHeap, 3);
+    PutPointer(resourceHeap->Native);
+    Put(firstSet);
+}
+
+void CommandBatch::SetComputeResourceHeap(ResourceHeap^ resourceHeap)
+{
+    SetComputeResourceHeap(resourceHeap, 0);
+}
+
+void CommandBatch::SetComputeResourceHeap(ResourceHeap^ resourceHeap, unsigned int firstSet)
+{
+    Emit(CommandBatchOpcode::SetComputeResourceHeap, 3);
+    PutPointer(resourceHeap->Native);
+    Put(firstSet);
+}
+
+/* ----- Render Passes ----- */
+
+void CommandBatch::EndRenderPass()
+{
+    Emit(CommandBatchOpcode::EndRenderPass, 0);
+}
+
+/* ----- Pipeline States ----- */
+
+void CommandBatch::SetGraphicsPipeline(GraphicsPipeline^ graphicsPipeline)
+{
+    Emit(CommandBatchOpcode::SetGraphicsPipeline, 2);
+    PutPointer(graphicsPipeline->Native);
+}
+
+void CommandBatch::SetComputePipeline(ComputePipeline^ computePipeline)
+{
+    Emit(CommandBatchOpcode::SetComputePipeline, 2);
+    PutPointer(computePipeline->Native);
+}
+
+/* ----- Drawing ----- */
+
+void CommandBatch::Draw(unsigned int numVertices, unsigned int firstVertex)
+{
+    Emit(CommandBatchOpcode::Draw, 2);
+    Put(numVertices);
+    Put(firstVertex);
+}
+
+void CommandBatch::DrawIndexed(unsigned int numIndices, unsigned int firstIndex)
+{
+    Emit(CommandBatchOpcode::DrawIndexed, 2);
+    Put(numIndices);
+    Put(firstIndex);
+}
+
+void CommandBatch::DrawIndexed(unsigned int numIndices, unsigned int firstIndex, int vertexOffset)
+{
+    Emit(CommandBatchOpcode::DrawIndexedOffset, 3);
+    Put(numIndices);
+    Put(firstIndex);
+    Put(static_cast<unsigned int>(vertexOffset));
+}
+
+void CommandBatch::DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances)
+{
+    Emit(CommandBatchOpcode::DrawInstanced, 3);
+    Put(numVertices);
+    Put(firstVertex);
+    Put(numInstances);
+}
+
+void CommandBatch::DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int firstInstance)
+{
+    Emit(CommandBatchOpcode::DrawInstancedOffset, 4);
+    Put(numVertices);
+    Put(firstVertex);
+    Put(numInstances);
+    Put(firstInstance);
+}
+
+void CommandBatch::DrawIndexedInstanced(unsigned int numIndices, unsigned int numInstances, unsigned int firstIndex)
+{
+    Emit(CommandBatchOpcode::DrawIndexedInstanced, 3);
+    Put(numIndices);
+    Put(numInstances);
+    Put(firstIndex);
+}
+
+void CommandBatch::DrawIndexedInstanced(unsigned int numIndices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset)
+{
+    Emit(CommandBatchOpcode::DrawIndexedInstancedOffset, 4);
+    Put(numIndices);
+    Put(numInstances);
+    Put(firstIndex);
+    Put(static_cast<unsigned int>(vertexOffset));
+}
+
+void CommandBatch::DrawIndexedInstanced(unsigned int numIndices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int firstInstance)
+{
+    Emit(CommandBatchOpcode::DrawIndexedInstancedBase, 5);
+    Put(numIndices);
+    Put(numInstances);
+    Put(firstIndex);
+    Put(static_cast<unsigned int>(vertexOffset));
+    Put(firstInstance);
+}
+
+/* ----- Compute ----- */
+
+void CommandBatch::Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ)
+{
+    Emit(CommandBatchOpcode::Dispatch, 3);
+    Put(groupSizeX);
+    Put(groupSizeY);
+    Put(groupSizeZ);
+}
+
+
+/*
+ * ======= Internal: =======
+ */
+
+array<unsigned int>^ CommandBatch::Tokens::get()
+{
+    return tokens_;
+}
+
+int CommandBatch::Size::get()
+{
+    return size_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void CommandBatch::Reserve(int numTokens)
+{
+    if (size_ + numTokens > tokens_->Length)
+    {
+        int newCapacity = tokens_->Length * 2;
+        while (size_ + numTokens > newCapacity)
+            newCapacity *= 2;
+
+        auto newTokens = tokens_;
+        Array::Resize(newTokens, newCapacity);
+        tokens_ = newTokens;
+    }
+}
+
+void CommandBatch::Put(unsigned int value)
+{
+    tokens_[size_++] = value;
+}
+
+void CommandBatch::PutFloat(float value)
+{
+    unsigned int bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    Put(bits);
+}
+
+void CommandBatch::PutPointer(void* pointer)
+{
+    auto bits = reinterpret_cast<std::uintptr_t>(pointer);
+    Put(static_cast<unsigned int>(bits));
+    Put(static_cast<unsigned int>(static_cast<std::uint64_t>(bits) >> 32));
+}
+
+void CommandBatch::Emit(CommandBatchOpcode opcode, int numTokens)
+{
+    Reserve(1 + numTokens);
+    Put(static_cast<unsigned int>(opcode));
+    ++count_;
+}
+
+
+} // /namespace SharpLLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,165 @@
+/*
+ * CsCommandBatch.h
+ *
+ * This file is part of the "LLGL" project (Copyright (c) 2015-2019 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#pragma once
+
+#include <vcclr.h>
+#include "CsTypes.h"
+#include "CsRenderSystemChilds.h"
+#include "CsCommandBufferFlags.h"
+#include "CsGraphicsPipelineFlags.h"
+
+#using <System.dll>
+#using <System.Core.dll>
+#using <System.Runtime.InteropServices.dll>
+
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+
+namespace SharpLLGL
+{
+
+
+// Token opcodes for batched command recording (see CommandBatch and CommandBuffer::ExecuteBatch)
+enum class CommandBatchOpcode : unsigned int
+{
+    SetViewport = 1,            // 6 tokens: x, y, width, height, minDepth, maxDepth (float bits)
+    SetScissor,                 // 4 tokens: x, y, width, height
+    SetClearColor,              // 4 tokens: r, g, b, a (float bits)
+    SetClearDepth,              // 1 token: depth (float bits)
+    SetClearStencil,            // 1 token: stencil
+    Clear,                      // 1 token: flags
+    SetVertexBuffer,            // 2 tokens: native pointer
+    SetVertexBufferArray,       // 2 tokens: native pointer
+    SetIndexBuffer,             // 2 tokens: native pointer
+    SetGraphicsResourceHeap,    // 3 tokens: native pointer, firstSet
+    SetComputeResourceHeap,     // 3 tokens: native pointer, firstSet
+    SetGraphicsPipeline,        // 2 tokens: native pointer
+    SetComputePipeline,         // 2 tokens: native pointer
+    EndRenderPass,              // 0 tokens
+    Draw,                       // 2 tokens: numVertices, firstVertex
+    DrawIndexed,                // 2 tokens: numIndices, firstIndex
+    DrawIndexedOffset,          // 3 tokens: numIndices, firstIndex, vertexOffset
+    DrawInstanced,              // 3 tokens: numVertices, firstVertex, numInstances
+    DrawInstancedOffset,        // 4 tokens: numVertices, firstVertex, numInstances, firstInstance
+    DrawIndexedInstanced,       // 3 tokens: numIndices, numInstances, firstIndex
+    DrawIndexedInstancedOffset, // 4 tokens: numIndices, numInstances, firstIndex, vertexOffset
+    DrawIndexedInstancedBase,   // 5 tokens: numIndices, numInstances, firstIndex, vertexOffset, firstInstance
+    Dispatch,                   // 3 tokens: groupSizeX, groupSizeY, groupSizeZ
+};
+
+/// <summary>
+/// Managed command recorder that encodes CommandBuffer calls into a token buffer.
+/// Recording runs entirely in managed code; a single call to CommandBuffer::ExecuteBatch
+/// decodes all tokens natively, amortizing the managed/native transition over whole passes.
+/// </summary>
+public ref class CommandBatch
+{
+
+    public:
+
+        /* ----- Common ----- */
+
+        CommandBatch();
+        CommandBatch(int initialCapacity);
+
+        /// <summary>Returns the number of encoded commands.</summary>
+        property int Count
+        {
+            int get();
+        }
+
+        /// <summary>Discards all encoded commands, so the token buffer can be reused.</summary>
+        void Reset();
+
+        /* ----- Viewport and Scissor ----- */
+
+        void SetViewport(Viewport^ viewport);
+        void SetScissor(Scissor^ scissor);
+
+        /* ----- Clear ----- */
+
+        void SetClearColor(float r, float g, float b, float a);
+        void SetClearDepth(float depth);
+        void SetClearStencil(unsigned int stencil);
+
+        void Clear(ClearFlags flags);
+
+        /* ----- Input Assembly ------ */
+
+        void SetVertexBuffer(Buffer^ buffer);
+        void SetVertexBufferArray(BufferArray^ bufferArray);
+        void SetIndexBuffer(Buffer^ buffer);
+
+        /* ----- Resource Heaps ----- */
+
+        void SetGraphicsResourceHeap(ResourceHeap^ resourceHeap);
+        void SetGraphicsResourceHeap(ResourceHeap^ resourceHeap, unsigned int firstSet);
+
+        void SetComputeResourceHeap(ResourceHeap^ resourceHeap);
+        void SetComputeResourceHeap(ResourceHeap^ resourceHeap, unsigned int firstSet);
+
+        /* ----- Render Passes ----- */
+
+        void EndRenderPass();
+
+        /* ----- Pipeline States ----- */
+
+        void SetGraphicsPipeline(GraphicsPipeline^ graphicsPipeline);
+        void SetComputePipeline(ComputePipeline^ computePipeline);
+
+        /* ----- Drawing ----- */
+
+        void Draw(unsigned int numVertices, unsigned int firstVertex);
+        void DrawIndexed(unsigned int numIndices, unsigned int firstIndex);
+        void DrawIndexed(unsigned int numIndices, unsigned int firstIndex, int vertexOffset);
+        void DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances);
+        void DrawInstanced(unsigned int numVertices, unsigned int firstVertex, unsigned int numInstances, unsigned int firstInstance);
+        void DrawIndexedInstanced(unsigned int numIndices, unsigned int numInstances, unsigned int firstIndex);
+        void DrawIndexedInstanced(unsigned int numIndices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset);
+        void DrawIndexedInstanced(unsigned int numIndices, unsigned int numInstances, unsigned int firstIndex, int vertexOffset, unsigned int firstInstance);
+
+        /* ----- Compute ----- */
+
+        void Dispatch(unsigned int groupSizeX, unsigned int groupSizeY, unsigned int groupSizeZ);
+
+    internal:
+
+        property array<unsigned int>^ Tokens
+        {
+            array<unsigned int>^ get();
+        }
+
+        property int Size
+        {
+            int get();
+        }
+
+    private:
+
+        void Reserve(int numTokens);
+
+        void Put(unsigned int value);
+        void PutFloat(float value);
+        void PutPointer(void* pointer);
+
+        void Emit(CommandBatchOpcode opcode, int numTokens);
+
+        array<unsigned int>^    tokens_;
+        int                     size_   = 0;
+        int                     count_  = 0;
+
+};
+
+
+} // /namespace SharpLLGL
+
+
+
+// ================================================================================
@@ -7,6 +7,7 @@
 
 #include "CsCommandBuffer.h"
 #include <algorithm>
+#include <cstdint>
 
 
 namespace SharpLLGL
@@ -55,6 +56,227 @@ void CommandBuffer::End()
     native_->End();
 }
 
+/*
+Decodes a command token stream (see CsCommandBatch.h for the token layouts).
+The entire loop runs on the native side with the token buffer pinned once,
+so the managed/native transition is paid per batch instead of per command.
+*/
+static const std::uint32_t* ExecuteBatchTokens(LLGL::CommandBuffer& cmdBuffer, const std::uint32_t* tokens, const std::uint32_t* tokensEnd)
+{
+    union
+    {
+        std::uint32_t   u32;
+        float           f32;
+    } word;
+
+    auto NextUInt = [&tokens]() -> std::uint32_t
+    {
+        return *tokens++;
+    };
+
+    auto NextFloat = [&]() -> float
+    {
+        word.u32 = *tokens++;
+        return word.f32;
+    };
+
+    auto NextPointer = [&tokens]() -> void*
+    {
+        std::uint64_t bits = tokens[0];
+        bits |= (static_cast<std::uint64_t>(tokens[1]) << 32);
+        tokens += 2;
+        return reinterpret_cast<void*>(static_cast<std::uintptr_t>(bits));
+    };
+
+    while (tokens < tokensEnd)
+    {
+        switch (static_cast<CommandBatchOpcode>(NextUInt()))
+        {
+            case CommandBatchOpcode::SetViewport:
+            {
+                LLGL::Viewport viewport;
+                {
+                    viewport.x          = NextFloat();
+                    viewport.y          = NextFloat();
+                    viewport.width      = NextFloat();
+                    viewport.height     = NextFloat();
+                    viewport.minDepth   = NextFloat();
+                    viewport.maxDepth   = NextFloat();
+                }
+                cmdBuffer.SetViewport(viewport);
+            }
+            break;
+
+            case CommandBatchOpcode::SetScissor:
+            {
+                LLGL::Scissor scissor;
+                {
+                    scissor.x       = static_cast<std::int32_t>(NextUInt());
+                    scissor.y       = static_cast<std::int32_t>(NextUInt());
+                    scissor.width   = static_cast<std::int32_t>(NextUInt());
+                    scissor.height  = static_cast<std::int32_t>(NextUInt());
+                }
+                cmdBuffer.SetScissor(scissor);
+            }
+            break;
+
+            case CommandBatchOpcode::SetClearColor:
+            {
+                LLGL::ColorRGBAf color;
+                {
+                    color.r = NextFloat();
+                    color.g = NextFloat();
+                    color.b = NextFloat();
+                    color.a = NextFloat();
+                }
+                cmdBuffer.SetClearColor(color);
+            }
+            break;
+
+            case CommandBatchOpcode::SetClearDepth:
+                cmdBuffer.SetClearDepth(NextFloat());
+                break;
+
+            case CommandBatchOpcode::SetClearStencil:
+                cmdBuffer.SetClearStencil(NextUInt());
+                break;
+
+            case CommandBatchOpcode::Clear:
+                cmdBuffer.Clear(static_cast<long>(NextUInt()));
+                break;
+
+            case CommandBatchOpcode::SetVertexBuffer:
+                cmdBuffer.SetVertexBuffer(*reinterpret_cast<LLGL::Buffer*>(NextPointer()));
+                break;
+
+            case CommandBatchOpcode::SetVertexBufferArray:
+                cmdBuffer.SetVertexBufferArray(*reinterpret_cast<LLGL::BufferArray*>(NextPointer()));
+                break;
+
+            case CommandBatchOpcode::SetIndexBuffer:
+                cmdBuffer.SetIndexBuffer(*reinterpret_cast<LLGL::Buffer*>(NextPointer()));
+                break;
+
+            case CommandBatchOpcode::SetGraphicsResourceHeap:
+            {
+                auto resourceHeap = reinterpret_cast<LLGL::ResourceHeap*>(NextPointer());
+                cmdBuffer.SetGraphicsResourceHeap(*resourceHeap, NextUInt());
+            }
+            break;
+
+            case CommandBatchOpcode::SetComputeResourceHeap:
+            {
+                auto resourceHeap = reinterpret_cast<LLGL::ResourceHeap*>(NextPointer());
+                cmdBuffer.SetComputeResourceHeap(*resourceHeap, NextUInt());
+            }
+            break;
+
+            case CommandBatchOpcode::SetGraphicsPipeline:
+                cmdBuffer.SetGraphicsPipeline(*reinterpret_cast<LLGL::GraphicsPipeline*>(NextPointer()));
+                break;
+
+            case CommandBatchOpcode::SetComputePipeline:
+                cmdBuffer.SetComputePipeline(*reinterpret_cast<LLGL::ComputePipeline*>(NextPointer()));
+                break;
+
+            case CommandBatchOpcode::EndRenderPass:
+                cmdBuffer.EndRenderPass();
+                break;
+
+            case CommandBatchOpcode::Draw:
+            {
+                auto numVertices = NextUInt();
+                cmdBuffer.Draw(numVertices, NextUInt());
+            }
+            break;
+
+            case CommandBatchOpcode::DrawIndexed:
+            {
+                auto numIndices = NextUInt();
+                cmdBuffer.DrawIndexed(numIndices, NextUInt());
+            }
+            break;
+
+            case CommandBatchOpcode::DrawIndexedOffset:
+            {
+                auto numIndices = NextUInt();
+                auto firstIndex = NextUInt();
+                cmdBuffer.DrawIndexed(numIndices, firstIndex, static_cast<std::int32_t>(NextUInt()));
+            }
+            break;
+
+            case CommandBatchOpcode::DrawInstanced:
+            {
+                auto numVertices    = NextUInt();
+                auto firstVertex    = NextUInt();
+                cmdBuffer.DrawInstanced(numVertices, firstVertex, NextUInt());
+            }
+            break;
+
+            case CommandBatchOpcode::DrawInstancedOffset:
+            {
+                auto numVertices    = NextUInt();
+                auto firstVertex    = NextUInt();
+                auto numInstances   = NextUInt();
+                cmdBuffer.DrawInstanced(numVertices, firstVertex, numInstances, NextUInt());
+            }
+            break;
+
+            case CommandBatchOpcode::DrawIndexedInstanced:
+            {
+                auto numIndices     = NextUInt();
+                auto numInstances   = NextUInt();
+                cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, NextUInt());
+            }
+            break;
+
+            case CommandBatchOpcode::DrawIndexedInstancedOffset:
+            {
+                auto numIndices     = NextUInt();
+                auto numInstances   = NextUInt();
+                auto firstIndex     = NextUInt();
+                cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, static_cast<std::int32_t>(NextUInt()));
+            }
+            break;
+
+            case CommandBatchOpcode::DrawIndexedInstancedBase:
+            {
+                auto numIndices     = NextUInt();
+                auto numInstances   = NextUInt();
+                auto firstIndex     = NextUInt();
+                auto vertexOffset   = static_cast<std::int32_t>(NextUInt());
+                cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, NextUInt());
+            }
+            break;
+
+            case CommandBatchOpcode::Dispatch:
+            {
+                auto groupSizeX = NextUInt();
+                auto groupSizeY = NextUInt();
+                cmdBuffer.Dispatch(groupSizeX, groupSizeY, NextUInt());
+            }
+            break;
+
+            default:
+                /* Stop decoding on an unknown opcode, since the following tokens cannot be interpreted */
+                return tokens;
+        }
+    }
+
+    return tokens;
+}
+
+void CommandBuffer::ExecuteBatch(CommandBatch^ batch)
+{
+    auto size = batch->Size;
+    if (size > 0)
+    {
+        pin_ptr<unsigned int> tokensRef = &(batch->Tokens[0]);
+        const std::uint32_t* tokens = tokensRef;
+        ExecuteBatchTokens(*native_, tokens, tokens + size);
+    }
+}
+
 generic <typename T>
 void CommandBuffer::UpdateBuffer(Buffer^ dstBuffer, System::UInt64 dstOffset, array<T>^ data)
 {
@@ -15,6 +15,7 @@
 #include "CsGraphicsPipelineFlags.h"
 #include "CsRenderTarget.h"
 #include "CsColor.h"
+#include "CsCommandBatch.h"
 
 #using <System.dll>
 #using <System.Core.dll>
@@ -50,6 +51,12 @@ public ref class CommandBuffer
         void Begin();
         void End();
 
+        /// <summary>
+        /// Decodes all commands of the specified batch with a single managed/native transition.
+        /// The batch is not reset, so it can be executed again or extended afterwards.
+        /// </summary>
+        void ExecuteBatch(CommandBatch^ batch);
+
         generic <typename T>
         void UpdateBuffer(Buffer^ dstBuffer, System::UInt64 dstOffset, array<T>^ data);
 
@@ -418,6 +418,28 @@ void RenderSystem::WriteBuffer(Buffer^ dstBuffer, System::UInt64 dstOffset, Syst
     native_->WriteBuffer(*(dstBuffer->NativeSub), dstOffset, data.ToPointer(), dataSize);
 }
 
+generic <typename T>
+void RenderSystem::WriteBuffer(Buffer^ dstBuffer, System::UInt64 dstOffset, array<T>^ data)
+{
+    WriteBuffer(dstBuffer, dstOffset, data, 0, data->Length);
+}
+
+generic <typename T>
+void RenderSystem::WriteBuffer(Buffer^ dstBuffer, System::UInt64 dstOffset, array<T>^ data, int firstElement, int numElements)
+{
+    if (firstElement >= 0 && numElements > 0 && firstElement + numElements <= data->Length)
+    {
+        /* Pin array range and pass it to the native entry point without an intermediate copy */
+        pin_ptr<T> dataRef = &data[firstElement];
+        native_->WriteBuffer(
+            *(dstBuffer->NativeSub),
+            dstOffset,
+            dataRef,
+            static_cast<std::uint64_t>(numElements) * sizeof(T)
+        );
+    }
+}
+
 System::IntPtr RenderSystem::MapBuffer(Buffer^ buffer, CPUAccess access)
 {
     return System::IntPtr(native_->MapBuffer(*(buffer->NativeSub), static_cast<LLGL::CPUAccess>(access)));
@@ -479,8 +501,59 @@ void RenderSystem::Release(Texture^ texture)
     native_->Release(*texture->NativeSub);
 }
 
+static void Convert(LLGL::Offset3D& dst, Offset3D^ src)
+{
+    if (src)
+    {
+        dst.x = src->X;
+        dst.y = src->Y;
+        dst.z = src->Z;
+    }
+}
+
+static void Convert(LLGL::TextureSubresource& dst, TextureSubresource^ src)
+{
+    if (src)
+    {
+        dst.baseArrayLayer  = src->BaseArrayLayer;
+        dst.numArrayLayers  = src->NumArrayLayers;
+        dst.baseMipLevel    = src->BaseMipLevel;
+        dst.numMipLevels    = src->NumMipLevels;
+    }
+}
+
+static void Convert(LLGL::TextureRegion& dst, TextureRegion^ src)
+{
+    if (src)
+    {
+        Convert(dst.subresource, src->Subresource);
+        Convert(dst.offset, src->Offset);
+        Convert(dst.extent, src->Extent);
+    }
+}
+
+generic <typename T>
+void RenderSystem::WriteTexture(Texture^ texture, TextureRegion^ textureRegion, SrcImageDescriptor<T>^ imageDesc)
+{
+    if (imageDesc != nullptr)
+    {
+        LLGL::TextureRegion nativeRegion;
+        Convert(nativeRegion, textureRegion);
+
+        /* Pin image data and pass it to the native entry point without an intermediate copy */
+        pin_ptr<T> imageDataRef = &(imageDesc->Data[0]);
+        LLGL::SrcImageDescriptor nativeImageDesc;
+        {
+            nativeImageDesc.format      = static_cast<LLGL::ImageFormat>(imageDesc->Format);
+            nativeImageDesc.dataType    = static_cast<LLGL::DataType>(imageDesc->DataType);
+            nativeImageDesc.data        = imageDataRef;
+            nativeImageDesc.dataSize    = static_cast<std::size_t>(imageDesc->Data->Length) * sizeof(T);
+        }
+        native_->WriteTexture(*(texture->NativeSub), nativeRegion, nativeImageDesc);
+    }
+}
+
 #if 0
-void RenderSystem::WriteTexture(Texture^ texture, SubTextureDescriptor^ subTextureDesc, SrcImageDescriptor^ imageDesc);
 void RenderSystem::ReadTexture(Texture^ texture, unsigned int mipLevel, DstImageDescriptor^ imageDesc);
 #endif
 
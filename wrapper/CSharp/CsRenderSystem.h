@@ -148,6 +148,14 @@ public ref class RenderSystem
 
         void WriteBuffer(Buffer^ dstBuffer, System::UInt64 dstOffset, System::IntPtr data, System::UInt64 dataSize);
 
+        /// <summary>Writes the entire array into the destination buffer; the data is pinned and passed to the native entry point without an intermediate copy.</summary>
+        generic <typename T>
+        void WriteBuffer(Buffer^ dstBuffer, System::UInt64 dstOffset, array<T>^ data);
+
+        /// <summary>Writes the specified array range into the destination buffer; the data is pinned and passed to the native entry point without an intermediate copy.</summary>
+        generic <typename T>
+        void WriteBuffer(Buffer^ dstBuffer, System::UInt64 dstOffset, array<T>^ data, int firstElement, int numElements);
+
         System::IntPtr MapBuffer(Buffer^ buffer, CPUAccess access);
 
         void UnmapBuffer(Buffer^ buffer);
@@ -161,10 +169,11 @@ public ref class RenderSystem
 
         void Release(Texture^ texture);
 
-        #if 0
+        /// <summary>Writes the image data into the specified texture region; the data is pinned and passed to the native entry point without an intermediate copy.</summary>
         generic <typename T>
         void WriteTexture(Texture^ texture, TextureRegion^ textureRegion, SrcImageDescriptor<T>^ imageDesc);
 
+        #if 0
         generic <typename T>
         void ReadTexture(Texture^ texture, unsigned int mipLevel, DstImageDescriptor<T>^ imageDesc);
         #endif
@@ -25,6 +25,51 @@ TextureDescriptor::TextureDescriptor()
     Samples         = 1;
 }
 
+TextureSubresource::TextureSubresource()
+{
+    BaseArrayLayer  = 0;
+    NumArrayLayers  = 1;
+    BaseMipLevel    = 0;
+    NumMipLevels    = 1;
+}
+
+TextureSubresource::TextureSubresource(unsigned int baseArrayLayer, unsigned int baseMipLevel)
+{
+    BaseArrayLayer  = baseArrayLayer;
+    NumArrayLayers  = 1;
+    BaseMipLevel    = baseMipLevel;
+    NumMipLevels    = 1;
+}
+
+TextureSubresource::TextureSubresource(unsigned int baseArrayLayer, unsigned int numArrayLayers, unsigned int baseMipLevel, unsigned int numMipLevels)
+{
+    BaseArrayLayer  = baseArrayLayer;
+    NumArrayLayers  = numArrayLayers;
+    BaseMipLevel    = baseMipLevel;
+    NumMipLevels    = numMipLevels;
+}
+
+TextureRegion::TextureRegion()
+{
+    Subresource = gcnew TextureSubresource();
+    Offset      = gcnew Offset3D();
+    Extent      = gcnew Extent3D();
+}
+
+TextureRegion::TextureRegion(Offset3D^ offset, Extent3D^ extent)
+{
+    Subresource = gcnew TextureSubresource();
+    Offset      = offset;
+    Extent      = extent;
+}
+
+TextureRegion::TextureRegion(TextureSubresource^ subresource, Offset3D^ offset, Extent3D^ extent)
+{
+    Subresource = subresource;
+    Offset      = offset;
+    Extent      = extent;
+}
+
 
 } // /namespace SharpLLGL
 
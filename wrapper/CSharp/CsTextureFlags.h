@@ -64,6 +64,37 @@ public ref class TextureDescriptor
 
 };
 
+public ref class TextureSubresource
+{
+
+    public:
+
+        TextureSubresource();
+        TextureSubresource(unsigned int baseArrayLayer, unsigned int baseMipLevel);
+        TextureSubresource(unsigned int baseArrayLayer, unsigned int numArrayLayers, unsigned int baseMipLevel, unsigned int numMipLevels);
+
+        property unsigned int   BaseArrayLayer;
+        property unsigned int   NumArrayLayers;
+        property unsigned int   BaseMipLevel;
+        property unsigned int   NumMipLevels;
+
+};
+
+public ref class TextureRegion
+{
+
+    public:
+
+        TextureRegion();
+        TextureRegion(Offset3D^ offset, Extent3D^ extent);
+        TextureRegion(TextureSubresource^ subresource, Offset3D^ offset, Extent3D^ extent);
+
+        property TextureSubresource^    Subresource;
+        property Offset3D^              Offset;
+        property Extent3D^              Extent;
+
+};
+
 
 } // /namespace SharpLLGL
 